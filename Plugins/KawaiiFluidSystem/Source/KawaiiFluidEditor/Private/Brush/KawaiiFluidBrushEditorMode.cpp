@@ -1,9 +1,12 @@
 // Copyright 2026 Team_Bruteforce. All Rights Reserved.
 
 #include "Brush/KawaiiFluidBrushEditorMode.h"
+#include "Brush/KawaiiFluidBrushStrokeChange.h"
 #include "Components/KawaiiFluidVolumeComponent.h"
 #include "Actors/KawaiiFluidVolume.h"
 #include "Modules/KawaiiFluidSimulationModule.h"
+#include "Data/KawaiiFluidPresetDataAsset.h"
+#include "Core/KawaiiFluidBrushSampler.h"
 #include "EditorViewportClient.h"
 #include "EngineUtils.h"
 #include "Engine/Engine.h"
@@ -15,6 +18,7 @@
 #include "Editor.h"
 #include "Framework/Application/SlateApplication.h"
 #include "ScopedTransaction.h"
+#include "Misc/ITransaction.h"
 #include "Selection.h"
 
 #define LOCTEXT_NAMESPACE "KawaiiFluidBrushEditorMode"
@@ -136,7 +140,7 @@ bool FKawaiiFluidBrushEditorMode::InputKey(FEditorViewportClient* ViewportClient
 		if (Event == IE_Pressed)
 		{
 			bPainting = true;
-			LastStrokeTime = 0.0;
+			BeginStroke();
 
 			if (bValidLocation)
 			{
@@ -147,6 +151,7 @@ bool FKawaiiFluidBrushEditorMode::InputKey(FEditorViewportClient* ViewportClient
 		else if (Event == IE_Released)
 		{
 			bPainting = false;
+			StrokeSamples.Empty();
 			return true;
 		}
 	}
@@ -483,24 +488,92 @@ void FKawaiiFluidBrushEditorMode::ApplyBrush()
 	}
 	LastStrokeTime = Now;
 
-	TargetVolume->Modify();
+	UKawaiiFluidSimulationModule* Module = TargetVolume->GetSimulationModule();
+	if (!Module)
+	{
+		return;
+	}
+
+	// Record only the particles this stroke touches instead of snapshotting the volume (Modify)
+	FKawaiiFluidBrushStrokeDelta Delta;
 	switch (Settings.Mode)
 	{
 		case EFluidBrushMode::Add:
-			TargetVolume->AddParticlesInRadius(
+		{
+			// Coalesce: the stroke covers the path swept since the previous stroke of this drag
+			const FKawaiiFluidBrushSampleRegion Region(
+				bHasLastStroke ? LastStrokeLocation : BrushLocation,
 				BrushLocation,
 				Settings.Radius,
+				BrushNormal
+			);
+
+			TArray<FVector> SpawnPositions;
+			TargetVolume->ComputeBrushSpawnPositions(
+				Region,
 				Settings.ParticlesPerStroke,
-				Settings.InitialVelocity,
 				Settings.Randomness,
-				BrushNormal
+				StrokeSeed++,
+				Settings.bFillEmptySpace,
+				StrokeSamples,
+				SpawnPositions
 			);
+			StrokeSamples.Append(SpawnPositions);
+
+			const UKawaiiFluidPresetDataAsset* Preset = Module->GetPreset();
+			const float Mass = Preset ? Preset->ParticleMass : 1.0f;
+			if (!Delta.ApplyAdd(*Module, SpawnPositions, Settings.InitialVelocity, Mass))
+			{
+				// No simulator to allocate IDs from yet: spawn without an undo record
+				for (const FVector& SpawnPos : SpawnPositions)
+				{
+					Module->SpawnParticle(SpawnPos, Settings.InitialVelocity);
+				}
+				TargetVolume->MarkPackageDirty();
+			}
 			break;
+		}
 
 		case EFluidBrushMode::Remove:
-			TargetVolume->RemoveParticlesInRadiusGPU(BrushLocation, Settings.Radius);
+			if (!Delta.ApplyRemove(*Module, BrushLocation, Settings.Radius))
+			{
+				// No particle readback yet: remove on the GPU without an undo record
+				TargetVolume->RemoveParticlesInRadiusGPU(BrushLocation, Settings.Radius);
+				TargetVolume->MarkPackageDirty();
+			}
 			break;
 	}
+
+	LastStrokeLocation = BrushLocation;
+	bHasLastStroke = true;
+
+	if (Delta.IsEmpty())
+	{
+		return;
+	}
+
+	FScopedTransaction Transaction(Settings.Mode == EFluidBrushMode::Add
+		? LOCTEXT("BrushAddTransaction", "Fluid Brush: Add Particles")
+		: LOCTEXT("BrushRemoveTransaction", "Fluid Brush: Remove Particles"));
+	if (GUndo)
+	{
+		GUndo->StoreUndo(TargetVolume.Get(), MakeUnique<FKawaiiFluidBrushStrokeChange>(MoveTemp(Delta)));
+	}
+
+	// StoreUndo with a change object doesn't dirty the package the way Modify() does
+	TargetVolume->MarkPackageDirty();
+}
+
+/**
+ * @brief Starts a new drag: the first stroke has no previous location and the seed sequence restarts.
+ */
+void FKawaiiFluidBrushEditorMode::BeginStroke()
+{
+	LastStrokeTime = 0.0;
+	LastStrokeLocation = BrushLocation;
+	bHasLastStroke = false;
+	StrokeSamples.Reset();
+	StrokeSeed = 0;
 }
 
 /**
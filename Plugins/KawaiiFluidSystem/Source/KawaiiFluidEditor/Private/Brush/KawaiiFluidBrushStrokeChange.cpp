@@ -0,0 +1,68 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Brush/KawaiiFluidBrushStrokeChange.h"
+#include "Actors/KawaiiFluidVolume.h"
+#include "Modules/KawaiiFluidSimulationModule.h"
+
+namespace
+{
+	UKawaiiFluidSimulationModule* GetStrokeTarget(UObject* Object)
+	{
+		const AKawaiiFluidVolume* Volume = Cast<AKawaiiFluidVolume>(Object);
+		return Volume ? Volume->GetSimulationModule() : nullptr;
+	}
+}
+
+/**
+ * @brief Takes ownership of a recorded stroke.
+ * @param InDelta The stroke's added/removed particles
+ */
+FKawaiiFluidBrushStrokeChange::FKawaiiFluidBrushStrokeChange(FKawaiiFluidBrushStrokeDelta&& InDelta)
+	: Delta(MoveTemp(InDelta))
+{
+}
+
+/**
+ * @brief Redoes the stroke (respawn added, despawn removed).
+ * @param Object The volume actor the change was stored on
+ */
+void FKawaiiFluidBrushStrokeChange::Apply(UObject* Object)
+{
+	if (UKawaiiFluidSimulationModule* Module = GetStrokeTarget(Object))
+	{
+		Delta.Redo(*Module);
+		Object->MarkPackageDirty();
+	}
+}
+
+/**
+ * @brief Undoes the stroke (despawn added, respawn removed).
+ * @param Object The volume actor the change was stored on
+ */
+void FKawaiiFluidBrushStrokeChange::Revert(UObject* Object)
+{
+	if (UKawaiiFluidSimulationModule* Module = GetStrokeTarget(Object))
+	{
+		Delta.Undo(*Module);
+		Object->MarkPackageDirty();
+	}
+}
+
+/**
+ * @brief A change whose volume or module is gone can no longer be replayed.
+ * @param Object The volume actor the change was stored on
+ * @return True if the change should be dropped from the undo buffer
+ */
+bool FKawaiiFluidBrushStrokeChange::HasExpired(UObject* Object) const
+{
+	return GetStrokeTarget(Object) == nullptr;
+}
+
+/**
+ * @brief Describes the change for the undo history.
+ * @return Added/removed counts and record size
+ */
+FString FKawaiiFluidBrushStrokeChange::ToString() const
+{
+	return Delta.ToString();
+}
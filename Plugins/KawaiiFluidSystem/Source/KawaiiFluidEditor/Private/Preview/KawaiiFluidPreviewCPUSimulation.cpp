@@ -0,0 +1,259 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Preview/KawaiiFluidPreviewCPUSimulation.h"
+#include "Preview/KawaiiFluidPreviewSettings.h"
+#include "Data/KawaiiFluidPresetDataAsset.h"
+#include "Core/FluidParticle.h"
+#include "Core/SpatialHash.h"
+#include "Core/KawaiiFluidSimulationContext.h"
+#include "Core/KawaiiFluidSimulationTypes.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "RHIGlobals.h"
+#include "Misc/Crc.h"
+#include "UObject/UnrealType.h"
+
+static int32 GFluidPreviewCPU = 0;
+static FAutoConsoleVariableRef CVarFluidPreviewCPU(
+	TEXT("r.Fluid.PreviewCPU"),
+	GFluidPreviewCPU,
+	TEXT("Preset editor preview and thumbnails: 0 = GPU simulator when available, 1 = always the CPU solver. ")
+	TEXT("Takes effect for newly opened previews."),
+	ECVF_Default);
+
+//========================================
+// FKawaiiFluidPreviewCPUSimulation
+//========================================
+
+FKawaiiFluidPreviewCPUSimulation::FKawaiiFluidPreviewCPUSimulation() = default;
+FKawaiiFluidPreviewCPUSimulation::~FKawaiiFluidPreviewCPUSimulation() = default;
+
+/**
+ * @brief Returns the preview containment box.
+ * @return Box with the floor at Z=0
+ */
+FBox FKawaiiFluidPreviewCPUSimulation::GetPreviewBounds()
+{
+	return FBox(FVector(-500.0, -500.0, 0.0), FVector(500.0, 500.0, 500.0));
+}
+
+/**
+ * @brief Chooses the CPU backend when forced or when no GPU renderer can run the simulator.
+ * @return True if previews should use the CPU solver
+ */
+bool FKawaiiFluidPreviewCPUSimulation::ShouldUseCPU()
+{
+	if (GFluidPreviewCPU != 0)
+	{
+		return true;
+	}
+	return !FApp::CanEverRender() || IsRunningCommandlet() || GMaxRHIFeatureLevel < ERHIFeatureLevel::SM5;
+}
+
+/**
+ * @brief Returns the fastest particle speed.
+ * @param Particles The particles to scan
+ * @return Max speed in cm/s
+ */
+float FKawaiiFluidPreviewCPUSimulation::GetMaxSpeed(const TArray<FFluidParticle>& Particles)
+{
+	double MaxSpeedSq = 0.0;
+	for (const FFluidParticle& Particle : Particles)
+	{
+		MaxSpeedSq = FMath::Max(MaxSpeedSq, Particle.Velocity.SizeSquared());
+	}
+	return static_cast<float>(FMath::Sqrt(MaxSpeedSq));
+}
+
+/**
+ * @brief Drops the substep accumulator.
+ */
+void FKawaiiFluidPreviewCPUSimulation::Reset()
+{
+	AccumulatedTime = 0.0f;
+}
+
+/**
+ * @brief Returns the spatial hash, recreated when the cell size changes.
+ * @param InCellSize Cell size (preset SmoothingRadius)
+ * @return Per-scene spatial hash
+ */
+FSpatialHash& FKawaiiFluidPreviewCPUSimulation::GetSpatialHash(float InCellSize)
+{
+	if (!SpatialHash.IsValid() || SpatialHashCellSize != InCellSize)
+	{
+		SpatialHash = MakeUnique<FSpatialHash>(InCellSize);
+		SpatialHashCellSize = InCellSize;
+	}
+	return *SpatialHash;
+}
+
+/**
+ * @brief Advances the particles with the CPU solver inside the preview box.
+ * @param Context Simulation context (solvers)
+ * @param Preset Fluid preset
+ * @param Particles Particles to advance
+ * @param DeltaTime Frame time
+ * @return Number of substeps run
+ */
+int32 FKawaiiFluidPreviewCPUSimulation::Step(UKawaiiFluidSimulationContext& Context, const UKawaiiFluidPresetDataAsset& Preset,
+	TArray<FFluidParticle>& Particles, float DeltaTime)
+{
+	FKawaiiFluidSimulationParams Params;
+	Params.bUseWorldCollision = false;
+	Params.ParticleRadius = Preset.ParticleRadius;
+	Params.WorldBounds = GetPreviewBounds();
+	Params.BoundsRestitution = Preset.Bounciness;
+	Params.BoundsFriction = Preset.Friction;
+
+	return Context.SimulateCPU(Particles, &Preset, Params, GetSpatialHash(Preset.SmoothingRadius), DeltaTime, AccumulatedTime);
+}
+
+/**
+ * @brief Steps fixed frames until the particles come to rest.
+ * @param Context Simulation context (solvers)
+ * @param Preset Fluid preset
+ * @param Particles Particles to settle
+ * @param MinFrames Frames always run
+ * @param MaxFrames Frame cap
+ * @param SettleSpeed Max speed considered at rest (cm/s)
+ * @return True if settled within MaxFrames
+ */
+bool FKawaiiFluidPreviewCPUSimulation::Settle(UKawaiiFluidSimulationContext& Context, const UKawaiiFluidPresetDataAsset& Preset,
+	TArray<FFluidParticle>& Particles, int32 MinFrames, int32 MaxFrames, float SettleSpeed)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidPreview_Settle);
+
+	if (Particles.Num() == 0)
+	{
+		return false;
+	}
+
+	for (int32 Frame = 0; Frame < MaxFrames; ++Frame)
+	{
+		Step(Context, Preset, Particles, SettleFrameTime);
+		if (Frame + 1 >= MinFrames && GetMaxSpeed(Particles) < SettleSpeed)
+		{
+			UE_LOG(LogTemp, Log, TEXT("PreviewCPUSimulation: %d particles settled in %d frames"), Particles.Num(), Frame + 1);
+			return true;
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("PreviewCPUSimulation: %d particles not settled after %d frames (max speed %.1f cm/s)"),
+		Particles.Num(), MaxFrames, GetMaxSpeed(Particles));
+	return false;
+}
+
+//========================================
+// FKawaiiFluidSettledCache
+//========================================
+
+FKawaiiFluidSettledCache& FKawaiiFluidSettledCache::Get()
+{
+	static FKawaiiFluidSettledCache Instance;
+	return Instance;
+}
+
+/**
+ * @brief Hashes the spawn settings that shape a settled fill.
+ * @param Settings Preview spawn settings
+ * @return Setup hash
+ */
+uint32 FKawaiiFluidSettledCache::ComputeSetupHash(const FFluidPreviewSettings& Settings)
+{
+	uint32 Hash = GetTypeHash(static_cast<uint8>(Settings.EmitterMode));
+	Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Settings.ShapeType)));
+	switch (Settings.ShapeType)
+	{
+	case EPreviewEmitterShapeType::Sphere:
+		Hash = HashCombine(Hash, GetTypeHash(Settings.SphereRadius));
+		break;
+	case EPreviewEmitterShapeType::Cube:
+		Hash = HashCombine(Hash, GetTypeHash(Settings.CubeHalfSize));
+		break;
+	case EPreviewEmitterShapeType::Cylinder:
+		Hash = HashCombine(Hash, GetTypeHash(Settings.CylinderRadius));
+		Hash = HashCombine(Hash, GetTypeHash(Settings.CylinderHalfHeight));
+		break;
+	}
+	Hash = HashCombine(Hash, GetTypeHash(Settings.PreviewSpawnOffset));
+	Hash = HashCombine(Hash, GetTypeHash(Settings.InitialVelocityDirection.GetSafeNormal() * Settings.InitialSpeed));
+	Hash = HashCombine(Hash, GetTypeHash(Settings.JitterAmount));
+	return Hash;
+}
+
+/**
+ * @brief Hashes the preset properties in the Physics categories (everything the solver reads).
+ * @param Preset Fluid preset
+ * @return Preset hash
+ */
+uint32 FKawaiiFluidSettledCache::ComputePresetHash(const UKawaiiFluidPresetDataAsset& Preset)
+{
+	uint32 Hash = 0;
+	FString ValueText;
+	for (TFieldIterator<FProperty> It(UKawaiiFluidPresetDataAsset::StaticClass()); It; ++It)
+	{
+		const FProperty* Property = *It;
+		if (!Property->GetMetaData(TEXT("Category")).StartsWith(TEXT("Physics")))
+		{
+			continue;
+		}
+
+		if (Property->HasAnyPropertyFlags(CPF_IsPlainOldData))
+		{
+			Hash = FCrc::MemCrc32(Property->ContainerPtrToValuePtr<void>(&Preset), Property->GetSize(), Hash);
+		}
+		else
+		{
+			ValueText.Reset();
+			Property->ExportTextItem_InContainer(ValueText, &Preset, nullptr, nullptr, PPF_None);
+			Hash = HashCombine(Hash, GetTypeHash(ValueText));
+		}
+	}
+	return Hash;
+}
+
+const TArray<FVector3f>* FKawaiiFluidSettledCache::Find(const UKawaiiFluidPresetDataAsset* Preset, uint32 SetupHash) const
+{
+	if (!Preset)
+	{
+		return nullptr;
+	}
+
+	const FEntry* Entry = Entries.Find(TPair<FObjectKey, uint32>(FObjectKey(Preset), SetupHash));
+	return Entry && Entry->PresetHash == ComputePresetHash(*Preset) ? &Entry->Positions : nullptr;
+}
+
+void FKawaiiFluidSettledCache::Store(const UKawaiiFluidPresetDataAsset* Preset, uint32 SetupHash, const TArray<FFluidParticle>& Particles)
+{
+	if (!Preset || Particles.Num() == 0)
+	{
+		return;
+	}
+
+	FEntry& Entry = Entries.FindOrAdd(TPair<FObjectKey, uint32>(FObjectKey(Preset), SetupHash));
+	Entry.PresetHash = ComputePresetHash(*Preset);
+	TArray<FVector3f>& Positions = Entry.Positions;
+	Positions.SetNumUninitialized(Particles.Num());
+	for (int32 i = 0; i < Particles.Num(); ++i)
+	{
+		Positions[i] = FVector3f(Particles[i].Position);
+	}
+}
+
+void FKawaiiFluidSettledCache::Invalidate(const UKawaiiFluidPresetDataAsset* Preset)
+{
+	const FObjectKey PresetKey(Preset);
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (It->Key.Key == PresetKey)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FKawaiiFluidSettledCache::Clear()
+{
+	Entries.Empty();
+}
@@ -10,6 +10,7 @@
 #include "Modules/KawaiiFluidSimulationModule.h"
 #include "Modules/KawaiiFluidRenderingModule.h"
 #include "Rendering/KawaiiFluidMetaballRenderer.h"
+#include "Rendering/KawaiiFluidISMRenderer.h"
 #include "Rendering/FluidRendererSubsystem.h"
 #include "GPU/GPUFluidSimulator.h"
 #include "Components/StaticMeshComponent.h"
@@ -30,6 +31,8 @@ FKawaiiFluidPreviewScene::FKawaiiFluidPreviewScene(FPreviewScene::ConstructionVa
 	, SpawnAccumulatedTime(0.0f)
 	, TotalSimulationTime(0.0f)
 	, bSimulationActive(false)
+	, bUseCPUSimulation(FKawaiiFluidPreviewCPUSimulation::ShouldUseCPU())
+	, bSettledConfigurationStored(false)
 	, RenderingModule(nullptr)
 	, PreviewActor(nullptr)
 	, FloorMeshComponent(nullptr)
@@ -39,13 +42,19 @@ FKawaiiFluidPreviewScene::FKawaiiFluidPreviewScene(FPreviewScene::ConstructionVa
 	PreviewSettingsObject = NewObject<UFluidPreviewSettingsObject>(GetTransientPackage(), NAME_None, RF_Transient);
 
 	// Create simulation context (physics solver)
-	// GPU simulator will be initialized in SetPreset() with preset's MaxParticles
+	// GPU simulator will be initialized in SetPreset() with preset's MaxParticles (GPU mode only)
 	SimulationContext = NewObject<UKawaiiFluidSimulationContext>(GetTransientPackage(), NAME_None, RF_Transient);
-	SimulationContext->InitializeRenderResource();
+	if (!bUseCPUSimulation)
+	{
+		SimulationContext->InitializeRenderResource();
+	}
 
 	// Create simulation module (uses same spawn logic as runtime)
 	SimulationModule = NewObject<UKawaiiFluidSimulationModule>(GetTransientPackage(), NAME_None, RF_Transient);
 	SimulationModule->SetSourceID(0);  // Preview uses fixed source ID
+	SimulationModule->SetCPUSimulationMode(bUseCPUSimulation);
+
+	UE_LOG(LogTemp, Log, TEXT("FluidPreviewScene: %s simulation"), bUseCPUSimulation ? TEXT("CPU") : TEXT("GPU"));
 
 	// Create visualization components (including PreviewActor)
 	CreateVisualizationComponents();
@@ -186,10 +195,13 @@ void FKawaiiFluidPreviewScene::SetPreset(UKawaiiFluidPresetDataAsset* InPreset)
 
 	if (CurrentPreset)
 	{
-		// Initialize GPU simulator with fixed buffer size
+		// Initialize GPU simulator with fixed buffer size (CPU mode: solvers only)
 		if (SimulationContext)
 		{
-			SimulationContext->InitializeGPUSimulator(FFluidPreviewSettings::GPUBufferSize);
+			if (!bUseCPUSimulation)
+			{
+				SimulationContext->InitializeGPUSimulator(FFluidPreviewSettings::GPUBufferSize);
+			}
 			SimulationContext->InitializeSolvers(CurrentPreset);
 			SimulationContext->SetCachedPreset(CurrentPreset);
 		}
@@ -198,8 +210,11 @@ void FKawaiiFluidPreviewScene::SetPreset(UKawaiiFluidPresetDataAsset* InPreset)
 		if (SimulationModule)
 		{
 			SimulationModule->Initialize(CurrentPreset);
-			SimulationModule->SetGPUSimulator(SimulationContext->GetGPUSimulatorShared());
-			SimulationModule->SetGPUSimulationActive(true);
+			if (!bUseCPUSimulation)
+			{
+				SimulationModule->SetGPUSimulator(SimulationContext->GetGPUSimulatorShared());
+				SimulationModule->SetGPUSimulationActive(true);
+			}
 		}
 
 		CachedParticleRadius = CurrentPreset->ParticleRadius;
@@ -213,6 +228,7 @@ void FKawaiiFluidPreviewScene::SetPreset(UKawaiiFluidPresetDataAsset* InPreset)
 				Metaball->SetPreset(CurrentPreset);
 			}
 		}
+		ApplyRendererBackend();
 
 		// Apply ISM settings from PreviewSettings
 		ApplyPreviewSettings();
@@ -236,7 +252,7 @@ void FKawaiiFluidPreviewScene::RefreshFromPreset()
 	if (SimulationContext)
 	{
 		// Ensure GPU simulator exists with fixed buffer size
-		if (!SimulationContext->IsGPUSimulatorReady())
+		if (!bUseCPUSimulation && !SimulationContext->IsGPUSimulatorReady())
 		{
 			SimulationContext->InitializeGPUSimulator(FFluidPreviewSettings::GPUBufferSize);
 		}
@@ -262,6 +278,7 @@ void FKawaiiFluidPreviewScene::RefreshFromPreset()
 			Metaball->SetPreset(CurrentPreset);
 		}
 	}
+	ApplyRendererBackend();
 
 	// Apply ISM settings from PreviewSettings
 	ApplyPreviewSettings();
@@ -284,7 +301,7 @@ void FKawaiiFluidPreviewScene::StopSimulation()
 }
 
 /**
- * @brief Clears GPU particle buffers and resets timers.
+ * @brief Clears particles and resets timers; Fill mode respawns (from the settled cache when available).
  */
 void FKawaiiFluidPreviewScene::ResetSimulation()
 {
@@ -297,14 +314,35 @@ void FKawaiiFluidPreviewScene::ResetSimulation()
 			GPUSimulator->ClearAllParticles();
 		}
 	}
+	if (SimulationModule && bUseCPUSimulation)
+	{
+		SimulationModule->ClearAllParticles();
+	}
+	CPUSimulation.Reset();
 	SpawnAccumulatedTime = 0.0f;
 	TotalSimulationTime = 0.0f;
+	bSettledConfigurationStored = false;
 
 	// Fill mode: spawn particles immediately on reset (like EmitterComponent::SpawnFill)
 	if (SimulationModule && CurrentPreset && PreviewSettingsObject)
 	{
 		const FFluidPreviewSettings& Settings = PreviewSettingsObject->Settings;
 
+		// Warm start: settled configuration of this preset and setup
+		if (Settings.IsFillMode())
+		{
+			const uint32 SetupHash = FKawaiiFluidSettledCache::ComputeSetupHash(Settings);
+			if (const TArray<FVector3f>* Settled = FKawaiiFluidSettledCache::Get().Find(CurrentPreset, SetupHash))
+			{
+				for (const FVector3f& Position : *Settled)
+				{
+					SimulationModule->SpawnParticle(FVector(Position), FVector::ZeroVector);
+				}
+				bSettledConfigurationStored = true;
+				return;
+			}
+		}
+
 		if (Settings.IsFillMode())
 		{
 			const FVector SpawnCenter = Settings.PreviewSpawnOffset;
@@ -348,7 +386,7 @@ void FKawaiiFluidPreviewScene::SpawnParticles(float DeltaTime)
 	}
 
 	FGPUFluidSimulator* GPUSimulator = SimulationModule->GetGPUSimulator();
-	if (!GPUSimulator)
+	if (!GPUSimulator && !bUseCPUSimulation)
 	{
 		return;
 	}
@@ -364,7 +402,9 @@ void FKawaiiFluidPreviewScene::SpawnParticles(float DeltaTime)
 	// Check max particle count (skip if Recycle mode - let recycle handle overflow)
 	if (Settings.MaxParticleCount > 0 && !Settings.bContinuousSpawn)
 	{
-		const int32 CurrentCount = GPUSimulator->GetParticleCount() + GPUSimulator->GetPendingSpawnCount();
+		const int32 CurrentCount = GPUSimulator
+			? GPUSimulator->GetParticleCount() + GPUSimulator->GetPendingSpawnCount()
+			: SimulationModule->GetParticles().Num();
 		if (CurrentCount >= Settings.MaxParticleCount)
 		{
 			return;
@@ -441,6 +481,12 @@ void FKawaiiFluidPreviewScene::TickSimulation(float DeltaTime)
 		return;
 	}
 
+	if (bUseCPUSimulation)
+	{
+		TickCPUSimulation(DeltaTime);
+		return;
+	}
+
 	FGPUFluidSimulator* GPUSimulator = SimulationContext->GetGPUSimulator();
 	if (!GPUSimulator)
 	{
@@ -463,23 +509,17 @@ void FKawaiiFluidPreviewScene::TickSimulation(float DeltaTime)
 	Params.ParticleRadius = CurrentPreset->ParticleRadius;
 
 	// Set simulation bounds for GPU collision (floor at Z=0)
-	const FVector BoundsMin(-500.0, -500.0, 0.0);
-	const FVector BoundsMax(500.0, 500.0, 500.0);
-	Params.WorldBounds = FBox(BoundsMin, BoundsMax);
-	GPUSimulator->SetSimulationBounds(FVector3f(BoundsMin), FVector3f(BoundsMax));
-
-	// Run GPU simulation
-	static TArray<FFluidParticle> DummyParticles;  // GPU mode doesn't use CPU particles
-	static FSpatialHash DummySpatialHash(CurrentPreset->SmoothingRadius);
-	float AccumulatedTime = 0.0f;
+	Params.WorldBounds = FKawaiiFluidPreviewCPUSimulation::GetPreviewBounds();
+	GPUSimulator->SetSimulationBounds(FVector3f(Params.WorldBounds.Min), FVector3f(Params.WorldBounds.Max));
 
+	// Run GPU simulation (module particle array is empty in GPU mode; hash and accumulator are per scene)
 	SimulationContext->Simulate(
-		DummyParticles,
+		SimulationModule->GetParticlesMutable(),
 		CurrentPreset,
 		Params,
-		DummySpatialHash,
+		CPUSimulation.GetSpatialHash(CurrentPreset->SmoothingRadius),
 		DeltaTime,
-		AccumulatedTime
+		CPUSimulation.GetAccumulatedTime()
 	);
 
 	// Update rendering module
@@ -490,11 +530,72 @@ void FKawaiiFluidPreviewScene::TickSimulation(float DeltaTime)
 }
 
 /**
- * @brief Floor collision logic (currently handled by GPU bounds).
+ * @brief CPU simulation step: stream recycling, solver step, settled-fill caching.
+ * @param DeltaTime The simulation time step
+ */
+void FKawaiiFluidPreviewScene::TickCPUSimulation(float DeltaTime)
+{
+	if (!SimulationModule || !PreviewSettingsObject)
+	{
+		return;
+	}
+
+	const FFluidPreviewSettings& Settings = PreviewSettingsObject->Settings;
+	TArray<FFluidParticle>& Particles = SimulationModule->GetParticlesMutable();
+
+	TotalSimulationTime += DeltaTime;
+	SpawnParticles(DeltaTime);
+
+	// Recycle: drop the oldest particles (spawned first) over the limit
+	if (Settings.IsStreamMode() && Settings.bContinuousSpawn && Settings.MaxParticleCount > 0 && Particles.Num() > Settings.MaxParticleCount)
+	{
+		Particles.RemoveAt(0, Particles.Num() - Settings.MaxParticleCount, EAllowShrinking::No);
+	}
+
+	CPUSimulation.Step(*SimulationContext, *CurrentPreset, Particles, DeltaTime);
+
+	// Store a settled fill so the next reset and the thumbnail start from it
+	constexpr float MinSettleTime = 1.0f;
+	if (Settings.IsFillMode() && !bSettledConfigurationStored && TotalSimulationTime > MinSettleTime
+		&& FKawaiiFluidPreviewCPUSimulation::GetMaxSpeed(Particles) < FKawaiiFluidPreviewCPUSimulation::DefaultSettleSpeed)
+	{
+		FKawaiiFluidSettledCache::Get().Store(CurrentPreset, FKawaiiFluidSettledCache::ComputeSetupHash(Settings), Particles);
+		bSettledConfigurationStored = true;
+	}
+
+	if (RenderingModule)
+	{
+		RenderingModule->UpdateRenderers();
+	}
+}
+
+/**
+ * @brief Routes rendering to the ISM renderer in CPU mode (Metaball reads GPU buffers).
+ */
+void FKawaiiFluidPreviewScene::ApplyRendererBackend()
+{
+	if (!bUseCPUSimulation || !RenderingModule)
+	{
+		return;
+	}
+
+	if (UKawaiiFluidMetaballRenderer* Metaball = RenderingModule->GetMetaballRenderer())
+	{
+		Metaball->SetEnabled(false);
+	}
+	if (UKawaiiFluidISMRenderer* ISM = RenderingModule->GetISMRenderer())
+	{
+		ISM->SetPreset(CurrentPreset);
+		ISM->SetEnabled(true);
+	}
+}
+
+/**
+ * @brief Floor collision logic (handled by the preview bounds on both backends).
  */
 void FKawaiiFluidPreviewScene::HandleFloorCollision()
 {
-	// Floor collision is handled by GPU bounds collision
+	// Floor collision is handled by bounds collision (GPU bounds, or SimulateCPU containment)
 }
 
 /**
@@ -548,21 +649,21 @@ void FKawaiiFluidPreviewScene::UpdateEnvironment()
 
 /**
  * @brief Returns CPU particles (empty in GPU mode).
- * @return Empty particle array
+ * @return Particle array
  */
 const TArray<FFluidParticle>& FKawaiiFluidPreviewScene::GetParticles() const
 {
 	static TArray<FFluidParticle> EmptyArray;
-	return EmptyArray;
+	return (bUseCPUSimulation && SimulationModule) ? SimulationModule->GetParticles() : EmptyArray;
 }
 
 /**
- * @brief Returns the particle count from GPU.
+ * @brief Returns the particle count (CPU array or GPU simulator).
  * @return Current particle count
  */
 int32 FKawaiiFluidPreviewScene::GetParticleCount() const
 {
-	return GetGPUParticleCount();
+	return bUseCPUSimulation ? GetParticles().Num() : GetGPUParticleCount();
 }
 
 /**
@@ -580,16 +681,21 @@ float FKawaiiFluidPreviewScene::GetParticleRadius() const
  */
 bool FKawaiiFluidPreviewScene::IsDataValid() const
 {
-	return IsGPUSimulationActive();
+	return bUseCPUSimulation ? SimulationModule != nullptr : IsGPUSimulationActive();
 }
 
 /**
  * @brief Returns mutable CPU particles (empty in GPU mode).
- * @return Empty particle array
+ * @return Particle array
  */
 TArray<FFluidParticle>& FKawaiiFluidPreviewScene::GetParticlesMutable()
 {
 	static TArray<FFluidParticle> EmptyArray;
+	if (bUseCPUSimulation && SimulationModule)
+	{
+		return SimulationModule->GetParticlesMutable();
+	}
+	EmptyArray.Reset();
 	return EmptyArray;
 }
 
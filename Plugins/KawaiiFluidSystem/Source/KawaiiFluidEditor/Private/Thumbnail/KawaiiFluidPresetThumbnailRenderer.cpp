@@ -4,6 +4,12 @@
 
 #include "CanvasTypes.h"
 #include "Data/KawaiiFluidPresetDataAsset.h"
+#include "Core/FluidParticle.h"
+#include "Core/KawaiiFluidSimulationContext.h"
+#include "Modules/KawaiiFluidSimulationModule.h"
+#include "Preview/KawaiiFluidPreviewCPUSimulation.h"
+#include "Preview/KawaiiFluidPreviewSettings.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "Engine/StaticMesh.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Materials/Material.h"
@@ -21,10 +27,19 @@
 
 /**
  * @brief Internal helper class for 3D thumbnail preview
+ * Draws the preset's settled fluid (CPU solver, cached per preset) as instanced particle spheres;
+ * falls back to a single sphere when no particles settle.
  */
 class FKawaiiFluidPresetThumbnailScene : public FThumbnailPreviewScene
 {
 public:
+	/** Fill sphere radius in particle spacings (~500 particles) */
+	static constexpr float FillRadiusInSpacings = 5.0f;
+
+	/** Settle frame limits (60 fps frames) */
+	static constexpr int32 MinSettleFrames = 30;
+	static constexpr int32 MaxSettleFrames = 240;
+
 	/**
 	 * @brief Constructor: Sets up the mesh, material, and lighting for the thumbnail scene.
 	 */
@@ -57,6 +72,24 @@ public:
 			PreviewMeshComponent->SetMaterial(0, ThumbnailMID);
 		}
 
+		// Particle spheres (hidden until a settled configuration is available)
+		ParticleMeshComponent = NewObject<UInstancedStaticMeshComponent>(GetTransientPackage(), NAME_None, RF_Transient);
+		if (UStaticMesh* ParticleMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Sphere.Sphere")))
+		{
+			ParticleMeshComponent->SetStaticMesh(ParticleMesh);
+		}
+		if (ThumbnailMID)
+		{
+			ParticleMeshComponent->SetMaterial(0, ThumbnailMID);
+		}
+		ParticleMeshComponent->SetVisibility(false);
+		AddComponent(ParticleMeshComponent, FTransform::Identity);
+
+		// CPU solver for the settled fluid
+		SimulationContext = NewObject<UKawaiiFluidSimulationContext>(GetTransientPackage(), NAME_None, RF_Transient);
+		SimulationModule = NewObject<UKawaiiFluidSimulationModule>(GetTransientPackage(), NAME_None, RF_Transient);
+		SimulationModule->SetCPUSimulationMode(true);
+
 		// 3. Lighting setup
 		if (DirectionalLight)
 		{
@@ -95,6 +128,84 @@ public:
 			}
 		}
 		PreviewMeshComponent->MarkRenderStateDirty();
+
+		UpdateParticles(Preset);
+	}
+
+	/**
+	 * @brief Fills the particle instances from the preset's settled configuration (settles and caches it on a miss).
+	 * @param Preset The preset to simulate
+	 */
+	void UpdateParticles(UKawaiiFluidPresetDataAsset* Preset)
+	{
+		ParticleMeshComponent->ClearInstances();
+		bShowParticles = false;
+
+		if (!Preset || Preset->ParticleSpacing <= 0.0f || Preset->ParticleRadius <= 0.0f)
+		{
+			ApplyVisibility();
+			return;
+		}
+
+		// Small sphere dropped just above the floor
+		FFluidPreviewSettings Settings;
+		Settings.EmitterMode = EPreviewEmitterMode::Fill;
+		Settings.ShapeType = EPreviewEmitterShapeType::Sphere;
+		Settings.SphereRadius = Preset->ParticleSpacing * FillRadiusInSpacings;
+		Settings.PreviewSpawnOffset = FVector(0.0f, 0.0f, Settings.SphereRadius + Preset->ParticleSpacing);
+		Settings.InitialSpeed = 0.0f;
+		Settings.JitterAmount = 0.0f;
+
+		FKawaiiFluidSettledCache& Cache = FKawaiiFluidSettledCache::Get();
+		const uint32 SetupHash = FKawaiiFluidSettledCache::ComputeSetupHash(Settings);
+		const TArray<FVector3f>* Settled = Cache.Find(Preset, SetupHash);
+		if (!Settled)
+		{
+			// Only a change to the preset's Physics properties gets here again (color, texture edits hit the cache)
+			SimulationContext->InitializeSolvers(Preset);
+			SimulationModule->Initialize(Preset);
+			SimulationModule->SetCPUSimulationMode(true);
+			SimulationModule->ClearAllParticles();
+			SimulationModule->SpawnParticlesSphereHexagonal(
+				Settings.PreviewSpawnOffset, Settings.SphereRadius, Preset->ParticleSpacing, false, 0.0f, FVector::ZeroVector);
+
+			FKawaiiFluidPreviewCPUSimulation CPUSimulation;
+			TArray<FFluidParticle>& Particles = SimulationModule->GetParticlesMutable();
+			CPUSimulation.Settle(*SimulationContext, *Preset, Particles, MinSettleFrames, MaxSettleFrames);
+			Cache.Store(Preset, SetupHash, Particles);
+			SimulationModule->ClearAllParticles();
+			Settled = Cache.Find(Preset, SetupHash);
+		}
+
+		if (!Settled || Settled->Num() == 0)
+		{
+			ApplyVisibility();
+			return;
+		}
+
+		// Engine sphere is 100 units across
+		const FVector Scale(Preset->ParticleRadius / 50.0f);
+		FBox Bounds(ForceInit);
+		TArray<FTransform> Instances;
+		Instances.Reserve(Settled->Num());
+		for (const FVector3f& Position : *Settled)
+		{
+			Instances.Add(FTransform(FQuat::Identity, FVector(Position), Scale));
+			Bounds += FVector(Position);
+		}
+		ParticleMeshComponent->AddInstances(Instances, false);
+
+		ParticleCenter = Bounds.GetCenter();
+		ParticleBoundsRadius = Bounds.GetExtent().Size() + Preset->ParticleRadius;
+		bShowParticles = true;
+		ApplyVisibility();
+	}
+
+	void ApplyVisibility()
+	{
+		PreviewMeshComponent->SetVisibility(!bShowParticles);
+		ParticleMeshComponent->SetVisibility(bShowParticles);
+		ParticleMeshComponent->MarkRenderStateDirty();
 	}
 	
 	/**
@@ -102,9 +213,15 @@ public:
 	 */
 	virtual void GetViewMatrixParameters(const float InFOVDegrees, FVector& OutOrigin, float& OutOrbitPitch, float& OutOrbitYaw, float& OutOrbitZoom) const override
 	{
-		OutOrigin = FVector::ZeroVector;
 		OutOrbitPitch = -45.0f;
 		OutOrbitYaw = -135.0f;
+		if (bShowParticles)
+		{
+			OutOrigin = ParticleCenter;
+			OutOrbitZoom = ParticleBoundsRadius * 2.5f;
+			return;
+		}
+		OutOrigin = FVector::ZeroVector;
 		OutOrbitZoom = PreviewMeshComponent ? (PreviewMeshComponent->Bounds.SphereRadius * 2.5f) : 0.0f;
 	}
 
@@ -182,11 +299,25 @@ public:
 		FThumbnailPreviewScene::AddReferencedObjects(Collector);
 		Collector.AddReferencedObject(PreviewMeshComponent);
 		Collector.AddReferencedObject(ThumbnailMID);
+		Collector.AddReferencedObject(ParticleMeshComponent);
+		Collector.AddReferencedObject(SimulationContext);
+		Collector.AddReferencedObject(SimulationModule);
 	}
 
 private:
 	TObjectPtr<UStaticMeshComponent> PreviewMeshComponent;
 	TObjectPtr<UMaterialInstanceDynamic> ThumbnailMID;
+
+	/** Settled particles (one instance per particle) */
+	TObjectPtr<UInstancedStaticMeshComponent> ParticleMeshComponent;
+
+	/** CPU solver used to settle the thumbnail fluid */
+	TObjectPtr<UKawaiiFluidSimulationContext> SimulationContext;
+	TObjectPtr<UKawaiiFluidSimulationModule> SimulationModule;
+
+	bool bShowParticles = false;
+	FVector ParticleCenter = FVector::ZeroVector;
+	float ParticleBoundsRadius = 0.0f;
 };
 
 /**
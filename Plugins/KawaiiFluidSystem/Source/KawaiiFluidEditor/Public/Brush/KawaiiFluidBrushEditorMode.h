@@ -21,6 +21,7 @@ class UKawaiiFluidVolumeComponent;
  * @param BrushNormal Surface normal at the brush location
  * @param bValidLocation Whether the brush is currently over a valid target
  * @param bPainting Whether the user is currently holding the paint button
+ * @param StrokeSamples Positions added during the current drag (coalesced stroke path)
  */
 class FKawaiiFluidBrushEditorMode : public FEdMode
 {
@@ -75,6 +76,19 @@ private:
 
 	double LastStrokeTime = 0.0;
 
+	/** Brush location of the previous stroke in this drag (start of the next stroke region) */
+	FVector LastStrokeLocation {};
+
+	bool bHasLastStroke = false;
+
+	/** Positions added during this drag; the GPU readback does not contain them yet */
+	TArray<FVector> StrokeSamples;
+
+	/** Seed of the next stroke, restarted per drag so a repeated drag samples identically */
+	int32 StrokeSeed = 0;
+
+	void BeginStroke();
+
 	FDelegateHandle SelectionChangedHandle;
 
 	void OnSelectionChanged(UObject* Object);
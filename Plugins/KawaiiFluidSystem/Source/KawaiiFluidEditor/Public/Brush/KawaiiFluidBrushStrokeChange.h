@@ -0,0 +1,35 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Change.h"
+#include "Core/KawaiiFluidBrushStrokeDelta.h"
+
+/**
+ * @brief FKawaiiFluidBrushStrokeChange
+ *
+ * Undo record of one brush stroke on an AKawaiiFluidVolume.
+ * Stores only the particles the stroke added and removed (FKawaiiFluidBrushStrokeDelta) and
+ * replays them as batched spawn/despawn on the volume's simulation module, so the cost of a
+ * stroke does not grow with the number of particles already in the volume.
+ *
+ * @param Delta The recorded stroke
+ */
+class KAWAIIFLUIDEDITOR_API FKawaiiFluidBrushStrokeChange : public FCommandChange
+{
+public:
+	explicit FKawaiiFluidBrushStrokeChange(FKawaiiFluidBrushStrokeDelta&& InDelta);
+
+	//~ Begin FCommandChange Interface
+	virtual void Apply(UObject* Object) override;
+	virtual void Revert(UObject* Object) override;
+	virtual bool HasExpired(UObject* Object) const override;
+	virtual FString ToString() const override;
+	//~ End FCommandChange Interface
+
+	const FKawaiiFluidBrushStrokeDelta& GetDelta() const { return Delta; }
+
+private:
+	FKawaiiFluidBrushStrokeDelta Delta;
+};
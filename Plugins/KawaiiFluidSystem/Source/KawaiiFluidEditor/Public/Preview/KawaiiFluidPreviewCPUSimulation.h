@@ -0,0 +1,115 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UKawaiiFluidPresetDataAsset;
+class UKawaiiFluidSimulationContext;
+class FSpatialHash;
+struct FFluidParticle;
+struct FFluidPreviewSettings;
+
+/**
+ * @brief FKawaiiFluidPreviewCPUSimulation
+ *
+ * Per-scene simulation state for the preset editor preview and thumbnails.
+ * Runs UKawaiiFluidSimulationContext::SimulateCPU on a caller-owned particle array
+ * inside the preview box (floor at Z=0), so previews work without a GPU simulator.
+ * The spatial hash follows the preset's SmoothingRadius.
+ */
+class KAWAIIFLUIDEDITOR_API FKawaiiFluidPreviewCPUSimulation
+{
+public:
+	FKawaiiFluidPreviewCPUSimulation();
+	~FKawaiiFluidPreviewCPUSimulation();
+
+	/** Fixed frame time used by Settle */
+	static constexpr float SettleFrameTime = 1.0f / 60.0f;
+
+	/** Fastest particle speed (cm/s) considered settled */
+	static constexpr float DefaultSettleSpeed = 5.0f;
+
+	/** Preview containment box (floor at Z=0, shared with the GPU preview) */
+	static FBox GetPreviewBounds();
+
+	/**
+	 * Backend selection for previews and thumbnails
+	 * @return true if r.Fluid.PreviewCPU forces it, or there is no SM5 renderer (headless cook, -nullrhi)
+	 */
+	static bool ShouldUseCPU();
+
+	/** Fastest particle speed (cm/s) */
+	static float GetMaxSpeed(const TArray<FFluidParticle>& Particles);
+
+	/** Drop accumulated time (call when the particles are replaced) */
+	void Reset();
+
+	/**
+	 * Advance the particles by DeltaTime (fixed substeps)
+	 * @return Number of substeps run
+	 */
+	int32 Step(UKawaiiFluidSimulationContext& Context, const UKawaiiFluidPresetDataAsset& Preset,
+		TArray<FFluidParticle>& Particles, float DeltaTime);
+
+	/**
+	 * Step SettleFrameTime frames until the fastest particle is below SettleSpeed
+	 * @param MinFrames Frames always run (lets a fill drop before it is judged)
+	 * @param MaxFrames Frame cap
+	 * @return true if the particles settled within MaxFrames
+	 */
+	bool Settle(UKawaiiFluidSimulationContext& Context, const UKawaiiFluidPresetDataAsset& Preset,
+		TArray<FFluidParticle>& Particles, int32 MinFrames, int32 MaxFrames, float SettleSpeed = DefaultSettleSpeed);
+
+	/** Spatial hash with cell size = InCellSize (recreated when it changes) */
+	FSpatialHash& GetSpatialHash(float InCellSize);
+
+	/** Substep accumulator (also used by the GPU preview path) */
+	float& GetAccumulatedTime() { return AccumulatedTime; }
+
+private:
+	TUniquePtr<FSpatialHash> SpatialHash;
+	float SpatialHashCellSize = 0.0f;
+	float AccumulatedTime = 0.0f;
+};
+
+/**
+ * @brief FKawaiiFluidSettledCache
+ *
+ * Settled particle positions per preset and spawn setup, used to warm-start the preview
+ * and thumbnails. Each entry remembers the hash of the preset's Physics properties it was
+ * settled with, so edits to other properties (rendering, thumbnail) keep it valid.
+ */
+class KAWAIIFLUIDEDITOR_API FKawaiiFluidSettledCache
+{
+public:
+	static FKawaiiFluidSettledCache& Get();
+
+	/** Hash of the spawn settings that shape the settled result */
+	static uint32 ComputeSetupHash(const FFluidPreviewSettings& Settings);
+
+	/** Hash of the preset properties that shape the settled result (Physics categories) */
+	static uint32 ComputePresetHash(const UKawaiiFluidPresetDataAsset& Preset);
+
+	/** Settled positions, or nullptr (also when the preset's Physics properties changed since Store) */
+	const TArray<FVector3f>* Find(const UKawaiiFluidPresetDataAsset* Preset, uint32 SetupHash) const;
+
+	void Store(const UKawaiiFluidPresetDataAsset* Preset, uint32 SetupHash, const TArray<FFluidParticle>& Particles);
+
+	void Invalidate(const UKawaiiFluidPresetDataAsset* Preset);
+
+	void Clear();
+
+private:
+	FKawaiiFluidSettledCache() = default;
+
+	struct FEntry
+	{
+		/** ComputePresetHash at Store time */
+		uint32 PresetHash = 0;
+		TArray<FVector3f> Positions;
+	};
+
+	TMap<TPair<FObjectKey, uint32>, FEntry> Entries;
+};
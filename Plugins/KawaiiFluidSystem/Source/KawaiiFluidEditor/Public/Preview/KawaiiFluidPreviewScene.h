@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "AdvancedPreviewScene.h"
 #include "Preview/KawaiiFluidPreviewSettings.h"
+#include "Preview/KawaiiFluidPreviewCPUSimulation.h"
 #include "Interfaces/IKawaiiFluidDataProvider.h"
 
 class UKawaiiFluidPresetDataAsset;
@@ -17,12 +18,14 @@ struct FFluidParticle;
  * @brief FKawaiiFluidPreviewScene
  * 
  * A specialized preview world for fluid simulation.
- * Manages the GPU simulator, simulation module, and rendering module 
- * in a lightweight environment for asset editing.
+ * Manages the simulator (GPU, or the CPU solver when no GPU is available),
+ * simulation module, and rendering module in a lightweight environment for asset editing.
+ * Fill mode warm-starts from the settled configuration cached for the preset.
  * 
  * @param CurrentPreset The fluid preset currently being previewed
  * @param PreviewSettingsObject Wrapper object for simulation settings in Details Panel
  * @param SimulationContext Physics solver with GPU simulator integration
+ * @param CPUSimulation Per-scene simulation state (spatial hash, substep accumulator)
  * @param SimulationModule Module handling particle spawn and update logic
  * @param RenderingModule Module handling visualization (ISM/Metaball)
  * @param PreviewActor Transient actor hosting simulation components
@@ -79,6 +82,9 @@ public:
 
 	bool IsSimulationActive() const { return bSimulationActive; }
 
+	/** True if this scene simulates on the CPU (see FKawaiiFluidPreviewCPUSimulation::ShouldUseCPU) */
+	bool IsCPUSimulation() const { return bUseCPUSimulation; }
+
 	//========================================
 	// Preview Settings
 	//========================================
@@ -98,7 +104,7 @@ public:
 	void UpdateEnvironment();
 
 	//========================================
-	// Particle Access (GPU mode - limited)
+	// Particle Access (CPU mode; empty in GPU mode)
 	//========================================
 
 	TArray<FFluidParticle>& GetParticlesMutable();
@@ -114,6 +120,12 @@ private:
 
 	void HandleFloorCollision();
 
+	/** Switch renderers for the active backend (CPU mode: ISM, Metaball needs the GPU simulator) */
+	void ApplyRendererBackend();
+
+	/** CPU mode: recycle, step, and cache the settled fill */
+	void TickCPUSimulation(float DeltaTime);
+
 private:
 	/** Current preset being previewed */
 	TObjectPtr<UKawaiiFluidPresetDataAsset> CurrentPreset;
@@ -136,6 +148,15 @@ private:
 	/** Is simulation running */
 	bool bSimulationActive;
 
+	/** Simulate on the CPU instead of the GPU simulator */
+	bool bUseCPUSimulation;
+
+	/** Per-scene spatial hash and substep accumulator */
+	FKawaiiFluidPreviewCPUSimulation CPUSimulation;
+
+	/** Fill mode: the current fill came from (or has been stored to) the settled cache */
+	bool bSettledConfigurationStored;
+
 	/** Rendering module - same as runtime! (ISM + SSFR) */
 	TObjectPtr<UKawaiiFluidRenderingModule> RenderingModule;
 
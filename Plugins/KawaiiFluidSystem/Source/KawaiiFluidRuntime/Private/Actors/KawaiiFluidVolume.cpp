@@ -15,6 +15,11 @@
 #include "Core/KawaiiFluidSimulationStats.h"
 #include "DrawDebugHelpers.h"
 #include "NiagaraFunctionLibrary.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "NiagaraDataInterfaceArrayFunctionLibrary.h"
+#include "Core/KawaiiFluidSplashSelector.h"
+#include "Core/KawaiiFluidBrushSampler.h"
 #include "Engine/World.h"
 #include "Camera/PlayerCameraManager.h"
 #include "Components/DirectionalLightComponent.h"
@@ -26,6 +31,32 @@
 #include "Engine/StaticMesh.h"
 #include "Engine/OverlapResult.h"
 
+namespace
+{
+	// User parameters read by a pooled splash Niagara system (bPooledSplashVFX)
+	const FName SplashPositionsParamName(TEXT("SplashPositions"));
+	const FName SplashDirectionsParamName(TEXT("SplashDirections"));
+	const FName SplashCountParamName(TEXT("SplashCount"));
+
+	/** True if the system exposes every user parameter the pooled path writes */
+	bool HasPooledSplashParams(const UNiagaraSystem* System)
+	{
+		int32 NumFound = 0;
+		for (const FNiagaraVariableWithOffset& Variable : System->GetExposedParameters().ReadParameterVariables())
+		{
+			for (const FName ParamName : { SplashPositionsParamName, SplashDirectionsParamName, SplashCountParamName })
+			{
+				if (Variable.GetName() == ParamName
+					|| Variable.GetName() == FName(*(TEXT("User.") + ParamName.ToString())))
+				{
+					++NumFound;
+				}
+			}
+		}
+		return NumFound == 3;
+	}
+}
+
 AKawaiiFluidVolume::AKawaiiFluidVolume()
 {
 	// Create the volume component as root
@@ -275,7 +306,6 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 		{
 			CachedShadowPositions.Empty();
 			CachedShadowVelocities.Empty();
-			CachedNeighborCounts.Empty();
 			return;
 		}
 
@@ -287,8 +317,7 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 		{
 			// Determine if readback is needed:
 			// 1. ISM Shadow enabled (needs position/anisotropy data for ISM)
-			// 2. SplashVFX assigned (needs velocity/neighbor data)
-			// 3. Debug visualization enabled (needs particle flags for debug draw)
+			// 2. Debug visualization enabled (needs particle flags for debug draw)
 			UFluidRendererSubsystem* RendererSubsystem = World->GetSubsystem<UFluidRendererSubsystem>();
 			bool bNeedShadow = RendererSubsystem &&
 			                   RendererSubsystem->bEnableISMShadow &&
@@ -333,10 +362,9 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 					}
 				}
 			}
-			const bool bNeedVFX = VolumeComponent->SplashVFX != nullptr;
 			const bool bNeedDebug = IsPointDebugMode(VolumeComponent->DebugDrawMode);
 			const bool bNeedDebugZOrder = (VolumeComponent->DebugDrawMode == EKawaiiFluidDebugDrawMode::Point_ZOrderArrayIndex);
-			const bool bNeedReadback = bNeedShadow || bNeedVFX || bNeedDebug;
+			const bool bNeedReadback = bNeedShadow || bNeedDebug;  // Splash VFX is detected on the GPU (no particle readback)
 			
 			// Only enable readback when actually needed (avoids GPU barrier overhead)
 			GPUSimulator->SetShadowReadbackEnabled(bNeedReadback);
@@ -364,9 +392,6 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 					CachedAnisotropyAxis3 = MoveTemp(NewAnisotropyAxis3);
 					LastShadowReadbackFrame = GFrameCounter;
 					LastShadowReadbackTime = FPlatformTime::Seconds();
-
-					// Also cache neighbor counts for isolation detection
-					GPUSimulator->GetShadowNeighborCounts(CachedNeighborCounts);
 				}
 			}
 			else if (bNeedReadback && CachedShadowPositions.Num() > 0 && CachedShadowVelocities.Num() == CachedShadowPositions.Num())
@@ -407,13 +432,11 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 			{
 				Positions.SetNum(NumParticles);
 				CachedShadowVelocities.SetNum(NumParticles);
-				CachedNeighborCounts.SetNum(NumParticles);
 
 				for (int32 i = 0; i < NumParticles; ++i)
 				{
 					Positions[i] = Particles[i].Position;
 					CachedShadowVelocities[i] = Particles[i].Velocity;
-					CachedNeighborCounts[i] = Particles[i].NeighborIndices.Num();
 				}
 			}
 		}
@@ -421,14 +444,12 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 		// Filter NaN/Inf positions (stale readback after despawn compaction)
 		{
 			const bool bHasVel = (CachedShadowVelocities.Num() == NumParticles);
-			const bool bHasNbr = (CachedNeighborCounts.Num() == NumParticles);
 			int32 Out = 0;
 			for (int32 i = 0; i < NumParticles; ++i)
 			{
 				if (Positions[i].ContainsNaN()) continue;
 				Positions[Out] = Positions[i];
 				if (bHasVel) CachedShadowVelocities[Out] = CachedShadowVelocities[i];
-				if (bHasNbr) CachedNeighborCounts[Out] = CachedNeighborCounts[i];
 				Out++;
 			}
 			NumParticles = Out;
@@ -512,98 +533,182 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 					);
 				}
 			}
+		}
 
-			// =====================================================
-			// Step 3: Splash VFX (independent of Shadow settings)
-			// =====================================================
-			UNiagaraSystem* SplashVFX = VolumeComponent->SplashVFX;
-			if (SplashVFX)
-			{
-				const float SplashVelocityThreshold = VolumeComponent->SplashVelocityThreshold;
-				const int32 MaxSplashVFXPerFrame = VolumeComponent->MaxSplashVFXPerFrame;
-				const ESplashConditionMode SplashConditionMode = VolumeComponent->SplashConditionMode;
-				const int32 IsolationNeighborThreshold = VolumeComponent->IsolationNeighborThreshold;
+		// =====================================================
+		// Step 3: Splash VFX (independent of Shadow settings and readback)
+		// =====================================================
+		UpdateSplashVFX(bGPUActive, GPUSimulator);
+	}
 
-				int32 SpawnCount = 0;
-				const bool bHasVelocityData = CachedShadowVelocities.Num() == NumParticles;
-				const bool bHasNeighborData = CachedNeighborCounts.Num() == NumParticles;
-				const bool bHasPrevNeighborData = PrevNeighborCounts.Num() == NumParticles;
+	// Simulation is handled by subsystem for proper batching
+	// The Subsystem tick runs after actor ticks, so particles spawned above
+	// will be simulated in the current frame.
+}
 
-				for (int32 i = 0; i < NumParticles && SpawnCount < MaxSplashVFXPerFrame; ++i)
-				{
-					// Velocity condition: fast-moving particle
-					bool bFastMoving = false;
-					FVector VelocityDir = FVector::UpVector;
-					if (bHasVelocityData)
-					{
-						const float Speed = CachedShadowVelocities[i].Size();
-						bFastMoving = Speed > SplashVelocityThreshold;
-						VelocityDir = CachedShadowVelocities[i].GetSafeNormal();
-					}
+void AKawaiiFluidVolume::UpdateSplashVFX(bool bGPUActive, FGPUFluidSimulator* GPUSimulator)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidVolume_SplashVFX);
 
-					// Isolation condition: few neighbors
-					bool bIsolated = false;
-					bool bJustBecameIsolated = false;
-					if (bHasNeighborData)
-					{
-						bIsolated = CachedNeighborCounts[i] <= IsolationNeighborThreshold;
+	const bool bNeedVFX = VolumeComponent->SplashVFX != nullptr;
 
-						// State change detection: was not isolated -> now isolated
-						if (bHasPrevNeighborData)
-						{
-							const bool bWasIsolated = PrevNeighborCounts[i] <= IsolationNeighborThreshold;
-							bJustBecameIsolated = bIsolated && !bWasIsolated;
-						}
-						else
-						{
-							// First frame with data - treat as state change if isolated
-							bJustBecameIsolated = bIsolated;
-						}
-					}
+	FKawaiiFluidSplashSettings Settings;
+	Settings.ConditionMode = VolumeComponent->SplashConditionMode;
+	Settings.VelocityThreshold = VolumeComponent->SplashVelocityThreshold;
+	Settings.IsolationNeighborThreshold = VolumeComponent->IsolationNeighborThreshold;
+	Settings.Budget = VolumeComponent->MaxSplashVFXPerFrame;
 
-					// Evaluate spawn condition based on mode
-					// For isolation-related modes, only spawn on state change (non-isolated -> isolated)
-					bool bShouldSpawn = false;
-					switch (SplashConditionMode)
-					{
-					case ESplashConditionMode::VelocityAndIsolation:
-						bShouldSpawn = bFastMoving && bJustBecameIsolated;
-						break;
-					case ESplashConditionMode::VelocityOrIsolation:
-						bShouldSpawn = bFastMoving || bJustBecameIsolated;
-						break;
-					case ESplashConditionMode::VelocityOnly:
-						bShouldSpawn = bFastMoving;
-						break;
-					case ESplashConditionMode::IsolationOnly:
-						bShouldSpawn = bJustBecameIsolated;
-						break;
-					}
+	if (bGPUActive)
+	{
+		// GPU compaction pass selects candidates; results arrive with readback latency
+		GPUSimulator->SetSplashDetection(bNeedVFX, Settings);
+		if (!bNeedVFX || !GPUSimulator->ConsumeSplashCandidates(SplashCandidates))
+		{
+			SplashCandidates.Reset();
+		}
+	}
+	else if (bNeedVFX && SimulationModule)
+	{
+		// CPU simulation: run the reference selection on the CPU particles
+		const TArray<FFluidParticle>& Particles = SimulationModule->GetParticles();
+		const int32 NumParticles = Particles.Num();
 
-					if (bShouldSpawn)
-					{
-						UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-							this,
-							SplashVFX,
-							Positions[i],
-							VelocityDir.Rotation()
-						);
-						++SpawnCount;
-					}
-				}
+		TArray<FVector3f> Positions;
+		TArray<FVector3f> Velocities;
+		TArray<uint32> NeighborCounts;
+		TArray<int32> ParticleIDs;
+		Positions.SetNumUninitialized(NumParticles);
+		Velocities.SetNumUninitialized(NumParticles);
+		NeighborCounts.SetNumUninitialized(NumParticles);
+		ParticleIDs.SetNumUninitialized(NumParticles);
+		for (int32 i = 0; i < NumParticles; ++i)
+		{
+			Positions[i] = FVector3f(Particles[i].Position);
+			Velocities[i] = FVector3f(Particles[i].Velocity);
+			NeighborCounts[i] = Particles[i].NeighborIndices.Num();
+			ParticleIDs[i] = Particles[i].ParticleID;
+		}
 
-				// Update previous neighbor counts for next frame's state change detection
-				if (bHasNeighborData)
-				{
-					PrevNeighborCounts = CachedNeighborCounts;
-				}
-			}
+		FKawaiiFluidSplashSelector::CompactCandidates(
+			Positions, Velocities, NeighborCounts, ParticleIDs,
+			CPUSplashWasIsolated, Settings, CPUSplashFrameIndex++, SplashCandidates);
+		FKawaiiFluidSplashSelector::SelectTopCandidates(SplashCandidates, Settings.Budget);
+	}
+	else
+	{
+		SplashCandidates.Reset();
+	}
+
+	if (!bNeedVFX)
+	{
+		CleanupSplashVFX();
+		return;
+	}
+
+	EmitSplashes(SplashCandidates);
+}
+
+void AKawaiiFluidVolume::EmitSplashes(const TArray<FGPUSplashCandidate>& Candidates)
+{
+	UNiagaraSystem* SplashVFX = VolumeComponent->SplashVFX;
+
+	// The pooled path only works with a system authored for it; anything else falls back to per-splash spawns
+	bool bPooled = VolumeComponent->bPooledSplashVFX;
+	if (bPooled && PooledSplashCheckedSystem.Get() != SplashVFX)
+	{
+		PooledSplashCheckedSystem = SplashVFX;
+		bPooledSplashParamsFound = HasPooledSplashParams(SplashVFX);
+		if (!bPooledSplashParamsFound)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("AKawaiiFluidVolume [%s]: SplashVFX %s lacks User.SplashPositions/SplashDirections/SplashCount, using one system per splash"),
+				*GetName(), *SplashVFX->GetName());
 		}
 	}
+	bPooled = bPooled && bPooledSplashParamsFound;
 
-	// Simulation is handled by subsystem for proper batching
-	// The Subsystem tick runs after actor ticks, so particles spawned above
-	// will be simulated in the current frame.
+	if (!bPooled)
+	{
+		CleanupSplashVFX();
+
+		// Legacy: one system per splash (budget already applied)
+		for (const FGPUSplashCandidate& Candidate : Candidates)
+		{
+			const FVector VelocityDir = FVector(Candidate.Velocity).GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector);
+			UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+				this,
+				SplashVFX,
+				FVector(Candidate.Position),
+				VelocityDir.Rotation()
+			);
+		}
+		return;
+	}
+
+	// Pooled: one persistent component, splashes passed as user array parameters
+	if (SplashNiagaraComponent && SplashNiagaraComponent->GetAsset() != SplashVFX)
+	{
+		CleanupSplashVFX();
+	}
+
+	if (!SplashNiagaraComponent)
+	{
+		if (Candidates.Num() == 0)
+		{
+			return;
+		}
+
+		SplashNiagaraComponent = UNiagaraFunctionLibrary::SpawnSystemAttached(
+			SplashVFX,
+			VolumeComponent,
+			NAME_None,
+			FVector::ZeroVector,
+			FRotator::ZeroRotator,
+			EAttachLocation::KeepRelativeOffset,
+			/*bAutoDestroy=*/false,
+			/*bAutoActivate=*/true,
+			ENCPoolMethod::None);
+		if (!SplashNiagaraComponent)
+		{
+			return;
+		}
+
+		// Splash positions are world space
+		SplashNiagaraComponent->SetUsingAbsoluteLocation(true);
+		SplashNiagaraComponent->SetUsingAbsoluteRotation(true);
+		SplashNiagaraComponent->SetWorldLocationAndRotation(FVector::ZeroVector, FRotator::ZeroRotator);
+		bSplashNiagaraHasSplashes = true;
+	}
+
+	// Nothing new and the component was already told so: skip parameter updates
+	if (Candidates.Num() == 0 && !bSplashNiagaraHasSplashes)
+	{
+		return;
+	}
+
+	TArray<FVector> SplashPositions;
+	TArray<FVector> SplashDirections;
+	SplashPositions.Reserve(Candidates.Num());
+	SplashDirections.Reserve(Candidates.Num());
+	for (const FGPUSplashCandidate& Candidate : Candidates)
+	{
+		SplashPositions.Add(FVector(Candidate.Position));
+		SplashDirections.Add(FVector(Candidate.Velocity).GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector));
+	}
+
+	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayPosition(SplashNiagaraComponent, SplashPositionsParamName, SplashPositions);
+	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector(SplashNiagaraComponent, SplashDirectionsParamName, SplashDirections);
+	SplashNiagaraComponent->SetVariableInt(SplashCountParamName, Candidates.Num());
+	bSplashNiagaraHasSplashes = Candidates.Num() > 0;
+}
+
+void AKawaiiFluidVolume::CleanupSplashVFX()
+{
+	if (SplashNiagaraComponent)
+	{
+		SplashNiagaraComponent->DestroyComponent();
+		SplashNiagaraComponent = nullptr;
+	}
+	bSplashNiagaraHasSplashes = false;
 }
 
 #if WITH_EDITOR
@@ -798,6 +903,7 @@ void AKawaiiFluidVolume::InitializeSimulation()
 
 	// Forward VolumeComponent properties to SimulationModule
 	SimulationModule->bUseWorldCollision = VolumeComponent->bUseWorldCollision;
+	SimulationModule->bUseWorldSDFCache = VolumeComponent->bUseWorldSDFCache;
 	SimulationModule->bEnableCollisionEvents = VolumeComponent->bEnableCollisionEvents;
 	SimulationModule->MinVelocityForEvent = VolumeComponent->MinVelocityForEvent;
 	SimulationModule->MaxEventsPerFrame = VolumeComponent->MaxEventsPerFrame;
@@ -1062,6 +1168,8 @@ void AKawaiiFluidVolume::CleanupRendering()
 		RenderingModule->Cleanup();
 	}
 
+	CleanupSplashVFX();
+
 	UE_LOG(LogTemp, Log, TEXT("AKawaiiFluidVolume [%s]: Rendering cleaned up"), *GetName());
 }
 
@@ -1662,24 +1770,69 @@ void AKawaiiFluidVolume::AddParticlesInRadius(const FVector& WorldCenter, float
 		return;
 	}
 
-	// Hemisphere distribution above surface
-	for (int32 i = 0; i < Count; ++i)
+	TArray<FVector> SpawnPositions;
+	const FKawaiiFluidBrushSampleRegion Region(WorldCenter, WorldCenter, Radius, SurfaceNormal);
+	ComputeBrushSpawnPositions(Region, Count, Randomness, BrushStrokeSeed++, /*bFillEmptySpace=*/false, {}, SpawnPositions);
+	for (const FVector& SpawnPos : SpawnPositions)
 	{
-		// Random point in unit sphere
-		FVector RandomDir = FMath::VRand();
+		SimulationModule->SpawnParticle(SpawnPos, Velocity);
+	}
+}
 
-		// Ensure above surface (dot with normal > 0)
-		if (FVector::DotProduct(RandomDir, SurfaceNormal) < 0)
+void AKawaiiFluidVolume::ComputeBrushSpawnPositions(const FKawaiiFluidBrushSampleRegion& Region, int32 Count,
+                                                    float Randomness, int32 Seed, bool bFillEmptySpace,
+                                                    TConstArrayView<FVector> ExtraOccupied,
+                                                    TArray<FVector>& OutPositions) const
+{
+	OutPositions.Reset(FMath::Max(Count, 0));
+	if (Count <= 0)
+	{
+		return;
+	}
+
+	if (!bFillEmptySpace)
+	{
+		// Legacy: hemisphere distribution above surface, ignores existing particles
+		FRandomStream Stream(Seed);
+		for (int32 i = 0; i < Count; ++i)
 		{
-			RandomDir = -RandomDir;
+			// Random point in unit sphere
+			FVector RandomDir = Stream.GetUnitVector();
+
+			// Ensure above surface (dot with normal > 0)
+			if (FVector::DotProduct(RandomDir, Region.SurfaceNormal) < 0)
+			{
+				RandomDir = -RandomDir;
+			}
+
+			// Apply randomness to radius
+			const float RandomRadius = Region.Radius * Stream.FRandRange(1.0f - Randomness, 1.0f);
+			OutPositions.Add(Region.End + RandomDir * RandomRadius);
 		}
+		return;
+	}
 
-		// Apply randomness to radius
-		const float RandomRadius = Radius * FMath::FRandRange(1.0f - Randomness, 1.0f);
-		const FVector SpawnPos = WorldCenter + RandomDir * RandomRadius;
+	// Fill only empty space: spawning inside existing fluid would start far above rest density
+	const float Spacing = GetParticleSpacing();
+	FKawaiiFluidBrushSampleRegion FillRegion = Region;
+	FillRegion.MinHeight = FMath::Max(Region.MinHeight, 0.5f * Spacing);
 
-		SimulationModule->SpawnParticle(SpawnPos, Velocity);
+	FKawaiiFluidBrushSampler Sampler(Spacing);
+	if (SimulationModule)
+	{
+		// All sources, emitter fluid included. GPU mode reads the last readback, so very recent spawns
+		// come in through ExtraOccupied
+		const FVector QueryCenter = 0.5 * (Region.Start + Region.End);
+		const float QueryRadius = 0.5f * FVector::Dist(Region.Start, Region.End) + Region.Radius + Spacing;
+		TArray<FVector3f> Existing;
+		if (SimulationModule->CollectOccupiedPositionsInSphere(QueryCenter, QueryRadius, Existing))
+		{
+			Sampler.AddOccupied(Existing);
+		}
 	}
+	Sampler.AddOccupied(ExtraOccupied);
+
+	Sampler.Sample(FillRegion, Count, Seed, OutPositions);
 }
 
 void AKawaiiFluidVolume::RemoveParticlesInRadiusGPU(const FVector& WorldCenter, float Radius)
@@ -1721,11 +1874,10 @@ void AKawaiiFluidVolume::ClearAllParticles()
 	// Clear cached shadow data (like UKawaiiFluidComponent does)
 	CachedShadowPositions.Empty();
 	CachedShadowVelocities.Empty();
-	CachedNeighborCounts.Empty();
 	CachedAnisotropyAxis1.Empty();
 	CachedAnisotropyAxis2.Empty();
 	CachedAnisotropyAxis3.Empty();
-	PrevNeighborCounts.Empty();
+	CPUSplashWasIsolated.Empty();
 
 	// Just update rendering - will show 0 particles
 	// DO NOT call Cleanup() - that destroys the rendering infrastructure
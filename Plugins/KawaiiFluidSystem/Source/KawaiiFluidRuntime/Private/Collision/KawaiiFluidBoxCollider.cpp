@@ -208,6 +208,18 @@ FVector UKawaiiFluidBoxCollider::LocalToWorld(const FVector& LocalPoint) const
 	return RotatedPoint + GetBoxCenter();
 }
 
+/**
+ * @brief Returns the world space bounds of the box.
+ * @return Axis-aligned box enclosing the rotated box
+ */
+FBox UKawaiiFluidBoxCollider::GetQueryBounds() const
+{
+	AActor* Owner = GetOwner();
+	const FRotator Rotation = Owner ? Owner->GetActorRotation() : FRotator::ZeroRotator;
+
+	return FBox(-BoxExtent, BoxExtent).TransformBy(FTransform(Rotation, GetBoxCenter()));
+}
+
 /**
  * @brief Returns the world space center of the box.
  * @return World space position
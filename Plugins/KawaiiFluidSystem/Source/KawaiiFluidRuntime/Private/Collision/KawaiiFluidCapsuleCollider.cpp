@@ -103,6 +103,21 @@ float UKawaiiFluidCapsuleCollider::GetSignedDistance(const FVector& Point, FVect
 	return DistanceToLine - Radius;
 }
 
+/**
+ * @brief Returns the world space bounds of the capsule.
+ * @return Axis-aligned box enclosing both hemispheres
+ */
+FBox UKawaiiFluidCapsuleCollider::GetQueryBounds() const
+{
+	FVector Start, End;
+	GetCapsuleEndpoints(Start, End);
+
+	FBox Bounds(ForceInit);
+	Bounds += Start;
+	Bounds += End;
+	return Bounds.ExpandBy(Radius);
+}
+
 /**
  * @brief Returns the world space center of the capsule.
  * @return World space position
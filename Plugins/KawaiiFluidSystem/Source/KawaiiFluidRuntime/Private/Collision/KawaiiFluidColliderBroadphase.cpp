@@ -0,0 +1,121 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Collision/KawaiiFluidColliderBroadphase.h"
+#include "Collision/KawaiiFluidCollider.h"
+
+FKawaiiFluidColliderBroadphase::FKawaiiFluidColliderBroadphase()
+	: CellSize(100.0f)
+	, NumColliders(0)
+{
+}
+
+void FKawaiiFluidColliderBroadphase::Build(const TArray<TObjectPtr<UKawaiiFluidCollider>>& Colliders, float Margin)
+{
+	// Colliders move and the cell size follows them, so cells are not kept between builds
+	Grid.Reset();
+	GlobalColliders.Reset();
+	InflatedBounds.Reset();
+	InflatedBounds.Init(FBox(ForceInit), Colliders.Num());
+	NumColliders = 0;
+
+	const float SafeMargin = FMath::Max(Margin, 0.0f);
+	TArray<float, TInlineAllocator<32>> BoundsSizes;
+
+	for (int32 i = 0; i < Colliders.Num(); ++i)
+	{
+		const UKawaiiFluidCollider* Collider = Colliders[i];
+		if (!Collider || !Collider->IsColliderEnabled())
+		{
+			continue;
+		}
+
+		++NumColliders;
+		const FBox Bounds = Collider->GetQueryBounds();
+		if (Bounds.IsValid)
+		{
+			InflatedBounds[i] = Bounds.ExpandBy(SafeMargin);
+			BoundsSizes.Add(static_cast<float>(InflatedBounds[i].GetSize().GetMax()));
+		}
+		else
+		{
+			GlobalColliders.Add(i);
+		}
+	}
+
+	if (BoundsSizes.Num() == 0)
+	{
+		return;
+	}
+
+	// A typical collider then covers 1-8 cells
+	BoundsSizes.Sort();
+	CellSize = FMath::Max(BoundsSizes[BoundsSizes.Num() / 2], 1.0f);
+
+	for (int32 i = 0; i < InflatedBounds.Num(); ++i)
+	{
+		const FBox& Bounds = InflatedBounds[i];
+		if (!Bounds.IsValid)
+		{
+			continue;
+		}
+
+		const FIntVector MinCell = GetCellCoord(Bounds.Min);
+		const FIntVector MaxCell = GetCellCoord(Bounds.Max);
+		const double NumCells = (static_cast<double>(MaxCell.X) - MinCell.X + 1.0)
+			* (static_cast<double>(MaxCell.Y) - MinCell.Y + 1.0)
+			* (static_cast<double>(MaxCell.Z) - MinCell.Z + 1.0);
+
+		// Huge colliders (floors, level meshes) would flood the grid
+		if (NumCells > MaxCellsPerCollider)
+		{
+			GlobalColliders.Add(i);
+			continue;
+		}
+
+		for (int32 x = MinCell.X; x <= MaxCell.X; ++x)
+		{
+			for (int32 y = MinCell.Y; y <= MaxCell.Y; ++y)
+			{
+				for (int32 z = MinCell.Z; z <= MaxCell.Z; ++z)
+				{
+					Grid.FindOrAdd(FIntVector(x, y, z)).Add(i);
+				}
+			}
+		}
+	}
+
+	GlobalColliders.Sort();
+}
+
+void FKawaiiFluidColliderBroadphase::Query(const FVector& Position, FCandidateList& OutColliders) const
+{
+	OutColliders.Reset();
+
+	const TArray<int32>* CellColliders = Grid.Num() > 0 ? Grid.Find(GetCellCoord(Position)) : nullptr;
+	const int32 NumCellColliders = CellColliders ? CellColliders->Num() : 0;
+	const int32 NumGlobalColliders = GlobalColliders.Num();
+
+	// Merge both ascending lists so candidates keep the collider array order
+	int32 c = 0;
+	int32 g = 0;
+	while (c < NumCellColliders || g < NumGlobalColliders)
+	{
+		const bool bTakeCell = g >= NumGlobalColliders || (c < NumCellColliders && (*CellColliders)[c] < GlobalColliders[g]);
+		const int32 ColliderIdx = bTakeCell ? (*CellColliders)[c++] : GlobalColliders[g++];
+
+		const FBox& Bounds = InflatedBounds[ColliderIdx];
+		if (!Bounds.IsValid || Bounds.IsInsideOrOn(Position))
+		{
+			OutColliders.Add(ColliderIdx);
+		}
+	}
+}
+
+FIntVector FKawaiiFluidColliderBroadphase::GetCellCoord(const FVector& Position) const
+{
+	return FIntVector(
+		FMath::FloorToInt(Position.X / CellSize),
+		FMath::FloorToInt(Position.Y / CellSize),
+		FMath::FloorToInt(Position.Z / CellSize)
+	);
+}
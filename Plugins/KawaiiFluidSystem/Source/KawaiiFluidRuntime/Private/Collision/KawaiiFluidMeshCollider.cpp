@@ -10,6 +10,12 @@
 #include "Engine/StaticMesh.h"
 #include "GPU/GPUFluidParticle.h"
 
+namespace
+{
+	/** Closest-point queries farther than this outside the cached bounds find nothing */
+	constexpr float MeshColliderCullingMargin = 50.0f;
+}
+
 /**
  * @brief Default constructor for UKawaiiFluidMeshCollider.
  */
@@ -577,8 +583,7 @@ bool UKawaiiFluidMeshCollider::GetClosestPoint(const FVector& Point, FVector& Ou
 {
 	if (!bCacheValid) return false;
 
-	const float CullingMargin = 50.0f;
-	if (!CachedBounds.ExpandBy(CullingMargin).IsInside(Point)) return false;
+	if (!CachedBounds.ExpandBy(MeshColliderCullingMargin).IsInside(Point)) return false;
 
 	float MinDistance = TNumericLimits<float>::Max();
 	bool bFoundAny = false;
@@ -698,8 +703,7 @@ bool UKawaiiFluidMeshCollider::GetClosestPointWithBone(const FVector& Point, FVe
 {
 	if (!bCacheValid) { OutBoneName = NAME_None; OutBoneTransform = FTransform::Identity; return false; }
 
-	const float CullingMargin = 50.0f;
-	if (!CachedBounds.ExpandBy(CullingMargin).IsInside(Point)) { OutBoneName = NAME_None; OutBoneTransform = FTransform::Identity; return false; }
+	if (!CachedBounds.ExpandBy(MeshColliderCullingMargin).IsInside(Point)) { OutBoneName = NAME_None; OutBoneTransform = FTransform::Identity; return false; }
 
 	float MinDistance = TNumericLimits<float>::Max();
 	bool bFoundAny = false;
@@ -789,6 +793,15 @@ bool UKawaiiFluidMeshCollider::GetClosestPointWithBone(const FVector& Point, FVe
 	return bFoundAny;
 }
 
+/**
+ * @brief Returns the region in which closest-point queries can find a shape.
+ * @return Cached bounds expanded by the culling margin (invalid before caching)
+ */
+FBox UKawaiiFluidMeshCollider::GetQueryBounds() const
+{
+	return bCacheValid ? CachedBounds.ExpandBy(MeshColliderCullingMargin) : FBox(ForceInit);
+}
+
 /**
  * @brief Checks if a point is inside any of the cached collision shapes.
  * @param Point Point to check in world space
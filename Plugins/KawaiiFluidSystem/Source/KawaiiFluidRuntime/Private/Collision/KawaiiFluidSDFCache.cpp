@@ -0,0 +1,751 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Sparse-Brick SDF Cache
+// See KawaiiFluidSDFCache.h for documentation.
+
+#include "Collision/KawaiiFluidSDFCache.h"
+#include "GPU/GPUFluidParticle.h"
+#include "Async/ParallelFor.h"
+
+//========================================
+// FKawaiiFluidSDFShape
+//========================================
+
+FKawaiiFluidSDFShape FKawaiiFluidSDFShape::MakeSphere(const FVector& InCenter, float InRadius)
+{
+	FKawaiiFluidSDFShape Shape;
+	Shape.Type = EKawaiiFluidSDFShapeType::Sphere;
+	Shape.Center = InCenter;
+	Shape.Radius = InRadius;
+	return Shape;
+}
+
+FKawaiiFluidSDFShape FKawaiiFluidSDFShape::MakeCapsule(const FVector& InStart, const FVector& InEnd, float InRadius)
+{
+	FKawaiiFluidSDFShape Shape;
+	Shape.Type = EKawaiiFluidSDFShapeType::Capsule;
+	Shape.Center = InStart;
+	Shape.End = InEnd;
+	Shape.Radius = InRadius;
+	return Shape;
+}
+
+FKawaiiFluidSDFShape FKawaiiFluidSDFShape::MakeBox(const FVector& InCenter, const FVector& InExtent, const FQuat& InRotation)
+{
+	FKawaiiFluidSDFShape Shape;
+	Shape.Type = EKawaiiFluidSDFShapeType::Box;
+	Shape.Center = InCenter;
+	Shape.Extent = InExtent;
+	Shape.Rotation = InRotation.GetNormalized();
+	return Shape;
+}
+
+FKawaiiFluidSDFShape FKawaiiFluidSDFShape::MakeConvex(const FVector& InCenter, float InBoundingRadius, TArray<FPlane> InPlanes)
+{
+	FKawaiiFluidSDFShape Shape;
+	Shape.Type = EKawaiiFluidSDFShapeType::Convex;
+	Shape.Center = InCenter;
+	Shape.Radius = InBoundingRadius;
+	Shape.Planes = MoveTemp(InPlanes);
+	return Shape;
+}
+
+float FKawaiiFluidSDFShape::Evaluate(const FVector& Position) const
+{
+	switch (Type)
+	{
+	case EKawaiiFluidSDFShapeType::Sphere:
+		return static_cast<float>(FVector::Dist(Position, Center)) - Radius;
+
+	case EKawaiiFluidSDFShapeType::Capsule:
+		return static_cast<float>(FMath::PointDistToSegment(Position, Center, End)) - Radius;
+
+	case EKawaiiFluidSDFShapeType::Box:
+	{
+		const FVector Local = Rotation.UnrotateVector(Position - Center);
+		const FVector Q = Local.GetAbs() - Extent;
+		const FVector Outside(FMath::Max(Q.X, 0.0), FMath::Max(Q.Y, 0.0), FMath::Max(Q.Z, 0.0));
+		const double Inside = FMath::Min(FMath::Max3(Q.X, Q.Y, Q.Z), 0.0);
+		return static_cast<float>(Outside.Size() + Inside);
+	}
+
+	case EKawaiiFluidSDFShapeType::Convex:
+	{
+		double MaxPlaneDistance = -TNumericLimits<double>::Max();
+		for (const FPlane& Plane : Planes)
+		{
+			MaxPlaneDistance = FMath::Max(MaxPlaneDistance, Plane.PlaneDot(Position));
+		}
+		return Planes.Num() > 0 ? static_cast<float>(MaxPlaneDistance) : TNumericLimits<float>::Max();
+	}
+	}
+
+	return TNumericLimits<float>::Max();
+}
+
+FBox FKawaiiFluidSDFShape::GetBounds() const
+{
+	switch (Type)
+	{
+	case EKawaiiFluidSDFShapeType::Sphere:
+	case EKawaiiFluidSDFShapeType::Convex:
+		return FBox(Center - FVector(Radius), Center + FVector(Radius));
+
+	case EKawaiiFluidSDFShapeType::Capsule:
+	{
+		FBox Bounds(ForceInit);
+		Bounds += Center;
+		Bounds += End;
+		return Bounds.ExpandBy(Radius);
+	}
+
+	case EKawaiiFluidSDFShapeType::Box:
+		return FBox(-Extent, Extent).TransformBy(FTransform(Rotation, Center));
+	}
+
+	return FBox(ForceInit);
+}
+
+//========================================
+// FKawaiiFluidSDFCache
+//========================================
+
+FKawaiiFluidSDFCache::FKawaiiFluidSDFCache(float InVoxelSize, float InNarrowBand)
+	: VoxelSize(FMath::Max(InVoxelSize, 0.1f))
+	, NarrowBand(FMath::Max(InNarrowBand, 0.0f))
+{
+}
+
+FKawaiiFluidSDFCache::~FKawaiiFluidSDFCache()
+{
+	// Build input is a snapshot, but don't leave tasks running past our lifetime
+	if (PendingBuild.IsValid())
+	{
+		PendingBuild.Wait();
+	}
+}
+
+uint32 FKawaiiFluidSDFCache::HashShapes(const TArray<FKawaiiFluidSDFShape>& Shapes)
+{
+	uint32 Hash = GetTypeHash(Shapes.Num());
+	for (const FKawaiiFluidSDFShape& Shape : Shapes)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Shape.Type)));
+		Hash = HashCombine(Hash, GetTypeHash(Shape.Center));
+		Hash = HashCombine(Hash, GetTypeHash(Shape.End));
+		Hash = HashCombine(Hash, GetTypeHash(Shape.Extent));
+		Hash = HashCombine(Hash, GetTypeHash(Shape.Radius));
+		Hash = HashCombine(Hash, FCrc::MemCrc32(&Shape.Rotation, sizeof(FQuat)));
+		if (Shape.Planes.Num() > 0)
+		{
+			Hash = HashCombine(Hash, FCrc::MemCrc32(Shape.Planes.GetData(), Shape.Planes.Num() * sizeof(FPlane)));
+		}
+	}
+	return Hash;
+}
+
+void FKawaiiFluidSDFCache::SetOwnerShapes(int32 OwnerID, TArray<FKawaiiFluidSDFShape> Shapes)
+{
+	if (Shapes.Num() == 0)
+	{
+		RemoveOwner(OwnerID);
+		return;
+	}
+
+	const uint32 NewHash = HashShapes(Shapes);
+	FOwnerEntry* Existing = Owners.Find(OwnerID);
+	if (Existing && Existing->Hash == NewHash)
+	{
+		return;
+	}
+
+	FBox NewBounds(ForceInit);
+	for (const FKawaiiFluidSDFShape& Shape : Shapes)
+	{
+		NewBounds += Shape.GetBounds();
+	}
+
+	// Old footprint must be rebuilt too (shape moved away or shrank)
+	if (Existing)
+	{
+		MarkDirty(Existing->Bounds);
+	}
+	MarkDirty(NewBounds);
+
+	FOwnerEntry& Entry = Owners.FindOrAdd(OwnerID);
+	Entry.Shapes = MoveTemp(Shapes);
+	Entry.Bounds = NewBounds;
+	Entry.Hash = NewHash;
+}
+
+void FKawaiiFluidSDFCache::RemoveOwner(int32 OwnerID)
+{
+	FOwnerEntry Removed;
+	if (Owners.RemoveAndCopyValue(OwnerID, Removed))
+	{
+		MarkDirty(Removed.Bounds);
+	}
+}
+
+void FKawaiiFluidSDFCache::InvalidateOwner(int32 OwnerID)
+{
+	if (const FOwnerEntry* Entry = Owners.Find(OwnerID))
+	{
+		MarkDirty(Entry->Bounds);
+	}
+}
+
+void FKawaiiFluidSDFCache::SyncFromPrimitives(const FGPUCollisionPrimitives& Primitives)
+{
+	TMap<int32, TArray<FKawaiiFluidSDFShape>> ShapesByOwner;
+
+	// Only static world geometry is baked (bone-driven and interaction primitives move every frame)
+	for (const FGPUCollisionSphere& Sphere : Primitives.Spheres)
+	{
+		if (Sphere.BoneIndex < 0 && !Sphere.bHasFluidInteraction)
+		{
+			ShapesByOwner.FindOrAdd(Sphere.OwnerID).Add(FKawaiiFluidSDFShape::MakeSphere(FVector(Sphere.Center), Sphere.Radius));
+		}
+	}
+
+	for (const FGPUCollisionCapsule& Capsule : Primitives.Capsules)
+	{
+		if (Capsule.BoneIndex < 0 && !Capsule.bHasFluidInteraction)
+		{
+			ShapesByOwner.FindOrAdd(Capsule.OwnerID).Add(
+				FKawaiiFluidSDFShape::MakeCapsule(FVector(Capsule.Start), FVector(Capsule.End), Capsule.Radius));
+		}
+	}
+
+	for (const FGPUCollisionBox& Box : Primitives.Boxes)
+	{
+		if (Box.BoneIndex < 0 && !Box.bHasFluidInteraction)
+		{
+			const FQuat Rotation(Box.Rotation.X, Box.Rotation.Y, Box.Rotation.Z, Box.Rotation.W);
+			ShapesByOwner.FindOrAdd(Box.OwnerID).Add(
+				FKawaiiFluidSDFShape::MakeBox(FVector(Box.Center), FVector(Box.Extent), Rotation));
+		}
+	}
+
+	for (const FGPUCollisionConvex& Convex : Primitives.Convexes)
+	{
+		if (Convex.BoneIndex >= 0 || Convex.bHasFluidInteraction ||
+			!Primitives.ConvexPlanes.IsValidIndex(Convex.PlaneStartIndex) ||
+			!Primitives.ConvexPlanes.IsValidIndex(Convex.PlaneStartIndex + Convex.PlaneCount - 1))
+		{
+			continue;
+		}
+
+		TArray<FPlane> Planes;
+		Planes.Reserve(Convex.PlaneCount);
+		for (int32 i = 0; i < Convex.PlaneCount; ++i)
+		{
+			const FGPUConvexPlane& Plane = Primitives.ConvexPlanes[Convex.PlaneStartIndex + i];
+			Planes.Add(FPlane(FVector(Plane.Normal), Plane.Distance));
+		}
+		ShapesByOwner.FindOrAdd(Convex.OwnerID).Add(
+			FKawaiiFluidSDFShape::MakeConvex(FVector(Convex.Center), Convex.BoundingRadius, MoveTemp(Planes)));
+	}
+
+	// Owners no longer present
+	TArray<int32> RemovedOwners;
+	for (const TPair<int32, FOwnerEntry>& Pair : Owners)
+	{
+		if (!ShapesByOwner.Contains(Pair.Key))
+		{
+			RemovedOwners.Add(Pair.Key);
+		}
+	}
+	for (const int32 OwnerID : RemovedOwners)
+	{
+		RemoveOwner(OwnerID);
+	}
+
+	for (TPair<int32, TArray<FKawaiiFluidSDFShape>>& Pair : ShapesByOwner)
+	{
+		SetOwnerShapes(Pair.Key, MoveTemp(Pair.Value));
+	}
+}
+
+void FKawaiiFluidSDFCache::SetClipBounds(const FBox& InClipBounds)
+{
+	if (ClipBounds.IsValid == InClipBounds.IsValid &&
+		(!InClipBounds.IsValid || (ClipBounds.Min.Equals(InClipBounds.Min) && ClipBounds.Max.Equals(InClipBounds.Max))))
+	{
+		return;
+	}
+
+	ClipBounds = InClipBounds;
+
+	// Bricks outside the new region must go; everything inside is rebuilt
+	if (PendingBuild.IsValid())
+	{
+		PendingBuild.Wait();
+		PendingBuild = {};
+	}
+	Bricks.Reset();
+	DirtyBricks.Reset();
+	++BrickRevision;
+	for (const TPair<int32, FOwnerEntry>& Pair : Owners)
+	{
+		MarkDirty(Pair.Value.Bounds);
+	}
+}
+
+void FKawaiiFluidSDFCache::Reset()
+{
+	if (PendingBuild.IsValid())
+	{
+		PendingBuild.Wait();
+		PendingBuild = {};
+	}
+	Owners.Reset();
+	Bricks.Reset();
+	DirtyBricks.Reset();
+	++BrickRevision;
+}
+
+FBox FKawaiiFluidSDFCache::GetBrickBounds(const FIntVector& Coord) const
+{
+	const double BrickSize = static_cast<double>(VoxelSize) * BrickCells;
+	const FVector Min = FVector(Coord) * BrickSize;
+	return FBox(Min, Min + FVector(BrickSize));
+}
+
+void FKawaiiFluidSDFCache::MarkDirty(const FBox& Bounds)
+{
+	if (!Bounds.IsValid)
+	{
+		return;
+	}
+
+	FBox Region = Bounds.ExpandBy(NarrowBand + VoxelSize);
+	if (ClipBounds.IsValid)
+	{
+		if (!Region.Intersect(ClipBounds))
+		{
+			return;
+		}
+		Region = Region.Overlap(ClipBounds);
+	}
+
+	const double InvBrickSize = 1.0 / (static_cast<double>(VoxelSize) * BrickCells);
+	const FIntVector Min(
+		FMath::FloorToInt(Region.Min.X * InvBrickSize),
+		FMath::FloorToInt(Region.Min.Y * InvBrickSize),
+		FMath::FloorToInt(Region.Min.Z * InvBrickSize));
+	const FIntVector Max(
+		FMath::FloorToInt(Region.Max.X * InvBrickSize),
+		FMath::FloorToInt(Region.Max.Y * InvBrickSize),
+		FMath::FloorToInt(Region.Max.Z * InvBrickSize));
+
+	const int64 Count = int64(Max.X - Min.X + 1) * int64(Max.Y - Min.Y + 1) * int64(Max.Z - Min.Z + 1);
+	if (Count > MaxBricks)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SDFCache] SKIP: shape footprint needs %lld bricks (MaxBricks=%d), use SetClipBounds"),
+			Count, MaxBricks);
+		return;
+	}
+
+	for (int32 z = Min.Z; z <= Max.Z; ++z)
+	{
+		for (int32 y = Min.Y; y <= Max.Y; ++y)
+		{
+			for (int32 x = Min.X; x <= Max.X; ++x)
+			{
+				DirtyBricks.Add(FIntVector(x, y, z));
+			}
+		}
+	}
+}
+
+TSharedRef<FKawaiiFluidSDFCache::FBuildInput> FKawaiiFluidSDFCache::MakeBuildInput() const
+{
+	TSharedRef<FBuildInput> Input = MakeShared<FBuildInput>();
+	Input->VoxelSize = VoxelSize;
+	Input->NarrowBand = NarrowBand;
+
+	for (const TPair<int32, FOwnerEntry>& Pair : Owners)
+	{
+		for (const FKawaiiFluidSDFShape& Shape : Pair.Value.Shapes)
+		{
+			Input->Shapes.Add(Shape);
+			Input->ShapeOwners.Add(Pair.Key);
+			Input->ExpandedBounds.Add(Shape.GetBounds().ExpandBy(NarrowBand + VoxelSize));
+		}
+	}
+	return Input;
+}
+
+TArray<FKawaiiFluidSDFCache::FBrickResult> FKawaiiFluidSDFCache::BuildBricks(const FBuildInput& Input, const TArray<FIntVector>& Coords)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidSDFCache_BuildBricks);
+
+	TArray<FBrickResult> Results;
+	Results.SetNum(Coords.Num());
+
+	const double BrickSize = static_cast<double>(Input.VoxelSize) * BrickCells;
+	const float KeepThreshold = Input.NarrowBand + Input.VoxelSize;
+
+	ParallelFor(Coords.Num(), [&](int32 BrickIndex)
+	{
+		FBrickResult& Result = Results[BrickIndex];
+		Result.Coord = Coords[BrickIndex];
+
+		const FVector BrickMin = FVector(Result.Coord) * BrickSize;
+		const FBox BrickBounds(BrickMin, BrickMin + FVector(BrickSize));
+
+		FBrick Brick;
+		TArray<int32, TInlineAllocator<16>> Candidates;
+		TArray<uint8, TInlineAllocator<16>> CandidateOwnerSlots;
+		for (int32 ShapeIndex = 0; ShapeIndex < Input.Shapes.Num(); ++ShapeIndex)
+		{
+			if (Input.ExpandedBounds[ShapeIndex].Intersect(BrickBounds))
+			{
+				const int32 OwnerID = Input.ShapeOwners[ShapeIndex];
+				int32 OwnerSlot = Brick.OwnerIDs.IndexOfByKey(OwnerID);
+				if (OwnerSlot == INDEX_NONE && Brick.OwnerIDs.Num() < UnknownOwnerSlot)
+				{
+					OwnerSlot = Brick.OwnerIDs.Add(OwnerID);
+				}
+
+				Candidates.Add(ShapeIndex);
+				CandidateOwnerSlots.Add(OwnerSlot == INDEX_NONE ? UnknownOwnerSlot : static_cast<uint8>(OwnerSlot));
+			}
+		}
+
+		if (Candidates.Num() == 0)
+		{
+			return;
+		}
+
+		const int32 NumSamples = BrickSamples * BrickSamples * BrickSamples;
+		Brick.Samples.SetNumUninitialized(NumSamples);
+		Brick.SampleOwners.SetNumUninitialized(NumSamples);
+		float MinSample = TNumericLimits<float>::Max();
+
+		int32 SampleIndex = 0;
+		for (int32 z = 0; z < BrickSamples; ++z)
+		{
+			for (int32 y = 0; y < BrickSamples; ++y)
+			{
+				for (int32 x = 0; x < BrickSamples; ++x)
+				{
+					const FVector Position = BrickMin + FVector(x, y, z) * Input.VoxelSize;
+					float Distance = TNumericLimits<float>::Max();
+					uint8 OwnerSlot = UnknownOwnerSlot;
+					for (int32 c = 0; c < Candidates.Num(); ++c)
+					{
+						const float ShapeDistance = Input.Shapes[Candidates[c]].Evaluate(Position);
+						if (ShapeDistance < Distance)
+						{
+							Distance = ShapeDistance;
+							OwnerSlot = CandidateOwnerSlots[c];
+						}
+					}
+					Brick.Samples[SampleIndex] = Distance;
+					Brick.SampleOwners[SampleIndex] = OwnerSlot;
+					++SampleIndex;
+					MinSample = FMath::Min(MinSample, Distance);
+				}
+			}
+		}
+
+		// Brick entirely outside the narrow band reads as "far"
+		if (MinSample <= KeepThreshold)
+		{
+			Result.Brick = MoveTemp(Brick);
+		}
+	});
+
+	return Results;
+}
+
+void FKawaiiFluidSDFCache::ApplyResults(TArray<FBrickResult>& Results)
+{
+	for (FBrickResult& Result : Results)
+	{
+		if (Result.Brick.Samples.Num() > 0)
+		{
+			Bricks.Add(Result.Coord, MoveTemp(Result.Brick));
+		}
+		else
+		{
+			Bricks.Remove(Result.Coord);
+		}
+	}
+	if (Results.Num() > 0)
+	{
+		++BrickRevision;
+	}
+}
+
+void FKawaiiFluidSDFCache::BuildDirtyBricks()
+{
+	if (PendingBuild.IsValid())
+	{
+		PendingBuild.Wait();
+		ApplyCompletedBuild();
+	}
+
+	if (DirtyBricks.Num() == 0)
+	{
+		return;
+	}
+
+	const TArray<FIntVector> Coords = DirtyBricks.Array();
+	DirtyBricks.Reset();
+
+	TArray<FBrickResult> Results = BuildBricks(*MakeBuildInput(), Coords);
+	ApplyResults(Results);
+}
+
+void FKawaiiFluidSDFCache::KickAsyncBuild()
+{
+	if (PendingBuild.IsValid() || DirtyBricks.Num() == 0)
+	{
+		return;
+	}
+
+	TSharedRef<FBuildInput> Input = MakeBuildInput();
+	TArray<FIntVector> Coords = DirtyBricks.Array();
+	DirtyBricks.Reset();
+
+	PendingBuild = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[Input, Coords = MoveTemp(Coords)]()
+		{
+			return BuildBricks(*Input, Coords);
+		});
+}
+
+bool FKawaiiFluidSDFCache::ApplyCompletedBuild()
+{
+	if (!PendingBuild.IsValid() || !PendingBuild.IsCompleted())
+	{
+		return false;
+	}
+
+	// Bricks dirtied again while the build ran stay in DirtyBricks and are rebuilt next time
+	ApplyResults(PendingBuild.GetResult());
+	PendingBuild = {};
+	return true;
+}
+
+bool FKawaiiFluidSDFCache::Sample(const FVector& Position, float& OutDistance, FVector& OutNormal) const
+{
+	int32 OwnerID;
+	return Sample(Position, OutDistance, OutNormal, OwnerID);
+}
+
+bool FKawaiiFluidSDFCache::Sample(const FVector& Position, float& OutDistance, FVector& OutNormal, int32& OutOwnerID) const
+{
+	const FVector Grid = Position / VoxelSize;
+	const FIntVector BrickCoord(
+		FMath::FloorToInt(Grid.X / BrickCells),
+		FMath::FloorToInt(Grid.Y / BrickCells),
+		FMath::FloorToInt(Grid.Z / BrickCells));
+
+	const FBrick* Brick = Bricks.Find(BrickCoord);
+	if (!Brick)
+	{
+		return false;
+	}
+
+	const FVector Local = Grid - FVector(BrickCoord) * BrickCells;
+	const int32 X0 = FMath::Clamp(FMath::FloorToInt(Local.X), 0, BrickCells - 1);
+	const int32 Y0 = FMath::Clamp(FMath::FloorToInt(Local.Y), 0, BrickCells - 1);
+	const int32 Z0 = FMath::Clamp(FMath::FloorToInt(Local.Z), 0, BrickCells - 1);
+	const float Fx = FMath::Clamp(static_cast<float>(Local.X - X0), 0.0f, 1.0f);
+	const float Fy = FMath::Clamp(static_cast<float>(Local.Y - Y0), 0.0f, 1.0f);
+	const float Fz = FMath::Clamp(static_cast<float>(Local.Z - Z0), 0.0f, 1.0f);
+
+	const float* Data = Brick->Samples.GetData();
+	auto At = [Data](int32 x, int32 y, int32 z)
+	{
+		return Data[(z * BrickSamples + y) * BrickSamples + x];
+	};
+
+	const float C000 = At(X0, Y0, Z0),         C100 = At(X0 + 1, Y0, Z0);
+	const float C010 = At(X0, Y0 + 1, Z0),     C110 = At(X0 + 1, Y0 + 1, Z0);
+	const float C001 = At(X0, Y0, Z0 + 1),     C101 = At(X0 + 1, Y0, Z0 + 1);
+	const float C011 = At(X0, Y0 + 1, Z0 + 1), C111 = At(X0 + 1, Y0 + 1, Z0 + 1);
+
+	// Interpolate along X, then Y, then Z
+	const float C00 = FMath::Lerp(C000, C100, Fx);
+	const float C10 = FMath::Lerp(C010, C110, Fx);
+	const float C01 = FMath::Lerp(C001, C101, Fx);
+	const float C11 = FMath::Lerp(C011, C111, Fx);
+	const float C0 = FMath::Lerp(C00, C10, Fy);
+	const float C1 = FMath::Lerp(C01, C11, Fy);
+	OutDistance = FMath::Lerp(C0, C1, Fz);
+
+	// Analytic gradient of the trilinear interpolant
+	const FVector Gradient(
+		FMath::Lerp(FMath::Lerp(C100 - C000, C110 - C010, Fy), FMath::Lerp(C101 - C001, C111 - C011, Fy), Fz),
+		FMath::Lerp(C10 - C00, C11 - C01, Fz),
+		C1 - C0);
+	OutNormal = Gradient.GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector);
+
+	// Owner of the nearest corner sample
+	const int32 NearestSample = ((Z0 + (Fz >= 0.5f)) * BrickSamples + (Y0 + (Fy >= 0.5f))) * BrickSamples + (X0 + (Fx >= 0.5f));
+	const uint8 OwnerSlot = Brick->SampleOwners[NearestSample];
+	OutOwnerID = Brick->OwnerIDs.IsValidIndex(OwnerSlot) ? Brick->OwnerIDs[OwnerSlot] : INDEX_NONE;
+
+	return true;
+}
+
+bool FKawaiiFluidSDFCache::Raycast(const FVector& Start, const FVector& Direction, float MaxDistance, int32 IgnoreOwnerID,
+	float& OutDistance, int32& OutOwnerID) const
+{
+	const float HitTolerance = VoxelSize * 0.1f;
+	const float MinStep = VoxelSize * 0.25f;
+
+	float Travel = 0.0f;
+	while (Travel <= MaxDistance)
+	{
+		float Distance;
+		FVector Normal;
+		int32 OwnerID;
+		if (!Sample(Start + Direction * Travel, Distance, Normal, OwnerID))
+		{
+			// No brick: every surface is farther than the narrow band
+			Travel += FMath::Max(NarrowBand, MinStep);
+			continue;
+		}
+
+		const bool bIgnored = IgnoreOwnerID != INDEX_NONE && OwnerID == IgnoreOwnerID;
+		if (Distance <= HitTolerance && !bIgnored)
+		{
+			OutDistance = Travel;
+			OutOwnerID = OwnerID;
+			return true;
+		}
+
+		// Ignored surfaces are crossed in small steps; elsewhere the distance is a safe step
+		Travel += bIgnored ? MinStep : FMath::Max(Distance, MinStep);
+	}
+
+	return false;
+}
+
+void FKawaiiFluidSDFCache::ExportBrickData(FKawaiiFluidSDFBrickData& OutData) const
+{
+	constexpr int32 SamplesPerBrick = BrickSamples * BrickSamples * BrickSamples;
+
+	OutData.VoxelSize = VoxelSize;
+	OutData.Samples.SetNumUninitialized(Bricks.Num() * SamplesPerBrick);
+
+	// Load factor <= 0.5 keeps probe chains short
+	const int32 TableSize = FMath::RoundUpToPowerOfTwo(FMath::Max(Bricks.Num() * 2, 1));
+	const uint32 TableMask = static_cast<uint32>(TableSize - 1);
+	OutData.BrickTable.Init(FIntVector4(0, 0, 0, INDEX_NONE), TableSize);
+
+	int32 BrickIndex = 0;
+	for (const TPair<FIntVector, FBrick>& Pair : Bricks)
+	{
+		FMemory::Memcpy(&OutData.Samples[BrickIndex * SamplesPerBrick], Pair.Value.Samples.GetData(), SamplesPerBrick * sizeof(float));
+
+		uint32 Slot = FKawaiiFluidSDFBrickData::HashBrickCoord(Pair.Key) & TableMask;
+		while (OutData.BrickTable[Slot].W != INDEX_NONE)
+		{
+			Slot = (Slot + 1) & TableMask;
+		}
+		OutData.BrickTable[Slot] = FIntVector4(Pair.Key.X, Pair.Key.Y, Pair.Key.Z, BrickIndex);
+		++BrickIndex;
+	}
+}
+
+//========================================
+// FKawaiiFluidSDFBrickData
+//========================================
+
+int32 FKawaiiFluidSDFBrickData::GetNumBricks() const
+{
+	constexpr int32 SamplesPerBrick = FKawaiiFluidSDFCache::BrickSamples * FKawaiiFluidSDFCache::BrickSamples * FKawaiiFluidSDFCache::BrickSamples;
+	return Samples.Num() / SamplesPerBrick;
+}
+
+uint32 FKawaiiFluidSDFBrickData::HashBrickCoord(const FIntVector& Coord)
+{
+	// Same primes as HashCell in FluidSpatialHash.ush
+	return (static_cast<uint32>(Coord.X) * 73856093u)
+		^ (static_cast<uint32>(Coord.Y) * 19349663u)
+		^ (static_cast<uint32>(Coord.Z) * 83492791u);
+}
+
+int32 FKawaiiFluidSDFBrickData::FindBrick(const FIntVector& Coord) const
+{
+	if (BrickTable.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const uint32 TableMask = static_cast<uint32>(BrickTable.Num() - 1);
+	uint32 Slot = HashBrickCoord(Coord) & TableMask;
+	for (int32 Probe = 0; Probe < BrickTable.Num(); ++Probe)
+	{
+		const FIntVector4& Entry = BrickTable[Slot];
+		if (Entry.W == INDEX_NONE)
+		{
+			return INDEX_NONE;
+		}
+		if (Entry.X == Coord.X && Entry.Y == Coord.Y && Entry.Z == Coord.Z)
+		{
+			return Entry.W;
+		}
+		Slot = (Slot + 1) & TableMask;
+	}
+	return INDEX_NONE;
+}
+
+bool FKawaiiFluidSDFBrickData::Sample(const FVector3f& Position, float& OutDistance, FVector3f& OutNormal) const
+{
+	constexpr int32 BrickCells = FKawaiiFluidSDFCache::BrickCells;
+	constexpr int32 BrickSamples = FKawaiiFluidSDFCache::BrickSamples;
+
+	const FVector3f Grid = Position * (1.0f / VoxelSize);
+	const FIntVector BrickCoord(
+		FMath::FloorToInt32(Grid.X / BrickCells),
+		FMath::FloorToInt32(Grid.Y / BrickCells),
+		FMath::FloorToInt32(Grid.Z / BrickCells));
+
+	const int32 BrickIndex = FindBrick(BrickCoord);
+	if (BrickIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const FVector3f Local = Grid - FVector3f(BrickCoord) * BrickCells;
+	const int32 X0 = FMath::Clamp(FMath::FloorToInt32(Local.X), 0, BrickCells - 1);
+	const int32 Y0 = FMath::Clamp(FMath::FloorToInt32(Local.Y), 0, BrickCells - 1);
+	const int32 Z0 = FMath::Clamp(FMath::FloorToInt32(Local.Z), 0, BrickCells - 1);
+	const float Fx = FMath::Clamp(Local.X - X0, 0.0f, 1.0f);
+	const float Fy = FMath::Clamp(Local.Y - Y0, 0.0f, 1.0f);
+	const float Fz = FMath::Clamp(Local.Z - Z0, 0.0f, 1.0f);
+
+	const float* Data = &Samples[BrickIndex * BrickSamples * BrickSamples * BrickSamples];
+	auto At = [Data](int32 x, int32 y, int32 z)
+	{
+		return Data[(z * BrickSamples + y) * BrickSamples + x];
+	};
+
+	const float C000 = At(X0, Y0, Z0),         C100 = At(X0 + 1, Y0, Z0);
+	const float C010 = At(X0, Y0 + 1, Z0),     C110 = At(X0 + 1, Y0 + 1, Z0);
+	const float C001 = At(X0, Y0, Z0 + 1),     C101 = At(X0 + 1, Y0, Z0 + 1);
+	const float C011 = At(X0, Y0 + 1, Z0 + 1), C111 = At(X0 + 1, Y0 + 1, Z0 + 1);
+
+	const float C00 = FMath::Lerp(C000, C100, Fx);
+	const float C10 = FMath::Lerp(C010, C110, Fx);
+	const float C01 = FMath::Lerp(C001, C101, Fx);
+	const float C11 = FMath::Lerp(C011, C111, Fx);
+	const float C0 = FMath::Lerp(C00, C10, Fy);
+	const float C1 = FMath::Lerp(C01, C11, Fy);
+	OutDistance = FMath::Lerp(C0, C1, Fz);
+
+	const FVector3f Gradient(
+		FMath::Lerp(FMath::Lerp(C100 - C000, C110 - C010, Fy), FMath::Lerp(C101 - C001, C111 - C011, Fy), Fz),
+		FMath::Lerp(C10 - C00, C11 - C01, Fz),
+		C1 - C0);
+	OutNormal = Gradient.GetSafeNormal(UE_SMALL_NUMBER, FVector3f::UpVector);
+
+	return true;
+}
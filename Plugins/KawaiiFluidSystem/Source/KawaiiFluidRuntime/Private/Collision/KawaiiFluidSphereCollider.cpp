@@ -80,6 +80,15 @@ float UKawaiiFluidSphereCollider::GetSignedDistance(const FVector& Point, FVecto
 	return DistanceToCenter - Radius;
 }
 
+/**
+ * @brief Returns the world space bounds of the sphere.
+ * @return Axis-aligned box enclosing the sphere
+ */
+FBox UKawaiiFluidSphereCollider::GetQueryBounds() const
+{
+	return FBox::BuildAABB(GetSphereCenter(), FVector(Radius));
+}
+
 /**
  * @brief Returns the world space center of the sphere.
  * @return World space position
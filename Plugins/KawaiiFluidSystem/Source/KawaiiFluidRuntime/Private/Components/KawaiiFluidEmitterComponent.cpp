@@ -8,6 +8,7 @@
 #include "Modules/KawaiiFluidSimulationModule.h"
 #include "GPU/GPUFluidSimulator.h"
 #include "Data/KawaiiFluidPresetDataAsset.h"
+#include "Data/KawaiiFluidPackingAsset.h"
 #include "DrawDebugHelpers.h"
 #include "Components/ArrowComponent.h"
 #include "Components/BillboardComponent.h"
@@ -165,8 +166,19 @@ void UKawaiiFluidEmitterComponent::BeginPlay()
 	UE_LOG(LogTemp, Log, TEXT("UKawaiiFluidEmitterComponent [%s]: BeginPlay - TargetVolume=%s"),
 		*GetName(), TargetVolume ? *TargetVolume->GetName() : TEXT("None"));
 
-	// Distance optimization: Check initial activation state
-	if (bUseDistanceOptimization)
+	// Distance optimization: without a custom reference actor, the Subsystem evaluates
+	// all emitters against every local player in one batched grid pass
+	UKawaiiFluidSimulatorSubsystem* ActivationSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UKawaiiFluidSimulatorSubsystem>() : nullptr;
+	if (bUseDistanceOptimization && !IsValid(DistanceReferenceActor) && ActivationSubsystem)
+	{
+		bUsesBatchedDistanceActivation = ActivationSubsystem->RegisterDistanceActivation(this, bDistanceActivated);
+
+		UE_LOG(LogTemp, Log, TEXT("UKawaiiFluidEmitterComponent [%s]: Distance Optimization (batched) - Initial state: %s (Threshold: %.1f cm)"),
+			*GetName(),
+			bDistanceActivated ? TEXT("Active") : TEXT("Inactive"),
+			ActivationDistance);
+	}
+	else if (bUseDistanceOptimization)
 	{
 		// Get reference location: custom actor if set, otherwise Player Pawn
 		FVector ReferenceLocation;
@@ -254,6 +266,18 @@ void UKawaiiFluidEmitterComponent::EndPlay(const EEndPlayReason::Type EndPlayRea
 
 	UnregisterFromVolume();
 
+	if (bUsesBatchedDistanceActivation)
+	{
+		if (UWorld* World = GetWorld())
+		{
+			if (UKawaiiFluidSimulatorSubsystem* Subsystem = World->GetSubsystem<UKawaiiFluidSimulatorSubsystem>())
+			{
+				Subsystem->UnregisterDistanceActivation(this);
+			}
+		}
+		bUsesBatchedDistanceActivation = false;
+	}
+
 	// Release SourceID back to Subsystem
 	if (CachedSourceID >= 0)
 	{
@@ -340,7 +364,11 @@ void UKawaiiFluidEmitterComponent::TickComponent(float DeltaTime, ELevelTick Tic
 	// === Distance Optimization Check ===
 	if (bIsGameWorld && bUseDistanceOptimization)
 	{
-		UpdateDistanceOptimization(DeltaTime);
+		// Batched emitters are updated by the Subsystem (ApplyDistanceActivation)
+		if (!bUsesBatchedDistanceActivation)
+		{
+			UpdateDistanceOptimization(DeltaTime);
+		}
 
 		// Skip all processing if deactivated by distance
 		if (!bDistanceActivated)
@@ -495,21 +523,29 @@ void UKawaiiFluidEmitterComponent::SpawnFill()
 
 	int32 SpawnedCount = 0;
 
-	// Always use hexagonal pattern (only mode supported)
-	switch (ShapeType)
+	if (PresettledPacking && PresettledPacking->IsBaked())
+	{
+		// Baked rest-density packing: no lattice settling after spawn
+		SpawnedCount = SpawnParticlesFromPacking(SpawnCenter, SpawnRotation, Spacing, CalculatedVelocity);
+	}
+	else
 	{
-	case EKawaiiFluidEmitterShapeType::Sphere:
-		SpawnedCount = SpawnParticlesSphereHexagonal(SpawnCenter, SpawnRotation, SphereRadius, Spacing, CalculatedVelocity);
-		break;
+		// Hexagonal pattern
+		switch (ShapeType)
+		{
+		case EKawaiiFluidEmitterShapeType::Sphere:
+			SpawnedCount = SpawnParticlesSphereHexagonal(SpawnCenter, SpawnRotation, SphereRadius, Spacing, CalculatedVelocity);
+			break;
 
-	case EKawaiiFluidEmitterShapeType::Cube:
-		SpawnedCount = SpawnParticlesCubeHexagonal(SpawnCenter, SpawnRotation, CubeHalfSize, Spacing, CalculatedVelocity);
-		break;
+		case EKawaiiFluidEmitterShapeType::Cube:
+			SpawnedCount = SpawnParticlesCubeHexagonal(SpawnCenter, SpawnRotation, CubeHalfSize, Spacing, CalculatedVelocity);
+			break;
 
-	case EKawaiiFluidEmitterShapeType::Cylinder:
-		SpawnedCount = SpawnParticlesCylinderHexagonal(SpawnCenter, SpawnRotation, CylinderRadius,
-			CylinderHalfHeight, Spacing, CalculatedVelocity);
-		break;
+		case EKawaiiFluidEmitterShapeType::Cylinder:
+			SpawnedCount = SpawnParticlesCylinderHexagonal(SpawnCenter, SpawnRotation, CylinderRadius,
+				CylinderHalfHeight, Spacing, CalculatedVelocity);
+			break;
+		}
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("UKawaiiFluidEmitterComponent::SpawnFill - Spawned %d particles"), SpawnedCount);
@@ -848,6 +884,41 @@ int32 UKawaiiFluidEmitterComponent::SpawnParticlesSphereHexagonal(FVector Center
 	return Positions.Num();
 }
 
+/**
+ * @brief Spawns the baked pre-settled packing placed by the component transform.
+ * @param Center Spawn origin
+ * @param Rotation Orientation
+ * @param Spacing Particle spacing of the target volume (checked against the bake)
+ * @param InInitialVelocity Initial velocity vector
+ * @return Number of spawned particles
+ */
+int32 UKawaiiFluidEmitterComponent::SpawnParticlesFromPacking(FVector Center, FQuat Rotation, float Spacing, FVector InInitialVelocity)
+{
+	AKawaiiFluidVolume* Volume = GetTargetVolume();
+	if (!Volume || !PresettledPacking) return 0;
+
+	if (!FMath::IsNearlyEqual(PresettledPacking->BakedParticleSpacing, Spacing, Spacing * 0.01f))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UKawaiiFluidEmitterComponent::SpawnParticlesFromPacking - %s was baked for spacing %.2f, volume uses %.2f (rebake for rest density)"),
+			*PresettledPacking->GetName(), PresettledPacking->BakedParticleSpacing, Spacing);
+	}
+
+	TArray<FVector> Positions;
+	PresettledPacking->GetPositions(FTransform(Rotation, Center), Positions);
+
+	// Check MaxParticleCount limit (Fill mode)
+	if (MaxParticleCount > 0 && Positions.Num() > MaxParticleCount)
+	{
+		Positions.SetNum(MaxParticleCount);
+	}
+
+	TArray<FVector> Velocities;
+	Velocities.Init(InInitialVelocity, Positions.Num());
+
+	QueueSpawnRequest(Positions, Velocities);
+	return Positions.Num();
+}
+
 /**
  * @brief Spawns particles in a cube using HCP packing.
  * @param Center Center position
@@ -1425,27 +1496,14 @@ AKawaiiFluidVolume* UKawaiiFluidEmitterComponent::FindNearestVolume() const
 		return NearestVolume;
 	}
 
-	// In game world, use Subsystem for registered volumes
+	// In game world, use Subsystem's volume grid for registered volumes
 	UKawaiiFluidSimulatorSubsystem* Subsystem = World->GetSubsystem<UKawaiiFluidSimulatorSubsystem>();
 	if (!Subsystem)
 	{
 		return nullptr;
 	}
 
-	for (const TObjectPtr<AKawaiiFluidVolume>& Volume : Subsystem->GetAllVolumes())
-	{
-		if (Volume)
-		{
-			const float DistSq = FVector::DistSquared(EmitterLocation, Volume->GetActorLocation());
-			if (DistSq < NearestDistSq)
-			{
-				NearestDistSq = DistSq;
-				NearestVolume = Volume;
-			}
-		}
-	}
-
-	return NearestVolume;
+	return Subsystem->FindNearestVolume(EmitterLocation);
 }
 
 /**
@@ -1502,6 +1560,18 @@ void UKawaiiFluidEmitterComponent::UpdateDistanceOptimization(float DeltaTime)
 	}
 }
 
+/**
+ * @brief Applies activation state evaluated by the Subsystem's batched distance activation.
+ * @param bNewState New activation state
+ */
+void UKawaiiFluidEmitterComponent::ApplyDistanceActivation(bool bNewState)
+{
+	if (bNewState != bDistanceActivated)
+	{
+		OnDistanceActivationChanged(bNewState);
+	}
+}
+
 /**
  * @brief Handles activation state changes based on distance optimization.
  * @param bNewState New activation state
@@ -240,10 +240,7 @@ void UKawaiiFluidInteractionComponent::DetachAllFluid()
 		{
 			if (Particle.bIsAttached && Particle.AttachedActor.Get() == Owner)
 			{
-				Particle.bIsAttached = false;
-				Particle.AttachedActor.Reset();
-				Particle.AttachedBoneName = NAME_None;
-				Particle.AttachedLocalOffset = FVector::ZeroVector;
+				Particle.ClearAttachment();
 			}
 		}
 	};
@@ -284,10 +281,7 @@ void UKawaiiFluidInteractionComponent::PushFluid(FVector Direction, float Force)
 
 				if (Particle.bIsAttached && Particle.AttachedActor.Get() == Owner)
 				{
-					Particle.bIsAttached = false;
-					Particle.AttachedActor.Reset();
-					Particle.AttachedBoneName = NAME_None;
-					Particle.AttachedLocalOffset = FVector::ZeroVector;
+					Particle.ClearAttachment();
 				}
 			}
 		}
@@ -0,0 +1,258 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Batched Distance Activation Grid
+// See KawaiiFluidActivationGrid.h for documentation.
+
+#include "Core/KawaiiFluidActivationGrid.h"
+
+FKawaiiFluidActivationGrid::FKawaiiFluidActivationGrid()
+	: SpatialHash(MinCellSize)
+{
+}
+
+FKawaiiFluidActivationGrid::FKawaiiFluidActivationGrid(float InMinCellSize)
+	: MinCellSize(FMath::Max(InMinCellSize, 1.0f))
+	, SpatialHash(FMath::Max(InMinCellSize, 1.0f))
+{
+}
+
+int32 FKawaiiFluidActivationGrid::AddEntry(const FVector& Location, float ActivationDistance, float HysteresisDistance)
+{
+	int32 Handle;
+	if (FreeHandles.Num() > 0)
+	{
+		Handle = FreeHandles.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Handle = Entries.AddDefaulted();
+	}
+
+	FKawaiiFluidActivationEntry& Entry = Entries[Handle];
+	Entry.Location = Location;
+	Entry.ActivationDistance = FMath::Max(ActivationDistance, 0.0f);
+	Entry.HysteresisDistance = FMath::Max(HysteresisDistance, 0.0f);
+	Entry.bActive = false;
+	Entry.bInUse = true;
+
+	++NumInUse;
+	bHashDirty = true;
+	return Handle;
+}
+
+void FKawaiiFluidActivationGrid::RemoveEntry(int32 Handle)
+{
+	if (!IsValidHandle(Handle))
+	{
+		return;
+	}
+
+	Entries[Handle] = FKawaiiFluidActivationEntry();
+	FreeHandles.Add(Handle);
+	--NumInUse;
+	bHashDirty = true;
+}
+
+void FKawaiiFluidActivationGrid::SetEntry(int32 Handle, const FVector& Location, float ActivationDistance, float HysteresisDistance)
+{
+	if (!IsValidHandle(Handle))
+	{
+		return;
+	}
+
+	FKawaiiFluidActivationEntry& Entry = Entries[Handle];
+	ActivationDistance = FMath::Max(ActivationDistance, 0.0f);
+	HysteresisDistance = FMath::Max(HysteresisDistance, 0.0f);
+
+	if (Entry.ActivationDistance != ActivationDistance || Entry.HysteresisDistance != HysteresisDistance)
+	{
+		Entry.ActivationDistance = ActivationDistance;
+		Entry.HysteresisDistance = HysteresisDistance;
+		bHashDirty = true;
+	}
+
+	SetEntryLocation(Handle, Location);
+}
+
+void FKawaiiFluidActivationGrid::SetEntryLocation(int32 Handle, const FVector& Location)
+{
+	if (!IsValidHandle(Handle))
+	{
+		return;
+	}
+
+	FKawaiiFluidActivationEntry& Entry = Entries[Handle];
+	if (!Entry.Location.Equals(Location, KINDA_SMALL_NUMBER))
+	{
+		Entry.Location = Location;
+		bHashDirty = true;
+	}
+}
+
+void FKawaiiFluidActivationGrid::SetEntryActive(int32 Handle, bool bActive)
+{
+	if (IsValidHandle(Handle))
+	{
+		Entries[Handle].bActive = bActive;
+	}
+}
+
+void FKawaiiFluidActivationGrid::Reset()
+{
+	Entries.Reset();
+	FreeHandles.Reset();
+	HashToHandle.Reset();
+	NumInUse = 0;
+	MaxReach = 0.0f;
+	bHashDirty = true;
+}
+
+void FKawaiiFluidActivationGrid::RebuildIfDirty() const
+{
+	if (!bHashDirty)
+	{
+		return;
+	}
+	bHashDirty = false;
+
+	TArray<FVector> Positions;
+	Positions.Reserve(NumInUse);
+	HashToHandle.Reset(NumInUse);
+	MaxReach = 0.0f;
+
+	for (int32 Handle = 0; Handle < Entries.Num(); ++Handle)
+	{
+		const FKawaiiFluidActivationEntry& Entry = Entries[Handle];
+		if (Entry.bInUse)
+		{
+			Positions.Add(Entry.Location);
+			HashToHandle.Add(Handle);
+			MaxReach = FMath::Max(MaxReach, Entry.ActivationDistance + Entry.HysteresisDistance);
+		}
+	}
+
+	// One cell per max reach: each reference point touches at most 3x3x3 cells
+	SpatialHash.SetCellSize(FMath::Max(MaxReach, MinCellSize));
+	SpatialHash.BuildFromPositions(Positions);
+}
+
+void FKawaiiFluidActivationGrid::Update(TConstArrayView<FVector> ReferencePoints, TArray<int32>& OutChangedHandles)
+{
+	OutChangedHandles.Reset();
+
+	if (NumInUse == 0)
+	{
+		return;
+	}
+
+	RebuildIfDirty();
+
+	InRangeScratch.Init(false, Entries.Num());
+
+	for (const FVector& Reference : ReferencePoints)
+	{
+		// Coarse query at max reach, then per-entry reach (with hysteresis) test
+		SpatialHash.GetNeighbors(Reference, MaxReach, CandidateScratch);
+
+		for (const int32 HashIndex : CandidateScratch)
+		{
+			const int32 Handle = HashToHandle[HashIndex];
+			if (InRangeScratch[Handle])
+			{
+				continue;
+			}
+
+			const FKawaiiFluidActivationEntry& Entry = Entries[Handle];
+			const float Reach = Entry.GetReach();
+			if (FVector::DistSquared(Reference, Entry.Location) <= Reach * Reach)
+			{
+				InRangeScratch[Handle] = true;
+			}
+		}
+	}
+
+	for (int32 Handle = 0; Handle < Entries.Num(); ++Handle)
+	{
+		FKawaiiFluidActivationEntry& Entry = Entries[Handle];
+		if (!Entry.bInUse)
+		{
+			continue;
+		}
+
+		const bool bShouldBeActive = InRangeScratch[Handle];
+		if (bShouldBeActive != Entry.bActive)
+		{
+			Entry.bActive = bShouldBeActive;
+			OutChangedHandles.Add(Handle);
+		}
+	}
+}
+
+bool FKawaiiFluidActivationGrid::IsWithinActivationRange(const FVector& Location, float ActivationDistance, TConstArrayView<FVector> ReferencePoints)
+{
+	const float DistanceSq = ActivationDistance * ActivationDistance;
+	for (const FVector& Reference : ReferencePoints)
+	{
+		if (FVector::DistSquared(Reference, Location) <= DistanceSq)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+int32 FKawaiiFluidActivationGrid::FindNearest(const FVector& Location) const
+{
+	if (NumInUse == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	RebuildIfDirty();
+
+	const float CellSize = SpatialHash.GetCellSize();
+	TArray<int32> Candidates;
+
+	// Everything inside the search radius is found, so the closest candidate is the global nearest
+	for (int32 Ring = 1; Ring <= MaxNearestSearchRings; ++Ring)
+	{
+		SpatialHash.GetNeighbors(Location, CellSize * Ring, Candidates);
+		if (Candidates.Num() == 0)
+		{
+			continue;
+		}
+
+		int32 NearestHandle = INDEX_NONE;
+		double NearestDistSq = TNumericLimits<double>::Max();
+		for (const int32 HashIndex : Candidates)
+		{
+			const int32 Handle = HashToHandle[HashIndex];
+			const double DistSq = FVector::DistSquared(Location, Entries[Handle].Location);
+			if (DistSq < NearestDistSq)
+			{
+				NearestDistSq = DistSq;
+				NearestHandle = Handle;
+			}
+		}
+		return NearestHandle;
+	}
+
+	// Far from every entry: linear scan
+	int32 NearestHandle = INDEX_NONE;
+	double NearestDistSq = TNumericLimits<double>::Max();
+	for (int32 Handle = 0; Handle < Entries.Num(); ++Handle)
+	{
+		const FKawaiiFluidActivationEntry& Entry = Entries[Handle];
+		if (!Entry.bInUse)
+		{
+			continue;
+		}
+
+		const double DistSq = FVector::DistSquared(Location, Entry.Location);
+		if (DistSq < NearestDistSq)
+		{
+			NearestDistSq = DistSq;
+			NearestHandle = Handle;
+		}
+	}
+	return NearestHandle;
+}
@@ -0,0 +1,367 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Core/KawaiiFluidAnisotropyBatch.h"
+#include "Math/UnrealMathSSE.h"
+#include "Async/ParallelFor.h"
+#include "Algo/Sort.h"
+
+namespace
+{
+	constexpr int32 SimdWidth = 4;
+
+	/** 21 bits per cell coordinate (X lowest, so X-adjacent cells have consecutive keys) */
+	constexpr int32 CellBits = 21;
+	constexpr int32 CellOffset = 1 << (CellBits - 1);
+
+	/** Padding position: squared distance stays finite (1e36) and always out of range */
+	constexpr float FarAway = 1.0e18f;
+
+	uint64 MakeCellKey(const FIntVector& Cell)
+	{
+		return (static_cast<uint64>(Cell.Z + CellOffset) << (2 * CellBits))
+			| (static_cast<uint64>(Cell.Y + CellOffset) << CellBits)
+			| static_cast<uint64>(Cell.X + CellOffset);
+	}
+
+	FIntVector KeyToCell(uint64 Key)
+	{
+		constexpr uint64 Mask = (1ull << CellBits) - 1;
+		return FIntVector(
+			static_cast<int32>(Key & Mask) - CellOffset,
+			static_cast<int32>((Key >> CellBits) & Mask) - CellOffset,
+			static_cast<int32>(Key >> (2 * CellBits)) - CellOffset);
+	}
+
+	int32 ToCellCoord(float Value, float InvCellSize)
+	{
+		// Non-finite positions land in a clamped (usually empty) border cell
+		const float Scaled = FMath::Clamp(Value * InvCellSize, static_cast<float>(2 - CellOffset), static_cast<float>(CellOffset - 2));
+		return FMath::IsFinite(Scaled) ? FMath::FloorToInt(Scaled) : CellOffset - 2;
+	}
+
+	// Named apart from DensityConstraint.cpp's global VectorInvSqrtSafe (ambiguous in unity builds)
+	FORCEINLINE VectorRegister4Float VectorInvSqrtClamped(VectorRegister4Float V)
+	{
+		return VectorReciprocalSqrt(VectorMax(V, VectorSetFloat1(KINDA_SMALL_NUMBER)));
+	}
+
+	FORCEINLINE float HorizontalSum(VectorRegister4Float V)
+	{
+		alignas(16) float Temp[4];
+		VectorStoreAligned(V, Temp);
+		return Temp[0] + Temp[1] + Temp[2] + Temp[3];
+	}
+
+	/** Neighbors cached for the covariance pass (offsets from the particle, padded to a SIMD load) */
+	struct FNeighborCache
+	{
+		static constexpr int32 Capacity = FKawaiiFluidAnisotropyScheduler::MaxCachedNeighbors;
+
+		alignas(16) float X[Capacity + SimdWidth];
+		alignas(16) float Y[Capacity + SimdWidth];
+		alignas(16) float Z[Capacity + SimdWidth];
+		alignas(16) float W[Capacity + SimdWidth];
+		int32 Count = 0;
+	};
+}
+
+//=============================================================================
+// Grid
+//=============================================================================
+
+void FKawaiiFluidAnisotropyBatch::BuildGrid(TConstArrayView<FVector3f> Positions, float CellSize)
+{
+	const int32 NumParticles = Positions.Num();
+	const float InvCellSize = 1.0f / CellSize;
+
+	ParticleKeys.SetNumUninitialized(NumParticles);
+	SortOrder.SetNumUninitialized(NumParticles);
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		const FVector3f& P = Positions[i];
+		ParticleKeys[i] = MakeCellKey(FIntVector(
+			ToCellCoord(P.X, InvCellSize),
+			ToCellCoord(P.Y, InvCellSize),
+			ToCellCoord(P.Z, InvCellSize)));
+		SortOrder[i] = i;
+	}
+
+	// Index tie-break keeps the order (and the cached neighbor subset) deterministic
+	Algo::Sort(SortOrder, [this](int32 A, int32 B)
+	{
+		return ParticleKeys[A] < ParticleKeys[B] || (ParticleKeys[A] == ParticleKeys[B] && A < B);
+	});
+
+	const int32 PaddedCount = NumParticles + SimdWidth - 1;
+	SortedX.SetNumUninitialized(PaddedCount);
+	SortedY.SetNumUninitialized(PaddedCount);
+	SortedZ.SetNumUninitialized(PaddedCount);
+	SortedToParticle.SetNumUninitialized(NumParticles);
+
+	CellKeys.Reset();
+	CellStart.Reset();
+	CellLookup.Reset();
+
+	for (int32 s = 0; s < NumParticles; ++s)
+	{
+		const int32 Particle = SortOrder[s];
+		SortedX[s] = Positions[Particle].X;
+		SortedY[s] = Positions[Particle].Y;
+		SortedZ[s] = Positions[Particle].Z;
+		SortedToParticle[s] = Particle;
+
+		const uint64 Key = ParticleKeys[Particle];
+		if (CellKeys.Num() == 0 || CellKeys.Last() != Key)
+		{
+			CellLookup.Add(Key, CellKeys.Num());
+			CellKeys.Add(Key);
+			CellStart.Add(s);
+		}
+	}
+	CellStart.Add(NumParticles);
+
+	for (int32 s = NumParticles; s < PaddedCount; ++s)
+	{
+		SortedX[s] = FarAway;
+		SortedY[s] = FarAway;
+		SortedZ[s] = FarAway;
+	}
+}
+
+bool FKawaiiFluidAnisotropyBatch::FindRowRange(const FIntVector& Cell, int32 DY, int32 DZ, int32& OutBegin, int32& OutEnd) const
+{
+	// Occupied cells among X-1..X+1 are consecutive in key order
+	int32 FirstCell = INDEX_NONE;
+	int32 LastCell = INDEX_NONE;
+	for (int32 DX = -1; DX <= 1; ++DX)
+	{
+		if (const int32* CellIndex = CellLookup.Find(MakeCellKey(Cell + FIntVector(DX, DY, DZ))))
+		{
+			if (FirstCell == INDEX_NONE)
+			{
+				FirstCell = *CellIndex;
+			}
+			LastCell = *CellIndex;
+		}
+	}
+
+	if (FirstCell == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutBegin = CellStart[FirstCell];
+	OutEnd = CellStart[LastCell + 1];
+	return true;
+}
+
+//=============================================================================
+// Batch Compute
+//=============================================================================
+
+void FKawaiiFluidAnisotropyBatch::Compute(
+	TConstArrayView<FVector3f> Positions,
+	const FKawaiiFluidAnisotropySettings& Settings,
+	TArray<FKawaiiFluidEllipsoid>& OutEllipsoids,
+	TArray<uint32>* OutNeighborCounts)
+{
+	const int32 NumParticles = Positions.Num();
+	OutEllipsoids.SetNum(NumParticles);
+	if (OutNeighborCounts)
+	{
+		OutNeighborCounts->SetNumZeroed(NumParticles);
+	}
+	if (NumParticles == 0 || Settings.SmoothingRadius <= 0.0f)
+	{
+		return;
+	}
+
+	const float H = Settings.SmoothingRadius;
+	BuildGrid(Positions, H);
+
+	const float* RESTRICT XPtr = SortedX.GetData();
+	const float* RESTRICT YPtr = SortedY.GetData();
+	const float* RESTRICT ZPtr = SortedZ.GetData();
+
+	// SIMD constants
+	const VectorRegister4Float VecH2 = VectorSetFloat1(H * H);
+	const VectorRegister4Float VecInvH = VectorSetFloat1(1.0f / H);
+	const VectorRegister4Float VecOne = VectorOneFloat();
+	const VectorRegister4Float VecTwo = VectorSetFloat1(2.0f);
+	const VectorRegister4Float VecSix = VectorSetFloat1(6.0f);
+	const VectorRegister4Float VecHalf = VectorSetFloat1(0.5f);
+	const VectorRegister4Float VecMinWeight = VectorSetFloat1(0.0001f);
+	const VectorRegister4Float VecZero = VectorZeroFloat();
+	const VectorRegister4Float VecLaneOffsets = MakeVectorRegisterFloat(0.0f, 1.0f, 2.0f, 3.0f);
+
+	ParallelFor(CellKeys.Num(), [&](int32 CellIndex)
+	{
+		const FIntVector Cell = KeyToCell(CellKeys[CellIndex]);
+
+		// 9 contiguous candidate ranges shared by every particle of the cell
+		int32 RangeBegin[9];
+		int32 RangeEnd[9];
+		int32 NumRanges = 0;
+		for (int32 DZ = -1; DZ <= 1; ++DZ)
+		{
+			for (int32 DY = -1; DY <= 1; ++DY)
+			{
+				if (FindRowRange(Cell, DY, DZ, RangeBegin[NumRanges], RangeEnd[NumRanges]))
+				{
+					++NumRanges;
+				}
+			}
+		}
+
+		FNeighborCache Cache;
+
+		for (int32 s = CellStart[CellIndex]; s < CellStart[CellIndex + 1]; ++s)
+		{
+			const VectorRegister4Float VecPX = VectorSetFloat1(XPtr[s]);
+			const VectorRegister4Float VecPY = VectorSetFloat1(YPtr[s]);
+			const VectorRegister4Float VecPZ = VectorSetFloat1(ZPtr[s]);
+
+			VectorRegister4Float VecSumW = VecZero;
+			VectorRegister4Float VecSumWX = VecZero;
+			VectorRegister4Float VecSumWY = VecZero;
+			VectorRegister4Float VecSumWZ = VecZero;
+			VectorRegister4Float VecCount = VecZero;
+			Cache.Count = 0;
+
+			// Pass 1: kernel weights, weighted center, first neighbors cached
+			for (int32 r = 0; r < NumRanges; ++r)
+			{
+				const int32 Begin = RangeBegin[r];
+				const VectorRegister4Float VecRangeCount = VectorSetFloat1(static_cast<float>(RangeEnd[r] - Begin));
+
+				for (int32 j = Begin; j < RangeEnd[r]; j += SimdWidth)
+				{
+					VectorRegister4Float VecDX = VectorSubtract(VectorLoad(&XPtr[j]), VecPX);
+					VectorRegister4Float VecDY = VectorSubtract(VectorLoad(&YPtr[j]), VecPY);
+					VectorRegister4Float VecDZ = VectorSubtract(VectorLoad(&ZPtr[j]), VecPZ);
+
+					VectorRegister4Float VecDist2 = VectorMultiply(VecDX, VecDX);
+					VecDist2 = VectorMultiplyAdd(VecDY, VecDY, VecDist2);
+					VecDist2 = VectorMultiplyAdd(VecDZ, VecDZ, VecDist2);
+
+					// Cubic spline (KernelWeight): 1 - 6q² + 6q³ below q = 0.5, 2(1-q)³ above
+					const VectorRegister4Float VecQ = VectorMultiply(VectorMultiply(VecDist2, VectorInvSqrtClamped(VecDist2)), VecInvH);
+					const VectorRegister4Float VecQ2 = VectorMultiply(VecQ, VecQ);
+					const VectorRegister4Float VecInner = VectorMultiplyAdd(VectorMultiply(VecSix, VecQ2), VectorSubtract(VecQ, VecOne), VecOne);
+					const VectorRegister4Float VecOneMinusQ = VectorSubtract(VecOne, VecQ);
+					const VectorRegister4Float VecOuter = VectorMultiply(VecTwo, VectorMultiply(VecOneMinusQ, VectorMultiply(VecOneMinusQ, VecOneMinusQ)));
+					VectorRegister4Float VecW = VectorSelect(VectorCompareLT(VecQ, VecHalf), VecInner, VecOuter);
+
+					// In range, above the weight floor, and inside this range (not the next cell or padding)
+					const VectorRegister4Float VecLane = VectorAdd(VectorSetFloat1(static_cast<float>(j - Begin)), VecLaneOffsets);
+					const VectorRegister4Float VecMask = VectorBitwiseAnd(
+						VectorBitwiseAnd(VectorCompareLT(VecDist2, VecH2), VectorCompareGT(VecW, VecMinWeight)),
+						VectorCompareLT(VecLane, VecRangeCount));
+					// Offsets too: a masked lane may hold a non-finite particle, and 0 * inf is NaN
+					VecW = VectorSelect(VecMask, VecW, VecZero);
+					VecDX = VectorSelect(VecMask, VecDX, VecZero);
+					VecDY = VectorSelect(VecMask, VecDY, VecZero);
+					VecDZ = VectorSelect(VecMask, VecDZ, VecZero);
+
+					VecSumW = VectorAdd(VecSumW, VecW);
+					VecSumWX = VectorMultiplyAdd(VecW, VecDX, VecSumWX);
+					VecSumWY = VectorMultiplyAdd(VecW, VecDY, VecSumWY);
+					VecSumWZ = VectorMultiplyAdd(VecW, VecDZ, VecSumWZ);
+					VecCount = VectorAdd(VecCount, VectorSelect(VecMask, VecOne, VecZero));
+
+					const int32 LaneBits = VectorMaskBits(VecMask);
+					if (LaneBits != 0 && Cache.Count < FNeighborCache::Capacity)
+					{
+						alignas(16) float LaneDX[4], LaneDY[4], LaneDZ[4], LaneW[4];
+						VectorStoreAligned(VecDX, LaneDX);
+						VectorStoreAligned(VecDY, LaneDY);
+						VectorStoreAligned(VecDZ, LaneDZ);
+						VectorStoreAligned(VecW, LaneW);
+
+						for (int32 Lane = 0; Lane < SimdWidth && Cache.Count < FNeighborCache::Capacity; ++Lane)
+						{
+							if (LaneBits & (1 << Lane))
+							{
+								Cache.X[Cache.Count] = LaneDX[Lane];
+								Cache.Y[Cache.Count] = LaneDY[Lane];
+								Cache.Z[Cache.Count] = LaneDZ[Lane];
+								Cache.W[Cache.Count] = LaneW[Lane];
+								++Cache.Count;
+							}
+						}
+					}
+				}
+			}
+
+			const int32 Particle = SortedToParticle[s];
+			const int32 NeighborCount = FMath::RoundToInt(HorizontalSum(VecCount));
+			const float SumW = HorizontalSum(VecSumW);
+			if (OutNeighborCounts)
+			{
+				(*OutNeighborCounts)[Particle] = static_cast<uint32>(NeighborCount);
+			}
+
+			if (NeighborCount < FKawaiiFluidAnisotropyScheduler::MinNeighbors || SumW < 0.0001f)
+			{
+				OutEllipsoids[Particle] = FKawaiiFluidEllipsoid();
+				continue;
+			}
+
+			// Pass 2: covariance of the cached neighbors around the weighted center
+			const float InvSumW = 1.0f / SumW;
+			const VectorRegister4Float VecCX = VectorSetFloat1(HorizontalSum(VecSumWX) * InvSumW);
+			const VectorRegister4Float VecCY = VectorSetFloat1(HorizontalSum(VecSumWY) * InvSumW);
+			const VectorRegister4Float VecCZ = VectorSetFloat1(HorizontalSum(VecSumWZ) * InvSumW);
+
+			for (int32 Pad = Cache.Count; Pad < Align(Cache.Count, SimdWidth); ++Pad)
+			{
+				Cache.X[Pad] = 0.0f;
+				Cache.Y[Pad] = 0.0f;
+				Cache.Z[Pad] = 0.0f;
+				Cache.W[Pad] = 0.0f;
+			}
+
+			VectorRegister4Float VecTotalW = VecZero;
+			VectorRegister4Float VecXX = VecZero, VecXY = VecZero, VecXZ = VecZero;
+			VectorRegister4Float VecYY = VecZero, VecYZ = VecZero, VecZZ = VecZero;
+
+			for (int32 k = 0; k < Cache.Count; k += SimdWidth)
+			{
+				const VectorRegister4Float VecW = VectorLoadAligned(&Cache.W[k]);
+				const VectorRegister4Float VecOX = VectorSubtract(VectorLoadAligned(&Cache.X[k]), VecCX);
+				const VectorRegister4Float VecOY = VectorSubtract(VectorLoadAligned(&Cache.Y[k]), VecCY);
+				const VectorRegister4Float VecOZ = VectorSubtract(VectorLoadAligned(&Cache.Z[k]), VecCZ);
+				const VectorRegister4Float VecWX = VectorMultiply(VecW, VecOX);
+				const VectorRegister4Float VecWY = VectorMultiply(VecW, VecOY);
+
+				VecTotalW = VectorAdd(VecTotalW, VecW);
+				VecXX = VectorMultiplyAdd(VecWX, VecOX, VecXX);
+				VecXY = VectorMultiplyAdd(VecWX, VecOY, VecXY);
+				VecXZ = VectorMultiplyAdd(VecWX, VecOZ, VecXZ);
+				VecYY = VectorMultiplyAdd(VecWY, VecOY, VecYY);
+				VecYZ = VectorMultiplyAdd(VecWY, VecOZ, VecYZ);
+				VecZZ = VectorMultiplyAdd(VectorMultiply(VecW, VecOZ), VecOZ, VecZZ);
+			}
+
+			const float InvTotalW = 1.0f / HorizontalSum(VecTotalW);
+			FKawaiiFluidCovariance Covariance;
+			Covariance.XX = HorizontalSum(VecXX) * InvTotalW;
+			Covariance.XY = HorizontalSum(VecXY) * InvTotalW;
+			Covariance.XZ = HorizontalSum(VecXZ) * InvTotalW;
+			Covariance.YY = HorizontalSum(VecYY) * InvTotalW;
+			Covariance.YZ = HorizontalSum(VecYZ) * InvTotalW;
+			Covariance.ZZ = HorizontalSum(VecZZ) * InvTotalW;
+
+			OutEllipsoids[Particle] = FKawaiiFluidAnisotropyScheduler::ComputeEllipsoid(Covariance, NeighborCount, Settings);
+		}
+	});
+}
+
+FTransform FKawaiiFluidAnisotropyBatch::MakeInstanceTransform(const FVector3f& Position, const FKawaiiFluidEllipsoid& Ellipsoid, float BaseScale)
+{
+	// MakeFromXY re-orthonormalizes and derives Z = X x Y, so a left-handed eigenbasis
+	// (the sorted-diagonal case) still gives a proper rotation; Z's sign does not matter for an ellipsoid
+	const FQuat Rotation = FRotationMatrix::MakeFromXY(FVector(FVector3f(Ellipsoid.Axes[0])), FVector(FVector3f(Ellipsoid.Axes[1]))).ToQuat();
+	const FVector Scale(Ellipsoid.Axes[0].W, Ellipsoid.Axes[1].W, Ellipsoid.Axes[2].W);
+	return FTransform(Rotation, FVector(Position), Scale * BaseScale);
+}
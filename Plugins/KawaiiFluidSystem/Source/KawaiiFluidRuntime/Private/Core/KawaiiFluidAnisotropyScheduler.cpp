@@ -0,0 +1,546 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Core/KawaiiFluidAnisotropyScheduler.h"
+#include "Core/FluidAnisotropy.h"
+#include "Core/SpatialHash.h"
+
+namespace
+{
+	/** Same as BuildOrthonormalBasis in FluidAnisotropyCompute.usf */
+	void BuildOrthonormalBasis(const FVector3f& N, FVector3f& OutT, FVector3f& OutB)
+	{
+		if (N.Z < -0.9999999f)
+		{
+			OutT = FVector3f(0.0f, -1.0f, 0.0f);
+			OutB = FVector3f(-1.0f, 0.0f, 0.0f);
+			return;
+		}
+
+		const float A = 1.0f / (1.0f + N.Z);
+		const float D = -N.X * N.Y * A;
+		OutT = FVector3f(1.0f - N.X * N.X * A, D, -N.X);
+		OutB = FVector3f(D, 1.0f - N.Y * N.Y * A, -N.Y);
+	}
+
+	/** Null space of (A - Lambda I) from the longest cross product of two rows */
+	FVector3f ComputeEigenvector(const FKawaiiFluidCovariance& M, float Lambda)
+	{
+		const FVector3f Row0(M.XX - Lambda, M.XY, M.XZ);
+		const FVector3f Row1(M.XY, M.YY - Lambda, M.YZ);
+		const FVector3f Row2(M.XZ, M.YZ, M.ZZ - Lambda);
+
+		const FVector3f Cross01 = FVector3f::CrossProduct(Row0, Row1);
+		const FVector3f Cross12 = FVector3f::CrossProduct(Row1, Row2);
+		const FVector3f Cross02 = FVector3f::CrossProduct(Row0, Row2);
+
+		const float Len01 = Cross01.SizeSquared();
+		const float Len12 = Cross12.SizeSquared();
+		const float Len02 = Cross02.SizeSquared();
+
+		FVector3f Vector;
+		if (Len01 >= Len12 && Len01 >= Len02)
+		{
+			Vector = Cross01;
+		}
+		else if (Len12 >= Len01 && Len12 >= Len02)
+		{
+			Vector = Cross12;
+		}
+		else
+		{
+			Vector = Cross02;
+		}
+
+		const float Len = Vector.Size();
+		return Len > 1e-10f ? Vector / Len : FVector3f(1.0f, 0.0f, 0.0f);
+	}
+
+	FIntVector GetCell(const FVector3f& Position, float CellSize)
+	{
+		return FIntVector(
+			FMath::FloorToInt(Position.X / CellSize),
+			FMath::FloorToInt(Position.Y / CellSize),
+			FMath::FloorToInt(Position.Z / CellSize));
+	}
+
+	bool IsBlockMarked(const TSet<FIntVector>& MarkedCells, const FIntVector& Cell)
+	{
+		for (int32 dz = -1; dz <= 1; ++dz)
+		{
+			for (int32 dy = -1; dy <= 1; ++dy)
+			{
+				for (int32 dx = -1; dx <= 1; ++dx)
+				{
+					if (MarkedCells.Contains(Cell + FIntVector(dx, dy, dz)))
+					{
+						return true;
+					}
+				}
+			}
+		}
+		return false;
+	}
+
+	void GatherCandidates(const FSpatialHash& Hash, const TArray<FVector>& Positions, int32 Index, float Radius, TArray<int32>& Scratch, TArray<FVector3f>& OutCandidates)
+	{
+		Hash.GetNeighbors(Positions[Index], Radius, Scratch);
+		OutCandidates.Reset(Scratch.Num());
+		for (const int32 Neighbor : Scratch)
+		{
+			OutCandidates.Add(FVector3f(Positions[Neighbor]));
+		}
+	}
+}
+
+FKawaiiFluidAnisotropySettings FKawaiiFluidAnisotropySettings::FromParams(const FFluidAnisotropyParams& Params, float SmoothingRadius)
+{
+	FKawaiiFluidAnisotropySettings Settings;
+	Settings.SmoothingRadius = SmoothingRadius;
+	Settings.Strength = Params.Strength;
+	Settings.MinStretch = Params.MinStretch;
+	Settings.MaxStretch = Params.MaxStretch;
+	Settings.bPreserveVolume = Params.bPreserveVolume;
+	Settings.NonPreservedRenderScale = Params.NonPreservedRenderScale;
+	return Settings;
+}
+
+FKawaiiFluidAnisotropySchedule FKawaiiFluidAnisotropySchedule::FromParams(const FFluidAnisotropyParams& Params)
+{
+	FKawaiiFluidAnisotropySchedule Schedule;
+	Schedule.MotionThreshold = Params.IncrementalMotionThreshold;
+	Schedule.NeighborThreshold = FMath::Max(1, Params.IncrementalNeighborThreshold);
+	Schedule.MaxStaleFrames = FMath::Max(1, Params.IncrementalMaxStaleFrames);
+	return Schedule;
+}
+
+//=============================================================================
+// Anisotropy Math
+//=============================================================================
+
+float FKawaiiFluidAnisotropyScheduler::KernelWeight(float Distance, float H)
+{
+	if (Distance >= H)
+	{
+		return 0.0f;
+	}
+
+	const float Q = Distance / H;
+	if (Q < 0.5f)
+	{
+		return 1.0f - 6.0f * Q * Q + 6.0f * Q * Q * Q;
+	}
+
+	const float OneMinusQ = 1.0f - Q;
+	return 2.0f * OneMinusQ * OneMinusQ * OneMinusQ;
+}
+
+void FKawaiiFluidAnisotropyScheduler::SymmetricEigen(const FKawaiiFluidCovariance& M, FVector3f& OutValues, FVector3f OutVectors[3])
+{
+	const float OffDiagSq = M.XY * M.XY + M.XZ * M.XZ + M.YZ * M.YZ;
+
+	// Already diagonal: sort the diagonal descending
+	if (OffDiagSq < 1e-12f)
+	{
+		const float Diagonal[3] = { M.XX, M.YY, M.ZZ };
+		int32 Order[3] = { 0, 1, 2 };
+		if (Diagonal[Order[1]] > Diagonal[Order[0]]) { Swap(Order[0], Order[1]); }
+		if (Diagonal[Order[2]] > Diagonal[Order[0]]) { Swap(Order[0], Order[2]); }
+		if (Diagonal[Order[2]] > Diagonal[Order[1]]) { Swap(Order[1], Order[2]); }
+
+		for (int32 i = 0; i < 3; ++i)
+		{
+			OutValues[i] = Diagonal[Order[i]];
+			OutVectors[i] = FVector3f::ZeroVector;
+			OutVectors[i][Order[i]] = 1.0f;
+		}
+		return;
+	}
+
+	// Cardano on the traceless shift B = A - qI
+	const float Q = (M.XX + M.YY + M.ZZ) / 3.0f;
+	const float B00 = M.XX - Q;
+	const float B11 = M.YY - Q;
+	const float B22 = M.ZZ - Q;
+	const float P2 = (B00 * B00 + B11 * B11 + B22 * B22 + 2.0f * OffDiagSq) / 6.0f;
+
+	if (P2 < 1e-12f)
+	{
+		OutValues = FVector3f(Q);
+		OutVectors[0] = FVector3f(1.0f, 0.0f, 0.0f);
+		OutVectors[1] = FVector3f(0.0f, 1.0f, 0.0f);
+		OutVectors[2] = FVector3f(0.0f, 0.0f, 1.0f);
+		return;
+	}
+
+	const float P = FMath::Sqrt(P2);
+	const float DetB = B00 * (B11 * B22 - M.YZ * M.YZ)
+		- M.XY * (M.XY * B22 - M.YZ * M.XZ)
+		+ M.XZ * (M.XY * M.YZ - B11 * M.XZ);
+	const float R = FMath::Clamp(DetB / (2.0f * P * P * P), -1.0f, 1.0f);
+	const float Phi = FMath::Acos(R) / 3.0f;
+
+	constexpr float TwoPiOver3 = 2.0943951f;
+	const float Lambda0 = Q + 2.0f * P * FMath::Cos(Phi);
+	const float Lambda2 = Q + 2.0f * P * FMath::Cos(Phi + TwoPiOver3);
+	const float Lambda1 = FMath::Clamp(3.0f * Q - Lambda0 - Lambda2, Lambda2, Lambda0);
+	OutValues = FVector3f(Lambda0, Lambda1, Lambda2);
+
+	// Cross products only resolve a simple eigenvalue (sheets have Lambda0 ~ Lambda1), so take
+	// the one farthest from the other two and solve the remaining pair as a 2x2 problem (Eberly 2014)
+	const bool bTopIsolated = (Lambda0 - Lambda1) >= (Lambda1 - Lambda2);
+	const FVector3f IsolatedVector = ComputeEigenvector(M, bTopIsolated ? Lambda0 : Lambda2);
+
+	FVector3f U, V;
+	BuildOrthonormalBasis(IsolatedVector, U, V);
+
+	const FVector3f MU(
+		M.XX * U.X + M.XY * U.Y + M.XZ * U.Z,
+		M.XY * U.X + M.YY * U.Y + M.YZ * U.Z,
+		M.XZ * U.X + M.YZ * U.Y + M.ZZ * U.Z);
+	const FVector3f MV(
+		M.XX * V.X + M.XY * V.Y + M.XZ * V.Z,
+		M.XY * V.X + M.YY * V.Y + M.YZ * V.Z,
+		M.XZ * V.X + M.YZ * V.Y + M.ZZ * V.Z);
+	const float A = FVector3f::DotProduct(U, MU);
+	const float B = FVector3f::DotProduct(U, MV);
+	const float C = FVector3f::DotProduct(V, MV);
+
+	// Larger eigenvalue of [[A, B], [B, C]]
+	const float Theta = 0.5f * FMath::Atan2(2.0f * B, A - C);
+	const FVector3f PlaneVector = (FMath::Cos(Theta) * U + FMath::Sin(Theta) * V).GetSafeNormal();
+
+	if (bTopIsolated)
+	{
+		OutVectors[0] = IsolatedVector;
+		OutVectors[1] = PlaneVector;
+		OutVectors[2] = FVector3f::CrossProduct(OutVectors[0], OutVectors[1]);
+	}
+	else
+	{
+		OutVectors[2] = IsolatedVector;
+		OutVectors[0] = PlaneVector;
+		OutVectors[1] = FVector3f::CrossProduct(OutVectors[2], OutVectors[0]);
+	}
+}
+
+int32 FKawaiiFluidAnisotropyScheduler::ComputeCovariance(const FVector3f& Center, TConstArrayView<FVector3f> Candidates, float H, FKawaiiFluidCovariance& OutCovariance)
+{
+	OutCovariance = FKawaiiFluidCovariance();
+
+	// Pass 1: kernel-weighted center, first MaxCachedNeighbors neighbors cached
+	FVector3f CachedPositions[MaxCachedNeighbors];
+	float CachedWeights[MaxCachedNeighbors];
+	int32 CachedCount = 0;
+
+	const float H2 = H * H;
+	FVector3f SumWP = FVector3f::ZeroVector;
+	float SumW = 0.0f;
+	int32 NeighborCount = 0;
+
+	for (const FVector3f& Neighbor : Candidates)
+	{
+		const float Dist2 = FVector3f::DistSquared(Neighbor, Center);
+		if (Dist2 >= H2)
+		{
+			continue;
+		}
+
+		const float W = KernelWeight(FMath::Sqrt(Dist2), H);
+		if (W <= 0.0001f)
+		{
+			continue;
+		}
+
+		SumWP += W * Neighbor;
+		SumW += W;
+		++NeighborCount;
+
+		if (CachedCount < MaxCachedNeighbors)
+		{
+			CachedPositions[CachedCount] = Neighbor;
+			CachedWeights[CachedCount] = W;
+			++CachedCount;
+		}
+	}
+
+	if (NeighborCount < MinNeighbors || SumW < 0.0001f)
+	{
+		return NeighborCount;
+	}
+
+	// Pass 2: covariance around the smoothed center
+	const FVector3f SmoothedCenter = SumWP / SumW;
+	FKawaiiFluidCovariance Sum;
+	float TotalWeight = 0.0f;
+
+	for (int32 i = 0; i < CachedCount; ++i)
+	{
+		const FVector3f Offset = CachedPositions[i] - SmoothedCenter;
+		const float W = CachedWeights[i];
+
+		TotalWeight += W;
+		Sum.XX += W * Offset.X * Offset.X;
+		Sum.XY += W * Offset.X * Offset.Y;
+		Sum.XZ += W * Offset.X * Offset.Z;
+		Sum.YY += W * Offset.Y * Offset.Y;
+		Sum.YZ += W * Offset.Y * Offset.Z;
+		Sum.ZZ += W * Offset.Z * Offset.Z;
+	}
+
+	const float InvW = 1.0f / TotalWeight;
+	OutCovariance.XX = Sum.XX * InvW;
+	OutCovariance.XY = Sum.XY * InvW;
+	OutCovariance.XZ = Sum.XZ * InvW;
+	OutCovariance.YY = Sum.YY * InvW;
+	OutCovariance.YZ = Sum.YZ * InvW;
+	OutCovariance.ZZ = Sum.ZZ * InvW;
+	return NeighborCount;
+}
+
+FKawaiiFluidEllipsoid FKawaiiFluidAnisotropyScheduler::ComputeDensityBased(const FVector3f& Center, TConstArrayView<FVector3f> Candidates, const FKawaiiFluidAnisotropySettings& Settings)
+{
+	FKawaiiFluidCovariance Covariance;
+	const int32 NeighborCount = ComputeCovariance(Center, Candidates, Settings.SmoothingRadius, Covariance);
+	return ComputeEllipsoid(Covariance, NeighborCount, Settings);
+}
+
+FKawaiiFluidEllipsoid FKawaiiFluidAnisotropyScheduler::ComputeEllipsoid(const FKawaiiFluidCovariance& Covariance, int32 NeighborCount, const FKawaiiFluidAnisotropySettings& Settings)
+{
+	FKawaiiFluidEllipsoid Ellipsoid;
+	if (NeighborCount < MinNeighbors)
+	{
+		return Ellipsoid;
+	}
+
+	FVector3f EigenValues;
+	FVector3f EigenVectors[3];
+	SymmetricEigen(Covariance, EigenValues, EigenVectors);
+
+	float Sigma[3];
+	for (int32 i = 0; i < 3; ++i)
+	{
+		Sigma[i] = FMath::Sqrt(FMath::Max(EigenValues[i], 0.0001f));
+	}
+
+	// Yu & Turk ratio clamp (no needle-thin ellipsoids)
+	const float MinSigma = Sigma[0] / MaxSigmaRatio;
+	Sigma[1] = FMath::Max(Sigma[1], MinSigma);
+	Sigma[2] = FMath::Max(Sigma[2], MinSigma);
+
+	// Sparse neighborhoods (surface) get partial anisotropy
+	const float BlendFactor = FMath::Clamp(
+		static_cast<float>(NeighborCount - MinNeighbors) / static_cast<float>(FullNeighbors - MinNeighbors), 0.0f, 1.0f);
+
+	float Scale[3];
+	if (Settings.bPreserveVolume)
+	{
+		float GeoMean = FMath::Pow(Sigma[0] * Sigma[1] * Sigma[2], 1.0f / 3.0f);
+		if (GeoMean < 0.0001f)
+		{
+			GeoMean = 1.0f;
+		}
+
+		float LogScale[3];
+		for (int32 i = 0; i < 3; ++i)
+		{
+			LogScale[i] = FMath::Loge(FMath::Max(Sigma[i] / GeoMean, 0.001f)) * Settings.Strength;
+		}
+
+		const float LogAvg = (LogScale[0] + LogScale[1] + LogScale[2]) / 3.0f;
+		const float LogMin = FMath::Loge(FMath::Max(Settings.MinStretch, 0.001f));
+		const float LogMax = FMath::Loge(FMath::Max(Settings.MaxStretch, 0.001f));
+		for (int32 i = 0; i < 3; ++i)
+		{
+			Scale[i] = FMath::Exp(FMath::Clamp((LogScale[i] - LogAvg) * BlendFactor, LogMin, LogMax));
+		}
+	}
+	else
+	{
+		// FleX: h / sigma with the smallest sigma clamped relative to the largest
+		const float MaxSigma = FMath::Max3(Sigma[0], Sigma[1], Sigma[2]);
+		const float MinSigmaThreshold = MaxSigma * Settings.MinStretch;
+		for (int32 i = 0; i < 3; ++i)
+		{
+			float S = Settings.SmoothingRadius / FMath::Max(FMath::Max(Sigma[i], MinSigmaThreshold), 0.0001f);
+			S *= Settings.NonPreservedRenderScale;
+			S = FMath::Lerp(1.0f, S, Settings.Strength);
+			S = FMath::Lerp(1.0f, S, BlendFactor);
+			Scale[i] = FMath::Clamp(S, Settings.MinStretch, Settings.MaxStretch);
+		}
+	}
+
+	for (int32 i = 0; i < 3; ++i)
+	{
+		Ellipsoid.Axes[i] = FVector4f(EigenVectors[i].GetSafeNormal(), Scale[i]);
+	}
+	return Ellipsoid;
+}
+
+void FKawaiiFluidAnisotropyScheduler::ComputeAll(
+	TConstArrayView<FVector3f> Positions,
+	const FKawaiiFluidAnisotropySettings& Settings,
+	TArray<FKawaiiFluidEllipsoid>& OutEllipsoids,
+	TArray<uint32>* OutNeighborCounts)
+{
+	const int32 NumParticles = Positions.Num();
+	OutEllipsoids.SetNum(NumParticles);
+	if (OutNeighborCounts)
+	{
+		OutNeighborCounts->SetNumZeroed(NumParticles);
+	}
+
+	TArray<FVector> PositionsD;
+	PositionsD.Reserve(NumParticles);
+	for (const FVector3f& P : Positions)
+	{
+		PositionsD.Add(FVector(P));
+	}
+
+	FSpatialHash Hash(Settings.SmoothingRadius);
+	Hash.BuildFromPositions(PositionsD);
+
+	TArray<int32> Scratch;
+	TArray<FVector3f> Candidates;
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		GatherCandidates(Hash, PositionsD, i, Settings.SmoothingRadius, Scratch, Candidates);
+		OutEllipsoids[i] = ComputeDensityBased(Positions[i], Candidates, Settings);
+
+		if (OutNeighborCounts)
+		{
+			FKawaiiFluidCovariance Unused;
+			(*OutNeighborCounts)[i] = static_cast<uint32>(ComputeCovariance(Positions[i], Candidates, Settings.SmoothingRadius, Unused));
+		}
+	}
+}
+
+//=============================================================================
+// Incremental Schedule
+//=============================================================================
+
+bool FKawaiiFluidAnisotropyScheduler::HasHistory(const FGPUAnisotropyHistory& History, int32 ParticleID, int32 PrevCount)
+{
+	return History.ParticleID == ParticleID && ParticleID >= 0 && History.PrevIndex < static_cast<uint32>(PrevCount);
+}
+
+bool FKawaiiFluidAnisotropyScheduler::HasMoved(
+	const FGPUAnisotropyHistory& History,
+	bool bHasHistory,
+	const FVector3f& Position,
+	uint32 NeighborCount,
+	const FKawaiiFluidAnisotropySchedule& Schedule,
+	float SmoothingRadius)
+{
+	if (!bHasHistory)
+	{
+		return true;
+	}
+
+	const float MotionDistance = Schedule.MotionThreshold * SmoothingRadius;
+	if (FVector3f::DistSquared(Position, History.RefPosition) > MotionDistance * MotionDistance)
+	{
+		return true;
+	}
+
+	const int32 NeighborDelta = FMath::Abs(static_cast<int32>(NeighborCount) - static_cast<int32>(History.NeighborCount));
+	return NeighborDelta >= Schedule.NeighborThreshold;
+}
+
+bool FKawaiiFluidAnisotropyScheduler::IsExpired(const FGPUAnisotropyHistory& History, const FKawaiiFluidAnisotropySchedule& Schedule)
+{
+	return History.FramesSinceUpdate >= static_cast<uint32>(FMath::Max(1, Schedule.MaxStaleFrames));
+}
+
+FKawaiiFluidAnisotropyPassStats FKawaiiFluidAnisotropyScheduler::UpdateIncremental(
+	TConstArrayView<FVector3f> Positions,
+	TConstArrayView<int32> ParticleIDs,
+	TConstArrayView<uint32> NeighborCounts,
+	const FKawaiiFluidAnisotropySettings& Settings,
+	const FKawaiiFluidAnisotropySchedule& Schedule,
+	TArray<FGPUAnisotropyHistory>& InOutHistory,
+	TArray<FKawaiiFluidEllipsoid>& InOutEllipsoids)
+{
+	FKawaiiFluidAnisotropyPassStats Stats;
+
+	const int32 NumParticles = Positions.Num();
+	if (ParticleIDs.Num() != NumParticles || NeighborCounts.Num() != NumParticles)
+	{
+		return Stats;
+	}
+	Stats.NumParticles = NumParticles;
+
+	// Spawned particles get empty records (the GPU history buffer grows the same way)
+	InOutHistory.SetNum(NumParticles);
+
+	const TArray<FKawaiiFluidEllipsoid> PrevEllipsoids = MoveTemp(InOutEllipsoids);
+	const int32 PrevCount = PrevEllipsoids.Num();
+	InOutEllipsoids.SetNum(NumParticles);
+
+	// Pass 1 (MarkActivityCS): moved particles mark their current and last recompute cell
+	const float CellSize = Settings.SmoothingRadius;
+	TSet<FIntVector> MarkedCells;
+	TBitArray<> Moved(false, NumParticles);
+
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		const FGPUAnisotropyHistory& History = InOutHistory[i];
+		const bool bHasHistory = HasHistory(History, ParticleIDs[i], PrevCount);
+		if (!HasMoved(History, bHasHistory, Positions[i], NeighborCounts[i], Schedule, Settings.SmoothingRadius))
+		{
+			continue;
+		}
+
+		Moved[i] = true;
+		++Stats.NumMoved;
+		MarkedCells.Add(GetCell(Positions[i], CellSize));
+		if (bHasHistory)
+		{
+			MarkedCells.Add(GetCell(History.RefPosition, CellSize));
+		}
+	}
+
+	// Pass 2 (MainCS): recompute near activity, reuse elsewhere
+	TArray<FVector> PositionsD;
+	FSpatialHash Hash(Settings.SmoothingRadius);
+	TArray<int32> Scratch;
+	TArray<FVector3f> Candidates;
+
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		FGPUAnisotropyHistory& History = InOutHistory[i];
+		const bool bRecompute = Moved[i]
+			|| IsExpired(History, Schedule)
+			|| IsBlockMarked(MarkedCells, GetCell(Positions[i], CellSize));
+
+		if (!bRecompute)
+		{
+			InOutEllipsoids[i] = PrevEllipsoids[History.PrevIndex];
+			History.PrevIndex = static_cast<uint32>(i);
+			++History.FramesSinceUpdate;
+			continue;
+		}
+
+		// Neighbor grid only when something is recomputed
+		if (PositionsD.Num() == 0)
+		{
+			PositionsD.Reserve(NumParticles);
+			for (const FVector3f& P : Positions)
+			{
+				PositionsD.Add(FVector(P));
+			}
+			Hash.BuildFromPositions(PositionsD);
+		}
+
+		GatherCandidates(Hash, PositionsD, i, Settings.SmoothingRadius, Scratch, Candidates);
+		InOutEllipsoids[i] = ComputeDensityBased(Positions[i], Candidates, Settings);
+
+		History.RefPosition = Positions[i];
+		History.ParticleID = ParticleIDs[i];
+		History.PrevIndex = static_cast<uint32>(i);
+		History.NeighborCount = NeighborCounts[i];
+		History.FramesSinceUpdate = 0;
+		++Stats.NumRecomputed;
+	}
+
+	return Stats;
+}
@@ -0,0 +1,158 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Core/KawaiiFluidBrushSampler.h"
+#include "Math/RandomStream.h"
+
+//========================================
+// FKawaiiFluidBrushSampleRegion
+//========================================
+
+bool FKawaiiFluidBrushSampleRegion::Contains(const FVector& Position) const
+{
+	const FVector Axis = FMath::ClosestPointOnSegment(Position, Start, End);
+	const FVector Offset = Position - Axis;
+	if (Offset.SizeSquared() > FMath::Square(Radius))
+	{
+		return false;
+	}
+	return FVector::DotProduct(Offset, SurfaceNormal) >= MinHeight;
+}
+
+FBox FKawaiiFluidBrushSampleRegion::GetBounds() const
+{
+	FBox Bounds(ForceInit);
+	Bounds += Start;
+	Bounds += End;
+	return Bounds.ExpandBy(Radius);
+}
+
+//========================================
+// FKawaiiFluidBrushSampler
+//========================================
+
+FKawaiiFluidBrushSampler::FKawaiiFluidBrushSampler(float InSpacing)
+	: Spacing(FMath::Max(InSpacing, KINDA_SMALL_NUMBER))
+	, Hash(Spacing)
+{
+}
+
+void FKawaiiFluidBrushSampler::AddOccupied(const FVector& Position)
+{
+	Hash.Insert(Occupied.Num(), Position);
+	Occupied.Add(Position);
+}
+
+void FKawaiiFluidBrushSampler::AddOccupied(TConstArrayView<FVector> Positions)
+{
+	Occupied.Reserve(Occupied.Num() + Positions.Num());
+	for (const FVector& Position : Positions)
+	{
+		AddOccupied(Position);
+	}
+}
+
+void FKawaiiFluidBrushSampler::AddOccupied(TConstArrayView<FVector3f> Positions)
+{
+	Occupied.Reserve(Occupied.Num() + Positions.Num());
+	for (const FVector3f& Position : Positions)
+	{
+		AddOccupied(FVector(Position));
+	}
+}
+
+void FKawaiiFluidBrushSampler::Reset()
+{
+	Hash.Clear();
+	Occupied.Reset();
+}
+
+bool FKawaiiFluidBrushSampler::IsFree(const FVector& Position) const
+{
+	// Cell size == Spacing, so the 27 surrounding cells cover the disk
+	Hash.GetNeighbors(Position, Spacing, NeighborScratch);
+
+	const double SpacingSq = FMath::Square(static_cast<double>(Spacing));
+	for (const int32 Index : NeighborScratch)
+	{
+		if (FVector::DistSquared(Position, Occupied[Index]) < SpacingSq)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+int32 FKawaiiFluidBrushSampler::Sample(const FKawaiiFluidBrushSampleRegion& Region, int32 MaxSamples, int32 Seed,
+	TArray<FVector>& OutPositions)
+{
+	if (MaxSamples <= 0 || Region.Radius <= 0.0f)
+	{
+		return 0;
+	}
+
+	FRandomStream Stream(Seed);
+	const FBox Bounds = Region.GetBounds();
+
+	// Indices into Occupied of samples that may still have free space around them
+	TArray<int32> Active;
+	int32 NumAccepted = 0;
+
+	auto TryAccept = [&](const FVector& Candidate)
+	{
+		if (!Region.Contains(Candidate) || !IsFree(Candidate))
+		{
+			return false;
+		}
+		Active.Add(Occupied.Num());
+		AddOccupied(Candidate);
+		OutPositions.Add(Candidate);
+		++NumAccepted;
+		return true;
+	};
+
+	// Darts find every empty pocket (existing fluid may split the region); Bridson expansion
+	// then grows each pocket out to the spacing. Random draws are sequenced explicitly so the
+	// result does not depend on argument evaluation order.
+	const int32 MaxDarts = MaxDartFailures * 16;
+	int32 DartFailures = 0;
+	for (int32 Dart = 0; Dart < MaxDarts && DartFailures < MaxDartFailures && NumAccepted < MaxSamples; ++Dart)
+	{
+		FVector Candidate;
+		Candidate.X = Stream.FRandRange(Bounds.Min.X, Bounds.Max.X);
+		Candidate.Y = Stream.FRandRange(Bounds.Min.Y, Bounds.Max.Y);
+		Candidate.Z = Stream.FRandRange(Bounds.Min.Z, Bounds.Max.Z);
+
+		if (!Region.Contains(Candidate))
+		{
+			continue;
+		}
+		if (!TryAccept(Candidate))
+		{
+			++DartFailures;
+			continue;
+		}
+		DartFailures = 0;
+
+		while (Active.Num() > 0 && NumAccepted < MaxSamples)
+		{
+			const int32 Slot = Stream.RandHelper(Active.Num());
+			const FVector Origin = Occupied[Active[Slot]];
+
+			bool bFound = false;
+			for (int32 k = 0; k < CandidatesPerSample && !bFound; ++k)
+			{
+				// Annulus [Spacing, 2 * Spacing] around the active sample
+				const FVector Direction = Stream.GetUnitVector();
+				const float Distance = Stream.FRandRange(Spacing, 2.0f * Spacing);
+				bFound = TryAccept(Origin + Direction * Distance);
+			}
+
+			if (!bFound)
+			{
+				Active.RemoveAtSwap(Slot);
+			}
+		}
+	}
+
+	return NumAccepted;
+}
@@ -0,0 +1,106 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Core/KawaiiFluidBrushStrokeDelta.h"
+
+int32 FKawaiiFluidParticleBlock::GetMaxParticleID() const
+{
+	int32 MaxID = INDEX_NONE;
+	for (const int32 ParticleID : ParticleIDs)
+	{
+		MaxID = FMath::Max(MaxID, ParticleID);
+	}
+	return MaxID;
+}
+
+void FKawaiiFluidBrushStrokeDelta::AppendBlock(FKawaiiFluidParticleBlock& Record, FKawaiiFluidParticleBlock&& Block)
+{
+	if (Record.IsEmpty())
+	{
+		Record = MoveTemp(Block);
+		return;
+	}
+
+	Record.Mass = Block.Mass;
+	Record.ParticleIDs.Append(Block.ParticleIDs);
+	Record.Positions.Append(Block.Positions);
+	Record.Velocities.Append(Block.Velocities);
+}
+
+bool FKawaiiFluidBrushStrokeDelta::ApplyAdd(IKawaiiFluidParticleEditTarget& Target, TConstArrayView<FVector> Positions,
+	const FVector& Velocity, float Mass)
+{
+	if (Positions.Num() == 0)
+	{
+		return true;
+	}
+
+	const int32 FirstID = Target.AllocateParticleIDs(Positions.Num());
+	if (FirstID == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Record only the new particles (a stroke's own block is spawned as one batch)
+	FKawaiiFluidParticleBlock Block;
+	Block.Mass = Mass;
+	Block.ParticleIDs.Reserve(Positions.Num());
+	Block.Positions.Reserve(Positions.Num());
+	Block.Velocities.Reserve(Positions.Num());
+	for (int32 i = 0; i < Positions.Num(); ++i)
+	{
+		Block.Add(FirstID + i, FVector3f(Positions[i]), FVector3f(Velocity));
+	}
+
+	Target.SpawnParticleBlock(Block);
+	AppendBlock(Added, MoveTemp(Block));
+	return true;
+}
+
+bool FKawaiiFluidBrushStrokeDelta::ApplyRemove(IKawaiiFluidParticleEditTarget& Target, const FVector& Center, float Radius)
+{
+	FKawaiiFluidParticleBlock Block;
+	if (!Target.CollectParticlesInSphere(Center, Radius, Block))
+	{
+		return false;
+	}
+
+	if (Block.IsEmpty())
+	{
+		return true;
+	}
+
+	// Despawn exactly what was recorded so undo restores the same set
+	Target.DespawnParticlesByID(Block.ParticleIDs);
+	AppendBlock(Removed, MoveTemp(Block));
+	return true;
+}
+
+void FKawaiiFluidBrushStrokeDelta::Undo(IKawaiiFluidParticleEditTarget& Target) const
+{
+	if (!Added.IsEmpty())
+	{
+		Target.DespawnParticlesByID(Added.ParticleIDs);
+	}
+	if (!Removed.IsEmpty())
+	{
+		Target.SpawnParticleBlock(Removed);
+	}
+}
+
+void FKawaiiFluidBrushStrokeDelta::Redo(IKawaiiFluidParticleEditTarget& Target) const
+{
+	if (!Added.IsEmpty())
+	{
+		Target.SpawnParticleBlock(Added);
+	}
+	if (!Removed.IsEmpty())
+	{
+		Target.DespawnParticlesByID(Removed.ParticleIDs);
+	}
+}
+
+FString FKawaiiFluidBrushStrokeDelta::ToString() const
+{
+	return FString::Printf(TEXT("Fluid brush stroke: +%d / -%d particles (%llu bytes)"),
+		Added.Num(), Removed.Num(), static_cast<uint64>(GetAllocatedSize()));
+}
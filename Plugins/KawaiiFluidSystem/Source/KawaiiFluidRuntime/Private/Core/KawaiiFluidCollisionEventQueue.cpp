@@ -0,0 +1,73 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Core/KawaiiFluidCollisionEventQueue.h"
+
+FKawaiiFluidCollisionEventQueue::FKawaiiFluidCollisionEventQueue()
+{
+	Configure(10, 0.1f, 0.0f, -1);
+}
+
+void FKawaiiFluidCollisionEventQueue::Configure(int32 MaxEventsPerFrame, float InCooldown, float InMinVelocity, int32 InSourceID)
+{
+	Capacity = MaxEventsPerFrame > 0 ? FMath::Min(MaxEventsPerFrame, MaxCapacity) : MaxCapacity;
+	if (Events.Num() < Capacity)
+	{
+		Events.SetNum(Capacity);
+	}
+	NumEvents = FMath::Min(NumEvents, Capacity);
+
+	Cooldown = FMath::Max(InCooldown, 0.0f);
+	MinVelocity = FMath::Max(InMinVelocity, 0.0f);
+	FilterSourceID = InSourceID;
+}
+
+void FKawaiiFluidCollisionEventQueue::BeginFrame(float InCurrentTime)
+{
+	CurrentTime = InCurrentTime;
+	NumEvents = 0;
+	Stats = FKawaiiFluidCollisionEventStats();
+}
+
+FKawaiiFluidCollisionEvent* FKawaiiFluidCollisionEventQueue::TryAdd(int32 ParticleID, int32 SourceID, float HitSpeed)
+{
+	++Stats.NumContacts;
+
+	if (NumEvents >= Capacity)
+	{
+		++Stats.NumDropped;
+		return nullptr;
+	}
+
+	if ((FilterSourceID >= 0 && SourceID != FilterSourceID) || HitSpeed < MinVelocity)
+	{
+		++Stats.NumFiltered;
+		return nullptr;
+	}
+
+	if (const float* LastTime = LastEventTime.Find(ParticleID))
+	{
+		if (CurrentTime - *LastTime < Cooldown)
+		{
+			++Stats.NumCooldown;
+			return nullptr;
+		}
+	}
+	LastEventTime.Set(ParticleID, CurrentTime);
+
+	// Reuse the preallocated slot (previous frame's object pointers are cleared)
+	FKawaiiFluidCollisionEvent& Event = Events[NumEvents++];
+	Event = FKawaiiFluidCollisionEvent();
+	Event.ParticleID = ParticleID;
+	Event.SourceID = SourceID;
+	Event.HitSpeed = HitSpeed;
+
+	++Stats.NumAccepted;
+	return &Event;
+}
+
+void FKawaiiFluidCollisionEventQueue::Reset()
+{
+	LastEventTime.Reset();
+	NumEvents = 0;
+	Stats = FKawaiiFluidCollisionEventStats();
+}
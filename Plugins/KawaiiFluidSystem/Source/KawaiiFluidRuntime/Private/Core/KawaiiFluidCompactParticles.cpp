@@ -0,0 +1,133 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Core/KawaiiFluidCompactParticles.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** Particles per ParallelFor task (multiple of the conversion block) */
+	constexpr int32 ParticlesPerTask = 1024;
+
+	FORCEINLINE uint8 PackFlags(const FFluidParticle& P)
+	{
+		return static_cast<uint8>((P.bIsAttached ? EKawaiiFluidCompactFlags::Attached : 0)
+			| (P.bNearBoundary ? EKawaiiFluidCompactFlags::NearBoundary : 0)
+			| (P.bIsSurfaceParticle ? EKawaiiFluidCompactFlags::Surface : 0));
+	}
+
+	FORCEINLINE float ClampSpeed(double Value)
+	{
+		constexpr double MaxComponent = FKawaiiFluidCompactParticles::MaxSpeedComponent;
+		return static_cast<float>(FMath::Clamp(Value, -MaxComponent, MaxComponent));
+	}
+}
+
+FIntVector FKawaiiFluidCompactParticles::ComputeTileCoord(const FVector& Position, float InTileSize)
+{
+	return FIntVector(
+		FMath::FloorToInt32(Position.X / InTileSize),
+		FMath::FloorToInt32(Position.Y / InTileSize),
+		FMath::FloorToInt32(Position.Z / InTileSize));
+}
+
+bool FKawaiiFluidCompactParticles::Load(TConstArrayView<FFluidParticle> Particles, float CellSize)
+{
+	NumParticles = 0;
+	TileSize = FMath::Max(CellSize, KINDA_SMALL_NUMBER) * TileCells;
+	TileCoords.Reset();
+	TileLookup.Reset();
+
+	const int32 Count = Particles.Num();
+	const int32 PaddedCount = Align(Count, BlockSize);
+
+	// Tile assignment (serial: builds the tile table; consecutive particles mostly share a tile)
+	TileIndex.SetNumUninitialized(PaddedCount, EAllowShrinking::No);
+	FIntVector LastCoord(MAX_int32);
+	int32 LastTile = INDEX_NONE;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FIntVector Coord = ComputeTileCoord(Particles[i].Position, TileSize);
+		if (Coord != LastCoord)
+		{
+			if (const int32* Found = TileLookup.Find(Coord))
+			{
+				LastTile = *Found;
+			}
+			else
+			{
+				if (TileCoords.Num() >= MaxTiles)
+				{
+					// Callers fall back to their float snapshots
+					TileCoords.Reset();
+					TileLookup.Reset();
+					return false;
+				}
+				LastTile = TileCoords.Add(Coord);
+				TileLookup.Add(Coord, LastTile);
+			}
+			LastCoord = Coord;
+		}
+		TileIndex[i] = static_cast<uint16>(LastTile);
+	}
+
+	LocalX.SetNumUninitialized(PaddedCount, EAllowShrinking::No);
+	LocalY.SetNumUninitialized(PaddedCount, EAllowShrinking::No);
+	LocalZ.SetNumUninitialized(PaddedCount, EAllowShrinking::No);
+	VelX.SetNumUninitialized(PaddedCount, EAllowShrinking::No);
+	VelY.SetNumUninitialized(PaddedCount, EAllowShrinking::No);
+	VelZ.SetNumUninitialized(PaddedCount, EAllowShrinking::No);
+	Flags.SetNumUninitialized(PaddedCount, EAllowShrinking::No);
+
+	const int32 NumTasks = FMath::DivideAndRoundUp(Count, ParticlesPerTask);
+	ParallelFor(NumTasks, [&](int32 Task)
+	{
+		const int32 Begin = Task * ParticlesPerTask;
+		const int32 End = FMath::Min(Begin + ParticlesPerTask, PaddedCount);
+
+		for (int32 Block = Begin; Block < End; Block += BlockSize)
+		{
+			alignas(32) float BlockVelX[BlockSize];
+			alignas(32) float BlockVelY[BlockSize];
+			alignas(32) float BlockVelZ[BlockSize];
+
+			for (int32 Lane = 0; Lane < BlockSize; ++Lane)
+			{
+				const int32 i = Block + Lane;
+				if (i >= Count)
+				{
+					// Padding lanes: zero so the block conversion reads defined values
+					LocalX[i] = LocalY[i] = LocalZ[i] = 0.0f;
+					BlockVelX[Lane] = BlockVelY[Lane] = BlockVelZ[Lane] = 0.0f;
+					Flags[i] = 0;
+					TileIndex[i] = 0;
+					continue;
+				}
+
+				const FFluidParticle& P = Particles[i];
+				const FVector Local = P.Position - FVector(TileCoords[TileIndex[i]]) * TileSize;
+				LocalX[i] = static_cast<float>(Local.X);
+				LocalY[i] = static_cast<float>(Local.Y);
+				LocalZ[i] = static_cast<float>(Local.Z);
+
+				BlockVelX[Lane] = ClampSpeed(P.Velocity.X);
+				BlockVelY[Lane] = ClampSpeed(P.Velocity.Y);
+				BlockVelZ[Lane] = ClampSpeed(P.Velocity.Z);
+
+				Flags[i] = PackFlags(P);
+			}
+
+			FPlatformMath::WideVectorStoreHalf(&VelX[Block], BlockVelX);
+			FPlatformMath::WideVectorStoreHalf(&VelY[Block], BlockVelY);
+			FPlatformMath::WideVectorStoreHalf(&VelZ[Block], BlockVelZ);
+		}
+	});
+
+	NumParticles = Count;
+	return true;
+}
+
+float FKawaiiFluidCompactParticles::GetPositionErrorBound() const
+{
+	// |Local| < TileSize: one float rounding of at most half an ulp at TileSize
+	return TileSize * (1.0f / 16777216.0f);
+}
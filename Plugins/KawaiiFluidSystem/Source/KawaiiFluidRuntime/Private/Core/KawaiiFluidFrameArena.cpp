@@ -0,0 +1,214 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Core/KawaiiFluidFrameArena.h"
+
+namespace
+{
+	/** Active arena of the calling thread */
+	thread_local FKawaiiFluidFrameArena* GActiveFrameArena = nullptr;
+
+	/** Alignment of chunk memory (allocations with larger alignment pad inside the chunk) */
+	constexpr uint32 ChunkAlignment = 16;
+
+	FORCEINLINE uint8* AlignPointer(uint8* Ptr, uint32 Alignment)
+	{
+		return reinterpret_cast<uint8*>(Align(reinterpret_cast<UPTRINT>(Ptr), static_cast<UPTRINT>(FMath::Max(Alignment, 1u))));
+	}
+}
+
+//========================================
+// FKawaiiFluidFrameArena
+//========================================
+
+FKawaiiFluidFrameArena::FKawaiiFluidFrameArena(SIZE_T InChunkSize)
+	: ChunkSize(FMath::Max<SIZE_T>(InChunkSize, 256))
+{
+}
+
+FKawaiiFluidFrameArena::~FKawaiiFluidFrameArena()
+{
+	checkf(GActiveFrameArena != this, TEXT("Frame arena destroyed while active"));
+	FreeChunks();
+}
+
+void* FKawaiiFluidFrameArena::Allocate(SIZE_T Size, uint32 Alignment)
+{
+	if (Size == 0)
+	{
+		return nullptr;
+	}
+
+	// Current chunk, then chunks kept from earlier frames, then a new chunk
+	while (Chunks.IsValidIndex(CurrentChunk))
+	{
+		FChunk& Chunk = Chunks[CurrentChunk];
+		uint8* Start = Chunk.Data + Offset;
+		uint8* Aligned = AlignPointer(Start, Alignment);
+		if (Aligned + Size <= Chunk.Data + Chunk.Size)
+		{
+			Stats.BytesUsed += (Aligned - Start) + Size;
+			Stats.HighWaterMark = FMath::Max(Stats.HighWaterMark, Stats.BytesUsed);
+			++Stats.NumAllocations;
+			Offset = (Aligned - Chunk.Data) + Size;
+			LastAllocation = Aligned;
+			return Aligned;
+		}
+
+		if (CurrentChunk + 1 >= Chunks.Num())
+		{
+			break;
+		}
+		++CurrentChunk;
+		Offset = 0;
+	}
+
+	AddChunk(Size + Alignment);
+	CurrentChunk = Chunks.Num() - 1;
+	Offset = 0;
+	return Allocate(Size, Alignment);
+}
+
+void* FKawaiiFluidFrameArena::Reallocate(void* Ptr, SIZE_T OldSize, SIZE_T NewSize, uint32 Alignment)
+{
+	uint8* Bytes = static_cast<uint8*>(Ptr);
+
+	// Most recent allocation: move the bump offset
+	if (Bytes && Bytes == LastAllocation)
+	{
+		const FChunk& Chunk = Chunks[CurrentChunk];
+		if (Bytes + NewSize <= Chunk.Data + Chunk.Size)
+		{
+			Offset = (Bytes - Chunk.Data) + NewSize;
+			Stats.BytesUsed = Stats.BytesUsed - OldSize + NewSize;
+			Stats.HighWaterMark = FMath::Max(Stats.HighWaterMark, Stats.BytesUsed);
+			if (NewSize == 0)
+			{
+				LastAllocation = nullptr;
+				return nullptr;
+			}
+			return Ptr;
+		}
+	}
+
+	if (NewSize == 0)
+	{
+		return nullptr;
+	}
+
+	void* NewPtr = Allocate(NewSize, Alignment);
+	if (Bytes && OldSize > 0)
+	{
+		FMemory::Memcpy(NewPtr, Bytes, FMath::Min(OldSize, NewSize));
+	}
+	return NewPtr;
+}
+
+void FKawaiiFluidFrameArena::Reset()
+{
+	// Overflowed last frame: replace the chunks with one that holds the whole high-water mark
+	if (Chunks.Num() > 1)
+	{
+		FreeChunks();
+		AddChunk(FMath::DivideAndRoundUp(Stats.HighWaterMark, ChunkSize) * ChunkSize);
+	}
+
+	CurrentChunk = 0;
+	Offset = 0;
+	LastAllocation = nullptr;
+	Stats.BytesUsed = 0;
+	Stats.NumAllocations = 0;
+	++Stats.NumResets;
+	++Generation;
+}
+
+void FKawaiiFluidFrameArena::Empty()
+{
+	FreeChunks();
+	CurrentChunk = 0;
+	Offset = 0;
+	LastAllocation = nullptr;
+	Stats.BytesUsed = 0;
+	Stats.NumAllocations = 0;
+	++Generation;
+}
+
+bool FKawaiiFluidFrameArena::Owns(const void* Ptr) const
+{
+	const uint8* Bytes = static_cast<const uint8*>(Ptr);
+	for (const FChunk& Chunk : Chunks)
+	{
+		if (Bytes >= Chunk.Data && Bytes < Chunk.Data + Chunk.Size)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+FKawaiiFluidFrameArena* FKawaiiFluidFrameArena::GetActive()
+{
+	return GActiveFrameArena;
+}
+
+void FKawaiiFluidFrameArena::AddChunk(SIZE_T MinSize)
+{
+	FChunk& Chunk = Chunks.AddDefaulted_GetRef();
+	Chunk.Size = FMath::Max(MinSize, ChunkSize);
+	Chunk.Data = static_cast<uint8*>(FMemory::Malloc(Chunk.Size, ChunkAlignment));
+
+	Stats.Capacity += Chunk.Size;
+	Stats.NumChunks = Chunks.Num();
+	++Stats.NumChunkAllocations;
+}
+
+void FKawaiiFluidFrameArena::FreeChunks()
+{
+	for (FChunk& Chunk : Chunks)
+	{
+		FMemory::Free(Chunk.Data);
+	}
+	Chunks.Reset();
+	Stats.Capacity = 0;
+	Stats.NumChunks = 0;
+}
+
+//========================================
+// FKawaiiFluidFrameArenaScope
+//========================================
+
+FKawaiiFluidFrameArenaScope::FKawaiiFluidFrameArenaScope(FKawaiiFluidFrameArena& Arena)
+	: Previous(GActiveFrameArena)
+{
+	GActiveFrameArena = &Arena;
+}
+
+FKawaiiFluidFrameArenaScope::~FKawaiiFluidFrameArenaScope()
+{
+	GActiveFrameArena = Previous;
+}
+
+//========================================
+// FKawaiiFluidDoubleBufferedArena
+//========================================
+
+FKawaiiFluidDoubleBufferedArena::FKawaiiFluidDoubleBufferedArena(SIZE_T InChunkSize)
+	: Arenas{ FKawaiiFluidFrameArena(InChunkSize), FKawaiiFluidFrameArena(InChunkSize) }
+{
+}
+
+void FKawaiiFluidDoubleBufferedArena::BeginFrame()
+{
+	CurrentIndex ^= 1;
+	Arenas[CurrentIndex].Reset();
+}
+
+SIZE_T FKawaiiFluidDoubleBufferedArena::GetHighWaterMark() const
+{
+	return FMath::Max(Arenas[0].GetStats().HighWaterMark, Arenas[1].GetStats().HighWaterMark);
+}
+
+void FKawaiiFluidDoubleBufferedArena::Empty()
+{
+	Arenas[0].Empty();
+	Arenas[1].Empty();
+}
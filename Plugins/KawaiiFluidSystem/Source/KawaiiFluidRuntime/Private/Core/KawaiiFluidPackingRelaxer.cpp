@@ -0,0 +1,366 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Core/KawaiiFluidPackingRelaxer.h"
+#include "Data/KawaiiFluidPresetDataAsset.h"
+#include "Physics/SPHKernels.h"
+#include "Async/ParallelFor.h"
+#include "Math/RandomStream.h"
+
+namespace
+{
+	constexpr float PackingCMToM = 0.01f;
+	constexpr float PackingMToCM = 100.0f;
+}
+
+//========================================
+// FKawaiiFluidPackingShape
+//========================================
+
+FKawaiiFluidPackingShape FKawaiiFluidPackingShape::MakeSphere(float Radius)
+{
+	FKawaiiFluidPackingShape Shape;
+	Shape.Type = EKawaiiFluidEmitterShapeType::Sphere;
+	Shape.SphereRadius = Radius;
+	return Shape;
+}
+
+FKawaiiFluidPackingShape FKawaiiFluidPackingShape::MakeBox(const FVector& HalfSize)
+{
+	FKawaiiFluidPackingShape Shape;
+	Shape.Type = EKawaiiFluidEmitterShapeType::Cube;
+	Shape.BoxHalfSize = HalfSize;
+	return Shape;
+}
+
+FKawaiiFluidPackingShape FKawaiiFluidPackingShape::MakeCylinder(float Radius, float HalfHeight)
+{
+	FKawaiiFluidPackingShape Shape;
+	Shape.Type = EKawaiiFluidEmitterShapeType::Cylinder;
+	Shape.CylinderRadius = Radius;
+	Shape.CylinderHalfHeight = HalfHeight;
+	return Shape;
+}
+
+float FKawaiiFluidPackingShape::SignedDistance(const FVector& Position) const
+{
+	switch (Type)
+	{
+	case EKawaiiFluidEmitterShapeType::Sphere:
+		return static_cast<float>(Position.Size() - SphereRadius);
+
+	case EKawaiiFluidEmitterShapeType::Cube:
+	{
+		const FVector Q = Position.GetAbs() - BoxHalfSize;
+		const FVector Outside = Q.ComponentMax(FVector::ZeroVector);
+		return static_cast<float>(Outside.Size() + FMath::Min(Q.GetMax(), 0.0));
+	}
+
+	case EKawaiiFluidEmitterShapeType::Cylinder:
+	{
+		const double RadialQ = FVector2D(Position.X, Position.Y).Size() - CylinderRadius;
+		const double AxialQ = FMath::Abs(Position.Z) - CylinderHalfHeight;
+		const FVector2D Outside(FMath::Max(RadialQ, 0.0), FMath::Max(AxialQ, 0.0));
+		return static_cast<float>(Outside.Size() + FMath::Min(FMath::Max(RadialQ, AxialQ), 0.0));
+	}
+	}
+	return 0.0f;
+}
+
+FVector FKawaiiFluidPackingShape::ProjectInside(const FVector& Position) const
+{
+	switch (Type)
+	{
+	case EKawaiiFluidEmitterShapeType::Sphere:
+		return Position.GetClampedToMaxSize(SphereRadius);
+
+	case EKawaiiFluidEmitterShapeType::Cube:
+		return Position.BoundToBox(-BoxHalfSize, BoxHalfSize);
+
+	case EKawaiiFluidEmitterShapeType::Cylinder:
+	{
+		FVector2D Radial(Position.X, Position.Y);
+		const double RadialLength = Radial.Size();
+		if (RadialLength > CylinderRadius)
+		{
+			Radial *= CylinderRadius / RadialLength;
+		}
+		return FVector(Radial.X, Radial.Y, FMath::Clamp<double>(Position.Z, -CylinderHalfHeight, CylinderHalfHeight));
+	}
+	}
+	return Position;
+}
+
+FBox FKawaiiFluidPackingShape::GetBounds() const
+{
+	switch (Type)
+	{
+	case EKawaiiFluidEmitterShapeType::Sphere:
+		return FBox(FVector(-SphereRadius), FVector(SphereRadius));
+
+	case EKawaiiFluidEmitterShapeType::Cube:
+		return FBox(-BoxHalfSize, BoxHalfSize);
+
+	case EKawaiiFluidEmitterShapeType::Cylinder:
+		return FBox(FVector(-CylinderRadius, -CylinderRadius, -CylinderHalfHeight),
+			FVector(CylinderRadius, CylinderRadius, CylinderHalfHeight));
+	}
+	return FBox(ForceInit);
+}
+
+//========================================
+// FKawaiiFluidPackingParams
+//========================================
+
+FKawaiiFluidPackingParams FKawaiiFluidPackingParams::FromPreset(const UKawaiiFluidPresetDataAsset& Preset)
+{
+	FKawaiiFluidPackingParams Params;
+	Params.SmoothingRadius = Preset.SmoothingRadius;
+	Params.RestDensity = Preset.Density;
+	Params.ParticleMass = Preset.ParticleMass;
+	return Params;
+}
+
+//========================================
+// FKawaiiFluidPackingRelaxer
+//========================================
+
+FKawaiiFluidPackingRelaxer::FKawaiiFluidPackingRelaxer(const FKawaiiFluidPackingShape& InShape, const FKawaiiFluidPackingParams& InParams)
+	: Shape(InShape)
+	, Params(InParams)
+	, Hash(InParams.SmoothingRadius)
+{
+	H_m = Params.SmoothingRadius * PackingCMToM;
+	Poly6Coeff = SPHKernels::Poly6Coefficient(H_m);
+	SpikyCoeff = SPHKernels::SpikyGradientCoefficient(H_m);
+}
+
+float FKawaiiFluidPackingRelaxer::ComputeLatticeDensity(float Spacing, float SmoothingRadius, float ParticleMass)
+{
+	const int32 Extent = FMath::CeilToInt(SmoothingRadius / Spacing);
+	double Density = 0.0;
+	for (int32 x = -Extent; x <= Extent; ++x)
+	{
+		for (int32 y = -Extent; y <= Extent; ++y)
+		{
+			for (int32 z = -Extent; z <= Extent; ++z)
+			{
+				Density += SPHKernels::Poly6(FVector(x, y, z).Size() * Spacing, SmoothingRadius);
+			}
+		}
+	}
+	return static_cast<float>(Density * ParticleMass);
+}
+
+float FKawaiiFluidPackingRelaxer::CalibrateLatticeSpacing(float SmoothingRadius, float RestDensity, float ParticleMass)
+{
+	// Density falls monotonically with spacing; bracket around the nominal spacing m = ρ₀d³
+	const float Nominal = FMath::Pow(ParticleMass / RestDensity, 1.0f / 3.0f) * PackingMToCM;
+	float Lo = Nominal * 0.5f;
+	float Hi = Nominal * 2.0f;
+	for (int32 i = 0; i < 40; ++i)
+	{
+		const float Mid = 0.5f * (Lo + Hi);
+		if (ComputeLatticeDensity(Mid, SmoothingRadius, ParticleMass) > RestDensity)
+		{
+			Lo = Mid;
+		}
+		else
+		{
+			Hi = Mid;
+		}
+	}
+	return 0.5f * (Lo + Hi);
+}
+
+void FKawaiiFluidPackingRelaxer::Initialize()
+{
+	LatticeSpacing = CalibrateLatticeSpacing(Params.SmoothingRadius, Params.RestDensity, Params.ParticleMass);
+
+	Positions.Reset();
+	Ghosts.Reset();
+
+	// Lattice over the shape plus one smoothing radius; cells inside seed the fluid, cells in the
+	// outer band become ghosts. Fluid and ghosts share the lattice, so the union starts at ρ₀.
+	const FBox Bounds = Shape.GetBounds().ExpandBy(Params.SmoothingRadius);
+	const FIntVector Min(
+		FMath::FloorToInt(Bounds.Min.X / LatticeSpacing),
+		FMath::FloorToInt(Bounds.Min.Y / LatticeSpacing),
+		FMath::FloorToInt(Bounds.Min.Z / LatticeSpacing));
+	const FIntVector Max(
+		FMath::CeilToInt(Bounds.Max.X / LatticeSpacing),
+		FMath::CeilToInt(Bounds.Max.Y / LatticeSpacing),
+		FMath::CeilToInt(Bounds.Max.Z / LatticeSpacing));
+
+	FRandomStream Stream(Params.Seed);
+	const float JitterRange = Params.Jitter * LatticeSpacing;
+	for (int32 z = Min.Z; z <= Max.Z; ++z)
+	{
+		for (int32 y = Min.Y; y <= Max.Y; ++y)
+		{
+			for (int32 x = Min.X; x <= Max.X; ++x)
+			{
+				const FVector Site = (FVector(x, y, z) + FVector(0.5)) * LatticeSpacing;
+				const float Distance = Shape.SignedDistance(Site);
+				if (Distance <= 0.0f)
+				{
+					FVector Jitter;
+					Jitter.X = Stream.FRandRange(-JitterRange, JitterRange);
+					Jitter.Y = Stream.FRandRange(-JitterRange, JitterRange);
+					Jitter.Z = Stream.FRandRange(-JitterRange, JitterRange);
+					Positions.Add(Shape.ProjectInside(Site + Jitter));
+				}
+				else if (Distance <= Params.SmoothingRadius)
+				{
+					Ghosts.Add(Site);
+				}
+			}
+		}
+	}
+
+	Lambdas.SetNumZeroed(Positions.Num());
+	Densities.SetNumZeroed(Positions.Num());
+	Deltas.SetNumZeroed(Positions.Num());
+	Neighbors.SetNum(Positions.Num());
+}
+
+void FKawaiiFluidPackingRelaxer::BuildNeighbors()
+{
+	AllPositions.Reset(Positions.Num() + Ghosts.Num());
+	AllPositions.Append(Positions);
+	AllPositions.Append(Ghosts);
+
+	Hash.BuildFromPositions(AllPositions);
+
+	ParallelFor(Positions.Num(), [this](int32 i)
+	{
+		Hash.GetNeighbors(Positions[i], Params.SmoothingRadius, Neighbors[i]);
+	});
+}
+
+void FKawaiiFluidPackingRelaxer::ComputeDensities()
+{
+	const float H2_m = H_m * H_m;
+	ParallelFor(Positions.Num(), [this, H2_m](int32 i)
+	{
+		double Density = 0.0;
+		for (const int32 j : Neighbors[i])
+		{
+			const float R2_m = static_cast<float>(FVector::DistSquared(Positions[i], AllPositions[j])) * PackingCMToM * PackingCMToM;
+			const float Diff = FMath::Max(H2_m - R2_m, 0.0f);
+			Density += Poly6Coeff * Diff * Diff * Diff;
+		}
+		Densities[i] = static_cast<float>(Density * Params.ParticleMass);
+	});
+}
+
+void FKawaiiFluidPackingRelaxer::Step()
+{
+	const int32 NumFluid = Positions.Num();
+	if (NumFluid == 0)
+	{
+		return;
+	}
+
+	BuildNeighbors();
+	ComputeDensities();
+
+	const float GradScale = Params.ParticleMass / Params.RestDensity;
+
+	// Spiky gradient ∇W(r) in 1/m⁴ along Offset (cm)
+	auto SpikyGradient = [this](const FVector& Offset) -> FVector
+	{
+		const double Dist = Offset.Size();
+		const double Dist_m = Dist * PackingCMToM;
+		if (Dist <= UE_KINDA_SMALL_NUMBER || Dist_m >= H_m)
+		{
+			return FVector::ZeroVector;
+		}
+		const double Diff = H_m - Dist_m;
+		return Offset * (SpikyCoeff * Diff * Diff / Dist);
+	};
+
+	// λᵢ = -Cᵢ / Σₖ|∇ₖCᵢ|²  (ghosts are frozen: no gradient term of their own)
+	ParallelFor(NumFluid, [&](int32 i)
+	{
+		const float C = Densities[i] / Params.RestDensity - 1.0f;
+		FVector GradI = FVector::ZeroVector;
+		double SumGrad2 = 0.0;
+		for (const int32 j : Neighbors[i])
+		{
+			if (j == i)
+			{
+				continue;
+			}
+			const FVector GradJ = SpikyGradient(Positions[i] - AllPositions[j]) * GradScale;
+			GradI += GradJ;
+			if (j < NumFluid)
+			{
+				SumGrad2 += GradJ.SizeSquared();
+			}
+		}
+		SumGrad2 += GradI.SizeSquared();
+		Lambdas[i] = SumGrad2 > UE_SMALL_NUMBER ? static_cast<float>(-C / SumGrad2) : 0.0f;
+	});
+
+	// Δpᵢ = (m/ρ₀) Σⱼ (λᵢ + λⱼ) ∇W, ghosts mirror λᵢ
+	ParallelFor(NumFluid, [&](int32 i)
+	{
+		FVector Delta = FVector::ZeroVector;
+		for (const int32 j : Neighbors[i])
+		{
+			if (j == i)
+			{
+				continue;
+			}
+			const float LambdaJ = j < NumFluid ? Lambdas[j] : Lambdas[i];
+			Delta += SpikyGradient(Positions[i] - AllPositions[j]) * (Lambdas[i] + LambdaJ);
+		}
+		Deltas[i] = Delta * (GradScale * PackingMToCM);
+	});
+
+	for (int32 i = 0; i < NumFluid; ++i)
+	{
+		Positions[i] = Shape.ProjectInside(Positions[i] + Deltas[i]);
+	}
+}
+
+void FKawaiiFluidPackingRelaxer::MeasureDensityDeviation(float& OutRMS, float& OutMax)
+{
+	OutRMS = 0.0f;
+	OutMax = 0.0f;
+	if (Positions.Num() == 0)
+	{
+		return;
+	}
+
+	BuildNeighbors();
+	ComputeDensities();
+
+	double SumSq = 0.0;
+	for (const float Density : Densities)
+	{
+		const float Deviation = FMath::Abs(Density / Params.RestDensity - 1.0f);
+		SumSq += Deviation * Deviation;
+		OutMax = FMath::Max(OutMax, Deviation);
+	}
+	OutRMS = static_cast<float>(FMath::Sqrt(SumSq / Positions.Num()));
+}
+
+FKawaiiFluidPackingStats FKawaiiFluidPackingRelaxer::Relax()
+{
+	Initialize();
+
+	FKawaiiFluidPackingStats Stats;
+	Stats.NumParticles = Positions.Num();
+	Stats.NumGhosts = Ghosts.Num();
+	Stats.LatticeSpacing = LatticeSpacing;
+	MeasureDensityDeviation(Stats.InitialRMSDeviation, Stats.InitialMaxDeviation);
+
+	for (int32 Iteration = 0; Iteration < Params.Iterations; ++Iteration)
+	{
+		Step();
+	}
+
+	MeasureDensityDeviation(Stats.RMSDeviation, Stats.MaxDeviation);
+	return Stats;
+}
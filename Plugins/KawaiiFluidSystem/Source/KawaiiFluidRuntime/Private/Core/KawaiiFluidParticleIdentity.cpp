@@ -0,0 +1,69 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Core/KawaiiFluidParticleIdentity.h"
+
+void FKawaiiFluidParticleIDMap::Rebuild(TConstArrayView<int32> SlotToID)
+{
+	const int32 NumSlots = SlotToID.Num();
+	const uint32 Capacity = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(NumSlots * 2, 16)));
+
+	// Grow only; shrinking would reallocate every time the particle count dips
+	if (static_cast<uint32>(TableIDs.Num()) < Capacity)
+	{
+		TableIDs.SetNumUninitialized(Capacity);
+		TableSlots.SetNumUninitialized(Capacity);
+	}
+	TableMask = static_cast<uint32>(TableIDs.Num()) - 1;
+
+	Reset();
+
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		const int32 ParticleID = SlotToID[Slot];
+		if (ParticleID < 0)
+		{
+			continue;
+		}
+
+		uint32 Entry = HashID(ParticleID);
+		while (TableIDs[Entry] != INDEX_NONE && TableIDs[Entry] != ParticleID)
+		{
+			Entry = (Entry + 1) & TableMask;
+		}
+
+		if (TableIDs[Entry] == INDEX_NONE)
+		{
+			++NumMapped;
+		}
+		TableIDs[Entry] = ParticleID;
+		TableSlots[Entry] = Slot;
+	}
+}
+
+int32 FKawaiiFluidParticleIDMap::FindSlot(int32 ParticleID) const
+{
+	if (ParticleID < 0 || NumMapped == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	uint32 Entry = HashID(ParticleID);
+	while (TableIDs[Entry] != INDEX_NONE)
+	{
+		if (TableIDs[Entry] == ParticleID)
+		{
+			return TableSlots[Entry];
+		}
+		Entry = (Entry + 1) & TableMask;
+	}
+	return INDEX_NONE;
+}
+
+void FKawaiiFluidParticleIDMap::Reset()
+{
+	for (int32& ParticleID : TableIDs)
+	{
+		ParticleID = INDEX_NONE;
+	}
+	NumMapped = 0;
+}
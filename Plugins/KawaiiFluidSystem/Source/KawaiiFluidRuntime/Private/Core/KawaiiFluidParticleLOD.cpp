@@ -0,0 +1,319 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Far-Field Particle LOD
+// See KawaiiFluidParticleLOD.h for documentation.
+
+#include "Core/KawaiiFluidParticleLOD.h"
+
+double FKawaiiFluidParticleLOD::GetMinViewDistanceSq(const FVector& Position, TConstArrayView<FVector> ViewPoints)
+{
+	double MinDistSq = TNumericLimits<double>::Max();
+	for (const FVector& ViewPoint : ViewPoints)
+	{
+		MinDistSq = FMath::Min(MinDistSq, FVector::DistSquared(Position, ViewPoint));
+	}
+	return MinDistSq;
+}
+
+FKawaiiFluidParticleLODStats FKawaiiFluidParticleLOD::MergeFarParticles(
+	TArray<FFluidParticle>& Particles,
+	const FKawaiiFluidParticleLODSettings& Settings,
+	TConstArrayView<FVector> ViewPoints)
+{
+	FKawaiiFluidParticleLODStats Stats;
+
+	if (ViewPoints.Num() == 0 || Particles.Num() < 2 || Settings.MaxMergeCount < 2)
+	{
+		return Stats;
+	}
+
+	const double MergeDistSq = FMath::Square(static_cast<double>(Settings.MergeDistance));
+	const float MaxSpeedSq = FMath::Square(Settings.MaxMergeSpeed);
+	const float MaxMass = Settings.BaseMass * Settings.MaxMergeCount * (1.0f + KINDA_SMALL_NUMBER);
+	const double InvCellSize = 1.0 / FMath::Max(Settings.ClusterCellSize, 1.0f);
+
+	//========================================
+	// 1. Bucket eligible particles by (cell, SourceID)
+	//========================================
+	TMap<TTuple<FIntVector, int32>, int32> CellToCluster;
+	TArray<TArray<int32>> Clusters;
+
+	for (int32 i = 0; i < Particles.Num(); ++i)
+	{
+		const FFluidParticle& Particle = Particles[i];
+
+		if (Particle.bIsAttached ||
+			Particle.Velocity.SizeSquared() > MaxSpeedSq ||
+			Particle.Mass >= MaxMass ||
+			GetMinViewDistanceSq(Particle.Position, ViewPoints) < MergeDistSq)
+		{
+			continue;
+		}
+
+		const FIntVector Cell(
+			FMath::FloorToInt(Particle.Position.X * InvCellSize),
+			FMath::FloorToInt(Particle.Position.Y * InvCellSize),
+			FMath::FloorToInt(Particle.Position.Z * InvCellSize));
+
+		const TTuple<FIntVector, int32> Key(Cell, Particle.SourceID);
+		int32* ClusterIndex = CellToCluster.Find(Key);
+		if (!ClusterIndex)
+		{
+			ClusterIndex = &CellToCluster.Add(Key, Clusters.AddDefaulted());
+		}
+		Clusters[*ClusterIndex].Add(i);
+	}
+
+	if (Clusters.Num() == 0)
+	{
+		return Stats;
+	}
+
+	//========================================
+	// 2. Fold each cluster into mass-bounded representatives
+	//========================================
+	TArray<FFluidParticle> Representatives;
+	TArray<int32> RepresentativeAt;
+	RepresentativeAt.Init(INDEX_NONE, Particles.Num());
+	TBitArray<> Consumed(false, Particles.Num());
+
+	auto EmitGroup = [&](TConstArrayView<int32> Group)
+	{
+		if (Group.Num() < 2)
+		{
+			return;
+		}
+
+		// Accumulate in double so conservation holds for large clusters far from origin
+		double TotalMass = 0.0;
+		FVector MassWeightedPosition = FVector::ZeroVector;
+		FVector Momentum = FVector::ZeroVector;
+		int32 MinParticleID = TNumericLimits<int32>::Max();
+
+		for (const int32 Index : Group)
+		{
+			const FFluidParticle& Member = Particles[Index];
+			TotalMass += Member.Mass;
+			MassWeightedPosition += Member.Position * Member.Mass;
+			Momentum += Member.Velocity * Member.Mass;
+			MinParticleID = FMath::Min(MinParticleID, Member.ParticleID);
+			Consumed[Index] = true;
+		}
+
+		FFluidParticle Representative = Particles[Group[0]];
+		Representative.Mass = static_cast<float>(TotalMass);
+		Representative.Position = MassWeightedPosition / TotalMass;
+		Representative.PredictedPosition = Representative.Position;
+		Representative.Velocity = Momentum / TotalMass;
+		Representative.ParticleID = MinParticleID;
+		Representative.Density = 0.0f;
+		Representative.Lambda = 0.0f;
+		Representative.NeighborIndices.Reset();
+
+		RepresentativeAt[Group[0]] = Representatives.Add(MoveTemp(Representative));
+
+		Stats.NumMergedParticles += Group.Num();
+		++Stats.NumRepresentativesCreated;
+	};
+
+	TArray<int32> Group;
+	for (const TArray<int32>& Cluster : Clusters)
+	{
+		Group.Reset();
+		float GroupMass = 0.0f;
+
+		for (const int32 Index : Cluster)
+		{
+			const float Mass = Particles[Index].Mass;
+			if (GroupMass + Mass > MaxMass)
+			{
+				EmitGroup(Group);
+				Group.Reset();
+				GroupMass = 0.0f;
+			}
+
+			Group.Add(Index);
+			GroupMass += Mass;
+		}
+
+		EmitGroup(Group);
+	}
+
+	if (Stats.NumRepresentativesCreated == 0)
+	{
+		return Stats;
+	}
+
+	//========================================
+	// 3. Compact: representatives take the slot of their first member
+	//========================================
+	TArray<FFluidParticle> Result;
+	Result.Reserve(Particles.Num() - Stats.NumMergedParticles + Stats.NumRepresentativesCreated);
+
+	for (int32 i = 0; i < Particles.Num(); ++i)
+	{
+		if (RepresentativeAt[i] != INDEX_NONE)
+		{
+			Result.Add(MoveTemp(Representatives[RepresentativeAt[i]]));
+		}
+		else if (!Consumed[i])
+		{
+			Result.Add(MoveTemp(Particles[i]));
+		}
+	}
+
+	Particles = MoveTemp(Result);
+	return Stats;
+}
+
+FKawaiiFluidParticleLODStats FKawaiiFluidParticleLOD::SplitNearParticles(
+	TArray<FFluidParticle>& Particles,
+	const FKawaiiFluidParticleLODSettings& Settings,
+	TConstArrayView<FVector> ViewPoints,
+	int32& InOutNextParticleID)
+{
+	FKawaiiFluidParticleLODStats Stats;
+
+	if (ViewPoints.Num() == 0 || Particles.Num() == 0)
+	{
+		return Stats;
+	}
+
+	const double SplitDistSq = FMath::Square(static_cast<double>(Settings.SplitDistance));
+
+	// Find representatives to split first (most frames have none)
+	TArray<int32> SplitIndices;
+	for (int32 i = 0; i < Particles.Num(); ++i)
+	{
+		const FFluidParticle& Particle = Particles[i];
+		if (IsRepresentative(Particle, Settings.BaseMass) &&
+			GetMinViewDistanceSq(Particle.Position, ViewPoints) <= SplitDistSq)
+		{
+			SplitIndices.Add(i);
+		}
+	}
+
+	if (SplitIndices.Num() == 0)
+	{
+		return Stats;
+	}
+
+	TArray<FFluidParticle> Result;
+	Result.Reserve(Particles.Num() + SplitIndices.Num() * Settings.MaxMergeCount);
+
+	TArray<FVector> Offsets;
+	int32 NextSplit = 0;
+
+	for (int32 i = 0; i < Particles.Num(); ++i)
+	{
+		if (NextSplit >= SplitIndices.Num() || SplitIndices[NextSplit] != i)
+		{
+			Result.Add(MoveTemp(Particles[i]));
+			continue;
+		}
+		++NextSplit;
+
+		const FFluidParticle& Representative = Particles[i];
+		const int32 ChildCount = GetRepresentedCount(Representative, Settings.BaseMass);
+
+		// Fibonacci sphere pattern, re-centered so offsets sum to zero (center of mass preserved)
+		Offsets.Reset(ChildCount);
+		FVector OffsetSum = FVector::ZeroVector;
+		for (int32 c = 0; c < ChildCount; ++c)
+		{
+			const double Z = 1.0 - (2.0 * c + 1.0) / ChildCount;
+			const double Radius = FMath::Sqrt(FMath::Max(0.0, 1.0 - Z * Z));
+			const double Phi = c * UE_DOUBLE_PI * (3.0 - FMath::Sqrt(5.0));
+			const FVector Offset = FVector(FMath::Cos(Phi) * Radius, FMath::Sin(Phi) * Radius, Z) * Settings.SplitRadius;
+			Offsets.Add(Offset);
+			OffsetSum += Offset;
+		}
+		const FVector OffsetMean = OffsetSum / ChildCount;
+
+		const float ChildMass = Representative.Mass / ChildCount;
+		for (int32 c = 0; c < ChildCount; ++c)
+		{
+			FFluidParticle Child = Representative;
+			Child.Mass = ChildMass;
+			Child.Position = Representative.Position + (Offsets[c] - OffsetMean);
+			Child.PredictedPosition = Child.Position;
+			Child.ParticleID = (c == 0) ? Representative.ParticleID : InOutNextParticleID++;
+			Child.Density = 0.0f;
+			Child.Lambda = 0.0f;
+			Child.NeighborIndices.Reset();
+			Result.Add(MoveTemp(Child));
+		}
+
+		++Stats.NumRepresentativesSplit;
+		Stats.NumSplitParticles += ChildCount;
+	}
+
+	Particles = MoveTemp(Result);
+	return Stats;
+}
+
+FKawaiiFluidParticleLODStats FKawaiiFluidParticleLOD::BuildUpdate(
+	TConstArrayView<FFluidParticle> Particles,
+	const FKawaiiFluidParticleLODSettings& Settings,
+	TConstArrayView<FVector> ViewPoints,
+	TArray<int32>& OutRemovedIDs,
+	TArray<FFluidParticle>& OutAddedParticles)
+{
+	OutRemovedIDs.Reset();
+	OutAddedParticles.Reset();
+
+	TArray<FFluidParticle> Working(Particles.GetData(), Particles.Num());
+	FKawaiiFluidParticleLODStats Stats = MergeFarParticles(Working, Settings, ViewPoints);
+
+	// Children ids only have to be unique within this step (replaced by the caller)
+	int32 NextParticleID = 0;
+	for (const FFluidParticle& Particle : Particles)
+	{
+		NextParticleID = FMath::Max(NextParticleID, Particle.ParticleID + 1);
+	}
+
+	const FKawaiiFluidParticleLODStats SplitStats = SplitNearParticles(Working, Settings, ViewPoints, NextParticleID);
+	Stats.NumRepresentativesSplit = SplitStats.NumRepresentativesSplit;
+	Stats.NumSplitParticles = SplitStats.NumSplitParticles;
+
+	if (Stats.NumRepresentativesCreated == 0 && Stats.NumRepresentativesSplit == 0)
+	{
+		return Stats;
+	}
+
+	// Untouched particles come out with their ParticleID and mass; a representative keeps a
+	// member id and a first child keeps the representative id, but both change mass
+	TMap<int32, float> InputMass;
+	InputMass.Reserve(Particles.Num());
+	for (const FFluidParticle& Particle : Particles)
+	{
+		InputMass.Add(Particle.ParticleID, Particle.Mass);
+	}
+
+	TMap<int32, float> OutputMass;
+	OutputMass.Reserve(Working.Num());
+	for (const FFluidParticle& Particle : Working)
+	{
+		OutputMass.Add(Particle.ParticleID, Particle.Mass);
+	}
+
+	for (const FFluidParticle& Particle : Particles)
+	{
+		const float* Mass = OutputMass.Find(Particle.ParticleID);
+		if (!Mass || *Mass != Particle.Mass)
+		{
+			OutRemovedIDs.Add(Particle.ParticleID);
+		}
+	}
+
+	for (const FFluidParticle& Particle : Working)
+	{
+		const float* Mass = InputMass.Find(Particle.ParticleID);
+		if (!Mass || *Mass != Particle.Mass)
+		{
+			FFluidParticle& Added = OutAddedParticles.Add_GetRef(Particle);
+			Added.ParticleID = INDEX_NONE;
+		}
+	}
+
+	return Stats;
+}
@@ -3,12 +3,16 @@
 #include "Core/KawaiiFluidSimulationContext.h"
 #include "Core/SpatialHash.h"
 #include "Core/KawaiiFluidSimulationStats.h"
+#include "Core/KawaiiFluidFrameArena.h"
 #include "Components/KawaiiFluidVolumeComponent.h"
 #include "Data/KawaiiFluidPresetDataAsset.h"
 #include "Physics/DensityConstraint.h"
+#include "Physics/SPHKernelTable.h"
 #include "Physics/ViscositySolver.h"
 #include "Physics/AdhesionSolver.h"
 #include "Physics/StackPressureSolver.h"
+#include "Physics/SurfaceDetector.h"
+#include "Core/KawaiiFluidCompactParticles.h"
 #include "Collision/KawaiiFluidCollider.h"
 #include "Collision/KawaiiFluidMeshCollider.h"
 #include "Components/KawaiiFluidInteractionComponent.h"
@@ -24,6 +28,7 @@
 #include "Engine/OverlapResult.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/World.h"
+#include "WorldCollision.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "Landscape/LandscapeHeightmapExtractor.h"
 #include "LandscapeProxy.h"
@@ -39,8 +44,31 @@ DECLARE_CYCLE_STAT(TEXT("Context WorldCollision"), STAT_ContextWorldCollision, S
 DECLARE_CYCLE_STAT(TEXT("Context FinalizePositions"), STAT_ContextFinalizePositions, STATGROUP_KawaiiFluidContext);
 DECLARE_CYCLE_STAT(TEXT("Context ApplyViscosity"), STAT_ContextApplyViscosity, STATGROUP_KawaiiFluidContext);
 DECLARE_CYCLE_STAT(TEXT("Context ApplyAdhesion"), STAT_ContextApplyAdhesion, STATGROUP_KawaiiFluidContext);
+DECLARE_CYCLE_STAT(TEXT("Context ClassifySurface"), STAT_ContextClassifySurface, STATGROUP_KawaiiFluidContext);
 DECLARE_CYCLE_STAT(TEXT("Context ApplyCohesion"), STAT_ContextApplyCohesion, STATGROUP_KawaiiFluidContext);
 
+// CPU solver: classify surface particles each substep and run cohesion on them only
+static int32 GFluidCPUSurfaceDetection = 1;
+static FAutoConsoleVariableRef CVarFluidCPUSurfaceDetection(
+	TEXT("r.Fluid.CPUSurfaceDetection"),
+	GFluidCPUSurfaceDetection,
+	TEXT("CPU surface particle classification.\n")
+	TEXT("  0 = Off (cohesion on every particle, surface flags untouched)\n")
+	TEXT("  1 = Neighbor count + color-field gradient; cohesion on surface particles only (default)"),
+	ECVF_Default
+);
+
+// CPU solver: pack a compact particle layout once per substep for the neighbor loops after FinalizePositions
+static int32 GFluidCPUCompactLayout = 0;
+static FAutoConsoleVariableRef CVarFluidCPUCompactLayout(
+	TEXT("r.Fluid.CPUCompactLayout"),
+	GFluidCPUCompactLayout,
+	TEXT("CPU solver particle layout read by viscosity and surface classification.\n")
+	TEXT("  0 = Float snapshots of FFluidParticle built by each pass (default)\n")
+	TEXT("  1 = One compact copy per substep (tile-relative float positions, half velocities, packed flags)"),
+	ECVF_Default
+);
+
 //========================================
 // Auto-Scaling for SmoothingRadius Independence
 // SPH stability depends on h (smoothing radius). When h changes, several parameters
@@ -73,19 +101,118 @@ namespace SPHScaling
 namespace
 {
 	constexpr float GPUWorldCollisionMargin = 1.0f;
-	constexpr float GPUWorldBoundsTolerance = 0.1f;
+	constexpr float GPUWorldTransformTolerance = 0.1f;
+
+	// Async world overlap query box: padded around the needed bounds, re-issued when the needed
+	// bounds leave it or when it becomes much larger than needed
+	constexpr float WorldOverlapPaddingRatio = 0.25f;
+	constexpr float WorldOverlapMinPadding = 200.0f;
+	constexpr float WorldOverlapShrinkRatio = 8.0f;
 
 	// ISMC per-instance collision limits
 	constexpr int32 MaxISMCInstancesForCollision = 256;
 
-	bool AreBoundsEqual(const FBox& A, const FBox& B)
+	/**
+	 * CPU world collision response shared by the overlap and SDF cache paths
+	 * Pushes PredictedPosition out along Normal, applies restitution/friction through Position,
+	 * records a collision event and detaches particles that hit a different surface.
+	 */
+	void ApplyWorldCollisionResponse(
+		FFluidParticle& Particle,
+		const FKawaiiFluidSimulationParams& Params,
+		const FVector& BestNormal,
+		float Penetration,
+		const FVector& BestClosestPoint,
+		AActor* HitActor,
+		float SubstepDT,
+		float Friction,
+		float Restitution)
 	{
-		if (!A.IsValid || !B.IsValid)
+		// Push particle to surface + margin
+		FVector CollisionPos = Particle.PredictedPosition + BestNormal * Penetration;
+
+		// Only modify PredictedPosition
+		Particle.PredictedPosition = CollisionPos;
+
+		// Calculate desired velocity after collision response
+		// Initialize to zero - particle stops on surface by default
+		FVector DesiredVelocity = FVector::ZeroVector;
+		float VelDotNormal = FVector::DotProduct(Particle.Velocity, BestNormal);
+
+		// Minimum velocity threshold for applying restitution bounce
+		// Prevents "popcorn" oscillation for particles resting on surfaces
+		const float MinBounceVelocity = 50.0f;  // cm/s
+
+		if (VelDotNormal < 0.0f)
 		{
-			return false;
+			// Particle moving INTO surface - apply collision response
+			FVector VelNormal = BestNormal * VelDotNormal;
+			FVector VelTangent = Particle.Velocity - VelNormal;
+
+			if (VelDotNormal < -MinBounceVelocity)
+			{
+				// Significant impact - apply full collision response
+				// Normal: reflect with Restitution (0 = stick, 1 = perfect bounce)
+				// Tangent: dampen with Friction (0 = slide, 1 = stop)
+				DesiredVelocity = VelTangent * (1.0f - Friction) - VelNormal * Restitution;
+			}
+			else
+			{
+				// Low velocity contact (resting on surface) - no bounce, just slide
+				DesiredVelocity = VelTangent * (1.0f - Friction);
+			}
+		}
+		// else: VelDotNormal >= 0 means particle moving AWAY from surface
+		// DesiredVelocity stays zero - particle stops on surface (same as OLD behavior)
+
+		// Back-calculate Position so FinalizePositions derives DesiredVelocity
+		Particle.Position = Particle.PredictedPosition - DesiredVelocity * SubstepDT;
+
+		// Add to collision event buffer (processed later in ProcessCollisionFeedback)
+		if (Params.bEnableCollisionEvents && Params.CPUCollisionFeedbackBufferPtr && Params.CPUCollisionFeedbackLockPtr)
+		{
+			const float Speed = Particle.Velocity.Size();
+			if (Speed >= Params.MinVelocityForEvent)
+			{
+				FKawaiiFluidCollisionEvent Event;
+				Event.ParticleID = Particle.ParticleID;
+				Event.SourceID = Particle.SourceID;
+				Event.ColliderOwnerID = HitActor ? HitActor->GetUniqueID() : -1;
+				Event.BoneIndex = -1;  // CPU path doesn't have bone info
+				Event.HitActor = HitActor;
+				Event.HitLocation = BestClosestPoint;
+				Event.HitNormal = BestNormal;
+				Event.HitSpeed = Speed;
+				// HitInteractionComponent is looked up in ProcessCollisionFeedback
+
+				// Add to buffer (thread-safe)
+				FScopeLock Lock(Params.CPUCollisionFeedbackLockPtr);
+				Params.CPUCollisionFeedbackBufferPtr->Add(Event);
+			}
+		}
+
+		// Detach from character if hitting different surface
+		if (Particle.bIsAttached && HitActor != Particle.AttachedActor.Get())
+		{
+			Particle.ClearAttachment();
 		}
+	}
+
+	/** Append Source to Out, offsetting convex plane indices */
+	void AppendCollisionPrimitives(const FGPUCollisionPrimitives& Source, FGPUCollisionPrimitives& Out)
+	{
+		const int32 PlaneOffset = Out.ConvexPlanes.Num();
+		Out.Spheres.Append(Source.Spheres);
+		Out.Capsules.Append(Source.Capsules);
+		Out.Boxes.Append(Source.Boxes);
+		Out.ConvexPlanes.Append(Source.ConvexPlanes);
 
-		return A.Min.Equals(B.Min, GPUWorldBoundsTolerance) && A.Max.Equals(B.Max, GPUWorldBoundsTolerance);
+		for (const FGPUCollisionConvex& SourceConvex : Source.Convexes)
+		{
+			FGPUCollisionConvex Convex = SourceConvex;
+			Convex.PlaneStartIndex += PlaneOffset;
+			Out.Convexes.Add(Convex);
+		}
 	}
 
 	void AppendConvexToGPUPrimitives(
@@ -198,7 +325,7 @@ namespace
 					Planes.Add(GPUPlane);
 				}
 				
-				static int32 FallbackLogCounter = 0;
+				static std::atomic<int32> FallbackLogCounter{0};
 				if (++FallbackLogCounter % 60 == 1)
 				{
 					UE_LOG(LogTemp, Log, TEXT("[Convex] Fallback to ChaosConvex: Verts=%d, IndexData=%d, ChaosPlanes=%d"),
@@ -215,7 +342,7 @@ namespace
 		}
 
 		// Convex debug log
-		static int32 ConvexLogCounter = 0;
+		static std::atomic<int32> ConvexLogCounter{0};
 		if (++ConvexLogCounter % 300 == 1)
 		{
 			UE_LOG(LogTemp, Log, TEXT("[Convex] Created: Center=(%.1f, %.1f, %.1f), BoundingRadius=%.1f, Planes=%d"),
@@ -352,10 +479,27 @@ void UKawaiiFluidSimulationContext::InitializeSolvers(const UKawaiiFluidPresetDa
 	ViscositySolver = MakeShared<FViscositySolver>();
 	AdhesionSolver = MakeShared<FAdhesionSolver>();
 	StackPressureSolver = MakeShared<FStackPressureSolver>();
+	SurfaceDetector = MakeShared<FSurfaceDetector>();
+	CompactParticles = MakeShared<FKawaiiFluidCompactParticles>();
+	KernelTable = MakeShared<FSPHKernelTable>();
 
 	bSolversInitialized = true;
 }
 
+const FSPHKernelTable* UKawaiiFluidSimulationContext::GetKernelTable(const UKawaiiFluidPresetDataAsset* Preset)
+{
+	if (!KernelTable.IsValid() || !Preset)
+	{
+		return nullptr;
+	}
+
+	if (!KernelTable->IsValid() || KernelTable->GetRadius() != Preset->SmoothingRadius)
+	{
+		KernelTable->Build(Preset->SmoothingRadius);
+	}
+	return KernelTable->IsValid() ? KernelTable.Get() : nullptr;
+}
+
 void UKawaiiFluidSimulationContext::EnsureSolversInitialized(const UKawaiiFluidPresetDataAsset* Preset)
 {
 	if (!bSolversInitialized && Preset)
@@ -377,12 +521,14 @@ void UKawaiiFluidSimulationContext::InitializeGPUSimulator(int32 MaxParticleCoun
 		{
 			GPUSimulator->Release();
 			GPUSimulator->Initialize(MaxParticleCount);
+			bWorldSDFBricksUploaded = false;
 		}
 		return;
 	}
 
 	GPUSimulator = MakeShared<FGPUFluidSimulator>();
 	GPUSimulator->Initialize(MaxParticleCount);
+	bWorldSDFBricksUploaded = false;
 
 	UE_LOG(LogTemp, Log, TEXT("GPU Fluid Simulator initialized with capacity: %d"), MaxParticleCount);
 }
@@ -394,6 +540,11 @@ void UKawaiiFluidSimulationContext::ReleaseGPUSimulator()
 		GPUSimulator->Release();
 		GPUSimulator.Reset();
 	}
+	bWorldSDFBricksUploaded = false;
+
+	LODRepresentativeMasses.Empty();
+	LODPendingSpawnIDs.Empty();
+	LODPendingDespawnIDs.Empty();
 }
 
 //=============================================================================
@@ -661,15 +812,34 @@ void UKawaiiFluidSimulationContext::SimulateGPU(
 	float DeltaTime,
 	float& AccumulatedTime)
 {
-	
-	
 	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_SimulateGPU);
 
-	if (!Preset)
+	// Single-context path: run all three frame phases back to back
+	// (the Subsystem runs PrepareGPUCollision for independent contexts in parallel)
+	FKawaiiFluidGPUFrameData Frame;
+	if (!BeginGPUFrame(Preset, Params, Frame))
 	{
 		return;
 	}
 
+	PrepareGPUCollision(Preset, Params, Frame);
+	SubmitGPUFrame(Preset, Params, Frame, DeltaTime, AccumulatedTime);
+}
+
+bool UKawaiiFluidSimulationContext::BeginGPUFrame(
+	const UKawaiiFluidPresetDataAsset* Preset,
+	const FKawaiiFluidSimulationParams& Params,
+	FKawaiiFluidGPUFrameData& OutFrame)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_BeginGPUFrame);
+
+	OutFrame = FKawaiiFluidGPUFrameData();
+
+	if (!Preset)
+	{
+		return false;
+	}
+
 	// Ensure GPU simulator is ready
 	if (!IsGPUSimulatorReady())
 	{
@@ -678,7 +848,7 @@ void UKawaiiFluidSimulationContext::SimulateGPU(
 		if (!IsGPUSimulatorReady())
 		{
 			UE_LOG(LogTemp, Warning, TEXT("GPU Simulator not ready"));
-			return;
+			return false;
 		}
 	}
 
@@ -731,7 +901,8 @@ void UKawaiiFluidSimulationContext::SimulateGPU(
 	// GPU World Collision Query Bounds
 	// In Unlimited Size mode: Use particle bounds (readback) + character bounds (InteractionComponents)
 	// In Normal mode: Use simulation volume bounds + particle radius padding
-	FBox GPUWorldQueryBounds{FVector(WorldBoundsMin), FVector(WorldBoundsMax)};
+	FBox& GPUWorldQueryBounds = OutFrame.WorldQueryBounds;
+	GPUWorldQueryBounds = FBox(FVector(WorldBoundsMin), FVector(WorldBoundsMax));
 	GPUWorldQueryBounds = GPUWorldQueryBounds.ExpandBy(Preset->ParticleRadius);
 
 	if (bUseUnlimitedSize)
@@ -817,7 +988,8 @@ void UKawaiiFluidSimulationContext::SimulateGPU(
 
 	// Build GPU simulation parameters
 	const float SubstepDT = Preset->SubstepDeltaTime;
-	FGPUFluidSimulationParams GPUParams = BuildGPUSimParams(Preset, Params, SubstepDT);
+	FGPUFluidSimulationParams& GPUParams = OutFrame.GPUParams;
+	GPUParams = BuildGPUSimParams(Preset, Params, SubstepDT);
 
 	// ParticleCount will be updated by GPU after spawn processing
 	// Use current GPU count + pending spawns as estimate
@@ -842,18 +1014,47 @@ void UKawaiiFluidSimulationContext::SimulateGPU(
 	*/
 
 	// Cache collider shapes once per frame (required for IsCacheValid() to return true)
+	// Touches collider components, so it stays on the game thread
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(SimGPU_CacheColliderShapes);
 		CacheColliderShapes(Params.Colliders);
 	}
 
+	// Scene queries are issued from the game thread; PrepareGPUCollision only consumes the results
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(SimGPU_WorldOverlapQuery);
+		UpdateWorldOverlapQuery(Params, GPUWorldQueryBounds);
+	}
+
+	OutFrame.AdhesionTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+	OutFrame.bValid = true;
+	return true;
+}
+
+void UKawaiiFluidSimulationContext::PrepareGPUCollision(
+	const UKawaiiFluidPresetDataAsset* Preset,
+	const FKawaiiFluidSimulationParams& Params,
+	const FKawaiiFluidGPUFrameData& Frame)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_PrepareGPUCollision);
+
+	if (!Preset || !Frame.bValid || !GPUSimulator.IsValid())
+	{
+		return;
+	}
+
+	const FBox& GPUWorldQueryBounds = Frame.WorldQueryBounds;
 
 	// Collect and upload collision primitives to GPU (with bone tracking for adhesion)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(SimGPU_CollectCollisionPrimitives);
-		FGPUCollisionPrimitives CollisionPrimitives;
-		// Use persistent bone data for velocity calculation across frames
-		CollisionPrimitives.BoneTransforms = MoveTemp(PersistentBoneTransforms);
+		// Shape arrays keep their allocation across frames; bone data persists for velocity calculation
+		FGPUCollisionPrimitives& CollisionPrimitives = GPUCollisionPrimitivesScratch;
+		CollisionPrimitives.Spheres.Reset();
+		CollisionPrimitives.Capsules.Reset();
+		CollisionPrimitives.Boxes.Reset();
+		CollisionPrimitives.Convexes.Reset();
+		CollisionPrimitives.ConvexPlanes.Reset();
 		const float DefaultFriction = Preset->Friction;
 		const float DefaultRestitution = Preset->Bounciness;
 
@@ -883,9 +1084,7 @@ void UKawaiiFluidSimulationContext::SimulateGPU(
 			UKawaiiFluidMeshCollider* MeshCollider = Cast<UKawaiiFluidMeshCollider>(Collider);
 			if (MeshCollider)
 			{
-				// Cache collider shape if needed
-				MeshCollider->CacheCollisionShapes();
-
+				// Shapes were cached on the game thread in BeginGPUFrame
 				if (MeshCollider->IsCacheValid())
 				{
 					// Get OwnerID for collision feedback filtering
@@ -928,16 +1127,41 @@ void UKawaiiFluidSimulationContext::SimulateGPU(
 
 		// Auto-collect Simple Collision from StaticMeshes within Simulation Volume
 		// FluidColliderOwners are excluded to avoid duplicate collision processing
+		// Baked world SDF replaces the world primitives once all its bricks are built
+		// Static boundary particles are generated from primitives, so they keep the primitive path
+		bool bUseWorldSDF = false;
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(SimGPU_WorldCollision);
-			AppendGPUWorldCollisionPrimitives(
-				CollisionPrimitives,
-				Params,
-				GPUWorldQueryBounds,
-				DefaultFriction,
-				DefaultRestitution,
-				FluidColliderOwners
-			);
+
+			if (Params.bUseWorldSDFCache && Params.bUseWorldCollision && !Params.bEnableStaticBoundaryParticles)
+			{
+				bUseWorldSDF = UpdateWorldSDFCache(Params, GPUWorldQueryBounds, DefaultFriction, DefaultRestitution, FluidColliderOwners);
+				UploadWorldSDFBricks();
+			}
+
+			FGPUSDFBrickCollisionParams SDFBrickParams;
+			SDFBrickParams.bEnabled = bUseWorldSDF ? 1 : 0;
+			SDFBrickParams.Friction = DefaultFriction;
+			SDFBrickParams.Restitution = DefaultRestitution;
+			GPUSimulator->SetSDFBrickCollisionParams(SDFBrickParams);
+
+			if (!bUseWorldSDF)
+			{
+				AppendGPUWorldCollisionPrimitives(
+					CollisionPrimitives,
+					Params,
+					GPUWorldQueryBounds,
+					DefaultFriction,
+					DefaultRestitution,
+					FluidColliderOwners
+				);
+			}
+		}
+
+		// World primitives uploaded before the SDF took over must not collide a second time
+		if (bUseWorldSDF && CollisionPrimitives.IsEmpty())
+		{
+			GPUSimulator->UploadCollisionPrimitives(CollisionPrimitives);
 		}
 
 		// Upload to GPU only if we have primitives
@@ -998,7 +1222,7 @@ void UKawaiiFluidSimulationContext::SimulateGPU(
 					AdhesionParams.ColliderContactOffset = Preset->AdhesionContactOffset;
 					AdhesionParams.BoneVelocityScale = Preset->AdhesionBoneVelocityScale;
 					AdhesionParams.SlidingFriction = DefaultFriction;
-					AdhesionParams.CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+					AdhesionParams.CurrentTime = Frame.AdhesionTime;
 					AdhesionParams.Gravity = FVector3f(Params.ExternalForce);
 					AdhesionParams.GravitySlidingScale = 1.0f;
 
@@ -1012,11 +1236,25 @@ void UKawaiiFluidSimulationContext::SimulateGPU(
 				}
 			}
 		}
+	}
+}
+
+void UKawaiiFluidSimulationContext::SubmitGPUFrame(
+	const UKawaiiFluidPresetDataAsset* Preset,
+	const FKawaiiFluidSimulationParams& Params,
+	FKawaiiFluidGPUFrameData& Frame,
+	float DeltaTime,
+	float& AccumulatedTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_SubmitGPUFrame);
 
-		// Save bone transforms back to persistent storage for next frame
-		PersistentBoneTransforms = MoveTemp(CollisionPrimitives.BoneTransforms);
+	if (!Preset || !Frame.bValid || !GPUSimulator.IsValid())
+	{
+		return;
 	}
 
+	FGPUFluidSimulationParams& GPUParams = Frame.GPUParams;
+
 	// =====================================================
 	// Landscape Heightmap Collision
 	// Extract heightmap from Landscape actors and upload to GPU
@@ -1186,6 +1424,45 @@ void UKawaiiFluidSimulationContext::Simulate(
 	SimulateGPU(Particles, Preset, Params, SpatialHash, DeltaTime, AccumulatedTime);
 }
 
+int32 UKawaiiFluidSimulationContext::SimulateCPU(
+	TArray<FFluidParticle>& Particles,
+	const UKawaiiFluidPresetDataAsset* Preset,
+	const FKawaiiFluidSimulationParams& Params,
+	FSpatialHash& SpatialHash,
+	float DeltaTime,
+	float& AccumulatedTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_SimulateCPU);
+
+	if (!Preset || Preset->SubstepDeltaTime <= 0.0f)
+	{
+		return 0;
+	}
+
+	if (!bSolversInitialized)
+	{
+		InitializeSolvers(Preset);
+	}
+
+	// Same accumulator as SimulateGPU (clamped so a long frame cannot spiral)
+	const int32 MaxSubstepsPerFrame = Preset->MaxSubsteps;
+	AccumulatedTime += FMath::Min(DeltaTime, Preset->SubstepDeltaTime * MaxSubstepsPerFrame);
+	const int32 TotalSubsteps = FMath::Min(FMath::FloorToInt(AccumulatedTime / Preset->SubstepDeltaTime), MaxSubstepsPerFrame);
+
+	if (Particles.Num() == 0)
+	{
+		AccumulatedTime -= TotalSubsteps * Preset->SubstepDeltaTime;
+		return 0;
+	}
+
+	for (int32 Substep = 0; Substep < TotalSubsteps; ++Substep)
+	{
+		SimulateSubstep(Particles, Preset, Params, SpatialHash, Preset->SubstepDeltaTime);
+		AccumulatedTime -= Preset->SubstepDeltaTime;
+	}
+	return TotalSubsteps;
+}
+
 void UKawaiiFluidSimulationContext::SimulateSubstep(
 	TArray<FFluidParticle>& Particles,
 	const UKawaiiFluidPresetDataAsset* Preset,
@@ -1232,12 +1509,21 @@ void UKawaiiFluidSimulationContext::SimulateSubstep(
 		}
 	}
 
+	// 5c. Containment bounds
+	if (Params.WorldBounds.IsValid && !Params.bSkipBoundsCollision)
+	{
+		HandleBoundsCollision(Particles, Params, Params.ParticleRadius);
+	}
+
 	// 6. Finalize positions
 	{
 		SCOPE_CYCLE_COUNTER(STAT_ContextFinalizePositions);
 		FinalizePositions(Particles, SubstepDT);
 	}
 
+	// 6b. Compact layout shared by viscosity and surface classification
+	PackCompactParticles(Particles, Preset);
+
 	// 7. Apply viscosity
 	{
 		SCOPE_CYCLE_COUNTER(STAT_ContextApplyViscosity);
@@ -1250,7 +1536,14 @@ void UKawaiiFluidSimulationContext::SimulateSubstep(
 		ApplyAdhesion(Particles, Preset, Params.Colliders);
 	}
 
-	// 9. Apply cohesion (surface tension between particles)
+	// 9a. Classify surface particles
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ContextClassifySurface);
+		TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_ClassifySurface);
+		ClassifySurface(Particles, Preset);
+	}
+
+	// 9b. Apply cohesion (surface tension between particles)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_ContextApplyCohesion);
 		ApplyCohesion(Particles, Preset);
@@ -1449,292 +1742,445 @@ void UKawaiiFluidSimulationContext::CacheColliderShapes(const TArray<TObjectPtr<
 	}
 }
 
-void UKawaiiFluidSimulationContext::AppendGPUWorldCollisionPrimitives(
-	FGPUCollisionPrimitives& OutPrimitives,
-	const FKawaiiFluidSimulationParams& Params,
-	const FBox& QueryBounds,
-	float DefaultFriction,
-	float DefaultRestitution,
-	const TSet<const AActor*>& FluidColliderOwners)
+void UKawaiiFluidSimulationContext::UpdateWorldOverlapQuery(const FKawaiiFluidSimulationParams& Params, const FBox& QueryBounds)
 {
-	// Diagnostic log (every 60 frames)
-	static int32 DiagLogCounter = 0;
-	const bool bShouldLog = (++DiagLogCounter % 60 == 1);
+	check(IsInGameThread());
 
-	if (!Params.bUseWorldCollision)
+	UWorld* World = Params.World;
+	if (!Params.bUseWorldCollision || !World || !QueryBounds.IsValid)
 	{
-		if (bShouldLog)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[WorldCollision] SKIP: bUseWorldCollision=false"));
-		}
-		bGPUWorldCollisionCacheDirty = true;
 		return;
 	}
 
-	if (!Params.World)
+	// World switch (PIE, level travel): drop everything, the first query below runs synchronously
+	if (CachedGPUWorldCollisionWorld.Get() != World)
 	{
-		if (bShouldLog)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[WorldCollision] SKIP: World is nullptr"));
-		}
-		bGPUWorldCollisionCacheDirty = true;
-		return;
+		CachedGPUWorldCollisionWorld = World;
+		WorldCollisionComponents.Reset();
+		CachedGPUWorldCollisionPrimitives.Reset();
+		ResolvedWorldOverlapComponents.Reset();
+		WorldOverlapCoveredBounds.Init();
+		PendingWorldOverlapHandle = FTraceHandle();
+		bWorldOverlapResultReady = false;
+		bWorldOverlapForceReexport = false;
+		bGPUWorldCollisionCacheDirty = false;
+		++GPUWorldCollisionCacheRevision;
+
+		// World changed: full static boundary / heightmap invalidation (primitives may have moved)
+		bStaticBoundaryParticlesDirty = true;
+		bLandscapeHeightmapDirty = true;
 	}
 
-	if (!QueryBounds.IsValid)
+	// 1. Collect last frame's async result
+	if (PendingWorldOverlapHandle.IsValid())
 	{
-		if (bShouldLog)
+		FOverlapDatum OverlapDatum;
+		if (World->QueryOverlapData(PendingWorldOverlapHandle, OverlapDatum))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[WorldCollision] SKIP: QueryBounds is invalid"));
+			ResolveWorldOverlap(OverlapDatum.OutOverlaps, PendingWorldOverlapBounds);
+			PendingWorldOverlapHandle = FTraceHandle();
+		}
+		else if (!World->IsTraceHandleValid(PendingWorldOverlapHandle, true))
+		{
+			// Result expired before we polled it: issue a new one below
+			PendingWorldOverlapHandle = FTraceHandle();
 		}
+	}
+
+	// 2. Hysteresis: re-query only when the needed bounds leave the covered (or requested) box,
+	//    or when the covered box has become much larger than needed
+	const FBox PaddedBounds = QueryBounds.ExpandBy(FMath::Max(
+		QueryBounds.GetExtent().GetMax() * WorldOverlapPaddingRatio, static_cast<double>(WorldOverlapMinPadding)));
+	const FBox& CoveredBounds = PendingWorldOverlapHandle.IsValid() ? PendingWorldOverlapBounds : WorldOverlapCoveredBounds;
+	const bool bOutsideCovered = !CoveredBounds.IsValid || !CoveredBounds.IsInside(QueryBounds);
+	const bool bCoveredTooLarge = CoveredBounds.IsValid && CoveredBounds.GetVolume() > PaddedBounds.GetVolume() * WorldOverlapShrinkRatio;
+
+	if (!bGPUWorldCollisionCacheDirty && !bOutsideCovered && !bCoveredTooLarge)
+	{
 		return;
 	}
 
-	const bool bWorldChanged = CachedGPUWorldCollisionWorld.Get() != Params.World;
-	const bool bBoundsChanged = !AreBoundsEqual(CachedGPUWorldCollisionBounds, QueryBounds);
+	// One query in flight at a time; a newer request is issued once it resolves
+	if (PendingWorldOverlapHandle.IsValid())
+	{
+		return;
+	}
 
-	if (bGPUWorldCollisionCacheDirty || bWorldChanged || bBoundsChanged)
+	// Actors spawned/destroyed: components that stay in the set are exported again too
+	if (bGPUWorldCollisionCacheDirty)
 	{
-		CachedGPUWorldCollisionPrimitives.Reset();
-		CachedGPUWorldCollisionBounds = QueryBounds;
-		CachedGPUWorldCollisionWorld = Params.World;
+		bWorldOverlapForceReexport = true;
 		bGPUWorldCollisionCacheDirty = false;
+	}
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(KawaiiFluidGPUWorldCollision), false);
+	QueryParams.bTraceComplex = false;
+	QueryParams.bReturnPhysicalMaterial = false;
+	if (Params.IgnoreActor.IsValid())
+	{
+		QueryParams.AddIgnoredActor(Params.IgnoreActor.Get());
+	}
+
+	// Query both WorldStatic and WorldDynamic
+	FCollisionObjectQueryParams ObjectQueryParams;
+	ObjectQueryParams.AddObjectTypesToQuery(ECC_WorldStatic);
+	ObjectQueryParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+
+	const FCollisionShape QueryShape = FCollisionShape::MakeBox(PaddedBounds.GetExtent());
+
+	if (!WorldOverlapCoveredBounds.IsValid)
+	{
+		// Nothing gathered yet in this world: query synchronously so the first frame has collision
+		TArray<FOverlapResult> Overlaps;
+		World->OverlapMultiByObjectType(Overlaps, PaddedBounds.GetCenter(), FQuat::Identity, ObjectQueryParams, QueryShape, QueryParams);
+		ResolveWorldOverlap(Overlaps, PaddedBounds);
+		return;
+	}
+
+	// Result is available next frame (one frame latency, no physics scene query on the game thread)
+	PendingWorldOverlapHandle = World->AsyncOverlapByObjectType(
+		PaddedBounds.GetCenter(), FQuat::Identity, ObjectQueryParams, QueryShape, QueryParams);
+	PendingWorldOverlapBounds = PaddedBounds;
+}
 
-		// Static boundary particle cache invalidation policy:
-		// - World changed: Full cache invalidation required (primitives may have moved/changed)
-		// - Bounds expanded: NO invalidation needed - existing cached particles remain valid
-		//   (StaticBoundaryManager uses per-primitive caching, so only NEW primitives
-		//    discovered in the expanded region will trigger generation)
-		// This optimization prevents 1+ second stalls every frame in Unlimited mode
-		if (bWorldChanged)
+void UKawaiiFluidSimulationContext::ResolveWorldOverlap(const TArray<FOverlapResult>& Overlaps, const FBox& Bounds)
+{
+	TSet<const UPrimitiveComponent*> UniqueComponents;
+	ResolvedWorldOverlapComponents.Reset();
+
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		const UPrimitiveComponent* PrimComp = Overlap.Component.Get();
+		if (!PrimComp || UniqueComponents.Contains(PrimComp))
 		{
-			bStaticBoundaryParticlesDirty = true;
-			bLandscapeHeightmapDirty = true;
+			continue;
 		}
-		// Note: bBoundsChanged alone no longer triggers bStaticBoundaryParticlesDirty
-		// StaticBoundaryManager handles caching internally
+		UniqueComponents.Add(PrimComp);
 
-		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(KawaiiFluidGPUWorldCollision), false);
-		QueryParams.bTraceComplex = false;
-		QueryParams.bReturnPhysicalMaterial = false;
-		if (Params.IgnoreActor.IsValid())
+		if (PrimComp->GetCollisionEnabled() == ECollisionEnabled::NoCollision)
 		{
-			QueryParams.AddIgnoredActor(Params.IgnoreActor.Get());
+			continue;
 		}
 
-		TArray<FOverlapResult> Overlaps;
-		const FVector QueryCenter = QueryBounds.GetCenter();
-		const FVector QueryExtent = QueryBounds.GetExtent();
+		// Allow both WorldStatic and WorldDynamic as World Collision targets
+		const ECollisionChannel ObjectType = PrimComp->GetCollisionObjectType();
+		if (ObjectType != ECC_WorldStatic && ObjectType != ECC_WorldDynamic)
+		{
+			continue;
+		}
 
-		// Query both WorldStatic and WorldDynamic
-		FCollisionObjectQueryParams ObjectQueryParams;
-		ObjectQueryParams.AddObjectTypesToQuery(ECC_WorldStatic);
-		ObjectQueryParams.AddObjectTypesToQuery(ECC_WorldDynamic);
-		
-		Params.World->OverlapMultiByObjectType(
-			Overlaps,
-			QueryCenter,
-			FQuat::Identity,
-			ObjectQueryParams,
-			FCollisionShape::MakeBox(QueryExtent),
-			QueryParams
-		);
+		ResolvedWorldOverlapComponents.Add(PrimComp);
+	}
+
+	WorldOverlapCoveredBounds = Bounds;
+	bWorldOverlapResultReady = true;
+}
 
-		TSet<const UPrimitiveComponent*> UniqueComponents;
-		int32 TotalOverlaps = Overlaps.Num();
-		int32 ValidStaticMeshCount = 0;
+void UKawaiiFluidSimulationContext::ExportWorldCollisionComponent(
+	const UPrimitiveComponent* PrimComp,
+	float DefaultFriction,
+	float DefaultRestitution,
+	bool bShouldLog,
+	FGPUCollisionPrimitives& OutPrimitives) const
+{
+	const AActor* Owner = PrimComp->GetOwner();
+	const int32 OwnerID = Owner ? Owner->GetUniqueID() : 0;
 
-		for (const FOverlapResult& Overlap : Overlaps)
+	// ISMC: Process each instance with its own world transform
+	const UInstancedStaticMeshComponent* ISMComp = Cast<UInstancedStaticMeshComponent>(PrimComp);
+	if (ISMComp)
+	{
+		const UStaticMesh* StaticMesh = ISMComp->GetStaticMesh();
+		const UBodySetup* BodySetup = StaticMesh ? StaticMesh->GetBodySetup() : nullptr;
+		if (!BodySetup)
 		{
-			const UPrimitiveComponent* PrimComp = Overlap.Component.Get();
-			if (!PrimComp || UniqueComponents.Contains(PrimComp))
-			{
-				continue;
-			}
-			UniqueComponents.Add(PrimComp);
+			return;
+		}
 
-			if (PrimComp->GetCollisionEnabled() == ECollisionEnabled::NoCollision)
-			{
-				continue;
-			}
+		const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+		if (AggGeom.SphereElems.Num() == 0 && AggGeom.SphylElems.Num() == 0 &&
+			AggGeom.BoxElems.Num() == 0 && AggGeom.ConvexElems.Num() == 0)
+		{
+			return;
+		}
+
+		const int32 InstanceCount = ISMComp->GetInstanceCount();
+		if (InstanceCount == 0)
+		{
+			return;
+		}
 
-			// Allow both WorldStatic and WorldDynamic as World Collision targets
-			const ECollisionChannel ObjectType = PrimComp->GetCollisionObjectType();
-			if (ObjectType != ECC_WorldStatic && ObjectType != ECC_WorldDynamic)
+		// Limit instance count to prevent GPU buffer overflow
+		const int32 EffectiveInstanceCount = FMath::Min(InstanceCount, MaxISMCInstancesForCollision);
+		if (InstanceCount > MaxISMCInstancesForCollision)
+		{
+			static std::atomic<int32> ISMCWarningLogCounter{0};
+			if (++ISMCWarningLogCounter % 300 == 1)
 			{
-				continue;
+				UE_LOG(LogTemp, Warning,
+					TEXT("[WorldCollision] ISMC '%s' has %d instances, limiting to %d for collision"),
+					*ISMComp->GetName(), InstanceCount, MaxISMCInstancesForCollision);
 			}
+		}
 
-			const AActor* Owner = PrimComp->GetOwner();
-
-			// Skip if this actor has FluidCollider (already processed, avoid duplicate collision)
-			if (Owner && FluidColliderOwners.Contains(Owner))
+		// Create collision primitives for each instance
+		for (int32 InstanceIndex = 0; InstanceIndex < EffectiveInstanceCount; ++InstanceIndex)
+		{
+			FTransform InstanceWorldTransform;
+			if (!ISMComp->GetInstanceTransform(InstanceIndex, InstanceWorldTransform, true))
 			{
 				continue;
 			}
 
-			// ISMC: Process each instance with its own world transform
-			const UInstancedStaticMeshComponent* ISMComp = Cast<UInstancedStaticMeshComponent>(PrimComp);
-			if (ISMComp)
-			{
-				const UStaticMesh* StaticMesh = ISMComp->GetStaticMesh();
-				const UBodySetup* BodySetup = StaticMesh ? StaticMesh->GetBodySetup() : nullptr;
-				if (!BodySetup)
-				{
-					continue;
-				}
+			AppendAggGeomToGPUPrimitives(
+				AggGeom,
+				InstanceWorldTransform,
+				DefaultFriction,
+				DefaultRestitution,
+				OwnerID,
+				OutPrimitives
+			);
+		}
 
-				const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
-				if (AggGeom.SphereElems.Num() == 0 && AggGeom.SphylElems.Num() == 0 &&
-					AggGeom.BoxElems.Num() == 0 && AggGeom.ConvexElems.Num() == 0)
-				{
-					continue;
-				}
+		// Debug logging (throttled)
+		if (bShouldLog)
+		{
+			UE_LOG(LogTemp, Log, TEXT("  [WorldCollision] ISMC: %s, Instances: %d (effective: %d)"),
+				*ISMComp->GetName(), InstanceCount, EffectiveInstanceCount);
+		}
 
-				const int32 InstanceCount = ISMComp->GetInstanceCount();
-				if (InstanceCount == 0)
-				{
-					continue;
-				}
+		return;
+	}
 
-				// Limit instance count to prevent GPU buffer overflow
-				const int32 EffectiveInstanceCount = FMath::Min(InstanceCount, MaxISMCInstancesForCollision);
-				if (InstanceCount > MaxISMCInstancesForCollision)
-				{
-					static int32 ISMCWarningLogCounter = 0;
-					if (++ISMCWarningLogCounter % 300 == 1)
-					{
-						UE_LOG(LogTemp, Warning,
-							TEXT("[WorldCollision] ISMC '%s' has %d instances, limiting to %d for collision"),
-							*ISMComp->GetName(), InstanceCount, MaxISMCInstancesForCollision);
-					}
-				}
+	// Regular StaticMeshComponent handling
+	const UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(PrimComp);
+	if (!StaticMeshComp)
+	{
+		return;
+	}
 
-				ValidStaticMeshCount++;
-				const int32 OwnerID = Owner ? Owner->GetUniqueID() : 0;
+	const UStaticMesh* StaticMesh = StaticMeshComp->GetStaticMesh();
+	const UBodySetup* BodySetup = StaticMesh ? StaticMesh->GetBodySetup() : nullptr;
+	if (!BodySetup)
+	{
+		return;
+	}
 
-				// Create collision primitives for each instance
-				for (int32 InstanceIndex = 0; InstanceIndex < EffectiveInstanceCount; ++InstanceIndex)
-				{
-					FTransform InstanceWorldTransform;
-					if (!ISMComp->GetInstanceTransform(InstanceIndex, InstanceWorldTransform, true))
-					{
-						continue;
-					}
+	const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+	if (AggGeom.SphereElems.Num() == 0 && AggGeom.SphylElems.Num() == 0 &&
+		AggGeom.BoxElems.Num() == 0 && AggGeom.ConvexElems.Num() == 0)
+	{
+		return;
+	}
 
-					AppendAggGeomToGPUPrimitives(
-						AggGeom,
-						InstanceWorldTransform,
-						DefaultFriction,
-						DefaultRestitution,
-						OwnerID,
-						CachedGPUWorldCollisionPrimitives
-					);
-				}
+	// Individual StaticMesh debug log
+	if (bShouldLog)
+	{
+		const FVector MeshLocation = StaticMeshComp->GetComponentLocation();
+		const FVector MeshScale = StaticMeshComp->GetComponentScale();
+		UE_LOG(LogTemp, Log, TEXT("  [WorldCollision] Mesh: %s, Owner: %s"),
+			*StaticMesh->GetName(),
+			Owner ? *Owner->GetName() : TEXT("None"));
+		UE_LOG(LogTemp, Log, TEXT("    Location: (%.1f, %.1f, %.1f), Scale: (%.2f, %.2f, %.2f)"),
+			MeshLocation.X, MeshLocation.Y, MeshLocation.Z,
+			MeshScale.X, MeshScale.Y, MeshScale.Z);
+		UE_LOG(LogTemp, Log, TEXT("    Collision: Spheres=%d, Capsules=%d, Boxes=%d, Convexes=%d"),
+			AggGeom.SphereElems.Num(), AggGeom.SphylElems.Num(),
+			AggGeom.BoxElems.Num(), AggGeom.ConvexElems.Num());
 
-				// Debug logging (throttled)
-				if (bShouldLog)
+		// Detailed primitive information
+		for (int32 i = 0; i < AggGeom.SphereElems.Num(); ++i)
+		{
+			const FKSphereElem& Sphere = AggGeom.SphereElems[i];
+			UE_LOG(LogTemp, Log, TEXT("      Sphere[%d]: Center=(%.1f, %.1f, %.1f), Radius=%.1f"),
+				i, Sphere.Center.X, Sphere.Center.Y, Sphere.Center.Z, Sphere.Radius);
+		}
+		for (int32 i = 0; i < AggGeom.BoxElems.Num(); ++i)
+		{
+			const FKBoxElem& Box = AggGeom.BoxElems[i];
+			UE_LOG(LogTemp, Log, TEXT("      Box[%d]: Center=(%.1f, %.1f, %.1f), Size=(%.1f, %.1f, %.1f)"),
+				i, Box.Center.X, Box.Center.Y, Box.Center.Z, Box.X, Box.Y, Box.Z);
+		}
+		for (int32 i = 0; i < AggGeom.ConvexElems.Num(); ++i)
+		{
+			const FKConvexElem& Convex = AggGeom.ConvexElems[i];
+			UE_LOG(LogTemp, Log, TEXT("      Convex[%d]: Vertices=%d, Indices=%d"),
+				i, Convex.VertexData.Num(), Convex.IndexData.Num());
+			if (Convex.VertexData.Num() > 0)
+			{
+				// Calculate bounding box
+				FBox ConvexBounds(ForceInit);
+				for (const FVector& V : Convex.VertexData)
 				{
-					UE_LOG(LogTemp, Log, TEXT("  [WorldCollision] ISMC: %s, Instances: %d (effective: %d)"),
-						*ISMComp->GetName(), InstanceCount, EffectiveInstanceCount);
+					ConvexBounds += V;
 				}
-
-				continue;  // Skip regular StaticMeshComponent handling below
+				UE_LOG(LogTemp, Log, TEXT("        LocalBounds: Min=(%.1f, %.1f, %.1f), Max=(%.1f, %.1f, %.1f)"),
+					ConvexBounds.Min.X, ConvexBounds.Min.Y, ConvexBounds.Min.Z,
+					ConvexBounds.Max.X, ConvexBounds.Max.Y, ConvexBounds.Max.Z);
 			}
+		}
+	}
 
-			// Regular StaticMeshComponent handling
-			const UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(PrimComp);
-			if (!StaticMeshComp)
-			{
-				continue;
-			}
+	AppendAggGeomToGPUPrimitives(
+		AggGeom,
+		StaticMeshComp->GetComponentTransform(),
+		DefaultFriction,
+		DefaultRestitution,
+		OwnerID,
+		OutPrimitives
+	);
+}
 
-			const UStaticMesh* StaticMesh = StaticMeshComp->GetStaticMesh();
-			const UBodySetup* BodySetup = StaticMesh ? StaticMesh->GetBodySetup() : nullptr;
-			if (!BodySetup)
+void UKawaiiFluidSimulationContext::AppendGPUWorldCollisionPrimitives(
+	FGPUCollisionPrimitives& OutPrimitives,
+	const FKawaiiFluidSimulationParams& Params,
+	const FBox& QueryBounds,
+	float DefaultFriction,
+	float DefaultRestitution,
+	const TSet<const AActor*>& FluidColliderOwners)
+{
+	// Diagnostic log (every 60 frames)
+	static std::atomic<int32> DiagLogCounter{0};  // Atomic: contexts prepare collision in parallel
+	const bool bShouldLog = (++DiagLogCounter % 60 == 1);
+
+	if (!Params.bUseWorldCollision)
+	{
+		if (bShouldLog)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[WorldCollision] SKIP: bUseWorldCollision=false"));
+		}
+		bGPUWorldCollisionCacheDirty = true;
+		return;
+	}
+
+	if (!Params.World)
+	{
+		if (bShouldLog)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[WorldCollision] SKIP: World is nullptr"));
+		}
+		bGPUWorldCollisionCacheDirty = true;
+		return;
+	}
+
+	if (!QueryBounds.IsValid)
+	{
+		if (bShouldLog)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[WorldCollision] SKIP: QueryBounds is invalid"));
+		}
+		return;
+	}
+
+	// Overlap results are produced by UpdateWorldOverlapQuery on the game thread
+	if (CachedGPUWorldCollisionWorld.Get() != Params.World)
+	{
+		if (bShouldLog)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[WorldCollision] SKIP: No overlap query issued for this world"));
+		}
+		return;
+	}
+
+	bool bPrimitivesChanged = CachedFluidColliderOwners.Num() != FluidColliderOwners.Num() ||
+		!CachedFluidColliderOwners.Includes(FluidColliderOwners);
+	int32 NumEntered = 0;
+	int32 NumLeft = 0;
+	int32 NumExported = 0;
+
+	// 1. Diff the latest overlap result against the persistent component set
+	if (bWorldOverlapResultReady)
+	{
+		bWorldOverlapResultReady = false;
+
+		TSet<TWeakObjectPtr<const UPrimitiveComponent>> ResolvedSet;
+		ResolvedSet.Append(ResolvedWorldOverlapComponents);
+
+		// Leaving (or force re-export after actors spawned/destroyed)
+		for (auto It = WorldCollisionComponents.CreateIterator(); It; ++It)
+		{
+			if (bWorldOverlapForceReexport || !ResolvedSet.Contains(It.Key()))
 			{
-				continue;
+				It.RemoveCurrent();
+				++NumLeft;
 			}
+		}
+		bWorldOverlapForceReexport = false;
 
-			const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
-			if (AggGeom.SphereElems.Num() == 0 && AggGeom.SphylElems.Num() == 0 &&
-				AggGeom.BoxElems.Num() == 0 && AggGeom.ConvexElems.Num() == 0)
+		// Entering: exported below
+		for (const TWeakObjectPtr<const UPrimitiveComponent>& Component : ResolvedWorldOverlapComponents)
+		{
+			if (!WorldCollisionComponents.Contains(Component))
 			{
-				continue;
+				WorldCollisionComponents.Add(Component);
+				++NumEntered;
 			}
+		}
+	}
+
+	// 2. Export entering components and re-export ones that moved (or changed ISMC instance count)
+	for (auto It = WorldCollisionComponents.CreateIterator(); It; ++It)
+	{
+		const UPrimitiveComponent* PrimComp = It.Key().Get();
+		if (!PrimComp)
+		{
+			It.RemoveCurrent();
+			++NumLeft;
+			continue;
+		}
+
+		FWorldCollisionComponentEntry& Entry = It.Value();
+		const UInstancedStaticMeshComponent* ISMComp = Cast<UInstancedStaticMeshComponent>(PrimComp);
+		const int32 InstanceCount = ISMComp ? ISMComp->GetInstanceCount() : 0;
+		const FTransform& ComponentTransform = PrimComp->GetComponentTransform();
+
+		if (Entry.bExported && Entry.InstanceCount == InstanceCount &&
+			Entry.Transform.Equals(ComponentTransform, GPUWorldTransformTolerance))
+		{
+			continue;
+		}
 
-			ValidStaticMeshCount++;
+		Entry.Primitives.Reset();
+		ExportWorldCollisionComponent(PrimComp, DefaultFriction, DefaultRestitution, bShouldLog, Entry.Primitives);
+		Entry.Transform = ComponentTransform;
+		Entry.InstanceCount = InstanceCount;
+		Entry.Owner = PrimComp->GetOwner();
+		Entry.bExported = true;
+		++NumExported;
+	}
+
+	bPrimitivesChanged |= (NumLeft > 0 || NumExported > 0);
 
-			// Individual StaticMesh debug log
-			if (bShouldLog)
+	// 3. Rebuild the concatenated primitive list only when the set changed
+	if (bPrimitivesChanged)
+	{
+		CachedGPUWorldCollisionPrimitives.Reset();
+		for (const TPair<TWeakObjectPtr<const UPrimitiveComponent>, FWorldCollisionComponentEntry>& Pair : WorldCollisionComponents)
+		{
+			// Skip if this actor has FluidCollider (already processed, avoid duplicate collision)
+			const AActor* Owner = Pair.Value.Owner.Get();
+			if (Owner && FluidColliderOwners.Contains(Owner))
 			{
-				const FVector MeshLocation = StaticMeshComp->GetComponentLocation();
-				const FVector MeshScale = StaticMeshComp->GetComponentScale();
-				UE_LOG(LogTemp, Log, TEXT("  [WorldCollision] Mesh: %s, Owner: %s"),
-					*StaticMesh->GetName(),
-					Owner ? *Owner->GetName() : TEXT("None"));
-				UE_LOG(LogTemp, Log, TEXT("    Location: (%.1f, %.1f, %.1f), Scale: (%.2f, %.2f, %.2f)"),
-					MeshLocation.X, MeshLocation.Y, MeshLocation.Z,
-					MeshScale.X, MeshScale.Y, MeshScale.Z);
-				UE_LOG(LogTemp, Log, TEXT("    Collision: Spheres=%d, Capsules=%d, Boxes=%d, Convexes=%d"),
-					AggGeom.SphereElems.Num(), AggGeom.SphylElems.Num(),
-					AggGeom.BoxElems.Num(), AggGeom.ConvexElems.Num());
-
-				// Detailed primitive information
-				for (int32 i = 0; i < AggGeom.SphereElems.Num(); ++i)
-				{
-					const FKSphereElem& Sphere = AggGeom.SphereElems[i];
-					UE_LOG(LogTemp, Log, TEXT("      Sphere[%d]: Center=(%.1f, %.1f, %.1f), Radius=%.1f"),
-						i, Sphere.Center.X, Sphere.Center.Y, Sphere.Center.Z, Sphere.Radius);
-				}
-				for (int32 i = 0; i < AggGeom.BoxElems.Num(); ++i)
-				{
-					const FKBoxElem& Box = AggGeom.BoxElems[i];
-					UE_LOG(LogTemp, Log, TEXT("      Box[%d]: Center=(%.1f, %.1f, %.1f), Size=(%.1f, %.1f, %.1f)"),
-						i, Box.Center.X, Box.Center.Y, Box.Center.Z, Box.X, Box.Y, Box.Z);
-				}
-				for (int32 i = 0; i < AggGeom.ConvexElems.Num(); ++i)
-				{
-					const FKConvexElem& Convex = AggGeom.ConvexElems[i];
-					UE_LOG(LogTemp, Log, TEXT("      Convex[%d]: Vertices=%d, Indices=%d"),
-						i, Convex.VertexData.Num(), Convex.IndexData.Num());
-					if (Convex.VertexData.Num() > 0)
-					{
-						// Calculate bounding box
-						FBox ConvexBounds(ForceInit);
-						for (const FVector& V : Convex.VertexData)
-						{
-							ConvexBounds += V;
-						}
-						UE_LOG(LogTemp, Log, TEXT("        LocalBounds: Min=(%.1f, %.1f, %.1f), Max=(%.1f, %.1f, %.1f)"),
-							ConvexBounds.Min.X, ConvexBounds.Min.Y, ConvexBounds.Min.Z,
-							ConvexBounds.Max.X, ConvexBounds.Max.Y, ConvexBounds.Max.Z);
-					}
-				}
+				continue;
 			}
 
-			const int32 OwnerID = Owner ? Owner->GetUniqueID() : 0;
-			AppendAggGeomToGPUPrimitives(
-				AggGeom,
-				StaticMeshComp->GetComponentTransform(),
-				DefaultFriction,
-				DefaultRestitution,
-				OwnerID,
-				CachedGPUWorldCollisionPrimitives
-			);
+			AppendCollisionPrimitives(Pair.Value.Primitives, CachedGPUWorldCollisionPrimitives);
 		}
+		CachedFluidColliderOwners = FluidColliderOwners;
+		++GPUWorldCollisionCacheRevision;
 
 		// Log output (only on cache refresh, every 60 frames)
-		static int32 WorldCollisionLogCounter = 0;
+		static std::atomic<int32> WorldCollisionLogCounter{0};
 		if (++WorldCollisionLogCounter % 60 == 1)
 		{
+			const FVector CoveredCenter = WorldOverlapCoveredBounds.GetCenter();
+			const FVector CoveredExtent = WorldOverlapCoveredBounds.GetExtent();
 			UE_LOG(LogTemp, Log, TEXT("========== GPU World Collision Cache Updated =========="));
-			UE_LOG(LogTemp, Log, TEXT("  Query Bounds: Center=(%.1f, %.1f, %.1f) Extent=(%.1f, %.1f, %.1f)"),
-				QueryCenter.X, QueryCenter.Y, QueryCenter.Z,
-				QueryExtent.X, QueryExtent.Y, QueryExtent.Z);
-			UE_LOG(LogTemp, Log, TEXT("  Overlaps Found: %d (Unique Components: %d)"),
-				TotalOverlaps, UniqueComponents.Num());
-			UE_LOG(LogTemp, Log, TEXT("  Valid StaticMeshes with Simple Collision: %d"), ValidStaticMeshCount);
+			UE_LOG(LogTemp, Log, TEXT("  Covered Bounds: Center=(%.1f, %.1f, %.1f) Extent=(%.1f, %.1f, %.1f)"),
+				CoveredCenter.X, CoveredCenter.Y, CoveredCenter.Z,
+				CoveredExtent.X, CoveredExtent.Y, CoveredExtent.Z);
+			UE_LOG(LogTemp, Log, TEXT("  Components: %d (Entered: %d, Left: %d, Exported: %d)"),
+				WorldCollisionComponents.Num(), NumEntered, NumLeft, NumExported);
 			UE_LOG(LogTemp, Log, TEXT("  Cached Primitives: Spheres=%d, Capsules=%d, Boxes=%d, Convexes=%d"),
 				CachedGPUWorldCollisionPrimitives.Spheres.Num(),
 				CachedGPUWorldCollisionPrimitives.Capsules.Num(),
@@ -1744,23 +2190,7 @@ void UKawaiiFluidSimulationContext::AppendGPUWorldCollisionPrimitives(
 		}
 	}
 
-	if (CachedGPUWorldCollisionPrimitives.IsEmpty())
-	{
-		return;
-	}
-
-	const int32 PlaneOffset = OutPrimitives.ConvexPlanes.Num();
-	OutPrimitives.Spheres.Append(CachedGPUWorldCollisionPrimitives.Spheres);
-	OutPrimitives.Capsules.Append(CachedGPUWorldCollisionPrimitives.Capsules);
-	OutPrimitives.Boxes.Append(CachedGPUWorldCollisionPrimitives.Boxes);
-	OutPrimitives.ConvexPlanes.Append(CachedGPUWorldCollisionPrimitives.ConvexPlanes);
-
-	for (const FGPUCollisionConvex& CachedConvex : CachedGPUWorldCollisionPrimitives.Convexes)
-	{
-		FGPUCollisionConvex Convex = CachedConvex;
-		Convex.PlaneStartIndex += PlaneOffset;
-		OutPrimitives.Convexes.Add(Convex);
-	}
+	AppendCollisionPrimitives(CachedGPUWorldCollisionPrimitives, OutPrimitives);
 }
 
 void UKawaiiFluidSimulationContext::HandleCollisions(
@@ -1835,10 +2265,10 @@ void UKawaiiFluidSimulationContext::HandleWorldCollision_Sweep(
 	{
 		FVector CellCenter;
 		FVector CellExtent;
-		TArray<int32> ParticleIndices;
+		TKawaiiFluidFrameArray<int32> ParticleIndices;
 	};
 
-	TArray<FCellQueryData> CellQueries;
+	TKawaiiFluidFrameArray<FCellQueryData> CellQueries;
 	CellQueries.Reserve(Grid.Num());
 
 	for (const auto& Pair : Grid)
@@ -1846,12 +2276,12 @@ void UKawaiiFluidSimulationContext::HandleWorldCollision_Sweep(
 		FCellQueryData CellData;
 		CellData.CellCenter = FVector(Pair.Key) * CellSize + FVector(CellSize * 0.5f);
 		CellData.CellExtent = FVector(CellSize * 0.5f);
-		CellData.ParticleIndices = Pair.Value;
+		CellData.ParticleIndices.Append(Pair.Value);
 		CellQueries.Add(MoveTemp(CellData));
 	}
 
 	// Cell overlap check - parallel
-	TArray<uint8> CellCollisionResults;
+	TKawaiiFluidFrameArray<uint8> CellCollisionResults;
 	CellCollisionResults.SetNumZeroed(CellQueries.Num());
 
 	ParallelFor(CellQueries.Num(), [&](int32 CellIdx)
@@ -1866,7 +2296,7 @@ void UKawaiiFluidSimulationContext::HandleWorldCollision_Sweep(
 	});
 
 	// Collect collision candidates
-	TArray<int32> CollisionParticleIndices;
+	TKawaiiFluidFrameArray<int32> CollisionParticleIndices;
 	CollisionParticleIndices.Reserve(Particles.Num());
 
 	for (int32 CellIdx = 0; CellIdx < CellQueries.Num(); ++CellIdx)
@@ -1967,7 +2397,7 @@ void UKawaiiFluidSimulationContext::HandleWorldCollision_Sweep(
 					if (Speed >= Params.MinVelocityForEvent)
 					{
 						FKawaiiFluidCollisionEvent Event;
-						Event.ParticleIndex = Particle.ParticleID;
+						Event.ParticleID = Particle.ParticleID;
 						Event.SourceID = Particle.SourceID;
 						Event.ColliderOwnerID = HitResult.GetActor() ? HitResult.GetActor()->GetUniqueID() : -1;
 						Event.BoneIndex = -1;  // CPU path doesn't have bone info
@@ -1989,11 +2419,7 @@ void UKawaiiFluidSimulationContext::HandleWorldCollision_Sweep(
 					AActor* HitActor = HitResult.GetActor();
 					if (HitActor != Particle.AttachedActor.Get())
 					{
-						Particle.bIsAttached = false;
-						Particle.AttachedActor.Reset();
-						Particle.AttachedBoneName = NAME_None;
-						Particle.AttachedLocalOffset = FVector::ZeroVector;
-						Particle.AttachedSurfaceNormal = FVector::UpVector;
+						Particle.ClearAttachment();
 					}
 				}
 			}
@@ -2012,11 +2438,7 @@ void UKawaiiFluidSimulationContext::HandleWorldCollision_Sweep(
 
 				if (bNearFloor && FloorHit.GetActor() != Particle.AttachedActor.Get())
 				{
-					Particle.bIsAttached = false;
-					Particle.AttachedActor.Reset();
-					Particle.AttachedBoneName = NAME_None;
-					Particle.AttachedLocalOffset = FVector::ZeroVector;
-					Particle.AttachedSurfaceNormal = FVector::UpVector;
+					Particle.ClearAttachment();
 				}
 			}
 		});
@@ -2058,11 +2480,7 @@ void UKawaiiFluidSimulationContext::HandleWorldCollision_Sweep(
 
 		if (bNearFloor && FloorHit.Distance <= FloorDetachDistance)
 		{
-			Particle.bIsAttached = false;
-			Particle.AttachedActor.Reset();
-			Particle.AttachedBoneName = NAME_None;
-			Particle.AttachedLocalOffset = FVector::ZeroVector;
-			Particle.AttachedSurfaceNormal = FVector::UpVector;
+			Particle.ClearAttachment();
 			Particle.bJustDetached = true;
 		}
 	}
@@ -2072,6 +2490,108 @@ void UKawaiiFluidSimulationContext::HandleWorldCollision_Sweep(
 // SDF-based World Collision (Overlap + ClosestPoint)
 //========================================
 
+bool UKawaiiFluidSimulationContext::UpdateWorldSDFCache(const FKawaiiFluidSimulationParams& Params, const TArray<FFluidParticle>& Particles)
+{
+	FBox ParticleBounds(ForceInit);
+	for (const FFluidParticle& Particle : Particles)
+	{
+		ParticleBounds += Particle.PredictedPosition;
+	}
+	if (!ParticleBounds.IsValid)
+	{
+		return false;
+	}
+
+	// FluidCollider owners are handled by the collider pass (same exclusion as the GPU path)
+	TSet<const AActor*> FluidColliderOwners;
+	for (const UKawaiiFluidCollider* Collider : Params.Colliders)
+	{
+		if (Collider && Collider->GetOwner())
+		{
+			FluidColliderOwners.Add(Collider->GetOwner());
+		}
+	}
+
+	// Same channel-based gather as the GPU path (re-queried only when the region leaves the covered box)
+	UpdateWorldOverlapQuery(Params, SnapWorldSDFRegion(ParticleBounds));
+	return UpdateWorldSDFCache(Params, ParticleBounds, 0.0f, 0.0f, FluidColliderOwners);
+}
+
+FBox UKawaiiFluidSimulationContext::SnapWorldSDFRegion(const FBox& Bounds)
+{
+	// Snap outward so the region (and the world primitive cache) only changes when particles travel far
+	const double Snap = WorldSDFRegionSnap;
+	const FVector RegionMin(
+		FMath::FloorToDouble(Bounds.Min.X / Snap - 0.5) * Snap,
+		FMath::FloorToDouble(Bounds.Min.Y / Snap - 0.5) * Snap,
+		FMath::FloorToDouble(Bounds.Min.Z / Snap - 0.5) * Snap);
+	const FVector RegionMax(
+		FMath::CeilToDouble(Bounds.Max.X / Snap + 0.5) * Snap,
+		FMath::CeilToDouble(Bounds.Max.Y / Snap + 0.5) * Snap,
+		FMath::CeilToDouble(Bounds.Max.Z / Snap + 0.5) * Snap);
+	return FBox(RegionMin, RegionMax);
+}
+
+bool UKawaiiFluidSimulationContext::UpdateWorldSDFCache(
+	const FKawaiiFluidSimulationParams& Params,
+	const FBox& Bounds,
+	float DefaultFriction,
+	float DefaultRestitution,
+	const TSet<const AActor*>& FluidColliderOwners)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_UpdateWorldSDFCache);
+
+	if (!Bounds.IsValid)
+	{
+		return false;
+	}
+
+	const FBox Region = SnapWorldSDFRegion(Bounds);
+	WorldSDFGatherScratch.Reset();
+	AppendGPUWorldCollisionPrimitives(WorldSDFGatherScratch, Params, Region, DefaultFriction, DefaultRestitution, FluidColliderOwners);
+
+	if (WorldSDFSourceRevision != GPUWorldCollisionCacheRevision)
+	{
+		// Only owners whose shapes changed dirty their bricks
+		WorldSDFCache.SetClipBounds(Region);
+		WorldSDFCache.SyncFromPrimitives(CachedGPUWorldCollisionPrimitives);
+		WorldSDFSourceRevision = GPUWorldCollisionCacheRevision;
+
+		// Primitive OwnerID is the owning actor's UniqueID
+		WorldSDFOwnerActors.Reset();
+		for (const TPair<TWeakObjectPtr<const UPrimitiveComponent>, FWorldCollisionComponentEntry>& Pair : WorldCollisionComponents)
+		{
+			const UPrimitiveComponent* PrimComp = Pair.Key.Get();
+			AActor* Owner = PrimComp ? PrimComp->GetOwner() : nullptr;
+			if (Owner)
+			{
+				WorldSDFOwnerActors.Add(Owner->GetUniqueID(), Owner);
+			}
+		}
+	}
+
+	WorldSDFCache.ApplyCompletedBuild();
+	WorldSDFCache.KickAsyncBuild();
+
+	return !WorldSDFCache.IsBuildInProgress() && WorldSDFCache.GetNumDirtyBricks() == 0;
+}
+
+void UKawaiiFluidSimulationContext::UploadWorldSDFBricks()
+{
+	if (!GPUSimulator.IsValid() || (bWorldSDFBricksUploaded && WorldSDFUploadedRevision == WorldSDFCache.GetBrickRevision()))
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(SimGPU_Upload_SDFBricks);
+	FKawaiiFluidSDFBrickData BrickData;
+	WorldSDFCache.ExportBrickData(BrickData);
+	GPUSimulator->UploadSDFBricks(MoveTemp(BrickData));
+
+	WorldSDFUploadedRevision = WorldSDFCache.GetBrickRevision();
+	bWorldSDFBricksUploaded = true;
+}
+
 void UKawaiiFluidSimulationContext::HandleWorldCollision_SDF(
 	TArray<FFluidParticle>& Particles,
 	const FKawaiiFluidSimulationParams& Params,
@@ -2087,6 +2607,56 @@ void UKawaiiFluidSimulationContext::HandleWorldCollision_SDF(
 		return;
 	}
 
+	// Baked SDF path: one trilinear lookup per particle (overlap queries below cover the build time)
+	if (Params.bUseWorldSDFCache && UpdateWorldSDFCache(Params, Particles))
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_WorldCollisionSDFCache);
+
+		const float CollisionMargin = ParticleRadius * 1.1f;
+		const float FloorDetachDistance = 5.0f;
+		const float FloorNearDistance = 20.0f;
+
+		ParallelFor(Particles.Num(), [&](int32 i)
+		{
+			FFluidParticle& Particle = Particles[i];
+
+			float Distance;
+			FVector Normal;
+			int32 OwnerID;
+			if (WorldSDFCache.Sample(Particle.PredictedPosition, Distance, Normal, OwnerID) && Distance < CollisionMargin)
+			{
+				const TWeakObjectPtr<AActor>* Owner = WorldSDFOwnerActors.Find(OwnerID);
+				AActor* HitActor = Owner ? Owner->Get() : nullptr;
+
+				const FVector SurfacePoint = Particle.PredictedPosition - Normal * Distance;
+				ApplyWorldCollisionResponse(Particle, Params, Normal, CollisionMargin - Distance,
+					SurfacePoint, HitActor, SubstepDT, Friction, Restitution);
+			}
+
+			// Floor detachment: static geometry within reach of an attached particle
+			if (!Particle.bIsAttached)
+			{
+				Particle.bNearGround = false;
+				return;
+			}
+
+			// Downward query like the sweep path's line trace (walls beside the particle don't count),
+			// passing through the actor the particle is attached to
+			const AActor* AttachedActor = Particle.AttachedActor.Get();
+			const int32 AttachedActorID = AttachedActor ? static_cast<int32>(AttachedActor->GetUniqueID()) : INDEX_NONE;
+			float FloorDistance;
+			int32 FloorOwnerID;
+			Particle.bNearGround = WorldSDFCache.Raycast(Particle.Position, -FVector::UpVector, FloorNearDistance,
+				AttachedActorID, FloorDistance, FloorOwnerID);
+			if (Particle.bNearGround && FloorDistance <= FloorDetachDistance)
+			{
+				Particle.ClearAttachment();
+				Particle.bJustDetached = true;
+			}
+		});
+		return;
+	}
+
 	const float CellSize = SpatialHash.GetCellSize();
 	const auto& Grid = SpatialHash.GetGrid();
 
@@ -2103,10 +2673,10 @@ void UKawaiiFluidSimulationContext::HandleWorldCollision_SDF(
 	{
 		FVector CellCenter;
 		FVector CellExtent;
-		TArray<int32> ParticleIndices;
+		TKawaiiFluidFrameArray<int32> ParticleIndices;
 	};
 
-	TArray<FCellQueryData> CellQueries;
+	TKawaiiFluidFrameArray<FCellQueryData> CellQueries;
 	CellQueries.Reserve(Grid.Num());
 
 	for (const auto& Pair : Grid)
@@ -2114,12 +2684,12 @@ void UKawaiiFluidSimulationContext::HandleWorldCollision_SDF(
 		FCellQueryData CellData;
 		CellData.CellCenter = FVector(Pair.Key) * CellSize + FVector(CellSize * 0.5f);
 		CellData.CellExtent = FVector(CellSize * 0.5f);
-		CellData.ParticleIndices = Pair.Value;
+		CellData.ParticleIndices.Append(Pair.Value);
 		CellQueries.Add(MoveTemp(CellData));
 	}
 
 	// Cell overlap check - parallel
-	TArray<uint8> CellCollisionResults;
+	TKawaiiFluidFrameArray<uint8> CellCollisionResults;
 	CellCollisionResults.SetNumZeroed(CellQueries.Num());
 
 	ParallelFor(CellQueries.Num(), [&](int32 CellIdx)
@@ -2134,7 +2704,7 @@ void UKawaiiFluidSimulationContext::HandleWorldCollision_SDF(
 	});
 
 	// Collect collision candidates
-	TArray<int32> CollisionParticleIndices;
+	TKawaiiFluidFrameArray<int32> CollisionParticleIndices;
 	CollisionParticleIndices.Reserve(Particles.Num());
 
 	for (int32 CellIdx = 0; CellIdx < CellQueries.Num(); ++CellIdx)
@@ -2257,79 +2827,8 @@ void UKawaiiFluidSimulationContext::HandleWorldCollision_SDF(
 			// Apply collision response if within margin
 			if (MinSignedDistance < CollisionMargin)
 			{
-				// Push particle to surface + margin
-				float Penetration = CollisionMargin - MinSignedDistance;
-				FVector CollisionPos = Particle.PredictedPosition + BestNormal * Penetration;
-
-				// Only modify PredictedPosition
-				Particle.PredictedPosition = CollisionPos;
-
-				// Calculate desired velocity after collision response
-				// Initialize to zero - particle stops on surface by default
-				FVector DesiredVelocity = FVector::ZeroVector;
-				float VelDotNormal = FVector::DotProduct(Particle.Velocity, BestNormal);
-
-				// Minimum velocity threshold for applying restitution bounce
-				// Prevents "popcorn" oscillation for particles resting on surfaces
-				const float MinBounceVelocity = 50.0f;  // cm/s
-
-				if (VelDotNormal < 0.0f)
-				{
-					// Particle moving INTO surface - apply collision response
-					FVector VelNormal = BestNormal * VelDotNormal;
-					FVector VelTangent = Particle.Velocity - VelNormal;
-
-					if (VelDotNormal < -MinBounceVelocity)
-					{
-						// Significant impact - apply full collision response
-						// Normal: reflect with Restitution (0 = stick, 1 = perfect bounce)
-						// Tangent: dampen with Friction (0 = slide, 1 = stop)
-						DesiredVelocity = VelTangent * (1.0f - Friction) - VelNormal * Restitution;
-					}
-					else
-					{
-						// Low velocity contact (resting on surface) - no bounce, just slide
-						DesiredVelocity = VelTangent * (1.0f - Friction);
-					}
-				}
-				// else: VelDotNormal >= 0 means particle moving AWAY from surface
-				// DesiredVelocity stays zero - particle stops on surface (same as OLD behavior)
-
-				// Back-calculate Position so FinalizePositions derives DesiredVelocity
-				Particle.Position = Particle.PredictedPosition - DesiredVelocity * SubstepDT;
-
-				// Add to collision event buffer (processed later in ProcessCollisionFeedback)
-				if (Params.bEnableCollisionEvents && Params.CPUCollisionFeedbackBufferPtr && Params.CPUCollisionFeedbackLockPtr)
-				{
-					const float Speed = Particle.Velocity.Size();
-					if (Speed >= Params.MinVelocityForEvent)
-					{
-						FKawaiiFluidCollisionEvent Event;
-						Event.ParticleIndex = Particle.ParticleID;
-						Event.SourceID = Particle.SourceID;
-						Event.ColliderOwnerID = HitActor ? HitActor->GetUniqueID() : -1;
-						Event.BoneIndex = -1;  // CPU path doesn't have bone info
-						Event.HitActor = HitActor;
-						Event.HitLocation = BestClosestPoint;
-						Event.HitNormal = BestNormal;
-						Event.HitSpeed = Speed;
-						// HitInteractionComponent is looked up in ProcessCollisionFeedback
-
-						// Add to buffer (thread-safe)
-						FScopeLock Lock(Params.CPUCollisionFeedbackLockPtr);
-						Params.CPUCollisionFeedbackBufferPtr->Add(Event);
-					}
-				}
-
-				// Detach from character if hitting different surface
-				if (Particle.bIsAttached && HitActor != Particle.AttachedActor.Get())
-				{
-					Particle.bIsAttached = false;
-					Particle.AttachedActor.Reset();
-					Particle.AttachedBoneName = NAME_None;
-					Particle.AttachedLocalOffset = FVector::ZeroVector;
-					Particle.AttachedSurfaceNormal = FVector::UpVector;
-				}
+				ApplyWorldCollisionResponse(Particle, Params, BestNormal, CollisionMargin - MinSignedDistance,
+					BestClosestPoint, HitActor, SubstepDT, Friction, Restitution);
 			}
 		});
 	});
@@ -2370,16 +2869,41 @@ void UKawaiiFluidSimulationContext::HandleWorldCollision_SDF(
 
 		if (bNearFloor && FloorHit.Distance <= FloorDetachDistance)
 		{
-			Particle.bIsAttached = false;
-			Particle.AttachedActor.Reset();
-			Particle.AttachedBoneName = NAME_None;
-			Particle.AttachedLocalOffset = FVector::ZeroVector;
-			Particle.AttachedSurfaceNormal = FVector::UpVector;
+			Particle.ClearAttachment();
 			Particle.bJustDetached = true;
 		}
 	}
 }
 
+void UKawaiiFluidSimulationContext::HandleBoundsCollision(
+	TArray<FFluidParticle>& Particles,
+	const FKawaiiFluidSimulationParams& Params,
+	float ParticleRadius)
+{
+	const FVector Min = Params.WorldBounds.Min + FVector(ParticleRadius);
+	const FVector Max = Params.WorldBounds.Max - FVector(ParticleRadius);
+	const float Friction = FMath::Clamp(Params.BoundsFriction, 0.0f, 1.0f);
+	const float Restitution = FMath::Clamp(Params.BoundsRestitution, 0.0f, 1.0f);
+
+	ParallelFor(Particles.Num(), [&](int32 i)
+	{
+		FFluidParticle& Particle = Particles[i];
+		const FVector Clamped = Particle.PredictedPosition.BoundToBox(Min, Max);
+		if (Clamped == Particle.PredictedPosition)
+		{
+			return;
+		}
+
+		// Contact: the penetration is mirrored back scaled by restitution (0 = inelastic),
+		// the tangential motion damped by friction
+		const FVector Penetration = Clamped - Particle.PredictedPosition;
+		const FVector Normal = Penetration.GetSafeNormal();
+		const FVector Move = Clamped - Particle.Position;
+		const FVector Tangential = Move - Normal * FVector::DotProduct(Move, Normal);
+		Particle.PredictedPosition = (Clamped - Tangential * Friction + Penetration * Restitution).BoundToBox(Min, Max);
+	});
+}
+
 void UKawaiiFluidSimulationContext::FinalizePositions(
 	TArray<FFluidParticle>& Particles,
 	float DeltaTime)
@@ -2394,13 +2918,41 @@ void UKawaiiFluidSimulationContext::FinalizePositions(
 	});
 }
 
+void UKawaiiFluidSimulationContext::PackCompactParticles(
+	const TArray<FFluidParticle>& Particles,
+	const UKawaiiFluidPresetDataAsset* Preset)
+{
+	if (!CompactParticles.IsValid())
+	{
+		return;
+	}
+
+	// Only worth a pass when a reader runs this substep; viscosity only changes velocities,
+	// so surface classification still reads current positions from the same copy
+	const bool bViscosity = ViscositySolver.IsValid() && Preset->Viscosity > 0.0f;
+	const bool bSurface = GFluidCPUSurfaceDetection != 0 && SurfaceDetector.IsValid();
+	if (GFluidCPUCompactLayout == 0 || !(bViscosity || bSurface)
+		|| !CompactParticles->Load(Particles, Preset->SmoothingRadius))
+	{
+		// Readers fall back to their own float snapshots
+		CompactParticles->Invalidate();
+	}
+}
+
 void UKawaiiFluidSimulationContext::ApplyViscosity(
 	TArray<FFluidParticle>& Particles,
 	const UKawaiiFluidPresetDataAsset* Preset)
 {
 if (ViscositySolver.IsValid() && Preset->Viscosity > 0.0f)
 	{
-		ViscositySolver->ApplyXSPH(Particles, Preset->Viscosity, Preset->SmoothingRadius);
+		if (CompactParticles.IsValid() && CompactParticles->IsValidFor(Particles.Num()))
+		{
+			ViscositySolver->ApplyXSPH(Particles, *CompactParticles, Preset->Viscosity, Preset->SmoothingRadius);
+		}
+		else
+		{
+			ViscositySolver->ApplyXSPH(Particles, Preset->Viscosity, Preset->SmoothingRadius);
+		}
 	}
 }
 
@@ -2413,16 +2965,43 @@ void UKawaiiFluidSimulationContext::ApplyAdhesion(
 	// All adhesion is now handled by GPU boundary particle system (FluidApplyViscosity.usf)
 }
 
+void UKawaiiFluidSimulationContext::ClassifySurface(
+	TArray<FFluidParticle>& Particles,
+	const UKawaiiFluidPresetDataAsset* Preset)
+{
+	if (GFluidCPUSurfaceDetection == 0 || !SurfaceDetector.IsValid())
+	{
+		return;
+	}
+
+	// Same neighbor threshold the GPU surface tension pass uses to scale surface particles
+	FSurfaceDetectorSettings Settings;
+	Settings.SmoothingRadius = Preset->SmoothingRadius;
+	Settings.NeighborThreshold = Preset->SurfaceTensionSurfaceThreshold;
+	if (CompactParticles.IsValid() && CompactParticles->IsValidFor(Particles.Num()))
+	{
+		SurfaceDetector->Classify(Particles, *CompactParticles, Settings);
+	}
+	else
+	{
+		SurfaceDetector->Classify(Particles, Settings);
+	}
+}
+
 void UKawaiiFluidSimulationContext::ApplyCohesion(
 	TArray<FFluidParticle>& Particles,
 	const UKawaiiFluidPresetDataAsset* Preset)
 {
 if (AdhesionSolver.IsValid() && Preset->SurfaceTension > 0.0f)
 	{
+		// Interior particles are pulled evenly from all sides, so only the surface gets a net force
+		const bool bSurfaceOnly = GFluidCPUSurfaceDetection != 0 && SurfaceDetector.IsValid();
 		AdhesionSolver->ApplyCohesion(
 			Particles,
 			Preset->SurfaceTension,
-			Preset->SmoothingRadius
+			Preset->SmoothingRadius,
+			GetKernelTable(Preset),
+			bSurfaceOnly ? &SurfaceDetector->GetSurfaceIndices() : nullptr
 		);
 	}
 }
@@ -2633,7 +3212,7 @@ void UKawaiiFluidSimulationContext::UpdateLandscapeHeightmapCollision(
 	}
 
 	// Only rebuild if dirty (level load, world changed, etc.)
-	// Note: bLandscapeHeightmapDirty is set by AppendGPUWorldCollisionPrimitives when world changes
+	// Note: bLandscapeHeightmapDirty is set by UpdateWorldOverlapQuery when world changes
 	if (!bLandscapeHeightmapDirty)
 	{
 		// Already uploaded, just ensure it's enabled
@@ -2702,3 +3281,127 @@ void UKawaiiFluidSimulationContext::UpdateLandscapeHeightmapCollision(
 
 	bLandscapeHeightmapDirty = false;
 }
+
+//=============================================================================
+// Particle LOD
+//=============================================================================
+
+FKawaiiFluidParticleLODStats UKawaiiFluidSimulationContext::UpdateParticleLOD(
+	TConstArrayView<FVector> ViewPoints,
+	const FKawaiiFluidParticleLODSettings& Settings)
+{
+	FKawaiiFluidParticleLODStats Stats;
+
+	FGPUFluidSimulator* Simulator = GPUSimulator.Get();
+	FGPUSpawnManager* SpawnManager = Simulator ? Simulator->GetSpawnManager() : nullptr;
+	if (!SpawnManager || !Simulator->IsReady() || ViewPoints.Num() == 0)
+	{
+		return Stats;
+	}
+
+	// Velocities are only read back with the full readback (as for ISM rendering)
+	Simulator->SetFullReadbackEnabled(true);
+
+	TArray<FVector3f> Positions;
+	TArray<FVector3f> Velocities;
+	TArray<int32> ParticleIDs;
+	TArray<int32> SourceIDs;
+	if (!Simulator->GetParticlePositionsAndIDs(Positions, ParticleIDs, SourceIDs, &Velocities) ||
+		ParticleIDs.Num() != Positions.Num() || SourceIDs.Num() != Positions.Num() || Velocities.Num() != Positions.Num())
+	{
+		return Stats;
+	}
+
+	TArray<uint32> Flags;
+	if (const TArray<uint32>* ReadbackFlags = Simulator->GetParticleFlags())
+	{
+		Flags = *ReadbackFlags;
+	}
+	const bool bHasFlags = Flags.Num() == Positions.Num();
+
+	FKawaiiFluidParticleLODSettings EffectiveSettings = Settings;
+	if (const UKawaiiFluidPresetDataAsset* Preset = CachedPreset.Get())
+	{
+		EffectiveSettings.BaseMass = Preset->ParticleMass;
+		EffectiveSettings.ClusterCellSize = 2.0f * Preset->ParticleSpacing;
+		EffectiveSettings.SplitRadius = 0.5f * Preset->ParticleSpacing;
+	}
+
+	//========================================
+	// 1. Snapshot (representative mass from the last steps, base mass otherwise)
+	//========================================
+	TArray<FFluidParticle> Snapshot;
+	Snapshot.Reserve(Positions.Num());
+	TSet<int32> ReadbackIDs;
+	ReadbackIDs.Reserve(Positions.Num());
+
+	for (int32 i = 0; i < Positions.Num(); ++i)
+	{
+		ReadbackIDs.Add(ParticleIDs[i]);
+
+		// Despawned by the last step but the readback has not caught up
+		if (LODPendingDespawnIDs.Contains(ParticleIDs[i]))
+		{
+			continue;
+		}
+
+		FFluidParticle& Particle = Snapshot.Emplace_GetRef(FVector(Positions[i]), ParticleIDs[i]);
+		Particle.Velocity = FVector(Velocities[i]);
+		Particle.SourceID = SourceIDs[i];
+		Particle.bIsAttached = bHasFlags && (Flags[i] & EGPUParticleFlags::IsAttached) != 0;
+
+		const float* RepresentativeMass = LODRepresentativeMasses.Find(ParticleIDs[i]);
+		Particle.Mass = RepresentativeMass ? *RepresentativeMass : EffectiveSettings.BaseMass;
+	}
+
+	// Representatives removed by other despawns (brush, source, recycling)
+	for (auto It = LODRepresentativeMasses.CreateIterator(); It; ++It)
+	{
+		if (!ReadbackIDs.Contains(It.Key()) && !LODPendingSpawnIDs.Contains(It.Key()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+	LODPendingSpawnIDs.Reset();
+	LODPendingDespawnIDs.Reset();
+
+	//========================================
+	// 2. Merge/split diff, applied with fresh ParticleIDs
+	//========================================
+	TArray<int32> RemovedIDs;
+	TArray<FFluidParticle> AddedParticles;
+	Stats = FKawaiiFluidParticleLOD::BuildUpdate(Snapshot, EffectiveSettings, ViewPoints, RemovedIDs, AddedParticles);
+	if (RemovedIDs.Num() == 0)
+	{
+		return Stats;
+	}
+
+	for (const int32 ParticleID : RemovedIDs)
+	{
+		LODRepresentativeMasses.Remove(ParticleID);
+		LODPendingDespawnIDs.Add(ParticleID);
+	}
+
+	const int32 FirstParticleID = SpawnManager->AllocateParticleIDs(AddedParticles.Num());
+	TArray<FGPUSpawnRequest> SpawnRequests;
+	SpawnRequests.Reserve(AddedParticles.Num());
+	for (int32 i = 0; i < AddedParticles.Num(); ++i)
+	{
+		const FFluidParticle& Particle = AddedParticles[i];
+		FGPUSpawnRequest& Request = SpawnRequests.Emplace_GetRef(
+			FVector3f(Particle.Position), FVector3f(Particle.Velocity), Particle.SourceID, Particle.Mass);
+		Request.ParticleID = FirstParticleID + i;
+
+		if (FKawaiiFluidParticleLOD::IsRepresentative(Particle, EffectiveSettings.BaseMass))
+		{
+			LODRepresentativeMasses.Add(Request.ParticleID, Particle.Mass);
+			LODPendingSpawnIDs.Add(Request.ParticleID);
+		}
+	}
+
+	// Despawns run before spawns in the same frame, so capacity freed by merging is available
+	Simulator->AddGPUDespawnIDRequests(RemovedIDs);
+	Simulator->AddSpawnRequests(SpawnRequests);
+
+	return Stats;
+}
@@ -11,18 +11,80 @@
 #include "Rendering/KawaiiFluidMetaballRenderer.h"
 #include "Rendering/KawaiiFluidRenderResource.h"
 #include "Components/KawaiiFluidInteractionComponent.h"
+#include "Components/KawaiiFluidEmitterComponent.h"
 #include "Collision/KawaiiFluidCollider.h"
 #include "GPU/GPUFluidSimulator.h"
 #include "Engine/Level.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
 #include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
 
 // Profiling
 DECLARE_STATS_GROUP(TEXT("KawaiiFluidSubsystem"), STATGROUP_KawaiiFluidSubsystem, STATCAT_Advanced);
 DECLARE_CYCLE_STAT(TEXT("Subsystem Tick"), STAT_SubsystemTick, STATGROUP_KawaiiFluidSubsystem);
 DECLARE_CYCLE_STAT(TEXT("Simulate Independent"), STAT_SimulateIndependent, STATGROUP_KawaiiFluidSubsystem);
 DECLARE_CYCLE_STAT(TEXT("Simulate Batched"), STAT_SimulateBatched, STATGROUP_KawaiiFluidSubsystem);
+DECLARE_CYCLE_STAT(TEXT("Prepare Collision (Parallel)"), STAT_PrepareCollisionParallel, STATGROUP_KawaiiFluidSubsystem);
 DECLARE_CYCLE_STAT(TEXT("Merge Particles"), STAT_MergeParticles, STATGROUP_KawaiiFluidSubsystem);
 DECLARE_CYCLE_STAT(TEXT("Split Particles"), STAT_SplitParticles, STATGROUP_KawaiiFluidSubsystem);
+DECLARE_CYCLE_STAT(TEXT("Distance Activation"), STAT_DistanceActivation, STATGROUP_KawaiiFluidSubsystem);
+DECLARE_CYCLE_STAT(TEXT("Particle LOD"), STAT_ParticleLOD, STATGROUP_KawaiiFluidSubsystem);
+
+// Far-field particle LOD: merge distant, slow clusters into representatives, split them as viewers approach
+static int32 GFluidParticleLOD = 0;
+static FAutoConsoleVariableRef CVarFluidParticleLOD(
+	TEXT("r.Fluid.ParticleLOD"),
+	GFluidParticleLOD,
+	TEXT("Far-field particle LOD.\n")
+	TEXT("  0 = Off, every particle simulates at full resolution (default)\n")
+	TEXT("  1 = Merge/split against the local players' pawns or cameras"),
+	ECVF_Default
+);
+
+static float GFluidParticleLODInterval = 0.5f;
+static FAutoConsoleVariableRef CVarFluidParticleLODInterval(
+	TEXT("r.Fluid.ParticleLOD.Interval"),
+	GFluidParticleLODInterval,
+	TEXT("Seconds between particle LOD steps; must exceed the particle readback latency (default 0.5)"),
+	ECVF_Default
+);
+
+static float GFluidParticleLODMergeDistance = 6000.0f;
+static FAutoConsoleVariableRef CVarFluidParticleLODMergeDistance(
+	TEXT("r.Fluid.ParticleLOD.MergeDistance"),
+	GFluidParticleLODMergeDistance,
+	TEXT("Particles farther than this from every viewer may be merged (cm, default 6000)"),
+	ECVF_Default
+);
+
+static float GFluidParticleLODSplitDistance = 4000.0f;
+static FAutoConsoleVariableRef CVarFluidParticleLODSplitDistance(
+	TEXT("r.Fluid.ParticleLOD.SplitDistance"),
+	GFluidParticleLODSplitDistance,
+	TEXT("Representatives closer than this to any viewer are split (cm, default 4000)"),
+	ECVF_Default
+);
+
+/**
+ * One Context simulation scheduled for this frame
+ * Independent module: Modules holds that module. Batch: Modules holds all merged modules.
+ */
+struct FKawaiiFluidSimulationJob
+{
+	UKawaiiFluidSimulationContext* Context = nullptr;
+	UKawaiiFluidPresetDataAsset* Preset = nullptr;
+	TArray<TObjectPtr<UKawaiiFluidSimulationModule>> Modules;
+	FKawaiiFluidSimulationParams Params;
+	FKawaiiFluidGPUFrameData Frame;
+	float AccumulatedTime = 0.0f;
+	bool bBatched = false;
+
+	/** Context is driven by this job only (eligible for parallel collision gathering) */
+	bool bExclusiveContext = false;
+};
 
 UKawaiiFluidSimulatorSubsystem::UKawaiiFluidSimulatorSubsystem()
 {
@@ -89,13 +151,21 @@ void UKawaiiFluidSimulatorSubsystem::Deinitialize()
 	}
 
 	AllModules.Empty();
+	ModulesBySourceID.Empty();
+	SourceIDAllocator.Reset();
 	AllVolumes.Empty();
+	VolumeGrid.Reset();
+	VolumeGridVolumes.Empty();
+	EmitterActivationGrid.Reset();
+	ActivationEmitters.Empty();
+	ActivationReferenceActors.Empty();
 	AllVolumeComponents.Empty();
 	GlobalColliders.Empty();
 	GlobalInteractionComponents.Empty();
 	ContextCache.Empty();
 	DefaultContext = nullptr;
 	SharedSpatialHash.Reset();
+	FrameArenas.Empty();
 
 	Super::Deinitialize();
 
@@ -114,6 +184,11 @@ void UKawaiiFluidSimulatorSubsystem::Tick(float DeltaTime)
 
 	// Reset event counter at frame start
 	EventCountThisFrame.store(0, std::memory_order_relaxed);
+
+	// Batched emitter distance activation (one grid pass for all emitters)
+	UpdateDistanceActivation(DeltaTime);
+
+	ReleaseDrainedSourceIDs();
 }
 
 void UKawaiiFluidSimulatorSubsystem::HandlePostActorTick(UWorld* World, ELevelTick TickType, float DeltaTime)
@@ -139,14 +214,20 @@ void UKawaiiFluidSimulatorSubsystem::HandlePostActorTick(UWorld* World, ELevelTi
 	//========================================
 	if (AllModules.Num() > 0)
 	{
-		SimulateIndependentFluidComponents(DeltaTime);
-		SimulateBatchedFluidComponents(DeltaTime);
+		// Per-frame temporaries of this tick come from the frame arena (previous frame's stay valid)
+		FrameArenas.BeginFrame();
+		FKawaiiFluidFrameArenaScope FrameArenaScope(FrameArenas.GetCurrent());
+
+		SimulateFluidComponents(DeltaTime);
+
+		UpdateParticleLOD(DeltaTime);
 
 		//========================================
 		// Collision Feedback Processing (GPU + CPU)
 		//========================================
 		// Build OwnerID → InteractionComponent map (once, for O(1) lookup)
-		TMap<int32, UKawaiiFluidInteractionComponent*> OwnerIDToIC;
+		TMap<int32, UKawaiiFluidInteractionComponent*>& OwnerIDToIC = OwnerIDToICScratch;
+		OwnerIDToIC.Reset();
 		OwnerIDToIC.Reserve(GlobalInteractionComponents.Num());
 		for (UKawaiiFluidInteractionComponent* IC : GlobalInteractionComponents)
 		{
@@ -183,6 +264,14 @@ void UKawaiiFluidSimulatorSubsystem::RegisterModule(UKawaiiFluidSimulationModule
 		// Allocate SourceID for per-component GPU counter tracking (0 ~ MaxSourceCount-1)
 		const int32 NewSourceID = AllocateSourceID();
 		Module->SetSourceID(NewSourceID);
+		if (NewSourceID >= 0)
+		{
+			if (ModulesBySourceID.Num() <= NewSourceID)
+			{
+				ModulesBySourceID.SetNum(SourceIDAllocator.GetHighWaterMark());
+			}
+			ModulesBySourceID[NewSourceID] = Module;
+		}
 
 		// Early GPU setup: Initialize GPU state at registration time
 		// so spawn calls before first Tick use the correct path
@@ -258,6 +347,10 @@ void UKawaiiFluidSimulatorSubsystem::UnregisterModule(UKawaiiFluidSimulationModu
 		const int32 SourceID = Module->GetSourceID();
 		if (SourceID >= 0)
 		{
+			if (ModulesBySourceID.IsValidIndex(SourceID))
+			{
+				ModulesBySourceID[SourceID].Reset();
+			}
 			ReleaseSourceID(SourceID);
 			Module->SetSourceID(EGPUParticleSource::InvalidSourceID);
 		}
@@ -273,36 +366,54 @@ void UKawaiiFluidSimulatorSubsystem::UnregisterModule(UKawaiiFluidSimulationModu
 
 int32 UKawaiiFluidSimulatorSubsystem::AllocateSourceID()
 {
-	// Initialize bitfield on first use
-	if (UsedSourceIDs.Num() == 0)
+	const int32 SourceID = SourceIDAllocator.Allocate();
+	if (SourceID == EGPUParticleSource::InvalidSourceID)
 	{
-		UsedSourceIDs.Init(false, EGPUParticleSource::MaxSourceCount);
+		UE_LOG(LogTemp, Warning, TEXT("Subsystem::AllocateSourceID FAILED - all %d slots in use!"), SourceIDAllocator.GetCapacity());
+		return EGPUParticleSource::InvalidSourceID;
 	}
 
-	// Search for first available ID starting from hint
-	for (int32 i = 0; i < EGPUParticleSource::MaxSourceCount; ++i)
+	UE_LOG(LogTemp, Log, TEXT("Subsystem::AllocateSourceID = %d (%d in use)"), SourceID, SourceIDAllocator.Num());
+	return SourceID;
+}
+
+void UKawaiiFluidSimulatorSubsystem::ReleaseSourceID(int32 SourceID)
+{
+	// Particles of a released source stay alive on the GPU; reusing the id right away would hand
+	// them (and their per-source count) to the next owner, so it waits in quarantine until drained
+	if (SourceIDAllocator.Quarantine(SourceID))
 	{
-		const int32 Index = (NextSourceIDHint + i) % EGPUParticleSource::MaxSourceCount;
-		if (!UsedSourceIDs[Index])
-		{
-			UsedSourceIDs[Index] = true;
-			NextSourceIDHint = (Index + 1) % EGPUParticleSource::MaxSourceCount;
-			UE_LOG(LogTemp, Log, TEXT("Subsystem::AllocateSourceID = %d"), Index);
-			return Index;
-		}
+		UE_LOG(LogTemp, Log, TEXT("Subsystem::ReleaseSourceID = %d (quarantined until drained)"), SourceID);
 	}
-
-	// All slots used - return invalid
-	UE_LOG(LogTemp, Warning, TEXT("Subsystem::AllocateSourceID FAILED - all %d slots in use!"), EGPUParticleSource::MaxSourceCount);
-	return EGPUParticleSource::InvalidSourceID;
 }
 
-void UKawaiiFluidSimulatorSubsystem::ReleaseSourceID(int32 SourceID)
+void UKawaiiFluidSimulatorSubsystem::ReleaseDrainedSourceIDs()
 {
-	if (SourceID >= 0 && SourceID < UsedSourceIDs.Num())
+	if (SourceIDAllocator.GetNumQuarantined() == 0)
+	{
+		return;
+	}
+
+	TArray<FGPUFluidSimulator*> Simulators;
+	GetAllGPUSimulators(Simulators);
+
+	const int32 NumReleased = SourceIDAllocator.ReleaseDrained(SourceIDQuarantineFrames, [&Simulators](int32 SourceID)
+	{
+		for (const FGPUFluidSimulator* Simulator : Simulators)
+		{
+			const FGPUSpawnManager* SpawnManager = Simulator->GetSpawnManager();
+			if (SpawnManager && SpawnManager->GetParticleCountForSource(SourceID) > 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	});
+
+	if (NumReleased > 0)
 	{
-		UsedSourceIDs[SourceID] = false;
-		UE_LOG(LogTemp, Log, TEXT("Subsystem::ReleaseSourceID = %d"), SourceID);
+		UE_LOG(LogTemp, Verbose, TEXT("Subsystem::ReleaseDrainedSourceIDs = %d (%d still quarantined)"),
+			NumReleased, SourceIDAllocator.GetNumQuarantined());
 	}
 }
 
@@ -315,6 +426,20 @@ void UKawaiiFluidSimulatorSubsystem::RegisterVolume(AKawaiiFluidVolume* Volume)
 	if (Volume && !AllVolumes.Contains(Volume))
 	{
 		AllVolumes.Add(Volume);
+
+		const int32 Handle = VolumeGrid.AddEntry(Volume->GetActorLocation(), 0.0f, 0.0f);
+		if (VolumeGridVolumes.Num() <= Handle)
+		{
+			VolumeGridVolumes.SetNum(Handle + 1);
+		}
+		VolumeGridVolumes[Handle] = Volume;
+
+		// Grid location follows the volume (no per-query refresh)
+		if (USceneComponent* Root = Volume->GetRootComponent())
+		{
+			Root->TransformUpdated.AddUObject(this, &UKawaiiFluidSimulatorSubsystem::HandleVolumeTransformUpdated, Handle);
+		}
+
 		UE_LOG(LogTemp, Log, TEXT("KawaiiFluidVolume registered: %s"), *Volume->GetName());
 	}
 }
@@ -322,9 +447,242 @@ void UKawaiiFluidSimulatorSubsystem::RegisterVolume(AKawaiiFluidVolume* Volume)
 void UKawaiiFluidSimulatorSubsystem::UnregisterVolume(AKawaiiFluidVolume* Volume)
 {
 	AllVolumes.Remove(Volume);
+
+	const int32 Handle = VolumeGridVolumes.IndexOfByKey(Volume);
+	if (Handle != INDEX_NONE)
+	{
+		VolumeGrid.RemoveEntry(Handle);
+		VolumeGridVolumes[Handle] = nullptr;
+
+		if (USceneComponent* Root = Volume->GetRootComponent())
+		{
+			Root->TransformUpdated.RemoveAll(this);
+		}
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("KawaiiFluidVolume unregistered: %s"), Volume ? *Volume->GetName() : TEXT("nullptr"));
 }
 
+AKawaiiFluidVolume* UKawaiiFluidSimulatorSubsystem::FindNearestVolume(const FVector& Location) const
+{
+	const int32 Handle = VolumeGrid.FindNearest(Location);
+	return VolumeGridVolumes.IsValidIndex(Handle) ? VolumeGridVolumes[Handle].Get() : nullptr;
+}
+
+void UKawaiiFluidSimulatorSubsystem::HandleVolumeTransformUpdated(USceneComponent* UpdatedComponent,
+	EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, int32 Handle)
+{
+	if (UpdatedComponent && VolumeGrid.IsValidHandle(Handle))
+	{
+		VolumeGrid.SetEntryLocation(Handle, UpdatedComponent->GetComponentLocation());
+	}
+}
+
+//========================================
+// Distance Activation (Batched)
+//========================================
+
+bool UKawaiiFluidSimulatorSubsystem::RegisterDistanceActivation(UKawaiiFluidEmitterComponent* Emitter, bool& bOutActive)
+{
+	bOutActive = false;
+	if (!Emitter)
+	{
+		return false;
+	}
+
+	// Already registered: keep the entry and report its current state
+	const int32 ExistingHandle = ActivationEmitters.IndexOfByKey(Emitter);
+	if (ExistingHandle != INDEX_NONE)
+	{
+		bOutActive = EmitterActivationGrid.IsEntryActive(ExistingHandle);
+		return true;
+	}
+
+	const FVector Location = Emitter->GetComponentLocation();
+	const int32 Handle = EmitterActivationGrid.AddEntry(Location, Emitter->ActivationDistance, Emitter->GetHysteresisDistance());
+	if (ActivationEmitters.Num() <= Handle)
+	{
+		ActivationEmitters.SetNum(Handle + 1);
+	}
+	ActivationEmitters[Handle] = Emitter;
+
+	// Initial state: plain activation distance (no hysteresis while inactive)
+	TArray<FVector> ReferencePoints;
+	GatherActivationReferencePoints(ReferencePoints);
+	bOutActive = FKawaiiFluidActivationGrid::IsWithinActivationRange(
+		Location, Emitter->ActivationDistance, ReferencePoints);
+
+	// Keep grid state in sync so the first batched update does not report a spurious change
+	EmitterActivationGrid.SetEntryActive(Handle, bOutActive);
+
+	return true;
+}
+
+void UKawaiiFluidSimulatorSubsystem::UnregisterDistanceActivation(UKawaiiFluidEmitterComponent* Emitter)
+{
+	const int32 Handle = ActivationEmitters.IndexOfByKey(Emitter);
+	if (Handle != INDEX_NONE)
+	{
+		EmitterActivationGrid.RemoveEntry(Handle);
+		ActivationEmitters[Handle] = nullptr;
+	}
+}
+
+void UKawaiiFluidSimulatorSubsystem::RegisterActivationReference(AActor* ReferenceActor)
+{
+	if (ReferenceActor)
+	{
+		ActivationReferenceActors.AddUnique(ReferenceActor);
+	}
+}
+
+void UKawaiiFluidSimulatorSubsystem::UnregisterActivationReference(AActor* ReferenceActor)
+{
+	ActivationReferenceActors.Remove(ReferenceActor);
+}
+
+void UKawaiiFluidSimulatorSubsystem::UpdateParticleLOD(float DeltaTime)
+{
+	if (GFluidParticleLOD == 0)
+	{
+		ParticleLODAccumulator = 0.0f;
+		return;
+	}
+
+	ParticleLODAccumulator += DeltaTime;
+	if (ParticleLODAccumulator < GFluidParticleLODInterval)
+	{
+		return;
+	}
+	ParticleLODAccumulator = 0.0f;
+
+	SCOPE_CYCLE_COUNTER(STAT_ParticleLOD);
+
+	TArray<FVector> ViewPoints;
+	GatherActivationReferencePoints(ViewPoints);
+	if (ViewPoints.Num() == 0)
+	{
+		return;
+	}
+
+	FKawaiiFluidParticleLODSettings Settings;
+	Settings.MergeDistance = GFluidParticleLODMergeDistance;
+	Settings.SplitDistance = FMath::Min(GFluidParticleLODSplitDistance, GFluidParticleLODMergeDistance);
+
+	TSet<UKawaiiFluidSimulationContext*> Contexts;
+	for (const auto& Pair : ContextCache)
+	{
+		Contexts.Add(Pair.Value);
+	}
+	Contexts.Add(DefaultContext);
+
+	for (UKawaiiFluidSimulationContext* Context : Contexts)
+	{
+		if (!Context)
+		{
+			continue;
+		}
+
+		const FKawaiiFluidParticleLODStats Stats = Context->UpdateParticleLOD(ViewPoints, Settings);
+		if (Stats.NumRepresentativesCreated > 0 || Stats.NumRepresentativesSplit > 0)
+		{
+			UE_LOG(LogTemp, Verbose, TEXT("Subsystem::UpdateParticleLOD: merged %d into %d, split %d into %d"),
+				Stats.NumMergedParticles, Stats.NumRepresentativesCreated,
+				Stats.NumRepresentativesSplit, Stats.NumSplitParticles);
+		}
+	}
+}
+
+void UKawaiiFluidSimulatorSubsystem::GatherActivationReferencePoints(TArray<FVector>& OutPoints) const
+{
+	OutPoints.Reset();
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// Every local player (split-screen): pawn if possessed, otherwise camera (spectating)
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (!PC || !PC->IsLocalController())
+		{
+			continue;
+		}
+
+		if (const APawn* Pawn = PC->GetPawn())
+		{
+			OutPoints.Add(Pawn->GetActorLocation());
+		}
+		else if (PC->PlayerCameraManager)
+		{
+			OutPoints.Add(PC->PlayerCameraManager->GetCameraLocation());
+		}
+	}
+
+	for (const TWeakObjectPtr<AActor>& ReferenceActor : ActivationReferenceActors)
+	{
+		if (const AActor* Actor = ReferenceActor.Get())
+		{
+			OutPoints.Add(Actor->GetActorLocation());
+		}
+	}
+}
+
+void UKawaiiFluidSimulatorSubsystem::UpdateDistanceActivation(float DeltaTime)
+{
+	if (EmitterActivationGrid.Num() == 0)
+	{
+		return;
+	}
+
+	// Throttle: 10Hz
+	ActivationUpdateAccumulator += DeltaTime;
+	if (ActivationUpdateAccumulator < ActivationUpdateInterval)
+	{
+		return;
+	}
+	ActivationUpdateAccumulator = 0.0f;
+
+	SCOPE_CYCLE_COUNTER(STAT_DistanceActivation);
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidSubsystem_DistanceActivation);
+
+	GatherActivationReferencePoints(ActivationReferencePoints);
+
+	// Same behavior as the former per-emitter check: keep last state while no reference exists
+	if (ActivationReferencePoints.Num() == 0)
+	{
+		return;
+	}
+
+	// Refresh locations (emitters may be attached to moving actors) and tunables
+	for (int32 Handle = 0; Handle < ActivationEmitters.Num(); ++Handle)
+	{
+		UKawaiiFluidEmitterComponent* Emitter = ActivationEmitters[Handle].Get();
+		if (Emitter)
+		{
+			EmitterActivationGrid.SetEntry(Handle, Emitter->GetComponentLocation(),
+				Emitter->ActivationDistance, Emitter->GetHysteresisDistance());
+		}
+		else if (EmitterActivationGrid.IsValidHandle(Handle))
+		{
+			EmitterActivationGrid.RemoveEntry(Handle);
+		}
+	}
+
+	EmitterActivationGrid.Update(ActivationReferencePoints, ActivationChangedHandles);
+
+	for (const int32 Handle : ActivationChangedHandles)
+	{
+		if (UKawaiiFluidEmitterComponent* Emitter = ActivationEmitters[Handle].Get())
+		{
+			Emitter->ApplyDistanceActivation(EmitterActivationGrid.IsEntryActive(Handle));
+		}
+	}
+}
+
 //========================================
 // Volume Component Registration (Legacy)
 //========================================
@@ -434,10 +792,10 @@ UKawaiiFluidSimulationModule* UKawaiiFluidSimulatorSubsystem::GetModuleBySourceI
 		return nullptr;
 	}
 
-	// Method 1: SourceID slot matching (AllocateSourceID result)
-	for (UKawaiiFluidSimulationModule* Module : AllModules)
+	// Method 1: SourceID slot lookup (AllocateSourceID result)
+	if (ModulesBySourceID.IsValidIndex(SourceID))
 	{
-		if (Module && Module->GetSourceID() == SourceID)
+		if (UKawaiiFluidSimulationModule* Module = ModulesBySourceID[SourceID].Get())
 		{
 			return Module;
 		}
@@ -526,8 +884,19 @@ UKawaiiFluidSimulationContext* UKawaiiFluidSimulatorSubsystem::GetOrCreateContex
 // Simulation Methods (Module-based)
 //========================================
 
-void UKawaiiFluidSimulatorSubsystem::SimulateIndependentFluidComponents(float DeltaTime)
+void UKawaiiFluidSimulatorSubsystem::SimulateFluidComponents(float DeltaTime)
 {
+	TKawaiiFluidFrameArray<FKawaiiFluidSimulationJob> Jobs;
+	GatherIndependentSimulationJobs(Jobs);
+	GatherBatchedSimulationJobs(Jobs);
+
+	RunSimulationJobs(Jobs, DeltaTime);
+}
+
+void UKawaiiFluidSimulatorSubsystem::GatherIndependentSimulationJobs(TKawaiiFluidFrameArray<FKawaiiFluidSimulationJob>& OutJobs)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SimulateIndependent);
+
 	static bool bLoggedOnce = false;
 	if (!bLoggedOnce && AllModules.Num() > 0)
 	{
@@ -571,20 +940,24 @@ void UKawaiiFluidSimulatorSubsystem::SimulateIndependentFluidComponents(float De
 		}
 
 		// Get spatial hash (use module's own)
-		FSpatialHash* SpatialHash = Module->GetSpatialHash();
-		if (!SpatialHash)
+		if (!Module->GetSpatialHash())
 		{
 			continue;
 		}
 
+		FKawaiiFluidSimulationJob& Job = OutJobs.AddDefaulted_GetRef();
+		Job.Context = Context;
+		Job.Preset = EffectivePreset;
+		Job.Modules.Add(Module);
+
 		// Build simulation params - directly from Module!
-		FKawaiiFluidSimulationParams Params = Module->BuildSimulationParams();
-		Params.Colliders.Append(GlobalColliders);
-		Params.InteractionComponents.Append(GlobalInteractionComponents);
+		Job.Params = Module->BuildSimulationParams();
+		Job.Params.Colliders.Append(GlobalColliders);
+		Job.Params.InteractionComponents.Append(GlobalInteractionComponents);
 
 		// Set CPU collision feedback buffer pointers (used by Context)
-		Params.CPUCollisionFeedbackBufferPtr = &CPUCollisionFeedbackBuffer;
-		Params.CPUCollisionFeedbackLockPtr = &CPUCollisionFeedbackLock;
+		Job.Params.CPUCollisionFeedbackBufferPtr = &CPUCollisionFeedbackBuffer;
+		Job.Params.CPUCollisionFeedbackLockPtr = &CPUCollisionFeedbackLock;
 
 		// GPU simulation setup (always enabled)
 		if (!Context->IsGPUSimulatorReady() && TargetVolume)
@@ -598,26 +971,14 @@ void UKawaiiFluidSimulatorSubsystem::SimulateIndependentFluidComponents(float De
 			Module->SetGPUSimulationActive(true);
 		}
 
-		// Simulate
-		TArray<FFluidParticle>& Particles = Module->GetParticlesMutable();
-		float AccumulatedTime = Module->GetAccumulatedTime();
-
-		static bool bSimLoggedOnce = false;
-		if (!bSimLoggedOnce)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Subsystem: Calling Context->Simulate for Module with %d particles"), Particles.Num());
-			bSimLoggedOnce = true;
-		}
-
-		Context->Simulate(Particles, EffectivePreset, Params, *SpatialHash, DeltaTime, AccumulatedTime);
-
-		Module->SetAccumulatedTime(AccumulatedTime);
-		Module->ResetExternalForce();
+		Job.AccumulatedTime = Module->GetAccumulatedTime();
 	}
 }
 
-void UKawaiiFluidSimulatorSubsystem::SimulateBatchedFluidComponents(float DeltaTime)
+void UKawaiiFluidSimulatorSubsystem::GatherBatchedSimulationJobs(TKawaiiFluidFrameArray<FKawaiiFluidSimulationJob>& OutJobs)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SimulateBatched);
+
 	// Group modules by Preset
 	TMap<FContextCacheKey, TArray<TObjectPtr<UKawaiiFluidSimulationModule>>> ContextGroups = GroupModulesByContext();
 
@@ -640,25 +1001,19 @@ void UKawaiiFluidSimulatorSubsystem::SimulateBatchedFluidComponents(float DeltaT
 			continue;
 		}
 
-		// Update shared spatial hash cell size
-		SharedSpatialHash->SetCellSize(Preset->SmoothingRadius);
-
-		// Merge particles from all modules
-		MergeModuleParticles(Modules);
-
-		if (MergedFluidParticleBuffer.Num() == 0)
-		{
-			continue;
-		}
+		FKawaiiFluidSimulationJob& Job = OutJobs.AddDefaulted_GetRef();
+		Job.Context = Context;
+		Job.Preset = Preset;
+		Job.bBatched = true;
 
 		// Build merged simulation params - directly from Module!
-		FKawaiiFluidSimulationParams Params = BuildMergedModuleSimulationParams(Modules);
-		Params.Colliders.Append(GlobalColliders);
-		Params.InteractionComponents.Append(GlobalInteractionComponents);
+		Job.Params = BuildMergedModuleSimulationParams(Modules);
+		Job.Params.Colliders.Append(GlobalColliders);
+		Job.Params.InteractionComponents.Append(GlobalInteractionComponents);
 
 		// Set CPU collision feedback buffer pointers (used by Context)
-		Params.CPUCollisionFeedbackBufferPtr = &CPUCollisionFeedbackBuffer;
-		Params.CPUCollisionFeedbackLockPtr = &CPUCollisionFeedbackLock;
+		Job.Params.CPUCollisionFeedbackBufferPtr = &CPUCollisionFeedbackBuffer;
+		Job.Params.CPUCollisionFeedbackLockPtr = &CPUCollisionFeedbackLock;
 
 		// GPU simulation setup (always enabled)
 		if (!Context->IsGPUSimulatorReady() && CacheKey.VolumeComponent)
@@ -680,27 +1035,111 @@ void UKawaiiFluidSimulatorSubsystem::SimulateBatchedFluidComponents(float DeltaT
 			}
 		}
 
-		// Simulate merged buffer
-		float AccumulatedTime = 0.0f;
-		if (Modules.Num() > 0 && Modules[0])
+		if (Modules[0])
 		{
-			AccumulatedTime = Modules[0]->GetAccumulatedTime();
+			Job.AccumulatedTime = Modules[0]->GetAccumulatedTime();
 		}
 
-		Context->Simulate(MergedFluidParticleBuffer, Preset, Params, *SharedSpatialHash, DeltaTime, AccumulatedTime);
+		Job.Modules = MoveTemp(Modules);
+	}
+}
+
+void UKawaiiFluidSimulatorSubsystem::RunSimulationJobs(TKawaiiFluidFrameArray<FKawaiiFluidSimulationJob>& Jobs, float DeltaTime)
+{
+	if (Jobs.Num() == 0)
+	{
+		return;
+	}
+
+	// Contexts driven by more than one job this frame (several independent modules on the same
+	// Volume + Preset) carry state from one job to the next and stay on the serial path
+	TMap<UKawaiiFluidSimulationContext*, int32> JobsPerContext;
+	for (const FKawaiiFluidSimulationJob& Job : Jobs)
+	{
+		++JobsPerContext.FindOrAdd(Job.Context);
+	}
+
+	//========================================
+	// Phase 1: Game thread - frame setup for exclusive contexts
+	//========================================
+	TKawaiiFluidFrameArray<int32> ParallelJobIndices;
+	ParallelJobIndices.Reserve(Jobs.Num());
+	for (int32 JobIndex = 0; JobIndex < Jobs.Num(); ++JobIndex)
+	{
+		FKawaiiFluidSimulationJob& Job = Jobs[JobIndex];
+		Job.bExclusiveContext = (JobsPerContext.FindChecked(Job.Context) == 1);
+
+		if (Job.bExclusiveContext && Job.Context->BeginGPUFrame(Job.Preset, Job.Params, Job.Frame))
+		{
+			ParallelJobIndices.Add(JobIndex);
+		}
+	}
+
+	//========================================
+	// Phase 2: Worker threads - collision gathering per context
+	// Each job touches only its own context and GPU simulator
+	//========================================
+	{
+		SCOPE_CYCLE_COUNTER(STAT_PrepareCollisionParallel);
+		TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidSubsystem_PrepareCollisionParallel);
+
+		ParallelFor(ParallelJobIndices.Num(), [&Jobs, &ParallelJobIndices](int32 Index)
+		{
+			FKawaiiFluidSimulationJob& Job = Jobs[ParallelJobIndices[Index]];
+			Job.Context->PrepareGPUCollision(Job.Preset, Job.Params, Job.Frame);
+		}, ParallelJobIndices.Num() < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+	}
+
+	//========================================
+	// Phase 3: Game thread - submit in original order
+	//========================================
+	for (FKawaiiFluidSimulationJob& Job : Jobs)
+	{
+		if (Job.bBatched)
+		{
+			// Update shared spatial hash cell size
+			SharedSpatialHash->SetCellSize(Job.Preset->SmoothingRadius);
+
+			// Merge particles from all modules
+			MergeModuleParticles(Job.Modules);
+
+			if (MergedFluidParticleBuffer.Num() == 0)
+			{
+				continue;
+			}
+		}
+
+		if (Job.bExclusiveContext)
+		{
+			if (Job.Frame.bValid)
+			{
+				Job.Context->SubmitGPUFrame(Job.Preset, Job.Params, Job.Frame, DeltaTime, Job.AccumulatedTime);
+			}
+		}
+		else
+		{
+			UKawaiiFluidSimulationModule* Module = Job.Modules[0];
+			TArray<FFluidParticle>& Particles = Job.bBatched ? MergedFluidParticleBuffer : Module->GetParticlesMutable();
+			FSpatialHash& SpatialHash = Job.bBatched ? *SharedSpatialHash : *Module->GetSpatialHash();
+
+			Job.Context->Simulate(Particles, Job.Preset, Job.Params, SpatialHash, DeltaTime, Job.AccumulatedTime);
+		}
 
 		// Update accumulated time and reset external force for all modules
-		for (UKawaiiFluidSimulationModule* Module : Modules)
+		for (UKawaiiFluidSimulationModule* Module : Job.Modules)
 		{
 			if (Module)
 			{
-				Module->SetAccumulatedTime(AccumulatedTime);
+				Module->SetAccumulatedTime(Job.AccumulatedTime);
 				Module->ResetExternalForce();
 			}
 		}
 
-		// Split particles back to modules
-		SplitModuleParticles(Modules);
+		if (Job.bBatched)
+		{
+			// Split particles back to modules
+			SplitModuleParticles(Job.Modules);
+		}
 	}
 }
 
@@ -812,6 +1251,7 @@ FKawaiiFluidSimulationParams UKawaiiFluidSimulatorSubsystem::BuildMergedModuleSi
 
 	FVector TotalForce = FVector::ZeroVector;
 	bool bAnyUseWorldCollision = false;
+	bool bAnyUseWorldSDFCache = false;
 
 	for (const UKawaiiFluidSimulationModule* Module : Modules)
 	{
@@ -829,12 +1269,14 @@ FKawaiiFluidSimulationParams UKawaiiFluidSimulatorSubsystem::BuildMergedModuleSi
 		if (Module->bUseWorldCollision)
 		{
 			bAnyUseWorldCollision = true;
+			bAnyUseWorldSDFCache |= Module->bUseWorldSDFCache;
 		}
 	}
 
 	Params.ExternalForce = TotalForce;
 	Params.InteractionComponents.Append(GlobalInteractionComponents);
 	Params.bUseWorldCollision = bAnyUseWorldCollision;
+	Params.bUseWorldSDFCache = bAnyUseWorldSDFCache;
 
 	// Use first module's particle radius
 	if (Modules.Num() > 0 && Modules[0])
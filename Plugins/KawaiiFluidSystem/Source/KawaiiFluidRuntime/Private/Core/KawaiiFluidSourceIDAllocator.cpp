@@ -0,0 +1,225 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Core/KawaiiFluidSourceIDAllocator.h"
+
+//=============================================================================
+// FKawaiiFluidSourceIDAllocator
+//=============================================================================
+
+FKawaiiFluidSourceIDAllocator::FKawaiiFluidSourceIDAllocator(int32 InCapacity)
+	: Capacity(FMath::Clamp(InCapacity, 0, EGPUParticleSource::MaxSourceCount))
+{
+	Reset();
+}
+
+void FKawaiiFluidSourceIDAllocator::Reset()
+{
+	const int32 NumWords = FMath::DivideAndRoundUp(Capacity, IDsPerWord);
+	const int32 NumSummaryWords = FMath::DivideAndRoundUp(NumWords, 64);
+
+	FreeWords.Init(~0ull, NumWords);
+	if (const int32 Tail = Capacity % IDsPerWord)
+	{
+		FreeWords.Last() = (1ull << Tail) - 1;
+	}
+
+	SummaryWords.Init(0ull, NumSummaryWords);
+	for (int32 w = 0; w < NumWords; ++w)
+	{
+		SummaryWords[w / 64] |= 1ull << (w % 64);
+	}
+
+	Quarantined.Reset();
+	QuarantinedBits.Init(false, Capacity);
+
+	FirstFreeSummary = 0;
+	NumAllocated = 0;
+	HighWaterMark = 0;
+}
+
+int32 FKawaiiFluidSourceIDAllocator::Allocate()
+{
+	// At most Capacity / IDsPerSummaryWord (16) summary words; the hint skips the full ones
+	for (int32 s = FirstFreeSummary; s < SummaryWords.Num(); ++s)
+	{
+		if (SummaryWords[s] == 0)
+		{
+			continue;
+		}
+
+		const int32 Word = s * 64 + static_cast<int32>(FMath::CountTrailingZeros64(SummaryWords[s]));
+		const int32 Bit = static_cast<int32>(FMath::CountTrailingZeros64(FreeWords[Word]));
+
+		FreeWords[Word] &= ~(1ull << Bit);
+		if (FreeWords[Word] == 0)
+		{
+			SummaryWords[s] &= ~(1ull << (Word % 64));
+		}
+
+		FirstFreeSummary = s;
+		++NumAllocated;
+
+		const int32 ID = Word * IDsPerWord + Bit;
+		HighWaterMark = FMath::Max(HighWaterMark, ID + 1);
+		return ID;
+	}
+
+	FirstFreeSummary = SummaryWords.Num();
+	return EGPUParticleSource::InvalidSourceID;
+}
+
+bool FKawaiiFluidSourceIDAllocator::Release(int32 ID)
+{
+	if (ID < 0 || ID >= Capacity)
+	{
+		return false;
+	}
+
+	const int32 Word = ID / IDsPerWord;
+	const uint64 Mask = 1ull << (ID % IDsPerWord);
+	if ((FreeWords[Word] & Mask) || QuarantinedBits[ID])
+	{
+		return false;
+	}
+
+	MarkFree(ID);
+	--NumAllocated;
+	return true;
+}
+
+void FKawaiiFluidSourceIDAllocator::MarkFree(int32 ID)
+{
+	const int32 Word = ID / IDsPerWord;
+	FreeWords[Word] |= 1ull << (ID % IDsPerWord);
+	SummaryWords[Word / 64] |= 1ull << (Word % 64);
+	FirstFreeSummary = FMath::Min(FirstFreeSummary, Word / 64);
+}
+
+bool FKawaiiFluidSourceIDAllocator::Quarantine(int32 ID)
+{
+	if (!IsAllocated(ID) || QuarantinedBits[ID])
+	{
+		return false;
+	}
+
+	// Stays marked in use in the bitmap, so Allocate skips it
+	QuarantinedBits[ID] = true;
+	Quarantined.Add({ ID, 0 });
+	--NumAllocated;
+	return true;
+}
+
+int32 FKawaiiFluidSourceIDAllocator::ReleaseDrained(int32 MinUpdates, TFunctionRef<bool(int32)> IsDrained)
+{
+	int32 NumReleased = 0;
+	int32 Write = 0;
+	for (int32 Read = 0; Read < Quarantined.Num(); ++Read)
+	{
+		FQuarantinedID Entry = Quarantined[Read];
+		++Entry.Updates;
+
+		if (Entry.Updates >= MinUpdates && IsDrained(Entry.ID))
+		{
+			QuarantinedBits[Entry.ID] = false;
+			MarkFree(Entry.ID);
+			++NumReleased;
+		}
+		else
+		{
+			Quarantined[Write++] = Entry;
+		}
+	}
+	Quarantined.SetNum(Write, EAllowShrinking::No);
+	return NumReleased;
+}
+
+bool FKawaiiFluidSourceIDAllocator::IsAllocated(int32 ID) const
+{
+	if (ID < 0 || ID >= Capacity)
+	{
+		return false;
+	}
+	return (FreeWords[ID / IDsPerWord] & (1ull << (ID % IDsPerWord))) == 0;
+}
+
+//=============================================================================
+// FKawaiiFluidSourceRangeSet
+//=============================================================================
+
+FKawaiiFluidSourceRangeSet::FKawaiiFluidSourceRangeSet(int32 InMergeGap, int32 InMaxRanges)
+	: MergeGap(FMath::Max(0, InMergeGap))
+	, MaxRanges(FMath::Max(1, InMaxRanges))
+{
+}
+
+void FKawaiiFluidSourceRangeSet::AddRange(int32 Begin, int32 End)
+{
+	if (Begin >= End)
+	{
+		return;
+	}
+
+	// Ranges stay sorted by Begin (at most MaxRanges + 1 entries, linear is fine)
+	int32 Insert = 0;
+	while (Insert < Ranges.Num() && Ranges[Insert].Begin <= Begin)
+	{
+		++Insert;
+	}
+	Ranges.Insert(FKawaiiFluidSourceRange(Begin, End), Insert);
+
+	// Join overlapping and nearby neighbors
+	int32 Write = 0;
+	for (int32 Read = 1; Read < Ranges.Num(); ++Read)
+	{
+		if (Ranges[Read].Begin - Ranges[Write].End <= MergeGap)
+		{
+			Ranges[Write].End = FMath::Max(Ranges[Write].End, Ranges[Read].End);
+		}
+		else
+		{
+			Ranges[++Write] = Ranges[Read];
+		}
+	}
+	Ranges.SetNum(Write + 1, EAllowShrinking::No);
+
+	// Over budget: join the closest pair
+	while (Ranges.Num() > MaxRanges)
+	{
+		int32 Closest = 0;
+		for (int32 i = 1; i + 1 < Ranges.Num(); ++i)
+		{
+			if (Ranges[i + 1].Begin - Ranges[i].End < Ranges[Closest + 1].Begin - Ranges[Closest].End)
+			{
+				Closest = i;
+			}
+		}
+		Ranges[Closest].End = Ranges[Closest + 1].End;
+		Ranges.RemoveAt(Closest + 1, EAllowShrinking::No);
+	}
+}
+
+bool FKawaiiFluidSourceRangeSet::Contains(int32 ID) const
+{
+	for (const FKawaiiFluidSourceRange& Range : Ranges)
+	{
+		if (ID < Range.Begin)
+		{
+			return false;
+		}
+		if (ID < Range.End)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+int32 FKawaiiFluidSourceRangeSet::GetNumIDs() const
+{
+	int32 Total = 0;
+	for (const FKawaiiFluidSourceRange& Range : Ranges)
+	{
+		Total += Range.Num();
+	}
+	return Total;
+}
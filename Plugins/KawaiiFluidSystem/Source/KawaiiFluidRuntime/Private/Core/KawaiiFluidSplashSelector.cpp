@@ -0,0 +1,132 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Core/KawaiiFluidSplashSelector.h"
+
+namespace
+{
+	/** PCG hash (same constants as FluidSplashCompact.usf) */
+	FORCEINLINE uint32 PcgHash(uint32 Value)
+	{
+		const uint32 State = Value * 747796405u + 2891336453u;
+		const uint32 Word = ((State >> ((State >> 28u) + 4u)) ^ State) * 277803737u;
+		return (Word >> 22u) ^ Word;
+	}
+}
+
+bool FKawaiiFluidSplashSelector::EvaluateCondition(
+	const FKawaiiFluidSplashSettings& Settings,
+	float Speed,
+	uint32 NeighborCount,
+	bool& bInOutWasIsolated)
+{
+	const bool bFastMoving = Speed > Settings.VelocityThreshold;
+
+	// State change detection: was not isolated -> now isolated
+	const bool bIsolated = static_cast<int32>(NeighborCount) <= Settings.IsolationNeighborThreshold;
+	const bool bJustBecameIsolated = bIsolated && !bInOutWasIsolated;
+	bInOutWasIsolated = bIsolated;
+
+	switch (Settings.ConditionMode)
+	{
+	case ESplashConditionMode::VelocityAndIsolation:
+		return bFastMoving && bJustBecameIsolated;
+	case ESplashConditionMode::VelocityOrIsolation:
+		return bFastMoving || bJustBecameIsolated;
+	case ESplashConditionMode::VelocityOnly:
+		return bFastMoving;
+	case ESplashConditionMode::IsolationOnly:
+		return bJustBecameIsolated;
+	}
+	return false;
+}
+
+uint32 FKawaiiFluidSplashSelector::ComputeWeightFixed(const FKawaiiFluidSplashSettings& Settings, float Speed)
+{
+	const float Weight = FMath::Clamp(Speed / FMath::Max(Settings.VelocityThreshold, 1.0f), 1.0f, MaxWeight);
+	return static_cast<uint32>(Weight * WeightFixedScale + 0.5f);
+}
+
+float FKawaiiFluidSplashSelector::HashUnit(int32 ParticleID, uint32 FrameIndex, uint32 Stream)
+{
+	const uint32 Hash = PcgHash(static_cast<uint32>(ParticleID) ^ PcgHash(FrameIndex * 2u + Stream));
+	return static_cast<float>((Hash >> 8) + 1u) / 16777216.0f;
+}
+
+void FKawaiiFluidSplashSelector::CompactCandidates(
+	TConstArrayView<FVector3f> Positions,
+	TConstArrayView<FVector3f> Velocities,
+	TConstArrayView<uint32> NeighborCounts,
+	TConstArrayView<int32> ParticleIDs,
+	TBitArray<>& InOutWasIsolated,
+	const FKawaiiFluidSplashSettings& Settings,
+	uint32 FrameIndex,
+	TArray<FGPUSplashCandidate>& OutCandidates)
+{
+	OutCandidates.Reset();
+
+	const int32 NumParticles = Positions.Num();
+	if (Velocities.Num() != NumParticles || NeighborCounts.Num() != NumParticles || ParticleIDs.Num() != NumParticles)
+	{
+		return;
+	}
+
+	if (InOutWasIsolated.Num() != NumParticles)
+	{
+		InOutWasIsolated.Init(false, NumParticles);
+	}
+
+	// Pass 1: total candidate weight (isolation state is read, not updated)
+	uint64 TotalWeightFixed = 0;
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		const float Speed = Velocities[i].Size();
+		bool bWasIsolated = InOutWasIsolated[i];
+		if (EvaluateCondition(Settings, Speed, NeighborCounts[i], bWasIsolated))
+		{
+			TotalWeightFixed += ComputeWeightFixed(Settings, Speed);
+		}
+	}
+
+	// Pass 2: thin to ~Budget * Oversample candidates, emit keys, update isolation state
+	const float TargetCount = static_cast<float>(FMath::Max(Settings.Budget, 0) * Oversample);
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		const float Speed = Velocities[i].Size();
+		bool bWasIsolated = InOutWasIsolated[i];
+		const bool bCandidate = EvaluateCondition(Settings, Speed, NeighborCounts[i], bWasIsolated);
+		InOutWasIsolated[i] = bWasIsolated;
+
+		if (!bCandidate || TotalWeightFixed == 0)
+		{
+			continue;
+		}
+
+		const uint32 WeightFixed = ComputeWeightFixed(Settings, Speed);
+		const float AcceptProbability = FMath::Min(1.0f,
+			static_cast<float>(WeightFixed) * TargetCount / static_cast<float>(TotalWeightFixed));
+		if (HashUnit(ParticleIDs[i], FrameIndex, 0) > AcceptProbability || OutCandidates.Num() >= MaxCandidates)
+		{
+			continue;
+		}
+
+		FGPUSplashCandidate& Candidate = OutCandidates.AddDefaulted_GetRef();
+		Candidate.Position = Positions[i];
+		Candidate.Velocity = Velocities[i];
+		Candidate.ParticleID = ParticleIDs[i];
+		Candidate.Key = FMath::Pow(HashUnit(ParticleIDs[i], FrameIndex, 1), WeightFixedScale / static_cast<float>(WeightFixed));
+	}
+}
+
+void FKawaiiFluidSplashSelector::SelectTopCandidates(TArray<FGPUSplashCandidate>& InOutCandidates, int32 Budget)
+{
+	// Ties broken by ParticleID so the result does not depend on GPU append order
+	InOutCandidates.Sort([](const FGPUSplashCandidate& A, const FGPUSplashCandidate& B)
+	{
+		return A.Key != B.Key ? A.Key > B.Key : A.ParticleID < B.ParticleID;
+	});
+
+	if (InOutCandidates.Num() > Budget)
+	{
+		InOutCandidates.SetNum(FMath::Max(Budget, 0), EAllowShrinking::No);
+	}
+}
@@ -0,0 +1,111 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Data/KawaiiFluidPackingAsset.h"
+#include "Data/KawaiiFluidPresetDataAsset.h"
+
+namespace
+{
+	constexpr float QuantizationSteps = 65535.0f;
+}
+
+void UKawaiiFluidPackingAsset::Bake()
+{
+	if (!Preset)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UKawaiiFluidPackingAsset::Bake - No preset assigned (%s)"), *GetName());
+		return;
+	}
+
+	FKawaiiFluidPackingParams Params = FKawaiiFluidPackingParams::FromPreset(*Preset);
+	Params.Iterations = RelaxationIterations;
+	Params.Jitter = Jitter;
+	Params.Seed = Seed;
+
+	FKawaiiFluidPackingRelaxer Relaxer(GetShape(), Params);
+	const FKawaiiFluidPackingStats Stats = Relaxer.Relax();
+
+	SetPositions(Relaxer.GetPositions());
+	BakedParticleSpacing = Preset->ParticleSpacing;
+	RMSDensityDeviation = Stats.RMSDeviation;
+	MaxDensityDeviation = Stats.MaxDeviation;
+	MarkPackageDirty();
+
+	UE_LOG(LogTemp, Log, TEXT("UKawaiiFluidPackingAsset::Bake - %s: %d particles, density deviation RMS %.2f%% / max %.2f%% (seed lattice: %.2f%% / %.2f%%)"),
+		*GetName(), Stats.NumParticles,
+		Stats.RMSDeviation * 100.0f, Stats.MaxDeviation * 100.0f,
+		Stats.InitialRMSDeviation * 100.0f, Stats.InitialMaxDeviation * 100.0f);
+}
+
+FKawaiiFluidPackingShape UKawaiiFluidPackingAsset::GetShape() const
+{
+	switch (ShapeType)
+	{
+	case EKawaiiFluidEmitterShapeType::Cube:
+		return FKawaiiFluidPackingShape::MakeBox(CubeHalfSize);
+
+	case EKawaiiFluidEmitterShapeType::Cylinder:
+		return FKawaiiFluidPackingShape::MakeCylinder(CylinderRadius, CylinderHalfHeight);
+
+	case EKawaiiFluidEmitterShapeType::Sphere:
+	default:
+		return FKawaiiFluidPackingShape::MakeSphere(SphereRadius);
+	}
+}
+
+void UKawaiiFluidPackingAsset::SetPositions(TConstArrayView<FVector> LocalPositions)
+{
+	NumParticles = LocalPositions.Num();
+	LocalBounds = FBox(LocalPositions.GetData(), LocalPositions.Num());
+
+	QuantizedPositions.Empty(NumParticles * 3);
+	if (NumParticles == 0)
+	{
+		return;
+	}
+
+	const FVector Size = LocalBounds.GetSize();
+	const FVector Scale(
+		Size.X > 0.0 ? QuantizationSteps / Size.X : 0.0,
+		Size.Y > 0.0 ? QuantizationSteps / Size.Y : 0.0,
+		Size.Z > 0.0 ? QuantizationSteps / Size.Z : 0.0);
+
+	for (const FVector& Position : LocalPositions)
+	{
+		const FVector Normalized = (Position - LocalBounds.Min) * Scale;
+		QuantizedPositions.Add(static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Normalized.X), 0, 65535)));
+		QuantizedPositions.Add(static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Normalized.Y), 0, 65535)));
+		QuantizedPositions.Add(static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Normalized.Z), 0, 65535)));
+	}
+}
+
+void UKawaiiFluidPackingAsset::GetLocalPositions(TArray<FVector>& OutPositions) const
+{
+	OutPositions.Reset();
+	if (!IsBaked())
+	{
+		return;
+	}
+
+	const FVector Step = LocalBounds.GetSize() / QuantizationSteps;
+	OutPositions.SetNumUninitialized(NumParticles);
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		const uint16* Q = &QuantizedPositions[i * 3];
+		OutPositions[i] = LocalBounds.Min + FVector(Q[0], Q[1], Q[2]) * Step;
+	}
+}
+
+void UKawaiiFluidPackingAsset::GetPositions(const FTransform& Transform, TArray<FVector>& OutPositions) const
+{
+	GetLocalPositions(OutPositions);
+	for (FVector& Position : OutPositions)
+	{
+		Position = Transform.TransformPosition(Position);
+	}
+}
+
+float UKawaiiFluidPackingAsset::GetQuantizationError() const
+{
+	// Rounding to the nearest step: half a step per axis
+	return static_cast<float>(LocalBounds.GetSize().GetMax() / QuantizationSteps * 0.5);
+}
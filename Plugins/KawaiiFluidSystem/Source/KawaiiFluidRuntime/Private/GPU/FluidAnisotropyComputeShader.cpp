@@ -16,6 +16,10 @@ IMPLEMENT_GLOBAL_SHADER(FFluidAnisotropyCS,
 	"/Plugin/KawaiiFluidSystem/Private/FluidAnisotropyCompute.usf",
 	"MainCS", SF_Compute);
 
+IMPLEMENT_GLOBAL_SHADER(FFluidAnisotropyMarkActivityCS,
+	"/Plugin/KawaiiFluidSystem/Private/FluidAnisotropyCompute.usf",
+	"MarkActivityCS", SF_Compute);
+
 //=============================================================================
 // Pass Builder Implementation
 //=============================================================================
@@ -333,10 +337,91 @@ void FFluidAnisotropyPassBuilder::AddAnisotropyPass(
 	const int32 ThreadGroupSize = FFluidAnisotropyCS::ThreadGroupSize;
 	const int32 NumGroups = FMath::DivideAndRoundUp(Params.ParticleCount, ThreadGroupSize);
 
+	// =========================================================================
+	// Incremental Update (DensityBased only)
+	// =========================================================================
+	const bool bIncrementalUpdate = Params.bIncrementalUpdate
+		&& Params.Mode == EGPUAnisotropyMode::DensityBased
+		&& Params.ParticleIDsSRV && Params.NeighborCountsSRV && Params.AnisotropyHistoryUAV;
+
+	FRDGBufferSRVRef ParticleIDsSRV = Params.ParticleIDsSRV;
+	FRDGBufferSRVRef NeighborCountsSRV = Params.NeighborCountsSRV;
+	FRDGBufferUAVRef AnisotropyHistoryUAV = Params.AnisotropyHistoryUAV;
+	FRDGBufferUAVRef CellActivityUAV = nullptr;
+
+	if (bIncrementalUpdate)
+	{
+		FRDGBufferRef CellActivityBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), ANISOTROPY_CELL_ACTIVITY_WORDS),
+			TEXT("FluidAnisotropyCellActivity"));
+		CellActivityUAV = GraphBuilder.CreateUAV(CellActivityBuffer);
+		AddClearUAVPass(GraphBuilder, CellActivityUAV, 0u);
+
+		TShaderMapRef<FFluidAnisotropyMarkActivityCS> MarkShader(GlobalShaderMap, PermutationVector);
+		FFluidAnisotropyMarkActivityCS::FParameters* MarkParameters =
+			GraphBuilder.AllocParameters<FFluidAnisotropyMarkActivityCS::FParameters>();
+		MarkParameters->InPositions = Params.PositionsSRV;
+		MarkParameters->InParticleIDs = ParticleIDsSRV;
+		MarkParameters->InNeighborCounts = NeighborCountsSRV;
+		MarkParameters->AnisotropyHistory = AnisotropyHistoryUAV;
+		MarkParameters->CellActivity = CellActivityUAV;
+		MarkParameters->ParticleCountBuffer = Params.ParticleCountBufferSRV;
+		MarkParameters->CellSize = Params.CellSize;
+		MarkParameters->IncrementalMotionDistance = Params.IncrementalMotionDistance;
+		MarkParameters->IncrementalNeighborThreshold = static_cast<uint32>(FMath::Max(1, Params.IncrementalNeighborThreshold));
+		MarkParameters->PrevAnisotropyCount = static_cast<uint32>(FMath::Max(0, Params.PrevAnisotropyCount));
+
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("FluidAnisotropy::MarkActivity(%d)", Params.ParticleCount),
+			MarkShader,
+			MarkParameters,
+			FIntVector(NumGroups, 1, 1));
+	}
+	else
+	{
+		// Dummy bindings (never accessed when bIncrementalUpdate = 0)
+		if (!ParticleIDsSRV)
+		{
+			FRDGBufferRef DummyBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(int32), 1), TEXT("DummyParticleIDs_Anisotropy"));
+			int32 InvalidID = -1;
+			GraphBuilder.QueueBufferUpload(DummyBuffer, &InvalidID, sizeof(int32));
+			ParticleIDsSRV = GraphBuilder.CreateSRV(DummyBuffer, PF_R32_SINT);
+		}
+
+		if (!NeighborCountsSRV)
+		{
+			FRDGBufferRef DummyBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), 1), TEXT("DummyNeighborCounts_Anisotropy"));
+			uint32 ZeroData = 0;
+			GraphBuilder.QueueBufferUpload(DummyBuffer, &ZeroData, sizeof(uint32));
+			NeighborCountsSRV = GraphBuilder.CreateSRV(DummyBuffer, PF_R32_UINT);
+		}
+
+		if (!AnisotropyHistoryUAV)
+		{
+			FRDGBufferRef DummyBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FGPUAnisotropyHistory), 1), TEXT("DummyAnisotropyHistory"));
+			AnisotropyHistoryUAV = GraphBuilder.CreateUAV(DummyBuffer);
+		}
+
+		FRDGBufferRef DummyActivity = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 1), TEXT("DummyCellActivity_Anisotropy"));
+		CellActivityUAV = GraphBuilder.CreateUAV(DummyActivity);
+	}
+
+	PassParameters->InParticleIDs = ParticleIDsSRV;
+	PassParameters->InNeighborCounts = NeighborCountsSRV;
+	PassParameters->AnisotropyHistory = AnisotropyHistoryUAV;
+	PassParameters->CellActivity = CellActivityUAV;
+	PassParameters->bIncrementalUpdate = bIncrementalUpdate ? 1 : 0;
+	PassParameters->IncrementalMotionDistance = Params.IncrementalMotionDistance;
+	PassParameters->IncrementalNeighborThreshold = static_cast<uint32>(FMath::Max(1, Params.IncrementalNeighborThreshold));
+	PassParameters->IncrementalMaxStaleFrames = static_cast<uint32>(FMath::Max(1, Params.IncrementalMaxStaleFrames));
+	PassParameters->PrevAnisotropyCount = bIncrementalUpdate ? static_cast<uint32>(FMath::Max(0, Params.PrevAnisotropyCount)) : 0u;
+
 	FComputeShaderUtils::AddPass(
 		GraphBuilder,
-		RDG_EVENT_NAME("FluidAnisotropy(%d,Preset=%d,mode=%d,Hybrid=%d)",
-			Params.ParticleCount, static_cast<int32>(EffectivePreset), static_cast<int32>(Params.Mode), Params.bUseHybridTiledZOrder ? 1 : 0),
+		RDG_EVENT_NAME("FluidAnisotropy(%d,Preset=%d,mode=%d,Hybrid=%d,Incremental=%d)",
+			Params.ParticleCount, static_cast<int32>(EffectivePreset), static_cast<int32>(Params.Mode), Params.bUseHybridTiledZOrder ? 1 : 0,
+			bIncrementalUpdate ? 1 : 0),
 		ComputeShader,
 		PassParameters,
 		FIntVector(NumGroups, 1, 1));
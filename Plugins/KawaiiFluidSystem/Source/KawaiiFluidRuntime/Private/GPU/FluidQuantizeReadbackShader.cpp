@@ -0,0 +1,78 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "GPU/FluidQuantizeReadbackShader.h"
+#include "GPU/FluidQuantizedReadback.h"
+#include "GPU/GPUIndirectDispatchUtils.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "ShaderParameterUtils.h"
+#include "GlobalShader.h"
+
+//=============================================================================
+// Shader Implementation
+//=============================================================================
+
+IMPLEMENT_GLOBAL_SHADER(FInitQuantizeHeaderCS,
+	"/Plugin/KawaiiFluidSystem/Private/FluidQuantizeReadback.usf",
+	"InitQuantizeHeaderCS", SF_Compute);
+
+IMPLEMENT_GLOBAL_SHADER(FReduceQuantizeBoundsCS,
+	"/Plugin/KawaiiFluidSystem/Private/FluidQuantizeReadback.usf",
+	"ReduceQuantizeBoundsCS", SF_Compute);
+
+IMPLEMENT_GLOBAL_SHADER(FEncodeQuantizedCS,
+	"/Plugin/KawaiiFluidSystem/Private/FluidQuantizeReadback.usf",
+	"EncodeQuantizedCS", SF_Compute);
+
+//=============================================================================
+// Pass Setup
+//=============================================================================
+
+FRDGBufferRef AddQuantizeReadbackPasses(FRDGBuilder& GraphBuilder, FRDGBufferRef ParticleBuffer, FRDGBufferRef CountBuffer, int32 MaxParticleCount)
+{
+	const uint32 BufferSize = GPUQuantizedReadback::GetBufferSize(FMath::Max(MaxParticleCount, 1));
+	FRDGBufferRef QuantizedBuffer = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateByteAddressDesc(BufferSize), TEXT("QuantizedStatsBuffer"));
+
+	FGlobalShaderMap* GlobalShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+	FRDGBufferSRVRef ParticlesSRV = GraphBuilder.CreateSRV(ParticleBuffer);
+	FRDGBufferSRVRef CountSRV = GraphBuilder.CreateSRV(CountBuffer);
+	FRDGBufferUAVRef QuantizedUAV = GraphBuilder.CreateUAV(QuantizedBuffer);
+
+	auto MakeParameters = [&]()
+	{
+		FQuantizeReadbackParameters* PassParameters = GraphBuilder.AllocParameters<FQuantizeReadbackParameters>();
+		PassParameters->InParticles = ParticlesSRV;
+		PassParameters->ParticleCountBuffer = CountSRV;
+		PassParameters->OutQuantized = QuantizedUAV;
+		return PassParameters;
+	};
+
+	// Pass 1: Reset bounds, record count
+	{
+		TShaderMapRef<FInitQuantizeHeaderCS> ComputeShader(GlobalShaderMap);
+		FComputeShaderUtils::AddPass(GraphBuilder,
+			RDG_EVENT_NAME("GPUFluid::QuantizeReadback_Init"),
+			ComputeShader, MakeParameters(), FIntVector(1, 1, 1));
+	}
+
+	// Pass 2: Bounds reduction
+	{
+		TShaderMapRef<FReduceQuantizeBoundsCS> ComputeShader(GlobalShaderMap);
+		GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
+			RDG_EVENT_NAME("GPUFluid::QuantizeReadback_Bounds(Indirect)"),
+			ComputeShader, MakeParameters(), CountBuffer,
+			GPUIndirectDispatch::IndirectArgsOffset_TG256);
+	}
+
+	// Pass 3: Encode
+	{
+		TShaderMapRef<FEncodeQuantizedCS> ComputeShader(GlobalShaderMap);
+		GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
+			RDG_EVENT_NAME("GPUFluid::QuantizeReadback_Encode(Indirect)"),
+			ComputeShader, MakeParameters(), CountBuffer,
+			GPUIndirectDispatch::IndirectArgsOffset_TG256);
+	}
+
+	return QuantizedBuffer;
+}
@@ -0,0 +1,133 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "GPU/FluidQuantizedReadback.h"
+
+namespace GPUQuantizedReadback
+{
+	FBounds MakeBounds(const FVector3f& Min, const FVector3f& Max, int32 ParticleCount)
+	{
+		FBounds Bounds;
+		Bounds.Min = Min;
+		Bounds.Max = Max;
+		Bounds.ParticleCount = ParticleCount;
+
+		const FVector3f Extent = (Max - Min).ComponentMax(FVector3f(MinExtent));
+		Bounds.Step = Extent / 65535.0f;
+		return Bounds;
+	}
+
+	FBounds DecodeHeader(const FQuantizedReadbackHeader& Header)
+	{
+		// Header still in its reset state: no particle was reduced
+		if (Header.OrderedMin[0] == 0xFFFFFFFFu)
+		{
+			return FBounds();
+		}
+
+		const FVector3f Min(
+			OrderedUintToFloat(Header.OrderedMin[0]),
+			OrderedUintToFloat(Header.OrderedMin[1]),
+			OrderedUintToFloat(Header.OrderedMin[2]));
+		const FVector3f Max(
+			OrderedUintToFloat(~Header.InvOrderedMax[0]),
+			OrderedUintToFloat(~Header.InvOrderedMax[1]),
+			OrderedUintToFloat(~Header.InvOrderedMax[2]));
+
+		return MakeBounds(Min, Max, static_cast<int32>(Header.ParticleCount));
+	}
+
+	FVector2f OctEncode(const FVector3f& Direction)
+	{
+		const float L1 = FMath::Abs(Direction.X) + FMath::Abs(Direction.Y) + FMath::Abs(Direction.Z);
+		if (L1 <= 0.0f)
+		{
+			return FVector2f::ZeroVector;
+		}
+
+		const FVector3f N = Direction / L1;
+		if (N.Z >= 0.0f)
+		{
+			return FVector2f(N.X, N.Y);
+		}
+
+		// Fold the lower hemisphere over the diagonals
+		return FVector2f(
+			(1.0f - FMath::Abs(N.Y)) * (N.X >= 0.0f ? 1.0f : -1.0f),
+			(1.0f - FMath::Abs(N.X)) * (N.Y >= 0.0f ? 1.0f : -1.0f));
+	}
+
+	FVector3f OctDecode(const FVector2f& Encoded)
+	{
+		FVector3f N(Encoded.X, Encoded.Y, 1.0f - FMath::Abs(Encoded.X) - FMath::Abs(Encoded.Y));
+		const float T = FMath::Max(-N.Z, 0.0f);
+		N.X += N.X >= 0.0f ? -T : T;
+		N.Y += N.Y >= 0.0f ? -T : T;
+		return N.GetSafeNormal();
+	}
+
+	FVector3f DecodeVelocity(const FQuantizedParticleStats& Packed)
+	{
+		const float Speed = DecodeSpeed(Packed);
+		if (Speed <= 0.0f)
+		{
+			return FVector3f::ZeroVector;
+		}
+
+		const int16 U = static_cast<int16>(Packed.VelocityOct & 0xFFFF);
+		const int16 V = static_cast<int16>(Packed.VelocityOct >> 16);
+		const FVector2f Encoded(
+			FMath::Max(static_cast<float>(U) / 32767.0f, -1.0f),
+			FMath::Max(static_cast<float>(V) / 32767.0f, -1.0f));
+		return OctDecode(Encoded) * Speed;
+	}
+
+	FQuantizedReadbackHeader EncodeHeader(TConstArrayView<FGPUFluidParticle> Particles)
+	{
+		FQuantizedReadbackHeader Header;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Header.OrderedMin[Axis] = 0xFFFFFFFFu;
+			Header.InvOrderedMax[Axis] = 0xFFFFFFFFu;
+		}
+		Header.ParticleCount = static_cast<uint32>(Particles.Num());
+		Header.Padding = 0;
+
+		for (const FGPUFluidParticle& Particle : Particles)
+		{
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				const uint32 Ordered = FloatToOrderedUint(Particle.Position[Axis]);
+				Header.OrderedMin[Axis] = FMath::Min(Header.OrderedMin[Axis], Ordered);
+				Header.InvOrderedMax[Axis] = FMath::Min(Header.InvOrderedMax[Axis], ~Ordered);
+			}
+		}
+		return Header;
+	}
+
+	FQuantizedParticleStats EncodeParticle(const FGPUFluidParticle& Particle, const FBounds& Bounds)
+	{
+		const FVector3f Extent = Bounds.Step * 65535.0f;
+		uint32 Q[3];
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const float T = FMath::Clamp((Particle.Position[Axis] - Bounds.Min[Axis]) / Extent[Axis], 0.0f, 1.0f);
+			Q[Axis] = static_cast<uint32>(FMath::FloorToInt32(T * 65535.0f + 0.5f));
+		}
+
+		const float Speed = Particle.Velocity.Length();
+		const FVector2f Oct = Speed > 0.0f ? OctEncode(Particle.Velocity / Speed) : FVector2f::ZeroVector;
+		const int32 OctU = FMath::FloorToInt32(FMath::Clamp(Oct.X, -1.0f, 1.0f) * 32767.0f + 0.5f);
+		const int32 OctV = FMath::FloorToInt32(FMath::Clamp(Oct.Y, -1.0f, 1.0f) * 32767.0f + 0.5f);
+		const FFloat16 SpeedHalf(FMath::Min(Speed, MaxSpeed));
+
+		FQuantizedParticleStats Packed;
+		Packed.PositionXY = Q[0] | (Q[1] << 16);
+		Packed.PositionZSpeed = Q[2] | (static_cast<uint32>(SpeedHalf.Encoded) << 16);
+		Packed.VelocityOct = (static_cast<uint32>(OctU) & 0xFFFF) | ((static_cast<uint32>(OctV) & 0xFFFF) << 16);
+		Packed.ParticleID = Particle.ParticleID;
+		Packed.SourceNeighborFlags = (static_cast<uint32>(Particle.SourceID) & 0xFFFF)
+			| (FMath::Min(Particle.NeighborCount, MaxNeighborCount) << 16)
+			| ((Particle.Flags & FlagsMask) << 24);
+		return Packed;
+	}
+}
@@ -0,0 +1,19 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "GPU/FluidSplashCompactShader.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "ShaderParameterUtils.h"
+#include "GlobalShader.h"
+
+//=============================================================================
+// Shader Implementation
+//=============================================================================
+
+IMPLEMENT_GLOBAL_SHADER(FSplashWeightCS,
+	"/Plugin/KawaiiFluidSystem/Private/FluidSplashCompact.usf",
+	"SplashWeightCS", SF_Compute);
+
+IMPLEMENT_GLOBAL_SHADER(FSplashCompactCS,
+	"/Plugin/KawaiiFluidSystem/Private/FluidSplashCompact.usf",
+	"SplashCompactCS", SF_Compute);
@@ -5,6 +5,8 @@
 #include "GPU/GPUIndirectDispatchUtils.h"
 #include "GPU/FluidAnisotropyComputeShader.h"
 #include "GPU/FluidStatsCompactShader.h"
+#include "GPU/FluidQuantizeReadbackShader.h"
+#include "GPU/FluidQuantizedReadback.h"
 #include "GPU/FluidRecordZOrderIndicesShader.h"
 #include "GPU/Managers/GPUZOrderSortManager.h"
 #include "GPU/Managers/GPUBoundarySkinningManager.h"
@@ -54,6 +56,20 @@ static FAutoConsoleVariableRef CVarFluidCaptureFrameNumber(
 // Internal flag - reset when CVar is changed back to 1
 static int32 GFluidCapturedFrame = 0;  // Tracks which frame was captured (0 = none)
 
+/** Append ParticleID to Buckets[SourceID], growing the table to the SourceID (ids are dense from 0) */
+static FORCEINLINE void AddToSourceBucket(TArray<TArray<int32>>& Buckets, int32 SourceID, int32 ParticleID)
+{
+	if (SourceID < 0 || SourceID >= EGPUParticleSource::MaxSourceCount)
+	{
+		return;
+	}
+	if (SourceID >= Buckets.Num())
+	{
+		Buckets.SetNum(SourceID + 1);
+	}
+	Buckets[SourceID].Add(ParticleID);
+}
+
 //=============================================================================
 // Constructor / Destructor
 //=============================================================================
@@ -113,6 +129,13 @@ void FGPUFluidSimulator::Initialize(int32 InMaxParticleCount)
 	StaticBoundaryManager = MakeUnique<FGPUStaticBoundaryManager>();
 	StaticBoundaryManager->Initialize();
 
+	// Initialize SplashManager
+	SplashManager = MakeUnique<FGPUSplashManager>();
+	SplashManager->Initialize();
+
+	// Initialize readback channels (count, stats, debug indices, bounds)
+	InitializeReadbackScheduler();
+
 	// Initialize render resource on render thread
 	BeginInitResource(this);
 
@@ -174,6 +197,13 @@ void FGPUFluidSimulator::Release()
 		StaticBoundaryManager.Reset();
 	}
 
+	// Release SplashManager
+	if (SplashManager.IsValid())
+	{
+		SplashManager->Release();
+		SplashManager.Reset();
+	}
+
 	// Release Anisotropy Readback objects
 	ReleaseAnisotropyReadbackObjects();
 
@@ -183,26 +213,23 @@ void FGPUFluidSimulator::Release()
 	ReadyShadowNeighborCounts.Empty();
 	ReadyShadowPositionsFrame.store(0);
 
-	// Release Stats Readback objects
-	ReleaseStatsReadbackObjects();
-
-	// Release Debug Index Readback objects
-	ReleaseDebugIndexReadbackObjects();
-
-	// Release Particle Bounds Readback objects
-	ReleaseParticleBoundsReadbackObjects();
+	// Release count, stats, debug index and bounds readback objects
+	if (ReadbackScheduler.IsValid())
+	{
+		ReadbackScheduler->ReleaseResources();
+		ReadbackScheduler.Reset();
+	}
+	CountReadbackChannel = INDEX_NONE;
+	SpawnCountTracker.Reset();
+	StatsReadbackChannel = INDEX_NONE;
+	DebugIndexReadbackChannel = INDEX_NONE;
+	ParticleBoundsReadbackChannel = INDEX_NONE;
+	CachedParticleBounds = FBox(EForceInit::ForceInit);
+	ReadyParticleBoundsFrame.store(0);
+	ReadyZOrderIndicesFrame.store(0);
 
 	// Release Indirect Dispatch resources
 	PersistentParticleCountBuffer = nullptr;
-	for (int32 i = 0; i < NUM_COUNT_READBACK_BUFFERS; ++i)
-	{
-		if (CountReadbacks[i])
-		{
-			delete CountReadbacks[i];
-			CountReadbacks[i] = nullptr;
-		}
-	}
-	CountReadbackWriteIndex = 0;
 	bEverHadParticles = false;
 
 	bIsInitialized = false;
@@ -281,6 +308,10 @@ void FGPUFluidSimulator::ReleaseRHI()
 	BoneDeltaAttachmentBuffer.SafeRelease();
 	BoneDeltaAttachmentCapacity = 0;
 
+	// Release incremental anisotropy history
+	AnisotropyHistoryBuffer.SafeRelease();
+	AnisotropyHistoryCapacity = 0;
+
 	// Collision cleanup is handled by CollisionManager::Release()
 }
 
@@ -620,9 +651,14 @@ void FGPUFluidSimulator::SimulateSubstep_RDG(FRDGBuilder& GraphBuilder, const FG
 		}
 	}
 
+	// Incremental anisotropy history must follow the particles through the Z-Order sort
+	FRDGBufferRef AnisotropyHistoryBufferRDG = IsIncrementalAnisotropyEnabled()
+		? EnsureAnisotropyHistoryBuffer(GraphBuilder, AllocParticleCount)
+		: nullptr;
+
 	// =====================================================
 	// Phase 2: Build Spatial Structures (Predict -> Extract -> Sort -> Hash)
-	// Also reorders BoneDeltaAttachment buffer to stay synchronized with particles after Z-Order sorting
+	// Also reorders BoneDeltaAttachment and anisotropy history buffers to stay synchronized with particles after Z-Order sorting
 	// =====================================================
 	FSimulationSpatialData SpatialData = BuildSpatialStructures(
 		GraphBuilder,
@@ -632,7 +668,9 @@ void FGPUFluidSimulator::SimulateSubstep_RDG(FRDGBuilder& GraphBuilder, const FG
 		PositionsSRVLocal,
 		PositionsUAVLocal,
 		Params,
-		BoneDeltaAttachmentBufferRDG ? &BoneDeltaAttachmentBufferRDG : nullptr);
+		BoneDeltaAttachmentBufferRDG ? &BoneDeltaAttachmentBufferRDG : nullptr,
+		AnisotropyHistoryBufferRDG ? &AnisotropyHistoryBufferRDG : nullptr);
+	SpatialData.AnisotropyHistoryBuffer = AnisotropyHistoryBufferRDG;
 
 	// If we pre-computed WorldBoundaryParticles in Phase 1.5, store it in SpatialData
 	// This ensures the data is available for density calculations and other passes
@@ -900,9 +938,13 @@ void FGPUFluidSimulator::BeginFrame()
 			Self->ProcessCollisionFeedbackReadback(RHICmdList);
 			Self->ProcessColliderContactCountReadback(RHICmdList);
 
-			// Process particle count readback FIRST so CurrentParticleCount is
-			// GPU-accurate before ProcessStatsReadback uses it as iteration bound
-			Self->ProcessParticleCountReadback();
+			// Count, debug index and bounds readbacks in one pass. Count is registered first,
+			// so CurrentParticleCount is GPU-accurate before ProcessStatsReadback uses it as iteration bound
+			if (Self->ReadbackScheduler.IsValid())
+			{
+				SCOPED_DRAW_EVENT(RHICmdList, GPUFluid_BeginFrame_ReadbackScheduler);
+				Self->ReadbackScheduler->ProcessCompleted(GFrameCounterRenderThread);
+			}
 
 			// Process stats readback - also extracts shadow data if bShadowReadbackEnabled
 			const bool bNeedStatsReadback = GetFluidStatsCollector().IsAnyReadbackNeeded();
@@ -921,18 +963,11 @@ void FGPUFluidSimulator::BeginFrame()
 				Self->ProcessAnisotropyReadback();
 			}
 
-			// Debug Z-Order index readback (for visualization)
-			if (Self->bDebugZOrderIndexEnabled.load())
-			{
-				SCOPED_DRAW_EVENT(RHICmdList, GPUFluid_BeginFrame_DebugIndex);
-				Self->ProcessDebugIndexReadback();
-			}
-
-			// Particle bounds readback (for Unlimited Simulation Range world collision)
-			if (Self->bParticleBoundsReadbackEnabled.load())
+			// Splash candidate readback (small compacted list)
+			if (Self->SplashManager.IsValid() && Self->SplashManager->IsEnabled())
 			{
-				SCOPED_DRAW_EVENT(RHICmdList, GPUFluid_BeginFrame_ParticleBounds);
-				Self->ProcessParticleBoundsReadback();
+				SCOPED_DRAW_EVENT(RHICmdList, GPUFluid_BeginFrame_Splash);
+				Self->SplashManager->ProcessReadback();
 			}
 
 			if (Self->SpawnManager.IsValid())
@@ -1036,6 +1071,7 @@ void FGPUFluidSimulator::BeginFrame()
 
 					// Estimate for CPU side (will be corrected by readback next frame)
 					Self->CurrentParticleCount = FMath::Min(SpawnCount, Self->MaxParticleCount);
+					Self->RecordSpawnForCountReadback(SpawnCount);
 					Self->SpawnManager->OnSpawnComplete(Self->CurrentParticleCount);
 				}
 				else
@@ -1113,6 +1149,7 @@ void FGPUFluidSimulator::BeginFrame()
 
 					// Estimate for CPU side (will be corrected by readback next frame)
 					Self->CurrentParticleCount = FMath::Min(TotalCount, Self->MaxParticleCount);
+					Self->RecordSpawnForCountReadback(SpawnCount);
 					Self->SpawnManager->OnSpawnComplete(SpawnCount);
 					ParticleBuffer = NewParticleBuffer;
 				}
@@ -1205,11 +1242,34 @@ void FGPUFluidSimulator::EndFrame()
 						Self->AddRecordZOrderIndicesPass(GraphBuilder, ParticleBuffer, Self->CurrentParticleCount);
 					}
 
+					// Splash candidate compaction (updates isolation flags, reads back only the candidate list)
+					if (Self->SplashManager.IsValid() && Self->SplashManager->IsEnabled())
+					{
+						FRDGBufferRef SplashCountBuffer = GraphBuilder.RegisterExternalBuffer(
+							Self->PersistentParticleCountBuffer, TEXT("ParticleCountBuffer_Splash"));
+						Self->SplashManager->AddSplashCompactionPasses(GraphBuilder, ParticleBuffer, SplashCountBuffer);
+					}
+
 					const int32 ParticleCount = Self->CurrentParticleCount;
 					const bool bNeedDetailedStats = GetFluidStatsCollector().IsDetailedGPUEnabled();
 					const bool bNeedVelocity = Self->bFullReadbackEnabled.load() || Self->bShadowReadbackEnabled.load();
 
-					if (bNeedDetailedStats || bNeedVelocity)
+					if (!bNeedDetailedStats && Self->bQuantizedReadbackEnabled.load())
+					{
+						// Quantized 20-byte readback (position, velocity, IDs, neighbor count, flags)
+						FRDGBufferRef CountBuffer = GraphBuilder.RegisterExternalBuffer(
+							Self->PersistentParticleCountBuffer, TEXT("ParticleCountBuffer_QuantizeReadback"));
+						FRDGBufferRef QuantizedBuffer = AddQuantizeReadbackPasses(GraphBuilder, ParticleBuffer, CountBuffer, ParticleCount);
+
+						AddReadbackBufferPass(GraphBuilder,
+							RDG_EVENT_NAME("GPUFluid::ZOrderReadback(Quantized)"),
+							QuantizedBuffer,
+							[Self, QuantizedBuffer, ParticleCount](FRHICommandListImmediate& InRHICmdList)
+							{
+								Self->EnqueueStatsReadback(InRHICmdList, QuantizedBuffer->GetRHI(), ParticleCount, EGPUStatsReadbackFormat::Quantized);
+							});
+					}
+					else if (bNeedDetailedStats || bNeedVelocity)
 					{
 						// Full 64-byte readback (Z-Order state, no sort)
 						AddReadbackBufferPass(GraphBuilder,
@@ -1217,7 +1277,7 @@ void FGPUFluidSimulator::EndFrame()
 							ParticleBuffer,
 							[Self, ParticleBuffer, ParticleCount](FRHICommandListImmediate& InRHICmdList)
 							{
-								Self->EnqueueStatsReadback(InRHICmdList, ParticleBuffer->GetRHI(), ParticleCount, /*bCompactMode=*/false);
+								Self->EnqueueStatsReadback(InRHICmdList, ParticleBuffer->GetRHI(), ParticleCount, EGPUStatsReadbackFormat::Full);
 							});
 					}
 					else
@@ -1255,7 +1315,7 @@ void FGPUFluidSimulator::EndFrame()
 							CompactBuffer,
 							[Self, CompactBuffer, ParticleCount](FRHICommandListImmediate& InRHICmdList)
 							{
-								Self->EnqueueStatsReadback(InRHICmdList, CompactBuffer->GetRHI(), ParticleCount, /*bCompactMode=*/true);
+								Self->EnqueueStatsReadback(InRHICmdList, CompactBuffer->GetRHI(), ParticleCount, EGPUStatsReadbackFormat::Compact);
 							});
 					}
 
@@ -1326,60 +1386,70 @@ FRDGBufferRef FGPUFluidSimulator::RegisterParticleCountBuffer(FRDGBuilder& Graph
 
 void FGPUFluidSimulator::EnqueueParticleCountReadback(FRHICommandListImmediate& RHICmdList)
 {
-	if (!PersistentParticleCountBuffer.IsValid())
+	if (!PersistentParticleCountBuffer.IsValid() || !ReadbackScheduler.IsValid())
 	{
 		return;
 	}
 
-	const int32 WriteIdx = CountReadbackWriteIndex;
-	CountReadbackWriteIndex = (CountReadbackWriteIndex + 1) % NUM_COUNT_READBACK_BUFFERS;
-
-	if (!CountReadbacks[WriteIdx])
-	{
-		CountReadbacks[WriteIdx] = new FRHIGPUBufferReadback(*FString::Printf(TEXT("ParticleCountReadback_%d"), WriteIdx));
-	}
-
-	CountReadbacks[WriteIdx]->EnqueueCopy(RHICmdList, PersistentParticleCountBuffer->GetRHI(), GPUIndirectDispatch::BufferSizeBytes);
-	bCountReadbackValid[WriteIdx] = true;
+	// Tag the copy with the last spawn batch it includes (spawns of this frame were enqueued in BeginFrame)
+	FRHIBuffer* SourceBuffer = PersistentParticleCountBuffer->GetRHI();
+	const int32 SpawnTag = static_cast<int32>(SpawnCountTracker.GetSpawnSequence());
+	ReadbackScheduler->GetChannel(CountReadbackChannel).Enqueue(GFrameCounterRenderThread, GPUIndirectDispatch::BufferSizeBytes, SpawnTag, 0,
+		[&RHICmdList, SourceBuffer](FRHIGPUBufferReadback& Readback)
+		{
+			Readback.EnqueueCopy(RHICmdList, SourceBuffer, GPUIndirectDispatch::BufferSizeBytes);
+		});
 }
 
-void FGPUFluidSimulator::ProcessParticleCountReadback()
+void FGPUFluidSimulator::RecordSpawnForCountReadback(int32 SpawnCount)
 {
-	// Find newest valid ready readback (most up-to-date GPU count)
-	int32 ReadIdx = -1;
-	for (int32 i = 0; i < NUM_COUNT_READBACK_BUFFERS; ++i)
-	{
-		if (CountReadbacks[i] && bCountReadbackValid[i] && CountReadbacks[i]->IsReady())
-		{
-			ReadIdx = i;
-		}
-	}
+	// In-flight copies stay valid: they still carry GPU-side despawns and removals,
+	// and the batches they predate are added back when they are consumed
+	SpawnCountTracker.RecordSpawn(SpawnCount);
+}
 
-	if (ReadIdx < 0)
+void FGPUFluidSimulator::ResetParticleCountReadback()
+{
+	// Readbacks enqueued before a full upload describe a different particle set
+	SpawnCountTracker.Reset();
+	if (ReadbackScheduler.IsValid())
 	{
-		return;
+		ReadbackScheduler->GetChannel(CountReadbackChannel).Invalidate();
 	}
+}
 
-	const uint32* Data = static_cast<const uint32*>(CountReadbacks[ReadIdx]->Lock(GPUIndirectDispatch::BufferSizeBytes));
-	if (Data)
-	{
-		const int32 GPUCount = static_cast<int32>(Data[GPUIndirectDispatch::ParticleCountElementIndex]);
-		CurrentParticleCount = GPUCount;
-
-		// Consumed: mark this slot invalid so it won't be re-read
-		bCountReadbackValid[ReadIdx] = false;
+void FGPUFluidSimulator::InitializeReadbackScheduler()
+{
+	ReadbackScheduler = MakeUnique<FGPUReadbackScheduler>();
 
-		// When GPU confirms 0 particles, invalidate all remaining slots.
-		// Prevents stale zero-readbacks from overwriting spawn estimates on next spawn cycle.
-		if (GPUCount == 0)
+	// Registration order is processing order: count first (stats/despawn use CurrentParticleCount)
+	CountReadbackChannel = ReadbackScheduler->AddChannel(TEXT("ParticleCountReadback"));
+	ReadbackScheduler->SetConsumer<uint32>(CountReadbackChannel,
+		[this](TConstArrayView<uint32> Data, const FGPUReadbackSlotInfo& Info)
 		{
-			for (int32 i = 0; i < NUM_COUNT_READBACK_BUFFERS; ++i)
+			if (Data.IsValidIndex(GPUIndirectDispatch::ParticleCountElementIndex))
 			{
-				bCountReadbackValid[i] = false;
+				const int32 GPUCount = static_cast<int32>(Data[GPUIndirectDispatch::ParticleCountElementIndex]);
+				CurrentParticleCount = SpawnCountTracker.Reconcile(static_cast<uint32>(Info.Payload), GPUCount, MaxParticleCount);
 			}
-		}
-	}
-	CountReadbacks[ReadIdx]->Unlock();
+		});
+
+	DebugIndexReadbackChannel = ReadbackScheduler->AddChannel(TEXT("DebugIndexReadback"));
+	ReadbackScheduler->SetConsumer<int32>(DebugIndexReadbackChannel,
+		[this](TConstArrayView<int32> Data, const FGPUReadbackSlotInfo& Info)
+		{
+			ConsumeDebugIndexReadback(Data, Info);
+		});
+
+	ParticleBoundsReadbackChannel = ReadbackScheduler->AddChannel(TEXT("ParticleBoundsReadback"));
+	ReadbackScheduler->SetConsumer<FVector3f>(ParticleBoundsReadbackChannel,
+		[this](TConstArrayView<FVector3f> Data, const FGPUReadbackSlotInfo& Info)
+		{
+			ConsumeParticleBoundsReadback(Data, Info);
+		});
+
+	// No consumer: driven by ProcessStatsReadback
+	StatsReadbackChannel = ReadbackScheduler->AddChannel(TEXT("StatsReadback"));
 }
 
 FRDGBufferRef FGPUFluidSimulator::PrepareParticleBuffer(
@@ -1460,6 +1530,7 @@ FRDGBufferRef FGPUFluidSimulator::PrepareParticleBuffer(
 
 		CurrentParticleCount = BufferCapacity;
 		PreviousParticleCount = CurrentParticleCount;
+		ResetParticleCountReadback();
 		bNeedsFullUpload = false;
 
 		// UE_LOG(LogGPUFluidSimulator, Log, TEXT("PATH 1 (CPU Upload): Uploaded %d particles from CPU to GPU"), BufferCapacity);
@@ -1488,7 +1559,8 @@ FSimulationSpatialData FGPUFluidSimulator::BuildSpatialStructures(
 	FRDGBufferSRVRef& OutPositionsSRV,
 	FRDGBufferUAVRef& OutPositionsUAV,
 	const FGPUFluidSimulationParams& Params,
-	FRDGBufferRef* InOutAttachmentBuffer)
+	FRDGBufferRef* InOutAttachmentBuffer,
+	FRDGBufferRef* InOutAnisotropyHistoryBuffer)
 {
 	RDG_EVENT_SCOPE(GraphBuilder, "GPUFluid_BuildSpatialStructures");
 
@@ -1519,6 +1591,10 @@ FSimulationSpatialData FGPUFluidSimulator::BuildSpatialStructures(
 		FRDGBufferRef InAttachment = (InOutAttachmentBuffer && *InOutAttachmentBuffer) ? *InOutAttachmentBuffer : nullptr;
 		FRDGBufferRef SortedAttachment = nullptr;
 
+		// Pass anisotropy history for reordering if provided
+		FRDGBufferRef InAnisotropyHistory = (InOutAnisotropyHistoryBuffer && *InOutAnisotropyHistoryBuffer) ? *InOutAnisotropyHistoryBuffer : nullptr;
+		FRDGBufferRef SortedAnisotropyHistory = nullptr;
+
 		FRDGBufferRef SortedParticleBuffer = ExecuteZOrderSortingPipeline(
 			GraphBuilder, InOutParticleBuffer,
 			CellStartUAVLocal, SpatialData.CellStartSRV,
@@ -1526,7 +1602,9 @@ FSimulationSpatialData FGPUFluidSimulator::BuildSpatialStructures(
 			SpatialData.CellStartBuffer, SpatialData.CellEndBuffer,
 			Params,
 			InAttachment,
-			InAttachment ? &SortedAttachment : nullptr);
+			InAttachment ? &SortedAttachment : nullptr,
+			InAnisotropyHistory,
+			InAnisotropyHistory ? &SortedAnisotropyHistory : nullptr);
 
 		// Replace attachment buffer with sorted version if provided
 		if (InOutAttachmentBuffer && SortedAttachment)
@@ -1534,6 +1612,12 @@ FSimulationSpatialData FGPUFluidSimulator::BuildSpatialStructures(
 			*InOutAttachmentBuffer = SortedAttachment;
 		}
 
+		// Replace anisotropy history with sorted version if provided
+		if (InOutAnisotropyHistoryBuffer && SortedAnisotropyHistory)
+		{
+			*InOutAnisotropyHistoryBuffer = SortedAnisotropyHistory;
+		}
+
 		// Replace particle buffer with sorted version
 		InOutParticleBuffer = SortedParticleBuffer;
 		OutParticlesUAV = GraphBuilder.CreateUAV(InOutParticleBuffer);
@@ -1767,6 +1851,7 @@ void FGPUFluidSimulator::ExecuteConstraintSolverLoop(
 		AddBoundsCollisionPass(GraphBuilder, SpatialData, Params);
 		AddPrimitiveCollisionPass(GraphBuilder, SpatialData, Params);
 		AddHeightmapCollisionPass(GraphBuilder, SpatialData, Params);
+		AddSDFBrickCollisionPass(GraphBuilder, SpatialData, Params);
 	}
 
 	// Create SRVs for use in subsequent passes
@@ -1948,7 +2033,33 @@ void FGPUFluidSimulator::ExecutePostSimulation(
 				PersistentAnisotropyAxis3Buffer.IsValid() &&
 				PersistentAnisotropyAxis1Buffer->GetSize() >= static_cast<uint32>(CurrentParticleCount * sizeof(FVector4f));
 
-			if (bHasPersistentAnisotropyBuffers)
+			// Incremental update reads last pass's axes while writing new ones, so it ping-pongs
+			// instead of updating in place. Persistent buffers smaller than the current count are
+			// still usable: particles beyond PrevAnisotropyCount are simply recomputed.
+			const bool bIncrementalAnisotropy =
+				IsIncrementalAnisotropyEnabled() &&
+				SpatialData.AnisotropyHistoryBuffer != nullptr &&
+				PersistentAnisotropyAxis1Buffer.IsValid() &&
+				PersistentAnisotropyAxis2Buffer.IsValid() &&
+				PersistentAnisotropyAxis3Buffer.IsValid();
+
+			FRDGBufferRef PrevAxis1Buffer = nullptr;
+			FRDGBufferRef PrevAxis2Buffer = nullptr;
+			FRDGBufferRef PrevAxis3Buffer = nullptr;
+
+			if (bIncrementalAnisotropy)
+			{
+				PrevAxis1Buffer = GraphBuilder.RegisterExternalBuffer(
+					PersistentAnisotropyAxis1Buffer, TEXT("FluidAnisotropyAxis1.Prev"));
+				PrevAxis2Buffer = GraphBuilder.RegisterExternalBuffer(
+					PersistentAnisotropyAxis2Buffer, TEXT("FluidAnisotropyAxis2.Prev"));
+				PrevAxis3Buffer = GraphBuilder.RegisterExternalBuffer(
+					PersistentAnisotropyAxis3Buffer, TEXT("FluidAnisotropyAxis3.Prev"));
+
+				FFluidAnisotropyPassBuilder::CreateAnisotropyBuffers(
+					GraphBuilder, CurrentParticleCount, Axis1Buffer, Axis2Buffer, Axis3Buffer);
+			}
+			else if (bHasPersistentAnisotropyBuffers)
 			{
 				// Reuse persistent buffers (contains previous frame's anisotropy for temporal smoothing)
 				Axis1Buffer = GraphBuilder.RegisterExternalBuffer(
@@ -2167,6 +2278,28 @@ void FGPUFluidSimulator::ExecutePostSimulation(
 					}
 				}
 
+				// Incremental update: reuse last pass's ellipsoid where the neighborhood is calm
+				// History is written whenever incremental mode is on, so the first pass after enabling seeds it
+				if (IsIncrementalAnisotropyEnabled() && SpatialData.AnisotropyHistoryBuffer != nullptr
+					&& SpatialData.SoA_ParticleIDs != nullptr && SpatialData.SoA_NeighborCounts != nullptr)
+				{
+					AnisotropyParams.bIncrementalUpdate = true;
+					AnisotropyParams.ParticleIDsSRV = GraphBuilder.CreateSRV(SpatialData.SoA_ParticleIDs, PF_R32_SINT);
+					AnisotropyParams.NeighborCountsSRV = GraphBuilder.CreateSRV(SpatialData.SoA_NeighborCounts, PF_R32_UINT);
+					AnisotropyParams.AnisotropyHistoryUAV = GraphBuilder.CreateUAV(SpatialData.AnisotropyHistoryBuffer);
+					AnisotropyParams.IncrementalMotionDistance = CachedAnisotropyParams.IncrementalMotionThreshold * Params.SmoothingRadius;
+					AnisotropyParams.IncrementalNeighborThreshold = CachedAnisotropyParams.IncrementalNeighborThreshold;
+					AnisotropyParams.IncrementalMaxStaleFrames = CachedAnisotropyParams.IncrementalMaxStaleFrames;
+
+					if (bIncrementalAnisotropy)
+					{
+						AnisotropyParams.PrevAxis1SRV = GraphBuilder.CreateSRV(PrevAxis1Buffer);
+						AnisotropyParams.PrevAxis2SRV = GraphBuilder.CreateSRV(PrevAxis2Buffer);
+						AnisotropyParams.PrevAxis3SRV = GraphBuilder.CreateSRV(PrevAxis3Buffer);
+						AnisotropyParams.PrevAnisotropyCount = static_cast<int32>(PersistentAnisotropyAxis1Buffer->GetSize() / sizeof(FVector4f));
+					}
+				}
+
 				FFluidAnisotropyPassBuilder::AddAnisotropyPass(GraphBuilder, AnisotropyParams);
 
 				GraphBuilder.QueueBufferExtraction(Axis1Buffer, &PersistentAnisotropyAxis1Buffer, ERHIAccess::SRVCompute);
@@ -2231,6 +2364,15 @@ void FGPUFluidSimulator::ExtractPersistentBuffers(
 	{
 		GraphBuilder.QueueBufferExtraction(SpatialData.BoneDeltaAttachmentBuffer, &BoneDeltaAttachmentBuffer, ERHIAccess::UAVCompute);
 	}
+
+	// =====================================================
+	// Extract incremental anisotropy history for next frame
+	// Sorted with particles, so it stays aligned with PersistentAnisotropyAxis buffers
+	// =====================================================
+	if (SpatialData.AnisotropyHistoryBuffer)
+	{
+		GraphBuilder.QueueBufferExtraction(SpatialData.AnisotropyHistoryBuffer, &AnisotropyHistoryBuffer, ERHIAccess::UAVCompute);
+	}
 }
 
 void FGPUFluidSimulator::SwapNeighborCacheBuffers()
@@ -2276,7 +2418,7 @@ void FGPUFluidSimulator::AddSpawnRequest(const FVector3f& Position, const FVecto
 	if (SpawnManager.IsValid()) { SpawnManager->AddSpawnRequest(Position, Velocity, Mass); }
 }
 
-void FGPUFluidSimulator::AddSpawnRequests(const TArray<FGPUSpawnRequest>& Requests)
+void FGPUFluidSimulator::AddSpawnRequests(TConstArrayView<FGPUSpawnRequest> Requests)
 {
 	if (SpawnManager.IsValid()) { SpawnManager->AddSpawnRequests(Requests); }
 }
@@ -2297,6 +2439,14 @@ void FGPUFluidSimulator::AddGPUDespawnSourceRequest(int32 SourceID)
 	}
 }
 
+void FGPUFluidSimulator::AddGPUDespawnIDRequests(TConstArrayView<int32> ParticleIDs)
+{
+	if (SpawnManager.IsValid())
+	{
+		SpawnManager->AddGPUDespawnIDRequests(ParticleIDs);
+	}
+}
+
 void FGPUFluidSimulator::SetSourceEmitterMax(int32 SourceID, int32 MaxCount)
 {
 	if (SpawnManager.IsValid())
@@ -2305,7 +2455,8 @@ void FGPUFluidSimulator::SetSourceEmitterMax(int32 SourceID, int32 MaxCount)
 	}
 }
 
-bool FGPUFluidSimulator::GetParticlePositionsAndIDs(TArray<FVector3f>& OutPositions, TArray<int32>& OutParticleIDs, TArray<int32>& OutSourceIDs)
+bool FGPUFluidSimulator::GetParticlePositionsAndIDs(TArray<FVector3f>& OutPositions, TArray<int32>& OutParticleIDs, TArray<int32>& OutSourceIDs,
+	TArray<FVector3f>* OutVelocities)
 {
 	if (!bHasValidGPUResults.load())
 	{
@@ -2322,6 +2473,10 @@ bool FGPUFluidSimulator::GetParticlePositionsAndIDs(TArray<FVector3f>& OutPositi
 	OutPositions = CachedParticlePositions;
 	OutParticleIDs = CachedAllParticleIDs;
 	OutSourceIDs = CachedParticleSourceIDs;
+	if (OutVelocities)
+	{
+		*OutVelocities = CachedParticleVelocities;
+	}
 	return true;
 }
 
@@ -2376,6 +2531,22 @@ const TArray<int32>* FGPUFluidSimulator::GetAllParticleIDs() const
 	return &CachedAllParticleIDs;
 }
 
+int32 FGPUFluidSimulator::FindParticleIndexByID(int32 ParticleID) const
+{
+	if (!bHasValidGPUResults.load())
+	{
+		return INDEX_NONE;
+	}
+
+	FScopeLock Lock(&const_cast<FCriticalSection&>(BufferLock));
+	if (bParticleIDMapDirty)
+	{
+		CachedParticleIDMap.Rebuild(CachedAllParticleIDs);
+		bParticleIDMapDirty = false;
+	}
+	return CachedParticleIDMap.FindSlot(ParticleID);
+}
+
 const TArray<uint32>* FGPUFluidSimulator::GetParticleFlags() const
 {
 	if (!bHasValidGPUResults.load())
@@ -2649,6 +2820,40 @@ FRDGBufferRef FGPUFluidSimulator::EnsureBoneDeltaAttachmentBuffer(
 	}
 }
 
+//=============================================================================
+// Incremental Anisotropy History Buffer Management
+//=============================================================================
+
+FRDGBufferRef FGPUFluidSimulator::EnsureAnisotropyHistoryBuffer(
+	FRDGBuilder& GraphBuilder,
+	int32 RequiredCapacity)
+{
+	if (AnisotropyHistoryCapacity < RequiredCapacity || !AnisotropyHistoryBuffer.IsValid())
+	{
+		// Default records are empty (ParticleID = -1), so every particle is recomputed on the next pass.
+		// Old records are not preserved on resize: the history is only a cache of the previous ellipsoids.
+		TArray<FGPUAnisotropyHistory> InitialData;
+		InitialData.SetNum(RequiredCapacity);
+
+		FRDGBufferRef NewBuffer = CreateStructuredBuffer(
+			GraphBuilder,
+			TEXT("GPUFluidAnisotropyHistory"),
+			sizeof(FGPUAnisotropyHistory),
+			RequiredCapacity,
+			InitialData.GetData(),
+			RequiredCapacity * sizeof(FGPUAnisotropyHistory),
+			ERDGInitialDataFlags::None);
+
+		AnisotropyHistoryCapacity = RequiredCapacity;
+
+		UE_LOG(LogGPUFluidSimulator, Verbose, TEXT("Created new AnisotropyHistory buffer with capacity: %d"), RequiredCapacity);
+
+		return NewBuffer;
+	}
+
+	return GraphBuilder.RegisterExternalBuffer(AnisotropyHistoryBuffer, TEXT("GPUFluidAnisotropyHistory"));
+}
+
 //=============================================================================
 // Z-Order Sorting (Delegated to FGPUZOrderSortManager)
 //=============================================================================
@@ -2660,7 +2865,9 @@ FRDGBufferRef FGPUFluidSimulator::ExecuteZOrderSortingPipeline(
 	FRDGBufferRef& OutCellStartBuffer, FRDGBufferRef& OutCellEndBuffer,
 	const FGPUFluidSimulationParams& Params,
 	FRDGBufferRef InAttachmentBuffer,
-	FRDGBufferRef* OutSortedAttachmentBuffer)
+	FRDGBufferRef* OutSortedAttachmentBuffer,
+	FRDGBufferRef InAnisotropyHistoryBuffer,
+	FRDGBufferRef* OutSortedAnisotropyHistoryBuffer)
 {
 	// Check both manager validity AND enabled flag
 	if (!ZOrderSortManager.IsValid() || !ZOrderSortManager->IsZOrderSortingEnabled())
@@ -2673,7 +2880,8 @@ FRDGBufferRef FGPUFluidSimulator::ExecuteZOrderSortingPipeline(
 		OutCellStartBuffer, OutCellEndBuffer,
 		CurrentParticleCount, Params, SortAllocCount,
 		InAttachmentBuffer, OutSortedAttachmentBuffer,
-		CurrentIndirectArgsBuffer);
+		CurrentIndirectArgsBuffer,
+		InAnisotropyHistoryBuffer, OutSortedAnisotropyHistoryBuffer);
 }
 
 //=============================================================================
@@ -2892,23 +3100,20 @@ void FGPUFluidSimulator::FinalizeUpload()
 
 		// Build readback cache at upload time (immediately usable in ClearAllParticles etc.)
 		// Build cache immediately from CPU data without waiting for GPU readback
-		constexpr int32 MaxSources = EGPUParticleSource::MaxSourceCount;
-		CachedSourceIDToParticleIDs.SetNum(MaxSources);
-		for (int32 i = 0; i < MaxSources; ++i)
+		// Sparse: one bucket per SourceID up to the highest one present
+		for (TArray<int32>& Bucket : CachedSourceIDToParticleIDs)
 		{
-			CachedSourceIDToParticleIDs[i].Reset();
+			Bucket.Reset();
 		}
 		CachedAllParticleIDs.Empty();
 		CachedAllParticleIDs.Reserve(ParticleCount);
 
 		for (const FGPUFluidParticle& P : CachedGPUParticles)
 		{
-			if (P.SourceID >= 0 && P.SourceID < MaxSources)
-			{
-				CachedSourceIDToParticleIDs[P.SourceID].Add(P.ParticleID);
-			}
+			AddToSourceBucket(CachedSourceIDToParticleIDs, P.SourceID, P.ParticleID);
 			CachedAllParticleIDs.Add(P.ParticleID);
 		}
+		bParticleIDMapDirty = true;
 
 		bHasValidGPUResults.store(true);
 		UE_LOG(LogGPUFluidSimulator, Log, TEXT("FinalizeUpload: Built readback cache for %d particles"), ParticleCount);
@@ -3164,12 +3369,14 @@ void FGPUFluidSimulator::DownloadParticles(TArray<FFluidParticle>& OutCPUParticl
 	}
 
 	// Build ParticleID -> CPU index map for matching
-	TMap<int32, int32> ParticleIDToIndex;
-	ParticleIDToIndex.Reserve(OutCPUParticles.Num());
+	TArray<int32> CPUParticleIDs;
+	CPUParticleIDs.SetNumUninitialized(OutCPUParticles.Num());
 	for (int32 i = 0; i < OutCPUParticles.Num(); ++i)
 	{
-		ParticleIDToIndex.Add(OutCPUParticles[i].ParticleID, i);
+		CPUParticleIDs[i] = OutCPUParticles[i].ParticleID;
 	}
+	FKawaiiFluidParticleIDMap ParticleIDToIndex;
+	ParticleIDToIndex.Rebuild(CPUParticleIDs);
 
 	// Debug: Log first particle before conversion - disabled for performance
 	// static int32 DebugFrameCounter = 0;
@@ -3189,9 +3396,10 @@ void FGPUFluidSimulator::DownloadParticles(TArray<FFluidParticle>& OutCPUParticl
 	for (int32 i = 0; i < Count; ++i)
 	{
 		const FGPUFluidParticle& GPUParticle = ParticleBuffer[i];
-		if (int32* CPUIndex = ParticleIDToIndex.Find(GPUParticle.ParticleID))
+		const int32 CPUIndex = ParticleIDToIndex.FindSlot(GPUParticle.ParticleID);
+		if (CPUIndex != INDEX_NONE)
 		{
-			ConvertFromGPU(OutCPUParticles[*CPUIndex], GPUParticle);
+			ConvertFromGPU(OutCPUParticles[CPUIndex], GPUParticle);
 			++UpdatedCount;
 
 			// Check if particle is near or outside bounds
@@ -3512,6 +3720,17 @@ void FGPUFluidSimulator::AddHeightmapCollisionPass(
 	}
 }
 
+void FGPUFluidSimulator::AddSDFBrickCollisionPass(
+	FRDGBuilder& GraphBuilder,
+	const FSimulationSpatialData& SpatialData,
+	const FGPUFluidSimulationParams& Params)
+{
+	if (CollisionManager.IsValid())
+	{
+		CollisionManager->AddSDFBrickCollisionPass(GraphBuilder, SpatialData, CurrentParticleCount, Params, CurrentIndirectArgsBuffer);
+	}
+}
+
 void FGPUFluidSimulator::AllocateCollisionFeedbackBuffers(FRHICommandListImmediate& RHICmdList)
 {
 	if (CollisionManager.IsValid())
@@ -3838,38 +4057,21 @@ void FGPUFluidSimulator::ProcessAnisotropyReadback()
 // Stats/Recycle Readback Implementation (Async GPU→CPU for ParticleID-based operations)
 //=============================================================================
 
-void FGPUFluidSimulator::AllocateStatsReadbackObjects(FRHICommandListImmediate& RHICmdList)
-{
-	for (int32 i = 0; i < NUM_STATS_READBACK_BUFFERS; ++i)
-	{
-		if (StatsReadbacks[i] == nullptr)
-		{
-			StatsReadbacks[i] = new FRHIGPUBufferReadback(*FString::Printf(TEXT("StatsReadback_%d"), i));
-		}
-		StatsReadbackFrameNumbers[i] = 0;
-		StatsReadbackParticleCounts[i] = 0;
-	}
-
-	UE_LOG(LogGPUFluidSimulator, Log, TEXT("Stats readback objects allocated (NumBuffers=%d)"), NUM_STATS_READBACK_BUFFERS);
-}
-
-void FGPUFluidSimulator::ReleaseStatsReadbackObjects()
+/** Readback size of a stats buffer in the given format */
+static uint32 GetStatsReadbackSize(EGPUStatsReadbackFormat Format, int32 ParticleCount)
 {
-	for (int32 i = 0; i < NUM_STATS_READBACK_BUFFERS; ++i)
+	switch (Format)
 	{
-		if (StatsReadbacks[i] != nullptr)
-		{
-			delete StatsReadbacks[i];
-			StatsReadbacks[i] = nullptr;
-		}
-		StatsReadbackFrameNumbers[i] = 0;
-		StatsReadbackParticleCounts[i] = 0;
-		bStatsReadbackCompactMode[i] = false;
+	case EGPUStatsReadbackFormat::Compact:
+		return ParticleCount * sizeof(FCompactParticleStats);
+	case EGPUStatsReadbackFormat::Quantized:
+		return GPUQuantizedReadback::GetBufferSize(ParticleCount);
+	default:
+		return ParticleCount * sizeof(FGPUFluidParticle);
 	}
-	StatsReadbackWriteIndex = 0;
 }
 
-void FGPUFluidSimulator::EnqueueStatsReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer, int32 ParticleCount, bool bCompactMode)
+void FGPUFluidSimulator::EnqueueStatsReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer, int32 ParticleCount, EGPUStatsReadbackFormat Format)
 {
 	if (ParticleCount <= 0 || SourceBuffer == nullptr)
 	{
@@ -3878,39 +4080,39 @@ void FGPUFluidSimulator::EnqueueStatsReadback(FRHICommandListImmediate& RHICmdLi
 
 	// Validate source buffer size based on mode
 	const uint32 SourceBufferSize = SourceBuffer->GetSize();
-	const uint32 ElementSize = bCompactMode ? sizeof(FCompactParticleStats) : sizeof(FGPUFluidParticle);
-	const uint32 RequiredSize = ParticleCount * ElementSize;
+	const uint32 RequiredSize = GetStatsReadbackSize(Format, ParticleCount);
 	if (RequiredSize > SourceBufferSize)
 	{
 		UE_LOG(LogGPUFluidSimulator, Warning,
-			TEXT("EnqueueStatsReadback: CopySize (%u) exceeds SourceBuffer size (%u). ParticleCount=%d, Compact=%d, Skipping."),
-			RequiredSize, SourceBufferSize, ParticleCount, bCompactMode ? 1 : 0);
+			TEXT("EnqueueStatsReadback: CopySize (%u) exceeds SourceBuffer size (%u). ParticleCount=%d, Format=%d, Skipping."),
+			RequiredSize, SourceBufferSize, ParticleCount, static_cast<int32>(Format));
 		return;
 	}
 
-	// Allocate readback objects if needed
-	if (StatsReadbacks[0] == nullptr)
+	if (!ReadbackScheduler.IsValid())
 	{
-		AllocateStatsReadbackObjects(RHICmdList);
+		return;
 	}
 
-	// Get current write index and advance for next frame
-	const int32 WriteIdx = StatsReadbackWriteIndex;
-	StatsReadbackWriteIndex = (StatsReadbackWriteIndex + 1) % NUM_STATS_READBACK_BUFFERS;
-
-	// Enqueue async copy (compact 32 bytes or full 64 bytes per particle)
-	const uint32 CopySize = ParticleCount * ElementSize;
-	RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::UAVCompute, ERHIAccess::CopySrc));
-	StatsReadbacks[WriteIdx]->EnqueueCopy(RHICmdList, SourceBuffer, CopySize);
-	RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::CopySrc, ERHIAccess::UAVCompute));
-	StatsReadbackFrameNumbers[WriteIdx] = GFrameCounterRenderThread;
-	StatsReadbackParticleCounts[WriteIdx] = ParticleCount;
-	bStatsReadbackCompactMode[WriteIdx] = bCompactMode;
+	// Enqueue async copy (quantized 20, compact 32 or full 64 bytes per particle)
+	ReadbackScheduler->GetChannel(StatsReadbackChannel).Enqueue(GFrameCounterRenderThread, RequiredSize, ParticleCount, static_cast<uint32>(Format),
+		[&RHICmdList, SourceBuffer, RequiredSize](FRHIGPUBufferReadback& Readback)
+		{
+			RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::UAVCompute, ERHIAccess::CopySrc));
+			Readback.EnqueueCopy(RHICmdList, SourceBuffer, RequiredSize);
+			RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::CopySrc, ERHIAccess::UAVCompute));
+		});
 }
 
 void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdList)
 {
-	if (StatsReadbacks[0] == nullptr)
+	if (!ReadbackScheduler.IsValid())
+	{
+		return;
+	}
+
+	FGPUReadbackScheduler::FChannel& StatsChannel = ReadbackScheduler->GetChannel(StatsReadbackChannel);
+	if (!StatsChannel.HasStagingResources())
 	{
 		return;
 	}
@@ -3924,6 +4126,8 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 			CachedParticleVelocities.Empty();
 			CachedParticleSourceIDs.Empty();
 			CachedAllParticleIDs.Empty();
+			CachedParticleIDMap.Reset();
+			bParticleIDMapDirty = false;
 			CachedSourceIDToParticleIDs.Empty();
 			CachedParticleFlags.Empty();
 			ReadyShadowPositions.Empty();
@@ -3932,63 +4136,44 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 			ReadyShadowPositionsFrame.store(0);
 			ReadyShadowAnisotropyFrame.store(0);
 		}
-		for (int32 i = 0; i < NUM_STATS_READBACK_BUFFERS; ++i)
-		{
-			if (StatsReadbackFrameNumbers[i] > 0 && StatsReadbacks[i] && StatsReadbacks[i]->IsReady())
-				StatsReadbackFrameNumbers[i] = 0;
-		}
+		StatsChannel.Invalidate();
 		return;
 	}
 
-	// Search for newest ready buffer (prevents stale pre-despawn data from refilling cache)
-	int32 ReadIdx = -1;
-	uint64 NewestFrame = 0;
-
-	for (int32 i = 0; i < NUM_STATS_READBACK_BUFFERS; ++i)
-	{
-		if (StatsReadbacks[i] != nullptr &&
-			StatsReadbackFrameNumbers[i] > 0 &&
-			StatsReadbacks[i]->IsReady())
-		{
-			if (StatsReadbackFrameNumbers[i] > NewestFrame)
-			{
-				NewestFrame = StatsReadbackFrameNumbers[i];
-				ReadIdx = i;
-			}
-		}
-	}
-
-	if (ReadIdx < 0)
+	// Newest ready copy; older ready copies are dropped (stale pre-despawn data must not refill the cache)
+	const int32 ReadIdx = StatsChannel.AcquireNewest(GFrameCounterRenderThread);
+	if (ReadIdx == INDEX_NONE)
 	{
 		return;  // No ready buffers
 	}
-
-	// Discard older ready buffers — they contain stale pre-despawn data
-	for (int32 i = 0; i < NUM_STATS_READBACK_BUFFERS; ++i)
-	{
-		if (i != ReadIdx && StatsReadbackFrameNumbers[i] > 0
-			&& StatsReadbacks[i] && StatsReadbacks[i]->IsReady())
-		{
-			StatsReadbackFrameNumbers[i] = 0;
-		}
-	}
+	const FGPUReadbackSlotInfo& ReadInfo = StatsChannel.GetSlotInfo(ReadIdx);
 
 	// Use min(stored, CurrentParticleCount) to handle CPU/GPU count desync after despawn.
-	// ProcessParticleCountReadback runs first, so CurrentParticleCount reflects GPU-accurate count.
+	// The count readback channel is processed first, so CurrentParticleCount reflects GPU-accurate count.
 	// stored count may be stale (too high) if despawn compacted particles after enqueue.
-	const int32 ParticleCount = FMath::Min(StatsReadbackParticleCounts[ReadIdx], CurrentParticleCount);
+	int32 ParticleCount = FMath::Min(ReadInfo.Payload, CurrentParticleCount);
 	if (ParticleCount <= 0)
 	{
+		StatsChannel.Release(ReadIdx);
 		return;
 	}
 
-	// Check if this readback is compact mode (32 bytes) or full mode (64 bytes)
-	const bool bIsCompactMode = bStatsReadbackCompactMode[ReadIdx];
+	// Readback layout: full 64-byte, compact 32-byte or quantized 20-byte (+ header)
+	const EGPUStatsReadbackFormat Format = static_cast<EGPUStatsReadbackFormat>(ReadInfo.UserFlags);
+	const bool bIsCompactMode = Format == EGPUStatsReadbackFormat::Compact;
+	const bool bIsQuantizedMode = Format == EGPUStatsReadbackFormat::Quantized;
 
 	// Lock buffer with appropriate size
-	const int32 ElementSize = bIsCompactMode ? sizeof(FCompactParticleStats) : sizeof(FGPUFluidParticle);
-	const int32 BufferSize = ParticleCount * ElementSize;
-	const void* RawData = StatsReadbacks[ReadIdx]->Lock(BufferSize);
+	const uint32 BufferSize = GetStatsReadbackSize(Format, ParticleCount);
+	const void* RawData = StatsChannel.Lock(ReadIdx, BufferSize);
+
+	// Quantized: bounds and GPU count come from the header written in the same frame
+	GPUQuantizedReadback::FBounds QuantizedBounds;
+	if (RawData && bIsQuantizedMode)
+	{
+		QuantizedBounds = GPUQuantizedReadback::DecodeHeader(*static_cast<const FQuantizedReadbackHeader*>(RawData));
+		ParticleCount = QuantizedBounds.IsValid() ? FMath::Min(ParticleCount, QuantizedBounds.ParticleCount) : 0;
+	}
 
 	if (RawData && ParticleCount > 0)
 	{
@@ -3997,16 +4182,11 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 		const int32 NumChunks = FMath::Clamp(FPlatformMisc::NumberOfCoresIncludingHyperthreads(), 1, ParticleCount);
 		const int32 ChunkSize = (ParticleCount + NumChunks - 1) / NumChunks;
 
-		// Use fixed-size arrays instead of TMap (SourceID is 0~63 range)
-		constexpr int32 MaxSources = EGPUParticleSource::MaxSourceCount;  // 64
-		TArray<TArray<TArray<int32>>> ChunkSourceArrays;  // [NumChunks][MaxSources][]
+		// Arrays indexed by SourceID instead of TMap; each chunk grows its own up to the highest SourceID it sees
+		TArray<TArray<TArray<int32>>> ChunkSourceArrays;  // [NumChunks][HighestSourceID + 1][]
 		TArray<TArray<int32>> ChunkAllIDs;
 		ChunkSourceArrays.SetNum(NumChunks);
 		ChunkAllIDs.SetNum(NumChunks);
-		for (int32 c = 0; c < NumChunks; ++c)
-		{
-			ChunkSourceArrays[c].SetNum(MaxSources);
-		}
 
 		// Pre-allocate data arrays (will be filled in parallel)
 		// Position/SourceID are ALWAYS copied (needed for lightweight despawn API)
@@ -4015,7 +4195,7 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 		// Density/VelocityMagnitude/Mass/Flags only when detailed GPU stats enabled (requires full mode)
 		const bool bNeedShadowData = bShadowReadbackEnabled.load();
 		const bool bNeedVelocity = (bFullReadbackEnabled.load() || bNeedShadowData) && !bIsCompactMode;  // Velocity not available in compact mode
-		const bool bNeedDetailedStats = GetFluidStatsCollector().IsDetailedGPUEnabled() && !bIsCompactMode;  // Detailed stats require full mode
+		const bool bNeedDetailedStats = GetFluidStatsCollector().IsDetailedGPUEnabled() && Format == EGPUStatsReadbackFormat::Full;  // Detailed stats require full mode
 		TArray<FVector3f> NewPositions;
 		TArray<int32> NewSourceIDs;
 		TArray<FVector3f> NewVelocities;
@@ -4063,10 +4243,7 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 					const FCompactParticleStats& P = CompactData[i];
 					LocalAllIDs.Add(P.ParticleID);
 
-					if (P.SourceID >= 0 && P.SourceID < MaxSources)
-					{
-						LocalSourceArrays[P.SourceID].Add(P.ParticleID);
-					}
+					AddToSourceBucket(LocalSourceArrays, P.SourceID, P.ParticleID);
 
 					NewPositions[i] = P.Position;
 					NewSourceIDs[i] = P.SourceID;
@@ -4082,6 +4259,46 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 				}
 			}, EParallelForFlags::Unbalanced);
 		}
+		else if (bIsQuantizedMode)
+		{
+			// Quantized mode: 20-byte FQuantizedParticleStats after the header (dequantized here)
+			const FQuantizedParticleStats* QuantizedData = reinterpret_cast<const FQuantizedParticleStats*>(
+				static_cast<const uint8*>(RawData) + sizeof(FQuantizedReadbackHeader));
+
+			ParallelFor(NumChunks, [&](int32 ChunkIndex)
+			{
+				const int32 StartIdx = ChunkIndex * ChunkSize;
+				const int32 EndIdx = FMath::Min(StartIdx + ChunkSize, ParticleCount);
+				if (StartIdx >= EndIdx) return;
+
+				auto& LocalSourceArrays = ChunkSourceArrays[ChunkIndex];
+				auto& LocalAllIDs = ChunkAllIDs[ChunkIndex];
+				LocalAllIDs.Reserve(EndIdx - StartIdx);
+
+				for (int32 i = StartIdx; i < EndIdx; ++i)
+				{
+					const FQuantizedParticleStats& P = QuantizedData[i];
+					const int32 SourceID = GPUQuantizedReadback::DecodeSourceID(P);
+					LocalAllIDs.Add(P.ParticleID);
+
+					AddToSourceBucket(LocalSourceArrays, SourceID, P.ParticleID);
+
+					NewPositions[i] = GPUQuantizedReadback::DecodePosition(P, QuantizedBounds);
+					NewSourceIDs[i] = SourceID;
+					NewFlags[i] = GPUQuantizedReadback::DecodeFlags(P);
+
+					if (bNeedVelocity)
+					{
+						NewVelocities[i] = GPUQuantizedReadback::DecodeVelocity(P);
+					}
+
+					if (bNeedShadowData)
+					{
+						NewNeighborCounts[i] = GPUQuantizedReadback::DecodeNeighborCount(P);
+					}
+				}
+			}, EParallelForFlags::Unbalanced);
+		}
 		else
 		{
 			// Full mode: 64-byte FGPUFluidParticle (all fields)
@@ -4102,10 +4319,7 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 					const FGPUFluidParticle& P = ParticleData[i];
 					LocalAllIDs.Add(P.ParticleID);
 
-					if (P.SourceID >= 0 && P.SourceID < MaxSources)
-					{
-						LocalSourceArrays[P.SourceID].Add(P.ParticleID);
-					}
+					AddToSourceBucket(LocalSourceArrays, P.SourceID, P.ParticleID);
 
 					NewPositions[i] = P.Position;
 					NewSourceIDs[i] = P.SourceID;
@@ -4137,7 +4351,12 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 		TArray<int32> NewAllParticleIDs;
 		{
 			SCOPED_DRAW_EVENT(RHICmdList, Merge);
-			NewSourceIDArrays.SetNum(MaxSources);
+			int32 NumSources = 0;
+			for (int32 c = 0; c < NumChunks; ++c)
+			{
+				NumSources = FMath::Max(NumSources, ChunkSourceArrays[c].Num());
+			}
+			NewSourceIDArrays.SetNum(NumSources);
 			NewAllParticleIDs.Reserve(ParticleCount);
 
 			for (int32 c = 0; c < NumChunks; ++c)
@@ -4148,7 +4367,7 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 			// Merge SourceID arrays - chunk-first loop order for cache efficiency
 			for (int32 c = 0; c < NumChunks; ++c)
 			{
-				for (int32 SourceID = 0; SourceID < MaxSources; ++SourceID)
+				for (int32 SourceID = 0; SourceID < ChunkSourceArrays[c].Num(); ++SourceID)
 				{
 					if (ChunkSourceArrays[c][SourceID].Num() > 0)
 					{
@@ -4259,6 +4478,7 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 			FScopeLock Lock(&BufferLock);
 			CachedSourceIDToParticleIDs = MoveTemp(NewSourceIDArrays);
 			CachedAllParticleIDs = MoveTemp(NewAllParticleIDs);
+			bParticleIDMapDirty = true;
 			CachedParticlePositions = MoveTemp(NewPositions);    // Always available for despawn API
 			CachedParticleSourceIDs = MoveTemp(NewSourceIDs);    // Always available for despawn API
 			CachedParticleFlags = MoveTemp(NewFlags);            // Always available for debug visualization
@@ -4277,7 +4497,7 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 				ReadyShadowPositions = CachedParticlePositions;  // Share with despawn data
 				ReadyShadowVelocities = CachedParticleVelocities;  // Share with ISM data
 				ReadyShadowNeighborCounts = MoveTemp(NewNeighborCounts);
-				ReadyShadowPositionsFrame.store(StatsReadbackFrameNumbers[ReadIdx]);
+				ReadyShadowPositionsFrame.store(ReadInfo.FrameNumber);
 			}
 		}
 
@@ -4285,10 +4505,10 @@ void FGPUFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdLi
 		// (CleanupCompletedRequests removed - despawn decisions are purely GPU-side)
 	}
 
-	StatsReadbacks[ReadIdx]->Unlock();
+	StatsChannel.Unlock(ReadIdx);
 
-	// Mark buffer as available for next write cycle
-	StatsReadbackFrameNumbers[ReadIdx] = 0;
+	// Slot available for next write cycle
+	StatsChannel.Release(ReadIdx);
 }
 
 /**
@@ -4367,36 +4587,6 @@ bool FGPUFluidSimulator::GetShadowDataWithAnisotropy(
 // Debug Z-Order Index Readback Implementation (Async GPU→CPU)
 //=============================================================================
 
-void FGPUFluidSimulator::AllocateDebugIndexReadbackObjects(FRHICommandListImmediate& RHICmdList)
-{
-	for (int32 i = 0; i < NUM_DEBUG_INDEX_READBACK_BUFFERS; ++i)
-	{
-		if (DebugIndexReadbacks[i] == nullptr)
-		{
-			DebugIndexReadbacks[i] = new FRHIGPUBufferReadback(*FString::Printf(TEXT("DebugIndexReadback_%d"), i));
-		}
-		DebugIndexReadbackFrameNumbers[i] = 0;
-		DebugIndexReadbackParticleCounts[i] = 0;
-	}
-
-	UE_LOG(LogGPUFluidSimulator, Log, TEXT("Debug Z-Order index readback objects allocated (NumBuffers=%d)"), NUM_DEBUG_INDEX_READBACK_BUFFERS);
-}
-
-void FGPUFluidSimulator::ReleaseDebugIndexReadbackObjects()
-{
-	for (int32 i = 0; i < NUM_DEBUG_INDEX_READBACK_BUFFERS; ++i)
-	{
-		if (DebugIndexReadbacks[i] != nullptr)
-		{
-			delete DebugIndexReadbacks[i];
-			DebugIndexReadbacks[i] = nullptr;
-		}
-		DebugIndexReadbackFrameNumbers[i] = 0;
-		DebugIndexReadbackParticleCounts[i] = 0;
-	}
-	DebugIndexReadbackWriteIndex = 0;
-}
-
 void FGPUFluidSimulator::EnqueueDebugIndexReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer, int32 ParticleCount)
 {
 	if (ParticleCount <= 0 || SourceBuffer == nullptr)
@@ -4416,83 +4606,33 @@ void FGPUFluidSimulator::EnqueueDebugIndexReadback(FRHICommandListImmediate& RHI
 		return;
 	}
 
-	// Allocate readback objects if needed
-	if (DebugIndexReadbacks[0] == nullptr)
+	if (!ReadbackScheduler.IsValid())
 	{
-		AllocateDebugIndexReadbackObjects(RHICmdList);
+		return;
 	}
 
-	// Get current write index and advance for next frame
-	const int32 WriteIdx = DebugIndexReadbackWriteIndex;
-	DebugIndexReadbackWriteIndex = (DebugIndexReadbackWriteIndex + 1) % NUM_DEBUG_INDEX_READBACK_BUFFERS;
-
 	// Enqueue async copy (int32 per particle = 4 bytes)
-	const uint32 CopySize = ParticleCount * ElementSize;
-	RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::UAVCompute, ERHIAccess::CopySrc));
-	DebugIndexReadbacks[WriteIdx]->EnqueueCopy(RHICmdList, SourceBuffer, CopySize);
-	RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::CopySrc, ERHIAccess::UAVCompute));
-	DebugIndexReadbackFrameNumbers[WriteIdx] = GFrameCounterRenderThread;
-	DebugIndexReadbackParticleCounts[WriteIdx] = ParticleCount;
+	ReadbackScheduler->GetChannel(DebugIndexReadbackChannel).Enqueue(GFrameCounterRenderThread, RequiredSize, ParticleCount, 0,
+		[&RHICmdList, SourceBuffer, RequiredSize](FRHIGPUBufferReadback& Readback)
+		{
+			RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::UAVCompute, ERHIAccess::CopySrc));
+			Readback.EnqueueCopy(RHICmdList, SourceBuffer, RequiredSize);
+			RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::CopySrc, ERHIAccess::UAVCompute));
+		});
 }
 
-void FGPUFluidSimulator::ProcessDebugIndexReadback()
+void FGPUFluidSimulator::ConsumeDebugIndexReadback(TConstArrayView<int32> IndexData, const FGPUReadbackSlotInfo& Info)
 {
-	if (DebugIndexReadbacks[0] == nullptr)
-	{
-		return;
-	}
-
-	// Search for oldest ready buffer
-	int32 ReadIdx = -1;
-	uint64 OldestFrame = UINT64_MAX;
-
-	for (int32 i = 0; i < NUM_DEBUG_INDEX_READBACK_BUFFERS; ++i)
-	{
-		if (DebugIndexReadbacks[i] != nullptr &&
-			DebugIndexReadbackFrameNumbers[i] > 0 &&
-			DebugIndexReadbacks[i]->IsReady())
-		{
-			if (DebugIndexReadbackFrameNumbers[i] < OldestFrame)
-			{
-				OldestFrame = DebugIndexReadbackFrameNumbers[i];
-				ReadIdx = i;
-			}
-		}
-	}
-
-	if (ReadIdx < 0)
+	if (IndexData.Num() == 0)
 	{
-		return;  // No ready buffers
-	}
-
-	const int32 ParticleCount = DebugIndexReadbackParticleCounts[ReadIdx];
-	if (ParticleCount <= 0)
-	{
-		return;
-	}
-
-	// Lock buffer (int32 per particle)
-	const int32 BufferSize = ParticleCount * sizeof(int32);
-	const int32* IndexData = (const int32*)DebugIndexReadbacks[ReadIdx]->Lock(BufferSize);
-
-	if (IndexData == nullptr)
-	{
-		UE_LOG(LogGPUFluidSimulator, Warning, TEXT("Debug Index Readback: Failed to lock buffer"));
 		return;
 	}
 
 	// Copy to cached array
-	CachedZOrderArrayIndices.SetNumUninitialized(ParticleCount);
-	FMemory::Memcpy(CachedZOrderArrayIndices.GetData(), IndexData, BufferSize);
-
-	// Unlock buffer
-	DebugIndexReadbacks[ReadIdx]->Unlock();
+	CachedZOrderArrayIndices = IndexData;
 
 	// Update frame counter
-	ReadyZOrderIndicesFrame.store(DebugIndexReadbackFrameNumbers[ReadIdx]);
-
-	// Mark buffer as available for next write cycle
-	DebugIndexReadbackFrameNumbers[ReadIdx] = 0;
+	ReadyZOrderIndicesFrame.store(Info.FrameNumber);
 }
 
 void FGPUFluidSimulator::AddRecordZOrderIndicesPass(FRDGBuilder& GraphBuilder, FRDGBufferRef ParticleBuffer, int32 ParticleCount)
@@ -4565,36 +4705,6 @@ bool FGPUFluidSimulator::GetZOrderArrayIndices(TArray<int32>& OutIndices) const
 // Used to expand world collision query bounds in Unlimited Simulation Range mode
 //=============================================================================
 
-void FGPUFluidSimulator::AllocateParticleBoundsReadbackObjects(FRHICommandListImmediate& RHICmdList)
-{
-	for (int32 i = 0; i < NUM_PARTICLE_BOUNDS_READBACK_BUFFERS; ++i)
-	{
-		if (ParticleBoundsReadbacks[i] == nullptr)
-		{
-			ParticleBoundsReadbacks[i] = new FRHIGPUBufferReadback(*FString::Printf(TEXT("ParticleBoundsReadback_%d"), i));
-		}
-		ParticleBoundsReadbackFrameNumbers[i] = 0;
-	}
-
-	UE_LOG(LogGPUFluidSimulator, Log, TEXT("Particle bounds readback objects allocated (NumBuffers=%d)"), NUM_PARTICLE_BOUNDS_READBACK_BUFFERS);
-}
-
-void FGPUFluidSimulator::ReleaseParticleBoundsReadbackObjects()
-{
-	for (int32 i = 0; i < NUM_PARTICLE_BOUNDS_READBACK_BUFFERS; ++i)
-	{
-		if (ParticleBoundsReadbacks[i] != nullptr)
-		{
-			delete ParticleBoundsReadbacks[i];
-			ParticleBoundsReadbacks[i] = nullptr;
-		}
-		ParticleBoundsReadbackFrameNumbers[i] = 0;
-	}
-	ParticleBoundsReadbackWriteIndex = 0;
-	CachedParticleBounds = FBox(EForceInit::ForceInit);
-	ReadyParticleBoundsFrame.store(0);
-}
-
 void FGPUFluidSimulator::EnqueueParticleBoundsReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer)
 {
 	if (SourceBuffer == nullptr)
@@ -4613,60 +4723,25 @@ void FGPUFluidSimulator::EnqueueParticleBoundsReadback(FRHICommandListImmediate&
 		return;
 	}
 
-	// Allocate readback objects if needed
-	if (ParticleBoundsReadbacks[0] == nullptr)
+	if (!ReadbackScheduler.IsValid())
 	{
-		AllocateParticleBoundsReadbackObjects(RHICmdList);
+		return;
 	}
 
-	// Get current write index and advance for next frame
-	const int32 WriteIdx = ParticleBoundsReadbackWriteIndex;
-	ParticleBoundsReadbackWriteIndex = (ParticleBoundsReadbackWriteIndex + 1) % NUM_PARTICLE_BOUNDS_READBACK_BUFFERS;
-
 	// Enqueue async copy (2 × FVector3f = 24 bytes)
-	RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::UAVCompute, ERHIAccess::CopySrc));
-	ParticleBoundsReadbacks[WriteIdx]->EnqueueCopy(RHICmdList, SourceBuffer, BoundsBufferSize);
-	RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::CopySrc, ERHIAccess::UAVCompute));
-	ParticleBoundsReadbackFrameNumbers[WriteIdx] = GFrameCounterRenderThread;
+	ReadbackScheduler->GetChannel(ParticleBoundsReadbackChannel).Enqueue(GFrameCounterRenderThread, BoundsBufferSize, 0, 0,
+		[&RHICmdList, SourceBuffer, BoundsBufferSize](FRHIGPUBufferReadback& Readback)
+		{
+			RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::UAVCompute, ERHIAccess::CopySrc));
+			Readback.EnqueueCopy(RHICmdList, SourceBuffer, BoundsBufferSize);
+			RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::CopySrc, ERHIAccess::UAVCompute));
+		});
 }
 
-void FGPUFluidSimulator::ProcessParticleBoundsReadback()
+void FGPUFluidSimulator::ConsumeParticleBoundsReadback(TConstArrayView<FVector3f> BoundsData, const FGPUReadbackSlotInfo& Info)
 {
-	if (ParticleBoundsReadbacks[0] == nullptr)
-	{
-		return;
-	}
-
-	// Search for oldest ready buffer
-	int32 ReadIdx = -1;
-	uint64 OldestFrame = UINT64_MAX;
-
-	for (int32 i = 0; i < NUM_PARTICLE_BOUNDS_READBACK_BUFFERS; ++i)
-	{
-		if (ParticleBoundsReadbacks[i] != nullptr &&
-			ParticleBoundsReadbackFrameNumbers[i] > 0 &&
-			ParticleBoundsReadbacks[i]->IsReady())
-		{
-			if (ParticleBoundsReadbackFrameNumbers[i] < OldestFrame)
-			{
-				OldestFrame = ParticleBoundsReadbackFrameNumbers[i];
-				ReadIdx = i;
-			}
-		}
-	}
-
-	if (ReadIdx < 0)
-	{
-		return;  // No ready buffers
-	}
-
-	// Lock buffer (2 × FVector3f = 24 bytes)
-	const int32 BufferSize = 2 * sizeof(FVector3f);
-	const FVector3f* BoundsData = (const FVector3f*)ParticleBoundsReadbacks[ReadIdx]->Lock(BufferSize);
-
-	if (BoundsData == nullptr)
+	if (BoundsData.Num() < 2)
 	{
-		UE_LOG(LogGPUFluidSimulator, Warning, TEXT("Particle Bounds Readback: Failed to lock buffer"));
 		return;
 	}
 
@@ -4674,8 +4749,6 @@ void FGPUFluidSimulator::ProcessParticleBoundsReadback()
 	const FVector3f BoundsMin = BoundsData[0];
 	const FVector3f BoundsMax = BoundsData[1];
 
-	ParticleBoundsReadbacks[ReadIdx]->Unlock();
-
 	// Validate bounds (check for infinity or NaN from empty particle set)
 	if (FMath::IsFinite(BoundsMin.X) && FMath::IsFinite(BoundsMin.Y) && FMath::IsFinite(BoundsMin.Z) &&
 		FMath::IsFinite(BoundsMax.X) && FMath::IsFinite(BoundsMax.Y) && FMath::IsFinite(BoundsMax.Z) &&
@@ -4683,9 +4756,6 @@ void FGPUFluidSimulator::ProcessParticleBoundsReadback()
 	{
 		// Update cached bounds
 		CachedParticleBounds = FBox(FVector(BoundsMin), FVector(BoundsMax));
-		ReadyParticleBoundsFrame.store(OldestFrame);
+		ReadyParticleBoundsFrame.store(Info.FrameNumber);
 	}
-
-	// Clear processed buffer's frame number to prevent re-processing
-	ParticleBoundsReadbackFrameNumbers[ReadIdx] = 0;
 }
\ No newline at end of file
@@ -44,6 +44,10 @@ IMPLEMENT_GLOBAL_SHADER(FHeightmapCollisionCS,
 	"/Plugin/KawaiiFluidSystem/Private/FluidHeightmapCollision.usf",
 	"HeightmapCollisionCS", SF_Compute);
 
+IMPLEMENT_GLOBAL_SHADER(FSDFBrickCollisionCS,
+	"/Plugin/KawaiiFluidSystem/Private/FluidSDFBrickCollision.usf",
+	"SDFBrickCollisionCS", SF_Compute);
+
 IMPLEMENT_GLOBAL_SHADER(FPrimitiveCollisionCS,
 	"/Plugin/KawaiiFluidSystem/Private/FluidPrimitiveCollision.usf",
 	"PrimitiveCollisionCS", SF_Compute);
@@ -88,6 +92,10 @@ IMPLEMENT_GLOBAL_SHADER(FMarkDespawnBySourceCS,
 	"/Plugin/KawaiiFluidSystem/Private/FluidDespawnBySource.usf",
 	"MarkDespawnBySourceCS", SF_Compute);
 
+IMPLEMENT_GLOBAL_SHADER(FMarkDespawnByIDCS,
+	"/Plugin/KawaiiFluidSystem/Private/FluidDespawnByID.usf",
+	"MarkDespawnByIDCS", SF_Compute);
+
 IMPLEMENT_GLOBAL_SHADER(FBuildIDHistogramCS,
 	"/Plugin/KawaiiFluidSystem/Private/FluidDespawnOldest.usf",
 	"BuildIDHistogramCS", SF_Compute);
@@ -191,11 +191,6 @@ void FGPUFluidSimulator::AddSolveDensityPressurePass(
 		GridPreset = ZOrderSortManager->GetEffectiveGridResolutionPreset();
 	}
 
-	// Create permutation vector and get shader
-	FSolveDensityPressureCS::FPermutationDomain PermutationVector;
-	PermutationVector.Set<FGridResolutionDim>(GridResolutionPermutation::FromPreset(GridPreset));
-	TShaderMapRef<FSolveDensityPressureCS> ComputeShader(ShaderMap, PermutationVector);
-
 	FSolveDensityPressureCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FSolveDensityPressureCS::FParameters>();
 
 	// SoA (Structure of Arrays) Particle Buffers
@@ -379,6 +374,11 @@ void FGPUFluidSimulator::AddSolveDensityPressurePass(
 	// 		BoundaryPath, ZOrderPath, PassParameters->BoundaryParticleCount, PassParameters->bUseBoundaryDensity, PassParameters->bUseBoundaryZOrder);
 	// }
 
+	// Feature permutation: tensile / surface tension / boundary density are compiled out when unused
+	const FSolveDensityPressureCS::FPermutationDomain PermutationVector = FSolveDensityPressureCS::SelectPermutation(
+		Params, GridResolutionPermutation::FromPreset(GridPreset), PassParameters->bUseBoundaryDensity != 0);
+	TShaderMapRef<FSolveDensityPressureCS> ComputeShader(ShaderMap, PermutationVector);
+
 	if (CurrentIndirectArgsBuffer)
 	{
 		GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
@@ -0,0 +1,141 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "GPU/GPUReadbackScheduler.h"
+
+namespace
+{
+	/** Smoothing of the average latency (exponential moving average weight of a new sample) */
+	constexpr float LatencySmoothing = 0.1f;
+}
+
+FGPUReadbackRing::FGPUReadbackRing(int32 InNumSlots)
+{
+	Slots.SetNum(FMath::Max(InNumSlots, 1));
+}
+
+int32 FGPUReadbackRing::BeginWrite(uint64 FrameNumber, uint32 NumBytes, int32 Payload, uint32 UserFlags)
+{
+	int32 Slot = Slots.IndexOfByPredicate([](const FGPUReadbackSlotInfo& Info) { return Info.State == EGPUReadbackSlotState::Free; });
+
+	// All busy: recycle the oldest in-flight copy (it would be superseded anyway)
+	if (Slot == INDEX_NONE)
+	{
+		for (int32 i = 0; i < Slots.Num(); ++i)
+		{
+			if (Slots[i].State == EGPUReadbackSlotState::InFlight && (Slot == INDEX_NONE || Slots[i].Sequence < Slots[Slot].Sequence))
+			{
+				Slot = i;
+			}
+		}
+
+		if (Slot == INDEX_NONE)
+		{
+			return INDEX_NONE;
+		}
+		++Stats.NumOverwritten;
+	}
+
+	FGPUReadbackSlotInfo& Info = Slots[Slot];
+	Info.Sequence = NextSequence++;
+	Info.FrameNumber = FrameNumber;
+	Info.Epoch = Epoch;
+	Info.NumBytes = NumBytes;
+	Info.Payload = Payload;
+	Info.UserFlags = UserFlags;
+	Info.State = EGPUReadbackSlotState::InFlight;
+	++Stats.NumEnqueued;
+	return Slot;
+}
+
+void FGPUReadbackRing::Release(int32 Slot)
+{
+	check(Slots.IsValidIndex(Slot) && Slots[Slot].State == EGPUReadbackSlotState::Acquired);
+	Slots[Slot].State = EGPUReadbackSlotState::Free;
+}
+
+void FGPUReadbackRing::Invalidate()
+{
+	++Epoch;
+}
+
+void FGPUReadbackRing::Reset()
+{
+	const int32 NumSlots = Slots.Num();
+	Slots.Reset();
+	Slots.SetNum(NumSlots);
+	Stats = FGPUReadbackChannelStats();
+	NextSequence = 1;
+	LastConsumedSequence = 0;
+	Epoch = 0;
+}
+
+int32 FGPUReadbackRing::GetNumInFlight() const
+{
+	int32 Count = 0;
+	for (const FGPUReadbackSlotInfo& Info : Slots)
+	{
+		Count += Info.State == EGPUReadbackSlotState::InFlight ? 1 : 0;
+	}
+	return Count;
+}
+
+void FGPUReadbackRing::DropCompleted(int32 Slot)
+{
+	FGPUReadbackSlotInfo& Info = Slots[Slot];
+	if (Info.Epoch != Epoch)
+	{
+		++Stats.NumInvalidated;
+	}
+	else
+	{
+		++Stats.NumSuperseded;
+	}
+	Info.State = EGPUReadbackSlotState::Free;
+}
+
+void FGPUReadbackRing::MarkAcquired(int32 Slot, uint64 CurrentFrame)
+{
+	FGPUReadbackSlotInfo& Info = Slots[Slot];
+	Info.State = EGPUReadbackSlotState::Acquired;
+	LastConsumedSequence = Info.Sequence;
+
+	const uint64 Latency = CurrentFrame > Info.FrameNumber ? CurrentFrame - Info.FrameNumber : 0;
+	Stats.LastLatencyFrames = Latency;
+	Stats.MaxLatencyFrames = FMath::Max(Stats.MaxLatencyFrames, Latency);
+	Stats.AverageLatencyFrames = Stats.NumConsumed == 0
+		? static_cast<float>(Latency)
+		: FMath::Lerp(Stats.AverageLatencyFrames, static_cast<float>(Latency), LatencySmoothing);
+	++Stats.NumConsumed;
+}
+
+uint32 FGPUSpawnCountTracker::RecordSpawn(int32 Count)
+{
+	++SpawnSequence;
+	FSpawnBatch& Batch = PendingBatches.AddDefaulted_GetRef();
+	Batch.Sequence = SpawnSequence;
+	Batch.Count = Count;
+	return SpawnSequence;
+}
+
+int32 FGPUSpawnCountTracker::Reconcile(uint32 CopySequence, int32 GPUCount, int32 MaxCount)
+{
+	// Consumed copies never go back in time, so covered batches can be dropped for good
+	int32 NumCovered = 0;
+	while (NumCovered < PendingBatches.Num() && static_cast<int32>(PendingBatches[NumCovered].Sequence - CopySequence) <= 0)
+	{
+		++NumCovered;
+	}
+	PendingBatches.RemoveAt(0, NumCovered, EAllowShrinking::No);
+
+	int64 Count = GPUCount;
+	for (const FSpawnBatch& Batch : PendingBatches)
+	{
+		Count += Batch.Count;
+	}
+	return static_cast<int32>(FMath::Clamp<int64>(Count, 0, FMath::Max(MaxCount, 0)));
+}
+
+void FGPUSpawnCountTracker::Reset()
+{
+	PendingBatches.Reset();
+}
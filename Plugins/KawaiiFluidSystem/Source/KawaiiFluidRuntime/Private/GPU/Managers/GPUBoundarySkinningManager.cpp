@@ -7,6 +7,7 @@
 
 #include "GPU/GPUFluidSimulatorShaders.h"
 #include "GPU/GPUIndirectDispatchUtils.h"
+#include "Physics/SPHKernelTable.h"
 #include "RenderGraphBuilder.h"
 #include "RenderGraphUtils.h"
 #include "Components/SkeletalMeshComponent.h"
@@ -81,6 +82,9 @@ void FGPUBoundarySkinningManager::Release()
 	CombinedBoundaryAABB = FGPUBoundaryOwnerAABB();
 	bBoundaryAABBDirty = true;
 
+	PersistentKernelTableBuffer.SafeRelease();
+	KernelTableResolution = 0;
+
 	bIsInitialized = false;
 
 	UE_LOG(LogGPUBoundarySkinning, Log, TEXT("GPUBoundarySkinningManager released"));
@@ -1118,6 +1122,32 @@ void FGPUBoundarySkinningManager::AddBoundarySkinningPass(
 	}
 }
 
+//=============================================================================
+// Tabulated Kernels
+//=============================================================================
+
+FRDGBufferRef FGPUBoundarySkinningManager::GetKernelTableBuffer(FRDGBuilder& GraphBuilder, float Radius)
+{
+	if (PersistentKernelTableBuffer.IsValid())
+	{
+		return GraphBuilder.RegisterExternalBuffer(PersistentKernelTableBuffer, TEXT("GPUFluidKernelTable"));
+	}
+
+	// Shapes do not depend on the radius; it only sets the scale the error bound is measured against
+	FSPHKernelTable Table;
+	Table.Build(FMath::Max(Radius, 1.0f));
+	const TArray<float>& ShapeData = Table.GetShapeData();
+
+	FRDGBufferRef KernelTableBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("GPUFluidKernelTable"),
+		sizeof(float), ShapeData.Num(), ShapeData.GetData(), ShapeData.Num() * sizeof(float));
+	PersistentKernelTableBuffer = GraphBuilder.ConvertToExternalBuffer(KernelTableBuffer);
+	KernelTableResolution = Table.GetResolution();
+
+	UE_LOG(LogGPUBoundarySkinning, Log, TEXT("Kernel table uploaded: %d samples per channel (%d bytes)"),
+		KernelTableResolution, ShapeData.Num() * static_cast<int32>(sizeof(float)));
+	return KernelTableBuffer;
+}
+
 //=============================================================================
 // Boundary Adhesion Pass
 //=============================================================================
@@ -1314,6 +1344,8 @@ void FGPUBoundarySkinningManager::AddBoundaryAdhesionPass(
 		PassParameters->DeltaTime = Params.DeltaTime;
 		PassParameters->RestDensity = Params.RestDensity;
 		PassParameters->Poly6Coeff = Params.Poly6Coeff;
+		PassParameters->KernelTable = GraphBuilder.CreateSRV(GetKernelTableBuffer(GraphBuilder, CachedBoundaryAdhesionParams.AdhesionRadius));
+		PassParameters->KernelTableResolution = KernelTableResolution;
 
 		// =========================================================================
 		// PARTICLE-LEVEL EARLY-OUT: Boundary AABB for per-particle culling
@@ -462,7 +462,7 @@ bool FGPUCollisionFeedbackManager::GetAllFeedback(TArray<FGPUCollisionFeedback>&
 		return false;
 	}
 
-	OutFeedback.SetNum(ReadyFeedbackCount);
+	OutFeedback.SetNumUninitialized(ReadyFeedbackCount, EAllowShrinking::No);  // Reused caller buffers keep their allocation
 	FMemory::Memcpy(OutFeedback.GetData(), ReadyFeedback.GetData(), ReadyFeedbackCount * sizeof(FGPUCollisionFeedback));
 
 	return true;
@@ -497,7 +497,7 @@ bool FGPUCollisionFeedbackManager::GetAllStaticMeshFeedback(TArray<FGPUCollision
 		return false;
 	}
 
-	OutFeedback.SetNum(ReadyStaticMeshFeedbackCount);
+	OutFeedback.SetNumUninitialized(ReadyStaticMeshFeedbackCount, EAllowShrinking::No);
 	FMemory::Memcpy(OutFeedback.GetData(), ReadyStaticMeshFeedback.GetData(), ReadyStaticMeshFeedbackCount * sizeof(FGPUCollisionFeedback));
 
 	return true;
@@ -515,7 +515,7 @@ bool FGPUCollisionFeedbackManager::GetAllFluidInteractionSMFeedback(TArray<FGPUC
 		return false;
 	}
 
-	OutFeedback.SetNum(ReadyFluidInteractionSMFeedbackCount);
+	OutFeedback.SetNumUninitialized(ReadyFluidInteractionSMFeedbackCount, EAllowShrinking::No);
 	FMemory::Memcpy(OutFeedback.GetData(), ReadyFluidInteractionSMFeedback.GetData(), ReadyFluidInteractionSMFeedbackCount * sizeof(FGPUCollisionFeedback));
 
 	return true;
@@ -71,6 +71,13 @@ void FGPUCollisionManager::Release()
 	HeightmapTextureRHI.SafeRelease();
 	bHeightmapDataValid = false;
 
+	// Release SDF brick buffers
+	SDFBrickTableBuffer.SafeRelease();
+	SDFBrickSamplesBuffer.SafeRelease();
+	PendingSDFBrickData = FKawaiiFluidSDFBrickData();
+	bSDFBrickUploadPending = false;
+	bSDFBrickDataValid = false;
+
 	bCollisionPrimitivesValid = false;
 	bBoneTransformsValid = false;
 	bIsInitialized = false;
@@ -354,6 +361,7 @@ void FGPUCollisionManager::AddPrimitiveCollisionPass(
 	PassParameters->PackedVelocities = GraphBuilder.CreateUAV(SpatialData.SoA_PackedVelocities, PF_R32G32_UINT);  // B plan
 	PassParameters->PackedDensityLambda = GraphBuilder.CreateSRV(SpatialData.SoA_PackedDensityLambda, PF_R32_UINT);  // B plan
 	PassParameters->SourceIDs = GraphBuilder.CreateSRV(SpatialData.SoA_SourceIDs, PF_R32_SINT);
+	PassParameters->ParticleIDs = GraphBuilder.CreateSRV(SpatialData.SoA_ParticleIDs, PF_R32_SINT);
 	PassParameters->Flags = GraphBuilder.CreateUAV(SpatialData.SoA_Flags, PF_R32_UINT);
 	PassParameters->ParticleCount = ParticleCount;
 	if (IndirectArgsBuffer) PassParameters->ParticleCountBuffer = GraphBuilder.CreateSRV(IndirectArgsBuffer);
@@ -766,3 +774,120 @@ void FGPUCollisionManager::AddHeightmapCollisionPass(
 			ComputeShader, PassParameters, FIntVector(NumGroups, 1, 1));
 	}
 }
+
+//=============================================================================
+// World SDF Brick Collision (static world geometry)
+//=============================================================================
+
+void FGPUCollisionManager::UploadSDFBricks(FKawaiiFluidSDFBrickData&& Data)
+{
+	if (!bIsInitialized)
+	{
+		return;
+	}
+
+	UE_LOG(LogGPUCollisionManager, Verbose, TEXT("Enqueued SDF brick upload: %d bricks, %d table slots"),
+		Data.GetNumBricks(), Data.BrickTable.Num());
+
+	// Buffers are created by the next AddSDFBrickCollisionPass (needs a graph builder)
+	ENQUEUE_RENDER_COMMAND(UploadSDFBricks)(
+		[this, Data = MoveTemp(Data)](FRHICommandListImmediate& RHICmdList) mutable
+		{
+			PendingSDFBrickData = MoveTemp(Data);
+			bSDFBrickUploadPending = true;
+		});
+}
+
+void FGPUCollisionManager::AddSDFBrickCollisionPass(
+	FRDGBuilder& GraphBuilder,
+	const FSimulationSpatialData& SpatialData,
+	int32 ParticleCount,
+	const FGPUFluidSimulationParams& Params,
+	FRDGBufferRef IndirectArgsBuffer)
+{
+	// Publish a pending upload (once per upload, not per solver iteration)
+	if (bSDFBrickUploadPending)
+	{
+		bSDFBrickUploadPending = false;
+
+		if (PendingSDFBrickData.IsEmpty())
+		{
+			SDFBrickTableBuffer.SafeRelease();
+			SDFBrickSamplesBuffer.SafeRelease();
+			bSDFBrickDataValid = false;
+		}
+		else
+		{
+			FRDGBufferRef TableBuffer = CreateStructuredBuffer(
+				GraphBuilder,
+				TEXT("GPUSDFBrickTable"),
+				sizeof(FIntVector4),
+				PendingSDFBrickData.BrickTable.Num(),
+				PendingSDFBrickData.BrickTable.GetData(),
+				PendingSDFBrickData.BrickTable.Num() * sizeof(FIntVector4)
+			);
+			FRDGBufferRef SamplesBuffer = CreateStructuredBuffer(
+				GraphBuilder,
+				TEXT("GPUSDFBrickSamples"),
+				sizeof(float),
+				PendingSDFBrickData.Samples.Num(),
+				PendingSDFBrickData.Samples.GetData(),
+				PendingSDFBrickData.Samples.Num() * sizeof(float)
+			);
+			SDFBrickTableBuffer = GraphBuilder.ConvertToExternalBuffer(TableBuffer);
+			SDFBrickSamplesBuffer = GraphBuilder.ConvertToExternalBuffer(SamplesBuffer);
+
+			SDFBrickTableMask = static_cast<uint32>(PendingSDFBrickData.BrickTable.Num() - 1);
+			SDFBrickInvVoxelSize = 1.0f / PendingSDFBrickData.VoxelSize;
+			SDFBrickCount = PendingSDFBrickData.GetNumBricks();
+			bSDFBrickDataValid = true;
+		}
+
+		// Initial data was copied by CreateStructuredBuffer
+		PendingSDFBrickData = FKawaiiFluidSDFBrickData();
+	}
+
+	// Skip if SDF brick collision is not enabled or no valid data
+	if (!SDFBrickParams.bEnabled || !bSDFBrickDataValid || !SDFBrickTableBuffer.IsValid() || !SDFBrickSamplesBuffer.IsValid())
+	{
+		return;
+	}
+
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+	TShaderMapRef<FSDFBrickCollisionCS> ComputeShader(ShaderMap);
+
+	FSDFBrickCollisionCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FSDFBrickCollisionCS::FParameters>();
+	// Bind SOA buffers
+	PassParameters->Positions = GraphBuilder.CreateUAV(SpatialData.SoA_Positions, PF_R32_FLOAT);
+	PassParameters->PredictedPositions = GraphBuilder.CreateUAV(SpatialData.SoA_PredictedPositions, PF_R32_FLOAT);
+	PassParameters->PackedVelocities = GraphBuilder.CreateUAV(SpatialData.SoA_PackedVelocities, PF_R32G32_UINT);  // B plan
+	PassParameters->Flags = GraphBuilder.CreateUAV(SpatialData.SoA_Flags, PF_R32_UINT);
+	PassParameters->ParticleCount = ParticleCount;
+	if (IndirectArgsBuffer) PassParameters->ParticleCountBuffer = GraphBuilder.CreateSRV(IndirectArgsBuffer);
+
+	// Brick data
+	PassParameters->BrickTable = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(SDFBrickTableBuffer, TEXT("GPUSDFBrickTable")));
+	PassParameters->BrickSamples = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(SDFBrickSamplesBuffer, TEXT("GPUSDFBrickSamples")));
+	PassParameters->BrickTableMask = SDFBrickTableMask;
+	PassParameters->InvVoxelSize = SDFBrickInvVoxelSize;
+
+	// Collision response parameters (same threshold as the primitive pass)
+	PassParameters->CollisionThreshold = PrimitiveCollisionThreshold;
+	PassParameters->Friction = SDFBrickParams.Friction;
+	PassParameters->Restitution = SDFBrickParams.Restitution;
+
+	if (IndirectArgsBuffer)
+	{
+		GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
+			RDG_EVENT_NAME("GPUFluid::SDFBrickCollision(%d bricks)", SDFBrickCount),
+			ComputeShader, PassParameters, IndirectArgsBuffer,
+			GPUIndirectDispatch::IndirectArgsOffset_TG256);
+	}
+	else
+	{
+		const uint32 NumGroups = FMath::DivideAndRoundUp(ParticleCount, FSDFBrickCollisionCS::ThreadGroupSize);
+		FComputeShaderUtils::AddPass(GraphBuilder,
+			RDG_EVENT_NAME("GPUFluid::SDFBrickCollision(%d bricks)", SDFBrickCount),
+			ComputeShader, PassParameters, FIntVector(NumGroups, 1, 1));
+	}
+}
@@ -7,6 +7,7 @@
 #include "RenderGraphBuilder.h"
 #include "RenderGraphUtils.h"
 #include "RHIGPUReadback.h"
+#include "Algo/Unique.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogGPUSpawnManager, Log, All);
 DEFINE_LOG_CATEGORY(LogGPUSpawnManager);
@@ -41,11 +42,12 @@ void FGPUSpawnManager::Initialize(int32 InMaxParticleCount)
 	MaxParticleCapacity = InMaxParticleCount;
 	bIsInitialized = true;
 
-	// Initialize source counter cache
-	CachedSourceCounts.SetNumZeroed(EGPUParticleSource::MaxSourceCount);
+	// Source counter cache grows with the counter buffer (sparse, up to the highest SourceID)
+	CachedSourceCounts.Reset();
+	DirtySourceRanges.Reset();
 
-	// Initialize per-source emitter max counts
-	EmitterMaxCountsCPU.SetNumZeroed(EGPUParticleSource::MaxSourceCount);
+	// Per-source emitter max counts grow on SetSourceEmitterMax
+	EmitterMaxCountsCPU.Reset();
 	ActiveEmitterMaxCount = 0;
 	bEmitterMaxCountsDirty = false;
 
@@ -58,6 +60,7 @@ void FGPUSpawnManager::Initialize(int32 InMaxParticleCount)
 	SourceCounterWriteIndex = 0;
 	SourceCounterReadIndex = 0;
 	SourceCounterPendingCount = 0;
+	SourceCounterReadbackRanges.SetNum(SourceCounterRingBufferSize);
 
 	UE_LOG(LogGPUSpawnManager, Log, TEXT("GPUSpawnManager initialized with capacity: %d, MaxSourceCount: %d"),
 		MaxParticleCapacity, EGPUParticleSource::MaxSourceCount);
@@ -78,6 +81,8 @@ void FGPUSpawnManager::Release()
 		ActiveGPUBrushDespawns.Empty();
 		PendingGPUSourceDespawns.Empty();
 		ActiveGPUSourceDespawns.Empty();
+		PendingGPUIDDespawns.Empty();
+		ActiveGPUIDDespawns.Empty();
 		bHasPendingGPUDespawnRequests.store(false);
 	}
 
@@ -85,6 +90,10 @@ void FGPUSpawnManager::Release()
 	{
 		FScopeLock Lock(&SourceCountLock);
 		SourceCounterBuffer.SafeRelease();
+		SourceCounterCapacity = 0;
+		SourceCounterGatherBuffer.SafeRelease();
+		SourceCounterGatherCapacity = 0;
+		DirtySourceRanges.Reset();
 		for (FRHIGPUBufferReadback* Readback : SourceCounterReadbacks)
 		{
 			if (Readback)
@@ -96,6 +105,7 @@ void FGPUSpawnManager::Release()
 		SourceCounterWriteIndex = 0;
 		SourceCounterReadIndex = 0;
 		SourceCounterPendingCount = 0;
+		SourceCounterReadbackRanges.Empty();
 		CachedSourceCounts.Empty();
 	}
 
@@ -116,6 +126,7 @@ void FGPUSpawnManager::Release()
 	// Release per-source recycle buffers
 	PersistentEmitterMaxCountsBuffer.SafeRelease();
 	PersistentPerSourceExcessBuffer.SafeRelease();
+	PerSourceRecycleCapacity = 0;
 	EmitterMaxCountsCPU.Empty();
 	ActiveEmitterMaxCount = 0;
 	bEmitterMaxCountsDirty = false;
@@ -148,7 +159,7 @@ void FGPUSpawnManager::AddSpawnRequest(const FVector3f& Position, const FVector3
 		Position.X, Position.Y, Position.Z, Velocity.X, Velocity.Y, Velocity.Z);
 }
 
-void FGPUSpawnManager::AddSpawnRequests(const TArray<FGPUSpawnRequest>& Requests)
+void FGPUSpawnManager::AddSpawnRequests(TConstArrayView<FGPUSpawnRequest> Requests)
 {
 	if (Requests.Num() == 0)
 	{
@@ -233,6 +244,18 @@ void FGPUSpawnManager::AddGPUDespawnSourceRequest(int32 SourceID)
 	bHasPendingGPUDespawnRequests.store(true);
 }
 
+void FGPUSpawnManager::AddGPUDespawnIDRequests(TConstArrayView<int32> ParticleIDs)
+{
+	if (ParticleIDs.Num() == 0)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&GPUDespawnLock);
+	PendingGPUIDDespawns.Append(ParticleIDs.GetData(), ParticleIDs.Num());
+	bHasPendingGPUDespawnRequests.store(true);
+}
+
 void FGPUSpawnManager::SetSourceEmitterMax(int32 SourceID, int32 MaxCount)
 {
 	if (SourceID < 0 || SourceID >= EGPUParticleSource::MaxSourceCount)
@@ -242,9 +265,14 @@ void FGPUSpawnManager::SetSourceEmitterMax(int32 SourceID, int32 MaxCount)
 
 	FScopeLock Lock(&GPUDespawnLock);
 
-	if (EmitterMaxCountsCPU.Num() == 0)
+	// Sparse: only as long as the highest SourceID that ever had a limit
+	if (SourceID >= EmitterMaxCountsCPU.Num())
 	{
-		EmitterMaxCountsCPU.SetNumZeroed(EGPUParticleSource::MaxSourceCount);
+		if (MaxCount == 0)
+		{
+			return;
+		}
+		EmitterMaxCountsCPU.SetNumZeroed(SourceID + 1);
 	}
 
 	const int32 OldValue = EmitterMaxCountsCPU[SourceID];
@@ -280,16 +308,26 @@ bool FGPUSpawnManager::SwapGPUDespawnBuffers()
 	ActiveGPUSourceDespawns = MoveTemp(PendingGPUSourceDespawns);
 	PendingGPUSourceDespawns.Empty();
 
+	// The ID mark shader binary-searches a sorted, duplicate-free list
+	ActiveGPUIDDespawns = MoveTemp(PendingGPUIDDespawns);
+	PendingGPUIDDespawns.Empty();
+	if (ActiveGPUIDDespawns.Num() > 1)
+	{
+		ActiveGPUIDDespawns.Sort();
+		ActiveGPUIDDespawns.SetNum(Algo::Unique(ActiveGPUIDDespawns));
+	}
+
 	bHasPendingGPUDespawnRequests.store(false);
 
 	const bool bHasAny = (ActiveGPUBrushDespawns.Num() > 0 ||
 		ActiveGPUSourceDespawns.Num() > 0 ||
+		ActiveGPUIDDespawns.Num() > 0 ||
 		HasPerSourceRecycle());
 
 	if (bHasAny)
 	{
-		UE_LOG(LogGPUSpawnManager, Verbose, TEXT("SwapGPUDespawnBuffers: Brush=%d, Source=%d, PerSourceRecycle=%s"),
-			ActiveGPUBrushDespawns.Num(), ActiveGPUSourceDespawns.Num(), HasPerSourceRecycle() ? TEXT("Yes") : TEXT("No"));
+		UE_LOG(LogGPUSpawnManager, Verbose, TEXT("SwapGPUDespawnBuffers: Brush=%d, Source=%d, ID=%d, PerSourceRecycle=%s"),
+			ActiveGPUBrushDespawns.Num(), ActiveGPUSourceDespawns.Num(), ActiveGPUIDDespawns.Num(), HasPerSourceRecycle() ? TEXT("Yes") : TEXT("No"));
 	}
 
 	return bHasAny;
@@ -307,15 +345,17 @@ void FGPUSpawnManager::AddGPUDespawnPass(
 	{
 		ActiveGPUBrushDespawns.Empty();
 		ActiveGPUSourceDespawns.Empty();
+		ActiveGPUIDDespawns.Empty();
 		return;
 	}
 
 	const bool bHasBrush = ActiveGPUBrushDespawns.Num() > 0;
 	const bool bHasSource = ActiveGPUSourceDespawns.Num() > 0;
+	const bool bHasID = ActiveGPUIDDespawns.Num() > 0;
 	const bool bHasPerSourceRecycle = HasPerSourceRecycle();
 	const bool bHasOldest = bHasPerSourceRecycle;
 
-	if (!bHasBrush && !bHasSource && !bHasOldest)
+	if (!bHasBrush && !bHasSource && !bHasID && !bHasOldest)
 	{
 		return;
 	}
@@ -324,6 +364,17 @@ void FGPUSpawnManager::AddGPUDespawnPass(
 	// PrefixSum/Compact still use MaxParticleCapacity (single-pass, correct with ClearUAV(0)).
 	const int32 CompactionElementCount = MaxParticleCapacity;
 
+	// Snapshot per-source limits (SetSourceEmitterMax may grow the array on the game thread)
+	TArray<int32> EmitterMaxCounts;
+	bool bUploadEmitterMaxCounts = false;
+	if (bHasPerSourceRecycle)
+	{
+		FScopeLock Lock(&GPUDespawnLock);
+		EmitterMaxCounts = EmitterMaxCountsCPU;
+		bUploadEmitterMaxCounts = bEmitterMaxCountsDirty;
+		bEmitterMaxCountsDirty = false;
+	}
+
 	FRDGBufferRef AliveMaskBuffer;
 	FRDGBufferRef PrefixSumsBuffer;
 	FRDGBufferRef BlockSumsBuffer;
@@ -340,8 +391,35 @@ void FGPUSpawnManager::AddGPUDespawnPass(
 		AliveMaskBuffer = GraphBuilder.RegisterExternalBuffer(PersistentAliveMaskBuffer, TEXT("AliveMask"));
 		PrefixSumsBuffer = GraphBuilder.RegisterExternalBuffer(PersistentPrefixSumsBuffer, TEXT("PrefixSums"));
 		BlockSumsBuffer = GraphBuilder.RegisterExternalBuffer(PersistentBlockSumsBuffer, TEXT("BlockSums"));
+
+		// Recycle reads a counter per limited source: grow before the UAV below is created
+		if (bHasPerSourceRecycle)
+		{
+			EnsureSourceCounterCapacity(GraphBuilder, EmitterMaxCounts.Num());
+		}
 		SourceCounterUAV = RegisterSourceCounterUAV(GraphBuilder);
 
+		// Counters UpdateSourceCountersDespawnCS may decrement
+		if (bHasBrush || bHasID)
+		{
+			// Any source can lose particles to a brush or an ID list
+			MarkSourceCountersDirty(0, SourceCounterCapacity);
+		}
+		for (const int32 SourceID : ActiveGPUSourceDespawns)
+		{
+			MarkSourceCountersDirty(SourceID, SourceID + 1);
+		}
+		if (bHasPerSourceRecycle)
+		{
+			for (int32 s = 0; s < EmitterMaxCounts.Num(); ++s)
+			{
+				if (EmitterMaxCounts[s] > 0)
+				{
+					MarkSourceCountersDirty(s, s + 1);
+				}
+			}
+		}
+
 		// ParticleCountBuffer SRV for bounds checking in all mark shaders
 		ParticleCountSRV = GraphBuilder.CreateSRV(ParticleCountBuffer);
 
@@ -417,62 +495,55 @@ void FGPUSpawnManager::AddGPUDespawnPass(
 			GPUIndirectDispatch::IndirectArgsOffset_TG256);
 	}
 
-	// Shared: Compute IDShiftBits (used by both per-source and global oldest)
-	const int32 MaxID = FMath::Max(1, NextParticleIDHint);
-	const int32 Log2MaxID = FMath::FloorLog2(MaxID);
-	const int32 IDShiftBits = FMath::Max(0, Log2MaxID - 7);
-
-	// Shared: Ensure histogram buffers exist (reused by per-source loop and global oldest)
-	FRDGBufferRef IDHistogramBuffer = nullptr;
-	FRDGBufferRef OldestThresholdBuffer = nullptr;
-	FRDGBufferRef BoundaryCounterBuffer = nullptr;
-
-	if (bHasOldest)
+	// Step 3b: ID mark pass (sorted IDs, binary search per particle)
+	if (bHasID)
 	{
-		if (!PersistentIDHistogramBuffer.IsValid())
-		{
-			FRDGBufferDesc HistDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 256);
-			IDHistogramBuffer = GraphBuilder.CreateBuffer(HistDesc, TEXT("IDHistogram"));
-			PersistentIDHistogramBuffer = GraphBuilder.ConvertToExternalBuffer(IDHistogramBuffer);
-		}
-		else
-		{
-			IDHistogramBuffer = GraphBuilder.RegisterExternalBuffer(PersistentIDHistogramBuffer, TEXT("IDHistogram"));
-		}
+		RDG_EVENT_SCOPE(GraphBuilder, "GPUDespawn_MarkID");
 
-		if (!PersistentOldestThresholdBuffer.IsValid())
-		{
-			FRDGBufferDesc ThreshDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 2);
-			OldestThresholdBuffer = GraphBuilder.CreateBuffer(ThreshDesc, TEXT("OldestThreshold"));
-			PersistentOldestThresholdBuffer = GraphBuilder.ConvertToExternalBuffer(OldestThresholdBuffer);
-		}
-		else
-		{
-			OldestThresholdBuffer = GraphBuilder.RegisterExternalBuffer(PersistentOldestThresholdBuffer, TEXT("OldestThreshold"));
-		}
+		FRDGBufferRef ParticleIDBuffer = CreateStructuredBuffer(
+			GraphBuilder,
+			TEXT("GPUDespawnParticleIDs"),
+			sizeof(int32),
+			ActiveGPUIDDespawns.Num(),
+			ActiveGPUIDDespawns.GetData(),
+			ActiveGPUIDDespawns.Num() * sizeof(int32),
+			ERDGInitialDataFlags::None
+		);
 
-		if (!PersistentBoundaryCounterBuffer.IsValid())
-		{
-			FRDGBufferDesc CounterDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 1);
-			BoundaryCounterBuffer = GraphBuilder.CreateBuffer(CounterDesc, TEXT("BoundaryCounter"));
-			PersistentBoundaryCounterBuffer = GraphBuilder.ConvertToExternalBuffer(BoundaryCounterBuffer);
-		}
-		else
-		{
-			BoundaryCounterBuffer = GraphBuilder.RegisterExternalBuffer(PersistentBoundaryCounterBuffer, TEXT("BoundaryCounter"));
-		}
+		TShaderMapRef<FMarkDespawnByIDCS> IDCS(ShaderMap);
+		FMarkDespawnByIDCS::FParameters* IDParams = GraphBuilder.AllocParameters<FMarkDespawnByIDCS::FParameters>();
+		IDParams->DespawnParticleIDs = GraphBuilder.CreateSRV(ParticleIDBuffer);
+		IDParams->Particles = GraphBuilder.CreateSRV(InOutParticleBuffer);
+		IDParams->OutAliveMask = GraphBuilder.CreateUAV(AliveMaskBuffer);
+		IDParams->ParticleCountBuffer = ParticleCountSRV;
+		IDParams->DespawnParticleIDCount = ActiveGPUIDDespawns.Num();
+
+		GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
+			RDG_EVENT_NAME("GPUFluid::DespawnID(%d ids)", ActiveGPUIDDespawns.Num()),
+			IDCS, IDParams, ParticleCountBuffer,
+			GPUIndirectDispatch::IndirectArgsOffset_TG256);
 	}
 
-	// Step 3.5: Per-source recycle — compute PerSourceExcess[64] and run oldest 3-pass per source
+	// Compute IDShiftBits (ParticleID bucket width for the oldest histogram)
+	const int32 MaxID = FMath::Max(1, NextParticleIDHint);
+	const int32 Log2MaxID = FMath::FloorLog2(MaxID);
+	const int32 IDShiftBits = FMath::Max(0, Log2MaxID - 7);
+
+	// Step 3.5: Per-source recycle — compute PerSourceExcess[] and run the oldest 3-pass over all limited sources
 	if (bHasPerSourceRecycle)
 	{
 		RDG_EVENT_SCOPE(GraphBuilder, "GPUDespawn_PerSourceRecycle");
 
+		// One slot per source counter (sparse: the counter buffer covers the highest limited SourceID)
+		const int32 SlotCount = SourceCounterCapacity;
+		const bool bRecycleBuffersResized = PerSourceRecycleCapacity != SlotCount;
+		PerSourceRecycleCapacity = SlotCount;
+
 		// Ensure PerSourceExcess buffer exists
 		FRDGBufferRef PerSourceExcessBuffer;
-		if (!PersistentPerSourceExcessBuffer.IsValid())
+		if (!PersistentPerSourceExcessBuffer.IsValid() || bRecycleBuffersResized)
 		{
-			FRDGBufferDesc Desc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), EGPUParticleSource::MaxSourceCount);
+			FRDGBufferDesc Desc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), SlotCount);
 			PerSourceExcessBuffer = GraphBuilder.CreateBuffer(Desc, TEXT("PerSourceExcess"));
 			PersistentPerSourceExcessBuffer = GraphBuilder.ConvertToExternalBuffer(PerSourceExcessBuffer);
 		}
@@ -483,26 +554,25 @@ void FGPUSpawnManager::AddGPUDespawnPass(
 
 		// Ensure EmitterMaxCounts buffer exists and upload if dirty
 		FRDGBufferRef EmitterMaxCountsBuffer;
-		if (!PersistentEmitterMaxCountsBuffer.IsValid() || bEmitterMaxCountsDirty)
+		if (!PersistentEmitterMaxCountsBuffer.IsValid() || bUploadEmitterMaxCounts || bRecycleBuffersResized)
 		{
 			TArray<uint32> MaxCountsUint32;
-			MaxCountsUint32.SetNumUninitialized(EGPUParticleSource::MaxSourceCount);
-			for (int32 i = 0; i < EGPUParticleSource::MaxSourceCount; ++i)
+			MaxCountsUint32.SetNumUninitialized(SlotCount);
+			for (int32 i = 0; i < SlotCount; ++i)
 			{
-				MaxCountsUint32[i] = static_cast<uint32>(FMath::Max(0, EmitterMaxCountsCPU.IsValidIndex(i) ? EmitterMaxCountsCPU[i] : 0));
+				MaxCountsUint32[i] = static_cast<uint32>(FMath::Max(0, EmitterMaxCounts.IsValidIndex(i) ? EmitterMaxCounts[i] : 0));
 			}
 
 			EmitterMaxCountsBuffer = CreateStructuredBuffer(
 				GraphBuilder,
 				TEXT("EmitterMaxCounts"),
 				sizeof(uint32),
-				EGPUParticleSource::MaxSourceCount,
+				SlotCount,
 				MaxCountsUint32.GetData(),
 				MaxCountsUint32.Num() * sizeof(uint32),
 				ERDGInitialDataFlags::None
 			);
 			PersistentEmitterMaxCountsBuffer = GraphBuilder.ConvertToExternalBuffer(EmitterMaxCountsBuffer);
-			bEmitterMaxCountsDirty = false;
 		}
 		else
 		{
@@ -511,10 +581,10 @@ void FGPUSpawnManager::AddGPUDespawnPass(
 
 		// Build per-source incoming spawn counts from ActiveSpawnRequests
 		TArray<uint32> IncomingCounts;
-		IncomingCounts.SetNumZeroed(EGPUParticleSource::MaxSourceCount);
+		IncomingCounts.SetNumZeroed(SlotCount);
 		for (const FGPUSpawnRequest& Req : ActiveSpawnRequests)
 		{
-			if (Req.SourceID >= 0 && Req.SourceID < EGPUParticleSource::MaxSourceCount)
+			if (Req.SourceID >= 0 && Req.SourceID < SlotCount)
 			{
 				IncomingCounts[Req.SourceID]++;
 			}
@@ -524,7 +594,7 @@ void FGPUSpawnManager::AddGPUDespawnPass(
 			GraphBuilder,
 			TEXT("IncomingSpawnCounts"),
 			sizeof(uint32),
-			EGPUParticleSource::MaxSourceCount,
+			SlotCount,
 			IncomingCounts.GetData(),
 			IncomingCounts.Num() * sizeof(uint32),
 			ERDGInitialDataFlags::None
@@ -536,7 +606,7 @@ void FGPUSpawnManager::AddGPUDespawnPass(
 		// Clear PerSourceExcess before compute
 		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(PerSourceExcessBuffer), 0u);
 
-		// Dispatch ComputePerSourceRecycleCS → PerSourceExcess[64]
+		// Dispatch ComputePerSourceRecycleCS → PerSourceExcess[] (one thread per source)
 		{
 			TShaderMapRef<FComputePerSourceRecycleCS> RecycleCS(ShaderMap);
 			FComputePerSourceRecycleCS::FParameters* RecycleParams = GraphBuilder.AllocParameters<FComputePerSourceRecycleCS::FParameters>();
@@ -544,77 +614,86 @@ void FGPUSpawnManager::AddGPUDespawnPass(
 			RecycleParams->EmitterMaxCounts = GraphBuilder.CreateSRV(EmitterMaxCountsBuffer);
 			RecycleParams->IncomingSpawnCounts = GraphBuilder.CreateSRV(IncomingSpawnCountsBuffer);
 			RecycleParams->PerSourceExcess = GraphBuilder.CreateUAV(PerSourceExcessBuffer);
-			RecycleParams->ActiveSourceCount = EGPUParticleSource::MaxSourceCount;
+			RecycleParams->ActiveSourceCount = SlotCount;
 
 			FComputeShaderUtils::AddPass(GraphBuilder,
-				RDG_EVENT_NAME("GPUFluid::ComputePerSourceExcess"),
-				RecycleCS, RecycleParams, FIntVector(1, 1, 1));
+				RDG_EVENT_NAME("GPUFluid::ComputePerSourceExcess(%d)", SlotCount),
+				RecycleCS, RecycleParams,
+				FIntVector(FMath::DivideAndRoundUp(SlotCount, FComputePerSourceRecycleCS::ThreadGroupSize), 1, 1));
 		}
 
 		FRDGBufferSRVRef PerSourceExcessSRV = GraphBuilder.CreateSRV(PerSourceExcessBuffer);
 
-		// Step 3.6: Per-source oldest 3-pass — loop over each source with EmitterMax set
-		for (int32 s = 0; s < EGPUParticleSource::MaxSourceCount; ++s)
+		// Step 3.6: Per-source oldest 3-pass — one dispatch per pass covers every source with excess
+		// (histograms, thresholds and boundary counters are indexed by source slot)
+		const auto RegisterRecycleBuffer = [&GraphBuilder, bRecycleBuffersResized](TRefCountPtr<FRDGPooledBuffer>& PooledBuffer, int32 NumElements, const TCHAR* Name)
 		{
-			if (!EmitterMaxCountsCPU.IsValidIndex(s) || EmitterMaxCountsCPU[s] <= 0)
+			if (!PooledBuffer.IsValid() || bRecycleBuffersResized)
 			{
-				continue;
+				FRDGBufferRef Buffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumElements), Name);
+				PooledBuffer = GraphBuilder.ConvertToExternalBuffer(Buffer);
+				return Buffer;
 			}
+			return GraphBuilder.RegisterExternalBuffer(PooledBuffer, Name);
+		};
 
-			// Clear histogram and boundary counter for this source
-			AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(IDHistogramBuffer), 0u);
-			AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(BoundaryCounterBuffer), 0u);
+		FRDGBufferRef IDHistogramBuffer = RegisterRecycleBuffer(PersistentIDHistogramBuffer, SlotCount * 256, TEXT("IDHistogram"));
+		FRDGBufferRef OldestThresholdBuffer = RegisterRecycleBuffer(PersistentOldestThresholdBuffer, SlotCount * 2, TEXT("OldestThreshold"));
+		FRDGBufferRef BoundaryCounterBuffer = RegisterRecycleBuffer(PersistentBoundaryCounterBuffer, SlotCount, TEXT("BoundaryCounter"));
 
-			// Pass 1: BuildIDHistogramCS (filtered to SourceID == s)
-			{
-				TShaderMapRef<FBuildIDHistogramCS> HistCS(ShaderMap);
-				FBuildIDHistogramCS::FParameters* HistParams = GraphBuilder.AllocParameters<FBuildIDHistogramCS::FParameters>();
-				HistParams->Particles = GraphBuilder.CreateSRV(InOutParticleBuffer);
-				HistParams->IDHistogram = GraphBuilder.CreateUAV(IDHistogramBuffer);
-				HistParams->ParticleCountBuffer = ParticleCountSRV;
-				HistParams->PerSourceExcess = PerSourceExcessSRV;
-				HistParams->FilterSourceID = s;
-				HistParams->IDShiftBits = IDShiftBits;
-
-				GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
-					RDG_EVENT_NAME("GPUFluid::PerSourceOldest_Histogram(src=%d)", s),
-					HistCS, HistParams, ParticleCountBuffer,
-					GPUIndirectDispatch::IndirectArgsOffset_TG256);
-			}
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(IDHistogramBuffer), 0u);
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(BoundaryCounterBuffer), 0u);
 
-			// Pass 2: FindOldestThresholdCS (removeCount = PerSourceExcess[s], read on GPU)
-			{
-				TShaderMapRef<FFindOldestThresholdCS> ThreshCS(ShaderMap);
-				FFindOldestThresholdCS::FParameters* ThreshParams = GraphBuilder.AllocParameters<FFindOldestThresholdCS::FParameters>();
-				ThreshParams->IDHistogram = GraphBuilder.CreateUAV(IDHistogramBuffer);
-				ThreshParams->OldestThreshold = GraphBuilder.CreateUAV(OldestThresholdBuffer);
-				ThreshParams->ParticleCountBuffer = ParticleCountSRV;
-				ThreshParams->PerSourceExcess = PerSourceExcessSRV;
-				ThreshParams->FilterSourceID = s;
-
-				FComputeShaderUtils::AddPass(GraphBuilder,
-					RDG_EVENT_NAME("GPUFluid::PerSourceOldest_Threshold(src=%d)", s),
-					ThreshCS, ThreshParams, FIntVector(1, 1, 1));
-			}
+		// Pass 1: BuildIDHistogramCS (particles of sources with excess, binned by SourceID)
+		{
+			TShaderMapRef<FBuildIDHistogramCS> HistCS(ShaderMap);
+			FBuildIDHistogramCS::FParameters* HistParams = GraphBuilder.AllocParameters<FBuildIDHistogramCS::FParameters>();
+			HistParams->Particles = GraphBuilder.CreateSRV(InOutParticleBuffer);
+			HistParams->IDHistogram = GraphBuilder.CreateUAV(IDHistogramBuffer);
+			HistParams->ParticleCountBuffer = ParticleCountSRV;
+			HistParams->PerSourceExcess = PerSourceExcessSRV;
+			HistParams->SourceCount = SlotCount;
+			HistParams->IDShiftBits = IDShiftBits;
+
+			GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
+				RDG_EVENT_NAME("GPUFluid::PerSourceOldest_Histogram(%d slots)", SlotCount),
+				HistCS, HistParams, ParticleCountBuffer,
+				GPUIndirectDispatch::IndirectArgsOffset_TG256);
+		}
 
-			// Pass 3: MarkOldestParticlesCS (filtered to SourceID == s)
-			{
-				TShaderMapRef<FMarkOldestParticlesCS> MarkCS(ShaderMap);
-				FMarkOldestParticlesCS::FParameters* MarkParams = GraphBuilder.AllocParameters<FMarkOldestParticlesCS::FParameters>();
-				MarkParams->Particles = GraphBuilder.CreateSRV(InOutParticleBuffer);
-				MarkParams->OldestThreshold = GraphBuilder.CreateUAV(OldestThresholdBuffer);
-				MarkParams->OutAliveMask = GraphBuilder.CreateUAV(AliveMaskBuffer);
-				MarkParams->BoundaryCounter = GraphBuilder.CreateUAV(BoundaryCounterBuffer);
-				MarkParams->ParticleCountBuffer = ParticleCountSRV;
-				MarkParams->PerSourceExcess = PerSourceExcessSRV;
-				MarkParams->FilterSourceID = s;
-				MarkParams->IDShiftBits = IDShiftBits;
-
-				GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
-					RDG_EVENT_NAME("GPUFluid::PerSourceOldest_Mark(src=%d)", s),
-					MarkCS, MarkParams, ParticleCountBuffer,
-					GPUIndirectDispatch::IndirectArgsOffset_TG256);
-			}
+		// Pass 2: FindOldestThresholdCS (one thread per source, removeCount = PerSourceExcess[s] read on GPU)
+		{
+			TShaderMapRef<FFindOldestThresholdCS> ThreshCS(ShaderMap);
+			FFindOldestThresholdCS::FParameters* ThreshParams = GraphBuilder.AllocParameters<FFindOldestThresholdCS::FParameters>();
+			ThreshParams->IDHistogram = GraphBuilder.CreateUAV(IDHistogramBuffer);
+			ThreshParams->OldestThreshold = GraphBuilder.CreateUAV(OldestThresholdBuffer);
+			ThreshParams->ParticleCountBuffer = ParticleCountSRV;
+			ThreshParams->PerSourceExcess = PerSourceExcessSRV;
+			ThreshParams->SourceCount = SlotCount;
+
+			FComputeShaderUtils::AddPass(GraphBuilder,
+				RDG_EVENT_NAME("GPUFluid::PerSourceOldest_Threshold(%d slots)", SlotCount),
+				ThreshCS, ThreshParams,
+				FIntVector(FMath::DivideAndRoundUp(SlotCount, FFindOldestThresholdCS::ThreadGroupSize), 1, 1));
+		}
+
+		// Pass 3: MarkOldestParticlesCS (each particle against its own source's threshold)
+		{
+			TShaderMapRef<FMarkOldestParticlesCS> MarkCS(ShaderMap);
+			FMarkOldestParticlesCS::FParameters* MarkParams = GraphBuilder.AllocParameters<FMarkOldestParticlesCS::FParameters>();
+			MarkParams->Particles = GraphBuilder.CreateSRV(InOutParticleBuffer);
+			MarkParams->OldestThreshold = GraphBuilder.CreateUAV(OldestThresholdBuffer);
+			MarkParams->OutAliveMask = GraphBuilder.CreateUAV(AliveMaskBuffer);
+			MarkParams->BoundaryCounter = GraphBuilder.CreateUAV(BoundaryCounterBuffer);
+			MarkParams->ParticleCountBuffer = ParticleCountSRV;
+			MarkParams->PerSourceExcess = PerSourceExcessSRV;
+			MarkParams->SourceCount = SlotCount;
+			MarkParams->IDShiftBits = IDShiftBits;
+
+			GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
+				RDG_EVENT_NAME("GPUFluid::PerSourceOldest_Mark(%d slots)", SlotCount),
+				MarkCS, MarkParams, ParticleCountBuffer,
+				GPUIndirectDispatch::IndirectArgsOffset_TG256);
 		}
 	}
 
@@ -628,7 +707,7 @@ void FGPUSpawnManager::AddGPUDespawnPass(
 		UpdateParams->Particles = GraphBuilder.CreateSRV(InOutParticleBuffer);
 		UpdateParams->SourceCounters = SourceCounterUAV;
 		UpdateParams->ParticleCountBuffer = ParticleCountSRV;
-		UpdateParams->MaxSourceCount = EGPUParticleSource::MaxSourceCount;
+		UpdateParams->MaxSourceCount = SourceCounterCapacity;
 
 		GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
 			RDG_EVENT_NAME("GPUFluid::DespawnUpdateSourceCounters"),
@@ -720,6 +799,7 @@ void FGPUSpawnManager::AddGPUDespawnPass(
 	// Clear active requests
 	ActiveGPUBrushDespawns.Empty();
 	ActiveGPUSourceDespawns.Empty();
+	ActiveGPUIDDespawns.Empty();
 }
 
 //=============================================================================
@@ -763,6 +843,21 @@ void FGPUSpawnManager::AddSpawnParticlesPass(
 		ERDGInitialDataFlags::None
 	);
 
+	// Counters this batch increments: grow the buffer to the highest SourceID, read them back
+	int32 MaxRequestSourceID = EGPUParticleSource::InvalidSourceID;
+	int32 LastSourceID = EGPUParticleSource::InvalidSourceID;
+	for (const FGPUSpawnRequest& Req : ActiveSpawnRequests)
+	{
+		// Requests arrive in per-source batches
+		if (Req.SourceID != LastSourceID && Req.SourceID >= 0 && Req.SourceID < EGPUParticleSource::MaxSourceCount)
+		{
+			LastSourceID = Req.SourceID;
+			MaxRequestSourceID = FMath::Max(MaxRequestSourceID, Req.SourceID);
+			MarkSourceCountersDirty(Req.SourceID, Req.SourceID + 1);
+		}
+	}
+	EnsureSourceCounterCapacity(GraphBuilder, MaxRequestSourceID + 1);
+
 	// Get or create source counter buffer UAV
 	FRDGBufferUAVRef SourceCounterUAV = RegisterSourceCounterUAV(GraphBuilder);
 
@@ -774,7 +869,7 @@ void FGPUSpawnManager::AddSpawnParticlesPass(
 	PassParameters->SpawnRequestCount = ActiveSpawnRequests.Num();
 	PassParameters->MaxParticleCount = MaxParticleCount;
 	PassParameters->NextParticleID = NextParticleID.load();
-	PassParameters->MaxSourceCount = EGPUParticleSource::MaxSourceCount;
+	PassParameters->MaxSourceCount = SourceCounterCapacity;
 	PassParameters->DefaultRadius = DefaultSpawnRadius;
 	PassParameters->DefaultMass = DefaultSpawnMass;
 
@@ -808,26 +903,47 @@ void FGPUSpawnManager::OnSpawnComplete(int32 SpawnedCount)
 FRDGBufferUAVRef FGPUSpawnManager::RegisterSourceCounterUAV(FRDGBuilder& GraphBuilder)
 {
 	// Create persistent buffer if not exists
-	if (!SourceCounterBuffer.IsValid())
+	EnsureSourceCounterCapacity(GraphBuilder, MinSourceCounterSlots);
+
+	// Register existing buffer
+	FRDGBufferRef RegisteredBuffer = GraphBuilder.RegisterExternalBuffer(SourceCounterBuffer, TEXT("GPUSourceCounters"));
+	return GraphBuilder.CreateUAV(RegisteredBuffer);
+}
+
+void FGPUSpawnManager::EnsureSourceCounterCapacity(FRDGBuilder& GraphBuilder, int32 RequiredSlots)
+{
+	RequiredSlots = FMath::Clamp(RequiredSlots, MinSourceCounterSlots, EGPUParticleSource::MaxSourceCount);
+	if (SourceCounterBuffer.IsValid() && RequiredSlots <= SourceCounterCapacity)
 	{
-		// Allocate on render thread via RDG
-		FRDGBufferDesc Desc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), EGPUParticleSource::MaxSourceCount);
-		FRDGBufferRef TempBuffer = GraphBuilder.CreateBuffer(Desc, TEXT("GPUSourceCounters"));
+		return;
+	}
 
-		// Initialize to zero
-		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(TempBuffer), 0u);
+	// Power-of-two growth: a few reallocations while sources register, then stable
+	const int32 NewCapacity = FMath::Min(static_cast<int32>(FMath::RoundUpToPowerOfTwo(RequiredSlots)), EGPUParticleSource::MaxSourceCount);
 
-		// Extract to persistent buffer
-		GraphBuilder.QueueBufferExtraction(TempBuffer, &SourceCounterBuffer);
+	FRDGBufferDesc Desc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NewCapacity);
+	FRDGBufferRef NewBuffer = GraphBuilder.CreateBuffer(Desc, TEXT("GPUSourceCounters"));
 
-		UE_LOG(LogGPUSpawnManager, Log, TEXT("Created SourceCounterBuffer with %d slots"), EGPUParticleSource::MaxSourceCount);
+	// Initialize to zero
+	AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(NewBuffer), 0u);
 
-		return GraphBuilder.CreateUAV(TempBuffer);
+	// Keep the live counters of the smaller buffer
+	if (SourceCounterBuffer.IsValid() && SourceCounterCapacity > 0)
+	{
+		FRDGBufferRef OldBuffer = GraphBuilder.RegisterExternalBuffer(SourceCounterBuffer, TEXT("GPUSourceCountersOld"));
+		AddCopyBufferPass(GraphBuilder, NewBuffer, 0, OldBuffer, 0, SourceCounterCapacity * sizeof(uint32));
 	}
 
-	// Register existing buffer
-	FRDGBufferRef RegisteredBuffer = GraphBuilder.RegisterExternalBuffer(SourceCounterBuffer, TEXT("GPUSourceCounters"));
-	return GraphBuilder.CreateUAV(RegisteredBuffer);
+	UE_LOG(LogGPUSpawnManager, Log, TEXT("SourceCounterBuffer: %d -> %d slots"), SourceCounterCapacity, NewCapacity);
+
+	SourceCounterBuffer = GraphBuilder.ConvertToExternalBuffer(NewBuffer);
+	SourceCounterCapacity = NewCapacity;
+}
+
+void FGPUSpawnManager::MarkSourceCountersDirty(int32 Begin, int32 End)
+{
+	// Clamped to the allocated counters at readback time
+	DirtySourceRanges.AddRange(FMath::Max(0, Begin), FMath::Min(End, EGPUParticleSource::MaxSourceCount));
 }
 
 int32 FGPUSpawnManager::GetParticleCountForSource(int32 SourceID) const
@@ -849,7 +965,7 @@ int32 FGPUSpawnManager::GetParticleCountForSource(int32 SourceID) const
 	{
 		return CachedSourceCounts[SourceID];
 	}
-	return -1;
+	return 0;  // Sparse cache: no particle of this source was ever counted
 }
 
 TArray<int32> FGPUSpawnManager::GetAllSourceCounts() const
@@ -871,27 +987,87 @@ void FGPUSpawnManager::EnqueueSourceCounterReadback(FRHICommandListImmediate& RH
 		return;
 	}
 
-	// Ring buffer full - skip this frame
+	// No counter changed since the last copy
+	if (DirtySourceRanges.IsEmpty())
+	{
+		return;
+	}
+
+	// Ring buffer full - skip this frame (dirty ranges are kept for the next one)
 	if (SourceCounterPendingCount >= SourceCounterRingBufferSize)
 	{
 		UE_LOG(LogGPUSpawnManager, Verbose, TEXT("SourceCounter ring buffer full, skipping enqueue"));
 		return;
 	}
 
-	// Enqueue to write slot
-	if (SourceCounterReadbacks.IsValidIndex(SourceCounterWriteIndex) && SourceCounterReadbacks[SourceCounterWriteIndex])
+	if (!SourceCounterReadbacks.IsValidIndex(SourceCounterWriteIndex) || !SourceCounterReadbacks[SourceCounterWriteIndex])
 	{
-		const uint32 CopySize = EGPUParticleSource::MaxSourceCount * sizeof(uint32);
+		return;
+	}
 
-		// State transition for readback
-		RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::UAVCompute, ERHIAccess::CopySrc));
-		SourceCounterReadbacks[SourceCounterWriteIndex]->EnqueueCopy(RHICmdList, SourceBuffer, CopySize);
-		RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::CopySrc, ERHIAccess::UAVCompute));
+	// Dirty ranges within the allocated counters
+	TArray<FKawaiiFluidSourceRange> Ranges;
+	int32 NumCounters = 0;
+	for (const FKawaiiFluidSourceRange& Range : DirtySourceRanges.GetRanges())
+	{
+		const int32 End = FMath::Min(Range.End, SourceCounterCapacity);
+		if (Range.Begin < End)
+		{
+			Ranges.Emplace(Range.Begin, End);
+			NumCounters += End - Range.Begin;
+		}
+	}
+	DirtySourceRanges.Reset();
 
-		// Advance write index
-		SourceCounterWriteIndex = (SourceCounterWriteIndex + 1) % SourceCounterRingBufferSize;
-		++SourceCounterPendingCount;
+	if (NumCounters == 0)
+	{
+		return;
+	}
+
+	FRHIGPUBufferReadback* Readback = SourceCounterReadbacks[SourceCounterWriteIndex];
+	const uint32 CopySize = NumCounters * sizeof(uint32);
+
+	// State transition for readback
+	RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::UAVCompute, ERHIAccess::CopySrc));
+
+	if (Ranges.Num() == 1 && Ranges[0].Begin == 0)
+	{
+		// Buffer prefix: copy directly
+		Readback->EnqueueCopy(RHICmdList, SourceBuffer, CopySize);
+	}
+	else
+	{
+		// Pack the dirty ranges back to back, then copy the packed prefix
+		if (!SourceCounterGatherBuffer.IsValid() || SourceCounterGatherCapacity < SourceCounterCapacity)
+		{
+			const FRHIBufferCreateDesc BufferDesc =
+				FRHIBufferCreateDesc::CreateStructured(TEXT("GPUSourceCounterGather"), SourceCounterCapacity * sizeof(uint32), sizeof(uint32))
+				.AddUsage(BUF_None)
+				.SetInitialState(ERHIAccess::CopyDest);
+			SourceCounterGatherBuffer = RHICmdList.CreateBuffer(BufferDesc);
+			SourceCounterGatherCapacity = SourceCounterCapacity;
+		}
+
+		uint32 PackedOffset = 0;
+		for (const FKawaiiFluidSourceRange& Range : Ranges)
+		{
+			RHICmdList.CopyBufferRegion(SourceCounterGatherBuffer, PackedOffset,
+				SourceBuffer, Range.Begin * sizeof(uint32), Range.Num() * sizeof(uint32));
+			PackedOffset += Range.Num() * sizeof(uint32);
+		}
+
+		RHICmdList.Transition(FRHITransitionInfo(SourceCounterGatherBuffer, ERHIAccess::CopyDest, ERHIAccess::CopySrc));
+		Readback->EnqueueCopy(RHICmdList, SourceCounterGatherBuffer, CopySize);
+		RHICmdList.Transition(FRHITransitionInfo(SourceCounterGatherBuffer, ERHIAccess::CopySrc, ERHIAccess::CopyDest));
 	}
+
+	RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::CopySrc, ERHIAccess::UAVCompute));
+
+	SourceCounterReadbackRanges[SourceCounterWriteIndex] = MoveTemp(Ranges);
+
+	// Advance write index
+	SourceCounterWriteIndex = (SourceCounterWriteIndex + 1) % SourceCounterRingBufferSize;
+	++SourceCounterPendingCount;
 }
 
 void FGPUSpawnManager::ProcessSourceCounterReadback()
@@ -910,20 +1086,38 @@ void FGPUSpawnManager::ProcessSourceCounterReadback()
 		return;
 	}
 
-	const uint32 CopySize = EGPUParticleSource::MaxSourceCount * sizeof(uint32);
-	const uint32* Data = static_cast<const uint32*>(SourceCounterReadbacks[SourceCounterReadIndex]->Lock(CopySize));
+	TArray<FKawaiiFluidSourceRange>& Ranges = SourceCounterReadbackRanges[SourceCounterReadIndex];
+	int32 NumCounters = 0;
+	for (const FKawaiiFluidSourceRange& Range : Ranges)
+	{
+		NumCounters += Range.Num();
+	}
 
-	if (Data)
+	if (NumCounters > 0)
 	{
-		FScopeLock Lock(&SourceCountLock);
-		CachedSourceCounts.SetNum(EGPUParticleSource::MaxSourceCount);
-		for (int32 i = 0; i < EGPUParticleSource::MaxSourceCount; ++i)
+		const uint32 CopySize = NumCounters * sizeof(uint32);
+		const uint32* Data = static_cast<const uint32*>(SourceCounterReadbacks[SourceCounterReadIndex]->Lock(CopySize));
+
+		if (Data)
 		{
-			CachedSourceCounts[i] = static_cast<int32>(Data[i]);
+			// Scatter the packed ranges into the sparse cache
+			FScopeLock Lock(&SourceCountLock);
+			if (CachedSourceCounts.Num() < Ranges.Last().End)
+			{
+				CachedSourceCounts.SetNumZeroed(Ranges.Last().End);
+			}
+			for (const FKawaiiFluidSourceRange& Range : Ranges)
+			{
+				for (int32 i = Range.Begin; i < Range.End; ++i)
+				{
+					CachedSourceCounts[i] = static_cast<int32>(*Data++);
+				}
+			}
 		}
-	}
 
-	SourceCounterReadbacks[SourceCounterReadIndex]->Unlock();
+		SourceCounterReadbacks[SourceCounterReadIndex]->Unlock();
+	}
+	Ranges.Reset();
 
 	// Advance read index
 	SourceCounterReadIndex = (SourceCounterReadIndex + 1) % SourceCounterRingBufferSize;
@@ -949,6 +1143,9 @@ void FGPUSpawnManager::ClearSourceCounters(FRDGBuilder& GraphBuilder)
 		}
 	}
 
+	// Copies already in flight hold pre-clear values; the next one overrides them
+	MarkSourceCountersDirty(0, SourceCounterCapacity);
+
 	UE_LOG(LogGPUSpawnManager, Log, TEXT("Cleared all source counters"));
 }
 
@@ -959,15 +1156,17 @@ void FGPUSpawnManager::InitializeSourceCountersFromParticles(const TArray<FGPUFl
 		return;
 	}
 
-	// Count particles by SourceID
+	// Count particles by SourceID (sparse: up to the highest SourceID present)
 	TArray<int32> SourceCounts;
-	SourceCounts.SetNumZeroed(EGPUParticleSource::MaxSourceCount);
-
 	for (const FGPUFluidParticle& Particle : Particles)
 	{
 		const int32 SourceID = Particle.SourceID;
 		if (SourceID >= 0 && SourceID < EGPUParticleSource::MaxSourceCount)
 		{
+			if (SourceID >= SourceCounts.Num())
+			{
+				SourceCounts.SetNumZeroed(SourceID + 1);
+			}
 			SourceCounts[SourceID]++;
 		}
 	}
@@ -980,41 +1179,26 @@ void FGPUSpawnManager::InitializeSourceCountersFromParticles(const TArray<FGPUFl
 
 	// Create or update GPU buffer
 	TArray<uint32> CountsUint32;
-	CountsUint32.SetNumUninitialized(EGPUParticleSource::MaxSourceCount);
-	for (int32 i = 0; i < EGPUParticleSource::MaxSourceCount; ++i)
+	CountsUint32.SetNumUninitialized(SourceCounts.Num());
+	for (int32 i = 0; i < SourceCounts.Num(); ++i)
 	{
 		CountsUint32[i] = static_cast<uint32>(SourceCounts[i]);
 	}
 
 	FGPUSpawnManager* Self = this;
-	TArray<uint32> CountsCopy = CountsUint32;
 
 	ENQUEUE_RENDER_COMMAND(InitializeSourceCounters)(
-		[Self, CountsCopy](FRHICommandListImmediate& RHICmdList)
+		[Self, CountsCopy = MoveTemp(CountsUint32)](FRHICommandListImmediate& RHICmdList) mutable
 		{
 			FRDGBuilder GraphBuilder(RHICmdList, RDG_EVENT_NAME("InitializeSourceCounters"));
 
-			FRDGBufferRef CounterBuffer;
-			if (!Self->SourceCounterBuffer.IsValid())
-			{
-				// Create buffer with initial data if not exists
-				CounterBuffer = CreateStructuredBuffer(
-					GraphBuilder,
-					TEXT("GPUSourceCounters"),
-					sizeof(uint32),
-					EGPUParticleSource::MaxSourceCount,
-					CountsCopy.GetData(),
-					CountsCopy.Num() * sizeof(uint32),
-					ERDGInitialDataFlags::None
-				);
-				GraphBuilder.QueueBufferExtraction(CounterBuffer, &Self->SourceCounterBuffer);
-			}
-			else
-			{
-				// Buffer exists, just upload data
-				CounterBuffer = GraphBuilder.RegisterExternalBuffer(Self->SourceCounterBuffer, TEXT("GPUSourceCounters"));
-				GraphBuilder.QueueBufferUpload(CounterBuffer, CountsCopy.GetData(), CountsCopy.Num() * sizeof(uint32));
-			}
+			// Create or grow the buffer, then overwrite every counter (sources absent from the upload are zero)
+			Self->EnsureSourceCounterCapacity(GraphBuilder, CountsCopy.Num());
+			CountsCopy.SetNumZeroed(Self->SourceCounterCapacity);
+
+			FRDGBufferRef CounterBuffer = GraphBuilder.RegisterExternalBuffer(Self->SourceCounterBuffer, TEXT("GPUSourceCounters"));
+			GraphBuilder.QueueBufferUpload(CounterBuffer, CountsCopy.GetData(), CountsCopy.Num() * sizeof(uint32));
+			Self->MarkSourceCountersDirty(0, Self->SourceCounterCapacity);
 
 			GraphBuilder.Execute();
 		}
@@ -1024,12 +1208,12 @@ void FGPUSpawnManager::InitializeSourceCountersFromParticles(const TArray<FGPUFl
 
 	// Log source counts
 	int32 TotalCounted = 0;
-	for (int32 i = 0; i < EGPUParticleSource::MaxSourceCount; ++i)
+	for (int32 i = 0; i < SourceCounts.Num(); ++i)
 	{
-		if (CachedSourceCounts[i] > 0)
+		if (SourceCounts[i] > 0)
 		{
-			UE_LOG(LogGPUSpawnManager, Log, TEXT("InitializeSourceCounters: SourceID %d = %d particles"), i, CachedSourceCounts[i]);
-			TotalCounted += CachedSourceCounts[i];
+			UE_LOG(LogGPUSpawnManager, Log, TEXT("InitializeSourceCounters: SourceID %d = %d particles"), i, SourceCounts[i]);
+			TotalCounted += SourceCounts[i];
 		}
 	}
 	UE_LOG(LogGPUSpawnManager, Log, TEXT("InitializeSourceCounters: Total %d particles from %d input"), TotalCounted, Particles.Num());
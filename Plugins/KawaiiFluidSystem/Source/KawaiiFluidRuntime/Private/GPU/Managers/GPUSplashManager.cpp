@@ -0,0 +1,251 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// FGPUSplashManager - GPU splash candidate compaction with async readback
+
+#include "GPU/Managers/GPUSplashManager.h"
+#include "GPU/FluidSplashCompactShader.h"
+#include "GPU/GPUIndirectDispatchUtils.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "RHIGPUReadback.h"
+#include "GlobalShader.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGPUSplashManager, Log, All);
+
+//=============================================================================
+// Constructor / Destructor
+//=============================================================================
+
+FGPUSplashManager::FGPUSplashManager()
+	: bIsInitialized(false)
+{
+}
+
+FGPUSplashManager::~FGPUSplashManager()
+{
+	if (bIsInitialized)
+	{
+		Release();
+	}
+}
+
+//=============================================================================
+// Lifecycle
+//=============================================================================
+
+void FGPUSplashManager::Initialize()
+{
+	if (bIsInitialized)
+	{
+		UE_LOG(LogGPUSplashManager, Warning, TEXT("Already initialized"));
+		return;
+	}
+
+	ReadyCandidates.Reserve(FKawaiiFluidSplashSelector::MaxCandidates);
+	bIsInitialized = true;
+
+	UE_LOG(LogGPUSplashManager, Log, TEXT("GPUSplashManager initialized (MaxCandidates=%d)"), FKawaiiFluidSplashSelector::MaxCandidates);
+}
+
+void FGPUSplashManager::Release()
+{
+	ReleaseReadbackObjects();
+
+	{
+		FScopeLock Lock(&SplashLock);
+		ReadyCandidates.Empty();
+		bHasReadyCandidates = false;
+	}
+
+	ReadbackWriteIndex = 0;
+	ReadbackFrameCounter = 0;
+	FrameIndex = 0;
+	bSplashEnabled.store(false);
+	bIsInitialized = false;
+}
+
+void FGPUSplashManager::SetSettings(const FKawaiiFluidSplashSettings& InSettings)
+{
+	FScopeLock Lock(&SplashLock);
+	Settings = InSettings;
+}
+
+//=============================================================================
+// Readback Objects
+//=============================================================================
+
+void FGPUSplashManager::AllocateReadbackObjects()
+{
+	for (int32 i = 0; i < NUM_SPLASH_BUFFERS; ++i)
+	{
+		if (SplashReadbacks[i] == nullptr)
+		{
+			SplashReadbacks[i] = new FRHIGPUBufferReadback(*FString::Printf(TEXT("SplashCandidateReadback_%d"), i));
+		}
+		ReadbackFrameNumbers[i] = 0;
+		ReadbackBudgets[i] = 0;
+	}
+}
+
+void FGPUSplashManager::ReleaseReadbackObjects()
+{
+	for (int32 i = 0; i < NUM_SPLASH_BUFFERS; ++i)
+	{
+		if (SplashReadbacks[i] != nullptr)
+		{
+			delete SplashReadbacks[i];
+			SplashReadbacks[i] = nullptr;
+		}
+		ReadbackFrameNumbers[i] = 0;
+	}
+}
+
+//=============================================================================
+// Passes
+//=============================================================================
+
+void FGPUSplashManager::AddSplashCompactionPasses(
+	FRDGBuilder& GraphBuilder,
+	FRDGBufferRef ParticleBuffer,
+	FRDGBufferRef ParticleCountBuffer)
+{
+	if (!bIsInitialized || !IsEnabled() || !ParticleBuffer || !ParticleCountBuffer)
+	{
+		return;
+	}
+
+	if (SplashReadbacks[0] == nullptr)
+	{
+		AllocateReadbackObjects();
+	}
+
+	FKawaiiFluidSplashSettings PassSettings;
+	{
+		FScopeLock Lock(&SplashLock);
+		PassSettings = Settings;
+	}
+
+	FRDGBufferRef SplashBuffer = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), BUFFER_SIZE / sizeof(uint32)),
+		TEXT("SplashCandidateBuffer"));
+	FRDGBufferUAVRef SplashUAV = GraphBuilder.CreateUAV(SplashBuffer);
+	AddClearUAVPass(GraphBuilder, SplashUAV, 0u);
+
+	FSplashCompactParameters Common;
+	Common.Particles = GraphBuilder.CreateUAV(ParticleBuffer);
+	Common.ParticleCountBuffer = GraphBuilder.CreateSRV(ParticleCountBuffer);
+	Common.SplashBuffer = SplashUAV;
+	Common.ConditionMode = static_cast<uint32>(PassSettings.ConditionMode);
+	Common.VelocityThreshold = PassSettings.VelocityThreshold;
+	Common.IsolationNeighborThreshold = static_cast<uint32>(FMath::Max(PassSettings.IsolationNeighborThreshold, 0));
+	Common.MaxCandidates = FKawaiiFluidSplashSelector::MaxCandidates;
+	Common.TargetCount = static_cast<float>(FMath::Max(PassSettings.Budget, 0) * FKawaiiFluidSplashSelector::Oversample);
+	Common.FrameIndex = FrameIndex++;
+
+	FGlobalShaderMap* GlobalShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+
+	// Pass 1: total candidate weight
+	{
+		TShaderMapRef<FSplashWeightCS> ComputeShader(GlobalShaderMap);
+		FSplashCompactParameters* PassParameters = GraphBuilder.AllocParameters<FSplashCompactParameters>();
+		*PassParameters = Common;
+
+		GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
+			RDG_EVENT_NAME("GPUFluid::SplashWeight(Indirect)"),
+			ComputeShader, PassParameters, ParticleCountBuffer,
+			GPUIndirectDispatch::IndirectArgsOffset_TG256);
+	}
+
+	// Pass 2: thin + append candidates, update isolation flags
+	{
+		TShaderMapRef<FSplashCompactCS> ComputeShader(GlobalShaderMap);
+		FSplashCompactParameters* PassParameters = GraphBuilder.AllocParameters<FSplashCompactParameters>();
+		*PassParameters = Common;
+
+		GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
+			RDG_EVENT_NAME("GPUFluid::SplashCompact(Indirect)"),
+			ComputeShader, PassParameters, ParticleCountBuffer,
+			GPUIndirectDispatch::IndirectArgsOffset_TG256);
+	}
+
+	// Readback only the header + candidate list
+	const int32 WriteIdx = ReadbackWriteIndex;
+	ReadbackWriteIndex = (ReadbackWriteIndex + 1) % NUM_SPLASH_BUFFERS;
+	ReadbackBudgets[WriteIdx] = PassSettings.Budget;
+
+	AddReadbackBufferPass(GraphBuilder,
+		RDG_EVENT_NAME("GPUFluid::SplashReadback"),
+		SplashBuffer,
+		[this, SplashBuffer, WriteIdx](FRHICommandListImmediate& InRHICmdList)
+		{
+			SplashReadbacks[WriteIdx]->EnqueueCopy(InRHICmdList, SplashBuffer->GetRHI(), BUFFER_SIZE);
+			ReadbackFrameNumbers[WriteIdx] = ++ReadbackFrameCounter;
+		});
+}
+
+//=============================================================================
+// Readback Processing
+//=============================================================================
+
+void FGPUSplashManager::ProcessReadback()
+{
+	if (SplashReadbacks[0] == nullptr)
+	{
+		return;
+	}
+
+	// Oldest finished readback first (each one is a separate frame of splashes)
+	int32 ReadIdx = -1;
+	for (int32 i = 0; i < NUM_SPLASH_BUFFERS; ++i)
+	{
+		if (ReadbackFrameNumbers[i] > 0 && SplashReadbacks[i]->IsReady() &&
+			(ReadIdx < 0 || ReadbackFrameNumbers[i] < ReadbackFrameNumbers[ReadIdx]))
+		{
+			ReadIdx = i;
+		}
+	}
+
+	if (ReadIdx < 0)
+	{
+		return;
+	}
+
+	const uint8* BufferData = static_cast<const uint8*>(SplashReadbacks[ReadIdx]->Lock(BUFFER_SIZE));
+	if (!BufferData)
+	{
+		SplashReadbacks[ReadIdx]->Unlock();
+		return;
+	}
+
+	const uint32* Header = reinterpret_cast<const uint32*>(BufferData);
+	const int32 Count = FMath::Min(static_cast<int32>(Header[0]), FKawaiiFluidSplashSelector::MaxCandidates);
+
+	TArray<FGPUSplashCandidate> Candidates;
+	Candidates.SetNumUninitialized(Count);
+	if (Count > 0)
+	{
+		FMemory::Memcpy(Candidates.GetData(), BufferData + HEADER_SIZE, Count * sizeof(FGPUSplashCandidate));
+	}
+
+	SplashReadbacks[ReadIdx]->Unlock();
+	ReadbackFrameNumbers[ReadIdx] = 0;
+
+	FKawaiiFluidSplashSelector::SelectTopCandidates(Candidates, ReadbackBudgets[ReadIdx]);
+
+	FScopeLock Lock(&SplashLock);
+	ReadyCandidates = MoveTemp(Candidates);
+	bHasReadyCandidates = true;
+}
+
+bool FGPUSplashManager::ConsumeCandidates(TArray<FGPUSplashCandidate>& OutCandidates)
+{
+	FScopeLock Lock(&SplashLock);
+	if (!bHasReadyCandidates)
+	{
+		return false;
+	}
+
+	OutCandidates = MoveTemp(ReadyCandidates);
+	ReadyCandidates.Reset();
+	bHasReadyCandidates = false;
+	return true;
+}
@@ -61,7 +61,9 @@ FRDGBufferRef FGPUZOrderSortManager::ExecuteZOrderSortingPipeline(
 	int32 AllocParticleCount,
 	FRDGBufferRef InAttachmentBuffer,
 	FRDGBufferRef* OutSortedAttachmentBuffer,
-	FRDGBufferRef IndirectArgsBuffer)
+	FRDGBufferRef IndirectArgsBuffer,
+	FRDGBufferRef InAnisotropyHistoryBuffer,
+	FRDGBufferRef* OutSortedAnisotropyHistoryBuffer)
 {
 	RDG_EVENT_SCOPE(GraphBuilder, "GPUFluid::ZOrderSorting");
 
@@ -149,9 +151,11 @@ FRDGBufferRef FGPUZOrderSortManager::ExecuteZOrderSortingPipeline(
 	//=========================================================================
 	// Step 4: Reorder particle data based on sorted indices
 	// Also reorder BoneDeltaAttachment buffer if provided (keeps indices synchronized)
+	// and the anisotropy history (keeps PrevIndex with its particle)
 	//=========================================================================
 	FRDGBufferRef SortedParticleBuffer;
 	FRDGBufferRef SortedAttachmentBuffer = nullptr;
+	FRDGBufferRef SortedAnisotropyHistoryBuffer = nullptr;
 	{
 		FRDGBufferDesc SortedDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(FGPUFluidParticle), AllocParticleCount);
 		SortedParticleBuffer = GraphBuilder.CreateBuffer(SortedDesc, TEXT("GPUFluid.SortedParticles"));
@@ -171,14 +175,32 @@ FRDGBufferRef FGPUZOrderSortManager::ExecuteZOrderSortingPipeline(
 			SortedAttachmentsUAV = GraphBuilder.CreateUAV(SortedAttachmentBuffer);
 		}
 
+		// Optional: Create sorted anisotropy history buffer if input is provided
+		FRDGBufferSRVRef OldAnisotropyHistorySRV = nullptr;
+		FRDGBufferUAVRef SortedAnisotropyHistoryUAV = nullptr;
+		if (InAnisotropyHistoryBuffer)
+		{
+			FRDGBufferDesc HistoryDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(FGPUAnisotropyHistory), AllocParticleCount);
+			SortedAnisotropyHistoryBuffer = GraphBuilder.CreateBuffer(HistoryDesc, TEXT("GPUFluid.SortedAnisotropyHistory"));
+			OldAnisotropyHistorySRV = GraphBuilder.CreateSRV(InAnisotropyHistoryBuffer);
+			SortedAnisotropyHistoryUAV = GraphBuilder.CreateUAV(SortedAnisotropyHistoryBuffer);
+		}
+
 		AddReorderParticlesPass(GraphBuilder, OldParticlesSRV, SortedIndicesSRV, SortedParticlesUAV, CurrentParticleCount,
-			OldAttachmentsSRV, SortedAttachmentsUAV, IndirectArgsBuffer);
+			OldAttachmentsSRV, SortedAttachmentsUAV, IndirectArgsBuffer,
+			OldAnisotropyHistorySRV, SortedAnisotropyHistoryUAV);
 
 		// Output sorted attachment buffer if requested
 		if (OutSortedAttachmentBuffer && SortedAttachmentBuffer)
 		{
 			*OutSortedAttachmentBuffer = SortedAttachmentBuffer;
 		}
+
+		// Output sorted anisotropy history buffer if requested
+		if (OutSortedAnisotropyHistoryBuffer && SortedAnisotropyHistoryBuffer)
+		{
+			*OutSortedAnisotropyHistoryBuffer = SortedAnisotropyHistoryBuffer;
+		}
 	}
 
 	//=========================================================================
@@ -431,7 +453,9 @@ void FGPUZOrderSortManager::AddReorderParticlesPass(
 	int32 CurrentParticleCount,
 	FRDGBufferSRVRef OldAttachmentsSRV,
 	FRDGBufferUAVRef SortedAttachmentsUAV,
-	FRDGBufferRef IndirectArgsBuffer)
+	FRDGBufferRef IndirectArgsBuffer,
+	FRDGBufferSRVRef OldAnisotropyHistorySRV,
+	FRDGBufferUAVRef SortedAnisotropyHistoryUAV)
 {
 	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
 	TShaderMapRef<FReorderParticlesCS> ComputeShader(ShaderMap);
@@ -453,6 +477,19 @@ void FGPUZOrderSortManager::AddReorderParticlesPass(
 		AttachmentsUAV = GraphBuilder.CreateUAV(DummyBuffer);
 	}
 
+	// Same for the anisotropy history
+	const bool bReorderAnisotropyHistory = (OldAnisotropyHistorySRV != nullptr && SortedAnisotropyHistoryUAV != nullptr);
+	FRDGBufferSRVRef HistorySRV = OldAnisotropyHistorySRV;
+	FRDGBufferUAVRef HistoryUAV = SortedAnisotropyHistoryUAV;
+	if (!bReorderAnisotropyHistory)
+	{
+		FRDGBufferDesc DummyDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(FGPUAnisotropyHistory), 1);
+		FRDGBufferRef DummyBuffer = GraphBuilder.CreateBuffer(DummyDesc, TEXT("GPUFluid.DummyAnisotropyHistory"));
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(DummyBuffer), 0);
+		HistorySRV = GraphBuilder.CreateSRV(DummyBuffer);
+		HistoryUAV = GraphBuilder.CreateUAV(DummyBuffer);
+	}
+
 	FReorderParticlesCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FReorderParticlesCS::FParameters>();
 	PassParameters->OldParticles = OldParticlesSRV;
 	PassParameters->SortedIndices = SortedIndicesSRV;
@@ -461,6 +498,9 @@ void FGPUZOrderSortManager::AddReorderParticlesPass(
 	PassParameters->OldBoneDeltaAttachments = AttachmentsSRV;
 	PassParameters->SortedBoneDeltaAttachments = AttachmentsUAV;
 	PassParameters->bReorderAttachments = bReorderAttachments ? 1 : 0;
+	PassParameters->OldAnisotropyHistory = HistorySRV;
+	PassParameters->SortedAnisotropyHistory = HistoryUAV;
+	PassParameters->bReorderAnisotropyHistory = bReorderAnisotropyHistory ? 1 : 0;
 	PassParameters->ParticleCount = CurrentParticleCount;
 	if (IndirectArgsBuffer) PassParameters->ParticleCountBuffer = GraphBuilder.CreateSRV(IndirectArgsBuffer);
 
@@ -468,8 +508,9 @@ void FGPUZOrderSortManager::AddReorderParticlesPass(
 	{
 		GPUIndirectDispatch::AddIndirectComputePass(
 			GraphBuilder,
-			RDG_EVENT_NAME("GPUFluid::ReorderParticles(%d)%s", CurrentParticleCount,
-				bReorderAttachments ? TEXT("+Attachments") : TEXT("")),
+			RDG_EVENT_NAME("GPUFluid::ReorderParticles(%d)%s%s", CurrentParticleCount,
+				bReorderAttachments ? TEXT("+Attachments") : TEXT(""),
+				bReorderAnisotropyHistory ? TEXT("+AnisotropyHistory") : TEXT("")),
 			ComputeShader,
 			PassParameters,
 			IndirectArgsBuffer,
@@ -480,8 +521,9 @@ void FGPUZOrderSortManager::AddReorderParticlesPass(
 		const int32 NumGroups = FMath::DivideAndRoundUp(CurrentParticleCount, FReorderParticlesCS::ThreadGroupSize);
 		FComputeShaderUtils::AddPass(
 			GraphBuilder,
-			RDG_EVENT_NAME("GPUFluid::ReorderParticles(%d)%s", CurrentParticleCount,
-				bReorderAttachments ? TEXT("+Attachments") : TEXT("")),
+			RDG_EVENT_NAME("GPUFluid::ReorderParticles(%d)%s%s", CurrentParticleCount,
+				bReorderAttachments ? TEXT("+Attachments") : TEXT(""),
+				bReorderAnisotropyHistory ? TEXT("+AnisotropyHistory") : TEXT("")),
 			ComputeShader,
 			PassParameters,
 			FIntVector(NumGroups, 1, 1)
@@ -4,11 +4,13 @@
 
 #include "KawaiiFluidSimulationContext.h"
 #include "Core/SpatialHash.h"
+#include "Core/KawaiiFluidFrameArena.h"
 #include "Collision/KawaiiFluidCollider.h"
 #include "Components/KawaiiFluidInteractionComponent.h"
 #include "Components/KawaiiFluidVolumeComponent.h"
 #include "Actors/KawaiiFluidVolume.h"
 #include "Data/KawaiiFluidPresetDataAsset.h"
+#include "Data/KawaiiFluidPackingAsset.h"
 #include "GPU/GPUFluidSimulator.h"
 #include "GPU/GPUFluidSimulatorShaders.h"  // For GPU_MORTON_GRID_AXIS_BITS
 #include "GPU/GPUFluidParticle.h"  // For FGPUSpawnRequest
@@ -490,6 +492,7 @@ FKawaiiFluidSimulationParams UKawaiiFluidSimulationModule::BuildSimulationParams
 	Params.World = GetWorld();
 	Params.IgnoreActor = GetOwnerActor();
 	Params.bUseWorldCollision = bUseWorldCollision;
+	Params.bUseWorldSDFCache = bUseWorldSDFCache;
 
 	// Get owner component for simulation origin and static boundary settings
 	if (UKawaiiFluidVolumeComponent* VolumeComp = GetTargetVolumeComponent())
@@ -605,8 +608,8 @@ FKawaiiFluidSimulationParams UKawaiiFluidSimulationModule::BuildSimulationParams
 
 	if (bEnableCollisionEvents)
 	{
-		// Connect map for cooldown tracking (const_cast needed - alternative to mutable)
-		Params.ParticleLastEventTimePtr = const_cast<TMap<int32, float>*>(&ParticleLastEventTime);
+		// Connect cooldown history (const_cast needed - alternative to mutable)
+		Params.ParticleLastEventTimePtr = &const_cast<FKawaiiFluidCollisionEventQueue&>(CollisionEventQueue).GetCooldownHistory();
 
 		// Current game time
 		if (UWorld* World = GetWorld())
@@ -631,14 +634,30 @@ void UKawaiiFluidSimulationModule::ProcessCollisionFeedback(
 	const TMap<int32, UKawaiiFluidInteractionComponent*>& OwnerIDToIC,
 	const TArray<FKawaiiFluidCollisionEvent>& CPUFeedbackBuffer)
 {
-	// Skip if no callback or collision events disabled
-	if (!OnCollisionEventCallback.IsBound() || !bEnableCollisionEvents)
+	// Skip if no listener or collision events disabled
+	if ((!OnCollisionEventCallback.IsBound() && !OnCollisionEventBatchCallback.IsBound()) || !bEnableCollisionEvents)
 	{
 		return;
 	}
 
-	const float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
-	int32 EventCount = 0;
+	CollisionEventQueue.Configure(MaxEventsPerFrame, EventCooldownPerParticle, MinVelocityForEvent, CachedSourceID);
+	CollisionEventQueue.BeginFrame(GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f);
+
+	auto ResolveInteractionComponent = [&OwnerIDToIC](FKawaiiFluidCollisionEvent& Event)
+	{
+		// IC lookup (O(1)) - CPU buffer may not have IC
+		if (!Event.HitInteractionComponent && Event.ColliderOwnerID >= 0)
+		{
+			if (UKawaiiFluidInteractionComponent* const* FoundIC = OwnerIDToIC.Find(Event.ColliderOwnerID))
+			{
+				Event.HitInteractionComponent = *FoundIC;
+				if (!Event.HitActor)
+				{
+					Event.HitActor = (*FoundIC)->GetOwner();
+				}
+			}
+		}
+	};
 
 	//========================================
 	// GPU feedback processing
@@ -646,114 +665,91 @@ void UKawaiiFluidSimulationModule::ProcessCollisionFeedback(
 	TSharedPtr<FGPUFluidSimulator> GPUSim = WeakGPUSimulator.Pin();
 	if (bGPUSimulationActive && GPUSim)
 	{
-		TArray<FGPUCollisionFeedback> GPUFeedbacks;
+		// Scratch buffer keeps its allocation across frames
 		int32 GPUFeedbackCount = 0;
-		GPUSim->GetAllCollisionFeedback(GPUFeedbacks, GPUFeedbackCount);
+		GPUSim->GetAllCollisionFeedback(GPUFeedbackScratch, GPUFeedbackCount);
+		GPUFeedbackCount = FMath::Min(GPUFeedbackCount, GPUFeedbackScratch.Num());
 
-		for (int32 i = 0; i < GPUFeedbackCount && EventCount < MaxEventsPerFrame; ++i)
+		for (int32 i = 0; i < GPUFeedbackCount && !CollisionEventQueue.IsFull(); ++i)
 		{
-			const FGPUCollisionFeedback& Feedback = GPUFeedbacks[i];
-
-			// SourceID filtering
-			if (CachedSourceID >= 0 && Feedback.ParticleSourceID != CachedSourceID)
-			{
-				continue;
-			}
+			const FGPUCollisionFeedback& Feedback = GPUFeedbackScratch[i];
 
-			// Velocity check
-			const float HitSpeed = FVector3f(Feedback.ParticleVelocity).Length();
-			if (HitSpeed < MinVelocityForEvent)
+			// Filter (SourceID, velocity) and cooldown by stable ParticleID
+			FKawaiiFluidCollisionEvent* Event = CollisionEventQueue.TryAdd(
+				Feedback.ParticleID, Feedback.ParticleSourceID, FVector3f(Feedback.ParticleVelocity).Length());
+			if (!Event)
 			{
 				continue;
 			}
 
-			// Cooldown check
-			if (const float* LastTime = ParticleLastEventTime.Find(Feedback.ParticleIndex))
-			{
-				if (CurrentTime - *LastTime < EventCooldownPerParticle)
-				{
-					continue;
-				}
-			}
-
-			// Update cooldown
-			ParticleLastEventTime.Add(Feedback.ParticleIndex, CurrentTime);
-
-			// Create event
-			FKawaiiFluidCollisionEvent Event;
-			Event.ParticleIndex = Feedback.ParticleIndex;
-			Event.SourceID = Feedback.ParticleSourceID;
-			Event.ColliderOwnerID = Feedback.ColliderOwnerID;
-			Event.BoneIndex = Feedback.BoneIndex;
-			Event.HitLocation = FVector(Feedback.ImpactNormal * (-Feedback.Penetration));
-			Event.HitNormal = FVector(Feedback.ImpactNormal);
-			Event.HitSpeed = HitSpeed;
-			Event.SourceModule = const_cast<UKawaiiFluidSimulationModule*>(this);
-
-			// IC lookup (O(1))
-			if (const UKawaiiFluidInteractionComponent* const* FoundIC = OwnerIDToIC.Find(Feedback.ColliderOwnerID))
-			{
-				Event.HitInteractionComponent = const_cast<UKawaiiFluidInteractionComponent*>(*FoundIC);
-				Event.HitActor = (*FoundIC)->GetOwner();
-			}
-
-			OnCollisionEventCallback.Execute(Event);
-			++EventCount;
+			Event->ColliderOwnerID = Feedback.ColliderOwnerID;
+			Event->BoneIndex = Feedback.BoneIndex;
+			Event->HitLocation = FVector(Feedback.ImpactNormal * (-Feedback.Penetration));
+			Event->HitNormal = FVector(Feedback.ImpactNormal);
+			Event->SourceModule = this;
+			ResolveInteractionComponent(*Event);
 		}
 	}
 
 	//========================================
 	// CPU feedback processing (filter by SourceID from Subsystem buffer)
 	//========================================
-	for (const FKawaiiFluidCollisionEvent& BufferEvent : CPUFeedbackBuffer)
+	for (int32 i = 0; i < CPUFeedbackBuffer.Num() && !CollisionEventQueue.IsFull(); ++i)
 	{
-		if (EventCount >= MaxEventsPerFrame)
-		{
-			break;
-		}
+		const FKawaiiFluidCollisionEvent& BufferEvent = CPUFeedbackBuffer[i];
 
-		// SourceID filtering - process only this Module's particles
-		if (CachedSourceID >= 0 && BufferEvent.SourceID != CachedSourceID)
+		FKawaiiFluidCollisionEvent* Event = CollisionEventQueue.TryAdd(
+			BufferEvent.ParticleID, BufferEvent.SourceID, BufferEvent.HitSpeed);
+		if (!Event)
 		{
 			continue;
 		}
 
-		// Cooldown check
-		if (const float* LastTime = ParticleLastEventTime.Find(BufferEvent.ParticleIndex))
-		{
-			if (CurrentTime - *LastTime < EventCooldownPerParticle)
-			{
-				continue;
-			}
-		}
+		*Event = BufferEvent;
+		Event->SourceModule = this;
+		ResolveInteractionComponent(*Event);
+	}
 
-		// Update cooldown
-		ParticleLastEventTime.Add(BufferEvent.ParticleIndex, CurrentTime);
+	//========================================
+	// Batched delivery
+	//========================================
+	const TConstArrayView<FKawaiiFluidCollisionEvent> Events = CollisionEventQueue.GetEvents();
+	if (Events.Num() == 0)
+	{
+		return;
+	}
 
-		// Copy event and set additional information
-		FKawaiiFluidCollisionEvent Event = BufferEvent;
-		Event.SourceModule = const_cast<UKawaiiFluidSimulationModule*>(this);
+	if (OnCollisionEventBatchCallback.IsBound())
+	{
+		OnCollisionEventBatchCallback.Execute(Events);
+	}
 
-		// IC lookup (O(1)) - CPU buffer may not have IC
-		if (!Event.HitInteractionComponent && Event.ColliderOwnerID >= 0)
+	if (OnCollisionEventCallback.IsBound())
+	{
+		for (const FKawaiiFluidCollisionEvent& Event : Events)
 		{
-			if (const UKawaiiFluidInteractionComponent* const* FoundIC = OwnerIDToIC.Find(Event.ColliderOwnerID))
-			{
-				Event.HitInteractionComponent = const_cast<UKawaiiFluidInteractionComponent*>(*FoundIC);
-				if (!Event.HitActor)
-				{
-					Event.HitActor = (*FoundIC)->GetOwner();
-				}
-			}
+			OnCollisionEventCallback.Execute(Event);
 		}
-
-		OnCollisionEventCallback.Execute(Event);
-		++EventCount;
 	}
 }
 
+int32 UKawaiiFluidSimulationModule::AddCPUParticle(const FVector& Position, const FVector& Velocity)
+{
+	FFluidParticle NewParticle(Position, NextCPUParticleID++);
+	NewParticle.Velocity = Velocity;
+	NewParticle.Mass = Preset ? Preset->ParticleMass : 1.0f;
+	NewParticle.SourceID = CachedSourceID;
+	Particles.Add(NewParticle);
+	return NewParticle.ParticleID;
+}
+
 int32 UKawaiiFluidSimulationModule::SpawnParticle(FVector Position, FVector Velocity)
 {
+	if (bCPUSimulationMode)
+	{
+		return AddCPUParticle(Position, Velocity);
+	}
+
 	TSharedPtr<FGPUFluidSimulator> GPUSim = WeakGPUSimulator.Pin();
 	if (!GPUSim)
 	{
@@ -770,9 +766,7 @@ int32 UKawaiiFluidSimulationModule::SpawnParticle(FVector Position, FVector Velo
 	Request.Radius = Radius;
 	Request.SourceID = CachedSourceID;
 
-	TArray<FGPUSpawnRequest> Requests;
-	Requests.Add(Request);
-	GPUSim->AddSpawnRequests(Requests);
+	GPUSim->AddSpawnRequests(MakeArrayView(&Request, 1));
 
 	return -1;  // GPU assigns ID asynchronously
 }
@@ -788,7 +782,7 @@ void UKawaiiFluidSimulationModule::SpawnParticles(FVector Location, int32 Count,
 	const float Mass = Preset ? Preset->ParticleMass : 1.0f;
 	const float Radius = Preset ? Preset->ParticleRadius : 5.0f;
 
-	TArray<FGPUSpawnRequest> SpawnRequests;
+	TKawaiiFluidFrameArray<FGPUSpawnRequest> SpawnRequests;
 	SpawnRequests.Reserve(Count);
 
 	for (int32 i = 0; i < Count; ++i)
@@ -841,7 +835,7 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesSphere(FVector Center, float R
 		const float Mass = Preset ? Preset->ParticleMass : 1.0f;
 		const float ParticleRadius = Preset ? Preset->ParticleRadius : 5.0f;
 
-		TArray<FGPUSpawnRequest> SpawnRequests;
+		TKawaiiFluidFrameArray<FGPUSpawnRequest> SpawnRequests;
 		SpawnRequests.Reserve(FMath::CeilToInt(EstimatedCount));
 
 		for (int32 x = -GridSize; x <= GridSize; ++x)
@@ -1250,6 +1244,29 @@ int32 UKawaiiFluidSimulationModule::SpawnParticlesCylinderHexagonal(FVector Cent
 	return SpawnedCount;
 }
 
+int32 UKawaiiFluidSimulationModule::SpawnParticlesFromPacking(const UKawaiiFluidPackingAsset* Packing, FVector Center,
+                                                               FVector Velocity, FRotator Rotation)
+{
+	if (!Packing || !Packing->IsBaked())
+	{
+		return 0;
+	}
+
+	const FQuat RotationQuat = Rotation.Quaternion();
+	const FVector WorldVelocity = RotationQuat.RotateVector(Velocity);
+
+	TArray<FVector> Positions;
+	Packing->GetPositions(FTransform(RotationQuat, Center), Positions);
+
+	Particles.Reserve(Particles.Num() + Positions.Num());
+	for (const FVector& WorldPos : Positions)
+	{
+		SpawnParticle(WorldPos, WorldVelocity);
+	}
+
+	return Positions.Num();
+}
+
 int32 UKawaiiFluidSimulationModule::SpawnParticleDirectional(FVector Position, FVector Direction, float Speed,
                                                              float Radius, float ConeAngle)
 {
@@ -1306,6 +1323,16 @@ int32 UKawaiiFluidSimulationModule::SpawnParticleDirectionalHexLayer(FVector Pos
 	TArray<FGPUSpawnRequest> BatchRequests;
 	int32 SpawnedCount = SpawnParticleDirectionalHexLayerBatch(Position, Direction, Speed, Radius, Spacing, Jitter, BatchRequests);
 
+	if (bCPUSimulationMode)
+	{
+		Particles.Reserve(Particles.Num() + BatchRequests.Num());
+		for (const FGPUSpawnRequest& Request : BatchRequests)
+		{
+			AddCPUParticle(FVector(Request.Position), FVector(Request.Velocity));
+		}
+		return SpawnedCount;
+	}
+
 	// Send batch requests
 	TSharedPtr<FGPUFluidSimulator> GPUSim = WeakGPUSimulator.Pin();
 	if (BatchRequests.Num() > 0 && GPUSim)
@@ -1448,6 +1475,181 @@ void UKawaiiFluidSimulationModule::DespawnBySourceGPU(int32 SourceID)
 	}
 }
 
+//========================================
+// ParticleID-addressed batch edits
+//========================================
+
+int32 UKawaiiFluidSimulationModule::AllocateParticleIDs(int32 Count)
+{
+	if (bCPUSimulationMode)
+	{
+		const int32 FirstID = NextCPUParticleID;
+		NextCPUParticleID += Count;
+		return FirstID;
+	}
+
+	TSharedPtr<FGPUFluidSimulator> GPUSim = WeakGPUSimulator.Pin();
+	return GPUSim ? GPUSim->AllocateParticleIDs(Count) : INDEX_NONE;
+}
+
+void UKawaiiFluidSimulationModule::SpawnParticleBlock(const FKawaiiFluidParticleBlock& Block)
+{
+	if (Block.IsEmpty())
+	{
+		return;
+	}
+
+	if (bCPUSimulationMode)
+	{
+		Particles.Reserve(Particles.Num() + Block.Num());
+		for (int32 i = 0; i < Block.Num(); ++i)
+		{
+			FFluidParticle NewParticle(FVector(Block.Positions[i]), Block.ParticleIDs[i]);
+			NewParticle.Velocity = FVector(Block.Velocities[i]);
+			NewParticle.Mass = Block.Mass;
+			NewParticle.SourceID = CachedSourceID;
+			Particles.Add(NewParticle);
+		}
+		NextCPUParticleID = FMath::Max(NextCPUParticleID, Block.GetMaxParticleID() + 1);
+		return;
+	}
+
+	TSharedPtr<FGPUFluidSimulator> GPUSim = WeakGPUSimulator.Pin();
+	if (!GPUSim)
+	{
+		return;
+	}
+
+	// Recorded IDs may predate an ID counter reset; keep new IDs clear of them
+	GPUSim->ReserveParticleIDsThrough(Block.GetMaxParticleID());
+
+	const float Radius = Preset ? Preset->ParticleRadius : 5.0f;
+
+	TKawaiiFluidFrameArray<FGPUSpawnRequest> Requests;
+	Requests.Reserve(Block.Num());
+	for (int32 i = 0; i < Block.Num(); ++i)
+	{
+		FGPUSpawnRequest& Request = Requests.Emplace_GetRef(Block.Positions[i], Block.Velocities[i], CachedSourceID, Block.Mass);
+		Request.Radius = Radius;
+		Request.ParticleID = Block.ParticleIDs[i];
+	}
+	GPUSim->AddSpawnRequests(Requests);
+}
+
+void UKawaiiFluidSimulationModule::DespawnParticlesByID(TConstArrayView<int32> ParticleIDs)
+{
+	if (ParticleIDs.Num() == 0)
+	{
+		return;
+	}
+
+	if (bCPUSimulationMode)
+	{
+		const TSet<int32> IDSet(ParticleIDs);
+		Particles.RemoveAll([&IDSet](const FFluidParticle& Particle)
+		{
+			return IDSet.Contains(Particle.ParticleID);
+		});
+		return;
+	}
+
+	TSharedPtr<FGPUFluidSimulator> GPUSim = WeakGPUSimulator.Pin();
+	if (GPUSim)
+	{
+		GPUSim->AddGPUDespawnIDRequests(ParticleIDs);
+	}
+}
+
+bool UKawaiiFluidSimulationModule::CollectParticlesInSphere(const FVector& Center, float Radius, FKawaiiFluidParticleBlock& OutBlock) const
+{
+	OutBlock.Reset();
+	OutBlock.Mass = Preset ? Preset->ParticleMass : 1.0f;
+	const float RadiusSq = Radius * Radius;
+
+	if (bCPUSimulationMode)
+	{
+		for (const FFluidParticle& Particle : Particles)
+		{
+			if (FVector::DistSquared(Particle.Position, Center) <= RadiusSq)
+			{
+				OutBlock.Add(Particle.ParticleID, FVector3f(Particle.Position), FVector3f(Particle.Velocity));
+			}
+		}
+		return true;
+	}
+
+	TSharedPtr<FGPUFluidSimulator> GPUSim = WeakGPUSimulator.Pin();
+	if (!GPUSim)
+	{
+		return false;
+	}
+
+	// Latest async readback (no GPU sync); particles spawned since then are not seen.
+	// Positions, IDs and velocities come from one copy so they always belong to the same readback.
+	TArray<FVector3f> Positions;
+	TArray<int32> ParticleIDs;
+	TArray<int32> SourceIDs;
+	TArray<FVector3f> Velocities;
+	if (!GPUSim->GetParticlePositionsAndIDs(Positions, ParticleIDs, SourceIDs, &Velocities) || ParticleIDs.Num() != Positions.Num())
+	{
+		return false;
+	}
+	const bool bHasVelocities = Velocities.Num() == Positions.Num();
+
+	const FVector3f Center3f(Center);
+	for (int32 i = 0; i < Positions.Num(); ++i)
+	{
+		if ((SourceIDs.IsValidIndex(i) && SourceIDs[i] != CachedSourceID) || FVector3f::DistSquared(Positions[i], Center3f) > RadiusSq)
+		{
+			continue;
+		}
+		OutBlock.Add(ParticleIDs[i], Positions[i], bHasVelocities ? Velocities[i] : FVector3f::ZeroVector);
+	}
+	return true;
+}
+
+bool UKawaiiFluidSimulationModule::CollectOccupiedPositionsInSphere(const FVector& Center, float Radius, TArray<FVector3f>& OutPositions) const
+{
+	OutPositions.Reset();
+	const float RadiusSq = Radius * Radius;
+
+	if (bCPUSimulationMode)
+	{
+		for (const FFluidParticle& Particle : Particles)
+		{
+			if (FVector::DistSquared(Particle.Position, Center) <= RadiusSq)
+			{
+				OutPositions.Add(FVector3f(Particle.Position));
+			}
+		}
+		return true;
+	}
+
+	TSharedPtr<FGPUFluidSimulator> GPUSim = WeakGPUSimulator.Pin();
+	if (!GPUSim)
+	{
+		return false;
+	}
+
+	// Latest async readback, all sources: emitter fluid occupies space as much as brushed fluid
+	TArray<FVector3f> Positions;
+	TArray<FVector3f> Velocities;
+	if (!GPUSim->GetParticlePositionsAndVelocities(Positions, Velocities))
+	{
+		return false;
+	}
+
+	const FVector3f Center3f(Center);
+	for (const FVector3f& Position : Positions)
+	{
+		if (FVector3f::DistSquared(Position, Center3f) <= RadiusSq)
+		{
+			OutPositions.Add(Position);
+		}
+	}
+	return true;
+}
+
 
 TArray<FVector> UKawaiiFluidSimulationModule::GetParticlePositions() const
 {
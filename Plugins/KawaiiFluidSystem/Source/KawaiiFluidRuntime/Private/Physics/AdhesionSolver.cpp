@@ -2,9 +2,24 @@
 
 #include "Physics/AdhesionSolver.h"
 #include "Physics/SPHKernels.h"
+#include "Physics/SPHKernelTable.h"
 #include "Collision/KawaiiFluidCollider.h"
 #include "Async/ParallelFor.h"
 #include "GameFramework/Actor.h"
+#include <atomic>
+
+namespace AdhesionConstants
+{
+	// Already attached particles (falling from above onto body): strict margin
+	constexpr float AttachMargin_Attached = 5.0f;
+	constexpr float MaintainMargin_Attached = 15.0f;   // Largest margin: colliders farther away never adhere
+	constexpr float MaintainMargin_NearGround = 5.0f;  // Reduced margin when near ground
+	// Previously unattached particles (newly attaching from floor to body): relaxed margin
+	constexpr float AttachMargin_New = 10.0f;
+
+	// Broadphase bounds padding against float rounding of the reported distances
+	constexpr float BroadphaseSlack = 1.0f;
+}
 
 FAdhesionSolver::FAdhesionSolver()
 {
@@ -26,16 +41,36 @@ void FAdhesionSolver::Apply(
 	// 		Colliders.Num(), AdhesionStrength, AdhesionRadius);
 	// }
 
+	PruneDestroyedOwners();
+
 	if (AdhesionStrength <= 0.0f || Colliders.Num() == 0)
 	{
 		return;
 	}
 
+	using namespace AdhesionConstants;
+
+	// Owner IDs once per collider (registers new owners, so serial)
+	ColliderOwnerIDs.SetNumUninitialized(Colliders.Num(), EAllowShrinking::No);
+	for (int32 c = 0; c < Colliders.Num(); ++c)
+	{
+		const UKawaiiFluidCollider* Collider = Colliders[c];
+		ColliderOwnerIDs[c] = (Collider && Collider->IsColliderEnabled()) ? FindOrAddOwnerID(Collider->GetOwner()) : INDEX_NONE;
+	}
+
+	// A collider farther than the largest margin never adheres, so it does not need to be queried
+	if (bUseColliderBroadphase)
+	{
+		Broadphase.Build(Colliders, MaintainMargin_Attached + FMath::Max(ColliderContactOffset, 0.0f) + BroadphaseSlack);
+	}
+
 	// Structure for storing results
 	struct FAdhesionResult
 	{
 		FVector Force;
 		AActor* ClosestActor;
+		int32 OwnerID;
+		int32 BoneID;              // INDEX_NONE with a valid BoneName = not registered yet
 		float ForceMagnitude;
 		FName BoneName;
 		FTransform BoneTransform;
@@ -45,21 +80,32 @@ void FAdhesionSolver::Apply(
 
 	TArray<FAdhesionResult> Results;
 	Results.SetNum(Particles.Num());
+	std::atomic<bool> bHasNewBones{false};
 
 	// Parallel computation (safe as read-only)
 	ParallelFor(Particles.Num(), [&](int32 i)
 	{
 		const FFluidParticle& Particle = Particles[i];
 		FVector TotalAdhesionForce = FVector::ZeroVector;
-		AActor* ClosestColliderActor = nullptr;
+		int32 ClosestCollider = INDEX_NONE;
 		float ClosestDistance = FLT_MAX;
 		FName ClosestBoneName = NAME_None;
 		FTransform ClosestBoneTransform = FTransform::Identity;
 		FVector ClosestSurfaceNormal = FVector::UpVector;
 		FVector ClosestSurfacePoint = FVector::ZeroVector;
 
-		for (UKawaiiFluidCollider* Collider : Colliders)
+		// Broadphase candidates keep the collider array order, so ties resolve as in the full scan
+		FKawaiiFluidColliderBroadphase::FCandidateList Candidates;
+		if (bUseColliderBroadphase)
 		{
+			Broadphase.Query(Particle.Position, Candidates);
+		}
+		const int32 NumCandidates = bUseColliderBroadphase ? Candidates.Num() : Colliders.Num();
+
+		for (int32 n = 0; n < NumCandidates; ++n)
+		{
+			const int32 ColliderIdx = bUseColliderBroadphase ? Candidates[n] : n;
+			const UKawaiiFluidCollider* Collider = Colliders[ColliderIdx];
 			if (!Collider || !Collider->IsColliderEnabled())
 			{
 				continue;
@@ -80,7 +126,7 @@ void FAdhesionSolver::Apply(
 				if (AdjustedDistance < ClosestDistance)
 				{
 					ClosestDistance = AdjustedDistance;
-					ClosestColliderActor = Collider->GetOwner();
+					ClosestCollider = ColliderIdx;
 					ClosestBoneName = BoneName;
 					ClosestBoneTransform = BoneTransform;
 					ClosestSurfaceNormal = Normal;
@@ -90,15 +136,9 @@ void FAdhesionSolver::Apply(
 		}
 
 		// Adhesion force calculation: apply different margins based on state
-		// Already attached particles (falling from above onto body): strict margin
-		const float AttachMargin_Attached = 5.0f;
-		const float MaintainMargin_Attached = 15.0f;
-		const float MaintainMargin_NearGround = 5.0f;  // Reduced margin when near ground
-		// Previously unattached particles (newly attaching from floor to body): relaxed margin
-		const float AttachMargin_New = 10.0f;
-
+		const int32 ClosestOwnerID = ClosestCollider != INDEX_NONE ? ColliderOwnerIDs[ClosestCollider] : INDEX_NONE;
 		bool bShouldApplyAdhesion = false;
-		bool bSameActor = (Particle.bIsAttached && Particle.AttachedActor.Get() == ClosestColliderActor);
+		bool bSameActor = (Particle.bIsAttached && Particle.AttachedOwnerID == ClosestOwnerID);
 
 		if (Particle.bIsAttached)
 		{
@@ -121,7 +161,13 @@ void FAdhesionSolver::Apply(
 			bShouldApplyAdhesion = (ClosestDistance <= AttachMargin_New);
 		}
 
-		if (bShouldApplyAdhesion && ClosestColliderActor)
+		// Outside adhesion range the collider information stays cleared
+		FAdhesionResult& Result = Results[i];
+		Result.ClosestActor = nullptr;
+		Result.OwnerID = INDEX_NONE;
+		Result.BoneID = INDEX_NONE;
+
+		if (bShouldApplyAdhesion && ClosestOwnerID != INDEX_NONE)
 		{
 			if (bSameActor && ClosestDistance > AttachMargin_Attached)
 			{
@@ -150,57 +196,188 @@ void FAdhesionSolver::Apply(
 
 				TotalAdhesionForce = AdhesionForce;
 			}
-		}
-		else
-		{
-			// Outside adhesion range - clear collider information
-			ClosestColliderActor = nullptr;
+
+			Result.ClosestActor = Colliders[ClosestCollider]->GetOwner();
+			Result.OwnerID = ClosestOwnerID;
+
+			// The bone table is only read here; names seen for the first time are registered below
+			if (const int32* BoneID = AttachmentBoneIDs.Find(ClosestBoneName))
+			{
+				Result.BoneID = *BoneID;
+			}
+			else
+			{
+				bHasNewBones.store(true, std::memory_order_relaxed);
+			}
 		}
 
-		Results[i].Force = TotalAdhesionForce;
-		Results[i].ClosestActor = ClosestColliderActor;
-		Results[i].ForceMagnitude = TotalAdhesionForce.Size();
-		Results[i].BoneName = ClosestBoneName;
-		Results[i].BoneTransform = ClosestBoneTransform;
-		Results[i].ParticlePosition = Particle.Position;
-		Results[i].SurfaceNormal = ClosestSurfaceNormal;
+		Result.Force = TotalAdhesionForce;
+		Result.ForceMagnitude = TotalAdhesionForce.Size();
+		Result.BoneName = ClosestBoneName;
+		Result.BoneTransform = ClosestBoneTransform;
+		Result.ParticlePosition = Particle.Position;
+		Result.SurfaceNormal = ClosestSurfaceNormal;
 	}, EParallelForFlags::Unbalanced);
 
-	// Sequential application (due to state changes)
-	for (int32 i = 0; i < Particles.Num(); ++i)
+	// Register new bone names (only in calls that meet a bone for the first time)
+	if (bHasNewBones.load(std::memory_order_relaxed))
 	{
-		Particles[i].Velocity += Results[i].Force;
+		for (FAdhesionResult& Result : Results)
+		{
+			if (Result.OwnerID != INDEX_NONE && Result.BoneID == INDEX_NONE)
+			{
+				Result.BoneID = FindOrAddBoneID(Result.BoneName);
+			}
+		}
+	}
+
+	// Parallel application (each particle only changes its own state)
+	ParallelFor(Particles.Num(), [&](int32 i)
+	{
+		const FAdhesionResult& Result = Results[i];
+		Particles[i].Velocity += Result.Force;
 		UpdateAttachmentState(
 			Particles[i],
-			Results[i].ClosestActor,
-			Results[i].ForceMagnitude,
+			Result.ClosestActor,
+			Result.OwnerID,
+			Result.BoneID,
+			Result.ForceMagnitude,
 			DetachThreshold,
-			Results[i].BoneName,
-			Results[i].BoneTransform,
-			Results[i].ParticlePosition,
-			Results[i].SurfaceNormal
+			Result.BoneName,
+			Result.BoneTransform,
+			Result.ParticlePosition,
+			Result.SurfaceNormal
 		);
 		// Reset detachment flag at frame end (allow reattachment next frame)
 		Particles[i].bJustDetached = false;
+	});
+}
+
+AActor* FAdhesionSolver::GetAttachmentOwner(int32 OwnerID) const
+{
+	return AttachmentOwners.IsValidIndex(OwnerID) ? AttachmentOwners[OwnerID].Get() : nullptr;
+}
+
+FName FAdhesionSolver::GetAttachmentBone(int32 BoneID) const
+{
+	return AttachmentBones.IsValidIndex(BoneID) ? AttachmentBones[BoneID] : NAME_None;
+}
+
+int32 FAdhesionSolver::FindOrAddOwnerID(AActor* Owner)
+{
+	if (!IsValid(Owner))
+	{
+		return INDEX_NONE;
+	}
+
+	const TWeakObjectPtr<AActor> Key(Owner);
+	if (const int32* OwnerID = AttachmentOwnerIDs.Find(Key))
+	{
+		return *OwnerID;
 	}
+
+	const int32 OwnerID = AttachmentOwners.Add(Key);
+	AttachmentOwnerIDs.Add(Key, OwnerID);
+	return OwnerID;
+}
+
+void FAdhesionSolver::PruneDestroyedOwners()
+{
+	for (auto It = AttachmentOwnerIDs.CreateIterator(); It; ++It)
+	{
+		if (It->Key.IsStale())
+		{
+			// The ID stays retired: particles may still carry it until they detach
+			AttachmentOwners[It->Value].Reset();
+			It.RemoveCurrent();
+		}
+	}
+}
+
+int32 FAdhesionSolver::FindOrAddBoneID(FName BoneName)
+{
+	if (const int32* BoneID = AttachmentBoneIDs.Find(BoneName))
+	{
+		return *BoneID;
+	}
+
+	const int32 BoneID = AttachmentBones.Add(BoneName);
+	AttachmentBoneIDs.Add(BoneName, BoneID);
+	return BoneID;
 }
 
 void FAdhesionSolver::ApplyCohesion(
 	TArray<FFluidParticle>& Particles,
 	float CohesionStrength,
-	float SmoothingRadius)
+	float SmoothingRadius,
+	const FSPHKernelTable* KernelTable,
+	const TArray<int32>* ParticleSubset)
 {
 	if (CohesionStrength <= 0.0f)
 	{
 		return;
 	}
 
+	// Forces are computed for the subset (all particles without one) and pull from every neighbor
+	const int32 NumTargets = ParticleSubset ? ParticleSubset->Num() : Particles.Num();
+	auto GetTarget = [ParticleSubset](int32 t) { return ParticleSubset ? (*ParticleSubset)[t] : t; };
+
 	TArray<FVector> CohesionForces;
-	CohesionForces.SetNum(Particles.Num());
+	CohesionForces.SetNum(NumTargets);
+
+	// Tabulated path: gather the neighbor offsets, evaluate the kernel 4 lanes at a time
+	if (KernelTable && KernelTable->IsValid() && FMath::IsNearlyEqual(KernelTable->GetRadius(), SmoothingRadius))
+	{
+		const float RadiusSq = SmoothingRadius * SmoothingRadius;
+
+		ParallelFor(NumTargets, [&](int32 t)
+		{
+			const int32 i = GetTarget(t);
+			const FFluidParticle& Particle = Particles[i];
+
+			TArray<FVector3f, TInlineAllocator<64>> Offsets;
+			TArray<float, TInlineAllocator<64>> DistSq;
+			for (int32 NeighborIdx : Particle.NeighborIndices)
+			{
+				if (NeighborIdx == i)
+				{
+					continue;
+				}
+
+				const FVector3f r = FVector3f(Particle.Position - Particles[NeighborIdx].Position);
+				const float r2 = r.SizeSquared();
+				if (r2 < KINDA_SMALL_NUMBER * KINDA_SMALL_NUMBER || r2 > RadiusSq)
+				{
+					continue;
+				}
+				Offsets.Add(r);
+				DistSq.Add(r2);
+			}
+
+			TArray<float, TInlineAllocator<64>> Weights;
+			Weights.SetNumUninitialized(DistSq.Num());
+			KernelTable->EvaluateBatch(ESPHKernelChannel::Cohesion, DistSq.GetData(), Weights.GetData(), DistSq.Num());
+
+			FVector3f CohesionForce = FVector3f::ZeroVector;
+			for (int32 n = 0; n < Offsets.Num(); ++n)
+			{
+				// Cohesion force: pull towards neighbors
+				CohesionForce -= Offsets[n] * (Weights[n] * FMath::InvSqrt(DistSq[n]));
+			}
+			CohesionForces[t] = FVector(CohesionForce) * CohesionStrength;
+		});
+
+		ParallelFor(NumTargets, [&](int32 t)
+		{
+			Particles[GetTarget(t)].Velocity += CohesionForces[t];
+		});
+		return;
+	}
 
 	// Parallel computation
-	ParallelFor(Particles.Num(), [&](int32 i)
+	ParallelFor(NumTargets, [&](int32 t)
 	{
+		const int32 i = GetTarget(t);
 		const FFluidParticle& Particle = Particles[i];
 		FVector CohesionForce = FVector::ZeroVector;
 
@@ -228,13 +405,13 @@ void FAdhesionSolver::ApplyCohesion(
 			CohesionForce += CohesionStrength * CohesionWeight * Direction;
 		}
 
-		CohesionForces[i] = CohesionForce;
+		CohesionForces[t] = CohesionForce;
 	});
 
 	// Parallel application
-	ParallelFor(Particles.Num(), [&](int32 i)
+	ParallelFor(NumTargets, [&](int32 t)
 	{
-		Particles[i].Velocity += CohesionForces[i];
+		Particles[GetTarget(t)].Velocity += CohesionForces[t];
 	});
 }
 
@@ -273,6 +450,8 @@ FVector FAdhesionSolver::ComputeAdhesionForce(
 void FAdhesionSolver::UpdateAttachmentState(
 	FFluidParticle& Particle,
 	AActor* ColliderActor,
+	int32 OwnerID,
+	int32 BoneID,
 	float Force,
 	float DetachThreshold,
 	FName BoneName,
@@ -291,7 +470,7 @@ void FAdhesionSolver::UpdateAttachmentState(
 	// 	}
 	// }
 
-	if (ColliderActor)
+	if (OwnerID != INDEX_NONE)
 	{
 		if (!Particle.bIsAttached)
 		{
@@ -299,15 +478,19 @@ void FAdhesionSolver::UpdateAttachmentState(
 			Particle.bIsAttached = true;
 			Particle.AttachedActor = TWeakObjectPtr<AActor>(ColliderActor);
 			Particle.AttachedBoneName = BoneName;
+			Particle.AttachedOwnerID = OwnerID;
+			Particle.AttachedBoneID = BoneID;
 			// Transform and store in bone local coordinates
 			Particle.AttachedLocalOffset = BoneTransform.InverseTransformPosition(ParticlePosition);
 			Particle.AttachedSurfaceNormal = SurfaceNormal;
 		}
-		else if (Particle.AttachedActor.Get() != ColliderActor || Particle.AttachedBoneName != BoneName)
+		else if (Particle.AttachedOwnerID != OwnerID || Particle.AttachedBoneID != BoneID)
 		{
 		// Moving to different object or different bone
 			Particle.AttachedActor = TWeakObjectPtr<AActor>(ColliderActor);
 			Particle.AttachedBoneName = BoneName;
+			Particle.AttachedOwnerID = OwnerID;
+			Particle.AttachedBoneID = BoneID;
 			Particle.AttachedLocalOffset = BoneTransform.InverseTransformPosition(ParticlePosition);
 			Particle.AttachedSurfaceNormal = SurfaceNormal;
 		}
@@ -323,11 +506,7 @@ void FAdhesionSolver::UpdateAttachmentState(
 		// Unconditionally release adhesion if not near collider
 		if (Particle.bIsAttached)
 		{
-			Particle.bIsAttached = false;
-			Particle.AttachedActor.Reset();
-			Particle.AttachedBoneName = NAME_None;
-			Particle.AttachedLocalOffset = FVector::ZeroVector;
-			Particle.AttachedSurfaceNormal = FVector::UpVector;
+			Particle.ClearAttachment();
 		}
 	}
 }
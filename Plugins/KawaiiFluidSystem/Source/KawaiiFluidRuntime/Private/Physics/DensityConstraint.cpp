@@ -4,6 +4,7 @@
 #include "Physics/SPHKernels.h"
 #include "Math/UnrealMathSSE.h"
 #include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
 
 //========================================
 // Constants
@@ -24,6 +25,85 @@ FORCEINLINE VectorRegister4Float VectorInvSqrtSafe(VectorRegister4Float V)
 	return VectorReciprocalSqrt(V);
 }
 
+//========================================
+// Kernel Variants
+//========================================
+static int32 GFluidCPUSpecializedKernels = 1;
+static FAutoConsoleVariableRef CVarFluidCPUSpecializedKernels(
+	TEXT("r.Fluid.CPUSpecializedKernels"),
+	GFluidCPUSpecializedKernels,
+	TEXT("CPU density solver uses kernels specialized per feature set (0 = generic runtime-branch kernel)"),
+	ECVF_Default);
+
+namespace
+{
+	/** Compile-time feature set of a kernel variant */
+	template<EDensityKernelVariant Variant>
+	struct TDensityKernelTraits
+	{
+		/** scorr code is compiled in (Generic keeps it behind a runtime branch) */
+		static constexpr bool bTensile = Variant != EDensityKernelVariant::Plain;
+
+		/** Fixed scorr exponent (0 = runtime TensileN) */
+		static constexpr int32 TensileExponent =
+			Variant == EDensityKernelVariant::TensilePow2 ? 2 :
+			Variant == EDensityKernelVariant::TensilePow4 ? 4 :
+			Variant == EDensityKernelVariant::TensilePow6 ? 6 : 0;
+	};
+
+	/** X^N, unrolled for a fixed exponent */
+	template<int32 Exponent>
+	FORCEINLINE VectorRegister4Float VectorPowInt(VectorRegister4Float X, int32 RuntimeN)
+	{
+		if constexpr (Exponent == 2)
+		{
+			return VectorMultiply(X, X);
+		}
+		else if constexpr (Exponent == 4)
+		{
+			const VectorRegister4Float X2 = VectorMultiply(X, X);
+			return VectorMultiply(X2, X2);
+		}
+		else if constexpr (Exponent == 6)
+		{
+			const VectorRegister4Float X2 = VectorMultiply(X, X);
+			return VectorMultiply(VectorMultiply(X2, X2), X2);
+		}
+		else
+		{
+			VectorRegister4Float Result = X;
+			for (int32 p = 1; p < RuntimeN; ++p)
+			{
+				Result = VectorMultiply(Result, X);
+			}
+			return Result;
+		}
+	}
+
+	template<int32 Exponent>
+	FORCEINLINE float PowInt(float X, int32 RuntimeN)
+	{
+		if constexpr (Exponent == 2)
+		{
+			return X * X;
+		}
+		else if constexpr (Exponent == 4)
+		{
+			const float X2 = X * X;
+			return X2 * X2;
+		}
+		else if constexpr (Exponent == 6)
+		{
+			const float X2 = X * X;
+			return X2 * X2 * X2;
+		}
+		else
+		{
+			return FMath::Pow(X, static_cast<float>(RuntimeN));
+		}
+	}
+}
+
 //========================================
 // Constructor
 //========================================
@@ -90,40 +170,7 @@ void FDensityConstraint::ApplyFromSoA(TArray<FFluidParticle>& Particles)
 //========================================
 void FDensityConstraint::Solve(TArray<FFluidParticle>& Particles, float InSmoothingRadius, float InRestDensity, float InCompliance, float DeltaTime)
 {
-	SmoothingRadius = InSmoothingRadius;
-	RestDensity = InRestDensity;
-
-	// XPBD: α̃ = α / dt²
-	const float DtSq = DeltaTime * DeltaTime;
-	Epsilon = InCompliance / FMath::Max(DtSq, 1e-8f);
-
-	const int32 NumParticles = Particles.Num();
-	if (NumParticles == 0) return;
-
-	// 1. Prepare SoA
-	ResizeSoAArrays(NumParticles);
-	CopyToSoA(Particles);
-
-	// 2. Compute kernel coefficients
-	const float h = SmoothingRadius * CM_TO_M;
-	const float h2 = h * h;
-	const float h6 = h2 * h2 * h2;
-	const float h9 = h6 * h2 * h;
-
-	FSPHKernelCoeffs Coeffs;
-	Coeffs.h = h;
-	Coeffs.h2 = h2;
-	Coeffs.Poly6Coeff = 315.0f / (64.0f * PI * h9);
-	Coeffs.SpikyCoeff = -45.0f / (PI * h6);
-	Coeffs.InvRestDensity = 1.0f / RestDensity;
-	Coeffs.SmoothingRadiusSq = SmoothingRadius * SmoothingRadius;
-
-	// 3. SIMD computation
-	ComputeDensityAndLambda_SIMD(Particles, Coeffs);
-	ComputeDeltaP_SIMD(Particles, Coeffs);
-
-	// 4. Apply results
-	ApplyFromSoA(Particles);
+	SolveInternal(Particles, InSmoothingRadius, InRestDensity, InCompliance, DeltaTime, FTensileInstabilityParams());
 }
 
 //========================================
@@ -136,6 +183,17 @@ void FDensityConstraint::SolveWithTensileCorrection(
 	float InCompliance,
 	float DeltaTime,
 	const FTensileInstabilityParams& TensileParams)
+{
+	SolveInternal(Particles, InSmoothingRadius, InRestDensity, InCompliance, DeltaTime, TensileParams);
+}
+
+void FDensityConstraint::SolveInternal(
+	TArray<FFluidParticle>& Particles,
+	float InSmoothingRadius,
+	float InRestDensity,
+	float InCompliance,
+	float DeltaTime,
+	const FTensileInstabilityParams& TensileParams)
 {
 	SmoothingRadius = InSmoothingRadius;
 	RestDensity = InRestDensity;
@@ -177,14 +235,35 @@ void FDensityConstraint::SolveWithTensileCorrection(
 		Coeffs.TensileParams.W_DeltaQ = Coeffs.Poly6Coeff * Diff * Diff * Diff;
 	}
 
-	// 4. SIMD computation
+	// 4. Pick the kernel variant once for the whole solve
+	LastKernelVariant = (bUseSpecializedKernels && GFluidCPUSpecializedKernels != 0)
+		? SelectKernelVariant(Coeffs.TensileParams)
+		: EDensityKernelVariant::Generic;
+
+	// 5. SIMD computation
 	ComputeDensityAndLambda_SIMD(Particles, Coeffs);
-	ComputeDeltaP_SIMD(Particles, Coeffs);
+	ComputeDeltaP(Particles, Coeffs, LastKernelVariant);
 
-	// 5. Apply results
+	// 6. Apply results
 	ApplyFromSoA(Particles);
 }
 
+EDensityKernelVariant FDensityConstraint::SelectKernelVariant(const FTensileInstabilityParams& TensileParams)
+{
+	if (!TensileParams.bEnabled || TensileParams.W_DeltaQ <= KINDA_SMALL_NUMBER)
+	{
+		return EDensityKernelVariant::Plain;
+	}
+
+	switch (TensileParams.N)
+	{
+	case 2: return EDensityKernelVariant::TensilePow2;
+	case 4: return EDensityKernelVariant::TensilePow4;
+	case 6: return EDensityKernelVariant::TensilePow6;
+	default: return EDensityKernelVariant::TensilePowN;
+	}
+}
+
 //========================================
 // Step 1: Density + Lambda (SIMD)
 //========================================
@@ -382,10 +461,29 @@ void FDensityConstraint::ComputeDensityAndLambda_SIMD(
 //========================================
 // Step 2: DeltaP (SIMD) - with Tensile Instability (scorr) Correction
 //========================================
+void FDensityConstraint::ComputeDeltaP(
+	const TArray<FFluidParticle>& Particles,
+	const FSPHKernelCoeffs& Coeffs,
+	EDensityKernelVariant Variant)
+{
+	switch (Variant)
+	{
+	case EDensityKernelVariant::Plain:       ComputeDeltaP_SIMD<EDensityKernelVariant::Plain>(Particles, Coeffs); break;
+	case EDensityKernelVariant::TensilePow2: ComputeDeltaP_SIMD<EDensityKernelVariant::TensilePow2>(Particles, Coeffs); break;
+	case EDensityKernelVariant::TensilePow4: ComputeDeltaP_SIMD<EDensityKernelVariant::TensilePow4>(Particles, Coeffs); break;
+	case EDensityKernelVariant::TensilePow6: ComputeDeltaP_SIMD<EDensityKernelVariant::TensilePow6>(Particles, Coeffs); break;
+	case EDensityKernelVariant::TensilePowN: ComputeDeltaP_SIMD<EDensityKernelVariant::TensilePowN>(Particles, Coeffs); break;
+	default:                                 ComputeDeltaP_SIMD<EDensityKernelVariant::Generic>(Particles, Coeffs); break;
+	}
+}
+
+template<EDensityKernelVariant Variant>
 void FDensityConstraint::ComputeDeltaP_SIMD(
 	const TArray<FFluidParticle>& Particles,
 	const FSPHKernelCoeffs& Coeffs)
 {
+	using FTraits = TDensityKernelTraits<Variant>;
+
 	const int32 NumParticles = Particles.Num();
 
 	const float* RESTRICT PosXPtr = PosX.GetData();
@@ -408,7 +506,10 @@ void FDensityConstraint::ComputeDeltaP_SIMD(
 	const VectorRegister4Float VecMinR2 = VectorSetFloat1(KINDA_SMALL_NUMBER);
 
 	// Tensile Instability parameters
-	const bool bUseTensileCorrection = Coeffs.TensileParams.bEnabled && Coeffs.TensileParams.W_DeltaQ > KINDA_SMALL_NUMBER;
+	// Specialized variants fix this at compile time; only Generic branches per neighbor
+	const bool bUseTensileCorrection = (Variant == EDensityKernelVariant::Generic)
+		? (Coeffs.TensileParams.bEnabled && Coeffs.TensileParams.W_DeltaQ > KINDA_SMALL_NUMBER)
+		: FTraits::bTensile;
 	const float TensileK = Coeffs.TensileParams.K;
 	const int32 TensileN = Coeffs.TensileParams.N;
 	const float InvW_DeltaQ = bUseTensileCorrection ? (1.0f / Coeffs.TensileParams.W_DeltaQ) : 0.0f;
@@ -484,29 +585,28 @@ void FDensityConstraint::ComputeDeltaP_SIMD(
 
 			// Add Tensile Instability correction (scorr)
 			// PBF Eq.13: scorr = -k * (W(r) / W(Δq))^n
-			if (bUseTensileCorrection)
+			if constexpr (FTraits::bTensile)
 			{
-				// W(r) = Poly6(r, h)
-				const VectorRegister4Float VecR2_m = VectorMultiply(VecR2, VecCmToMSq);
-				VectorRegister4Float VecDiff_Poly6 = VectorSubtract(VecH2, VecR2_m);
-				VecDiff_Poly6 = VectorMax(VecDiff_Poly6, VecZero);  // Ensure h² - r² >= 0
-				const VectorRegister4Float VecDiff3 = VectorMultiply(VecDiff_Poly6, VectorMultiply(VecDiff_Poly6, VecDiff_Poly6));
-				const VectorRegister4Float VecW_r = VectorMultiply(VecPoly6Coeff, VecDiff3);
-
-				// W(r) / W(Δq)
-				VectorRegister4Float VecRatio = VectorMultiply(VecW_r, VecInvW_DeltaQ);
-				VecRatio = VectorSelect(VecValidMask, VecRatio, VecZero);
-
-				// (W(r) / W(Δq))^n - integer exponentiation in SIMD
-				VectorRegister4Float VecRatioPowN = VecRatio;
-				for (int32 p = 1; p < TensileN; ++p)
+				if (bUseTensileCorrection)
 				{
-					VecRatioPowN = VectorMultiply(VecRatioPowN, VecRatio);
+					// W(r) = Poly6(r, h)
+					const VectorRegister4Float VecR2_m = VectorMultiply(VecR2, VecCmToMSq);
+					VectorRegister4Float VecDiff_Poly6 = VectorSubtract(VecH2, VecR2_m);
+					VecDiff_Poly6 = VectorMax(VecDiff_Poly6, VecZero);  // Ensure h² - r² >= 0
+					const VectorRegister4Float VecDiff3 = VectorMultiply(VecDiff_Poly6, VectorMultiply(VecDiff_Poly6, VecDiff_Poly6));
+					const VectorRegister4Float VecW_r = VectorMultiply(VecPoly6Coeff, VecDiff3);
+
+					// W(r) / W(Δq)
+					VectorRegister4Float VecRatio = VectorMultiply(VecW_r, VecInvW_DeltaQ);
+					VecRatio = VectorSelect(VecValidMask, VecRatio, VecZero);
+
+					// (W(r) / W(Δq))^n - integer exponentiation in SIMD (unrolled for fixed n)
+					const VectorRegister4Float VecRatioPowN = VectorPowInt<FTraits::TensileExponent>(VecRatio, TensileN);
+
+					// scorr = -k * ratio^n
+					const VectorRegister4Float VecScorr = VectorMultiply(VecNegK, VecRatioPowN);
+					VecLambdaSum = VectorAdd(VecLambdaSum, VecScorr);
 				}
-
-				// scorr = -k * ratio^n
-				const VectorRegister4Float VecScorr = VectorMultiply(VecNegK, VecRatioPowN);
-				VecLambdaSum = VectorAdd(VecLambdaSum, VecScorr);
 			}
 
 			VecDeltaX = VectorMultiplyAdd(VecLambdaSum, VecGradWX, VecDeltaX);
@@ -548,15 +648,18 @@ void FDensityConstraint::ComputeDeltaP_SIMD(
 				float LambdaSum = Lambda_i + LambdaPtr[NeighborIdx];
 
 				// Tensile Instability correction (scorr) - scalar path
-				if (bUseTensileCorrection)
+				if constexpr (FTraits::bTensile)
 				{
-					const float r2_m = r2_cm * CM_TO_M_SQ;
-					const float diff_poly6 = FMath::Max(0.0f, Coeffs.h2 - r2_m);
-					const float diff3 = diff_poly6 * diff_poly6 * diff_poly6;
-					const float W_r = Coeffs.Poly6Coeff * diff3;
-					const float ratio = W_r * InvW_DeltaQ;
-					const float scorr = -TensileK * FMath::Pow(ratio, static_cast<float>(TensileN));
-					LambdaSum += scorr;
+					if (bUseTensileCorrection)
+					{
+						const float r2_m = r2_cm * CM_TO_M_SQ;
+						const float diff_poly6 = FMath::Max(0.0f, Coeffs.h2 - r2_m);
+						const float diff3 = diff_poly6 * diff_poly6 * diff_poly6;
+						const float W_r = Coeffs.Poly6Coeff * diff3;
+						const float ratio = W_r * InvW_DeltaQ;
+						const float scorr = -TensileK * PowInt<FTraits::TensileExponent>(ratio, TensileN);
+						LambdaSum += scorr;
+					}
 				}
 
 				DeltaX += LambdaSum * coeff * dx;
@@ -0,0 +1,299 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Physics/SPHKernelTable.h"
+
+namespace
+{
+	constexpr float CM_TO_M = 0.01f;
+
+	/** Adhesion is supported on h/2 < r <= h, i.e. x > 1/4 */
+	constexpr float AdhesionMinX = 0.25f;
+
+	/** Probe points per interval when measuring the error */
+	constexpr int32 ProbesPerInterval = 4;
+
+	FORCEINLINE float CatmullRom(float P0, float P1, float P2, float P3, float F)
+	{
+		return P1 + 0.5f * F * ((P2 - P0) + F * ((2.0f * P0 - 5.0f * P1 + 4.0f * P2 - P3) + F * (3.0f * (P1 - P2) + P3 - P0)));
+	}
+
+	/** Final shape from the stored one (Adhesion stores the fourth power) */
+	FORCEINLINE float FinishShape(ESPHKernelChannel::Type Channel, float Shape)
+	{
+		return Channel == ESPHKernelChannel::Adhesion ? FMath::Sqrt(FMath::Sqrt(FMath::Max(Shape, 0.0f))) : Shape;
+	}
+}
+
+//========================================
+// Analytic Shapes
+//========================================
+
+float FSPHKernelTable::EvaluateShape(ESPHKernelChannel::Type Channel, float X)
+{
+	X = FMath::Max(X, 0.0f);
+	const float q = FMath::Sqrt(X);
+
+	switch (Channel)
+	{
+	case ESPHKernelChannel::Poly6:
+	{
+		// (h² - r²)³ / h⁶
+		const float Diff = 1.0f - X;
+		return Diff * Diff * Diff;
+	}
+	case ESPHKernelChannel::SpikyGradient:
+	{
+		// (h - r)² / h²
+		const float Diff = 1.0f - q;
+		return Diff * Diff;
+	}
+	case ESPHKernelChannel::ViscosityLaplacian:
+		// (h - r) / h
+		return 1.0f - q;
+	case ESPHKernelChannel::Adhesion:
+		// (-4r²/h + 6r - 2h) / h, fourth root taken after interpolation.
+		// Not clamped: the smooth extension below h/2 keeps cubic interpolation accurate at the edge
+		return -4.0f * X + 6.0f * q - 2.0f;
+	case ESPHKernelChannel::Cohesion:
+	{
+		// Akinci 2013: (h-r)³r³ / h⁶, or 2(h-r)³r³ / h⁶ - 1/64 for r <= h/2
+		const float Diff = 1.0f - q;
+		const float Value = Diff * Diff * Diff * X * q;
+		return q > 0.5f ? Value : 2.0f * Value - 1.0f / 64.0f;
+	}
+	default:
+		return 0.0f;
+	}
+}
+
+float FSPHKernelTable::ComputeScale(ESPHKernelChannel::Type Channel, float InRadius)
+{
+	const float h = InRadius * CM_TO_M;
+	const float h3 = h * h * h;
+
+	switch (Channel)
+	{
+	case ESPHKernelChannel::Poly6:              return 315.0f / (64.0f * PI * h3);
+	case ESPHKernelChannel::SpikyGradient:      return -45.0f / (PI * h3 * h) * CM_TO_M;
+	case ESPHKernelChannel::ViscosityLaplacian: return 45.0f / (PI * h3 * h * h);
+	case ESPHKernelChannel::Adhesion:           return 0.007f / h3;
+	case ESPHKernelChannel::Cohesion:           return 32.0f / (PI * h3);
+	default:                                    return 0.0f;
+	}
+}
+
+//========================================
+// Interpolation
+//========================================
+
+FORCEINLINE float FSPHKernelTable::InterpolateShape(ESPHKernelChannel::Type Channel, float X) const
+{
+	const float T = X * Resolution;
+	const int32 Index = FMath::Min(FMath::FloorToInt32(T), Resolution - 1);
+	const float F = T - Index;
+	const float* S = ShapeData.GetData() + Channel * GetChannelStride() + 1 + Index;
+
+	if (Settings.Interpolation == ESPHKernelInterpolation::Cubic)
+	{
+		return CatmullRom(S[-1], S[0], S[1], S[2], F);
+	}
+	return S[0] + F * (S[1] - S[0]);
+}
+
+//========================================
+// Build
+//========================================
+
+bool FSPHKernelTable::Build(float InRadius, const FSPHKernelTableSettings& InSettings)
+{
+	Reset();
+	if (InRadius <= 0.0f)
+	{
+		return false;
+	}
+
+	Settings = InSettings;
+	Radius = InRadius;
+	InvRadiusSq = 1.0f / (InRadius * InRadius);
+	for (int32 Channel = 0; Channel < ESPHKernelChannel::Count; ++Channel)
+	{
+		Scales[Channel] = ComputeScale(static_cast<ESPHKernelChannel::Type>(Channel), InRadius);
+	}
+
+	const int32 MaxResolution = FMath::RoundUpToPowerOfTwo(FMath::Max(Settings.MaxResolution, 4));
+	int32 TryResolution = FMath::Min<int32>(FMath::RoundUpToPowerOfTwo(FMath::Max(Settings.MinResolution, 4)), MaxResolution);
+
+	while (true)
+	{
+		Sample(TryResolution);
+
+		bool bWithinBound = true;
+		for (int32 Channel = 0; Channel < ESPHKernelChannel::Count; ++Channel)
+		{
+			MaxErrors[Channel] = MeasureError(static_cast<ESPHKernelChannel::Type>(Channel));
+			bWithinBound &= MaxErrors[Channel] <= Settings.MaxRelativeError;
+		}
+
+		if (bWithinBound)
+		{
+			return true;
+		}
+		if (TryResolution >= MaxResolution)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SPHKernelTable: error bound %g not met at resolution %d (h = %.2f cm)"),
+				Settings.MaxRelativeError, Resolution, Radius);
+			return false;
+		}
+		TryResolution *= 2;
+	}
+}
+
+void FSPHKernelTable::Sample(int32 InResolution)
+{
+	Resolution = InResolution;
+	const int32 Stride = GetChannelStride();
+	ShapeData.SetNumUninitialized(Stride * ESPHKernelChannel::Count);
+
+	const float InvResolution = 1.0f / Resolution;
+	for (int32 Channel = 0; Channel < ESPHKernelChannel::Count; ++Channel)
+	{
+		float* Samples = ShapeData.GetData() + Channel * Stride + 1;
+		for (int32 k = 0; k <= Resolution; ++k)
+		{
+			Samples[k] = EvaluateShape(static_cast<ESPHKernelChannel::Type>(Channel), k * InvResolution);
+		}
+
+		// Padding for cubic interpolation: linear extrapolation
+		Samples[-1] = 2.0f * Samples[0] - Samples[1];
+		Samples[Resolution + 1] = 2.0f * Samples[Resolution] - Samples[Resolution - 1];
+	}
+}
+
+float FSPHKernelTable::MeasureError(ESPHKernelChannel::Type Channel) const
+{
+	const float* Samples = ShapeData.GetData() + Channel * GetChannelStride() + 1;
+
+	float Peak = 0.0f;
+	for (int32 k = 0; k <= Resolution; ++k)
+	{
+		Peak = FMath::Max(Peak, FMath::Abs(FinishShape(Channel, Samples[k])));
+	}
+	if (Peak <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	const float MinX = FMath::Square(Settings.MinRadiusRatio);
+	float MaxError = 0.0f;
+	for (int32 k = 0; k < Resolution; ++k)
+	{
+		for (int32 p = 1; p < ProbesPerInterval; ++p)
+		{
+			const float X = (k + static_cast<float>(p) / ProbesPerInterval) / Resolution;
+			if (X < MinX || (Channel == ESPHKernelChannel::Adhesion && X <= AdhesionMinX))
+			{
+				continue;
+			}
+
+			const float Table = FinishShape(Channel, InterpolateShape(Channel, X));
+			const float Exact = FinishShape(Channel, EvaluateShape(Channel, X));
+			MaxError = FMath::Max(MaxError, FMath::Abs(Table - Exact));
+		}
+	}
+	return MaxError / Peak;
+}
+
+void FSPHKernelTable::Reset()
+{
+	Radius = 0.0f;
+	InvRadiusSq = 0.0f;
+	Resolution = 0;
+	FMemory::Memzero(Scales);
+	FMemory::Memzero(MaxErrors);
+	ShapeData.Reset();
+}
+
+//========================================
+// Lookup
+//========================================
+
+float FSPHKernelTable::Evaluate(ESPHKernelChannel::Type Channel, float R2) const
+{
+	const float X = R2 * InvRadiusSq;
+	if (X < 0.0f || X >= 1.0f || (Channel == ESPHKernelChannel::Adhesion && X <= AdhesionMinX))
+	{
+		return 0.0f;
+	}
+	return Scales[Channel] * FinishShape(Channel, InterpolateShape(Channel, X));
+}
+
+VectorRegister4Float FSPHKernelTable::Evaluate4(ESPHKernelChannel::Type Channel, VectorRegister4Float R2) const
+{
+	const VectorRegister4Float VecZero = VectorZeroFloat();
+	const VectorRegister4Float VecOne = VectorOneFloat();
+
+	const VectorRegister4Float X = VectorMultiply(R2, VectorSetFloat1(InvRadiusSq));
+	VectorRegister4Float InRange = VectorBitwiseAnd(VectorCompareGE(X, VecZero), VectorCompareLT(X, VecOne));
+	if (Channel == ESPHKernelChannel::Adhesion)
+	{
+		InRange = VectorBitwiseAnd(InRange, VectorCompareGT(X, VectorSetFloat1(AdhesionMinX)));
+	}
+
+	// Index and fraction (out-of-range lanes are clamped, then masked)
+	const VectorRegister4Float T = VectorMultiply(VectorMax(X, VecZero), VectorSetFloat1(static_cast<float>(Resolution)));
+	const VectorRegister4Float Floor = VectorMin(VectorFloor(T), VectorSetFloat1(static_cast<float>(Resolution - 1)));
+	const VectorRegister4Float F = VectorSubtract(T, Floor);
+
+	alignas(16) float IndexFloats[4];
+	VectorStoreAligned(Floor, IndexFloats);
+	const float* S = ShapeData.GetData() + Channel * GetChannelStride() + 1;
+	const int32 I0 = static_cast<int32>(IndexFloats[0]);
+	const int32 I1 = static_cast<int32>(IndexFloats[1]);
+	const int32 I2 = static_cast<int32>(IndexFloats[2]);
+	const int32 I3 = static_cast<int32>(IndexFloats[3]);
+
+	const VectorRegister4Float P1 = MakeVectorRegisterFloat(S[I0], S[I1], S[I2], S[I3]);
+	const VectorRegister4Float P2 = MakeVectorRegisterFloat(S[I0 + 1], S[I1 + 1], S[I2 + 1], S[I3 + 1]);
+
+	VectorRegister4Float Shape;
+	if (Settings.Interpolation == ESPHKernelInterpolation::Cubic)
+	{
+		const VectorRegister4Float P0 = MakeVectorRegisterFloat(S[I0 - 1], S[I1 - 1], S[I2 - 1], S[I3 - 1]);
+		const VectorRegister4Float P3 = MakeVectorRegisterFloat(S[I0 + 2], S[I1 + 2], S[I2 + 2], S[I3 + 2]);
+
+		// P1 + 0.5 F (A + F (B + F C))
+		const VectorRegister4Float A = VectorSubtract(P2, P0);
+		const VectorRegister4Float B = VectorSubtract(
+			VectorAdd(VectorMultiply(VectorSetFloat1(2.0f), P0), VectorMultiply(VectorSetFloat1(4.0f), P2)),
+			VectorAdd(VectorMultiply(VectorSetFloat1(5.0f), P1), P3));
+		const VectorRegister4Float C = VectorSubtract(
+			VectorAdd(VectorMultiply(VectorSetFloat1(3.0f), VectorSubtract(P1, P2)), P3), P0);
+		VectorRegister4Float Poly = VectorMultiplyAdd(F, C, B);
+		Poly = VectorMultiplyAdd(F, Poly, A);
+		Shape = VectorMultiplyAdd(VectorMultiply(VectorSetFloat1(0.5f), F), Poly, P1);
+	}
+	else
+	{
+		Shape = VectorMultiplyAdd(F, VectorSubtract(P2, P1), P1);
+	}
+
+	if (Channel == ESPHKernelChannel::Adhesion)
+	{
+		Shape = VectorSqrt(VectorSqrt(VectorMax(Shape, VecZero)));
+	}
+
+	return VectorSelect(InRange, VectorMultiply(Shape, VectorSetFloat1(Scales[Channel])), VecZero);
+}
+
+void FSPHKernelTable::EvaluateBatch(ESPHKernelChannel::Type Channel, const float* R2, float* OutValues, int32 Count) const
+{
+	int32 i = 0;
+	for (; i + 4 <= Count; i += 4)
+	{
+		VectorStore(Evaluate4(Channel, VectorLoad(R2 + i)), OutValues + i);
+	}
+	for (; i < Count; ++i)
+	{
+		OutValues[i] = Evaluate(Channel, R2[i]);
+	}
+}
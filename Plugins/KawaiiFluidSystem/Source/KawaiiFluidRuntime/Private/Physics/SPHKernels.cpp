@@ -150,7 +150,7 @@ namespace SPHKernels
 			float diff1 = h_m - r_m;
 			float diff2 = diff1 * diff1 * diff1;
 			float r3 = r_m * r_m * r_m;
-			return coeff * 2.0f * diff2 * r3 - (FMath::Pow(h_m, 6.0f) / 64.0f);
+			return coeff * (2.0f * diff2 * r3 - FMath::Pow(h_m, 6.0f) / 64.0f);
 		}
 		else
 		{
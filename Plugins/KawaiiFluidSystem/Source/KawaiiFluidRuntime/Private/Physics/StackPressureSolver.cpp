@@ -80,7 +80,7 @@ void FStackPressureSolver::Apply(
 
 			// Optional: Only consider neighbors attached to same actor
 			// This prevents weight transfer between different surfaces
-			if (Neighbor.AttachedActor != Particle.AttachedActor)
+			if (Neighbor.AttachedOwnerID != Particle.AttachedOwnerID)
 			{
 				continue;
 			}
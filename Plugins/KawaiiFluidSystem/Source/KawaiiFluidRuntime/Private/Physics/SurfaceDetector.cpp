@@ -0,0 +1,222 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Physics/SurfaceDetector.h"
+#include "Core/KawaiiFluidCompactParticles.h"
+#include "Math/UnrealMathSSE.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** Stand-in offset for the particle itself in a gathered lane (always out of range) */
+	constexpr float SelfLaneOffset = 1.0e18f;
+
+	/**
+	 * Classification over the neighbor lists
+	 * @param Offset (i, j) -> FVector3f Pi - Pj
+	 * @param WasSurface i -> last frame's bIsSurfaceParticle
+	 */
+	template <typename FOffsetFn, typename FWasSurfaceFn>
+	void ClassifyParticles(TArray<FFluidParticle>& Particles, const FSurfaceDetectorSettings& Settings, uint8* RESTRICT MaskPtr,
+		const FOffsetFn& Offset, const FWasSurfaceFn& WasSurface)
+	{
+		const int32 NumParticles = Particles.Num();
+		const float h = Settings.SmoothingRadius;
+		const float h2 = h * h;
+		const float EnterThreshold = Settings.GradientThreshold;
+		const float ExitThreshold = Settings.GradientThreshold * Settings.ExitRatio;
+		const int32 EnterCount = Settings.NeighborThreshold;
+		const int32 ExitCount = Settings.ExitRatio > 0.0f
+			? FMath::CeilToInt(static_cast<float>(Settings.NeighborThreshold) / Settings.ExitRatio)
+			: Settings.NeighborThreshold;
+
+		const VectorRegister4Float VecH = VectorSetFloat1(h);
+		const VectorRegister4Float VecH2 = VectorSetFloat1(h2);
+		const VectorRegister4Float VecMinR2 = VectorSetFloat1(KINDA_SMALL_NUMBER);
+		const VectorRegister4Float VecZero = VectorZeroFloat();
+		const VectorRegister4Float VecOne = VectorOneFloat();
+
+		ParallelFor(NumParticles, [&](int32 i)
+		{
+			FFluidParticle& Particle = Particles[i];
+			const TArray<int32>& Neighbors = Particle.NeighborIndices;
+			const int32 NumNeighbors = Neighbors.Num();
+			const int32* NeighborData = Neighbors.GetData();
+
+			VectorRegister4Float VecCount = VecZero;
+			VectorRegister4Float VecSumW = VecZero;
+			VectorRegister4Float VecGradX = VecZero;
+			VectorRegister4Float VecGradY = VecZero;
+			VectorRegister4Float VecGradZ = VecZero;
+
+			// Process 4 at a time with SIMD
+			alignas(16) float LaneX[4], LaneY[4], LaneZ[4];
+			int32 n = 0;
+			for (; n + 4 <= NumNeighbors; n += 4)
+			{
+				// Gather r = Pi - Pj (points away from the neighbor; the particle itself is moved
+				// out of range so it is neither counted nor weighted)
+				for (int32 Lane = 0; Lane < 4; ++Lane)
+				{
+					const int32 j = NeighborData[n + Lane];
+					const FVector3f R = j == i ? FVector3f(SelfLaneOffset, 0.0f, 0.0f) : Offset(i, j);
+					LaneX[Lane] = R.X;
+					LaneY[Lane] = R.Y;
+					LaneZ[Lane] = R.Z;
+				}
+				const VectorRegister4Float VecDX = VectorLoadAligned(LaneX);
+				const VectorRegister4Float VecDY = VectorLoadAligned(LaneY);
+				const VectorRegister4Float VecDZ = VectorLoadAligned(LaneZ);
+
+				VectorRegister4Float VecR2 = VectorMultiply(VecDX, VecDX);
+				VecR2 = VectorMultiplyAdd(VecDY, VecDY, VecR2);
+				VecR2 = VectorMultiplyAdd(VecDZ, VecDZ, VecR2);
+
+				const VectorRegister4Float VecInRange = VectorCompareLT(VecR2, VecH2);
+				VecCount = VectorAdd(VecCount, VectorSelect(VecInRange, VecOne, VecZero));
+
+				// Spiky-shaped weight (h - r)², direction r̂ (coincident neighbors have none)
+				const VectorRegister4Float VecValid = VectorBitwiseAnd(VecInRange, VectorCompareGT(VecR2, VecMinR2));
+				const VectorRegister4Float VecInvR = VectorReciprocalSqrt(VectorMax(VecR2, VecMinR2));
+				const VectorRegister4Float VecDiff = VectorSubtract(VecH, VectorMultiply(VecR2, VecInvR));
+				const VectorRegister4Float VecW = VectorSelect(VecValid, VectorMultiply(VecDiff, VecDiff), VecZero);
+				const VectorRegister4Float VecWInvR = VectorMultiply(VecW, VecInvR);
+
+				VecSumW = VectorAdd(VecSumW, VecW);
+				VecGradX = VectorMultiplyAdd(VecWInvR, VecDX, VecGradX);
+				VecGradY = VectorMultiplyAdd(VecWInvR, VecDY, VecGradY);
+				VecGradZ = VectorMultiplyAdd(VecWInvR, VecDZ, VecGradZ);
+			}
+
+			// Reduce SIMD results
+			alignas(16) float Temp[4];
+			VectorStoreAligned(VecCount, Temp);
+			int32 Count = FMath::RoundToInt(Temp[0] + Temp[1] + Temp[2] + Temp[3]);
+			VectorStoreAligned(VecSumW, Temp);
+			float SumW = Temp[0] + Temp[1] + Temp[2] + Temp[3];
+			VectorStoreAligned(VecGradX, Temp);
+			float GradX = Temp[0] + Temp[1] + Temp[2] + Temp[3];
+			VectorStoreAligned(VecGradY, Temp);
+			float GradY = Temp[0] + Temp[1] + Temp[2] + Temp[3];
+			VectorStoreAligned(VecGradZ, Temp);
+			float GradZ = Temp[0] + Temp[1] + Temp[2] + Temp[3];
+
+			// Process remaining scalar elements
+			for (; n < NumNeighbors; ++n)
+			{
+				const int32 NeighborIdx = NeighborData[n];
+				if (NeighborIdx == i)
+				{
+					continue;
+				}
+
+				const FVector3f R = Offset(i, NeighborIdx);
+				const float r2 = R.X * R.X + R.Y * R.Y + R.Z * R.Z;
+				if (!(r2 < h2))
+				{
+					continue;
+				}
+
+				++Count;
+				if (r2 > KINDA_SMALL_NUMBER)
+				{
+					const float InvR = FMath::InvSqrt(r2);
+					const float Diff = h - r2 * InvR;
+					const float W = Diff * Diff;
+					SumW += W;
+					GradX += W * InvR * R.X;
+					GradY += W * InvR * R.Y;
+					GradZ += W * InvR * R.Z;
+				}
+			}
+
+			// Normalized color-field gradient: 0 inside, 1 when one-sided
+			const float GradLength = FMath::Sqrt(GradX * GradX + GradY * GradY + GradZ * GradZ);
+			const float Gradient = SumW > 0.0f ? GradLength / SumW : 1.0f;
+
+			const bool bWasSurface = Settings.bTemporalCoherence && WasSurface(i);
+			const bool bSurface = Gradient >= (bWasSurface ? ExitThreshold : EnterThreshold)
+				|| Count < (bWasSurface ? ExitCount : EnterCount);
+
+			MaskPtr[i] = bSurface ? 1 : 0;
+			Particle.bIsSurfaceParticle = bSurface;
+			Particle.SurfaceNormal = (bSurface && GradLength > KINDA_SMALL_NUMBER)
+				? FVector(GradX, GradY, GradZ) / GradLength
+				: FVector::ZeroVector;
+		}, EParallelForFlags::Unbalanced);
+	}
+}
+
+FSurfaceDetector::FSurfaceDetector()
+{
+}
+
+int32 FSurfaceDetector::Classify(TArray<FFluidParticle>& Particles, const FSurfaceDetectorSettings& Settings)
+{
+	const int32 NumParticles = Particles.Num();
+	SurfaceIndices.Reset();
+	if (NumParticles == 0 || Settings.SmoothingRadius <= 0.0f)
+	{
+		return 0;
+	}
+
+	// Positions relative to the first particle keep float precision far from the world origin
+	const FVector Origin = Particles[0].Position;
+	PosX.SetNumUninitialized(NumParticles);
+	PosY.SetNumUninitialized(NumParticles);
+	PosZ.SetNumUninitialized(NumParticles);
+	SurfaceMask.SetNumUninitialized(NumParticles);
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		const FVector Position = Particles[i].Position - Origin;
+		PosX[i] = static_cast<float>(Position.X);
+		PosY[i] = static_cast<float>(Position.Y);
+		PosZ[i] = static_cast<float>(Position.Z);
+	}
+
+	const float* RESTRICT PosXPtr = PosX.GetData();
+	const float* RESTRICT PosYPtr = PosY.GetData();
+	const float* RESTRICT PosZPtr = PosZ.GetData();
+	ClassifyParticles(Particles, Settings, SurfaceMask.GetData(),
+		[PosXPtr, PosYPtr, PosZPtr](int32 i, int32 j)
+		{
+			return FVector3f(PosXPtr[i] - PosXPtr[j], PosYPtr[i] - PosYPtr[j], PosZPtr[i] - PosZPtr[j]);
+		},
+		[&Particles](int32 i) { return Particles[i].bIsSurfaceParticle; });
+
+	return CollectSurfaceIndices(NumParticles);
+}
+
+int32 FSurfaceDetector::Classify(TArray<FFluidParticle>& Particles, const FKawaiiFluidCompactParticles& Compact, const FSurfaceDetectorSettings& Settings)
+{
+	const int32 NumParticles = Particles.Num();
+	if (!Compact.IsValidFor(NumParticles))
+	{
+		return Classify(Particles, Settings);
+	}
+
+	SurfaceIndices.Reset();
+	if (Settings.SmoothingRadius <= 0.0f)
+	{
+		return 0;
+	}
+
+	SurfaceMask.SetNumUninitialized(NumParticles);
+	ClassifyParticles(Particles, Settings, SurfaceMask.GetData(),
+		[&Compact](int32 i, int32 j) { return Compact.GetOffset(i, j); },
+		[&Compact](int32 i) { return (Compact.GetFlags(i) & EKawaiiFluidCompactFlags::Surface) != 0; });
+
+	return CollectSurfaceIndices(NumParticles);
+}
+
+int32 FSurfaceDetector::CollectSurfaceIndices(int32 NumParticles)
+{
+	const uint8* MaskPtr = SurfaceMask.GetData();
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		if (MaskPtr[i])
+		{
+			SurfaceIndices.Add(i);
+		}
+	}
+	return SurfaceIndices.Num();
+}
@@ -2,6 +2,8 @@
 
 #include "Physics/ViscositySolver.h"
 #include "Physics/SPHKernels.h"
+#include "Core/KawaiiFluidCompactParticles.h"
+#include "Math/UnrealMathSSE.h"
 #include "Async/ParallelFor.h"
 
 namespace ViscosityConstants
@@ -14,7 +16,7 @@ FViscositySolver::FViscositySolver()
 {
 }
 
-void FViscositySolver::ApplyXSPH(TArray<FFluidParticle>& Particles, float ViscosityCoeff, float SmoothingRadius)
+void FViscositySolver::ApplyXSPH(TArray<FFluidParticle>& Particles, float ViscosityCoeff, float SmoothingRadius, int32 NumWorkRanges)
 {
 	if (ViscosityCoeff <= 0.0f)
 	{
@@ -27,71 +29,366 @@ void FViscositySolver::ApplyXSPH(TArray<FFluidParticle>& Particles, float Viscos
 		return;
 	}
 
-	// [Optimization 1] Cache kernel coefficients - compute once per frame
+	// Cache kernel coefficients - compute once per frame
 	SPHKernels::FKernelCoefficients KernelCoeffs;
 	KernelCoeffs.Precompute(SmoothingRadius);
 
-	// Radius squared (to avoid sqrt calls)
-	const float RadiusSquared = SmoothingRadius * SmoothingRadius;
+	// Read buffer: snapshot of every particle before any velocity changes
+	const int32 NumRanges = PrepareWorkRanges(Particles, NumWorkRanges, true);
+	const int32* RangeStartPtr = RangeStart.GetData();
 
-	// Store new velocities in temporary array
-	TArray<FVector> NewVelocities;
-	NewVelocities.SetNum(ParticleCount);
+	const float* RESTRICT PosXPtr = PosX.GetData();
+	const float* RESTRICT PosYPtr = PosY.GetData();
+	const float* RESTRICT PosZPtr = PosZ.GetData();
+	const float* RESTRICT VelXPtr = VelX.GetData();
+	const float* RESTRICT VelYPtr = VelY.GetData();
+	const float* RESTRICT VelZPtr = VelZ.GetData();
 
-	// [Optimization 4] Load balancing - use Unbalanced flag to handle varying neighbor counts
-	ParallelFor(ParticleCount, [&](int32 i)
-	{
-		const FFluidParticle& Particle = Particles[i];
-		FVector VelocityCorrection = FVector::ZeroVector;
-		float WeightSum = 0.0f;
+	const float h2_m = KernelCoeffs.h2;
+	const float Poly6Coeff = KernelCoeffs.Poly6Coeff;
+	const VectorRegister4Float VecH2 = VectorSetFloat1(h2_m);
+	const VectorRegister4Float VecCmToMSq = VectorSetFloat1(ViscosityConstants::CM_TO_M_SQ);
+	const VectorRegister4Float VecPoly6Coeff = VectorSetFloat1(Poly6Coeff);
+	const VectorRegister4Float VecZero = VectorZeroFloat();
 
-		for (int32 NeighborIdx : Particle.NeighborIndices)
+	// Write buffer: the particles themselves (a range only writes its own velocities, neighbors read the snapshot)
+	ParallelFor(NumRanges, [&](int32 Range)
+	{
+		for (int32 i = RangeStartPtr[Range]; i < RangeStartPtr[Range + 1]; ++i)
 		{
-			if (NeighborIdx == i)
+			const TArray<int32>& Neighbors = Particles[i].NeighborIndices;
+			const int32 NumNeighbors = Neighbors.Num();
+			const int32* NeighborData = Neighbors.GetData();
+
+			const float PiX = PosXPtr[i];
+			const float PiY = PosYPtr[i];
+			const float PiZ = PosZPtr[i];
+			const float ViX = VelXPtr[i];
+			const float ViY = VelYPtr[i];
+			const float ViZ = VelZPtr[i];
+
+			const VectorRegister4Float VecPiX = VectorSetFloat1(PiX);
+			const VectorRegister4Float VecPiY = VectorSetFloat1(PiY);
+			const VectorRegister4Float VecPiZ = VectorSetFloat1(PiZ);
+			const VectorRegister4Float VecViX = VectorSetFloat1(ViX);
+			const VectorRegister4Float VecViY = VectorSetFloat1(ViY);
+			const VectorRegister4Float VecViZ = VectorSetFloat1(ViZ);
+
+			VectorRegister4Float VecWeightSum = VecZero;
+			VectorRegister4Float VecCorrX = VecZero;
+			VectorRegister4Float VecCorrY = VecZero;
+			VectorRegister4Float VecCorrZ = VecZero;
+
+			// Process 4 at a time with SIMD
+			int32 n = 0;
+			for (; n + 4 <= NumNeighbors; n += 4)
 			{
-				continue;
+				const int32 n0 = NeighborData[n];
+				const int32 n1 = NeighborData[n + 1];
+				const int32 n2 = NeighborData[n + 2];
+				const int32 n3 = NeighborData[n + 3];
+
+				// Gather
+				const VectorRegister4Float VecDX = VectorSubtract(VecPiX, MakeVectorRegisterFloat(PosXPtr[n0], PosXPtr[n1], PosXPtr[n2], PosXPtr[n3]));
+				const VectorRegister4Float VecDY = VectorSubtract(VecPiY, MakeVectorRegisterFloat(PosYPtr[n0], PosYPtr[n1], PosYPtr[n2], PosYPtr[n3]));
+				const VectorRegister4Float VecDZ = VectorSubtract(VecPiZ, MakeVectorRegisterFloat(PosZPtr[n0], PosZPtr[n1], PosZPtr[n2], PosZPtr[n3]));
+				const VectorRegister4Float VecDVX = VectorSubtract(MakeVectorRegisterFloat(VelXPtr[n0], VelXPtr[n1], VelXPtr[n2], VelXPtr[n3]), VecViX);
+				const VectorRegister4Float VecDVY = VectorSubtract(MakeVectorRegisterFloat(VelYPtr[n0], VelYPtr[n1], VelYPtr[n2], VelYPtr[n3]), VecViY);
+				const VectorRegister4Float VecDVZ = VectorSubtract(MakeVectorRegisterFloat(VelZPtr[n0], VelZPtr[n1], VelZPtr[n2], VelZPtr[n3]), VecViZ);
+
+				VectorRegister4Float VecR2 = VectorMultiply(VecDX, VecDX);
+				VecR2 = VectorMultiplyAdd(VecDY, VecDY, VecR2);
+				VecR2 = VectorMultiplyAdd(VecDZ, VecDZ, VecR2);
+
+				// Poly6: W = Poly6Coeff * (h² - r²)³ in m, zero outside the radius and for the particle itself
+				const VectorRegister4Float VecDiff = VectorSubtract(VecH2, VectorMultiply(VecR2, VecCmToMSq));
+				const VectorRegister4Float VecNotSelf = MakeVectorRegisterFloat(
+					n0 != i ? 1.0f : 0.0f, n1 != i ? 1.0f : 0.0f, n2 != i ? 1.0f : 0.0f, n3 != i ? 1.0f : 0.0f);
+				const VectorRegister4Float VecMask = VectorBitwiseAnd(VectorCompareGT(VecDiff, VecZero), VectorCompareGT(VecNotSelf, VecZero));
+				VectorRegister4Float VecWeight = VectorMultiply(VecPoly6Coeff, VectorMultiply(VecDiff, VectorMultiply(VecDiff, VecDiff)));
+				VecWeight = VectorSelect(VecMask, VecWeight, VecZero);
+
+				VecWeightSum = VectorAdd(VecWeightSum, VecWeight);
+				VecCorrX = VectorMultiplyAdd(VecDVX, VecWeight, VecCorrX);
+				VecCorrY = VectorMultiplyAdd(VecDVY, VecWeight, VecCorrY);
+				VecCorrZ = VectorMultiplyAdd(VecDVZ, VecWeight, VecCorrZ);
 			}
 
-			const FFluidParticle& Neighbor = Particles[NeighborIdx];
-			const FVector r = Particle.Position - Neighbor.Position;
+			// Reduce SIMD results
+			alignas(16) float Temp[4];
+			VectorStoreAligned(VecWeightSum, Temp);
+			float WeightSum = Temp[0] + Temp[1] + Temp[2] + Temp[3];
+			VectorStoreAligned(VecCorrX, Temp);
+			float CorrX = Temp[0] + Temp[1] + Temp[2] + Temp[3];
+			VectorStoreAligned(VecCorrY, Temp);
+			float CorrY = Temp[0] + Temp[1] + Temp[2] + Temp[3];
+			VectorStoreAligned(VecCorrZ, Temp);
+			float CorrZ = Temp[0] + Temp[1] + Temp[2] + Temp[3];
+
+			// Process remaining scalar elements
+			for (; n < NumNeighbors; ++n)
+			{
+				const int32 NeighborIdx = NeighborData[n];
+				if (NeighborIdx == i)
+				{
+					continue;
+				}
+
+				const float dx = PiX - PosXPtr[NeighborIdx];
+				const float dy = PiY - PosYPtr[NeighborIdx];
+				const float dz = PiZ - PosZPtr[NeighborIdx];
+				const float diff = h2_m - (dx * dx + dy * dy + dz * dz) * ViscosityConstants::CM_TO_M_SQ;
+				if (diff > 0.0f)
+				{
+					const float Weight = Poly6Coeff * diff * diff * diff;
+					WeightSum += Weight;
+					CorrX += (VelXPtr[NeighborIdx] - ViX) * Weight;
+					CorrY += (VelYPtr[NeighborIdx] - ViY) * Weight;
+					CorrZ += (VelZPtr[NeighborIdx] - ViZ) * Weight;
+				}
+			}
+
+			// Apply XSPH viscosity: v_new = v + c * Σ(v_j - v_i) * W / ΣW
+			// (added to the full-precision velocity so particles without neighbors keep it exactly)
+			if (WeightSum > 0.0f)
+			{
+				const float Scale = ViscosityCoeff / WeightSum;
+				Particles[i].Velocity += FVector(CorrX * Scale, CorrY * Scale, CorrZ * Scale);
+			}
+		}
+	});
+}
+
+void FViscositySolver::ApplyXSPH(TArray<FFluidParticle>& Particles, const FKawaiiFluidCompactParticles& Compact, float ViscosityCoeff, float SmoothingRadius, int32 NumWorkRanges)
+{
+	if (ViscosityCoeff <= 0.0f)
+	{
+		return;
+	}
+
+	const int32 ParticleCount = Particles.Num();
+	if (!Compact.IsValidFor(ParticleCount))
+	{
+		ApplyXSPH(Particles, ViscosityCoeff, SmoothingRadius, NumWorkRanges);
+		return;
+	}
+
+	SPHKernels::FKernelCoefficients KernelCoeffs;
+	KernelCoeffs.Precompute(SmoothingRadius);
+
+	// Read buffer: the compact layout (packed before any velocity changes)
+	const int32 NumRanges = PrepareWorkRanges(Particles, NumWorkRanges, false);
+	const int32* RangeStartPtr = RangeStart.GetData();
+
+	constexpr int32 GatherSize = FKawaiiFluidCompactParticles::BlockSize;
+	const float h2_m = KernelCoeffs.h2;
+	const float Poly6Coeff = KernelCoeffs.Poly6Coeff;
+	const VectorRegister4Float VecH2 = VectorSetFloat1(h2_m);
+	const VectorRegister4Float VecCmToMSq = VectorSetFloat1(ViscosityConstants::CM_TO_M_SQ);
+	const VectorRegister4Float VecPoly6Coeff = VectorSetFloat1(Poly6Coeff);
+	const VectorRegister4Float VecZero = VectorZeroFloat();
+
+	ParallelFor(NumRanges, [&](int32 Range)
+	{
+		alignas(16) float DX[GatherSize], DY[GatherSize], DZ[GatherSize];
+		alignas(16) float VX[GatherSize], VY[GatherSize], VZ[GatherSize];
+		alignas(16) float NotSelf[GatherSize];
+
+		for (int32 i = RangeStartPtr[Range]; i < RangeStartPtr[Range + 1]; ++i)
+		{
+			const TArray<int32>& Neighbors = Particles[i].NeighborIndices;
+			const int32 NumNeighbors = Neighbors.Num();
+			const int32* NeighborData = Neighbors.GetData();
+
+			const FVector3f Vi = Compact.GetVelocity(i);
+			const VectorRegister4Float VecViX = VectorSetFloat1(Vi.X);
+			const VectorRegister4Float VecViY = VectorSetFloat1(Vi.Y);
+			const VectorRegister4Float VecViZ = VectorSetFloat1(Vi.Z);
+
+			VectorRegister4Float VecWeightSum = VecZero;
+			VectorRegister4Float VecCorrX = VecZero;
+			VectorRegister4Float VecCorrY = VecZero;
+			VectorRegister4Float VecCorrZ = VecZero;
 
-			// [Optimization 2] Radius-based filtering - early skip if r² > h² (avoid sqrt)
-			const float rSquared = r.SizeSquared();
-			if (rSquared > RadiusSquared)
+			// Gather 8 neighbors (one half conversion per axis), then 2 x 4 lanes of SIMD
+			int32 n = 0;
+			for (; n + GatherSize <= NumNeighbors; n += GatherSize)
 			{
-				continue;
+				for (int32 Lane = 0; Lane < GatherSize; ++Lane)
+				{
+					const int32 j = NeighborData[n + Lane];
+					const FVector3f Offset = Compact.GetOffset(i, j);
+					DX[Lane] = Offset.X;
+					DY[Lane] = Offset.Y;
+					DZ[Lane] = Offset.Z;
+					NotSelf[Lane] = j != i ? 1.0f : 0.0f;
+				}
+				Compact.GatherVelocities(NeighborData + n, VX, VY, VZ);
+
+				for (int32 Half = 0; Half < GatherSize; Half += 4)
+				{
+					const VectorRegister4Float VecDX = VectorLoadAligned(DX + Half);
+					const VectorRegister4Float VecDY = VectorLoadAligned(DY + Half);
+					const VectorRegister4Float VecDZ = VectorLoadAligned(DZ + Half);
+
+					VectorRegister4Float VecR2 = VectorMultiply(VecDX, VecDX);
+					VecR2 = VectorMultiplyAdd(VecDY, VecDY, VecR2);
+					VecR2 = VectorMultiplyAdd(VecDZ, VecDZ, VecR2);
+
+					const VectorRegister4Float VecDiff = VectorSubtract(VecH2, VectorMultiply(VecR2, VecCmToMSq));
+					const VectorRegister4Float VecMask = VectorBitwiseAnd(VectorCompareGT(VecDiff, VecZero), VectorCompareGT(VectorLoadAligned(NotSelf + Half), VecZero));
+					VectorRegister4Float VecWeight = VectorMultiply(VecPoly6Coeff, VectorMultiply(VecDiff, VectorMultiply(VecDiff, VecDiff)));
+					VecWeight = VectorSelect(VecMask, VecWeight, VecZero);
+
+					VecWeightSum = VectorAdd(VecWeightSum, VecWeight);
+					VecCorrX = VectorMultiplyAdd(VectorSubtract(VectorLoadAligned(VX + Half), VecViX), VecWeight, VecCorrX);
+					VecCorrY = VectorMultiplyAdd(VectorSubtract(VectorLoadAligned(VY + Half), VecViY), VecWeight, VecCorrY);
+					VecCorrZ = VectorMultiplyAdd(VectorSubtract(VectorLoadAligned(VZ + Half), VecViZ), VecWeight, VecCorrZ);
+				}
 			}
 
-			// [Optimization 1] Directly compute Poly6 with cached coefficients
-			// W(r, h) = Poly6Coeff * (h² - r²)³
-			// Unit conversion: cm -> m (coefficients already computed in m units)
-			const float h2_m = KernelCoeffs.h2;
-			const float r2_m = rSquared * ViscosityConstants::CM_TO_M_SQ;
-			const float diff = h2_m - r2_m;
-			const float Weight = (diff > 0.0f) ? KernelCoeffs.Poly6Coeff * diff * diff * diff : 0.0f;
+			// Reduce SIMD results
+			alignas(16) float Temp[4];
+			VectorStoreAligned(VecWeightSum, Temp);
+			float WeightSum = Temp[0] + Temp[1] + Temp[2] + Temp[3];
+			VectorStoreAligned(VecCorrX, Temp);
+			float CorrX = Temp[0] + Temp[1] + Temp[2] + Temp[3];
+			VectorStoreAligned(VecCorrY, Temp);
+			float CorrY = Temp[0] + Temp[1] + Temp[2] + Temp[3];
+			VectorStoreAligned(VecCorrZ, Temp);
+			float CorrZ = Temp[0] + Temp[1] + Temp[2] + Temp[3];
 
-			// Velocity difference
-			const FVector VelocityDiff = Neighbor.Velocity - Particle.Velocity;
+			// Process remaining scalar elements
+			for (; n < NumNeighbors; ++n)
+			{
+				const int32 NeighborIdx = NeighborData[n];
+				if (NeighborIdx == i)
+				{
+					continue;
+				}
 
-			VelocityCorrection += VelocityDiff * Weight;
-			WeightSum += Weight;
+				const float diff = h2_m - Compact.GetOffset(i, NeighborIdx).SizeSquared() * ViscosityConstants::CM_TO_M_SQ;
+				if (diff > 0.0f)
+				{
+					const float Weight = Poly6Coeff * diff * diff * diff;
+					const FVector3f Vj = Compact.GetVelocity(NeighborIdx);
+					WeightSum += Weight;
+					CorrX += (Vj.X - Vi.X) * Weight;
+					CorrY += (Vj.Y - Vi.Y) * Weight;
+					CorrZ += (Vj.Z - Vi.Z) * Weight;
+				}
+			}
+
+			if (WeightSum > 0.0f)
+			{
+				const float Scale = ViscosityCoeff / WeightSum;
+				Particles[i].Velocity += FVector(CorrX * Scale, CorrY * Scale, CorrZ * Scale);
+			}
 		}
+	});
+}
 
-		// Normalization (optional)
-		if (WeightSum > 0.0f)
+int32 FViscositySolver::PrepareWorkRanges(const TArray<FFluidParticle>& Particles, int32 NumWorkRanges, bool bSnapshot)
+{
+	const int32 ParticleCount = Particles.Num();
+
+	// Balanced ranges instead of per-particle Unbalanced scheduling: one task per range
+	if (NumWorkRanges <= 0)
+	{
+		NumWorkRanges = FPlatformMisc::NumberOfCoresIncludingHyperthreads() * 4;
+	}
+	NumWorkRanges = FMath::Clamp(NumWorkRanges, 1, ParticleCount);
+
+	// Positions relative to the first particle keep float precision far from the world origin
+	const FVector Origin = Particles[0].Position;
+	if (bSnapshot)
+	{
+		PosX.SetNumUninitialized(ParticleCount, EAllowShrinking::No);
+		PosY.SetNumUninitialized(ParticleCount, EAllowShrinking::No);
+		PosZ.SetNumUninitialized(ParticleCount, EAllowShrinking::No);
+		VelX.SetNumUninitialized(ParticleCount, EAllowShrinking::No);
+		VelY.SetNumUninitialized(ParticleCount, EAllowShrinking::No);
+		VelZ.SetNumUninitialized(ParticleCount, EAllowShrinking::No);
+	}
+
+	// The same pass over the particles builds the work prefix sum per block of equal particle count
+	const int32 BlockSize = FMath::DivideAndRoundUp(ParticleCount, NumWorkRanges);
+	const int32 NumBlocks = FMath::DivideAndRoundUp(ParticleCount, BlockSize);
+	WorkPrefix.SetNumUninitialized(ParticleCount, EAllowShrinking::No);
+	BlockWorkStart.SetNumUninitialized(NumBlocks + 1, EAllowShrinking::No);
+
+	ParallelFor(NumBlocks, [&](int32 Block)
+	{
+		const int32 BlockEnd = FMath::Min((Block + 1) * BlockSize, ParticleCount);
+		int32 Work = 0;
+		for (int32 i = Block * BlockSize; i < BlockEnd; ++i)
 		{
-			VelocityCorrection /= WeightSum;
+			const FFluidParticle& Particle = Particles[i];
+			if (bSnapshot)
+			{
+				PosX[i] = static_cast<float>(Particle.Position.X - Origin.X);
+				PosY[i] = static_cast<float>(Particle.Position.Y - Origin.Y);
+				PosZ[i] = static_cast<float>(Particle.Position.Z - Origin.Z);
+				VelX[i] = static_cast<float>(Particle.Velocity.X);
+				VelY[i] = static_cast<float>(Particle.Velocity.Y);
+				VelZ[i] = static_cast<float>(Particle.Velocity.Z);
+			}
+
+			// Cost of a particle: its neighbor list plus a fixed per-particle overhead
+			Work += Particle.NeighborIndices.Num() + 1;
+			WorkPrefix[i] = Work;
 		}
+		BlockWorkStart[Block + 1] = Work;
+	});
+
+	BuildWorkRanges(NumWorkRanges, BlockSize);
+	return RangeStart.Num() - 1;
+}
 
-		// Apply XSPH viscosity: v_new = v + c * Σ(v_j - v_i) * W
-		NewVelocities[i] = Particle.Velocity + ViscosityCoeff * VelocityCorrection;
+void FViscositySolver::BuildWorkRanges(int32 NumRanges, int32 BlockSize)
+{
+	const int32 ParticleCount = WorkPrefix.Num();
 
-	}, EParallelForFlags::Unbalanced);
+	// Block totals -> exclusive block offsets (one entry per block, not per particle)
+	BlockWorkStart[0] = 0;
+	for (int32 Block = 1; Block < BlockWorkStart.Num(); ++Block)
+	{
+		BlockWorkStart[Block] += BlockWorkStart[Block - 1];
+	}
+	const int64 TotalWork = BlockWorkStart.Last();
+
+	// Work up to and including particle i (strictly increasing)
+	auto WorkThrough = [this, BlockSize](int32 i)
+	{
+		return BlockWorkStart[i / BlockSize] + WorkPrefix[i];
+	};
 
-	// [Optimization 3] Simplify velocity application loop - use simple for loop instead of ParallelFor
-	// Simple copy operations have more scheduler overhead than benefit
-	for (int32 i = 0; i < ParticleCount; ++i)
+	// Close range k after the first particle whose running work reaches k shares of the total
+	RangeStart.Reset(NumRanges + 1);
+	RangeStart.Add(0);
+	for (int32 k = 1; k < NumRanges; ++k)
 	{
-		Particles[i].Velocity = NewVelocities[i];
+		int32 Lo = RangeStart.Last();
+		int32 Hi = ParticleCount;
+		while (Lo < Hi)
+		{
+			const int32 Mid = Lo + (Hi - Lo) / 2;
+			if (WorkThrough(Mid) * NumRanges >= TotalWork * k)
+			{
+				Hi = Mid;
+			}
+			else
+			{
+				Lo = Mid + 1;
+			}
+		}
+
+		if (Lo + 1 >= ParticleCount)
+		{
+			break;
+		}
+		RangeStart.Add(Lo + 1);
 	}
+
+	RangeStart.Add(ParticleCount);
 }
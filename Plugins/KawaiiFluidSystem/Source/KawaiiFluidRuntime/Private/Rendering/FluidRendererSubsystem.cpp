@@ -508,8 +508,8 @@ void UFluidRendererSubsystem::RegisterShadowParticles(const FVector* ParticlePos
 		return;
 	}
 
-	// Apply skip factor
-	const int32 SkipFactor = FMath::Max(1, ParticleSkipFactor);
+	// Apply skip factor (clustering uses every particle; cost is one hash lookup per cell change)
+	const int32 SkipFactor = bClusterShadowProxies ? 1 : FMath::Max(1, ParticleSkipFactor);
 	const int32 NumToAdd = (NumParticles + SkipFactor - 1) / SkipFactor;
 
 	// Reserve space to avoid frequent reallocations
@@ -527,6 +527,21 @@ void UFluidRendererSubsystem::RegisterShadowParticles(const FVector* ParticlePos
 	bHasParticlesThisFrame[QualityIndex] = true;
 }
 
+/**
+ * @brief Record a view origin used for shadow cluster LOD.
+ * The first view of a new frame replaces the previous frame's views.
+ * @param ViewOrigin World-space view origin.
+ */
+void UFluidRendererSubsystem::RecordShadowView(const FVector& ViewOrigin)
+{
+	if (ShadowViewFrameNumber != GFrameCounter)
+	{
+		ShadowViewFrameNumber = GFrameCounter;
+		ShadowViewLocations.Reset();
+	}
+	ShadowViewLocations.Add(ViewOrigin);
+}
+
 /**
  * @brief Flush aggregated particles to ISM components.
  * Creates transforms from aggregated positions and updates ISM per quality level.
@@ -556,6 +571,7 @@ void UFluidRendererSubsystem::FlushShadowInstances()
 				ISM->ClearInstances();
 				ISM->MarkRenderStateDirty();
 			}
+			ShadowClusterers[QualityIndex].Reset();
 			continue;
 		}
 
@@ -569,6 +585,20 @@ void UFluidRendererSubsystem::FlushShadowInstances()
 			}
 		}
 
+		if (bClusterShadowProxies)
+		{
+			FFluidShadowClusterSettings ClusterSettings;
+			ClusterSettings.ClusterSizeInRadii = ShadowClusterSizeInRadii;
+			ClusterSettings.LODDistance = ShadowLODDistance;
+			ClusterSettings.MaxLOD = MaxShadowLOD;
+			ShadowClusterers[QualityIndex].SetSettings(ClusterSettings);
+			ShadowClusterers[QualityIndex].Update(Positions, Radius, ShadowViewLocations);
+
+			FlushClusteredShadowInstances(QualityIndex, ISM);
+			continue;
+		}
+		ShadowClusterers[QualityIndex].Reset();
+
 		const int32 NumInstances = Positions.Num();
 
 		// Prepare transforms
@@ -613,6 +643,46 @@ void UFluidRendererSubsystem::FlushShadowInstances()
 				}	}
 }
 
+/**
+ * @brief Update ISM instances from the clusterer of one quality level.
+ * Existing slots are updated in place; only appended slots are added.
+ * A full rebuild happens after slot compaction or if the ISM lost sync.
+ * @param QualityIndex Shadow quality level index.
+ * @param ISM Target ISM component.
+ */
+void UFluidRendererSubsystem::FlushClusteredShadowInstances(int32 QualityIndex, UInstancedStaticMeshComponent* ISM)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FluidShadow_FlushClusters);
+
+	const FFluidShadowClusterer& Clusterer = ShadowClusterers[QualityIndex];
+	const TArray<FTransform>& Transforms = Clusterer.GetInstanceTransforms();
+	const int32 NumSlots = Transforms.Num();
+	const int32 PreviousNumSlots = Clusterer.GetPreviousNumSlots();
+	const int32 CurrentCount = ISM->GetInstanceCount();
+
+	if (CurrentCount == NumSlots)
+	{
+		// Same slots (also covers a compaction that happens to keep the count): update in place
+		ISM->BatchUpdateInstancesTransforms(0, Transforms, true, true, false);
+	}
+	else if (CurrentCount == PreviousNumSlots && NumSlots > PreviousNumSlots)
+	{
+		// Grown: update the existing prefix, append the new tail
+		if (PreviousNumSlots > 0)
+		{
+			ISM->BatchUpdateInstancesTransforms(0, MakeArrayView(Transforms.GetData(), PreviousNumSlots), true, false, false);
+		}
+		ISM->AddInstances(TArray<FTransform>(Transforms.GetData() + PreviousNumSlots, NumSlots - PreviousNumSlots), false, true);
+		ISM->MarkRenderStateDirty();
+	}
+	else
+	{
+		// Compacted (or ISM out of sync): rebuild
+		ISM->ClearInstances();
+		ISM->AddInstances(Transforms, false, true);
+	}
+}
+
 /**
  * @brief Clear aggregation buffers for next frame.
  */
@@ -653,4 +723,9 @@ void UFluidRendererSubsystem::CleanupShadowResources()
 	// Clear buffers
 	ClearAggregationBuffers();
 	CachedInstanceTransforms.Empty();
+	for (FFluidShadowClusterer& Clusterer : ShadowClusterers)
+	{
+		Clusterer.Reset();
+	}
+	ShadowViewLocations.Empty();
 }
@@ -94,6 +94,15 @@ void FFluidSceneViewExtension::BeginRenderViewFamily(FSceneViewFamily& InViewFam
 		}
 	}
 
+	// Shadow proxy clustering LOD is relative to the rendered views
+	for (const FSceneView* View : InViewFamily.Views)
+	{
+		if (View)
+		{
+			SubsystemPtr->RecordShadowView(View->ViewMatrices.GetViewOrigin());
+		}
+	}
+
 	// ============================================
 	// NOTE: Bone transform refresh is now done in SimulateSubstep(), NOT here.
 	//
@@ -0,0 +1,214 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Rendering/FluidShadowClusterer.h"
+
+namespace
+{
+	/** Slot key of a vacated slot (bit 63 is never set by ComputeClusterKey) */
+	constexpr uint64 FreeSlotKey = ~0ull;
+
+	/** Bits per cell coordinate in the cluster key (wraps every 2^20 cells) */
+	constexpr int32 CellBits = 20;
+	constexpr uint64 CellMask = (1ull << CellBits) - 1;
+}
+
+void FFluidShadowClusterer::SetSettings(const FFluidShadowClusterSettings& InSettings)
+{
+	Settings = InSettings;
+	Settings.ClusterSizeInRadii = FMath::Max(Settings.ClusterSizeInRadii, 1.0f);
+	Settings.LODDistance = FMath::Max(Settings.LODDistance, 0.0f);
+	Settings.MaxLOD = FMath::Clamp(Settings.MaxLOD, 0, LODLimit);
+	Settings.CoverageSigma = FMath::Max(Settings.CoverageSigma, 0.0f);
+	Settings.ProxyMeshRadius = FMath::Max(Settings.ProxyMeshRadius, KINDA_SMALL_NUMBER);
+}
+
+int32 FFluidShadowClusterer::ComputeLOD(const FVector& Position) const
+{
+	if (Anchors.Num() == 0 || Settings.LODDistance <= 0.0f || Settings.MaxLOD == 0)
+	{
+		return 0;
+	}
+
+	double MinDistSq = TNumericLimits<double>::Max();
+	for (const FVector& Anchor : Anchors)
+	{
+		MinDistSq = FMath::Min(MinDistSq, FVector::DistSquared(Position, Anchor));
+	}
+
+	const double Distance = FMath::Sqrt(MinDistSq);
+	if (Distance < Settings.LODDistance)
+	{
+		return 0;
+	}
+
+	const int32 Level = 1 + FMath::FloorToInt32(FMath::Log2(Distance / Settings.LODDistance));
+	return FMath::Min(Level, Settings.MaxLOD);
+}
+
+uint64 FFluidShadowClusterer::ComputeClusterKey(const FVector& Position, float ParticleRadius) const
+{
+	const int32 Level = ComputeLOD(Position);
+	const double CellSize = FMath::Max(static_cast<double>(Settings.ClusterSizeInRadii * ParticleRadius), 1.0) * static_cast<double>(1 << Level);
+
+	const uint64 X = static_cast<uint64>(FMath::FloorToInt64(Position.X / CellSize)) & CellMask;
+	const uint64 Y = static_cast<uint64>(FMath::FloorToInt64(Position.Y / CellSize)) & CellMask;
+	const uint64 Z = static_cast<uint64>(FMath::FloorToInt64(Position.Z / CellSize)) & CellMask;
+
+	return (static_cast<uint64>(Level) << (CellBits * 3)) | (X << (CellBits * 2)) | (Y << CellBits) | Z;
+}
+
+int32 FFluidShadowClusterer::FindSlot(uint64 ClusterKey) const
+{
+	const int32* Slot = ClusterToSlot.Find(ClusterKey);
+	return Slot ? *Slot : INDEX_NONE;
+}
+
+EFluidShadowSlotChange FFluidShadowClusterer::Update(TConstArrayView<FVector> Positions, float ParticleRadius, TConstArrayView<FVector> ViewLocations)
+{
+	PreviousNumSlots = SlotKeys.Num();
+
+	UpdateAnchors(ViewLocations);
+
+	// Accumulators of free slots stay zero, so reusing one mid-frame needs no reset
+	Accumulators.SetNumUninitialized(SlotKeys.Num(), EAllowShrinking::No);
+	if (Accumulators.Num() > 0)
+	{
+		FMemory::Memzero(Accumulators.GetData(), Accumulators.Num() * sizeof(FClusterAccumulator));
+	}
+
+	// Readback is Z-Order sorted, so consecutive particles mostly share a cluster
+	uint64 LastKey = FreeSlotKey;
+	int32 LastSlot = INDEX_NONE;
+	for (const FVector& Position : Positions)
+	{
+		const uint64 Key = ComputeClusterKey(Position, ParticleRadius);
+		if (Key != LastKey)
+		{
+			LastSlot = FindOrAddSlot(Key);
+			LastKey = Key;
+		}
+
+		FClusterAccumulator& Accumulator = Accumulators[LastSlot];
+		const FVector3d P(Position);
+		Accumulator.Sum += P;
+		Accumulator.SumSquared += P * P;
+		++Accumulator.Count;
+	}
+
+	// Vacate clusters that lost all particles
+	for (int32 Slot = 0; Slot < SlotKeys.Num(); ++Slot)
+	{
+		if (SlotKeys[Slot] != FreeSlotKey && Accumulators[Slot].Count == 0)
+		{
+			ClusterToSlot.Remove(SlotKeys[Slot]);
+			SlotKeys[Slot] = FreeSlotKey;
+			FreeSlots.Add(Slot);
+		}
+	}
+
+	EFluidShadowSlotChange Change = SlotKeys.Num() > PreviousNumSlots ? EFluidShadowSlotChange::Grown : EFluidShadowSlotChange::None;
+	if (FreeSlots.Num() > FMath::Max(MinFreeSlotsBeforeCompact, ClusterToSlot.Num()))
+	{
+		CompactSlots();
+		Change = EFluidShadowSlotChange::Compacted;
+	}
+
+	// Axis-aligned ellipsoid from per-axis mean and variance
+	InstanceTransforms.SetNum(SlotKeys.Num(), EAllowShrinking::No);
+	for (int32 Slot = 0; Slot < SlotKeys.Num(); ++Slot)
+	{
+		FTransform& Transform = InstanceTransforms[Slot];
+		const FClusterAccumulator& Accumulator = Accumulators[Slot];
+		if (SlotKeys[Slot] == FreeSlotKey || Accumulator.Count == 0)
+		{
+			Transform.SetScale3D(FVector::ZeroVector);
+			continue;
+		}
+
+		const double InvCount = 1.0 / Accumulator.Count;
+		const FVector3d Mean = Accumulator.Sum * InvCount;
+		const FVector3d Variance = (Accumulator.SumSquared * InvCount - Mean * Mean).ComponentMax(FVector3d::ZeroVector);
+		const FVector3d Sigma(FMath::Sqrt(Variance.X), FMath::Sqrt(Variance.Y), FMath::Sqrt(Variance.Z));
+		const FVector3d Extent = Sigma * Settings.CoverageSigma + FVector3d(ParticleRadius);
+
+		Transform.SetTranslation(Mean);
+		Transform.SetRotation(FQuat::Identity);
+		Transform.SetScale3D(Extent / Settings.ProxyMeshRadius);
+	}
+
+	return Change;
+}
+
+void FFluidShadowClusterer::UpdateAnchors(TConstArrayView<FVector> ViewLocations)
+{
+	if (Anchors.Num() != ViewLocations.Num())
+	{
+		Anchors.Reset();
+		Anchors.Append(ViewLocations.GetData(), ViewLocations.Num());
+		return;
+	}
+
+	const double MoveThreshold = Settings.LODDistance * AnchorHysteresis;
+	for (int32 i = 0; i < Anchors.Num(); ++i)
+	{
+		if (FVector::DistSquared(Anchors[i], ViewLocations[i]) > MoveThreshold * MoveThreshold)
+		{
+			Anchors[i] = ViewLocations[i];
+		}
+	}
+}
+
+int32 FFluidShadowClusterer::FindOrAddSlot(uint64 ClusterKey)
+{
+	if (const int32* Existing = ClusterToSlot.Find(ClusterKey))
+	{
+		return *Existing;
+	}
+
+	int32 Slot;
+	if (FreeSlots.Num() > 0)
+	{
+		Slot = FreeSlots.Pop(EAllowShrinking::No);
+		SlotKeys[Slot] = ClusterKey;
+	}
+	else
+	{
+		Slot = SlotKeys.Add(ClusterKey);
+		Accumulators.AddZeroed();
+	}
+
+	ClusterToSlot.Add(ClusterKey, Slot);
+	return Slot;
+}
+
+void FFluidShadowClusterer::CompactSlots()
+{
+	int32 NumLive = 0;
+	for (int32 Slot = 0; Slot < SlotKeys.Num(); ++Slot)
+	{
+		if (SlotKeys[Slot] == FreeSlotKey)
+		{
+			continue;
+		}
+
+		SlotKeys[NumLive] = SlotKeys[Slot];
+		Accumulators[NumLive] = Accumulators[Slot];
+		ClusterToSlot.FindChecked(SlotKeys[NumLive]) = NumLive;
+		++NumLive;
+	}
+
+	SlotKeys.SetNum(NumLive, EAllowShrinking::No);
+	Accumulators.SetNum(NumLive, EAllowShrinking::No);
+	FreeSlots.Reset();
+}
+
+void FFluidShadowClusterer::Reset()
+{
+	Anchors.Reset();
+	ClusterToSlot.Reset();
+	SlotKeys.Reset();
+	FreeSlots.Reset();
+	Accumulators.Reset();
+	InstanceTransforms.Reset();
+	PreviousNumSlots = 0;
+}
@@ -170,6 +170,15 @@ void UKawaiiFluidISMRenderer::UpdateRendering(const IKawaiiFluidDataProvider* Da
 	// Check if velocities available
 	const bool bHasVelocities = Velocities.Num() == Positions.Num();
 
+	// Anisotropic instances: ellipsoids from the particle positions on the CPU
+	const bool bUseAnisotropy = bAnisotropicInstances && CachedPreset;
+	if (bUseAnisotropy)
+	{
+		const FKawaiiFluidAnisotropySettings AnisotropySettings = FKawaiiFluidAnisotropySettings::FromParams(
+			CachedPreset->RenderingParameters.AnisotropyParams, CachedPreset->SmoothingRadius);
+		AnisotropyBatch.Compute(Positions, AnisotropySettings, InstanceEllipsoids);
+	}
+
 	// Add each particle as instance
 	int32 InstanceIndex = 0;
 	for (int32 i = 0; i < NumInstances; ++i)
@@ -189,8 +198,12 @@ void UKawaiiFluidISMRenderer::UpdateRendering(const IKawaiiFluidDataProvider* Da
 		InstanceTransform.SetLocation(FVector(Position));
 		InstanceTransform.SetScale3D(ScaleVec);
 
+		if (bUseAnisotropy)
+		{
+			InstanceTransform = FKawaiiFluidAnisotropyBatch::MakeInstanceTransform(Position, InstanceEllipsoids[i], ScaleFactor);
+		}
 		// Velocity-based rotation (optional)
-		if (bRotateByVelocity && bHasVelocities && !Velocity.IsNearlyZero())
+		else if (bRotateByVelocity && bHasVelocities && !Velocity.IsNearlyZero())
 		{
 			FRotator Rotation = FVector(Velocity).ToOrientationRotator();
 			InstanceTransform.SetRotation(Rotation.Quaternion());
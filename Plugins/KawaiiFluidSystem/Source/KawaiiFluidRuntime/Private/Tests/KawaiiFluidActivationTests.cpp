@@ -0,0 +1,204 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Batched Distance Activation Unit Tests
+// Verifies FKawaiiFluidActivationGrid against brute-force distance checks on synthetic positions
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Core/KawaiiFluidActivationGrid.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidActivationTest_Hysteresis,
+	"KawaiiFluid.Core.Activation.A01_Hysteresis",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidActivationTest_MultipleReferences,
+	"KawaiiFluid.Core.Activation.A02_MultipleReferences",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidActivationTest_MatchesBruteForce,
+	"KawaiiFluid.Core.Activation.A03_MatchesBruteForce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidActivationTest_FindNearest,
+	"KawaiiFluid.Core.Activation.A04_FindNearest",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+//=============================================================================
+// A-01: Hysteresis
+// Entry activates at ActivationDistance and only deactivates beyond
+// ActivationDistance + HysteresisDistance
+//=============================================================================
+bool FKawaiiFluidActivationTest_Hysteresis::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidActivationGrid Grid;
+	const int32 Handle = Grid.AddEntry(FVector::ZeroVector, 1000.0f, 100.0f);
+	TArray<int32> Changed;
+
+	// Outside activation range: stays inactive
+	TArray<FVector> Reference = { FVector(1050.0f, 0.0f, 0.0f) };
+	Grid.Update(Reference, Changed);
+	TestFalse(TEXT("Inactive at 1050 (threshold 1000)"), Grid.IsEntryActive(Handle));
+	TestEqual(TEXT("No change reported"), Changed.Num(), 0);
+
+	// Enters range
+	Reference[0] = FVector(900.0f, 0.0f, 0.0f);
+	Grid.Update(Reference, Changed);
+	TestTrue(TEXT("Active at 900"), Grid.IsEntryActive(Handle));
+	TestEqual(TEXT("Activation reported once"), Changed.Num(), 1);
+
+	// Inside hysteresis band: stays active
+	Reference[0] = FVector(1050.0f, 0.0f, 0.0f);
+	Grid.Update(Reference, Changed);
+	TestTrue(TEXT("Still active at 1050 (deactivation 1100)"), Grid.IsEntryActive(Handle));
+	TestEqual(TEXT("No change inside hysteresis band"), Changed.Num(), 0);
+
+	// Beyond hysteresis band: deactivates
+	Reference[0] = FVector(1150.0f, 0.0f, 0.0f);
+	Grid.Update(Reference, Changed);
+	TestFalse(TEXT("Inactive at 1150"), Grid.IsEntryActive(Handle));
+	TestEqual(TEXT("Deactivation reported once"), Changed.Num(), 1);
+
+	return true;
+}
+
+//=============================================================================
+// A-02: Multiple Reference Points (split-screen / spectators)
+// Entry is active while ANY reference point is in range
+//=============================================================================
+bool FKawaiiFluidActivationTest_MultipleReferences::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidActivationGrid Grid;
+	const int32 Left = Grid.AddEntry(FVector(-5000.0f, 0.0f, 0.0f), 1000.0f, 100.0f);
+	const int32 Right = Grid.AddEntry(FVector(5000.0f, 0.0f, 0.0f), 1000.0f, 100.0f);
+	const int32 Far = Grid.AddEntry(FVector(0.0f, 50000.0f, 0.0f), 1000.0f, 100.0f);
+	TArray<int32> Changed;
+
+	const TArray<FVector> References = { FVector(-4500.0f, 0.0f, 0.0f), FVector(5500.0f, 0.0f, 0.0f) };
+	Grid.Update(References, Changed);
+
+	TestTrue(TEXT("Left emitter active (player 1)"), Grid.IsEntryActive(Left));
+	TestTrue(TEXT("Right emitter active (player 2)"), Grid.IsEntryActive(Right));
+	TestFalse(TEXT("Far emitter inactive"), Grid.IsEntryActive(Far));
+	TestEqual(TEXT("Two activations reported"), Changed.Num(), 2);
+
+	// No reference points: everything deactivates
+	Grid.Update(TConstArrayView<FVector>(), Changed);
+	TestFalse(TEXT("Left inactive without references"), Grid.IsEntryActive(Left));
+	TestFalse(TEXT("Right inactive without references"), Grid.IsEntryActive(Right));
+
+	// Removed handle is reused and starts inactive
+	Grid.RemoveEntry(Left);
+	const int32 Reused = Grid.AddEntry(FVector::ZeroVector, 500.0f, 50.0f);
+	TestEqual(TEXT("Removed handle reused"), Reused, Left);
+	TestFalse(TEXT("Reused entry starts inactive"), Grid.IsEntryActive(Reused));
+	TestEqual(TEXT("Entry count"), Grid.Num(), 3);
+
+	return true;
+}
+
+//=============================================================================
+// A-03: Grid Update Matches Brute Force
+// Random emitters with mixed activation distances, moving reference points
+//=============================================================================
+bool FKawaiiFluidActivationTest_MatchesBruteForce::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(1234);
+	FKawaiiFluidActivationGrid Grid;
+
+	const int32 NumEntries = 500;
+	TArray<FVector> Locations;
+	TArray<float> Distances;
+	TArray<bool> BruteForceActive;
+	for (int32 i = 0; i < NumEntries; ++i)
+	{
+		Locations.Add(Random.GetUnitVector() * Random.FRandRange(0.0f, 50000.0f));
+		Distances.Add(Random.FRandRange(500.0f, 4000.0f));
+		BruteForceActive.Add(false);
+		Grid.AddEntry(Locations[i], Distances[i], Distances[i] * 0.1f);
+	}
+
+	int32 Mismatches = 0;
+	TArray<int32> Changed;
+	for (int32 Step = 0; Step < 50; ++Step)
+	{
+		TArray<FVector> References;
+		const int32 NumReferences = 1 + (Step % 4);
+		for (int32 r = 0; r < NumReferences; ++r)
+		{
+			References.Add(Random.GetUnitVector() * Random.FRandRange(0.0f, 50000.0f));
+		}
+
+		Grid.Update(References, Changed);
+
+		for (int32 i = 0; i < NumEntries; ++i)
+		{
+			const float Reach = BruteForceActive[i] ? Distances[i] + Distances[i] * 0.1f : Distances[i];
+			bool bInRange = false;
+			for (const FVector& Reference : References)
+			{
+				bInRange |= FVector::DistSquared(Reference, Locations[i]) <= Reach * Reach;
+			}
+			BruteForceActive[i] = bInRange;
+
+			if (Grid.IsEntryActive(i) != bInRange)
+			{
+				++Mismatches;
+			}
+		}
+	}
+
+	TestEqual(TEXT("Grid activation matches brute force"), Mismatches, 0);
+
+	return true;
+}
+
+//=============================================================================
+// A-04: Nearest Lookup
+// FindNearest matches brute force, including queries far outside the grid
+//=============================================================================
+bool FKawaiiFluidActivationTest_FindNearest::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(42);
+	FKawaiiFluidActivationGrid Grid(1000.0f);
+
+	TestEqual(TEXT("Empty grid returns INDEX_NONE"), Grid.FindNearest(FVector::ZeroVector), static_cast<int32>(INDEX_NONE));
+
+	TArray<FVector> Locations;
+	for (int32 i = 0; i < 64; ++i)
+	{
+		Locations.Add(Random.GetUnitVector() * Random.FRandRange(0.0f, 20000.0f));
+		Grid.AddEntry(Locations[i], 0.0f, 0.0f);
+	}
+
+	int32 Mismatches = 0;
+	for (int32 Query = 0; Query < 200; ++Query)
+	{
+		// Half the queries are far away to exercise the linear fallback
+		const float Range = (Query % 2 == 0) ? 20000.0f : 500000.0f;
+		const FVector QueryLocation = Random.GetUnitVector() * Random.FRandRange(0.0f, Range);
+
+		int32 Expected = INDEX_NONE;
+		double BestDistSq = TNumericLimits<double>::Max();
+		for (int32 i = 0; i < Locations.Num(); ++i)
+		{
+			const double DistSq = FVector::DistSquared(QueryLocation, Locations[i]);
+			if (DistSq < BestDistSq)
+			{
+				BestDistSq = DistSq;
+				Expected = i;
+			}
+		}
+
+		if (Grid.FindNearest(QueryLocation) != Expected)
+		{
+			++Mismatches;
+		}
+	}
+
+	TestEqual(TEXT("FindNearest matches brute force"), Mismatches, 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,348 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// CPU Adhesion Unit Tests
+// Collider broadphase verified against the brute-force scan, integer attachment IDs, stack pressure owner filter
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Physics/AdhesionSolver.h"
+#include "Physics/StackPressureSolver.h"
+#include "Collision/KawaiiFluidColliderBroadphase.h"
+#include "Collision/KawaiiFluidSphereCollider.h"
+#include "Collision/KawaiiFluidCapsuleCollider.h"
+#include "Collision/KawaiiFluidBoxCollider.h"
+#include "Core/FluidParticle.h"
+#include "GameFramework/Actor.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAdhesionTest_BroadphaseQuery,
+	"KawaiiFluid.Physics.Adhesion.A01_BroadphaseQuery",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAdhesionTest_MatchesBruteForce,
+	"KawaiiFluid.Physics.Adhesion.A02_MatchesBruteForce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAdhesionTest_AttachmentIDs,
+	"KawaiiFluid.Physics.Adhesion.A03_AttachmentIDs",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float TestAdhesionStrength = 0.5f;
+	constexpr float TestAdhesionRadius = 25.0f;
+	constexpr float TestContactOffset = 2.0f;
+
+	UKawaiiFluidSphereCollider* AddSphere(AActor* Owner, const FVector& Center, float Radius)
+	{
+		UKawaiiFluidSphereCollider* Collider = NewObject<UKawaiiFluidSphereCollider>(Owner);
+		Collider->LocalOffset = Center;
+		Collider->Radius = Radius;
+		return Collider;
+	}
+
+	UKawaiiFluidCapsuleCollider* AddCapsule(AActor* Owner, const FVector& Center, float HalfHeight, float Radius)
+	{
+		UKawaiiFluidCapsuleCollider* Collider = NewObject<UKawaiiFluidCapsuleCollider>(Owner);
+		Collider->LocalOffset = Center;
+		Collider->HalfHeight = HalfHeight;
+		Collider->Radius = Radius;
+		return Collider;
+	}
+
+	UKawaiiFluidBoxCollider* AddBox(AActor* Owner, const FVector& Center, const FVector& Extent)
+	{
+		UKawaiiFluidBoxCollider* Collider = NewObject<UKawaiiFluidBoxCollider>(Owner);
+		Collider->LocalOffset = Center;
+		Collider->BoxExtent = Extent;
+		return Collider;
+	}
+
+	/** Two characters (capsule legs and torso, sphere head), a floor slab, a disabled sphere and an empty slot */
+	TArray<TObjectPtr<UKawaiiFluidCollider>> MakeCharacterScene()
+	{
+		TArray<TObjectPtr<UKawaiiFluidCollider>> Colliders;
+		const FVector CharacterPositions[] = { FVector(-60.0, 0.0, 0.0), FVector(80.0, 40.0, 0.0) };
+		for (const FVector& Base : CharacterPositions)
+		{
+			AActor* Character = NewObject<AActor>();
+			Colliders.Add(AddCapsule(Character, Base + FVector(0.0, -12.0, 45.0), 35.0f, 10.0f));
+			Colliders.Add(AddCapsule(Character, Base + FVector(0.0, 12.0, 45.0), 35.0f, 10.0f));
+			Colliders.Add(AddCapsule(Character, Base + FVector(0.0, 0.0, 120.0), 30.0f, 22.0f));
+			Colliders.Add(AddSphere(Character, Base + FVector(0.0, 0.0, 175.0), 15.0f));
+		}
+
+		AActor* Floor = NewObject<AActor>();
+		Colliders.Add(AddBox(Floor, FVector(0.0, 0.0, -10.0), FVector(5000.0, 5000.0, 10.0)));
+
+		UKawaiiFluidSphereCollider* Disabled = AddSphere(NewObject<AActor>(), FVector(0.0, 0.0, 60.0), 40.0f);
+		Disabled->bColliderEnabled = false;
+		Colliders.Add(Disabled);
+		Colliders.Add(nullptr);
+		return Colliders;
+	}
+
+	TArray<FFluidParticle> MakePuddle(FRandomStream& Random, int32 Count)
+	{
+		TArray<FFluidParticle> Particles;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const FVector Position(Random.FRandRange(-150.0f, 150.0f), Random.FRandRange(-100.0f, 120.0f), Random.FRandRange(-5.0f, 200.0f));
+			FFluidParticle P(Position, i);
+			P.Velocity = FVector(Random.VRand()) * Random.FRandRange(0.0f, 200.0f);
+			P.bNearGround = (i % 7) == 0;
+			Particles.Add(P);
+		}
+		return Particles;
+	}
+
+	bool SameAdhesionState(const FFluidParticle& A, const FFluidParticle& B)
+	{
+		return A.Velocity == B.Velocity
+			&& A.bIsAttached == B.bIsAttached
+			&& A.AttachedActor == B.AttachedActor
+			&& A.AttachedBoneName == B.AttachedBoneName
+			&& A.AttachedOwnerID == B.AttachedOwnerID
+			&& A.AttachedBoneID == B.AttachedBoneID
+			&& A.AttachedLocalOffset == B.AttachedLocalOffset
+			&& A.AttachedSurfaceNormal == B.AttachedSurfaceNormal
+			&& A.bJustDetached == B.bJustDetached;
+	}
+}
+
+//=============================================================================
+// A-01: Broadphase Query
+// Candidates equal the colliders whose inflated bounds contain the point, in
+// array order; every collider within the margin is found, most are culled
+//=============================================================================
+bool FKawaiiFluidAdhesionTest_BroadphaseQuery::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(50);
+	const float Margin = 16.0f;
+
+	// Scattered small colliders plus the large floor slab (oversized: tested by every query)
+	TArray<TObjectPtr<UKawaiiFluidCollider>> Colliders = MakeCharacterScene();
+	for (int32 i = 0; i < 120; ++i)
+	{
+		const FVector Center(Random.FRandRange(-1500.0f, 1500.0f), Random.FRandRange(-1500.0f, 1500.0f), Random.FRandRange(0.0f, 400.0f));
+		Colliders.Add(AddSphere(NewObject<AActor>(), Center, Random.FRandRange(5.0f, 40.0f)));
+	}
+
+	FKawaiiFluidColliderBroadphase Broadphase;
+	Broadphase.Build(Colliders, Margin);
+	TestEqual(TEXT("Enabled colliders"), Broadphase.GetNumColliders(), Colliders.Num() - 2);
+	TestTrue(TEXT("Grid has cells"), Broadphase.GetNumCells() > 0);
+
+	bool bMatchesBounds = true;
+	bool bFindsAllInRange = true;
+	int64 TotalCandidates = 0;
+	const int32 NumQueries = 5000;
+	FKawaiiFluidColliderBroadphase::FCandidateList Candidates;
+	for (int32 q = 0; q < NumQueries; ++q)
+	{
+		const FVector Position(Random.FRandRange(-1600.0f, 1600.0f), Random.FRandRange(-1600.0f, 1600.0f), Random.FRandRange(-30.0f, 450.0f));
+		Broadphase.Query(Position, Candidates);
+		TotalCandidates += Candidates.Num();
+
+		TArray<int32> Expected;
+		for (int32 c = 0; c < Colliders.Num(); ++c)
+		{
+			const UKawaiiFluidCollider* Collider = Colliders[c];
+			if (!Collider || !Collider->IsColliderEnabled())
+			{
+				continue;
+			}
+
+			if (Collider->GetQueryBounds().ExpandBy(Margin).IsInsideOrOn(Position))
+			{
+				Expected.Add(c);
+			}
+
+			FVector ClosestPoint, Normal;
+			float Distance;
+			if (Collider->GetClosestPoint(Position, ClosestPoint, Normal, Distance) && Distance <= Margin)
+			{
+				bFindsAllInRange &= Candidates.Contains(c);
+			}
+		}
+		bMatchesBounds &= Candidates.Num() == Expected.Num() && FMemory::Memcmp(Candidates.GetData(), Expected.GetData(), Expected.Num() * sizeof(int32)) == 0;
+	}
+
+	TestTrue(TEXT("Candidates are the containing bounds in array order"), bMatchesBounds);
+	TestTrue(TEXT("Every collider within the margin is a candidate"), bFindsAllInRange);
+
+	const double AverageCandidates = static_cast<double>(TotalCandidates) / NumQueries;
+	TestTrue(FString::Printf(TEXT("Most colliders culled (%.2f of %d per query)"), AverageCandidates, Broadphase.GetNumColliders()), AverageCandidates < 3.0);
+
+	// Rebuild after moving every sphere: no stale cells
+	for (UKawaiiFluidCollider* Collider : Colliders)
+	{
+		if (UKawaiiFluidSphereCollider* Sphere = Cast<UKawaiiFluidSphereCollider>(Collider))
+		{
+			Sphere->LocalOffset += FVector(10000.0, 0.0, 0.0);
+		}
+	}
+	Broadphase.Build(Colliders, Margin);
+	Broadphase.Query(FVector(-60.0, 0.0, 175.0), Candidates);
+	TestTrue(TEXT("Moved head sphere no longer found"), !Candidates.Contains(3));
+	Broadphase.Query(FVector(9940.0, 0.0, 175.0), Candidates);
+	TestTrue(TEXT("Moved head sphere found at its new position"), Candidates.Contains(3));
+
+	return true;
+}
+
+//=============================================================================
+// A-02: Matches Brute Force
+// Several frames of adhesion over a puddle around two characters: broadphase
+// solver and brute-force solver leave every particle in the same state
+//=============================================================================
+bool FKawaiiFluidAdhesionTest_MatchesBruteForce::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(7);
+	const TArray<TObjectPtr<UKawaiiFluidCollider>> Colliders = MakeCharacterScene();
+	TArray<FFluidParticle> Broad = MakePuddle(Random, 3000);
+	TArray<FFluidParticle> Brute = Broad;
+
+	FAdhesionSolver BroadSolver;
+	FAdhesionSolver BruteSolver;
+	BruteSolver.SetUseColliderBroadphase(false);
+
+	const float DeltaTime = 1.0f / 60.0f;
+	int32 MaxAttached = 0;
+	bool bAllFramesMatch = true;
+	for (int32 Frame = 0; Frame < 6; ++Frame)
+	{
+		BroadSolver.Apply(Broad, Colliders, TestAdhesionStrength, TestAdhesionRadius, 0.0f, TestContactOffset);
+		BruteSolver.Apply(Brute, Colliders, TestAdhesionStrength, TestAdhesionRadius, 0.0f, TestContactOffset);
+
+		int32 Attached = 0;
+		int32 Mismatches = 0;
+		for (int32 i = 0; i < Broad.Num(); ++i)
+		{
+			Mismatches += SameAdhesionState(Broad[i], Brute[i]) ? 0 : 1;
+			Attached += Broad[i].bIsAttached ? 1 : 0;
+		}
+		bAllFramesMatch &= Mismatches == 0;
+		MaxAttached = FMath::Max(MaxAttached, Attached);
+		if (Mismatches > 0)
+		{
+			AddError(FString::Printf(TEXT("Frame %d: %d particles differ"), Frame, Mismatches));
+		}
+
+		// Same motion for both sets
+		for (int32 i = 0; i < Broad.Num(); ++i)
+		{
+			Broad[i].Position += Broad[i].Velocity * DeltaTime;
+			Brute[i].Position = Broad[i].Position;
+		}
+	}
+
+	TestTrue(TEXT("Broadphase matches brute force on every frame"), bAllFramesMatch);
+	TestTrue(FString::Printf(TEXT("Particles attached (%d)"), MaxAttached), MaxAttached > 0);
+
+	return true;
+}
+
+//=============================================================================
+// A-03: Attachment IDs
+// Colliders of one actor share an owner ID that resolves to the actor, IDs
+// stay stable as actors are added, detaching clears them, and stack pressure
+// only transfers weight between particles with the same owner ID
+//=============================================================================
+bool FKawaiiFluidAdhesionTest_AttachmentIDs::RunTest(const FString& Parameters)
+{
+	AActor* ActorA = NewObject<AActor>();
+	AActor* ActorB = NewObject<AActor>();
+	TArray<TObjectPtr<UKawaiiFluidCollider>> Colliders;
+	Colliders.Add(AddSphere(ActorA, FVector(0.0, 0.0, 0.0), 20.0f));
+	Colliders.Add(AddSphere(ActorA, FVector(0.0, 200.0, 0.0), 20.0f));
+	Colliders.Add(AddSphere(ActorB, FVector(400.0, 0.0, 0.0), 20.0f));
+
+	// One particle just outside each sphere
+	TArray<FFluidParticle> Particles;
+	Particles.Add(FFluidParticle(FVector(0.0, 0.0, 23.0), 0));
+	Particles.Add(FFluidParticle(FVector(0.0, 200.0, 23.0), 1));
+	Particles.Add(FFluidParticle(FVector(400.0, 0.0, 23.0), 2));
+	Particles.Add(FFluidParticle(FVector(1000.0, 0.0, 0.0), 3));
+
+	FAdhesionSolver Solver;
+	Solver.Apply(Particles, Colliders, TestAdhesionStrength, TestAdhesionRadius, 0.0f, 0.0f);
+
+	TestTrue(TEXT("Particles near colliders attach"), Particles[0].bIsAttached && Particles[1].bIsAttached && Particles[2].bIsAttached);
+	TestFalse(TEXT("Far particle stays free"), Particles[3].bIsAttached);
+	TestEqual(TEXT("Free particle has no owner ID"), Particles[3].AttachedOwnerID, INDEX_NONE);
+	TestEqual(TEXT("Same actor: same owner ID"), Particles[0].AttachedOwnerID, Particles[1].AttachedOwnerID);
+	TestTrue(TEXT("Different actors: different owner IDs"), Particles[0].AttachedOwnerID != Particles[2].AttachedOwnerID);
+	TestTrue(TEXT("Owner ID resolves to actor A"), Solver.GetAttachmentOwner(Particles[0].AttachedOwnerID) == ActorA);
+	TestTrue(TEXT("Owner ID resolves to actor B"), Solver.GetAttachmentOwner(Particles[2].AttachedOwnerID) == ActorB);
+	TestTrue(TEXT("Weak pointer kept for consumers"), Particles[2].AttachedActor.Get() == ActorB);
+	TestTrue(TEXT("Bone ID resolves to the bone name"), Solver.GetAttachmentBone(Particles[0].AttachedBoneID) == Particles[0].AttachedBoneName);
+
+	// A new actor in front of the list does not renumber the existing ones
+	const int32 OwnerA = Particles[0].AttachedOwnerID;
+	const int32 OwnerB = Particles[2].AttachedOwnerID;
+	Colliders.Insert(AddSphere(NewObject<AActor>(), FVector(-400.0, 0.0, 0.0), 20.0f), 0);
+	Particles[2].Position = FVector(400.0, 0.0, 1000.0);
+	Solver.Apply(Particles, Colliders, TestAdhesionStrength, TestAdhesionRadius, 0.0f, 0.0f);
+
+	TestEqual(TEXT("Owner ID stable across calls"), Particles[0].AttachedOwnerID, OwnerA);
+	TestFalse(TEXT("Particle moved away detaches"), Particles[2].bIsAttached);
+	TestEqual(TEXT("Detached: owner ID cleared"), Particles[2].AttachedOwnerID, INDEX_NONE);
+	TestEqual(TEXT("Detached: bone ID cleared"), Particles[2].AttachedBoneID, INDEX_NONE);
+	TestTrue(TEXT("Detached: actor cleared"), !Particles[2].AttachedActor.IsValid());
+	TestTrue(TEXT("Retired owner ID still resolves"), Solver.GetAttachmentOwner(OwnerB) == ActorB);
+	TestTrue(TEXT("Unknown IDs resolve to nothing"), Solver.GetAttachmentOwner(INDEX_NONE) == nullptr && Solver.GetAttachmentBone(1000) == NAME_None);
+
+	// A destroyed actor leaves the table on the next call; its ID is not handed out again
+	const int32 NumOwnersBefore = Solver.GetNumAttachmentOwners();
+	Colliders.Pop();
+	ActorB->MarkAsGarbage();
+	Solver.Apply(Particles, Colliders, TestAdhesionStrength, TestAdhesionRadius, 0.0f, 0.0f);
+	TestEqual(TEXT("Destroyed actor pruned"), Solver.GetNumAttachmentOwners(), NumOwnersBefore - 1);
+	TestTrue(TEXT("Pruned owner ID resolves to nothing"), Solver.GetAttachmentOwner(OwnerB) == nullptr);
+
+	AActor* ActorC = NewObject<AActor>();
+	Colliders.Add(AddSphere(ActorC, FVector(400.0, 0.0, 0.0), 20.0f));
+	Particles[2].Position = FVector(400.0, 0.0, 23.0);
+	Solver.Apply(Particles, Colliders, TestAdhesionStrength, TestAdhesionRadius, 0.0f, 0.0f);
+	TestTrue(TEXT("New actor gets a fresh owner ID"), Particles[2].bIsAttached && Particles[2].AttachedOwnerID != OwnerB);
+
+	// Every detach path goes through ClearAttachment
+	FFluidParticle Cleared = Particles[2];
+	Cleared.ClearAttachment();
+	TestTrue(TEXT("ClearAttachment drops the IDs"), !Cleared.bIsAttached && Cleared.AttachedOwnerID == INDEX_NONE && Cleared.AttachedBoneID == INDEX_NONE
+		&& !Cleared.AttachedActor.IsValid() && Cleared.AttachedBoneName == NAME_None);
+
+	// Stack pressure on a vertical wall: the upper particle only loads the lower one with the same owner
+	const FVector Gravity(0.0, 0.0, -980.0);
+	FStackPressureSolver StackPressure;
+	for (int32 OwnerOfUpper : { 0, 1 })
+	{
+		TArray<FFluidParticle> Stack;
+		Stack.Add(FFluidParticle(FVector(0.0, 0.0, 0.0), 0));
+		Stack.Add(FFluidParticle(FVector(0.0, 0.0, 5.0), 1));
+		for (FFluidParticle& P : Stack)
+		{
+			P.bIsAttached = true;
+			P.AttachedSurfaceNormal = FVector(1.0, 0.0, 0.0);
+			P.NeighborIndices = { 0, 1 };
+		}
+		Stack[0].AttachedOwnerID = 0;
+		Stack[1].AttachedOwnerID = OwnerOfUpper;
+
+		StackPressure.Apply(Stack, Gravity, 1.0f, 20.0f, 1.0f / 60.0f);
+		if (OwnerOfUpper == 0)
+		{
+			TestTrue(TEXT("Same owner: lower particle pushed down"), Stack[0].Velocity.Z < 0.0);
+		}
+		else
+		{
+			TestTrue(TEXT("Different owner: no weight transfer"), Stack[0].Velocity.IsZero());
+		}
+		TestTrue(TEXT("Upper particle carries no weight"), Stack[1].Velocity.IsZero());
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
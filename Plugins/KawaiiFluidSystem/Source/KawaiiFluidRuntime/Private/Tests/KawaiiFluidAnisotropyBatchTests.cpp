@@ -0,0 +1,498 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Batch CPU Anisotropy Unit Tests
+// Symmetric eigen accuracy, degenerate neighborhoods, orientation consistency, and batch vs reference
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Core/KawaiiFluidAnisotropyBatch.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAnisotropyBatchTest_EigenAccuracy,
+	"KawaiiFluid.Core.AnisotropyBatch.B01_EigenAccuracy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAnisotropyBatchTest_DegenerateCases,
+	"KawaiiFluid.Core.AnisotropyBatch.B02_DegenerateCases",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAnisotropyBatchTest_OrientationConsistency,
+	"KawaiiFluid.Core.AnisotropyBatch.B03_OrientationConsistency",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAnisotropyBatchTest_MatchesReference,
+	"KawaiiFluid.Core.AnisotropyBatch.B04_MatchesReference",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float TestSmoothingRadius = 20.0f;
+
+	/** Spacing with at most ~22 kernel neighbors, so the MaxCachedNeighbors subset is the full set */
+	constexpr float SparseSpacing = 12.0f;
+
+	/** Symmetric 3x3 as a plain row-major array */
+	struct FTestMatrix
+	{
+		float M[3][3] = {};
+	};
+
+	FQuat4f RandomRotation(FRandomStream& Random)
+	{
+		return FQuat4f(FVector3f(Random.GetUnitVector()), Random.FRandRange(0.0f, 2.0f * PI));
+	}
+
+	FKawaiiFluidCovariance ToCovariance(const FTestMatrix& A)
+	{
+		FKawaiiFluidCovariance Covariance;
+		Covariance.XX = A.M[0][0]; Covariance.XY = A.M[0][1]; Covariance.XZ = A.M[0][2];
+		Covariance.YY = A.M[1][1]; Covariance.YZ = A.M[1][2];
+		Covariance.ZZ = A.M[2][2];
+		return Covariance;
+	}
+
+	/** Sum of Scale * Axis * Axis^T: independent of axis signs and of the basis inside repeated eigenvalues */
+	FTestMatrix ShapeTensor(const FKawaiiFluidEllipsoid& Ellipsoid)
+	{
+		FTestMatrix Tensor;
+		for (int32 k = 0; k < 3; ++k)
+		{
+			const FVector3f Axis(Ellipsoid.Axes[k]);
+			for (int32 r = 0; r < 3; ++r)
+			{
+				for (int32 c = 0; c < 3; ++c)
+				{
+					Tensor.M[r][c] += Ellipsoid.Axes[k].W * Axis[r] * Axis[c];
+				}
+			}
+		}
+		return Tensor;
+	}
+
+	/** R A R^T, R's columns being the rotated basis vectors */
+	FTestMatrix Rotate(const FTestMatrix& A, const FQuat4f& Rotation)
+	{
+		const FVector3f Basis[3] = {
+			Rotation.RotateVector(FVector3f(1.0f, 0.0f, 0.0f)),
+			Rotation.RotateVector(FVector3f(0.0f, 1.0f, 0.0f)),
+			Rotation.RotateVector(FVector3f(0.0f, 0.0f, 1.0f))
+		};
+
+		FTestMatrix Result;
+		for (int32 r = 0; r < 3; ++r)
+		{
+			for (int32 c = 0; c < 3; ++c)
+			{
+				for (int32 i = 0; i < 3; ++i)
+				{
+					for (int32 j = 0; j < 3; ++j)
+					{
+						Result.M[r][c] += Basis[i][r] * A.M[i][j] * Basis[j][c];
+					}
+				}
+			}
+		}
+		return Result;
+	}
+
+	float MaxDifference(const FTestMatrix& A, const FTestMatrix& B)
+	{
+		float MaxError = 0.0f;
+		for (int32 r = 0; r < 3; ++r)
+		{
+			for (int32 c = 0; c < 3; ++c)
+			{
+				MaxError = FMath::Max(MaxError, FMath::Abs(A.M[r][c] - B.M[r][c]));
+			}
+		}
+		return MaxError;
+	}
+
+	bool IsFiniteOrthonormal(const FKawaiiFluidEllipsoid& Ellipsoid)
+	{
+		for (int32 i = 0; i < 3; ++i)
+		{
+			const FVector4f& Axis = Ellipsoid.Axes[i];
+			if (!FMath::IsFinite(Axis.X) || !FMath::IsFinite(Axis.Y) || !FMath::IsFinite(Axis.Z) || !FMath::IsFinite(Axis.W))
+			{
+				return false;
+			}
+			if (!FMath::IsNearlyEqual(FVector3f(Axis).Size(), 1.0f, 1e-3f))
+			{
+				return false;
+			}
+			for (int32 j = i + 1; j < 3; ++j)
+			{
+				if (FMath::Abs(FVector3f::DotProduct(FVector3f(Axis), FVector3f(Ellipsoid.Axes[j]))) > 1e-3f)
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * Count^3 cubic lattice from Origin with jitter (fraction of the spacing)
+	 * Without jitter every neighbor distance is 0, s or s*sqrt(2) for s = SparseSpacing, far from
+	 * the kernel cutoff, so rounding (rotation, world offset) cannot change a neighbor count
+	 */
+	TArray<FVector3f> MakeBlock(FRandomStream& Random, int32 Count, float Spacing, float Jitter, const FVector3f& Origin)
+	{
+		TArray<FVector3f> Positions;
+		for (int32 z = 0; z < Count; ++z)
+		{
+			for (int32 y = 0; y < Count; ++y)
+			{
+				for (int32 x = 0; x < Count; ++x)
+				{
+					const FVector3f Offset(Random.FRandRange(-Jitter, Jitter), Random.FRandRange(-Jitter, Jitter), Random.FRandRange(-Jitter, Jitter));
+					Positions.Add(Origin + (FVector3f(x, y, z) + Offset) * Spacing);
+				}
+			}
+		}
+		return Positions;
+	}
+}
+
+//=============================================================================
+// B-01: Eigen Accuracy
+// R diag(L) R^T for random rotations and spectra with distinct, repeated,
+// widely spread and zero eigenvalues: descending values, orthonormal vectors,
+// exact reconstruction, and vectors along R where the eigenvalue is isolated
+//=============================================================================
+bool FKawaiiFluidAnisotropyBatchTest_EigenAccuracy::RunTest(const FString& Parameters)
+{
+	const FVector3f Spectra[] = {
+		FVector3f(9.0f, 4.0f, 1.0f),
+		FVector3f(1.0f, 1.0f, 0.25f),		// sheet: repeated top pair
+		FVector3f(4.0f, 1.0f, 1.0f),		// line: repeated bottom pair
+		FVector3f(100.0f, 99.0f, 1.0f),		// nearly repeated
+		FVector3f(1.0f, 0.01f, 0.0001f),	// 4 decades
+		FVector3f(1.0f, 1.0f, 0.0f),		// flat, rank 2
+		FVector3f(1.0f, 0.0f, 0.0f),		// collinear, rank 1
+		FVector3f(2.0f, 2.0f, 2.0f),		// isotropic
+		FVector3f(1e-3f, 5e-4f, 1e-4f)		// small magnitudes
+	};
+
+	FRandomStream Random(47);
+	float WorstReconstruction = 0.0f;
+	float WorstOrthonormality = 0.0f;
+	float WorstValue = 0.0f;
+	float WorstAlignment = 1.0f;
+	bool bDescending = true;
+
+	for (const FVector3f& Spectrum : Spectra)
+	{
+		for (int32 Trial = 0; Trial < 64; ++Trial)
+		{
+			const FQuat4f Rotation = RandomRotation(Random);
+			const FVector3f Basis[3] = {
+				Rotation.RotateVector(FVector3f(1.0f, 0.0f, 0.0f)),
+				Rotation.RotateVector(FVector3f(0.0f, 1.0f, 0.0f)),
+				Rotation.RotateVector(FVector3f(0.0f, 0.0f, 1.0f))
+			};
+
+			FTestMatrix A;
+			for (int32 k = 0; k < 3; ++k)
+			{
+				for (int32 r = 0; r < 3; ++r)
+				{
+					for (int32 c = 0; c < 3; ++c)
+					{
+						A.M[r][c] += Spectrum[k] * Basis[k][r] * Basis[k][c];
+					}
+				}
+			}
+
+			FVector3f Values;
+			FVector3f Vectors[3];
+			FKawaiiFluidAnisotropyScheduler::SymmetricEigen(ToCovariance(A), Values, Vectors);
+
+			const float Norm = Spectrum[0];
+			bDescending &= Values[0] >= Values[1] && Values[1] >= Values[2];
+
+			FTestMatrix Rebuilt;
+			for (int32 k = 0; k < 3; ++k)
+			{
+				WorstValue = FMath::Max(WorstValue, FMath::Abs(Values[k] - Spectrum[k]) / Norm);
+				for (int32 r = 0; r < 3; ++r)
+				{
+					for (int32 c = 0; c < 3; ++c)
+					{
+						Rebuilt.M[r][c] += Values[k] * Vectors[k][r] * Vectors[k][c];
+					}
+				}
+
+				WorstOrthonormality = FMath::Max(WorstOrthonormality, FMath::Abs(Vectors[k].Size() - 1.0f));
+				for (int32 j = k + 1; j < 3; ++j)
+				{
+					WorstOrthonormality = FMath::Max(WorstOrthonormality, FMath::Abs(FVector3f::DotProduct(Vectors[k], Vectors[j])));
+				}
+
+				// Direction is only defined for an isolated eigenvalue
+				const bool bIsolated = (k == 0 || Spectrum[k - 1] - Spectrum[k] > 0.05f * Norm)
+					&& (k == 2 || Spectrum[k] - Spectrum[k + 1] > 0.05f * Norm);
+				if (bIsolated)
+				{
+					WorstAlignment = FMath::Min(WorstAlignment, FMath::Abs(FVector3f::DotProduct(Vectors[k], Basis[k])));
+				}
+			}
+			WorstReconstruction = FMath::Max(WorstReconstruction, MaxDifference(Rebuilt, A) / Norm);
+		}
+	}
+
+	TestTrue(TEXT("Eigenvalues descending"), bDescending);
+	TestTrue(FString::Printf(TEXT("Eigenvalue error %.2e < 1e-3"), WorstValue), WorstValue < 1e-3f);
+	TestTrue(FString::Printf(TEXT("Reconstruction error %.2e < 1e-3"), WorstReconstruction), WorstReconstruction < 1e-3f);
+	TestTrue(FString::Printf(TEXT("Orthonormality error %.2e < 1e-4"), WorstOrthonormality), WorstOrthonormality < 1e-4f);
+	TestTrue(FString::Printf(TEXT("Isolated eigenvectors along the basis (worst |dot| %.5f)"), WorstAlignment), WorstAlignment > 0.999f);
+
+	return true;
+}
+
+//=============================================================================
+// B-02: Degenerate Cases
+// Empty input, isolated and coincident particles, a line, a square-lattice
+// sheet (repeated top eigenvalues) and non-finite positions all give finite
+// orthonormal ellipsoids within the stretch limits
+//=============================================================================
+bool FKawaiiFluidAnisotropyBatchTest_DegenerateCases::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidAnisotropySettings Settings;
+	Settings.SmoothingRadius = TestSmoothingRadius;
+
+	FKawaiiFluidAnisotropyBatch Batch;
+	TArray<FKawaiiFluidEllipsoid> Ellipsoids;
+	TArray<uint32> NeighborCounts;
+
+	Batch.Compute(TArray<FVector3f>(), Settings, Ellipsoids, &NeighborCounts);
+	TestEqual(TEXT("Empty: no output"), Ellipsoids.Num(), 0);
+
+	// Isolated particle and a distant pair stay spheres
+	const TArray<FVector3f> Sparse = { FVector3f(0.0f), FVector3f(500.0f, 0.0f, 0.0f), FVector3f(505.0f, 0.0f, 0.0f) };
+	Batch.Compute(Sparse, Settings, Ellipsoids, &NeighborCounts);
+	TestEqual(TEXT("Isolated: only itself"), NeighborCounts[0], 1u);
+	TestEqual(TEXT("Pair: two neighbors"), NeighborCounts[1], 2u);
+	TestTrue(TEXT("Sparse: spheres"), MaxDifference(ShapeTensor(Ellipsoids[0]), ShapeTensor(FKawaiiFluidEllipsoid())) < 1e-6f
+		&& MaxDifference(ShapeTensor(Ellipsoids[1]), ShapeTensor(FKawaiiFluidEllipsoid())) < 1e-6f);
+
+	// Coincident particles: zero covariance is a unit sphere, not NaN
+	TArray<FVector3f> Coincident;
+	Coincident.Init(FVector3f(30.0f, -10.0f, 5.0f), 8);
+	Batch.Compute(Coincident, Settings, Ellipsoids, &NeighborCounts);
+	TestEqual(TEXT("Coincident: all neighbors"), NeighborCounts[0], 8u);
+	TestTrue(TEXT("Coincident: unit sphere"), IsFiniteOrthonormal(Ellipsoids[0])
+		&& MaxDifference(ShapeTensor(Ellipsoids[0]), ShapeTensor(FKawaiiFluidEllipsoid())) < 1e-4f);
+
+	// Collinear: rank-1 covariance
+	const FVector3f LineDirection = FVector3f(1.0f, -2.0f, 0.5f).GetSafeNormal();
+	TArray<FVector3f> Line;
+	for (int32 i = -4; i <= 4; ++i)
+	{
+		Line.Add(LineDirection * (4.0f * i));
+	}
+	Batch.Compute(Line, Settings, Ellipsoids);
+	const FKawaiiFluidEllipsoid& LineCenter = Ellipsoids[4];
+	TestTrue(TEXT("Line: finite orthonormal"), IsFiniteOrthonormal(LineCenter));
+	TestTrue(TEXT("Line: long axis along the line"), FMath::Abs(FVector3f::DotProduct(FVector3f(LineCenter.Axes[0]), LineDirection)) > 0.99f);
+	bool bWithinLimits = true;
+	for (int32 k = 0; k < 3; ++k)
+	{
+		bWithinLimits &= LineCenter.Axes[k].W >= Settings.MinStretch - 1e-4f && LineCenter.Axes[k].W <= Settings.MaxStretch + 1e-4f;
+	}
+	TestTrue(TEXT("Line: scales within stretch limits"), bWithinLimits);
+
+	// Square lattice sheet: the in-plane eigenvalues are equal, the normal must still be exact
+	// (spacing 8 keeps the center at 21 neighbors, all of them in the covariance)
+	const FQuat4f SheetRotation(FVector3f(0.3f, 1.0f, -0.4f).GetSafeNormal(), 1.1f);
+	const FVector3f Normal = SheetRotation.RotateVector(FVector3f(0.0f, 0.0f, 1.0f));
+	TArray<FVector3f> Sheet;
+	for (int32 y = -4; y <= 4; ++y)
+	{
+		for (int32 x = -4; x <= 4; ++x)
+		{
+			Sheet.Add(SheetRotation.RotateVector(FVector3f(x * 8.0f, y * 8.0f, 0.0f)));
+		}
+	}
+	Batch.Compute(Sheet, Settings, Ellipsoids);
+	const FKawaiiFluidEllipsoid& SheetCenter = Ellipsoids[Sheet.Num() / 2];
+	TestTrue(TEXT("Sheet: finite orthonormal"), IsFiniteOrthonormal(SheetCenter));
+	TestTrue(TEXT("Sheet: short axis along the normal"), FMath::Abs(FVector3f::DotProduct(FVector3f(SheetCenter.Axes[2]), Normal)) > 0.999f);
+	TestTrue(TEXT("Sheet: equal in-plane scales"), FMath::IsNearlyEqual(SheetCenter.Axes[0].W, SheetCenter.Axes[1].W, 1e-3f));
+
+	// Non-finite positions get a sphere and do not disturb their neighbors
+	TArray<FVector3f> WithInvalid = Line;
+	WithInvalid.Add(FVector3f(NAN, 0.0f, 0.0f));
+	WithInvalid.Add(FVector3f(INFINITY, 0.0f, 0.0f));
+	TArray<FKawaiiFluidEllipsoid> Reference;
+	Batch.Compute(Line, Settings, Reference);
+	Batch.Compute(WithInvalid, Settings, Ellipsoids, &NeighborCounts);
+	TestTrue(TEXT("NaN: sphere"), MaxDifference(ShapeTensor(Ellipsoids[Line.Num()]), ShapeTensor(FKawaiiFluidEllipsoid())) < 1e-6f);
+	bool bUnchanged = true;
+	for (int32 i = 0; i < Line.Num(); ++i)
+	{
+		bUnchanged &= MaxDifference(ShapeTensor(Ellipsoids[i]), ShapeTensor(Reference[i])) < 1e-6f;
+	}
+	TestTrue(TEXT("Invalid positions: neighbors unchanged"), bUnchanged);
+
+	return true;
+}
+
+//=============================================================================
+// B-03: Orientation Consistency
+// Sheets keep their short axis on the normal under any rotation, rotating a
+// blob rotates every ellipsoid with it, and instance transforms map the unit
+// mesh axes onto the scaled ellipsoid axes
+//=============================================================================
+bool FKawaiiFluidAnisotropyBatchTest_OrientationConsistency::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidAnisotropySettings Settings;
+	Settings.SmoothingRadius = TestSmoothingRadius;
+
+	FKawaiiFluidAnisotropyBatch Batch;
+	TArray<FKawaiiFluidEllipsoid> Ellipsoids;
+	TArray<uint32> NeighborCounts;
+	FRandomStream Random(1047);
+
+	// Hexagonal sheet under random rotations: every well-supported particle faces the normal
+	float WorstNormal = 1.0f;
+	for (int32 Trial = 0; Trial < 8; ++Trial)
+	{
+		const FQuat4f Rotation = RandomRotation(Random);
+		const FVector3f Normal = Rotation.RotateVector(FVector3f(0.0f, 0.0f, 1.0f));
+
+		TArray<FVector3f> Sheet;
+		for (int32 Row = -6; Row <= 6; ++Row)
+		{
+			for (int32 Column = -6; Column <= 6; ++Column)
+			{
+				const FVector3f Local((Column + 0.5f * (Row & 1)) * 6.0f, Row * 6.0f * 0.8660254f, 0.0f);
+				Sheet.Add(Rotation.RotateVector(Local) + FVector3f(100.0f, -50.0f, 20.0f));
+			}
+		}
+
+		Batch.Compute(Sheet, Settings, Ellipsoids, &NeighborCounts);
+		for (int32 i = 0; i < Sheet.Num(); ++i)
+		{
+			if (NeighborCounts[i] >= static_cast<uint32>(FKawaiiFluidAnisotropyScheduler::FullNeighbors))
+			{
+				WorstNormal = FMath::Min(WorstNormal, FMath::Abs(FVector3f::DotProduct(FVector3f(Ellipsoids[i].Axes[2]), Normal)));
+			}
+		}
+	}
+	TestTrue(FString::Printf(TEXT("Sheet: short axis on the normal (worst |dot| %.5f)"), WorstNormal), WorstNormal > 0.99f);
+
+	// Rotating the particles about the blob center rotates every shape tensor: S' = R S R^T
+	// (faces, edges and corners of the block give flattened and stretched ellipsoids)
+	const TArray<FVector3f> Blob = MakeBlock(Random, 6, SparseSpacing, 0.0f, FVector3f::ZeroVector);
+	const FVector3f Center = FVector3f(2.5f * SparseSpacing);
+	const FQuat4f BlobRotation(FVector3f(-0.2f, 0.7f, 0.5f).GetSafeNormal(), 2.3f);
+
+	TArray<FVector3f> RotatedBlob;
+	for (const FVector3f& P : Blob)
+	{
+		RotatedBlob.Add(Center + BlobRotation.RotateVector(P - Center));
+	}
+
+	TArray<FKawaiiFluidEllipsoid> RotatedEllipsoids;
+	TArray<uint32> RotatedCounts;
+	Batch.Compute(Blob, Settings, Ellipsoids, &NeighborCounts);
+	Batch.Compute(RotatedBlob, Settings, RotatedEllipsoids, &RotatedCounts);
+
+	float WorstTensor = 0.0f;
+	bool bSameNeighbors = true;
+	for (int32 i = 0; i < Blob.Num(); ++i)
+	{
+		bSameNeighbors &= NeighborCounts[i] == RotatedCounts[i];
+		WorstTensor = FMath::Max(WorstTensor, MaxDifference(ShapeTensor(RotatedEllipsoids[i]), Rotate(ShapeTensor(Ellipsoids[i]), BlobRotation)));
+	}
+	TestTrue(TEXT("Rotated blob: same neighbor counts"), bSameNeighbors);
+	TestTrue(FString::Printf(TEXT("Rotated blob: shape tensors rotate (max error %.2e)"), WorstTensor), WorstTensor < 1e-2f);
+
+	// Instance transform: local X/Y/Z -> scaled axes (Z up to sign)
+	const FKawaiiFluidEllipsoid& Ellipsoid = Ellipsoids[Blob.Num() / 2];
+	const FTransform Transform = FKawaiiFluidAnisotropyBatch::MakeInstanceTransform(Blob[Blob.Num() / 2], Ellipsoid, 0.1f);
+	TestTrue(TEXT("Instance: location"), Transform.GetLocation().Equals(FVector(Blob[Blob.Num() / 2]), 1e-3));
+	const FVector LocalAxes[3] = { FVector::XAxisVector, FVector::YAxisVector, FVector::ZAxisVector };
+	for (int32 k = 0; k < 3; ++k)
+	{
+		const FVector Mapped = Transform.TransformVector(LocalAxes[k]);
+		const FVector Expected = FVector(FVector3f(Ellipsoid.Axes[k])) * (Ellipsoid.Axes[k].W * 0.1);
+		TestTrue(FString::Printf(TEXT("Instance: local axis %d maps to the scaled ellipsoid axis"), k),
+			Mapped.Equals(Expected, 1e-3) || (k == 2 && Mapped.Equals(-Expected, 1e-3)));
+	}
+
+	return true;
+}
+
+//=============================================================================
+// B-04: Matches Reference
+// The SIMD batch equals the scalar reference (ComputeAll) on a jittered blob,
+// is unaffected by a large world offset, and reuses its grid across calls
+//=============================================================================
+bool FKawaiiFluidAnisotropyBatchTest_MatchesReference::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidAnisotropySettings Settings;
+	Settings.SmoothingRadius = TestSmoothingRadius;
+
+	FRandomStream Random(2047);
+	const TArray<FVector3f> Blob = MakeBlock(Random, 8, SparseSpacing, 0.25f, FVector3f(-40.0f, 15.0f, 3.0f));
+
+	TArray<FKawaiiFluidEllipsoid> Reference;
+	TArray<uint32> ReferenceCounts;
+	FKawaiiFluidAnisotropyScheduler::ComputeAll(Blob, Settings, Reference, &ReferenceCounts);
+
+	FKawaiiFluidAnisotropyBatch Batch;
+	TArray<FKawaiiFluidEllipsoid> Ellipsoids;
+	TArray<uint32> NeighborCounts;
+	Batch.Compute(Blob, Settings, Ellipsoids, &NeighborCounts);
+
+	int32 CountMismatches = 0;
+	float WorstTensor = 0.0f;
+	for (int32 i = 0; i < Blob.Num(); ++i)
+	{
+		CountMismatches += NeighborCounts[i] != ReferenceCounts[i] ? 1 : 0;
+		WorstTensor = FMath::Max(WorstTensor, MaxDifference(ShapeTensor(Ellipsoids[i]), ShapeTensor(Reference[i])));
+	}
+	TestEqual(TEXT("Neighbor counts match the reference"), CountMismatches, 0);
+	TestTrue(FString::Printf(TEXT("Shape tensors match the reference (max error %.2e)"), WorstTensor), WorstTensor < 1e-3f);
+
+	// 500 m away from the origin: offsets are particle-relative, so the result barely moves
+	const TArray<FVector3f> Lattice = MakeBlock(Random, 6, SparseSpacing, 0.0f, FVector3f::ZeroVector);
+	const FVector3f WorldOffset(50000.0f, -30000.0f, 2000.0f);
+	TArray<FVector3f> FarLattice;
+	for (const FVector3f& P : Lattice)
+	{
+		FarLattice.Add(P + WorldOffset);
+	}
+
+	TArray<FKawaiiFluidEllipsoid> NearEllipsoids;
+	TArray<FKawaiiFluidEllipsoid> FarEllipsoids;
+	Batch.Compute(Lattice, Settings, NearEllipsoids);
+	Batch.Compute(FarLattice, Settings, FarEllipsoids);
+	float WorstFar = 0.0f;
+	for (int32 i = 0; i < Lattice.Num(); ++i)
+	{
+		WorstFar = FMath::Max(WorstFar, MaxDifference(ShapeTensor(FarEllipsoids[i]), ShapeTensor(NearEllipsoids[i])));
+	}
+	TestTrue(FString::Printf(TEXT("World offset: shape tensors unchanged (max error %.2e)"), WorstFar), WorstFar < 1e-2f);
+
+	// Reusing the batch object reproduces the first result exactly
+	TArray<FKawaiiFluidEllipsoid> Again;
+	Batch.Compute(Blob, Settings, Again);
+	bool bIdentical = true;
+	for (int32 i = 0; i < Blob.Num(); ++i)
+	{
+		for (int32 k = 0; k < 3; ++k)
+		{
+			bIdentical &= Again[i].Axes[k] == Ellipsoids[i].Axes[k];
+		}
+	}
+	TestTrue(TEXT("Reused batch: identical result"), bIdentical);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
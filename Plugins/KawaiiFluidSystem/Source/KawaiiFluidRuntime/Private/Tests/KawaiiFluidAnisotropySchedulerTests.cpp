@@ -0,0 +1,302 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Incremental Anisotropy Unit Tests
+// CPU reference for FluidAnisotropyCompute.usf: covariance axes, update triggers, and calm-region reuse
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Core/KawaiiFluidAnisotropyScheduler.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAnisotropyTest_CovarianceAxes,
+	"KawaiiFluid.Core.Anisotropy.A01_CovarianceAxes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAnisotropyTest_UpdateTriggers,
+	"KawaiiFluid.Core.Anisotropy.A02_UpdateTriggers",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAnisotropyTest_CalmRegionReuse,
+	"KawaiiFluid.Core.Anisotropy.A03_CalmRegionReuse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float TestSmoothingRadius = 20.0f;
+
+	/** Block of Count^3 particles with the given spacing, IDs continue from the existing ones */
+	void AddBlock(TArray<FVector3f>& Positions, TArray<int32>& ParticleIDs, const FVector3f& Origin, int32 Count, float Spacing)
+	{
+		for (int32 z = 0; z < Count; ++z)
+		{
+			for (int32 y = 0; y < Count; ++y)
+			{
+				for (int32 x = 0; x < Count; ++x)
+				{
+					ParticleIDs.Add(Positions.Num());
+					Positions.Add(Origin + FVector3f(x, y, z) * Spacing);
+				}
+			}
+		}
+	}
+
+	bool IsOrthonormal(const FKawaiiFluidEllipsoid& Ellipsoid)
+	{
+		for (int32 i = 0; i < 3; ++i)
+		{
+			const FVector3f A(Ellipsoid.Axes[i]);
+			if (!FMath::IsNearlyEqual(A.Size(), 1.0f, 1e-3f))
+			{
+				return false;
+			}
+			for (int32 j = i + 1; j < 3; ++j)
+			{
+				if (FMath::Abs(FVector3f::DotProduct(A, FVector3f(Ellipsoid.Axes[j]))) > 1e-3f)
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	bool IsSameEllipsoid(const FKawaiiFluidEllipsoid& A, const FKawaiiFluidEllipsoid& B, float Tolerance)
+	{
+		for (int32 i = 0; i < 3; ++i)
+		{
+			if (!A.Axes[i].Equals(B.Axes[i], Tolerance))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+//=============================================================================
+// A-01: Covariance Axes
+// A line of particles yields a long axis along the line, a sheet yields its
+// short axis along the normal; the eigen solver reconstructs its input
+//=============================================================================
+bool FKawaiiFluidAnisotropyTest_CovarianceAxes::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidAnisotropySettings Settings;
+	Settings.SmoothingRadius = TestSmoothingRadius;
+
+	const FQuat4f Rotation(FVector3f(1.0f, 2.0f, 3.0f).GetSafeNormal(), 0.7f);
+	const FVector3f U = Rotation.RotateVector(FVector3f(1.0f, 0.0f, 0.0f));
+	const FVector3f V = Rotation.RotateVector(FVector3f(0.0f, 1.0f, 0.0f));
+	const FVector3f N = Rotation.RotateVector(FVector3f(0.0f, 0.0f, 1.0f));
+
+	// Line along U
+	TArray<FVector3f> Line;
+	for (int32 i = -6; i <= 6; ++i)
+	{
+		Line.Add(U * (4.0f * i));
+	}
+	const FKawaiiFluidEllipsoid LineEllipsoid = FKawaiiFluidAnisotropyScheduler::ComputeDensityBased(FVector3f::ZeroVector, Line, Settings);
+	TestTrue(TEXT("Line: orthonormal axes"), IsOrthonormal(LineEllipsoid));
+	TestTrue(TEXT("Line: long axis along the line"), FMath::Abs(FVector3f::DotProduct(FVector3f(LineEllipsoid.Axes[0]), U)) > 0.99f);
+	TestTrue(TEXT("Line: stretched along the line"), LineEllipsoid.Axes[0].W > 1.0f && LineEllipsoid.Axes[2].W < 1.0f);
+
+	// Rectangular sheet spanned by U and V
+	TArray<FVector3f> Sheet;
+	for (int32 i = -4; i <= 4; ++i)
+	{
+		for (int32 j = -6; j <= 6; ++j)
+		{
+			Sheet.Add(U * (5.0f * i) + V * (3.0f * j));
+		}
+	}
+	const FKawaiiFluidEllipsoid SheetEllipsoid = FKawaiiFluidAnisotropyScheduler::ComputeDensityBased(FVector3f::ZeroVector, Sheet, Settings);
+	TestTrue(TEXT("Sheet: orthonormal axes"), IsOrthonormal(SheetEllipsoid));
+	TestTrue(TEXT("Sheet: short axis along the normal"), FMath::Abs(FVector3f::DotProduct(FVector3f(SheetEllipsoid.Axes[2]), N)) > 0.99f);
+	TestTrue(TEXT("Sheet: flattened along the normal"), SheetEllipsoid.Axes[2].W < SheetEllipsoid.Axes[1].W);
+
+	// Too few neighbors stays a sphere
+	const TArray<FVector3f> Sparse = { FVector3f::ZeroVector, U * 5.0f, V * 5.0f };
+	const FKawaiiFluidEllipsoid SparseEllipsoid = FKawaiiFluidAnisotropyScheduler::ComputeDensityBased(FVector3f::ZeroVector, Sparse, Settings);
+	TestTrue(TEXT("Sparse: sphere"), IsSameEllipsoid(SparseEllipsoid, FKawaiiFluidEllipsoid(), 0.0f));
+
+	// Eigen decomposition reproduces the matrix
+	FKawaiiFluidCovariance M;
+	M.XX = 4.0f; M.XY = 1.0f; M.XZ = -0.5f;
+	M.YY = 3.0f; M.YZ = 0.25f;
+	M.ZZ = 1.0f;
+
+	FVector3f Values;
+	FVector3f Vectors[3];
+	FKawaiiFluidAnisotropyScheduler::SymmetricEigen(M, Values, Vectors);
+	TestTrue(TEXT("Eigen: descending"), Values[0] >= Values[1] && Values[1] >= Values[2]);
+
+	float MaxError = 0.0f;
+	const float Original[3][3] = { { M.XX, M.XY, M.XZ }, { M.XY, M.YY, M.YZ }, { M.XZ, M.YZ, M.ZZ } };
+	for (int32 r = 0; r < 3; ++r)
+	{
+		for (int32 c = 0; c < 3; ++c)
+		{
+			float Rebuilt = 0.0f;
+			for (int32 k = 0; k < 3; ++k)
+			{
+				Rebuilt += Values[k] * Vectors[k][r] * Vectors[k][c];
+			}
+			MaxError = FMath::Max(MaxError, FMath::Abs(Rebuilt - Original[r][c]));
+		}
+	}
+	TestTrue(FString::Printf(TEXT("Eigen: V L V^T == M (max error %.2e)"), MaxError), MaxError < 1e-3f);
+
+	return true;
+}
+
+//=============================================================================
+// A-02: Update Triggers
+// Motion, neighbor count change, a foreign record and age each force a
+// recompute; small drift does not. Despawn compaction recomputes everyone
+//=============================================================================
+bool FKawaiiFluidAnisotropyTest_UpdateTriggers::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidAnisotropySchedule Schedule;
+	Schedule.MotionThreshold = 0.1f;
+	Schedule.NeighborThreshold = 2;
+	Schedule.MaxStaleFrames = 30;
+
+	FGPUAnisotropyHistory History;
+	History.RefPosition = FVector3f(10.0f, 0.0f, 0.0f);
+	History.ParticleID = 7;
+	History.PrevIndex = 3;
+	History.NeighborCount = 20;
+	History.FramesSinceUpdate = 0;
+
+	TestTrue(TEXT("Own record"), FKawaiiFluidAnisotropyScheduler::HasHistory(History, 7, 10));
+	TestFalse(TEXT("Foreign record"), FKawaiiFluidAnisotropyScheduler::HasHistory(History, 8, 10));
+	TestFalse(TEXT("Previous output too small"), FKawaiiFluidAnisotropyScheduler::HasHistory(History, 7, 3));
+	TestFalse(TEXT("Empty record"), FKawaiiFluidAnisotropyScheduler::HasHistory(FGPUAnisotropyHistory(), -1, 10));
+
+	auto Moved = [&](const FVector3f& Position, uint32 NeighborCount, bool bHasHistory = true)
+	{
+		return FKawaiiFluidAnisotropyScheduler::HasMoved(History, bHasHistory, Position, NeighborCount, Schedule, TestSmoothingRadius);
+	};
+
+	// Threshold = 0.1 * 20 = 2 cm
+	TestFalse(TEXT("Drift below threshold"), Moved(FVector3f(11.5f, 0.0f, 0.0f), 20));
+	TestTrue(TEXT("Motion above threshold"), Moved(FVector3f(10.0f, 2.5f, 0.0f), 20));
+	TestFalse(TEXT("Neighbor change below threshold"), Moved(History.RefPosition, 21));
+	TestTrue(TEXT("Neighbor gain"), Moved(History.RefPosition, 22));
+	TestTrue(TEXT("Neighbor loss"), Moved(History.RefPosition, 18));
+	TestTrue(TEXT("No history"), Moved(History.RefPosition, 20, false));
+
+	History.FramesSinceUpdate = 29;
+	TestFalse(TEXT("Not yet expired"), FKawaiiFluidAnisotropyScheduler::IsExpired(History, Schedule));
+	History.FramesSinceUpdate = 30;
+	TestTrue(TEXT("Expired"), FKawaiiFluidAnisotropyScheduler::IsExpired(History, Schedule));
+
+	// Despawn of the first particle shifts every index: no record matches its particle
+	FKawaiiFluidAnisotropySettings Settings;
+	Settings.SmoothingRadius = TestSmoothingRadius;
+
+	TArray<FVector3f> Positions;
+	TArray<int32> ParticleIDs;
+	AddBlock(Positions, ParticleIDs, FVector3f::ZeroVector, 4, 5.0f);
+
+	TArray<FKawaiiFluidEllipsoid> Full;
+	TArray<uint32> NeighborCounts;
+	FKawaiiFluidAnisotropyScheduler::ComputeAll(Positions, Settings, Full, &NeighborCounts);
+
+	TArray<FGPUAnisotropyHistory> Histories;
+	TArray<FKawaiiFluidEllipsoid> Ellipsoids;
+	FKawaiiFluidAnisotropyScheduler::UpdateIncremental(Positions, ParticleIDs, NeighborCounts, Settings, Schedule, Histories, Ellipsoids);
+
+	Positions.RemoveAt(0);
+	ParticleIDs.RemoveAt(0);
+	FKawaiiFluidAnisotropyScheduler::ComputeAll(Positions, Settings, Full, &NeighborCounts);
+	Histories.RemoveAt(Histories.Num() - 1);
+	const FKawaiiFluidAnisotropyPassStats Stats = FKawaiiFluidAnisotropyScheduler::UpdateIncremental(
+		Positions, ParticleIDs, NeighborCounts, Settings, Schedule, Histories, Ellipsoids);
+	TestEqual(TEXT("Compaction: every particle treated as new"), Stats.NumMoved, Positions.Num());
+
+	return true;
+}
+
+//=============================================================================
+// A-03: Calm Region Reuse
+// Two separated blocks: disturbing one recomputes only its particles, the
+// calm block keeps its ellipsoids, and the result matches a full pass.
+// Untouched ellipsoids are still refreshed after MaxStaleFrames passes
+//=============================================================================
+bool FKawaiiFluidAnisotropyTest_CalmRegionReuse::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidAnisotropySettings Settings;
+	Settings.SmoothingRadius = TestSmoothingRadius;
+
+	FKawaiiFluidAnisotropySchedule Schedule;
+	Schedule.MaxStaleFrames = 3;
+
+	TArray<FVector3f> Positions;
+	TArray<int32> ParticleIDs;
+	AddBlock(Positions, ParticleIDs, FVector3f::ZeroVector, 6, 5.0f);
+	const int32 NumCalm = Positions.Num();
+	AddBlock(Positions, ParticleIDs, FVector3f(400.0f, 0.0f, 0.0f), 6, 5.0f);
+	const int32 NumParticles = Positions.Num();
+
+	TArray<FKawaiiFluidEllipsoid> Full;
+	TArray<uint32> NeighborCounts;
+	TArray<FGPUAnisotropyHistory> Histories;
+	TArray<FKawaiiFluidEllipsoid> Ellipsoids;
+
+	auto RunPass = [&]()
+	{
+		FKawaiiFluidAnisotropyScheduler::ComputeAll(Positions, Settings, Full, &NeighborCounts);
+		return FKawaiiFluidAnisotropyScheduler::UpdateIncremental(Positions, ParticleIDs, NeighborCounts, Settings, Schedule, Histories, Ellipsoids);
+	};
+
+	auto MatchesFull = [&]()
+	{
+		for (int32 i = 0; i < NumParticles; ++i)
+		{
+			if (!IsSameEllipsoid(Ellipsoids[i], Full[i], 1e-4f))
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	FKawaiiFluidAnisotropyPassStats Stats = RunPass();
+	TestEqual(TEXT("First pass: full recompute"), Stats.NumRecomputed, NumParticles);
+	TestTrue(TEXT("First pass: matches full"), MatchesFull());
+
+	Stats = RunPass();
+	TestEqual(TEXT("Still water: nothing moved"), Stats.NumMoved, 0);
+	TestEqual(TEXT("Still water: nothing recomputed"), Stats.NumRecomputed, 0);
+
+	// Splash in the second block
+	const TArray<FKawaiiFluidEllipsoid> CalmBefore(Ellipsoids.GetData(), NumCalm);
+	for (int32 i = NumCalm; i < NumCalm + 6; ++i)
+	{
+		Positions[i] += FVector3f(0.0f, 0.0f, 0.5f * TestSmoothingRadius);
+	}
+
+	Stats = RunPass();
+	TestTrue(TEXT("Splash: displaced particles moved"), Stats.NumMoved >= 6);
+	TestTrue(TEXT("Splash: neighbors recomputed"), Stats.NumRecomputed > Stats.NumMoved);
+	TestTrue(TEXT("Splash: calm block untouched"), Stats.NumRecomputed <= NumParticles - NumCalm);
+	TestTrue(TEXT("Splash: matches full"), MatchesFull());
+
+	bool bCalmReused = true;
+	for (int32 i = 0; i < NumCalm; ++i)
+	{
+		bCalmReused &= IsSameEllipsoid(Ellipsoids[i], CalmBefore[i], 0.0f) && Histories[i].FramesSinceUpdate == 2;
+	}
+	TestTrue(TEXT("Splash: calm ellipsoids reused"), bCalmReused);
+
+	// Calm block reaches MaxStaleFrames after its third reuse
+	Stats = RunPass();
+	TestTrue(TEXT("Aging: calm block still reused"), Stats.NumRecomputed < NumCalm);
+	Stats = RunPass();
+	TestTrue(TEXT("Aging: calm block refreshed"), Stats.NumRecomputed >= NumCalm);
+	TestTrue(TEXT("Aging: matches full"), MatchesFull());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
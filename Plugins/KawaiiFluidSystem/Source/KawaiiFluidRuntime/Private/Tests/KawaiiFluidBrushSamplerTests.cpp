@@ -0,0 +1,275 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Brush Sampler Unit Tests
+// Poisson-disk spacing, seed determinism, empty-space filling, stroke coalescing
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Core/KawaiiFluidBrushSampler.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBrushSamplerTest_MinimumSpacing,
+	"KawaiiFluid.Core.BrushSampler.S01_MinimumSpacing",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBrushSamplerTest_Deterministic,
+	"KawaiiFluid.Core.BrushSampler.S02_Deterministic",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBrushSamplerTest_FillsOnlyEmptySpace,
+	"KawaiiFluid.Core.BrushSampler.S03_FillsOnlyEmptySpace",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBrushSamplerTest_StrokeCoalescing,
+	"KawaiiFluid.Core.BrushSampler.S04_StrokeCoalescing",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float TestSpacing = 10.0f;
+	constexpr float TestBrushRadius = 50.0f;
+
+	/** Large enough that no test hits the per-stroke cap */
+	constexpr int32 Unlimited = 100000;
+
+	/** Brute-force O(n^2) check: smallest distance between any two positions */
+	double MinPairDistance(const TArray<FVector>& Positions)
+	{
+		double MinDistSq = TNumericLimits<double>::Max();
+		for (int32 i = 0; i < Positions.Num(); ++i)
+		{
+			for (int32 j = i + 1; j < Positions.Num(); ++j)
+			{
+				MinDistSq = FMath::Min(MinDistSq, FVector::DistSquared(Positions[i], Positions[j]));
+			}
+		}
+		return FMath::Sqrt(MinDistSq);
+	}
+
+	/** Brute-force distance from P to the closest of Positions */
+	double NearestDistance(const FVector& P, const TArray<FVector>& Positions)
+	{
+		double MinDistSq = TNumericLimits<double>::Max();
+		for (const FVector& Q : Positions)
+		{
+			MinDistSq = FMath::Min(MinDistSq, FVector::DistSquared(P, Q));
+		}
+		return FMath::Sqrt(MinDistSq);
+	}
+
+	/** Grid of existing particles at the spacing covering the X < 0 half of a brush hemisphere */
+	TArray<FVector> MakeHalfFilledHemisphere(const FKawaiiFluidBrushSampleRegion& Region)
+	{
+		TArray<FVector> Positions;
+		const int32 Steps = FMath::CeilToInt(Region.Radius / TestSpacing);
+		for (int32 x = -Steps; x < 0; ++x)
+		{
+			for (int32 y = -Steps; y <= Steps; ++y)
+			{
+				for (int32 z = 0; z <= Steps; ++z)
+				{
+					const FVector P = Region.End + FVector(x, y, z) * TestSpacing + FVector(0.0, 0.0, 0.5 * TestSpacing);
+					if (Region.Contains(P))
+					{
+						Positions.Add(P);
+					}
+				}
+			}
+		}
+		return Positions;
+	}
+}
+
+//=============================================================================
+// S-01: Minimum Spacing
+// No two samples, and no sample and existing particle, are closer than the
+// spacing; every sample lies inside the region above the surface
+//=============================================================================
+bool FKawaiiFluidBrushSamplerTest_MinimumSpacing::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidBrushSampleRegion Region(FVector::ZeroVector, FVector::ZeroVector, TestBrushRadius, FVector::UpVector);
+	Region.MinHeight = 0.5f * TestSpacing;
+
+	TArray<FVector> Existing;
+	Existing.Add(FVector(0.0, 0.0, 20.0));
+	Existing.Add(FVector(15.0, -10.0, 8.0));
+	Existing.Add(FVector(-30.0, 5.0, 12.0));
+
+	FKawaiiFluidBrushSampler Sampler(TestSpacing);
+	Sampler.AddOccupied(Existing);
+
+	TArray<FVector> Samples;
+	const int32 NumSampled = Sampler.Sample(Region, Unlimited, 7, Samples);
+	AddInfo(FString::Printf(TEXT("%d samples in a %.0f cm hemisphere"), NumSampled, Region.Radius));
+
+	TestEqual(TEXT("Return value matches appended samples"), NumSampled, Samples.Num());
+	TestEqual(TEXT("Samples join the occupied set"), Sampler.NumOccupied(), Existing.Num() + Samples.Num());
+	TestTrue(TEXT("Hemisphere is filled with more than a handful of samples"), NumSampled > 50);
+
+	const double MinSampleDist = MinPairDistance(Samples);
+	AddInfo(FString::Printf(TEXT("Closest sample pair: %.3f cm"), MinSampleDist));
+	TestTrue(TEXT("Samples keep the spacing"), MinSampleDist >= TestSpacing - 1e-3);
+
+	bool bAllInside = true;
+	bool bAllClearOfExisting = true;
+	for (const FVector& S : Samples)
+	{
+		bAllInside &= Region.Contains(S);
+		bAllClearOfExisting &= NearestDistance(S, Existing) >= TestSpacing - 1e-3;
+	}
+	TestTrue(TEXT("Samples lie inside the region"), bAllInside);
+	TestTrue(TEXT("Samples keep the spacing to existing particles"), bAllClearOfExisting);
+
+	TArray<FVector> Capped;
+	FKawaiiFluidBrushSampler CappedSampler(TestSpacing);
+	TestEqual(TEXT("MaxSamples caps the stroke"), CappedSampler.Sample(Region, 15, 7, Capped), 15);
+
+	return true;
+}
+
+//=============================================================================
+// S-02: Deterministic
+// Same seed and occupied set reproduce the samples bit for bit; a different
+// seed produces a different set
+//=============================================================================
+bool FKawaiiFluidBrushSamplerTest_Deterministic::RunTest(const FString& Parameters)
+{
+	const FKawaiiFluidBrushSampleRegion Region(FVector(0.0, 0.0, 0.0), FVector(80.0, 20.0, 0.0), 30.0f, FVector::UpVector);
+
+	auto Run = [&Region](int32 Seed)
+	{
+		FKawaiiFluidBrushSampler Sampler(TestSpacing);
+		Sampler.AddOccupied(FVector(40.0, 10.0, 10.0));
+		TArray<FVector> Samples;
+		Sampler.Sample(Region, Unlimited, Seed, Samples);
+		return Samples;
+	};
+
+	const TArray<FVector> First = Run(1234);
+	const TArray<FVector> Second = Run(1234);
+	const TArray<FVector> Other = Run(4321);
+
+	TestTrue(TEXT("Produces samples"), First.Num() > 0);
+	TestEqual(TEXT("Same seed, same count"), Second.Num(), First.Num());
+
+	bool bIdentical = First.Num() == Second.Num();
+	for (int32 i = 0; bIdentical && i < First.Num(); ++i)
+	{
+		bIdentical = First[i] == Second[i];
+	}
+	TestTrue(TEXT("Same seed, identical samples"), bIdentical);
+
+	bool bDiffers = First.Num() != Other.Num();
+	for (int32 i = 0; !bDiffers && i < First.Num(); ++i)
+	{
+		bDiffers = First[i] != Other[i];
+	}
+	TestTrue(TEXT("Different seed, different samples"), bDiffers);
+
+	return true;
+}
+
+//=============================================================================
+// S-03: Fills Only Empty Space
+// With half the hemisphere already filled at the spacing, samples land only in
+// the empty half; a second pass over the same region adds nothing
+//=============================================================================
+bool FKawaiiFluidBrushSamplerTest_FillsOnlyEmptySpace::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidBrushSampleRegion Region(FVector::ZeroVector, FVector::ZeroVector, TestBrushRadius, FVector::UpVector);
+	Region.MinHeight = 0.5f * TestSpacing;
+
+	const TArray<FVector> Existing = MakeHalfFilledHemisphere(Region);
+	FKawaiiFluidBrushSampler Sampler(TestSpacing);
+	Sampler.AddOccupied(Existing);
+
+	TArray<FVector> Samples;
+	Sampler.Sample(Region, Unlimited, 99, Samples);
+	AddInfo(FString::Printf(TEXT("%d existing particles, %d samples added"), Existing.Num(), Samples.Num()));
+
+	TestTrue(TEXT("Empty half receives samples"), Samples.Num() > 20);
+
+	bool bAllInEmptyHalf = true;
+	for (const FVector& S : Samples)
+	{
+		// Existing grid occupies X <= -Spacing, so free space starts at X > -Spacing + Spacing
+		bAllInEmptyHalf &= S.X > -TestSpacing + 1e-3;
+	}
+	TestTrue(TEXT("No sample lands in the filled half"), bAllInEmptyHalf);
+
+	TArray<FVector> SecondPass;
+	const int32 NumSecond = Sampler.Sample(Region, Unlimited, 100, SecondPass);
+	AddInfo(FString::Printf(TEXT("Second pass over the filled region: %d samples"), NumSecond));
+	TestTrue(TEXT("Second pass over the filled region adds almost nothing"), NumSecond <= Samples.Num() / 20);
+
+	TArray<FVector> All = Existing;
+	All.Append(Samples);
+	All.Append(SecondPass);
+	TestTrue(TEXT("Combined set keeps the spacing"), MinPairDistance(All) >= TestSpacing - 1e-3);
+
+	return true;
+}
+
+//=============================================================================
+// S-04: Stroke Coalescing
+// A drag split into many overlapping strokes (each region from the previous
+// to the current brush position) fills the path like one capsule fill: the
+// spacing holds across strokes and the total count stays close
+//=============================================================================
+bool FKawaiiFluidBrushSamplerTest_StrokeCoalescing::RunTest(const FString& Parameters)
+{
+	const FVector PathStart(0.0, 0.0, 0.0);
+	const FVector PathEnd(200.0, 0.0, 0.0);
+	constexpr int32 NumStrokes = 20;
+	const float MinHeight = 0.5f * TestSpacing;
+
+	// One sampler carries the drag's samples across strokes (the editor passes them as ExtraOccupied)
+	FKawaiiFluidBrushSampler DragSampler(TestSpacing);
+	TArray<FVector> DragSamples;
+	FVector LastLocation = PathStart;
+	for (int32 Stroke = 0; Stroke <= NumStrokes; ++Stroke)
+	{
+		const FVector Location = FMath::Lerp(PathStart, PathEnd, static_cast<double>(Stroke) / NumStrokes);
+		FKawaiiFluidBrushSampleRegion Region(LastLocation, Location, TestBrushRadius, FVector::UpVector);
+		Region.MinHeight = MinHeight;
+		DragSampler.Sample(Region, Unlimited, Stroke, DragSamples);
+		LastLocation = Location;
+	}
+
+	FKawaiiFluidBrushSampleRegion Capsule(PathStart, PathEnd, TestBrushRadius, FVector::UpVector);
+	Capsule.MinHeight = MinHeight;
+	FKawaiiFluidBrushSampler SingleSampler(TestSpacing);
+	TArray<FVector> SingleSamples;
+	SingleSampler.Sample(Capsule, Unlimited, 0, SingleSamples);
+
+	AddInfo(FString::Printf(TEXT("%d strokes: %d samples, single capsule fill: %d samples"),
+		NumStrokes, DragSamples.Num(), SingleSamples.Num()));
+
+	TestTrue(TEXT("Spacing holds across strokes"), MinPairDistance(DragSamples) >= TestSpacing - 1e-3);
+	TestTrue(TEXT("Stroke count close to a single fill (no stacking)"),
+		FMath::Abs(DragSamples.Num() - SingleSamples.Num()) <= SingleSamples.Num() / 5);
+
+	// Coverage: every probe point in the capsule interior has a sample within 2 * spacing
+	FRandomStream Probe(42);
+	int32 NumUncovered = 0;
+	int32 NumProbes = 0;
+	const FBox Bounds = Capsule.GetBounds();
+	while (NumProbes < 500)
+	{
+		FVector P;
+		P.X = Probe.FRandRange(Bounds.Min.X, Bounds.Max.X);
+		P.Y = Probe.FRandRange(Bounds.Min.Y, Bounds.Max.Y);
+		P.Z = Probe.FRandRange(Bounds.Min.Z, Bounds.Max.Z);
+		if (!Capsule.Contains(P))
+		{
+			continue;
+		}
+		++NumProbes;
+		NumUncovered += NearestDistance(P, DragSamples) > 2.0 * TestSpacing ? 1 : 0;
+	}
+	TestEqual(TEXT("Stroke path is covered without gaps"), NumUncovered, 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
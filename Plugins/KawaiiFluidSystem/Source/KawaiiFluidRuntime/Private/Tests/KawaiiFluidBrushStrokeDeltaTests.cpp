@@ -0,0 +1,329 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Brush Stroke Delta Unit Tests
+// Add/remove undo-redo on a mock CPU volume, stroke sequences, record size and serialization
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Core/KawaiiFluidBrushStrokeDelta.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBrushStrokeDeltaTest_AddUndoRedo,
+	"KawaiiFluid.Core.BrushStrokeDelta.B01_AddUndoRedo",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBrushStrokeDeltaTest_RemoveUndoRedo,
+	"KawaiiFluid.Core.BrushStrokeDelta.B02_RemoveUndoRedo",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBrushStrokeDeltaTest_StrokeSequence,
+	"KawaiiFluid.Core.BrushStrokeDelta.B03_StrokeSequence",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBrushStrokeDeltaTest_RecordSize,
+	"KawaiiFluid.Core.BrushStrokeDelta.B04_RecordSize",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	struct FMockParticle
+	{
+		FVector3f Position;
+		FVector3f Velocity;
+		float Mass;
+
+		bool operator==(const FMockParticle& Other) const
+		{
+			return Position == Other.Position && Velocity == Other.Velocity && Mass == Other.Mass;
+		}
+	};
+
+	/** CPU stand-in for a volume: particles keyed by ID, counts batched calls */
+	class FMockParticleVolume : public IKawaiiFluidParticleEditTarget
+	{
+	public:
+		TMap<int32, FMockParticle> Particles;
+		int32 NextID = 0;
+		int32 SpawnCalls = 0;
+		int32 DespawnCalls = 0;
+		bool bHasData = true;
+
+		virtual int32 AllocateParticleIDs(int32 Count) override
+		{
+			const int32 FirstID = NextID;
+			NextID += Count;
+			return FirstID;
+		}
+
+		virtual void SpawnParticleBlock(const FKawaiiFluidParticleBlock& Block) override
+		{
+			++SpawnCalls;
+			for (int32 i = 0; i < Block.Num(); ++i)
+			{
+				Particles.Add(Block.ParticleIDs[i], { Block.Positions[i], Block.Velocities[i], Block.Mass });
+			}
+			NextID = FMath::Max(NextID, Block.GetMaxParticleID() + 1);
+		}
+
+		virtual void DespawnParticlesByID(TConstArrayView<int32> ParticleIDs) override
+		{
+			++DespawnCalls;
+			for (const int32 ParticleID : ParticleIDs)
+			{
+				Particles.Remove(ParticleID);
+			}
+		}
+
+		virtual bool CollectParticlesInSphere(const FVector& Center, float Radius, FKawaiiFluidParticleBlock& OutBlock) const override
+		{
+			OutBlock.Reset();
+			if (!bHasData)
+			{
+				return false;
+			}
+			OutBlock.Mass = 1.0f;
+			for (const TPair<int32, FMockParticle>& Pair : Particles)
+			{
+				if (FVector::DistSquared(FVector(Pair.Value.Position), Center) <= FMath::Square(Radius))
+				{
+					OutBlock.Add(Pair.Key, Pair.Value.Position, Pair.Value.Velocity);
+				}
+			}
+			return true;
+		}
+
+		/** Seed a jittered grid (IDs from the volume counter) */
+		void Fill(int32 GridSize, float Spacing, int32 Seed)
+		{
+			FRandomStream Random(Seed);
+			for (int32 x = 0; x < GridSize; ++x)
+			{
+				for (int32 y = 0; y < GridSize; ++y)
+				{
+					for (int32 z = 0; z < GridSize; ++z)
+					{
+						const FVector3f Jitter = FVector3f(Random.VRand()) * Spacing * 0.2f;
+						Particles.Add(NextID++, { FVector3f(x, y, z) * Spacing + Jitter, FVector3f(Random.VRand()) * 10.0f, 1.0f });
+					}
+				}
+			}
+		}
+	};
+
+	TArray<FVector> MakeStrokePositions(const FVector& Center, float Radius, int32 Count, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FVector> Positions;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Positions.Add(Center + Random.GetUnitVector() * Random.FRandRange(0.0f, Radius));
+		}
+		return Positions;
+	}
+
+	bool SameParticles(const TMap<int32, FMockParticle>& A, const TMap<int32, FMockParticle>& B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+		for (const TPair<int32, FMockParticle>& Pair : A)
+		{
+			const FMockParticle* Other = B.Find(Pair.Key);
+			if (!Other || !(*Other == Pair.Value))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+//=============================================================================
+// B-01: Add Undo/Redo
+// An add stroke records exactly its own block; undo despawns it and redo respawns
+// it with the same IDs, each as a single batched call
+//=============================================================================
+bool FKawaiiFluidBrushStrokeDeltaTest_AddUndoRedo::RunTest(const FString& Parameters)
+{
+	FMockParticleVolume Volume;
+	Volume.Fill(6, 10.0f, 1);
+	const TMap<int32, FMockParticle> Before = Volume.Particles;
+
+	const TArray<FVector> Positions = MakeStrokePositions(FVector(30.0), 15.0f, 50, 2);
+	FKawaiiFluidBrushStrokeDelta Delta;
+	TestTrue(TEXT("Add applied"), Delta.ApplyAdd(Volume, Positions, FVector(0.0, 0.0, -50.0), 1.5f));
+	TestEqual(TEXT("Recorded the stroke's block"), Delta.GetAdded().Num(), Positions.Num());
+	TestEqual(TEXT("Nothing recorded as removed"), Delta.GetRemoved().Num(), 0);
+	TestEqual(TEXT("Stroke spawned one batch"), Volume.SpawnCalls, 1);
+	TestEqual(TEXT("Volume grew by the stroke"), Volume.Particles.Num(), Before.Num() + Positions.Num());
+	const TMap<int32, FMockParticle> After = Volume.Particles;
+
+	Delta.Undo(Volume);
+	TestTrue(TEXT("Undo restores the previous particles"), SameParticles(Volume.Particles, Before));
+	TestEqual(TEXT("Undo is one despawn batch"), Volume.DespawnCalls, 1);
+
+	Delta.Redo(Volume);
+	TestTrue(TEXT("Redo restores the stroke (same IDs and state)"), SameParticles(Volume.Particles, After));
+	TestEqual(TEXT("Redo is one spawn batch"), Volume.SpawnCalls, 2);
+
+	// A target that cannot allocate IDs records nothing
+	struct FNoSimulator : FMockParticleVolume
+	{
+		virtual int32 AllocateParticleIDs(int32 Count) override { return INDEX_NONE; }
+	} NoSimulator;
+	FKawaiiFluidBrushStrokeDelta Failed;
+	TestFalse(TEXT("Add without IDs fails"), Failed.ApplyAdd(NoSimulator, Positions, FVector::ZeroVector, 1.0f));
+	TestTrue(TEXT("Failed add records nothing"), Failed.IsEmpty());
+
+	return true;
+}
+
+//=============================================================================
+// B-02: Remove Undo/Redo
+// A remove stroke despawns exactly the particles inside the sphere (brute-force
+// reference) by ID; undo brings back identical particles, redo removes them again
+//=============================================================================
+bool FKawaiiFluidBrushStrokeDeltaTest_RemoveUndoRedo::RunTest(const FString& Parameters)
+{
+	FMockParticleVolume Volume;
+	Volume.Fill(12, 8.0f, 3);
+	const TMap<int32, FMockParticle> Before = Volume.Particles;
+
+	const FVector Center(40.0, 44.0, 30.0);
+	const float Radius = 20.0f;
+	int32 ExpectedRemoved = 0;
+	for (const TPair<int32, FMockParticle>& Pair : Before)
+	{
+		ExpectedRemoved += FVector::DistSquared(FVector(Pair.Value.Position), Center) <= FMath::Square(Radius) ? 1 : 0;
+	}
+
+	FKawaiiFluidBrushStrokeDelta Delta;
+	TestTrue(TEXT("Remove applied"), Delta.ApplyRemove(Volume, Center, Radius));
+	TestTrue(TEXT("Brush touched particles"), ExpectedRemoved > 0);
+	TestEqual(TEXT("Recorded every particle in the sphere"), Delta.GetRemoved().Num(), ExpectedRemoved);
+	TestEqual(TEXT("Removed from the volume"), Volume.Particles.Num(), Before.Num() - ExpectedRemoved);
+	const TMap<int32, FMockParticle> After = Volume.Particles;
+
+	Delta.Undo(Volume);
+	TestTrue(TEXT("Undo restores removed particles exactly"), SameParticles(Volume.Particles, Before));
+
+	Delta.Redo(Volume);
+	TestTrue(TEXT("Redo removes them again"), SameParticles(Volume.Particles, After));
+
+	// No particle data: nothing removed, nothing recorded (caller falls back to an unrecorded brush)
+	Volume.bHasData = false;
+	FKawaiiFluidBrushStrokeDelta NoData;
+	TestFalse(TEXT("Remove without data fails"), NoData.ApplyRemove(Volume, Center, Radius));
+	TestTrue(TEXT("Failed remove records nothing"), NoData.IsEmpty());
+
+	return true;
+}
+
+//=============================================================================
+// B-03: Stroke Sequence
+// Interleaved add/remove strokes (removes also hit particles added by earlier
+// strokes). Undoing all strokes in reverse and redoing them in order reproduces
+// every intermediate state.
+//=============================================================================
+bool FKawaiiFluidBrushStrokeDeltaTest_StrokeSequence::RunTest(const FString& Parameters)
+{
+	FMockParticleVolume Volume;
+	Volume.Fill(8, 10.0f, 5);
+
+	FRandomStream Random(7);
+	TArray<FKawaiiFluidBrushStrokeDelta> Strokes;
+	TArray<TMap<int32, FMockParticle>> States;
+	States.Add(Volume.Particles);
+
+	constexpr int32 NumStrokes = 24;
+	for (int32 Stroke = 0; Stroke < NumStrokes; ++Stroke)
+	{
+		const FVector Center(Random.FRandRange(0.0f, 70.0f), Random.FRandRange(0.0f, 70.0f), Random.FRandRange(0.0f, 70.0f));
+		FKawaiiFluidBrushStrokeDelta& Delta = Strokes.AddDefaulted_GetRef();
+		if (Stroke % 3 == 2)
+		{
+			Delta.ApplyRemove(Volume, Center, 18.0f);
+		}
+		else
+		{
+			Delta.ApplyAdd(Volume, MakeStrokePositions(Center, 12.0f, 20, 100 + Stroke), FVector(Random.VRand()) * 30.0, 1.0f);
+		}
+		States.Add(Volume.Particles);
+	}
+
+	bool bUndoMatches = true;
+	for (int32 Stroke = NumStrokes - 1; Stroke >= 0; --Stroke)
+	{
+		Strokes[Stroke].Undo(Volume);
+		if (!SameParticles(Volume.Particles, States[Stroke]))
+		{
+			AddError(FString::Printf(TEXT("Undo of stroke %d does not restore its input"), Stroke));
+			bUndoMatches = false;
+		}
+	}
+	TestTrue(TEXT("Reverse undo reproduces every state"), bUndoMatches);
+
+	bool bRedoMatches = true;
+	for (int32 Stroke = 0; Stroke < NumStrokes; ++Stroke)
+	{
+		Strokes[Stroke].Redo(Volume);
+		if (!SameParticles(Volume.Particles, States[Stroke + 1]))
+		{
+			AddError(FString::Printf(TEXT("Redo of stroke %d does not reproduce its output"), Stroke));
+			bRedoMatches = false;
+		}
+	}
+	TestTrue(TEXT("Forward redo reproduces every state"), bRedoMatches);
+
+	return true;
+}
+
+//=============================================================================
+// B-04: Record Size
+// A stroke's record depends on the particles it touches, not on the volume size,
+// and round-trips through binary serialization
+//=============================================================================
+bool FKawaiiFluidBrushStrokeDeltaTest_RecordSize::RunTest(const FString& Parameters)
+{
+	const TArray<FVector> Positions = MakeStrokePositions(FVector(-100.0), 10.0f, 64, 9);
+
+	FMockParticleVolume SmallVolume;
+	SmallVolume.Fill(10, 10.0f, 11);
+	FMockParticleVolume LargeVolume;
+	LargeVolume.Fill(47, 10.0f, 11);
+	AddInfo(FString::Printf(TEXT("Volumes: %d and %d particles"), SmallVolume.Particles.Num(), LargeVolume.Particles.Num()));
+
+	FKawaiiFluidBrushStrokeDelta SmallStroke;
+	FKawaiiFluidBrushStrokeDelta LargeStroke;
+	SmallStroke.ApplyAdd(SmallVolume, Positions, FVector::ZeroVector, 1.0f);
+	LargeStroke.ApplyAdd(LargeVolume, Positions, FVector::ZeroVector, 1.0f);
+
+	const SIZE_T PayloadBytes = Positions.Num() * (sizeof(int32) + 2 * sizeof(FVector3f));
+	AddInfo(FString::Printf(TEXT("Record: %llu bytes for %d particles (payload %llu)"),
+		static_cast<uint64>(LargeStroke.GetAllocatedSize()), Positions.Num(), static_cast<uint64>(PayloadBytes)));
+	TestTrue(TEXT("Record size independent of volume size"), SmallStroke.GetAllocatedSize() == LargeStroke.GetAllocatedSize());
+	TestTrue(TEXT("Record is compact (<= 2x payload)"), LargeStroke.GetAllocatedSize() <= 2 * PayloadBytes);
+
+	// Binary round trip
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Writer << LargeStroke;
+	FKawaiiFluidBrushStrokeDelta Loaded;
+	FMemoryReader Reader(Bytes);
+	Reader << Loaded;
+
+	TestEqual(TEXT("Round trip keeps added count"), Loaded.GetAdded().Num(), LargeStroke.GetAdded().Num());
+	TestTrue(TEXT("Round trip keeps IDs"), Loaded.GetAdded().ParticleIDs == LargeStroke.GetAdded().ParticleIDs);
+	TestTrue(TEXT("Round trip keeps positions"), Loaded.GetAdded().Positions == LargeStroke.GetAdded().Positions);
+
+	// The loaded record replays like the original
+	Loaded.Undo(LargeVolume);
+	TestEqual(TEXT("Loaded record undoes the stroke"), LargeVolume.Particles.Num(), 47 * 47 * 47);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,298 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// CPU Simulation Unit Tests
+// Substep accumulator, bounds containment and restitution, CPU-mode spawning on the simulation module,
+// compact particle layout parity
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Core/KawaiiFluidSimulationContext.h"
+#include "Core/KawaiiFluidSimulationTypes.h"
+#include "Core/FluidParticle.h"
+#include "Core/SpatialHash.h"
+#include "Data/KawaiiFluidPresetDataAsset.h"
+#include "Modules/KawaiiFluidSimulationModule.h"
+#include "HAL/IConsoleManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidCPUSimulationTest_SubstepAccumulator,
+	"KawaiiFluid.Core.CPUSimulation.C01_SubstepAccumulator",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidCPUSimulationTest_BoundsContainment,
+	"KawaiiFluid.Core.CPUSimulation.C02_BoundsContainment",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidCPUSimulationTest_CPUSpawnMode,
+	"KawaiiFluid.Core.CPUSimulation.C03_CPUSpawnMode",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidCPUSimulationTest_BoundsRestitution,
+	"KawaiiFluid.Core.CPUSimulation.C04_BoundsRestitution",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidCPUSimulationTest_CompactLayout,
+	"KawaiiFluid.Core.CPUSimulation.C05_CompactLayout",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float TestFrameTime = 1.0f / 60.0f;
+
+	/** Containment box with the floor at Z=0 */
+	FKawaiiFluidSimulationParams MakeBoxParams(const UKawaiiFluidPresetDataAsset& Preset, const FBox& Bounds)
+	{
+		FKawaiiFluidSimulationParams Params;
+		Params.bUseWorldCollision = false;
+		Params.ParticleRadius = Preset.ParticleRadius;
+		Params.WorldBounds = Bounds;
+		Params.BoundsRestitution = Preset.Bounciness;
+		Params.BoundsFriction = Preset.Friction;
+		return Params;
+	}
+
+	/** Grid block of particles at the preset spacing */
+	TArray<FFluidParticle> MakeBlock(const FVector& Origin, int32 GridSize, float Spacing, float Mass)
+	{
+		TArray<FFluidParticle> Particles;
+		Particles.Reserve(GridSize * GridSize * GridSize);
+		for (int32 x = 0; x < GridSize; ++x)
+		{
+			for (int32 y = 0; y < GridSize; ++y)
+			{
+				for (int32 z = 0; z < GridSize; ++z)
+				{
+					FFluidParticle P(Origin + FVector(x, y, z) * Spacing, Particles.Num());
+					P.Mass = Mass;
+					Particles.Add(P);
+				}
+			}
+		}
+		return Particles;
+	}
+}
+
+//=============================================================================
+// C-01: Substep Accumulator
+// SimulateCPU runs floor(accumulated / SubstepDeltaTime) substeps, carries the
+// remainder, and clamps a long frame to MaxSubsteps
+//=============================================================================
+bool FKawaiiFluidCPUSimulationTest_SubstepAccumulator::RunTest(const FString& Parameters)
+{
+	UKawaiiFluidPresetDataAsset* Preset = NewObject<UKawaiiFluidPresetDataAsset>();
+	UKawaiiFluidSimulationContext* Context = NewObject<UKawaiiFluidSimulationContext>();
+	Preset->SubstepDeltaTime = 1.0f / 120.0f;
+	Preset->MaxSubsteps = 8;
+
+	TArray<FFluidParticle> Particles = MakeBlock(FVector(0.0, 0.0, 100.0), 1, Preset->ParticleSpacing, Preset->ParticleMass);
+	FSpatialHash SpatialHash(Preset->SmoothingRadius);
+	const FKawaiiFluidSimulationParams Params = MakeBoxParams(*Preset, FBox(FVector(-200.0), FVector(200.0, 200.0, 400.0)));
+
+	float AccumulatedTime = 0.0f;
+	TestEqual(TEXT("Half substep runs nothing"), Context->SimulateCPU(Particles, Preset, Params, SpatialHash, Preset->SubstepDeltaTime * 0.5f, AccumulatedTime), 0);
+	TestEqual(TEXT("Accumulated remainder completes one substep"), Context->SimulateCPU(Particles, Preset, Params, SpatialHash, Preset->SubstepDeltaTime * 0.5f, AccumulatedTime), 1);
+	TestTrue(TEXT("Remainder is consumed"), FMath::Abs(AccumulatedTime) < 1e-5f);
+
+	TestEqual(TEXT("1/60 frame runs two 1/120 substeps"), Context->SimulateCPU(Particles, Preset, Params, SpatialHash, TestFrameTime, AccumulatedTime), 2);
+	TestEqual(TEXT("Long frame clamps to MaxSubsteps"), Context->SimulateCPU(Particles, Preset, Params, SpatialHash, 1.0f, AccumulatedTime), Preset->MaxSubsteps);
+	TestTrue(TEXT("Clamped frame leaves less than one substep"), AccumulatedTime < Preset->SubstepDeltaTime);
+
+	TestTrue(TEXT("Gravity moved the particle down"), Particles[0].Position.Z < 100.0);
+
+	TestEqual(TEXT("No preset runs nothing"), Context->SimulateCPU(Particles, nullptr, Params, SpatialHash, TestFrameTime, AccumulatedTime), 0);
+
+	return true;
+}
+
+//=============================================================================
+// C-02: Bounds Containment
+// A block dropped into a small box and pushed sideways never leaves the box
+// shrunk by the particle radius, and ends up resting on the floor
+//=============================================================================
+bool FKawaiiFluidCPUSimulationTest_BoundsContainment::RunTest(const FString& Parameters)
+{
+	UKawaiiFluidPresetDataAsset* Preset = NewObject<UKawaiiFluidPresetDataAsset>();
+	UKawaiiFluidSimulationContext* Context = NewObject<UKawaiiFluidSimulationContext>();
+
+	const FBox Bounds(FVector(-40.0, -40.0, 0.0), FVector(40.0, 40.0, 200.0));
+	const FKawaiiFluidSimulationParams Params = MakeBoxParams(*Preset, Bounds);
+	const FBox Inner(Bounds.Min + FVector(Preset->ParticleRadius), Bounds.Max - FVector(Preset->ParticleRadius));
+	constexpr double Tolerance = 1e-3;
+
+	TArray<FFluidParticle> Particles = MakeBlock(FVector(-15.0, -15.0, 60.0), 4, Preset->ParticleSpacing, Preset->ParticleMass);
+	for (FFluidParticle& P : Particles)
+	{
+		P.Velocity = FVector(600.0, 250.0, 0.0);
+	}
+
+	FSpatialHash SpatialHash(Preset->SmoothingRadius);
+	float AccumulatedTime = 0.0f;
+	bool bAlwaysInside = true;
+	for (int32 Frame = 0; Frame < 180 && bAlwaysInside; ++Frame)
+	{
+		Context->SimulateCPU(Particles, Preset, Params, SpatialHash, TestFrameTime, AccumulatedTime);
+		for (const FFluidParticle& P : Particles)
+		{
+			if (!Inner.ExpandBy(Tolerance).IsInsideOrOn(P.Position) || P.Position.ContainsNaN())
+			{
+				AddError(FString::Printf(TEXT("Frame %d: particle %d at %s left the box"), Frame, P.ParticleID, *P.Position.ToString()));
+				bAlwaysInside = false;
+				break;
+			}
+		}
+	}
+	TestTrue(TEXT("Particles stay inside the bounds"), bAlwaysInside);
+
+	double MinZ = TNumericLimits<double>::Max();
+	for (const FFluidParticle& P : Particles)
+	{
+		MinZ = FMath::Min(MinZ, P.Position.Z);
+	}
+	AddInfo(FString::Printf(TEXT("Lowest particle after 3 s: Z = %.2f cm"), MinZ));
+	TestTrue(TEXT("Lowest particle rests on the floor"), MinZ < Inner.Min.Z + Preset->ParticleSpacing);
+
+	return true;
+}
+
+//=============================================================================
+// C-03: CPU Spawn Mode
+// In CPU mode the module spawns straight into its particle array with unique
+// IDs, the preset mass and its SourceID; ClearAllParticles empties it
+//=============================================================================
+bool FKawaiiFluidCPUSimulationTest_CPUSpawnMode::RunTest(const FString& Parameters)
+{
+	UKawaiiFluidPresetDataAsset* Preset = NewObject<UKawaiiFluidPresetDataAsset>();
+	Preset->ParticleMass = 2.5f;
+
+	UKawaiiFluidSimulationModule* Module = NewObject<UKawaiiFluidSimulationModule>();
+	Module->Initialize(Preset);
+	Module->SetCPUSimulationMode(true);
+	TestTrue(TEXT("CPU mode enabled"), Module->IsCPUSimulationMode());
+
+	const int32 FirstID = Module->SpawnParticle(FVector(0.0, 0.0, 50.0), FVector(0.0, 0.0, -100.0));
+	const int32 SecondID = Module->SpawnParticle(FVector(10.0, 0.0, 50.0));
+	TestEqual(TEXT("Two CPU particles"), Module->GetParticles().Num(), 2);
+	TestTrue(TEXT("Particle IDs are unique"), FirstID != SecondID);
+
+	if (Module->GetParticles().Num() == 2)
+	{
+		const FFluidParticle& First = Module->GetParticles()[0];
+		TestEqual(TEXT("ID returned by SpawnParticle"), First.ParticleID, FirstID);
+		TestTrue(TEXT("Velocity copied"), First.Velocity.Equals(FVector(0.0, 0.0, -100.0)));
+		TestEqual(TEXT("Preset mass"), First.Mass, Preset->ParticleMass);
+		TestEqual(TEXT("Module SourceID"), First.SourceID, Module->GetSourceID());
+	}
+
+	Module->ClearAllParticles();
+	TestEqual(TEXT("Cleared"), Module->GetParticles().Num(), 0);
+
+	Module->Shutdown();
+	return true;
+}
+
+//=============================================================================
+// C-04: Bounds Restitution
+// A particle hitting the floor stops with zero bounciness and leaves the floor
+// upward, slower than it arrived, with a partial one
+//=============================================================================
+bool FKawaiiFluidCPUSimulationTest_BoundsRestitution::RunTest(const FString& Parameters)
+{
+	UKawaiiFluidPresetDataAsset* Preset = NewObject<UKawaiiFluidPresetDataAsset>();
+	UKawaiiFluidSimulationContext* Context = NewObject<UKawaiiFluidSimulationContext>();
+	Preset->SubstepDeltaTime = 1.0f / 120.0f;
+	Preset->Friction = 0.0f;
+
+	const FBox Bounds(FVector(-200.0, -200.0, 0.0), FVector(200.0, 200.0, 400.0));
+	const double FloorZ = Bounds.Min.Z + Preset->ParticleRadius;
+	constexpr double ImpactSpeed = 300.0;
+
+	// One substep from resting on the floor while moving down at ImpactSpeed
+	auto Bounce = [&](float Bounciness) -> FFluidParticle
+	{
+		Preset->Bounciness = Bounciness;
+		TArray<FFluidParticle> Particles = MakeBlock(FVector(0.0, 0.0, FloorZ), 1, Preset->ParticleSpacing, Preset->ParticleMass);
+		Particles[0].Velocity = FVector(0.0, 0.0, -ImpactSpeed);
+
+		FSpatialHash SpatialHash(Preset->SmoothingRadius);
+		float AccumulatedTime = 0.0f;
+		Context->SimulateCPU(Particles, Preset, MakeBoxParams(*Preset, Bounds), SpatialHash, Preset->SubstepDeltaTime, AccumulatedTime);
+		return Particles[0];
+	};
+
+	const FFluidParticle Inelastic = Bounce(0.0f);
+	TestTrue(TEXT("Zero bounciness stops on the floor"), FMath::IsNearlyEqual(Inelastic.Position.Z, FloorZ, 1e-3));
+	TestTrue(TEXT("Zero bounciness leaves no normal velocity"), FMath::Abs(Inelastic.Velocity.Z) < 1.0);
+
+	const FFluidParticle Bouncy = Bounce(0.5f);
+	AddInfo(FString::Printf(TEXT("Bounciness 0.5: Z = %.3f cm, Vz = %.1f cm/s"), Bouncy.Position.Z - FloorZ, Bouncy.Velocity.Z));
+	TestTrue(TEXT("Bounce lifts the particle off the floor"), Bouncy.Position.Z > FloorZ);
+	TestTrue(TEXT("Bounce reverses the velocity"), Bouncy.Velocity.Z > 0.0);
+	TestTrue(TEXT("Bounce loses speed"), Bouncy.Velocity.Z < ImpactSpeed);
+
+	return true;
+}
+
+//=============================================================================
+// C-05: Compact Layout
+// With r.Fluid.CPUCompactLayout=1 viscosity and surface classification read the
+// per-substep compact copy; a short run stays within half-precision drift of
+// the float snapshot path
+//=============================================================================
+bool FKawaiiFluidCPUSimulationTest_CompactLayout::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* CompactLayoutCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.Fluid.CPUCompactLayout"));
+	if (!CompactLayoutCVar)
+	{
+		AddError(TEXT("r.Fluid.CPUCompactLayout not registered"));
+		return false;
+	}
+	const int32 PreviousValue = CompactLayoutCVar->GetInt();
+
+	UKawaiiFluidPresetDataAsset* Preset = NewObject<UKawaiiFluidPresetDataAsset>();
+	Preset->Viscosity = 0.3f;
+	const FBox Bounds(FVector(-40.0, -40.0, 0.0), FVector(40.0, 40.0, 200.0));
+	const FKawaiiFluidSimulationParams Params = MakeBoxParams(*Preset, Bounds);
+
+	auto Run = [&](int32 Layout)
+	{
+		CompactLayoutCVar->Set(Layout, ECVF_SetByCode);
+		UKawaiiFluidSimulationContext* Context = NewObject<UKawaiiFluidSimulationContext>();
+		TArray<FFluidParticle> Particles = MakeBlock(FVector(-15.0, -15.0, 20.0), 4, Preset->ParticleSpacing, Preset->ParticleMass);
+		for (FFluidParticle& P : Particles)
+		{
+			P.Velocity = FVector(120.0, -60.0, 0.0);
+		}
+
+		FSpatialHash SpatialHash(Preset->SmoothingRadius);
+		float AccumulatedTime = 0.0f;
+		for (int32 Frame = 0; Frame < 10; ++Frame)
+		{
+			Context->SimulateCPU(Particles, Preset, Params, SpatialHash, TestFrameTime, AccumulatedTime);
+		}
+		return Particles;
+	};
+
+	const TArray<FFluidParticle> Snapshot = Run(0);
+	const TArray<FFluidParticle> Compact = Run(1);
+	CompactLayoutCVar->Set(PreviousValue, ECVF_SetByCode);
+
+	if (!TestEqual(TEXT("Same particle count"), Compact.Num(), Snapshot.Num()))
+	{
+		return false;
+	}
+
+	double WorstDrift = 0.0;
+	bool bFinite = true;
+	for (int32 i = 0; i < Snapshot.Num(); ++i)
+	{
+		bFinite &= !Compact[i].Position.ContainsNaN() && !Compact[i].Velocity.ContainsNaN();
+		WorstDrift = FMath::Max(WorstDrift, FVector::Dist(Compact[i].Position, Snapshot[i].Position));
+	}
+	AddInfo(FString::Printf(TEXT("Worst position drift after 10 frames: %.4f cm"), WorstDrift));
+	TestTrue(TEXT("Compact run stays finite"), bFinite);
+	TestTrue(TEXT("Compact run tracks the float snapshot path"), WorstDrift < Preset->ParticleRadius * 0.25);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
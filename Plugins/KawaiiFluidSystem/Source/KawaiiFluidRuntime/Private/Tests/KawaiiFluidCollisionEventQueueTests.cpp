@@ -0,0 +1,172 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Collision Event Queue Unit Tests
+// Synthetic feedback streams: budget, cooldown by ParticleID, filtering, no steady-state allocation
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Core/KawaiiFluidCollisionEventQueue.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidCollisionEventQueueTest_Budget,
+	"KawaiiFluid.Core.CollisionEventQueue.E01_Budget",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidCollisionEventQueueTest_Cooldown,
+	"KawaiiFluid.Core.CollisionEventQueue.E02_Cooldown",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidCollisionEventQueueTest_Filtering,
+	"KawaiiFluid.Core.CollisionEventQueue.E03_Filtering",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidCollisionEventQueueTest_NoAllocation,
+	"KawaiiFluid.Core.CollisionEventQueue.E04_NoAllocation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/** Offer a waterfall-like stream: Count contacts from IDs [FirstID, FirstID + Count) */
+	void OfferStream(FKawaiiFluidCollisionEventQueue& Queue, int32 FirstID, int32 Count, int32 SourceID, float HitSpeed)
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Queue.TryAdd(FirstID + i, SourceID, HitSpeed);
+		}
+	}
+}
+
+//=============================================================================
+// E-01: Budget
+// A 10k-contact frame produces exactly MaxEventsPerFrame events;
+// MaxEventsPerFrame = 0 means unlimited up to MaxCapacity
+//=============================================================================
+bool FKawaiiFluidCollisionEventQueueTest_Budget::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidCollisionEventQueue Queue;
+	Queue.Configure(10, 0.1f, 50.0f, -1);
+	Queue.BeginFrame(0.0f);
+
+	OfferStream(Queue, 0, 10000, 0, 300.0f);
+
+	const FKawaiiFluidCollisionEventStats& Stats = Queue.GetStats();
+	TestEqual(TEXT("Events capped at budget"), Queue.GetEvents().Num(), 10);
+	TestTrue(TEXT("Queue full"), Queue.IsFull());
+	TestEqual(TEXT("Accepted"), Stats.NumAccepted, 10);
+	TestEqual(TEXT("Dropped after full"), Stats.NumDropped, 10000 - 10);
+	TestEqual(TEXT("First event is first contact"), Queue.GetEvents()[0].ParticleID, 0);
+
+	Queue.Configure(0, 0.1f, 50.0f, -1);
+	Queue.BeginFrame(1.0f);
+	OfferStream(Queue, 20000, 10000, 0, 300.0f);
+	TestEqual(TEXT("Unlimited budget bounded by MaxCapacity"), Queue.GetEvents().Num(), FKawaiiFluidCollisionEventQueue::MaxCapacity);
+
+	return true;
+}
+
+//=============================================================================
+// E-02: Cooldown
+// One particle touching a collider every frame at 60 Hz fires once per
+// cooldown window; other particles are unaffected
+//=============================================================================
+bool FKawaiiFluidCollisionEventQueueTest_Cooldown::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidCollisionEventQueue Queue;
+	Queue.Configure(10, 0.1f, 0.0f, -1);
+
+	const float FrameTime = 1.0f / 60.0f;
+	int32 EventsOfParticle = 0;
+	for (int32 Frame = 0; Frame < 60; ++Frame)
+	{
+		Queue.BeginFrame(Frame * FrameTime);
+		EventsOfParticle += Queue.TryAdd(42, 0, 100.0f) ? 1 : 0;
+	}
+
+	// 1 second / 0.1 second cooldown (frame quantization: every 6th or 7th frame)
+	TestTrue(TEXT("Cooldown limits repeat events"), EventsOfParticle >= 8 && EventsOfParticle <= 10);
+
+	Queue.BeginFrame(60 * FrameTime);
+	Queue.TryAdd(42, 0, 100.0f);
+	TestNotNull(TEXT("Other particle not blocked by cooldown"), Queue.TryAdd(43, 0, 100.0f));
+	TestNull(TEXT("Same particle blocked within frame"), Queue.TryAdd(43, 0, 100.0f));
+	TestTrue(TEXT("Cooldown counted"), Queue.GetStats().NumCooldown >= 1);
+
+	Queue.Reset();
+	Queue.BeginFrame(60 * FrameTime);
+	TestNotNull(TEXT("Reset clears cooldowns"), Queue.TryAdd(43, 0, 100.0f));
+
+	return true;
+}
+
+//=============================================================================
+// E-03: Filtering
+// SourceID and minimum hit speed reject contacts before they use budget
+//=============================================================================
+bool FKawaiiFluidCollisionEventQueueTest_Filtering::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidCollisionEventQueue Queue;
+	Queue.Configure(4, 0.0f, 50.0f, 3);
+	Queue.BeginFrame(0.0f);
+
+	OfferStream(Queue, 0, 100, 1, 300.0f);    // wrong source
+	OfferStream(Queue, 100, 100, 3, 10.0f);   // too slow
+	TestEqual(TEXT("Filtered contacts produce no events"), Queue.GetEvents().Num(), 0);
+	TestEqual(TEXT("Filtered count"), Queue.GetStats().NumFiltered, 200);
+
+	FKawaiiFluidCollisionEvent* Event = Queue.TryAdd(500, 3, 80.0f);
+	TestNotNull(TEXT("Matching contact accepted"), Event);
+	if (Event)
+	{
+		TestEqual(TEXT("Event carries ParticleID"), Event->ParticleID, 500);
+		TestEqual(TEXT("Event carries SourceID"), Event->SourceID, 3);
+		TestEqual(TEXT("Event carries speed"), Event->HitSpeed, 80.0f);
+	}
+
+	return true;
+}
+
+//=============================================================================
+// E-04: No Allocation
+// After Configure, thousands of frames of varying streams never reallocate
+// the event buffer or the cooldown ring
+//=============================================================================
+bool FKawaiiFluidCollisionEventQueueTest_NoAllocation::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(5);
+	FKawaiiFluidCollisionEventQueue Queue;
+	Queue.Configure(32, 0.1f, 10.0f, -1);
+
+	Queue.BeginFrame(0.0f);
+	const FKawaiiFluidCollisionEvent* EventData = Queue.GetEvents().GetData();
+	const int32 CooldownCapacity = Queue.GetCooldownHistory().GetCapacity();
+
+	int32 NextID = 0;
+	int32 TotalAccepted = 0;
+	for (int32 Frame = 1; Frame <= 2000; ++Frame)
+	{
+		Queue.Configure(32, 0.1f, 10.0f, -1);
+		Queue.BeginFrame(Frame / 60.0f);
+
+		// Mix of repeat hitters and newly spawned particles
+		const int32 NumContacts = Random.RandRange(0, 5000);
+		for (int32 i = 0; i < NumContacts; ++i)
+		{
+			const int32 ParticleID = (i & 1) ? Random.RandRange(0, 256) : NextID++;
+			Queue.TryAdd(ParticleID, 0, Random.FRandRange(0.0f, 500.0f));
+		}
+		TotalAccepted += Queue.GetEvents().Num();
+
+		if (Queue.GetEvents().GetData() != EventData)
+		{
+			AddError(FString::Printf(TEXT("Event buffer reallocated at frame %d"), Frame));
+			break;
+		}
+	}
+
+	TestTrue(TEXT("Events produced"), TotalAccepted > 0);
+	TestEqual(TEXT("Cooldown ring capacity fixed"), Queue.GetCooldownHistory().GetCapacity(), CooldownCapacity);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,343 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Compact Particle Storage Unit Tests
+// Packed values within the documented precision, tile-relative offsets, XSPH and surface parity with the full-precision paths
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Core/KawaiiFluidCompactParticles.h"
+#include "Physics/ViscositySolver.h"
+#include "Physics/SurfaceDetector.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidCompactParticlesTest_Packing,
+	"KawaiiFluid.Core.CompactParticles.C01_Packing",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidCompactParticlesTest_CrossTileOffsets,
+	"KawaiiFluid.Core.CompactParticles.C02_CrossTileOffsets",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidCompactParticlesTest_XSPHParity,
+	"KawaiiFluid.Core.CompactParticles.C03_XSPHParity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidCompactParticlesTest_SurfaceParity,
+	"KawaiiFluid.Core.CompactParticles.C04_SurfaceParity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float TestCellSize = 20.0f;
+
+	/** Relative error of one half-precision conversion (round to nearest) */
+	constexpr float HalfRelativeError = 1.0f / 2048.0f;
+
+	/** Random particles in a box, random velocities and flags */
+	TArray<FFluidParticle> MakeParticles(int32 Count, const FVector& Min, const FVector& Max, float MaxSpeed, FRandomStream& Random)
+	{
+		TArray<FFluidParticle> Particles;
+		Particles.Reserve(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FFluidParticle P(FVector(
+				Random.FRandRange(Min.X, Max.X),
+				Random.FRandRange(Min.Y, Max.Y),
+				Random.FRandRange(Min.Z, Max.Z)), i);
+			P.Velocity = FVector(Random.VRand()) * Random.FRandRange(0.0f, MaxSpeed);
+			P.bIsAttached = Random.RandRange(0, 1) != 0;
+			P.bNearBoundary = Random.RandRange(0, 1) != 0;
+			P.bIsSurfaceParticle = Random.RandRange(0, 1) != 0;
+			Particles.Add(P);
+		}
+		return Particles;
+	}
+
+	/** Brute-force neighbor lists (self included, like FSpatialHash queries) */
+	void BuildNeighbors(TArray<FFluidParticle>& Particles, float Radius)
+	{
+		const double RadiusSq = static_cast<double>(Radius) * Radius;
+		for (FFluidParticle& P : Particles)
+		{
+			P.NeighborIndices.Reset();
+			for (int32 j = 0; j < Particles.Num(); ++j)
+			{
+				if (FVector::DistSquared(P.Position, Particles[j].Position) <= RadiusSq)
+				{
+					P.NeighborIndices.Add(j);
+				}
+			}
+		}
+	}
+
+	uint8 ExpectedFlags(const FFluidParticle& P)
+	{
+		return static_cast<uint8>((P.bIsAttached ? EKawaiiFluidCompactFlags::Attached : 0)
+			| (P.bNearBoundary ? EKawaiiFluidCompactFlags::NearBoundary : 0)
+			| (P.bIsSurfaceParticle ? EKawaiiFluidCompactFlags::Surface : 0));
+	}
+}
+
+//=============================================================================
+// C-01: Packing
+// Far from the world origin, positions are packed within the tile-local float
+// bound, velocities within half precision, flags exactly
+//=============================================================================
+bool FKawaiiFluidCompactParticlesTest_Packing::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(7);
+	const FVector Offset(2.5e6, -1.2e6, 3.0e4);
+	const TArray<FFluidParticle> Particles = MakeParticles(5000, Offset - FVector(3000.0), Offset + FVector(3000.0), 1500.0f, Random);
+
+	FKawaiiFluidCompactParticles Compact;
+	TestTrue(TEXT("Load succeeds"), Compact.Load(Particles, TestCellSize));
+	TestEqual(TEXT("Particle count"), Compact.Num(), Particles.Num());
+	TestTrue(TEXT("Valid for the packed count only"), Compact.IsValidFor(Particles.Num()) && !Compact.IsValidFor(Particles.Num() - 1));
+	TestTrue(TEXT("Tile size matches hybrid tiles"), FMath::IsNearlyEqual(Compact.GetTileSize(), TestCellSize * FKawaiiFluidCompactParticles::TileCells));
+	TestTrue(TEXT("Several tiles"), Compact.GetNumTiles() > 1);
+
+	const double PositionBound = Compact.GetPositionErrorBound();
+	int32 PositionFailures = 0;
+	int32 VelocityFailures = 0;
+	int32 FlagFailures = 0;
+	double WorstPositionError = 0.0;
+	for (int32 i = 0; i < Particles.Num(); ++i)
+	{
+		const FVector PositionError = (Compact.GetPosition(i) - Particles[i].Position).GetAbs();
+		WorstPositionError = FMath::Max(WorstPositionError, PositionError.GetMax());
+		PositionFailures += PositionError.GetMax() <= PositionBound ? 0 : 1;
+
+		const FVector3f Velocity = Compact.GetVelocity(i);
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const double Expected = Particles[i].Velocity[Axis];
+			if (FMath::Abs(Velocity[Axis] - Expected) > FMath::Abs(Expected) * HalfRelativeError + 1.e-4)
+			{
+				++VelocityFailures;
+			}
+		}
+
+		FlagFailures += Compact.GetFlags(i) == ExpectedFlags(Particles[i]) ? 0 : 1;
+	}
+	TestEqual(TEXT("Positions within tile-local float bound"), PositionFailures, 0);
+	TestEqual(TEXT("Velocities within half precision"), VelocityFailures, 0);
+	TestEqual(TEXT("Flags exact"), FlagFailures, 0);
+	AddInfo(FString::Printf(TEXT("Worst position error %.6f cm at |x| ~ %.0f cm (bound %.6f cm)"), WorstPositionError, Offset.GetAbsMax(), PositionBound));
+
+	// Absolute float at this distance would be far worse than the tile-local bound
+	const double AbsoluteFloatUlp = FMath::Pow(2.0, FMath::FloorToDouble(FMath::Log2(FMath::Abs(Offset.X))) - 23.0);
+	TestTrue(TEXT("Tile-local precision beats absolute float"), PositionBound < AbsoluteFloatUlp * 0.5);
+
+	// The 8-lane gather converts the same values as the scalar accessor
+	const int32 Indices[FKawaiiFluidCompactParticles::BlockSize] = { 4999, 0, 17, 17, 2500, 3, 1234, 4000 };
+	float GatherX[FKawaiiFluidCompactParticles::BlockSize];
+	float GatherY[FKawaiiFluidCompactParticles::BlockSize];
+	float GatherZ[FKawaiiFluidCompactParticles::BlockSize];
+	Compact.GatherVelocities(Indices, GatherX, GatherY, GatherZ);
+	bool bGatherMatches = true;
+	for (int32 Lane = 0; Lane < FKawaiiFluidCompactParticles::BlockSize; ++Lane)
+	{
+		bGatherMatches &= FVector3f(GatherX[Lane], GatherY[Lane], GatherZ[Lane]) == Compact.GetVelocity(Indices[Lane]);
+	}
+	TestTrue(TEXT("Gathered velocities match scalar conversion"), bGatherMatches);
+
+	// Speed clamping
+	TArray<FFluidParticle> Fast;
+	Fast.Add(FFluidParticle(FVector(10.0), 0));
+	Fast[0].Velocity = FVector(1.0e6, -1.0e6, 3.0);
+	TestTrue(TEXT("Load fast particle"), Compact.Load(Fast, TestCellSize));
+	const FVector3f Clamped = Compact.GetVelocity(0);
+	TestTrue(TEXT("Speed clamped to half range"), Clamped.X == FKawaiiFluidCompactParticles::MaxSpeedComponent && Clamped.Y == -FKawaiiFluidCompactParticles::MaxSpeedComponent);
+
+	Compact.Invalidate();
+	TestFalse(TEXT("Invalidated layout is not used"), Compact.IsValidFor(Fast.Num()));
+
+	TestEqual(TEXT("Bytes per particle"), FKawaiiFluidCompactParticles::BytesPerParticle, 21);
+	TestTrue(TEXT("At least 3x smaller than FFluidParticle"), FKawaiiFluidCompactParticles::BytesPerParticle * 3 <= static_cast<int32>(sizeof(FFluidParticle)));
+
+	return true;
+}
+
+//=============================================================================
+// C-02: Cross-Tile Offsets
+// Pair offsets across tile boundaries (including negative tile coordinates)
+// match the double difference
+//=============================================================================
+bool FKawaiiFluidCompactParticlesTest_CrossTileOffsets::RunTest(const FString& Parameters)
+{
+	const double TileSize = TestCellSize * FKawaiiFluidCompactParticles::TileCells;
+
+	TestTrue(TEXT("Tile coord floors negative positions"), FKawaiiFluidCompactParticles::ComputeTileCoord(FVector(-0.5, 0.0, TileSize), TileSize) == FIntVector(-1, 0, 1));
+
+	// Pairs straddling tile faces, edges and corners
+	TArray<FFluidParticle> Particles;
+	FRandomStream Random(99);
+	for (int32 Pair = 0; Pair < 200; ++Pair)
+	{
+		const FVector Boundary = FVector(
+			Random.RandRange(-40, 40),
+			Random.RandRange(-40, 40),
+			Random.RandRange(-40, 40)) * TileSize;
+		const FVector Jitter(Random.FRandRange(-15.0f, 15.0f), Random.FRandRange(-15.0f, 15.0f), Random.FRandRange(-15.0f, 15.0f));
+		Particles.Add(FFluidParticle(Boundary + Jitter, Particles.Num()));
+		Particles.Add(FFluidParticle(Boundary - Jitter * 0.7, Particles.Num()));
+	}
+
+	FKawaiiFluidCompactParticles Compact;
+	TestTrue(TEXT("Load succeeds"), Compact.Load(Particles, TestCellSize));
+
+	// Two roundings of the local coordinates plus float arithmetic at tile scale
+	const double Tolerance = 4.0 * Compact.GetPositionErrorBound() + 1.e-4;
+	int32 CrossTilePairs = 0;
+	int32 Failures = 0;
+	for (int32 i = 0; i < Particles.Num(); i += 2)
+	{
+		CrossTilePairs += Compact.GetTileIndex(i) != Compact.GetTileIndex(i + 1) ? 1 : 0;
+
+		const FVector Expected = Particles[i].Position - Particles[i + 1].Position;
+		const FVector Actual(Compact.GetOffset(i, i + 1));
+		Failures += (Actual - Expected).GetAbsMax() <= Tolerance ? 0 : 1;
+	}
+	TestTrue(TEXT("Most pairs straddle tiles"), CrossTilePairs > 150);
+	TestEqual(TEXT("Offsets match double"), Failures, 0);
+
+	return true;
+}
+
+//=============================================================================
+// C-03: XSPH Parity
+// XSPH on the compact layout matches the full-precision path within the
+// half-precision input error (blob far from the world origin, across tiles);
+// a stale layout falls back to the full-precision path
+//=============================================================================
+bool FKawaiiFluidCompactParticlesTest_XSPHParity::RunTest(const FString& Parameters)
+{
+	constexpr float MaxSpeed = 400.0f;
+	constexpr float ViscosityCoeff = 0.5f;
+	const double TileSize = TestCellSize * FKawaiiFluidCompactParticles::TileCells;
+	const FVector Center = FVector(-625.0, 312.0, 1.0) * TileSize;
+
+	FRandomStream Random(2024);
+	TArray<FFluidParticle> Reference = MakeParticles(1500, Center - FVector(120.0), Center + FVector(120.0), MaxSpeed, Random);
+	BuildNeighbors(Reference, TestCellSize);
+	TArray<FFluidParticle> Compacted = Reference;
+
+	FKawaiiFluidCompactParticles Compact;
+	TestTrue(TEXT("Load succeeds"), Compact.Load(Compacted, TestCellSize));
+	TestTrue(TEXT("Blob spans several tiles"), Compact.GetNumTiles() > 1);
+
+	FViscositySolver ReferenceSolver;
+	FViscositySolver CompactSolver;
+	ReferenceSolver.ApplyXSPH(Reference, ViscosityCoeff, TestCellSize);
+	CompactSolver.ApplyXSPH(Compacted, Compact, ViscosityCoeff, TestCellSize);
+
+	// Correction is a weighted mean of velocity differences, each off by at most two half roundings;
+	// the slack covers the different summation order
+	const double Tolerance = ViscosityCoeff * 2.0 * MaxSpeed * HalfRelativeError + 2.e-2;
+	double WorstError = 0.0;
+	int32 Failures = 0;
+	int32 Changed = 0;
+	for (int32 i = 0; i < Reference.Num(); ++i)
+	{
+		const double Error = (Compacted[i].Velocity - Reference[i].Velocity).GetAbsMax();
+		WorstError = FMath::Max(WorstError, Error);
+		Failures += Error <= Tolerance ? 0 : 1;
+		Changed += Compacted[i].Velocity != Reference[i].Velocity ? 1 : 0;
+	}
+
+	TestEqual(TEXT("Compact XSPH matches full-precision path"), Failures, 0);
+	TestTrue(TEXT("Compact path ran (velocities differ in rounding)"), Changed > 0);
+	AddInfo(FString::Printf(TEXT("Worst velocity difference %.4f cm/s (tolerance %.4f)"), WorstError, Tolerance));
+
+	// Work split does not change the compact result either
+	TArray<FFluidParticle> SingleRange = Compacted;
+	TArray<FFluidParticle> ManyRanges = Compacted;
+	CompactSolver.ApplyXSPH(SingleRange, Compact, ViscosityCoeff, TestCellSize, 1);
+	CompactSolver.ApplyXSPH(ManyRanges, Compact, ViscosityCoeff, TestCellSize, 97);
+	bool bSplitIdentical = true;
+	for (int32 i = 0; i < SingleRange.Num(); ++i)
+	{
+		bSplitIdentical &= SingleRange[i].Velocity == ManyRanges[i].Velocity;
+	}
+	TestTrue(TEXT("Compact path independent of the work split"), bSplitIdentical);
+
+	// Layout packed from a different particle count: full-precision path
+	TArray<FFluidParticle> Grown = Reference;
+	Grown.Add(FFluidParticle(Center, Grown.Num()));
+	BuildNeighbors(Grown, TestCellSize);
+	TArray<FFluidParticle> Fallback = Grown;
+	ReferenceSolver.ApplyXSPH(Grown, ViscosityCoeff, TestCellSize);
+	CompactSolver.ApplyXSPH(Fallback, Compact, ViscosityCoeff, TestCellSize);
+	bool bFallbackIdentical = true;
+	for (int32 i = 0; i < Grown.Num(); ++i)
+	{
+		bFallbackIdentical &= Grown[i].Velocity == Fallback[i].Velocity;
+	}
+	TestTrue(TEXT("Stale layout falls back to the full-precision path"), bFallbackIdentical);
+
+	return true;
+}
+
+//=============================================================================
+// C-04: Surface Parity
+// Classification on the compact layout agrees with the float snapshot path
+// and reads last frame's surface flag from the packed flags
+//=============================================================================
+bool FKawaiiFluidCompactParticlesTest_SurfaceParity::RunTest(const FString& Parameters)
+{
+	const double TileSize = TestCellSize * FKawaiiFluidCompactParticles::TileCells;
+	const FVector Corner = FVector(40.0, -3.0, 7.0) * TileSize - FVector(45.0);
+
+	// Jittered lattice block (spacing h/2) straddling a tile corner
+	FRandomStream Random(5);
+	TArray<FFluidParticle> Particles;
+	const double Spacing = TestCellSize * 0.5;
+	for (int32 z = 0; z < 10; ++z)
+	{
+		for (int32 y = 0; y < 10; ++y)
+		{
+			for (int32 x = 0; x < 10; ++x)
+			{
+				const FVector Jitter(Random.FRandRange(-0.2f, 0.2f), Random.FRandRange(-0.2f, 0.2f), Random.FRandRange(-0.2f, 0.2f));
+				Particles.Add(FFluidParticle(Corner + (FVector(x, y, z) + Jitter) * Spacing, Particles.Num()));
+			}
+		}
+	}
+	BuildNeighbors(Particles, TestCellSize);
+
+	FSurfaceDetectorSettings Settings;
+	Settings.SmoothingRadius = TestCellSize;
+	Settings.NeighborThreshold = 10;
+
+	TArray<FFluidParticle> Snapshot = Particles;
+	TArray<FFluidParticle> Compacted = Particles;
+	FKawaiiFluidCompactParticles Compact;
+	TestTrue(TEXT("Load succeeds"), Compact.Load(Compacted, TestCellSize));
+	TestTrue(TEXT("Block spans several tiles"), Compact.GetNumTiles() > 1);
+
+	FSurfaceDetector SnapshotDetector;
+	FSurfaceDetector CompactDetector;
+	const int32 SnapshotCount = SnapshotDetector.Classify(Snapshot, Settings);
+	const int32 CompactCount = CompactDetector.Classify(Compacted, Compact, Settings);
+
+	TestTrue(TEXT("Surface found"), SnapshotCount > 0 && SnapshotCount < Particles.Num());
+	TestEqual(TEXT("Same surface particles"), CompactDetector.GetSurfaceIndices(), SnapshotDetector.GetSurfaceIndices());
+	TestEqual(TEXT("Same surface count"), CompactCount, SnapshotCount);
+
+	double WorstNormalError = 0.0;
+	for (int32 i = 0; i < Particles.Num(); ++i)
+	{
+		WorstNormalError = FMath::Max(WorstNormalError, (Compacted[i].SurfaceNormal - Snapshot[i].SurfaceNormal).GetAbsMax());
+	}
+	TestTrue(FString::Printf(TEXT("Same normals (worst %.2e)"), WorstNormalError), WorstNormalError < 1.e-4);
+
+	// Temporal coherence reads the packed flag: repack after the first pass and classify again
+	TestTrue(TEXT("Repack succeeds"), Compact.Load(Compacted, TestCellSize));
+	SnapshotDetector.Classify(Snapshot, Settings);
+	CompactDetector.Classify(Compacted, Compact, Settings);
+	TestEqual(TEXT("Same surface particles with hysteresis"), CompactDetector.GetSurfaceIndices(), SnapshotDetector.GetSurfaceIndices());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,327 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Frame Arena Unit Tests
+// Linear allocation, reset/high-water sizing, container adapter binding, double buffering, heap comparison
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Core/KawaiiFluidFrameArena.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidFrameArenaTest_LinearAllocation,
+	"KawaiiFluid.Core.FrameArena.F01_LinearAllocation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidFrameArenaTest_ResetAndHighWater,
+	"KawaiiFluid.Core.FrameArena.F02_ResetAndHighWater",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidFrameArenaTest_ContainerAdapter,
+	"KawaiiFluid.Core.FrameArena.F03_ContainerAdapter",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidFrameArenaTest_Microbenchmark,
+	"KawaiiFluid.Core.FrameArena.F04_Microbenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/** Blocks do not overlap (sorted by address) */
+	bool AreDisjoint(TArray<TPair<const uint8*, SIZE_T>> Blocks)
+	{
+		Blocks.Sort([](const TPair<const uint8*, SIZE_T>& A, const TPair<const uint8*, SIZE_T>& B) { return A.Key < B.Key; });
+		for (int32 i = 1; i < Blocks.Num(); ++i)
+		{
+			if (Blocks[i - 1].Key + Blocks[i - 1].Value > Blocks[i].Key)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * One simulated frame of temporaries: a job list and per-cell index lists grown without
+	 * Reserve (the pattern of the CPU collision broad-phase)
+	 * @return Checksum of the contents
+	 */
+	template<typename IndexArrayType, typename CellArrayType>
+	uint64 BuildFrameTemporaries(int32 NumCells, int32 Frame)
+	{
+		CellArrayType Cells;
+		uint64 Checksum = 0;
+		for (int32 Cell = 0; Cell < NumCells; ++Cell)
+		{
+			IndexArrayType& Indices = Cells.AddDefaulted_GetRef();
+			const int32 Count = 1 + ((Cell * 7 + Frame) % 24);
+			for (int32 i = 0; i < Count; ++i)
+			{
+				Indices.Add(Cell * 32 + i);
+			}
+		}
+
+		IndexArrayType Candidates;
+		for (const IndexArrayType& Indices : Cells)
+		{
+			Candidates.Append(Indices);
+		}
+		for (int32 Index : Candidates)
+		{
+			Checksum = Checksum * 31 + static_cast<uint64>(Index);
+		}
+		return Checksum;
+	}
+}
+
+//=============================================================================
+// F-01: Linear Allocation
+// Allocations honor alignment, never overlap, overflow into new chunks, and the
+// most recent allocation resizes in place
+//=============================================================================
+bool FKawaiiFluidFrameArenaTest_LinearAllocation::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidFrameArena Arena(1024);
+
+	TestNull(TEXT("Zero-size allocation"), Arena.Allocate(0, 16));
+	TestEqual(TEXT("No chunk before first allocation"), Arena.GetStats().NumChunks, 0);
+
+	TArray<TPair<const uint8*, SIZE_T>> Blocks;
+	const uint32 Alignments[] = { 1, 4, 8, 16, 64, 256 };
+	int32 Misaligned = 0;
+	for (int32 i = 0; i < 60; ++i)
+	{
+		const uint32 Alignment = Alignments[i % UE_ARRAY_COUNT(Alignments)];
+		const SIZE_T Size = 3 + (i * 37) % 200;
+		uint8* Ptr = static_cast<uint8*>(Arena.Allocate(Size, Alignment));
+		FMemory::Memset(Ptr, static_cast<uint8>(i), Size);
+		Misaligned += IsAligned(Ptr, Alignment) ? 0 : 1;
+		Blocks.Emplace(Ptr, Size);
+	}
+	TestEqual(TEXT("All allocations aligned"), Misaligned, 0);
+	TestTrue(TEXT("Allocations disjoint"), AreDisjoint(Blocks));
+	TestTrue(TEXT("Overflowed into several chunks"), Arena.GetStats().NumChunks > 1);
+	TestEqual(TEXT("Allocation count"), Arena.GetStats().NumAllocations, 60);
+
+	// Contents survive later allocations
+	int32 Corrupted = 0;
+	for (int32 i = 0; i < Blocks.Num(); ++i)
+	{
+		for (SIZE_T b = 0; b < Blocks[i].Value; ++b)
+		{
+			Corrupted += Blocks[i].Key[b] == static_cast<uint8>(i) ? 0 : 1;
+		}
+	}
+	TestEqual(TEXT("Contents intact"), Corrupted, 0);
+
+	// In-place growth of the last allocation, copy for older ones
+	uint8* Last = static_cast<uint8*>(Arena.Allocate(16, 16));
+	TestTrue(TEXT("Last allocation grows in place"), Arena.Reallocate(Last, 16, 64, 16) == Last);
+	uint8* Older = static_cast<uint8*>(Arena.Allocate(8, 8));
+	FMemory::Memset(Older, 0xAB, 8);
+	Arena.Allocate(8, 8);
+	uint8* Moved = static_cast<uint8*>(Arena.Reallocate(Older, 8, 32, 8));
+	TestTrue(TEXT("Older allocation moves"), Moved != Older);
+	TestTrue(TEXT("Moved contents copied"), Moved[0] == 0xAB && Moved[7] == 0xAB);
+	TestTrue(TEXT("Arena owns its blocks"), Arena.Owns(Moved) && Arena.Owns(Blocks[0].Key));
+
+	int32 HeapValue = 0;
+	TestFalse(TEXT("Arena does not own stack memory"), Arena.Owns(&HeapValue));
+
+	return true;
+}
+
+//=============================================================================
+// F-02: Reset and High-Water Mark
+// Reset coalesces overflow chunks into one chunk holding the high-water mark, so
+// repeating the frame allocates no further chunks; double buffering keeps the
+// previous frame's memory valid for one more frame
+//=============================================================================
+bool FKawaiiFluidFrameArenaTest_ResetAndHighWater::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidFrameArena Arena(4096);
+
+	auto RunFrame = [&Arena]()
+	{
+		for (int32 i = 0; i < 100; ++i)
+		{
+			Arena.Allocate(500, 16);
+		}
+	};
+
+	RunFrame();
+	const SIZE_T FrameBytes = Arena.GetStats().BytesUsed;
+	TestTrue(TEXT("First frame overflowed"), Arena.GetStats().NumChunks > 1);
+	TestTrue(TEXT("Bytes used covers requests"), FrameBytes >= 100 * 500);
+
+	const uint32 Generation = Arena.GetGeneration();
+	Arena.Reset();
+	TestTrue(TEXT("Generation advances"), Arena.GetGeneration() != Generation);
+	TestEqual(TEXT("High-water mark"), static_cast<int64>(Arena.GetStats().HighWaterMark), static_cast<int64>(FrameBytes));
+	TestEqual(TEXT("Coalesced to one chunk"), Arena.GetStats().NumChunks, 1);
+	TestTrue(TEXT("Chunk holds the high-water mark"), Arena.GetStats().Capacity >= FrameBytes);
+	TestEqual(TEXT("Bytes used cleared"), static_cast<int64>(Arena.GetStats().BytesUsed), static_cast<int64>(0));
+
+	const int32 ChunkAllocations = Arena.GetStats().NumChunkAllocations;
+	for (int32 Frame = 0; Frame < 10; ++Frame)
+	{
+		RunFrame();
+		Arena.Reset();
+	}
+	TestEqual(TEXT("Steady state allocates no chunks"), Arena.GetStats().NumChunkAllocations, ChunkAllocations);
+	TestEqual(TEXT("Reset count"), Arena.GetStats().NumResets, 11);
+
+	// Double buffering: frame N data readable during frame N + 1
+	FKawaiiFluidDoubleBufferedArena Buffered(1024);
+	Buffered.BeginFrame();
+	int32* FrameData = static_cast<int32*>(Buffered.GetCurrent().Allocate(sizeof(int32) * 64, alignof(int32)));
+	for (int32 i = 0; i < 64; ++i)
+	{
+		FrameData[i] = i * 3;
+	}
+	FKawaiiFluidFrameArena* FrameArena = &Buffered.GetCurrent();
+
+	Buffered.BeginFrame();
+	TestTrue(TEXT("Previous arena is last frame's"), &Buffered.GetPrevious() == FrameArena);
+	TestTrue(TEXT("Current arena differs"), &Buffered.GetCurrent() != FrameArena);
+	for (int32 i = 0; i < 256; ++i)
+	{
+		Buffered.GetCurrent().Allocate(64, 16);
+	}
+	bool bIntact = true;
+	for (int32 i = 0; i < 64; ++i)
+	{
+		bIntact &= FrameData[i] == i * 3;
+	}
+	TestTrue(TEXT("Previous frame data intact"), bIntact);
+	TestTrue(TEXT("Previous frame still counted"), FrameArena->GetStats().BytesUsed >= sizeof(int32) * 64);
+
+	Buffered.BeginFrame();
+	TestTrue(TEXT("Two flips reuse the arena"), &Buffered.GetCurrent() == FrameArena);
+	TestEqual(TEXT("Reused arena was reset"), static_cast<int64>(FrameArena->GetStats().BytesUsed), static_cast<int64>(0));
+	TestTrue(TEXT("High-water mark tracks both arenas"), Buffered.GetHighWaterMark() >= 256 * 64);
+
+	return true;
+}
+
+//=============================================================================
+// F-03: Container Adapter
+// Frame arrays bind to the active arena inside a scope and use the heap outside;
+// growth preserves contents; nested scopes restore the outer arena
+//=============================================================================
+bool FKawaiiFluidFrameArenaTest_ContainerAdapter::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidFrameArena Arena;
+	FKawaiiFluidFrameArena InnerArena;
+
+	TestNull(TEXT("No active arena by default"), FKawaiiFluidFrameArena::GetActive());
+	{
+		FKawaiiFluidFrameArenaScope Scope(Arena);
+		TestTrue(TEXT("Scope activates arena"), FKawaiiFluidFrameArena::GetActive() == &Arena);
+
+		TKawaiiFluidFrameArray<int32> Values;
+		for (int32 i = 0; i < 10000; ++i)
+		{
+			Values.Add(i);
+		}
+		TestTrue(TEXT("Array allocated from arena"), Arena.Owns(Values.GetData()));
+
+		bool bInOrder = true;
+		for (int32 i = 0; i < Values.Num(); ++i)
+		{
+			bInOrder &= Values[i] == i;
+		}
+		TestTrue(TEXT("Growth preserves contents"), bInOrder);
+		TestTrue(TEXT("Growth of the last allocation stays compact"), Arena.GetStats().BytesUsed < 4 * Values.Num() * sizeof(int32));
+
+		// Move keeps the arena block
+		const int32* Block = Values.GetData();
+		TKawaiiFluidFrameArray<int32> Moved = MoveTemp(Values);
+		TestTrue(TEXT("Move transfers the block"), Moved.GetData() == Block);
+		TestEqual(TEXT("Moved-from array empty"), Values.Num(), 0);
+
+		// Nested element containers (the cell query pattern)
+		TKawaiiFluidFrameArray<TKawaiiFluidFrameArray<int32>> Cells;
+		Cells.SetNum(16);
+		for (int32 Cell = 0; Cell < Cells.Num(); ++Cell)
+		{
+			Cells[Cell].Add(Cell);
+		}
+		TestTrue(TEXT("Nested arrays from arena"), Arena.Owns(Cells.GetData()) && Arena.Owns(Cells[15].GetData()));
+
+		{
+			FKawaiiFluidFrameArenaScope InnerScope(InnerArena);
+			TKawaiiFluidFrameArray<int32> Inner;
+			Inner.Add(1);
+			TestTrue(TEXT("Inner scope uses inner arena"), InnerArena.Owns(Inner.GetData()));
+
+			// Arrays keep their arena after the active arena changes
+			Moved.Add(-1);
+			TestTrue(TEXT("Existing array keeps its arena"), Arena.Owns(Moved.GetData()));
+		}
+		TestTrue(TEXT("Inner scope restores outer arena"), FKawaiiFluidFrameArena::GetActive() == &Arena);
+	}
+	TestNull(TEXT("Scope end clears active arena"), FKawaiiFluidFrameArena::GetActive());
+
+	// No active arena: heap fallback
+	TKawaiiFluidFrameArray<int32> HeapValues;
+	HeapValues.Init(7, 1000);
+	TestFalse(TEXT("Heap fallback outside scope"), Arena.Owns(HeapValues.GetData()) || InnerArena.Owns(HeapValues.GetData()));
+	HeapValues.Empty();
+	TestEqual(TEXT("Heap fallback frees"), HeapValues.Max(), 0);
+
+	return true;
+}
+
+//=============================================================================
+// F-04: Microbenchmark
+// Per-frame temporaries with the heap allocator vs the frame arena; results
+// must match and the arena must reach a steady state with no chunk allocations
+// (timings are informational)
+//=============================================================================
+bool FKawaiiFluidFrameArenaTest_Microbenchmark::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumFrames = 200;
+	constexpr int32 NumCells = 512;
+
+	// Cell sizes repeat every 24 frames; each arena of the pair sees every pattern by then
+	constexpr int32 WarmupFrames = 50;
+
+	uint64 HeapChecksum = 0;
+	const double HeapStart = FPlatformTime::Seconds();
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		HeapChecksum ^= BuildFrameTemporaries<TArray<int32>, TArray<TArray<int32>>>(NumCells, Frame);
+	}
+	const double HeapSeconds = FPlatformTime::Seconds() - HeapStart;
+
+	FKawaiiFluidDoubleBufferedArena Arenas;
+	uint64 ArenaChecksum = 0;
+	int32 WarmChunkAllocations = 0;
+	const double ArenaStart = FPlatformTime::Seconds();
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		Arenas.BeginFrame();
+		FKawaiiFluidFrameArenaScope Scope(Arenas.GetCurrent());
+		ArenaChecksum ^= BuildFrameTemporaries<TKawaiiFluidFrameArray<int32>, TKawaiiFluidFrameArray<TKawaiiFluidFrameArray<int32>>>(NumCells, Frame);
+
+		if (Frame == WarmupFrames)
+		{
+			WarmChunkAllocations = Arenas.GetCurrent().GetStats().NumChunkAllocations + Arenas.GetPrevious().GetStats().NumChunkAllocations;
+		}
+	}
+	const double ArenaSeconds = FPlatformTime::Seconds() - ArenaStart;
+
+	TestTrue(TEXT("Arena and heap results match"), ArenaChecksum == HeapChecksum);
+
+	const int32 FinalChunkAllocations = Arenas.GetCurrent().GetStats().NumChunkAllocations + Arenas.GetPrevious().GetStats().NumChunkAllocations;
+	TestEqual(TEXT("No chunk allocations after warm-up"), FinalChunkAllocations, WarmChunkAllocations);
+
+	AddInfo(FString::Printf(TEXT("Heap %.3f ms, arena %.3f ms per frame (%.2fx), high-water %llu bytes"),
+		HeapSeconds * 1000.0 / NumFrames, ArenaSeconds * 1000.0 / NumFrames,
+		ArenaSeconds > 0.0 ? HeapSeconds / ArenaSeconds : 0.0,
+		static_cast<uint64>(Arenas.GetHighWaterMark())));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
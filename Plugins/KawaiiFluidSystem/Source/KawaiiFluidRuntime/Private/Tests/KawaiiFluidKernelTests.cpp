@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Misc/AutomationTest.h"
 #include "Physics/SPHKernels.h"
+#include "Physics/SPHKernelTable.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -40,6 +41,76 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidKernelTest_UnitConversion,
 	"KawaiiFluid.Physics.Kernels.K08_UnitConversion",
 	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidKernelTest_TableAccuracy,
+	"KawaiiFluid.Physics.Kernels.K09_TableAccuracy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidKernelTest_TableNormalization,
+	"KawaiiFluid.Physics.Kernels.K10_TableNormalization",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidKernelTest_TableSimdMatchesScalar,
+	"KawaiiFluid.Physics.Kernels.K11_TableSimdMatchesScalar",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidKernelTest_TableSizing,
+	"KawaiiFluid.Physics.Kernels.K12_TableSizing",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	const ESPHKernelChannel::Type AllChannels[] =
+	{
+		ESPHKernelChannel::Poly6,
+		ESPHKernelChannel::SpikyGradient,
+		ESPHKernelChannel::ViscosityLaplacian,
+		ESPHKernelChannel::Adhesion,
+		ESPHKernelChannel::Cohesion,
+	};
+
+	const TCHAR* ChannelName(ESPHKernelChannel::Type Channel)
+	{
+		switch (Channel)
+		{
+		case ESPHKernelChannel::Poly6:              return TEXT("Poly6");
+		case ESPHKernelChannel::SpikyGradient:      return TEXT("SpikyGradient");
+		case ESPHKernelChannel::ViscosityLaplacian: return TEXT("ViscosityLaplacian");
+		case ESPHKernelChannel::Adhesion:           return TEXT("Adhesion");
+		case ESPHKernelChannel::Cohesion:           return TEXT("Cohesion");
+		default:                                    return TEXT("?");
+		}
+	}
+
+	/** Analytic SPHKernels value matching a table channel (r, h in cm) */
+	float AnalyticKernel(ESPHKernelChannel::Type Channel, float r, float h)
+	{
+		switch (Channel)
+		{
+		case ESPHKernelChannel::Poly6:              return SPHKernels::Poly6(r, h);
+		case ESPHKernelChannel::SpikyGradient:      return static_cast<float>(SPHKernels::SpikyGradient(FVector(r, 0.0, 0.0), h).X);
+		case ESPHKernelChannel::ViscosityLaplacian: return SPHKernels::ViscosityLaplacian(r, h);
+		case ESPHKernelChannel::Adhesion:           return SPHKernels::Adhesion(r, h);
+		case ESPHKernelChannel::Cohesion:           return SPHKernels::Cohesion(r, h);
+		default:                                    return 0.0f;
+		}
+	}
+
+	/** ∫ f(r) 4πr² dr over the support (midpoint rule, r in m, f sampled in cm) */
+	template<typename FuncType>
+	double IntegrateOverSphere(float h_cm, int32 NumSteps, FuncType&& Func)
+	{
+		const double h_m = h_cm * 0.01;
+		const double dr = h_m / NumSteps;
+		double Sum = 0.0;
+		for (int32 i = 0; i < NumSteps; ++i)
+		{
+			const double r_m = (i + 0.5) * dr;
+			Sum += Func(static_cast<float>(r_m * 100.0)) * 4.0 * PI * r_m * r_m * dr;
+		}
+		return Sum;
+	}
+}
+
 //=============================================================================
 // K-01: Poly6 Kernel Coefficient Test
 // Formula: 315 / (64 * PI * h^9)
@@ -300,4 +371,208 @@ bool FKawaiiFluidKernelTest_UnitConversion::RunTest(const FString& Parameters)
 	return true;
 }
 
+//=============================================================================
+// K-09: Kernel Table Accuracy
+// Table lookups match the analytic SPHKernels functions within the table's error
+// bound (relative to the channel peak), for linear and cubic interpolation
+//=============================================================================
+bool FKawaiiFluidKernelTest_TableAccuracy::RunTest(const FString& Parameters)
+{
+	const float h_cm = 20.0f;
+	const ESPHKernelInterpolation Modes[] = { ESPHKernelInterpolation::Linear, ESPHKernelInterpolation::Cubic };
+
+	for (ESPHKernelInterpolation Mode : Modes)
+	{
+		FSPHKernelTableSettings Settings;
+		Settings.Interpolation = Mode;
+		FSPHKernelTable Table;
+		TestTrue(TEXT("Table builds within the default bound"), Table.Build(h_cm, Settings));
+
+		for (ESPHKernelChannel::Type Channel : AllChannels)
+		{
+			// Dense probe that does not align with the table samples
+			const int32 NumProbes = 2000;
+			float Peak = 0.0f;
+			float MaxError = 0.0f;
+			for (int32 i = 0; i <= NumProbes; ++i)
+			{
+				const float r = h_cm * (Settings.MinRadiusRatio + (1.0f - Settings.MinRadiusRatio) * i / (NumProbes + 0.37f));
+				const float Exact = AnalyticKernel(Channel, r, h_cm);
+				Peak = FMath::Max(Peak, FMath::Abs(Exact));
+				MaxError = FMath::Max(MaxError, FMath::Abs(Table.Evaluate(Channel, r * r) - Exact));
+			}
+
+			const float RelativeError = Peak > 0.0f ? MaxError / Peak : MaxError;
+			const FString Label = FString::Printf(TEXT("%s (%s)"), ChannelName(Channel),
+				Mode == ESPHKernelInterpolation::Cubic ? TEXT("cubic") : TEXT("linear"));
+			AddInfo(FString::Printf(TEXT("%s: resolution %d, relative error %.2e"), *Label, Table.GetResolution(), RelativeError));
+
+			// Small slack for float rounding between the table and SPHKernels' own arithmetic
+			TestTrue(FString::Printf(TEXT("%s within bound (%.2e)"), *Label, RelativeError),
+				RelativeError <= Settings.MaxRelativeError * 1.05f + 1e-5f);
+		}
+
+		// Outside the support
+		for (ESPHKernelChannel::Type Channel : AllChannels)
+		{
+			// r²/h² may round just below 1, which lands on the vanishing end of the last interval
+			TestNearlyEqual(FString::Printf(TEXT("%s vanishes at r = h"), ChannelName(Channel)),
+				Table.Evaluate(Channel, h_cm * h_cm), 0.0f, FMath::Abs(Table.GetScale(Channel)) * 1e-6f);
+			TestEqual(FString::Printf(TEXT("%s is zero beyond h"), ChannelName(Channel)), Table.Evaluate(Channel, 2.0f * h_cm * h_cm), 0.0f);
+		}
+		TestEqual(TEXT("Adhesion is zero below h/2"), Table.Evaluate(ESPHKernelChannel::Adhesion, FMath::Square(0.4f * h_cm)), 0.0f);
+	}
+
+	return true;
+}
+
+//=============================================================================
+// K-10: Kernel Table Integral / Normalization
+// The tabulated Poly6 integrates to 1 over the sphere, and every channel's
+// integral matches the analytic kernel's integral
+//=============================================================================
+bool FKawaiiFluidKernelTest_TableNormalization::RunTest(const FString& Parameters)
+{
+	const float h_cm = 20.0f;
+	const int32 NumSteps = 4000;
+
+	FSPHKernelTable Table;
+	Table.Build(h_cm);
+
+	const double Poly6Integral = IntegrateOverSphere(h_cm, NumSteps,
+		[&Table](float r) { return Table.Evaluate(ESPHKernelChannel::Poly6, r * r); });
+	AddInfo(FString::Printf(TEXT("Tabulated Poly6 integral over sphere: %.5f"), Poly6Integral));
+	TestNearlyEqual(TEXT("Tabulated Poly6 integral is 1"), Poly6Integral, 1.0, 5e-3);
+
+	// Viscosity Laplacian: ∫ 45/(πh⁶)(h-r) 4πr² dr = 15/h²
+	const double h_m = h_cm * 0.01;
+	const double ViscosityIntegral = IntegrateOverSphere(h_cm, NumSteps,
+		[&Table](float r) { return Table.Evaluate(ESPHKernelChannel::ViscosityLaplacian, r * r); });
+	TestNearlyEqual(TEXT("Tabulated viscosity Laplacian integral is 15/h^2"), ViscosityIntegral * h_m * h_m, 15.0, 15.0 * 5e-3);
+
+	for (ESPHKernelChannel::Type Channel : AllChannels)
+	{
+		const double TableIntegral = IntegrateOverSphere(h_cm, NumSteps,
+			[&Table, Channel](float r) { return Table.Evaluate(Channel, r * r); });
+		const double ExactIntegral = IntegrateOverSphere(h_cm, NumSteps,
+			[Channel, h_cm](float r) { return AnalyticKernel(Channel, r, h_cm); });
+		const double AbsIntegral = IntegrateOverSphere(h_cm, NumSteps,
+			[Channel, h_cm](float r) { return FMath::Abs(AnalyticKernel(Channel, r, h_cm)); });
+
+		const double RelativeDifference = FMath::Abs(TableIntegral - ExactIntegral) / FMath::Max(AbsIntegral, UE_SMALL_NUMBER);
+		AddInfo(FString::Printf(TEXT("%s: table %.6e, analytic %.6e"), ChannelName(Channel), TableIntegral, ExactIntegral));
+		TestTrue(FString::Printf(TEXT("%s integral matches analytic (%.2e)"), ChannelName(Channel), RelativeDifference),
+			RelativeDifference <= 2e-3);
+	}
+
+	return true;
+}
+
+//=============================================================================
+// K-11: Kernel Table SIMD Matches Scalar
+// Evaluate4 / EvaluateBatch (including the scalar tail and out-of-support lanes)
+// return the same values as Evaluate
+//=============================================================================
+bool FKawaiiFluidKernelTest_TableSimdMatchesScalar::RunTest(const FString& Parameters)
+{
+	const float h_cm = 15.0f;
+	const ESPHKernelInterpolation Modes[] = { ESPHKernelInterpolation::Linear, ESPHKernelInterpolation::Cubic };
+
+	// 4n + 3 values: exercises the tail; r up to 1.2h covers masked lanes
+	FRandomStream Random(42);
+	TArray<float> R2;
+	for (int32 i = 0; i < 39; ++i)
+	{
+		R2.Add(FMath::Square(Random.FRandRange(0.0f, 1.2f * h_cm)));
+	}
+	R2[0] = 0.0f;
+	R2[1] = h_cm * h_cm;
+
+	for (ESPHKernelInterpolation Mode : Modes)
+	{
+		FSPHKernelTableSettings Settings;
+		Settings.Interpolation = Mode;
+		FSPHKernelTable Table;
+		Table.Build(h_cm, Settings);
+
+		for (ESPHKernelChannel::Type Channel : AllChannels)
+		{
+			TArray<float> Batch;
+			Batch.SetNumZeroed(R2.Num());
+			Table.EvaluateBatch(Channel, R2.GetData(), Batch.GetData(), R2.Num());
+
+			const float Tolerance = FMath::Abs(Table.GetScale(Channel)) * 1e-5f;
+			float MaxDifference = 0.0f;
+			for (int32 i = 0; i < R2.Num(); ++i)
+			{
+				MaxDifference = FMath::Max(MaxDifference, FMath::Abs(Batch[i] - Table.Evaluate(Channel, R2[i])));
+			}
+
+			const FString Label = FString::Printf(TEXT("%s (%s)"), ChannelName(Channel),
+				Mode == ESPHKernelInterpolation::Cubic ? TEXT("cubic") : TEXT("linear"));
+			TestTrue(FString::Printf(TEXT("%s: batch matches scalar (max %.2e)"), *Label, MaxDifference), MaxDifference <= Tolerance);
+
+			alignas(16) float Lanes[4];
+			VectorStoreAligned(Table.Evaluate4(Channel, MakeVectorRegisterFloat(R2[2], R2[3], 1.5f * h_cm * h_cm, R2[1])), Lanes);
+			TestTrue(FString::Printf(TEXT("%s: Evaluate4 lane 0"), *Label), FMath::Abs(Lanes[0] - Table.Evaluate(Channel, R2[2])) <= Tolerance);
+			TestTrue(FString::Printf(TEXT("%s: Evaluate4 lane 1"), *Label), FMath::Abs(Lanes[1] - Table.Evaluate(Channel, R2[3])) <= Tolerance);
+			TestEqual(FString::Printf(TEXT("%s: Evaluate4 masks r > h"), *Label), Lanes[2], 0.0f);
+			TestTrue(FString::Printf(TEXT("%s: Evaluate4 vanishes at r = h"), *Label), FMath::Abs(Lanes[3]) <= Tolerance);
+		}
+	}
+
+	return true;
+}
+
+//=============================================================================
+// K-12: Kernel Table Sizing
+// Resolution grows until every channel meets the error bound; a tighter bound
+// needs more samples, cubic needs fewer, and the shapes do not depend on h
+// (one uploaded buffer serves every radius)
+//=============================================================================
+bool FKawaiiFluidKernelTest_TableSizing::RunTest(const FString& Parameters)
+{
+	FSPHKernelTable Default;
+	TestTrue(TEXT("Default bound is met"), Default.Build(20.0f));
+	for (ESPHKernelChannel::Type Channel : AllChannels)
+	{
+		TestTrue(FString::Printf(TEXT("%s measured error within bound"), ChannelName(Channel)),
+			Default.GetMaxError(Channel) <= Default.GetSettings().MaxRelativeError);
+	}
+	TestEqual(TEXT("Shape data size"), Default.GetShapeData().Num(), Default.GetChannelStride() * static_cast<int32>(ESPHKernelChannel::Count));
+
+	FSPHKernelTableSettings Tight;
+	Tight.MaxRelativeError = 1e-4f;
+	FSPHKernelTable TightTable;
+	TestTrue(TEXT("Tight bound is met"), TightTable.Build(20.0f, Tight));
+	TestTrue(TEXT("Tighter bound needs a higher resolution"), TightTable.GetResolution() > Default.GetResolution());
+
+	FSPHKernelTableSettings Cubic;
+	Cubic.MaxRelativeError = 1e-4f;
+	Cubic.Interpolation = ESPHKernelInterpolation::Cubic;
+	FSPHKernelTable CubicTable;
+	TestTrue(TEXT("Cubic meets the tight bound"), CubicTable.Build(20.0f, Cubic));
+	TestTrue(TEXT("Cubic needs no more samples than linear"), CubicTable.GetResolution() <= TightTable.GetResolution());
+
+	FSPHKernelTableSettings Capped;
+	Capped.MaxRelativeError = 1e-7f;
+	Capped.MaxResolution = 256;
+	FSPHKernelTable CappedTable;
+	TestFalse(TEXT("Unreachable bound reports failure"), CappedTable.Build(20.0f, Capped));
+	TestTrue(TEXT("Capped table is still usable"), CappedTable.IsValid());
+	TestEqual(TEXT("Capped at MaxResolution"), CappedTable.GetResolution(), 256);
+
+	FSPHKernelTable Small;
+	FSPHKernelTable Large;
+	Small.Build(5.0f);
+	Large.Build(80.0f);
+	TestEqual(TEXT("Resolution does not depend on h"), Small.GetResolution(), Large.GetResolution());
+	TestTrue(TEXT("Shape data does not depend on h"), Small.GetShapeData() == Large.GetShapeData());
+
+	AddInfo(FString::Printf(TEXT("Resolution: default %d, tight %d, tight cubic %d"),
+		Default.GetResolution(), TightTable.GetResolution(), CubicTable.GetResolution()));
+
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
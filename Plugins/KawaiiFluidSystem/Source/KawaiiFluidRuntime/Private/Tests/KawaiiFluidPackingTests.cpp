@@ -0,0 +1,183 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Pre-settled Packing Unit Tests
+// Lattice calibration, density deviation after relaxation, shape containment, baked asset round trip
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Core/KawaiiFluidPackingRelaxer.h"
+#include "Data/KawaiiFluidPackingAsset.h"
+#include "Data/KawaiiFluidPresetDataAsset.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidPackingTest_LatticeCalibration,
+	"KawaiiFluid.Core.Packing.P01_LatticeCalibration",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidPackingTest_RelaxedDensityDeviation,
+	"KawaiiFluid.Core.Packing.P02_RelaxedDensityDeviation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidPackingTest_ShapeContainment,
+	"KawaiiFluid.Core.Packing.P03_ShapeContainment",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidPackingTest_BakedAssetRoundTrip,
+	"KawaiiFluid.Core.Packing.P04_BakedAssetRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/** Thresholds after TestIterations relaxation steps */
+	constexpr int32 TestIterations = 100;
+	constexpr float MaxRMSDeviation = 0.01f;
+	constexpr float MaxParticleDeviation = 0.03f;
+
+	FKawaiiFluidPackingParams MakeParams(const UKawaiiFluidPresetDataAsset& Preset, int32 Iterations)
+	{
+		FKawaiiFluidPackingParams Params = FKawaiiFluidPackingParams::FromPreset(Preset);
+		Params.Iterations = Iterations;
+		Params.Seed = 11;
+		return Params;
+	}
+}
+
+//=============================================================================
+// P-01: Lattice Calibration
+// The calibrated cubic lattice has bulk Poly6 density ρ₀; the preset spacing
+// (m = ρ₀d³) alone does not
+//=============================================================================
+bool FKawaiiFluidPackingTest_LatticeCalibration::RunTest(const FString& Parameters)
+{
+	const UKawaiiFluidPresetDataAsset* Preset = NewObject<UKawaiiFluidPresetDataAsset>();
+
+	const float Calibrated = FKawaiiFluidPackingRelaxer::CalibrateLatticeSpacing(Preset->SmoothingRadius, Preset->Density, Preset->ParticleMass);
+	const float CalibratedDensity = FKawaiiFluidPackingRelaxer::ComputeLatticeDensity(Calibrated, Preset->SmoothingRadius, Preset->ParticleMass);
+	const float NominalDensity = FKawaiiFluidPackingRelaxer::ComputeLatticeDensity(Preset->ParticleSpacing, Preset->SmoothingRadius, Preset->ParticleMass);
+
+	AddInfo(FString::Printf(TEXT("Preset spacing %.3f cm: %.1f kg/m³, calibrated %.3f cm: %.1f kg/m³ (ρ₀ = %.1f)"),
+		Preset->ParticleSpacing, NominalDensity, Calibrated, CalibratedDensity, Preset->Density));
+
+	TestTrue(TEXT("Calibrated lattice is at rest density"), FMath::Abs(CalibratedDensity / Preset->Density - 1.0f) < 1e-3f);
+	TestTrue(TEXT("Calibrated spacing stays close to the preset spacing"), FMath::Abs(Calibrated / Preset->ParticleSpacing - 1.0f) < 0.1f);
+	TestTrue(TEXT("Denser lattice has higher density"),
+		FKawaiiFluidPackingRelaxer::ComputeLatticeDensity(Calibrated * 0.9f, Preset->SmoothingRadius, Preset->ParticleMass) > CalibratedDensity);
+
+	return true;
+}
+
+//=============================================================================
+// P-02: Relaxed Density Deviation
+// After N relaxation steps every particle of a sphere is within a few percent
+// of rest density, far below the jittered seed lattice
+//=============================================================================
+bool FKawaiiFluidPackingTest_RelaxedDensityDeviation::RunTest(const FString& Parameters)
+{
+	const UKawaiiFluidPresetDataAsset* Preset = NewObject<UKawaiiFluidPresetDataAsset>();
+
+	FKawaiiFluidPackingRelaxer Relaxer(FKawaiiFluidPackingShape::MakeSphere(40.0f), MakeParams(*Preset, TestIterations));
+	const FKawaiiFluidPackingStats Stats = Relaxer.Relax();
+
+	AddInfo(FString::Printf(TEXT("%d particles, %d ghosts, lattice %.3f cm"), Stats.NumParticles, Stats.NumGhosts, Stats.LatticeSpacing));
+	AddInfo(FString::Printf(TEXT("Density deviation seed: RMS %.3f%% max %.3f%%, after %d steps: RMS %.3f%% max %.3f%%"),
+		Stats.InitialRMSDeviation * 100.0f, Stats.InitialMaxDeviation * 100.0f, TestIterations,
+		Stats.RMSDeviation * 100.0f, Stats.MaxDeviation * 100.0f));
+
+	TestTrue(TEXT("Sphere is populated"), Stats.NumParticles > 200);
+	TestTrue(TEXT("RMS deviation below threshold"), Stats.RMSDeviation < MaxRMSDeviation);
+	TestTrue(TEXT("Max deviation below threshold"), Stats.MaxDeviation < MaxParticleDeviation);
+	TestTrue(TEXT("Relaxation reduces the RMS deviation at least 5x"), Stats.RMSDeviation * 5.0f < Stats.InitialRMSDeviation);
+
+	return true;
+}
+
+//=============================================================================
+// P-03: Shape Containment
+// Box and cylinder packings stay inside their shape, relax below the
+// threshold, and reproduce bit for bit with the same seed
+//=============================================================================
+bool FKawaiiFluidPackingTest_ShapeContainment::RunTest(const FString& Parameters)
+{
+	const UKawaiiFluidPresetDataAsset* Preset = NewObject<UKawaiiFluidPresetDataAsset>();
+	const FKawaiiFluidPackingParams Params = MakeParams(*Preset, TestIterations);
+
+	const FKawaiiFluidPackingShape Shapes[] = {
+		FKawaiiFluidPackingShape::MakeBox(FVector(40.0, 30.0, 25.0)),
+		FKawaiiFluidPackingShape::MakeCylinder(30.0f, 40.0f)
+	};
+
+	for (const FKawaiiFluidPackingShape& Shape : Shapes)
+	{
+		FKawaiiFluidPackingRelaxer Relaxer(Shape, Params);
+		const FKawaiiFluidPackingStats Stats = Relaxer.Relax();
+		const TCHAR* ShapeName = Shape.Type == EKawaiiFluidEmitterShapeType::Cube ? TEXT("Box") : TEXT("Cylinder");
+
+		AddInfo(FString::Printf(TEXT("%s: %d particles, RMS %.3f%% max %.3f%%"),
+			ShapeName, Stats.NumParticles, Stats.RMSDeviation * 100.0f, Stats.MaxDeviation * 100.0f));
+
+		float MaxOutside = 0.0f;
+		for (const FVector& P : Relaxer.GetPositions())
+		{
+			MaxOutside = FMath::Max(MaxOutside, Shape.SignedDistance(P));
+		}
+		TestTrue(FString::Printf(TEXT("%s: particles stay inside"), ShapeName), MaxOutside <= 1e-3f);
+		TestTrue(FString::Printf(TEXT("%s: RMS deviation below threshold"), ShapeName), Stats.RMSDeviation < MaxRMSDeviation);
+		TestTrue(FString::Printf(TEXT("%s: max deviation below threshold"), ShapeName), Stats.MaxDeviation < MaxParticleDeviation);
+
+		FKawaiiFluidPackingRelaxer Repeat(Shape, Params);
+		Repeat.Relax();
+		TestTrue(FString::Printf(TEXT("%s: same seed, same packing"), ShapeName), Repeat.GetPositions() == Relaxer.GetPositions());
+	}
+
+	return true;
+}
+
+//=============================================================================
+// P-04: Baked Asset Round Trip
+// Bake stores 6 bytes per particle; instantiating by transform reproduces the
+// relaxed positions within the quantization error
+//=============================================================================
+bool FKawaiiFluidPackingTest_BakedAssetRoundTrip::RunTest(const FString& Parameters)
+{
+	UKawaiiFluidPresetDataAsset* Preset = NewObject<UKawaiiFluidPresetDataAsset>();
+	UKawaiiFluidPackingAsset* Packing = NewObject<UKawaiiFluidPackingAsset>();
+	TestFalse(TEXT("Not baked before Bake"), Packing->IsBaked());
+
+	Packing->Preset = Preset;
+	Packing->ShapeType = EKawaiiFluidEmitterShapeType::Cylinder;
+	Packing->CylinderRadius = 30.0f;
+	Packing->CylinderHalfHeight = 20.0f;
+	Packing->RelaxationIterations = TestIterations;
+	Packing->Seed = 11;
+	Packing->Bake();
+
+	TestTrue(TEXT("Baked"), Packing->IsBaked());
+	TestEqual(TEXT("Baked spacing from preset"), Packing->BakedParticleSpacing, Preset->ParticleSpacing);
+	TestTrue(TEXT("Baked deviation below threshold"), Packing->MaxDensityDeviation < MaxParticleDeviation);
+	TestTrue(TEXT("6 bytes per particle"), Packing->GetBakedDataSize() >= static_cast<SIZE_T>(Packing->NumParticles) * 6
+		&& Packing->GetBakedDataSize() < static_cast<SIZE_T>(Packing->NumParticles) * 8);
+
+	// Same relaxation as the bake
+	FKawaiiFluidPackingParams Params = MakeParams(*Preset, TestIterations);
+	FKawaiiFluidPackingRelaxer Relaxer(Packing->GetShape(), Params);
+	Relaxer.Relax();
+	TestEqual(TEXT("Particle count matches the relaxation"), Packing->NumParticles, Relaxer.GetPositions().Num());
+
+	const FTransform Transform(FRotator(30.0f, 45.0f, 10.0f).Quaternion(), FVector(500.0, -200.0, 300.0));
+	TArray<FVector> World;
+	Packing->GetPositions(Transform, World);
+
+	const float Tolerance = Packing->GetQuantizationError() * 2.0f + 1e-3f;
+	bool bAllMatch = World.Num() == Relaxer.GetPositions().Num();
+	for (int32 i = 0; bAllMatch && i < World.Num(); ++i)
+	{
+		bAllMatch = FVector::Dist(World[i], Transform.TransformPosition(Relaxer.GetPositions()[i])) <= Tolerance;
+	}
+	AddInfo(FString::Printf(TEXT("%d particles, %llu bytes, quantization error %.4f cm"),
+		Packing->NumParticles, static_cast<uint64>(Packing->GetBakedDataSize()), Packing->GetQuantizationError()));
+	TestTrue(TEXT("Instantiated positions match the relaxed packing"), bAllMatch);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
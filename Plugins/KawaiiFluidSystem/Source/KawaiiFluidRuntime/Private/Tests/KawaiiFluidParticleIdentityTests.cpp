@@ -0,0 +1,181 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Stable Particle Identity Unit Tests
+// ParticleID -> slot mapping and ID-indexed history must survive Z-Order slot permutation
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Core/KawaiiFluidParticleIdentity.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidParticleIdentityTest_InverseMapping,
+	"KawaiiFluid.Core.ParticleIdentity.I01_InverseMapping",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidParticleIdentityTest_HistoryAcrossReorder,
+	"KawaiiFluid.Core.ParticleIdentity.I02_HistoryAcrossReorder",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidParticleIdentityTest_HistoryBounded,
+	"KawaiiFluid.Core.ParticleIdentity.I03_HistoryBounded",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/** Simulates one Z-Order sort: random permutation of the slot -> ID array */
+	void ShuffleSlots(TArray<int32>& SlotToID, FRandomStream& Random)
+	{
+		for (int32 i = SlotToID.Num() - 1; i > 0; --i)
+		{
+			SlotToID.Swap(i, Random.RandRange(0, i));
+		}
+	}
+
+	/** Sliding ID window: IDs [FirstID, FirstID + Count) as produced by sequential allocation */
+	TArray<int32> MakeSequentialIDs(int32 FirstID, int32 Count)
+	{
+		TArray<int32> IDs;
+		IDs.SetNumUninitialized(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			IDs[i] = FirstID + i;
+		}
+		return IDs;
+	}
+}
+
+//=============================================================================
+// I-01: Inverse Mapping
+// FindSlot inverts the slot -> ID permutation after every simulated sort;
+// despawned and unknown IDs are not found
+//=============================================================================
+bool FKawaiiFluidParticleIdentityTest_InverseMapping::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(11);
+	FKawaiiFluidParticleIDMap IDMap;
+
+	TArray<int32> SlotToID = MakeSequentialIDs(1000, 5000);
+	for (int32 Substep = 0; Substep < 8; ++Substep)
+	{
+		ShuffleSlots(SlotToID, Random);
+		IDMap.Rebuild(SlotToID);
+
+		TestEqual(TEXT("All particles mapped"), IDMap.Num(), SlotToID.Num());
+
+		int32 Mismatches = 0;
+		for (int32 Slot = 0; Slot < SlotToID.Num(); ++Slot)
+		{
+			if (IDMap.FindSlot(SlotToID[Slot]) != Slot)
+			{
+				++Mismatches;
+			}
+		}
+		TestEqual(TEXT("FindSlot inverts the permutation"), Mismatches, 0);
+	}
+
+	TestEqual(TEXT("ID below window not found"), IDMap.FindSlot(999), static_cast<int32>(INDEX_NONE));
+	TestEqual(TEXT("ID above window not found"), IDMap.FindSlot(6000), static_cast<int32>(INDEX_NONE));
+	TestEqual(TEXT("Negative ID not found"), IDMap.FindSlot(-1), static_cast<int32>(INDEX_NONE));
+
+	// Despawn half (compaction moves survivors into the freed slots), spawn new IDs
+	SlotToID.SetNum(SlotToID.Num() / 2);
+	const int32 NextID = 1000 + 5000;
+	SlotToID.Append(MakeSequentialIDs(NextID + 100, 200));
+	ShuffleSlots(SlotToID, Random);
+	IDMap.Rebuild(SlotToID);
+
+	TestEqual(TEXT("Count after despawn/spawn"), IDMap.Num(), SlotToID.Num());
+	TestEqual(TEXT("New ID mapped"), SlotToID[IDMap.FindSlot(NextID + 150)], NextID + 150);
+
+	IDMap.Reset();
+	TestEqual(TEXT("Reset clears mapping"), IDMap.FindSlot(SlotToID[0]), static_cast<int32>(INDEX_NONE));
+
+	return true;
+}
+
+//=============================================================================
+// I-02: History Across Reorder
+// State stored by ParticleID stays attached to the same particle after its
+// slot moves; index-keyed state (the old behavior) would not
+//=============================================================================
+bool FKawaiiFluidParticleIdentityTest_HistoryAcrossReorder::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(23);
+	TKawaiiFluidParticleHistory<float> History(8192);
+
+	TArray<int32> SlotToID = MakeSequentialIDs(0, 4000);
+	for (int32 Slot = 0; Slot < SlotToID.Num(); ++Slot)
+	{
+		History.Set(SlotToID[Slot], static_cast<float>(SlotToID[Slot]) * 0.5f);
+	}
+
+	ShuffleSlots(SlotToID, Random);
+
+	int32 Mismatches = 0;
+	int32 IndexKeyedMismatches = 0;
+	for (int32 Slot = 0; Slot < SlotToID.Num(); ++Slot)
+	{
+		const int32 ParticleID = SlotToID[Slot];
+		const float* Value = History.Find(ParticleID);
+		if (!Value || *Value != static_cast<float>(ParticleID) * 0.5f)
+		{
+			++Mismatches;
+		}
+
+		// What an index-keyed lookup would have returned for this slot
+		const float* IndexKeyed = History.Find(Slot);
+		if (!IndexKeyed || *IndexKeyed != static_cast<float>(ParticleID) * 0.5f)
+		{
+			++IndexKeyedMismatches;
+		}
+	}
+
+	TestEqual(TEXT("ID-keyed history follows particles"), Mismatches, 0);
+	TestTrue(TEXT("Index-keyed history would attach to wrong particles"), IndexKeyedMismatches > SlotToID.Num() / 2);
+
+	return true;
+}
+
+//=============================================================================
+// I-03: History Bounded
+// Capacity is fixed (power of two); an ID Capacity apart evicts the older
+// entry instead of returning its state; memory does not grow with IDs
+//=============================================================================
+bool FKawaiiFluidParticleIdentityTest_HistoryBounded::RunTest(const FString& Parameters)
+{
+	TKawaiiFluidParticleHistory<float> History(1000);
+	TestEqual(TEXT("Capacity rounded to power of two"), History.GetCapacity(), 1024);
+
+	History.Set(5, 1.0f);
+	History.Set(5 + 1024, 2.0f);
+	TestNull(TEXT("Aliased older ID evicted"), History.Find(5));
+	TestTrue(TEXT("Newer ID stored"), History.Find(5 + 1024) && *History.Find(5 + 1024) == 2.0f);
+
+	History.Remove(5);
+	TestNotNull(TEXT("Remove of evicted ID keeps the owner's entry"), History.Find(5 + 1024));
+	History.Remove(5 + 1024);
+	TestNull(TEXT("Remove own entry"), History.Find(5 + 1024));
+
+	// Many spawn generations: capacity never changes, recent window stays valid
+	for (int32 ParticleID = 0; ParticleID < 100000; ++ParticleID)
+	{
+		History.Set(ParticleID, static_cast<float>(ParticleID));
+	}
+	TestEqual(TEXT("Capacity unchanged"), History.GetCapacity(), 1024);
+
+	int32 RecentFound = 0;
+	for (int32 ParticleID = 100000 - 1024; ParticleID < 100000; ++ParticleID)
+	{
+		const float* Value = History.Find(ParticleID);
+		RecentFound += (Value && *Value == static_cast<float>(ParticleID)) ? 1 : 0;
+	}
+	TestEqual(TEXT("Most recent Capacity IDs retained"), RecentFound, 1024);
+	TestNull(TEXT("Old generation evicted"), History.Find(0));
+
+	History.Set(-3, 1.0f);
+	TestNull(TEXT("Negative IDs ignored"), History.Find(-3));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
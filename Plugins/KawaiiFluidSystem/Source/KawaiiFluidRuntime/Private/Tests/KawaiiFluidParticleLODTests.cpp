@@ -0,0 +1,319 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Far-Field Particle LOD Unit Tests
+// Merge and split rules must conserve mass, linear momentum and center of mass, also when
+// applied as a despawn/spawn diff (BuildUpdate)
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Core/FluidParticle.h"
+#include "Core/KawaiiFluidParticleLOD.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidParticleLODTest_MergeConservation,
+	"KawaiiFluid.Core.ParticleLOD.L01_MergeConservation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidParticleLODTest_SplitConservation,
+	"KawaiiFluid.Core.ParticleLOD.L02_SplitConservation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidParticleLODTest_Eligibility,
+	"KawaiiFluid.Core.ParticleLOD.L03_Eligibility",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidParticleLODTest_RoundTrip,
+	"KawaiiFluid.Core.ParticleLOD.L04_RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidParticleLODTest_SpawnDespawnDiff,
+	"KawaiiFluid.Core.ParticleLOD.L05_SpawnDespawnDiff",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	struct FConservedQuantities
+	{
+		double Mass = 0.0;
+		FVector Momentum = FVector::ZeroVector;
+		FVector CenterOfMass = FVector::ZeroVector;
+	};
+
+	FConservedQuantities ComputeConserved(const TArray<FFluidParticle>& Particles)
+	{
+		FConservedQuantities Result;
+		FVector MassWeightedPosition = FVector::ZeroVector;
+		for (const FFluidParticle& Particle : Particles)
+		{
+			Result.Mass += Particle.Mass;
+			Result.Momentum += Particle.Velocity * Particle.Mass;
+			MassWeightedPosition += Particle.Position * Particle.Mass;
+		}
+		if (Result.Mass > 0.0)
+		{
+			Result.CenterOfMass = MassWeightedPosition / Result.Mass;
+		}
+		return Result;
+	}
+
+	// Slow particle block far from origin (viewer sits at origin)
+	TArray<FFluidParticle> CreateFarBlock(FRandomStream& Random, const FVector& Center, int32 GridSize, float Spacing)
+	{
+		TArray<FFluidParticle> Particles;
+		int32 ID = 0;
+		for (int32 x = 0; x < GridSize; ++x)
+		{
+			for (int32 y = 0; y < GridSize; ++y)
+			{
+				for (int32 z = 0; z < GridSize; ++z)
+				{
+					FFluidParticle Particle(Center + FVector(x, y, z) * Spacing, ID++);
+					Particle.Velocity = Random.GetUnitVector() * Random.FRandRange(0.0f, 30.0f);
+					Particle.SourceID = (x + y) % 2;
+					Particles.Add(Particle);
+				}
+			}
+		}
+		return Particles;
+	}
+
+	void TestConserved(FAutomationTestBase& Test, const FConservedQuantities& Before, const FConservedQuantities& After)
+	{
+		Test.TestEqual(TEXT("Mass conserved"), After.Mass, Before.Mass, 1.0e-3);
+		Test.TestTrue(TEXT("Momentum conserved"), After.Momentum.Equals(Before.Momentum, 1.0e-2));
+		Test.TestTrue(TEXT("Center of mass conserved"), After.CenterOfMass.Equals(Before.CenterOfMass, 1.0e-2));
+	}
+}
+
+//=============================================================================
+// L-01: Merge Conservation
+// Far, slow block collapses into representatives with identical mass,
+// momentum and center of mass; SourceIDs are never mixed
+//=============================================================================
+bool FKawaiiFluidParticleLODTest_MergeConservation::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(7);
+	FKawaiiFluidParticleLODSettings Settings;
+	TArray<FFluidParticle> Particles = CreateFarBlock(Random, FVector(10000.0f, 0.0f, 0.0f), 8, 10.0f);
+	const TArray<FVector> Viewers = { FVector::ZeroVector };
+
+	const int32 CountBefore = Particles.Num();
+	const FConservedQuantities Before = ComputeConserved(Particles);
+
+	const FKawaiiFluidParticleLODStats Stats = FKawaiiFluidParticleLOD::MergeFarParticles(Particles, Settings, Viewers);
+
+	TestTrue(TEXT("Particles merged"), Stats.NumRepresentativesCreated > 0);
+	TestEqual(TEXT("Count bookkeeping"), Particles.Num(), CountBefore - Stats.NumMergedParticles + Stats.NumRepresentativesCreated);
+	TestConserved(*this, Before, ComputeConserved(Particles));
+
+	int32 MaxRepresented = 0;
+	for (const FFluidParticle& Particle : Particles)
+	{
+		MaxRepresented = FMath::Max(MaxRepresented, FKawaiiFluidParticleLOD::GetRepresentedCount(Particle, Settings.BaseMass));
+	}
+	TestTrue(TEXT("Representatives bounded by MaxMergeCount"), MaxRepresented <= Settings.MaxMergeCount);
+
+	// Per-source mass must be conserved too (no cross-source merging)
+	for (int32 SourceID = 0; SourceID < 2; ++SourceID)
+	{
+		float SourceMass = 0.0f;
+		for (const FFluidParticle& Particle : Particles)
+		{
+			if (Particle.SourceID == SourceID)
+			{
+				SourceMass += Particle.Mass;
+			}
+		}
+		TestEqual(*FString::Printf(TEXT("Source %d mass conserved"), SourceID), SourceMass, 256.0f, 1.0e-3f);
+	}
+
+	return true;
+}
+
+//=============================================================================
+// L-02: Split Conservation
+// Heavy representatives near the viewer split into base-mass children
+// without changing mass, momentum or center of mass
+//=============================================================================
+bool FKawaiiFluidParticleLODTest_SplitConservation::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidParticleLODSettings Settings;
+	TArray<FFluidParticle> Particles;
+	for (int32 i = 0; i < 10; ++i)
+	{
+		FFluidParticle Particle(FVector(100.0f * i, 50.0f, 0.0f), i);
+		Particle.Mass = static_cast<float>(2 + (i % 7));
+		Particle.Velocity = FVector(i, -2.0f * i, 5.0f);
+		Particles.Add(Particle);
+	}
+	const TArray<FVector> Viewers = { FVector::ZeroVector };
+
+	const FConservedQuantities Before = ComputeConserved(Particles);
+	int32 NextID = 100;
+
+	const FKawaiiFluidParticleLODStats Stats = FKawaiiFluidParticleLOD::SplitNearParticles(Particles, Settings, Viewers, NextID);
+
+	TestEqual(TEXT("All representatives split"), Stats.NumRepresentativesSplit, 10);
+	TestEqual(TEXT("Children equal represented count"), Particles.Num(), static_cast<int32>(Before.Mass));
+	TestEqual(TEXT("New IDs allocated"), NextID, 100 + Particles.Num() - 10);
+	TestConserved(*this, Before, ComputeConserved(Particles));
+
+	bool bAllBaseMass = true;
+	TSet<int32> IDs;
+	for (const FFluidParticle& Particle : Particles)
+	{
+		bAllBaseMass &= FMath::IsNearlyEqual(Particle.Mass, Settings.BaseMass, 1.0e-4f);
+		IDs.Add(Particle.ParticleID);
+	}
+	TestTrue(TEXT("Children have base mass"), bAllBaseMass);
+	TestEqual(TEXT("Particle IDs unique"), IDs.Num(), Particles.Num());
+
+	return true;
+}
+
+//=============================================================================
+// L-03: Eligibility
+// Near, fast and attached particles are never merged;
+// nothing merges without a viewer
+//=============================================================================
+bool FKawaiiFluidParticleLODTest_Eligibility::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidParticleLODSettings Settings;
+	const TArray<FVector> Viewers = { FVector::ZeroVector };
+
+	TArray<FFluidParticle> Particles;
+	Particles.Add(FFluidParticle(FVector(100.0f, 0.0f, 0.0f), 0));	// Near
+	Particles.Add(FFluidParticle(FVector(101.0f, 0.0f, 0.0f), 1));	// Near
+
+	FFluidParticle Fast(FVector(10000.0f, 0.0f, 0.0f), 2);
+	Fast.Velocity = FVector(500.0f, 0.0f, 0.0f);
+	Particles.Add(Fast);
+	FFluidParticle Attached(FVector(10001.0f, 0.0f, 0.0f), 3);
+	Attached.bIsAttached = true;
+	Particles.Add(Attached);
+	Particles.Add(FFluidParticle(FVector(10002.0f, 0.0f, 0.0f), 4));	// Far, alone in its cluster
+
+	TArray<FFluidParticle> NoViewerCopy = Particles;
+	FKawaiiFluidParticleLODStats Stats = FKawaiiFluidParticleLOD::MergeFarParticles(NoViewerCopy, Settings, TConstArrayView<FVector>());
+	TestEqual(TEXT("No merge without viewers"), Stats.NumRepresentativesCreated, 0);
+
+	Stats = FKawaiiFluidParticleLOD::MergeFarParticles(Particles, Settings, Viewers);
+	TestEqual(TEXT("Nothing eligible merged"), Stats.NumRepresentativesCreated, 0);
+	TestEqual(TEXT("All particles kept"), Particles.Num(), 5);
+
+	return true;
+}
+
+//=============================================================================
+// L-04: Round Trip and Hysteresis
+// Representatives between SplitDistance and MergeDistance stay merged;
+// approaching restores the original particle count
+//=============================================================================
+bool FKawaiiFluidParticleLODTest_RoundTrip::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(99);
+	FKawaiiFluidParticleLODSettings Settings;
+	const FVector BlockCenter(10000.0f, 0.0f, 0.0f);
+	TArray<FFluidParticle> Particles = CreateFarBlock(Random, BlockCenter, 6, 10.0f);
+	const int32 OriginalCount = Particles.Num();
+	const FConservedQuantities Before = ComputeConserved(Particles);
+
+	const TArray<FVector> FarViewer = { FVector::ZeroVector };
+	FKawaiiFluidParticleLOD::MergeFarParticles(Particles, Settings, FarViewer);
+	const int32 MergedCount = Particles.Num();
+	TestTrue(TEXT("Merge reduced count"), MergedCount < OriginalCount);
+
+	// Viewer inside hysteresis band: no split
+	int32 NextID = OriginalCount;
+	const TArray<FVector> BandViewer = { BlockCenter - FVector(0.5f * (Settings.SplitDistance + Settings.MergeDistance), 0.0f, 0.0f) };
+	FKawaiiFluidParticleLOD::SplitNearParticles(Particles, Settings, BandViewer, NextID);
+	TestEqual(TEXT("No split inside hysteresis band"), Particles.Num(), MergedCount);
+
+	// Viewer next to the block: full resolution restored
+	const TArray<FVector> NearViewer = { BlockCenter };
+	FKawaiiFluidParticleLOD::SplitNearParticles(Particles, Settings, NearViewer, NextID);
+	TestEqual(TEXT("Original count restored"), Particles.Num(), OriginalCount);
+	TestConserved(*this, Before, ComputeConserved(Particles));
+
+	return true;
+}
+
+namespace
+{
+	/** Apply a BuildUpdate diff the way the GPU queues do: despawn by id, then spawn with fresh ids */
+	bool ApplyDiff(TArray<FFluidParticle>& Particles, const TArray<int32>& RemovedIDs,
+		const TArray<FFluidParticle>& AddedParticles, int32& InOutNextParticleID)
+	{
+		const TSet<int32> Removed(RemovedIDs);
+		const int32 NumBefore = Particles.Num();
+		Particles.RemoveAll([&Removed](const FFluidParticle& Particle) { return Removed.Contains(Particle.ParticleID); });
+		const bool bAllFound = NumBefore - Particles.Num() == RemovedIDs.Num();
+
+		for (FFluidParticle Added : AddedParticles)
+		{
+			Added.ParticleID = InOutNextParticleID++;
+			Particles.Add(Added);
+		}
+		return bAllFound;
+	}
+}
+
+//=============================================================================
+// L-05: Spawn/Despawn Diff
+// The runtime applies LOD steps as despawn-by-ID plus spawn requests; the
+// removed and added sets carry the same mass, momentum and center of mass,
+// and applying them matches the in-place rules
+//=============================================================================
+bool FKawaiiFluidParticleLODTest_SpawnDespawnDiff::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(7);
+	FKawaiiFluidParticleLODSettings Settings;
+	const FVector BlockCenter(10000.0f, 0.0f, 0.0f);
+	TArray<FFluidParticle> Particles = CreateFarBlock(Random, BlockCenter, 6, 10.0f);
+
+	// Near particles are never touched by a far viewer's merge
+	FFluidParticle& NearParticle = Particles.Add_GetRef(FFluidParticle(FVector(100.0f, 0.0f, 0.0f), Particles.Num()));
+	NearParticle.Velocity = FVector(1.0f, 2.0f, 3.0f);
+	const int32 NearID = NearParticle.ParticleID;
+
+	const int32 OriginalCount = Particles.Num();
+	const FConservedQuantities Before = ComputeConserved(Particles);
+	int32 NextParticleID = OriginalCount;
+
+	// Merge step
+	TArray<int32> RemovedIDs;
+	TArray<FFluidParticle> AddedParticles;
+	const TArray<FVector> FarViewer = { FVector::ZeroVector };
+	FKawaiiFluidParticleLODStats Stats = FKawaiiFluidParticleLOD::BuildUpdate(Particles, Settings, FarViewer, RemovedIDs, AddedParticles);
+
+	TestEqual(TEXT("Merge: every merged particle is despawned"), RemovedIDs.Num(), Stats.NumMergedParticles);
+	TestEqual(TEXT("Merge: one spawn per representative"), AddedParticles.Num(), Stats.NumRepresentativesCreated);
+	TestFalse(TEXT("Merge: near particle untouched"), RemovedIDs.Contains(NearID));
+
+	TArray<FFluidParticle> RemovedParticles = Particles.FilterByPredicate(
+		[&RemovedIDs](const FFluidParticle& Particle) { return RemovedIDs.Contains(Particle.ParticleID); });
+	TestConserved(*this, ComputeConserved(RemovedParticles), ComputeConserved(AddedParticles));
+	TestFalse(TEXT("Spawned particles get fresh ids from the caller"),
+		AddedParticles.ContainsByPredicate([](const FFluidParticle& Particle) { return Particle.ParticleID != INDEX_NONE; }));
+
+	TArray<FFluidParticle> InPlace = Particles;
+	FKawaiiFluidParticleLOD::MergeFarParticles(InPlace, Settings, FarViewer);
+
+	TestTrue(TEXT("Merge: every despawned id exists"), ApplyDiff(Particles, RemovedIDs, AddedParticles, NextParticleID));
+	TestEqual(TEXT("Merge: same count as the in-place rule"), Particles.Num(), InPlace.Num());
+	TestConserved(*this, Before, ComputeConserved(Particles));
+
+	// Split step: the viewer walks up to the block
+	const TArray<FVector> NearViewer = { BlockCenter };
+	Stats = FKawaiiFluidParticleLOD::BuildUpdate(Particles, Settings, NearViewer, RemovedIDs, AddedParticles);
+	TestEqual(TEXT("Split: every representative is despawned"), RemovedIDs.Num(), Stats.NumRepresentativesSplit);
+	TestEqual(TEXT("Split: children are spawned"), AddedParticles.Num(), Stats.NumSplitParticles);
+
+	TestTrue(TEXT("Split: every despawned id exists"), ApplyDiff(Particles, RemovedIDs, AddedParticles, NextParticleID));
+	TestEqual(TEXT("Split: original count restored"), Particles.Num(), OriginalCount);
+	TestConserved(*this, Before, ComputeConserved(Particles));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
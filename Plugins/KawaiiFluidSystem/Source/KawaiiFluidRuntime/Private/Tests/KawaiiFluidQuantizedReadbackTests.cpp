@@ -0,0 +1,218 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Quantized Readback Codec Unit Tests
+// Encode (CPU reference of FluidQuantizeReadback.usf) -> decode round trips stay within the documented error bounds
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "GPU/FluidQuantizedReadback.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidQuantizedReadbackTest_Position,
+	"KawaiiFluid.GPU.QuantizedReadback.Q01_PositionRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidQuantizedReadbackTest_Velocity,
+	"KawaiiFluid.GPU.QuantizedReadback.Q02_VelocityRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidQuantizedReadbackTest_PackedFields,
+	"KawaiiFluid.GPU.QuantizedReadback.Q03_PackedFields",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/** Random particle cloud inside [Min, Max] */
+	TArray<FGPUFluidParticle> MakeParticles(int32 Count, const FVector3f& Min, const FVector3f& Max, float MaxSpeed, FRandomStream& Random)
+	{
+		TArray<FGPUFluidParticle> Particles;
+		Particles.SetNum(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FGPUFluidParticle& P = Particles[i];
+			P.Position = FVector3f(
+				Random.FRandRange(Min.X, Max.X),
+				Random.FRandRange(Min.Y, Max.Y),
+				Random.FRandRange(Min.Z, Max.Z));
+			P.Velocity = FVector3f(Random.VRand()) * Random.FRandRange(0.0f, MaxSpeed);
+			P.ParticleID = i;
+		}
+		return Particles;
+	}
+
+	/** Angle between two directions (stable for tiny angles) */
+	double AngleBetween(const FVector3f& A, const FVector3f& B)
+	{
+		const FVector3d DA(A);
+		const FVector3d DB(B);
+		return FMath::Atan2(FVector3d::CrossProduct(DA, DB).Size(), FVector3d::DotProduct(DA, DB));
+	}
+}
+
+//=============================================================================
+// Q-01: Position Round Trip
+// Header bounds equal the exact particle AABB; every decoded position is
+// within half a quantization step per axis; degenerate bounds are exact
+//=============================================================================
+bool FKawaiiFluidQuantizedReadbackTest_Position::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(17);
+	const TArray<FGPUFluidParticle> Particles = MakeParticles(20000, FVector3f(-3000.0f, 250.0f, -40.0f), FVector3f(5000.0f, 1250.0f, 800.0f), 500.0f, Random);
+
+	FVector3f ExpectedMin(TNumericLimits<float>::Max());
+	FVector3f ExpectedMax(TNumericLimits<float>::Lowest());
+	for (const FGPUFluidParticle& P : Particles)
+	{
+		ExpectedMin = ExpectedMin.ComponentMin(P.Position);
+		ExpectedMax = ExpectedMax.ComponentMax(P.Position);
+	}
+
+	const GPUQuantizedReadback::FBounds Bounds = GPUQuantizedReadback::DecodeHeader(GPUQuantizedReadback::EncodeHeader(Particles));
+	TestTrue(TEXT("Header valid"), Bounds.IsValid());
+	TestEqual(TEXT("Header particle count"), Bounds.ParticleCount, Particles.Num());
+	TestTrue(TEXT("Header min is exact AABB min"), Bounds.Min == ExpectedMin);
+	TestTrue(TEXT("Header max is exact AABB max"), Bounds.Max == ExpectedMax);
+
+	// Half a step plus float rounding of the dequantization
+	const FVector3f Tolerance = Bounds.GetPositionErrorBound() * 1.01f + FVector3f(1.e-3f);
+	int32 OutOfBound = 0;
+	float WorstError = 0.0f;
+	for (const FGPUFluidParticle& P : Particles)
+	{
+		const FVector3f Error = (GPUQuantizedReadback::DecodePosition(GPUQuantizedReadback::EncodeParticle(P, Bounds), Bounds) - P.Position).GetAbs();
+		WorstError = FMath::Max(WorstError, Error.GetMax());
+		if (Error.X > Tolerance.X || Error.Y > Tolerance.Y || Error.Z > Tolerance.Z)
+		{
+			++OutOfBound;
+		}
+	}
+	TestEqual(TEXT("All positions within error bound"), OutOfBound, 0);
+	AddInfo(FString::Printf(TEXT("Worst position error %.4f cm (bound %.4f cm)"), WorstError, Tolerance.GetMax()));
+
+	// All particles at one point: extent clamps to MinExtent, decode is (near) exact
+	TArray<FGPUFluidParticle> Stacked;
+	Stacked.SetNum(4);
+	for (FGPUFluidParticle& P : Stacked)
+	{
+		P.Position = FVector3f(12.5f, -7.0f, 300.0f);
+	}
+	const GPUQuantizedReadback::FBounds StackedBounds = GPUQuantizedReadback::DecodeHeader(GPUQuantizedReadback::EncodeHeader(Stacked));
+	TestTrue(TEXT("Degenerate bounds decode exactly"),
+		GPUQuantizedReadback::DecodePosition(GPUQuantizedReadback::EncodeParticle(Stacked[0], StackedBounds), StackedBounds).Equals(Stacked[0].Position, 1.e-4f));
+
+	TestFalse(TEXT("Empty header invalid"), GPUQuantizedReadback::DecodeHeader(GPUQuantizedReadback::EncodeHeader(TArray<FGPUFluidParticle>())).IsValid());
+
+	return true;
+}
+
+//=============================================================================
+// Q-02: Velocity Round Trip
+// Direction error <= DirectionErrorBound and speed relative error <=
+// SpeedRelativeErrorBound over random and edge-case directions
+//=============================================================================
+bool FKawaiiFluidQuantizedReadbackTest_Velocity::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(31);
+	TArray<FGPUFluidParticle> Particles = MakeParticles(20000, FVector3f(0.0f), FVector3f(100.0f), 5000.0f, Random);
+
+	// Octahedral edge cases: axes, lower hemisphere diagonals, fold seams
+	const FVector3f EdgeDirections[] = {
+		FVector3f(1, 0, 0), FVector3f(-1, 0, 0), FVector3f(0, 1, 0), FVector3f(0, -1, 0),
+		FVector3f(0, 0, 1), FVector3f(0, 0, -1), FVector3f(1, 1, -1), FVector3f(-1, -1, -1),
+		FVector3f(1, -1, 0), FVector3f(-1, 0, -1e-3f), FVector3f(0.3f, -0.9f, -0.1f)
+	};
+	for (const FVector3f& Direction : EdgeDirections)
+	{
+		FGPUFluidParticle& P = Particles.AddDefaulted_GetRef();
+		P.Velocity = Direction.GetSafeNormal() * 321.0f;
+	}
+
+	const GPUQuantizedReadback::FBounds Bounds = GPUQuantizedReadback::DecodeHeader(GPUQuantizedReadback::EncodeHeader(Particles));
+	int32 DirectionFailures = 0;
+	int32 SpeedFailures = 0;
+	for (const FGPUFluidParticle& P : Particles)
+	{
+		const FVector3f Decoded = GPUQuantizedReadback::DecodeVelocity(GPUQuantizedReadback::EncodeParticle(P, Bounds));
+		const float Speed = P.Velocity.Length();
+		if (Speed < KINDA_SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		if (AngleBetween(P.Velocity, Decoded) > GPUQuantizedReadback::DirectionErrorBound)
+		{
+			++DirectionFailures;
+		}
+		if (FMath::Abs(Decoded.Length() - Speed) > Speed * GPUQuantizedReadback::SpeedRelativeErrorBound + 1.e-4f)
+		{
+			++SpeedFailures;
+		}
+	}
+	TestEqual(TEXT("Directions within bound"), DirectionFailures, 0);
+	TestEqual(TEXT("Speeds within bound"), SpeedFailures, 0);
+
+	FGPUFluidParticle Resting;
+	TestTrue(TEXT("Zero velocity decodes to zero"), GPUQuantizedReadback::DecodeVelocity(GPUQuantizedReadback::EncodeParticle(Resting, Bounds)).IsZero());
+
+	FGPUFluidParticle Fast;
+	Fast.Velocity = FVector3f(0.0f, 0.0f, -1.0e6f);
+	const FVector3f FastDecoded = GPUQuantizedReadback::DecodeVelocity(GPUQuantizedReadback::EncodeParticle(Fast, Bounds));
+	TestTrue(TEXT("Speed saturates at MaxSpeed"), FMath::IsNearlyEqual(FastDecoded.Length(), GPUQuantizedReadback::MaxSpeed, 1.0f));
+	TestTrue(TEXT("Saturated direction preserved"), AngleBetween(Fast.Velocity, FastDecoded) <= GPUQuantizedReadback::DirectionErrorBound);
+
+	return true;
+}
+
+//=============================================================================
+// Q-03: Packed Fields
+// ParticleID exact, SourceID (incl. invalid) exact, NeighborCount saturates,
+// all particle flags preserved; record is 20 bytes (>= 3x smaller than full)
+//=============================================================================
+bool FKawaiiFluidQuantizedReadbackTest_PackedFields::RunTest(const FString& Parameters)
+{
+	const GPUQuantizedReadback::FBounds Bounds = GPUQuantizedReadback::MakeBounds(FVector3f(0.0f), FVector3f(1.0f), 1);
+
+	const int32 ParticleIDs[] = { 0, 1, 65535, 65536, 123456789, MAX_int32 };
+	const int32 SourceIDs[] = { EGPUParticleSource::InvalidSourceID, 0, 63, 64, 1000, 65534 };
+	const uint32 NeighborCounts[] = { 0, 17, 255, 256, 100000 };
+
+	int32 Failures = 0;
+	for (int32 ParticleID : ParticleIDs)
+	{
+		for (int32 SourceID : SourceIDs)
+		{
+			for (uint32 NeighborCount : NeighborCounts)
+			{
+				FGPUFluidParticle P;
+				P.ParticleID = ParticleID;
+				P.SourceID = SourceID;
+				P.NeighborCount = NeighborCount;
+				P.Flags = EGPUParticleFlags::IsAttached | EGPUParticleFlags::IsSleeping | EGPUParticleFlags::WasIsolated;
+
+				const FQuantizedParticleStats Packed = GPUQuantizedReadback::EncodeParticle(P, Bounds);
+				const bool bOk = Packed.ParticleID == ParticleID
+					&& GPUQuantizedReadback::DecodeSourceID(Packed) == SourceID
+					&& GPUQuantizedReadback::DecodeNeighborCount(Packed) == FMath::Min(NeighborCount, GPUQuantizedReadback::MaxNeighborCount)
+					&& GPUQuantizedReadback::DecodeFlags(Packed) == P.Flags;
+				Failures += bOk ? 0 : 1;
+			}
+		}
+	}
+	TestEqual(TEXT("Integer fields round trip"), Failures, 0);
+
+	// Every defined flag fits in the packed byte
+	for (uint32 Bit = 0; Bit < 8; ++Bit)
+	{
+		FGPUFluidParticle P;
+		P.Flags = 1u << Bit;
+		TestEqual(FString::Printf(TEXT("Flag bit %u preserved"), Bit), static_cast<int32>(GPUQuantizedReadback::DecodeFlags(GPUQuantizedReadback::EncodeParticle(P, Bounds))), static_cast<int32>(P.Flags));
+	}
+
+	TestEqual(TEXT("Record size"), static_cast<int32>(sizeof(FQuantizedParticleStats)), 20);
+	TestTrue(TEXT("At least 3x smaller than full particle"), sizeof(FQuantizedParticleStats) * 3 <= sizeof(FGPUFluidParticle));
+	TestEqual(TEXT("Buffer size includes header"), static_cast<int32>(GPUQuantizedReadback::GetBufferSize(1000)), 32 + 1000 * 20);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
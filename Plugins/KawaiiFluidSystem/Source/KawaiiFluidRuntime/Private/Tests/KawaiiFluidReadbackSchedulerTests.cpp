@@ -0,0 +1,391 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Readback Scheduler Unit Tests
+// Ring state machine driven by a mock staging object: ordering, invalidation, slot recycling, dispatch,
+// particle count reconciliation under continuous spawn/despawn
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "GPU/GPUReadbackScheduler.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackSchedulerTest_Ordering,
+	"KawaiiFluid.GPU.ReadbackScheduler.R01_Ordering",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackSchedulerTest_Invalidate,
+	"KawaiiFluid.GPU.ReadbackScheduler.R02_Invalidate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackSchedulerTest_SlotRecycling,
+	"KawaiiFluid.GPU.ReadbackScheduler.R03_SlotRecycling",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackSchedulerTest_Dispatch,
+	"KawaiiFluid.GPU.ReadbackScheduler.R04_Dispatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackSchedulerTest_SpawnCountConvergence,
+	"KawaiiFluid.GPU.ReadbackScheduler.R05_SpawnCountConvergence",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/** Stand-in for FRHIGPUBufferReadback: the "GPU" finishes when the test says so */
+	struct FMockReadback
+	{
+		explicit FMockReadback(FName InName) : Name(InName) {}
+
+		void EnqueueCopy(TConstArrayView<uint32> Source)
+		{
+			Data = Source;
+			bReady = false;
+		}
+
+		bool IsReady() const { return bReady; }
+		void* Lock(uint32 NumBytes) { ++NumLocks; return Data.GetData(); }
+		void Unlock() {}
+
+		FName Name;
+		TArray<uint32> Data;
+		bool bReady = false;
+		int32 NumLocks = 0;
+
+		/** Frame the copy completes on, for tests that model GPU latency */
+		uint64 ReadyFrame = 0;
+	};
+
+	using FMockChannel = TGPUReadbackChannel<FMockReadback>;
+	using FMockScheduler = TGPUReadbackScheduler<FMockReadback>;
+
+	/** Enqueue a single uint32 value, returns the slot */
+	int32 EnqueueValue(FMockChannel& Channel, uint64 Frame, uint32 Value, FMockReadback** OutStaging = nullptr)
+	{
+		return Channel.Enqueue(Frame, sizeof(uint32), static_cast<int32>(Value), 0, [Value, OutStaging](FMockReadback& Staging)
+		{
+			Staging.EnqueueCopy(MakeArrayView(&Value, 1));
+			if (OutStaging)
+			{
+				*OutStaging = &Staging;
+			}
+		});
+	}
+
+	/** Consume the newest value, INDEX_NONE if nothing was consumed */
+	int64 ConsumeValue(FMockChannel& Channel, uint64 Frame)
+	{
+		int64 Value = INDEX_NONE;
+		Channel.ProcessNewest(Frame, [&Value](const void* Data, const FGPUReadbackSlotInfo& Info)
+		{
+			Value = *static_cast<const uint32*>(Data);
+		});
+		return Value;
+	}
+
+	/** Outcome of a simulated emission run */
+	struct FEmissionResult
+	{
+		int32 FinalCPUCount = 0;
+		int32 FinalGPUCount = 0;
+		int32 PeakGPUCount = 0;
+
+		/** Largest CPU - GPU difference while emitting (negative if the CPU ever undercounted) */
+		int32 MaxOvercount = 0;
+		int32 MinOvercount = 0;
+
+		FGPUReadbackChannelStats Stats;
+		int32 NumPendingBatches = 0;
+	};
+
+	/**
+	 * Spawn and despawn every frame like a continuous emitter with a kill plane:
+	 * spawns are known to the CPU, despawns only reach it through count readbacks
+	 * that complete 1-3 frames later (possibly out of order)
+	 */
+	FEmissionResult RunEmission(int32 MaxCount, int32 SpawnPerFrame, int32 MaxDespawnPerFrame, int32 EmitFrames, int32 TotalFrames)
+	{
+		FRandomStream Random(36);
+		FMockChannel Channel(TEXT("Count"));
+		FGPUSpawnCountTracker Tracker;
+		TArray<FMockReadback*> Stagings;
+		FEmissionResult Result;
+
+		int32 GPUCount = 0;
+		int32 CPUCount = 0;
+
+		for (uint64 Frame = 1; Frame <= static_cast<uint64>(TotalFrames); ++Frame)
+		{
+			// BeginFrame: consume the newest completed count
+			for (FMockReadback* Staging : Stagings)
+			{
+				Staging->bReady |= Frame >= Staging->ReadyFrame;
+			}
+			Channel.ProcessNewest(Frame, [&](const void* Data, const FGPUReadbackSlotInfo& Info)
+			{
+				CPUCount = Tracker.Reconcile(static_cast<uint32>(Info.Payload), static_cast<int32>(*static_cast<const uint32*>(Data)), MaxCount);
+			});
+
+			if (Frame <= static_cast<uint64>(EmitFrames))
+			{
+				// GPU-side removal the CPU does not see (despawn, recycle, kill plane)
+				GPUCount -= FMath::Min(Random.RandRange(0, MaxDespawnPerFrame), GPUCount);
+
+				// Spawn: the GPU clamps to capacity, the CPU keeps its estimate
+				GPUCount = FMath::Min(GPUCount + SpawnPerFrame, MaxCount);
+				CPUCount = FMath::Min(CPUCount + SpawnPerFrame, MaxCount);
+				Tracker.RecordSpawn(SpawnPerFrame);
+
+				Result.MaxOvercount = FMath::Max(Result.MaxOvercount, CPUCount - GPUCount);
+				Result.MinOvercount = FMath::Min(Result.MinOvercount, CPUCount - GPUCount);
+			}
+			Result.PeakGPUCount = FMath::Max(Result.PeakGPUCount, GPUCount);
+
+			// EndFrame: copy the count, tagged with the last spawn batch it includes
+			const uint32 Count = static_cast<uint32>(GPUCount);
+			const uint64 ReadyFrame = Frame + Random.RandRange(1, 3);
+			Channel.Enqueue(Frame, sizeof(uint32), static_cast<int32>(Tracker.GetSpawnSequence()), 0, [&](FMockReadback& Staging)
+			{
+				Staging.EnqueueCopy(MakeArrayView(&Count, 1));
+				Staging.ReadyFrame = ReadyFrame;
+				Stagings.AddUnique(&Staging);
+			});
+		}
+
+		Result.FinalCPUCount = CPUCount;
+		Result.FinalGPUCount = GPUCount;
+		Result.Stats = Channel.GetStats();
+		Result.NumPendingBatches = Tracker.GetNumPendingBatches();
+		return Result;
+	}
+}
+
+//=============================================================================
+// R-01: Ordering
+// The newest completed copy wins regardless of slot index; older completed copies are
+// dropped, and a copy completing after a newer one was consumed never goes back in time
+//=============================================================================
+bool FKawaiiFluidReadbackSchedulerTest_Ordering::RunTest(const FString& Parameters)
+{
+	FMockChannel Channel(TEXT("Ordering"));
+	FMockReadback* Staging[3] = {};
+
+	EnqueueValue(Channel, 1, 10, &Staging[0]);
+	EnqueueValue(Channel, 2, 20, &Staging[1]);
+	EnqueueValue(Channel, 3, 30, &Staging[2]);
+	TestEqual(TEXT("Nothing ready yet"), ConsumeValue(Channel, 3), static_cast<int64>(INDEX_NONE));
+
+	for (FMockReadback* S : Staging)
+	{
+		S->bReady = true;
+	}
+	TestEqual(TEXT("Newest of three ready copies consumed"), ConsumeValue(Channel, 4), static_cast<int64>(30));
+	TestEqual(TEXT("Older ready copies superseded"), static_cast<int32>(Channel.GetStats().NumSuperseded), 2);
+	TestEqual(TEXT("Each copy consumed at most once"), ConsumeValue(Channel, 5), static_cast<int64>(INDEX_NONE));
+
+	// Out-of-order completion: the newer copy finishes first
+	FMockReadback* Older = nullptr;
+	FMockReadback* Newer = nullptr;
+	EnqueueValue(Channel, 6, 60, &Older);
+	EnqueueValue(Channel, 7, 70, &Newer);
+	Newer->bReady = true;
+	TestEqual(TEXT("Newer copy completes first"), ConsumeValue(Channel, 8), static_cast<int64>(70));
+
+	Older->bReady = true;
+	TestEqual(TEXT("Late older copy is dropped"), ConsumeValue(Channel, 9), static_cast<int64>(INDEX_NONE));
+	TestEqual(TEXT("All slots free again"), Channel.GetRing().GetNumInFlight(), 0);
+
+	return true;
+}
+
+//=============================================================================
+// R-02: Invalidate
+// Full upload: copies enqueued before the CPU replaced the count must not
+// overwrite it when they complete; copies enqueued after the epoch change are used
+//=============================================================================
+bool FKawaiiFluidReadbackSchedulerTest_Invalidate::RunTest(const FString& Parameters)
+{
+	FMockChannel Channel(TEXT("Count"));
+	FMockReadback* Stale[2] = {};
+	FMockReadback* Fresh = nullptr;
+
+	// Idle frames: GPU count is 0
+	EnqueueValue(Channel, 1, 0, &Stale[0]);
+	EnqueueValue(Channel, 2, 0, &Stale[1]);
+
+	// Upload: CPU count 100, pre-upload copies are stale
+	int64 CurrentCount = 100;
+	Channel.Invalidate();
+	EnqueueValue(Channel, 3, 100, &Fresh);
+
+	Stale[0]->bReady = true;
+	Stale[1]->bReady = true;
+	const int64 Consumed = ConsumeValue(Channel, 4);
+	CurrentCount = Consumed != INDEX_NONE ? Consumed : CurrentCount;
+	TestEqual(TEXT("Stale zero readbacks ignored"), CurrentCount, static_cast<int64>(100));
+	TestEqual(TEXT("Stale copies counted as invalidated"), static_cast<int32>(Channel.GetStats().NumInvalidated), 2);
+	TestEqual(TEXT("Stale copies never locked"), Stale[0]->NumLocks + Stale[1]->NumLocks, 0);
+
+	Fresh->bReady = true;
+	TestEqual(TEXT("Post-upload copy consumed"), ConsumeValue(Channel, 5), static_cast<int64>(100));
+	TestEqual(TEXT("Epoch advanced once"), static_cast<int32>(Channel.GetRing().GetEpoch()), 1);
+
+	return true;
+}
+
+//=============================================================================
+// R-03: Slot Recycling
+// A full ring recycles the oldest in-flight slot, an acquired slot is never
+// recycled, latency is tracked in frames, staging objects are pooled
+//=============================================================================
+bool FKawaiiFluidReadbackSchedulerTest_SlotRecycling::RunTest(const FString& Parameters)
+{
+	FMockChannel Channel(TEXT("Recycle"), 3);
+	FMockReadback* First = nullptr;
+	FMockReadback* Fourth = nullptr;
+
+	const int32 FirstSlot = EnqueueValue(Channel, 10, 1, &First);
+	EnqueueValue(Channel, 11, 2);
+	EnqueueValue(Channel, 12, 3);
+	const int32 FourthSlot = EnqueueValue(Channel, 13, 4, &Fourth);
+
+	TestEqual(TEXT("Oldest in-flight slot recycled"), FourthSlot, FirstSlot);
+	TestTrue(TEXT("Staging object reused"), First == Fourth);
+	TestEqual(TEXT("Overwrite counted"), static_cast<int32>(Channel.GetStats().NumOverwritten), 1);
+
+	Fourth->bReady = true;
+	const int32 Acquired = Channel.AcquireNewest(16);
+	TestEqual(TEXT("Recycled slot carries the newest copy"), Acquired, FourthSlot);
+	TestEqual(TEXT("Latency in frames"), static_cast<int32>(Channel.GetStats().LastLatencyFrames), 3);
+	TestEqual(TEXT("Payload kept with the copy"), Channel.GetSlotInfo(Acquired).Payload, 4);
+
+	// Acquired slot is locked by the consumer: the other two are recycled instead
+	EnqueueValue(Channel, 14, 5);
+	EnqueueValue(Channel, 15, 6);
+	TestEqual(TEXT("Acquired slot untouched"), Channel.GetSlotInfo(Acquired).Payload, 4);
+	Channel.Release(Acquired);
+
+	FMockChannel Single(TEXT("Single"), 1);
+	FMockReadback* Only = nullptr;
+	EnqueueValue(Single, 1, 7, &Only);
+	Only->bReady = true;
+	const int32 Locked = Single.AcquireNewest(2);
+	TestEqual(TEXT("No slot while the only slot is acquired"), EnqueueValue(Single, 2, 8), static_cast<int32>(INDEX_NONE));
+	Single.Release(Locked);
+	TestTrue(TEXT("Slot available after release"), EnqueueValue(Single, 3, 9) != INDEX_NONE);
+
+	Channel.ReleaseResources();
+	TestFalse(TEXT("Staging objects released"), Channel.HasStagingResources());
+
+	return true;
+}
+
+//=============================================================================
+// R-04: Dispatch
+// One ProcessCompleted call dispatches typed data to each consumer in registration
+// order; channels without a consumer are left for manual processing
+//=============================================================================
+bool FKawaiiFluidReadbackSchedulerTest_Dispatch::RunTest(const FString& Parameters)
+{
+	FMockScheduler Scheduler;
+	const int32 CountChannel = Scheduler.AddChannel(TEXT("Count"));
+	const int32 BoundsChannel = Scheduler.AddChannel(TEXT("Bounds"));
+	const int32 ManualChannel = Scheduler.AddChannel(TEXT("Manual"));
+
+	TArray<FString> Order;
+	int32 ReceivedCount = 0;
+	FVector3f ReceivedMax = FVector3f::ZeroVector;
+	uint64 ReceivedFrame = 0;
+
+	Scheduler.SetConsumer<uint32>(CountChannel, [&](TConstArrayView<uint32> Data, const FGPUReadbackSlotInfo& Info)
+	{
+		Order.Add(TEXT("Count"));
+		ReceivedCount = Data.Num() > 6 ? static_cast<int32>(Data[6]) : -1;
+	});
+	Scheduler.SetConsumer<FVector3f>(BoundsChannel, [&](TConstArrayView<FVector3f> Data, const FGPUReadbackSlotInfo& Info)
+	{
+		Order.Add(TEXT("Bounds"));
+		ReceivedMax = Data.Num() == 2 ? Data[1] : FVector3f::ZeroVector;
+		ReceivedFrame = Info.FrameNumber;
+	});
+
+	// 11 x uint32 count buffer with the raw count at element 6
+	TArray<uint32> CountBuffer;
+	CountBuffer.SetNumZeroed(11);
+	CountBuffer[6] = 4242;
+	Scheduler.GetChannel(CountChannel).Enqueue(1, CountBuffer.Num() * sizeof(uint32), 0, 0, [&CountBuffer](FMockReadback& Staging)
+	{
+		Staging.EnqueueCopy(CountBuffer);
+		Staging.bReady = true;
+	});
+
+	const FVector3f Bounds[2] = { FVector3f(-1.0f), FVector3f(2.0f, 3.0f, 4.0f) };
+	Scheduler.GetChannel(BoundsChannel).Enqueue(1, sizeof(Bounds), 0, 0, [&Bounds](FMockReadback& Staging)
+	{
+		Staging.EnqueueCopy(MakeArrayView(reinterpret_cast<const uint32*>(Bounds), sizeof(Bounds) / sizeof(uint32)));
+		Staging.bReady = true;
+	});
+
+	Scheduler.GetChannel(ManualChannel).Enqueue(1, sizeof(uint32), 0, 0, [](FMockReadback& Staging)
+	{
+		Staging.EnqueueCopy(TArray<uint32>({ 1u }));
+		Staging.bReady = true;
+	});
+
+	TestEqual(TEXT("Two consumers dispatched"), Scheduler.ProcessCompleted(3), 2);
+	TestEqual(TEXT("Registration order"), FString::Join(Order, TEXT(",")), FString(TEXT("Count,Bounds")));
+	TestEqual(TEXT("Typed count element"), ReceivedCount, 4242);
+	TestTrue(TEXT("Typed bounds max"), ReceivedMax == Bounds[1]);
+	TestEqual(TEXT("Slot info forwarded"), static_cast<int32>(ReceivedFrame), 1);
+	TestEqual(TEXT("Manual channel untouched"), Scheduler.GetChannel(ManualChannel).GetRing().GetNumInFlight(), 1);
+	TestEqual(TEXT("Nothing left to dispatch"), Scheduler.ProcessCompleted(4), 0);
+
+	Scheduler.ReleaseResources();
+	TestFalse(TEXT("Resources released"), Scheduler.GetChannel(CountChannel).HasStagingResources());
+	TestEqual(TEXT("Channels stay registered"), Scheduler.GetNumChannels(), 3);
+
+	return true;
+}
+
+//=============================================================================
+// R-05: Spawn Count Convergence
+// Spawn and despawn every frame: in-flight count copies keep being consumed
+// (spawns are added back by tag instead of invalidating the channel), the CPU
+// count never drifts from the GPU count and matches it once emission stops
+//=============================================================================
+bool FKawaiiFluidReadbackSchedulerTest_SpawnCountConvergence::RunTest(const FString& Parameters)
+{
+	constexpr int32 SpawnPerFrame = 20;
+	constexpr int32 MaxDespawnPerFrame = 40;
+	constexpr int32 EmitFrames = 600;
+	constexpr int32 TotalFrames = EmitFrames + 8;
+
+	// Despawns outpace spawns on average: the count settles well below capacity
+	const FEmissionResult Open = RunEmission(100000, SpawnPerFrame, MaxDespawnPerFrame, EmitFrames, TotalFrames);
+	TestTrue(TEXT("Readbacks consumed while emitting"), Open.Stats.NumConsumed > static_cast<uint64>(EmitFrames / 2));
+	TestEqual(TEXT("No readback invalidated by spawns"), static_cast<int32>(Open.Stats.NumInvalidated), 0);
+	TestTrue(TEXT("Population stays far below capacity"), Open.PeakGPUCount < 1000);
+	TestTrue(FString::Printf(TEXT("CPU never undercounts (min %d)"), Open.MinOvercount), Open.MinOvercount >= 0);
+	TestTrue(FString::Printf(TEXT("Overcount bounded by readback latency (max %d)"), Open.MaxOvercount), Open.MaxOvercount <= 4 * MaxDespawnPerFrame);
+	TestEqual(TEXT("Converged after emission"), Open.FinalCPUCount, Open.FinalGPUCount);
+	TestEqual(TEXT("No spawn batch left pending"), Open.NumPendingBatches, 0);
+
+	// Spawns slightly outpace despawns: the GPU clamps at capacity and dips below it,
+	// the CPU count must follow those dips instead of sticking to the capacity
+	constexpr int32 CappedDespawnPerFrame = 50;
+	const FEmissionResult Capped = RunEmission(500, 30, CappedDespawnPerFrame, EmitFrames, TotalFrames);
+	TestEqual(TEXT("Capacity reached"), Capped.PeakGPUCount, 500);
+	TestTrue(TEXT("Capped: CPU never undercounts"), Capped.MinOvercount >= 0);
+	TestTrue(FString::Printf(TEXT("Capped: overcount bounded (max %d)"), Capped.MaxOvercount), Capped.MaxOvercount <= 4 * CappedDespawnPerFrame);
+	TestEqual(TEXT("Capped: converged after emission"), Capped.FinalCPUCount, Capped.FinalGPUCount);
+
+	// Idle tracker: a readback passes the GPU count through
+	FGPUSpawnCountTracker Tracker;
+	TestEqual(TEXT("No spawns: GPU count used as is"), Tracker.Reconcile(0, 321, 1000), 321);
+	const uint32 Tag = Tracker.RecordSpawn(50);
+	TestEqual(TEXT("Copy before the spawn adds it"), Tracker.Reconcile(Tag - 1, 321, 1000), 371);
+	TestEqual(TEXT("Copy after the spawn does not"), Tracker.Reconcile(Tag, 371, 1000), 371);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,389 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Sparse-Brick SDF Cache Unit Tests
+// Builder and trilinear sampler verified against analytic signed distances, owners and downward traces,
+// plus the flattened GPU brick layout
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Collision/KawaiiFluidSDFCache.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSDFCacheTest_AnalyticShapes,
+	"KawaiiFluid.Collision.SDFCache.S01_AnalyticShapes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSDFCacheTest_SampleMatchesAnalytic,
+	"KawaiiFluid.Collision.SDFCache.S02_SampleMatchesAnalytic",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSDFCacheTest_PerOwnerInvalidation,
+	"KawaiiFluid.Collision.SDFCache.S03_PerOwnerInvalidation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSDFCacheTest_AsyncMatchesSync,
+	"KawaiiFluid.Collision.SDFCache.S04_AsyncMatchesSync",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSDFCacheTest_OwnersAndRaycast,
+	"KawaiiFluid.Collision.SDFCache.S05_OwnersAndRaycast",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSDFCacheTest_GPUBrickData,
+	"KawaiiFluid.Collision.SDFCache.S06_GPUBrickData",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	// Axis-aligned cube as a convex hull (6 outward planes)
+	FKawaiiFluidSDFShape MakeConvexCube(const FVector& Center, float HalfSize)
+	{
+		TArray<FPlane> Planes;
+		const FVector Axes[] = { FVector::XAxisVector, FVector::YAxisVector, FVector::ZAxisVector };
+		for (const FVector& Axis : Axes)
+		{
+			Planes.Add(FPlane(Axis, FVector::DotProduct(Axis, Center) + HalfSize));
+			Planes.Add(FPlane(-Axis, FVector::DotProduct(-Axis, Center) + HalfSize));
+		}
+		return FKawaiiFluidSDFShape::MakeConvex(Center, HalfSize * UE_SQRT_3, MoveTemp(Planes));
+	}
+
+	float EvaluateAll(const TArray<FKawaiiFluidSDFShape>& Shapes, const FVector& Position)
+	{
+		float Distance = TNumericLimits<float>::Max();
+		for (const FKawaiiFluidSDFShape& Shape : Shapes)
+		{
+			Distance = FMath::Min(Distance, Shape.Evaluate(Position));
+		}
+		return Distance;
+	}
+}
+
+//=============================================================================
+// S-01: Analytic Shape Distances
+// Sphere, capsule, rotated box and convex hull distances at known points
+//=============================================================================
+bool FKawaiiFluidSDFCacheTest_AnalyticShapes::RunTest(const FString& Parameters)
+{
+	const FKawaiiFluidSDFShape Sphere = FKawaiiFluidSDFShape::MakeSphere(FVector(100.0f, 0.0f, 0.0f), 50.0f);
+	TestEqual(TEXT("Sphere outside"), Sphere.Evaluate(FVector(200.0f, 0.0f, 0.0f)), 50.0f, 1.0e-3f);
+	TestEqual(TEXT("Sphere center"), Sphere.Evaluate(FVector(100.0f, 0.0f, 0.0f)), -50.0f, 1.0e-3f);
+
+	const FKawaiiFluidSDFShape Capsule = FKawaiiFluidSDFShape::MakeCapsule(FVector::ZeroVector, FVector(0.0f, 0.0f, 100.0f), 10.0f);
+	TestEqual(TEXT("Capsule side"), Capsule.Evaluate(FVector(30.0f, 0.0f, 50.0f)), 20.0f, 1.0e-3f);
+	TestEqual(TEXT("Capsule cap"), Capsule.Evaluate(FVector(0.0f, 0.0f, 130.0f)), 20.0f, 1.0e-3f);
+
+	// Box rotated 90 degrees around Z: local X extent lies along world Y
+	const FKawaiiFluidSDFShape Box = FKawaiiFluidSDFShape::MakeBox(FVector::ZeroVector, FVector(100.0f, 10.0f, 10.0f),
+		FQuat(FVector::ZAxisVector, UE_HALF_PI));
+	TestEqual(TEXT("Rotated box along long axis"), Box.Evaluate(FVector(0.0f, 150.0f, 0.0f)), 50.0f, 1.0e-2f);
+	TestEqual(TEXT("Rotated box along short axis"), Box.Evaluate(FVector(30.0f, 0.0f, 0.0f)), 20.0f, 1.0e-2f);
+	TestEqual(TEXT("Rotated box inside"), Box.Evaluate(FVector::ZeroVector), -10.0f, 1.0e-2f);
+	TestEqual(TEXT("Box corner (euclidean)"), Box.Evaluate(FVector(13.0f, 104.0f, 0.0f)), 5.0f, 1.0e-2f);
+
+	const FKawaiiFluidSDFShape Convex = MakeConvexCube(FVector(0.0f, 0.0f, 500.0f), 20.0f);
+	TestEqual(TEXT("Convex face"), Convex.Evaluate(FVector(0.0f, 0.0f, 530.0f)), 10.0f, 1.0e-3f);
+	TestEqual(TEXT("Convex inside"), Convex.Evaluate(FVector(0.0f, 0.0f, 500.0f)), -20.0f, 1.0e-3f);
+
+	TestTrue(TEXT("Box bounds contain rotated extent"), Box.GetBounds().IsInside(FVector(0.0f, 99.0f, 0.0f)));
+
+	return true;
+}
+
+//=============================================================================
+// S-02: Trilinear Sample vs Analytic
+// Inside the narrow band the cached distance stays within a fraction of a voxel
+// and the gradient points along the analytic normal
+//=============================================================================
+bool FKawaiiFluidSDFCacheTest_SampleMatchesAnalytic::RunTest(const FString& Parameters)
+{
+	const float VoxelSize = 5.0f;
+	const float NarrowBand = 20.0f;
+	FKawaiiFluidSDFCache Cache(VoxelSize, NarrowBand);
+
+	const FVector SphereCenter(37.0f, -12.0f, 8.0f);
+	const float SphereRadius = 60.0f;
+	TArray<FKawaiiFluidSDFShape> Shapes = { FKawaiiFluidSDFShape::MakeSphere(SphereCenter, SphereRadius) };
+	Cache.SetOwnerShapes(1, Shapes);
+	Cache.BuildDirtyBricks();
+
+	TestTrue(TEXT("Bricks allocated"), Cache.GetNumBricks() > 0);
+	TestEqual(TEXT("No dirty bricks after build"), Cache.GetNumDirtyBricks(), 0);
+
+	FRandomStream Random(2024);
+	float MaxError = 0.0f;
+	float MinNormalDot = 1.0f;
+	int32 Missing = 0;
+
+	for (int32 i = 0; i < 1000; ++i)
+	{
+		const FVector Direction = Random.GetUnitVector();
+		const float Offset = Random.FRandRange(-NarrowBand * 0.5f, NarrowBand * 0.5f);
+		const FVector Position = SphereCenter + Direction * (SphereRadius + Offset);
+
+		float Distance;
+		FVector Normal;
+		if (!Cache.Sample(Position, Distance, Normal))
+		{
+			++Missing;
+			continue;
+		}
+
+		MaxError = FMath::Max(MaxError, FMath::Abs(Distance - EvaluateAll(Shapes, Position)));
+		MinNormalDot = FMath::Min(MinNormalDot, static_cast<float>(FVector::DotProduct(Normal, Direction)));
+	}
+
+	TestEqual(TEXT("Narrow band fully covered"), Missing, 0);
+	TestTrue(*FString::Printf(TEXT("Distance error %.3f below quarter voxel"), MaxError), MaxError < VoxelSize * 0.25f);
+	TestTrue(*FString::Printf(TEXT("Normal alignment %.3f"), MinNormalDot), MinNormalDot > 0.95f);
+
+	// Far away: no brick
+	float Distance;
+	FVector Normal;
+	TestFalse(TEXT("Far position reads as empty"), Cache.Sample(SphereCenter + FVector(1000.0f, 0.0f, 0.0f), Distance, Normal));
+
+	return true;
+}
+
+//=============================================================================
+// S-03: Per-Owner Invalidation
+// Changing one owner only rebuilds its own bricks; removing it clears them
+//=============================================================================
+bool FKawaiiFluidSDFCacheTest_PerOwnerInvalidation::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSDFCache Cache(10.0f, 30.0f);
+
+	const FVector FarBoxCenter(5000.0f, 0.0f, 0.0f);
+	Cache.SetOwnerShapes(1, { FKawaiiFluidSDFShape::MakeSphere(FVector::ZeroVector, 50.0f) });
+	Cache.SetOwnerShapes(2, { FKawaiiFluidSDFShape::MakeBox(FarBoxCenter, FVector(40.0f), FQuat::Identity) });
+	Cache.BuildDirtyBricks();
+	const int32 InitialBricks = Cache.GetNumBricks();
+
+	// Re-submitting identical shapes is free
+	Cache.SetOwnerShapes(2, { FKawaiiFluidSDFShape::MakeBox(FarBoxCenter, FVector(40.0f), FQuat::Identity) });
+	TestEqual(TEXT("Unchanged owner dirties nothing"), Cache.GetNumDirtyBricks(), 0);
+
+	// Moving the sphere dirties only bricks near the sphere
+	Cache.SetOwnerShapes(1, { FKawaiiFluidSDFShape::MakeSphere(FVector(20.0f, 0.0f, 0.0f), 50.0f) });
+	const int32 Dirty = Cache.GetNumDirtyBricks();
+	TestTrue(TEXT("Moved owner dirties bricks"), Dirty > 0);
+	TestTrue(TEXT("Dirty set smaller than whole cache"), Dirty < InitialBricks * 2);
+	Cache.BuildDirtyBricks();
+
+	float Distance;
+	FVector Normal;
+	TestTrue(TEXT("Moved sphere sampled"), Cache.Sample(FVector(80.0f, 0.0f, 0.0f), Distance, Normal));
+	TestEqual(TEXT("Moved sphere distance"), Distance, 10.0f, 1.0f);
+
+	// Removing the box clears its bricks, sphere untouched
+	Cache.RemoveOwner(2);
+	Cache.BuildDirtyBricks();
+	TestFalse(TEXT("Removed owner bricks cleared"), Cache.Sample(FarBoxCenter + FVector(45.0f, 0.0f, 0.0f), Distance, Normal));
+	TestTrue(TEXT("Other owner kept"), Cache.Sample(FVector(80.0f, 0.0f, 0.0f), Distance, Normal));
+	TestEqual(TEXT("Owner count"), Cache.GetNumOwners(), 1);
+
+	return true;
+}
+
+//=============================================================================
+// S-04: Background Build Matches Synchronous Build
+//=============================================================================
+bool FKawaiiFluidSDFCacheTest_AsyncMatchesSync::RunTest(const FString& Parameters)
+{
+	const TArray<FKawaiiFluidSDFShape> Shapes = {
+		FKawaiiFluidSDFShape::MakeCapsule(FVector(-50.0f, 0.0f, 0.0f), FVector(50.0f, 30.0f, 40.0f), 15.0f),
+		MakeConvexCube(FVector(0.0f, 120.0f, 0.0f), 35.0f)
+	};
+
+	FKawaiiFluidSDFCache SyncCache(8.0f, 24.0f);
+	SyncCache.SetOwnerShapes(7, Shapes);
+	SyncCache.BuildDirtyBricks();
+
+	FKawaiiFluidSDFCache AsyncCache(8.0f, 24.0f);
+	AsyncCache.SetOwnerShapes(7, Shapes);
+	AsyncCache.KickAsyncBuild();
+	TestEqual(TEXT("Dirty set handed to task"), AsyncCache.GetNumDirtyBricks(), 0);
+
+	const double StartTime = FPlatformTime::Seconds();
+	while (!AsyncCache.ApplyCompletedBuild() && FPlatformTime::Seconds() - StartTime < 10.0)
+	{
+		FPlatformProcess::Sleep(0.001f);
+	}
+
+	TestEqual(TEXT("Same brick count"), AsyncCache.GetNumBricks(), SyncCache.GetNumBricks());
+
+	FRandomStream Random(5);
+	int32 Mismatches = 0;
+	for (int32 i = 0; i < 500; ++i)
+	{
+		const FVector Position(Random.FRandRange(-120.0f, 120.0f), Random.FRandRange(-80.0f, 200.0f), Random.FRandRange(-80.0f, 100.0f));
+		float SyncDistance = 0.0f, AsyncDistance = 0.0f;
+		FVector SyncNormal, AsyncNormal;
+		const bool bSync = SyncCache.Sample(Position, SyncDistance, SyncNormal);
+		const bool bAsync = AsyncCache.Sample(Position, AsyncDistance, AsyncNormal);
+		if (bSync != bAsync || (bSync && !FMath::IsNearlyEqual(SyncDistance, AsyncDistance)))
+		{
+			++Mismatches;
+		}
+	}
+	TestEqual(TEXT("Async samples match sync"), Mismatches, 0);
+
+	return true;
+}
+
+//=============================================================================
+// S-05: Owners and Downward Raycast
+// Samples report the owner of the closest shape; a downward trace finds the
+// floor below a particle but not a wall beside it, and skips an ignored owner
+//=============================================================================
+bool FKawaiiFluidSDFCacheTest_OwnersAndRaycast::RunTest(const FString& Parameters)
+{
+	constexpr int32 FloorOwner = 10;
+	constexpr int32 WallOwner = 20;
+	const FVector Down = -FVector::UpVector;
+
+	// Floor slab with its top at Z = 0, wall (X 90..110) standing on it
+	FKawaiiFluidSDFCache Cache(5.0f, 20.0f);
+	Cache.SetOwnerShapes(FloorOwner, { FKawaiiFluidSDFShape::MakeBox(FVector(0.0f, 0.0f, -10.0f), FVector(200.0f, 200.0f, 10.0f), FQuat::Identity) });
+	Cache.SetOwnerShapes(WallOwner, { FKawaiiFluidSDFShape::MakeBox(FVector(100.0f, 0.0f, 100.0f), FVector(10.0f, 200.0f, 100.0f), FQuat::Identity) });
+	Cache.BuildDirtyBricks();
+
+	float Distance;
+	FVector Normal;
+	int32 OwnerID = INDEX_NONE;
+	TestTrue(TEXT("Above floor sampled"), Cache.Sample(FVector(0.0f, 0.0f, 3.0f), Distance, Normal, OwnerID));
+	TestEqual(TEXT("Floor owner"), OwnerID, FloorOwner);
+	TestTrue(TEXT("Beside wall sampled"), Cache.Sample(FVector(87.0f, 0.0f, 120.0f), Distance, Normal, OwnerID));
+	TestEqual(TEXT("Wall owner"), OwnerID, WallOwner);
+
+	float HitDistance = 0.0f;
+	int32 HitOwner = INDEX_NONE;
+	TestTrue(TEXT("Floor below is hit"), Cache.Raycast(FVector(0.0f, 0.0f, 12.0f), Down, 20.0f, INDEX_NONE, HitDistance, HitOwner));
+	TestEqual(TEXT("Floor hit distance"), HitDistance, 12.0f, 1.5f);
+	TestEqual(TEXT("Floor hit owner"), HitOwner, FloorOwner);
+
+	// 4 cm from the wall, 150 cm above the floor: close to geometry, but nothing below
+	TestTrue(TEXT("Wall is within reach sideways"), Cache.Sample(FVector(86.0f, 0.0f, 150.0f), Distance, Normal) && Distance < 5.0f);
+	TestFalse(TEXT("Wall beside the particle is not a floor"), Cache.Raycast(FVector(86.0f, 0.0f, 150.0f), Down, 20.0f, INDEX_NONE, HitDistance, HitOwner));
+
+	TestFalse(TEXT("Ignored floor is passed through"), Cache.Raycast(FVector(0.0f, 0.0f, 12.0f), Down, 20.0f, FloorOwner, HitDistance, HitOwner));
+	TestTrue(TEXT("Wall top is hit"), Cache.Raycast(FVector(100.0f, 0.0f, 212.0f), Down, 20.0f, FloorOwner, HitDistance, HitOwner));
+	TestEqual(TEXT("Wall top owner"), HitOwner, WallOwner);
+	TestFalse(TEXT("Nothing in empty space"), Cache.Raycast(FVector(0.0f, 0.0f, 500.0f), Down, 20.0f, INDEX_NONE, HitDistance, HitOwner));
+
+	return true;
+}
+
+//=============================================================================
+// S-06: GPU Brick Layout
+// The flattened hash table + sample array (what the GPU SDF brick collision pass
+// reads) finds every brick and reproduces the cache's lookups; the brick revision
+// tells the context when to re-upload
+//=============================================================================
+bool FKawaiiFluidSDFCacheTest_GPUBrickData::RunTest(const FString& Parameters)
+{
+	constexpr int32 SamplesPerBrick = FKawaiiFluidSDFCache::BrickSamples * FKawaiiFluidSDFCache::BrickSamples * FKawaiiFluidSDFCache::BrickSamples;
+
+	// Shapes on both sides of the origin so brick coordinates are negative as well
+	FKawaiiFluidSDFCache Cache(5.0f, 20.0f);
+	Cache.SetOwnerShapes(1, { FKawaiiFluidSDFShape::MakeBox(FVector(0.0f, 0.0f, -10.0f), FVector(150.0f, 150.0f, 10.0f), FQuat::Identity) });
+	Cache.SetOwnerShapes(2, {
+		FKawaiiFluidSDFShape::MakeSphere(FVector(-60.0f, 40.0f, 30.0f), 25.0f),
+		FKawaiiFluidSDFShape::MakeCapsule(FVector(40.0f, -50.0f, 10.0f), FVector(90.0f, -20.0f, 60.0f), 12.0f),
+		MakeConvexCube(FVector(60.0f, 80.0f, 20.0f), 20.0f)
+	});
+
+	FKawaiiFluidSDFBrickData Empty;
+	Cache.ExportBrickData(Empty);
+	TestTrue(TEXT("Nothing built yet exports empty"), Empty.IsEmpty());
+	TestEqual(TEXT("Empty lookup misses"), Empty.FindBrick(FIntVector::ZeroValue), static_cast<int32>(INDEX_NONE));
+
+	const uint32 RevisionBefore = Cache.GetBrickRevision();
+	Cache.BuildDirtyBricks();
+	TestNotEqual(TEXT("Build bumps the brick revision"), Cache.GetBrickRevision(), RevisionBefore);
+
+	FKawaiiFluidSDFBrickData Data;
+	Cache.ExportBrickData(Data);
+
+	const int32 NumBricks = Cache.GetNumBricks();
+	TestEqual(TEXT("Every brick exported"), Data.GetNumBricks(), NumBricks);
+	TestEqual(TEXT("Sample array size"), Data.Samples.Num(), NumBricks * SamplesPerBrick);
+	TestTrue(TEXT("Table size is a power of two"), FMath::IsPowerOfTwo(Data.BrickTable.Num()));
+	TestTrue(TEXT("Table at most half full"), Data.BrickTable.Num() >= NumBricks * 2);
+
+	// Every stored slot is reachable by probing from its own hash, and brick indices are unique
+	TSet<int32> SeenIndices;
+	int32 Unreachable = 0;
+	for (const FIntVector4& Entry : Data.BrickTable)
+	{
+		if (Entry.W == INDEX_NONE)
+		{
+			continue;
+		}
+		SeenIndices.Add(Entry.W);
+		if (Data.FindBrick(FIntVector(Entry.X, Entry.Y, Entry.Z)) != Entry.W)
+		{
+			++Unreachable;
+		}
+	}
+	TestEqual(TEXT("All bricks reachable"), Unreachable, 0);
+	TestEqual(TEXT("Unique brick indices"), SeenIndices.Num(), NumBricks);
+
+	// Float lookup on the flat layout matches the cache's double lookup
+	FRandomStream Random(29);
+	int32 CoverageMismatches = 0;
+	int32 Hits = 0;
+	float MaxDistanceError = 0.0f;
+	float MinNormalDot = 1.0f;
+	for (int32 i = 0; i < 2000; ++i)
+	{
+		const FVector Position(Random.FRandRange(-200.0f, 200.0f), Random.FRandRange(-200.0f, 200.0f), Random.FRandRange(-60.0f, 120.0f));
+
+		float CacheDistance = 0.0f;
+		FVector CacheNormal;
+		const bool bCacheHit = Cache.Sample(Position, CacheDistance, CacheNormal);
+
+		float GPUDistance = 0.0f;
+		FVector3f GPUNormal;
+		const bool bGPUHit = Data.Sample(FVector3f(Position), GPUDistance, GPUNormal);
+
+		if (bCacheHit != bGPUHit)
+		{
+			++CoverageMismatches;
+			continue;
+		}
+		if (!bCacheHit)
+		{
+			continue;
+		}
+
+		++Hits;
+		MaxDistanceError = FMath::Max(MaxDistanceError, FMath::Abs(GPUDistance - CacheDistance));
+		MinNormalDot = FMath::Min(MinNormalDot, static_cast<float>(FVector::DotProduct(FVector(GPUNormal), CacheNormal)));
+	}
+	TestTrue(TEXT("Some samples inside bricks"), Hits > 100);
+	TestEqual(TEXT("Same brick coverage"), CoverageMismatches, 0);
+	TestTrue(*FString::Printf(TEXT("Distance difference %.5f"), MaxDistanceError), MaxDistanceError < 1e-3f);
+	TestTrue(*FString::Printf(TEXT("Normal alignment %.4f"), MinNormalDot), MinNormalDot > 0.999f);
+
+	// A particle sunk into the floor is pushed up by the GPU response
+	float Distance = 0.0f;
+	FVector3f Normal;
+	TestTrue(TEXT("Floor sampled"), Data.Sample(FVector3f(10.0f, -10.0f, -2.0f), Distance, Normal));
+	TestEqual(TEXT("Floor penetration"), Distance, -2.0f, 0.5f);
+	TestTrue(TEXT("Floor normal points up"), Normal.Z > 0.95f);
+
+	// Removing an owner changes the bricks and the revision; the re-export drops its bricks
+	const uint32 RevisionBuilt = Cache.GetBrickRevision();
+	Cache.RemoveOwner(2);
+	Cache.BuildDirtyBricks();
+	TestNotEqual(TEXT("Removal bumps the brick revision"), Cache.GetBrickRevision(), RevisionBuilt);
+
+	Cache.ExportBrickData(Data);
+	TestEqual(TEXT("Re-export brick count"), Data.GetNumBricks(), Cache.GetNumBricks());
+	TestFalse(TEXT("Removed sphere no longer sampled"), Data.Sample(FVector3f(-60.0f, 40.0f, 70.0f), Distance, Normal));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,286 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Shadow Proxy Clustering Unit Tests
+// Synthetic particle clouds: instance reduction, coverage, distance LOD, slot stability
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Rendering/FluidShadowClusterer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidShadowClusterTest_Coverage,
+	"KawaiiFluid.Rendering.ShadowCluster.S01_Coverage",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidShadowClusterTest_DistanceLOD,
+	"KawaiiFluid.Rendering.ShadowCluster.S02_DistanceLOD",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidShadowClusterTest_StableSlots,
+	"KawaiiFluid.Rendering.ShadowCluster.S03_StableSlots",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidShadowClusterTest_Compaction,
+	"KawaiiFluid.Rendering.ShadowCluster.S04_Compaction",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float TestRadius = 5.0f;
+
+	/** Jittered lattice blob (particle spacing = 2 * radius), like a settled fluid body */
+	void AddBlob(TArray<FVector>& OutPositions, const FVector& Center, int32 CountPerAxis, FRandomStream& Random)
+	{
+		const float Spacing = TestRadius * 2.0f;
+		const FVector Origin = Center - FVector(CountPerAxis * Spacing * 0.5f);
+		for (int32 z = 0; z < CountPerAxis; ++z)
+		{
+			for (int32 y = 0; y < CountPerAxis; ++y)
+			{
+				for (int32 x = 0; x < CountPerAxis; ++x)
+				{
+					const FVector Jitter(Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f));
+					OutPositions.Add(Origin + FVector(x, y, z) * Spacing + Jitter * TestRadius * 0.3f);
+				}
+			}
+		}
+	}
+
+	/** Whether a point lies inside the ellipsoid of an instance transform */
+	bool IsInsideProxy(const FTransform& Transform, const FVector& Point, float ProxyMeshRadius)
+	{
+		const FVector Extent = Transform.GetScale3D() * ProxyMeshRadius;
+		if (Extent.GetMin() <= 0.0)
+		{
+			return false;
+		}
+		const FVector Local = (Point - Transform.GetTranslation()) / Extent;
+		return Local.SizeSquared() <= 1.0;
+	}
+
+	/** Slot of every particle's cluster */
+	TArray<int32> GatherParticleSlots(const FFluidShadowClusterer& Clusterer, const TArray<FVector>& Positions)
+	{
+		TArray<int32> Slots;
+		Slots.Reserve(Positions.Num());
+		for (const FVector& Position : Positions)
+		{
+			Slots.Add(Clusterer.FindSlot(Clusterer.ComputeClusterKey(Position, TestRadius)));
+		}
+		return Slots;
+	}
+}
+
+//=============================================================================
+// S-01: Coverage
+// A dense blob produces far fewer proxies than particles, and (nearly) every
+// particle center lies inside its own cluster's ellipsoid
+//=============================================================================
+bool FKawaiiFluidShadowClusterTest_Coverage::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(3);
+	TArray<FVector> Positions;
+	AddBlob(Positions, FVector(0.0f, 0.0f, 200.0f), 24, Random);
+
+	FFluidShadowClusterer Clusterer;
+	Clusterer.SetSettings(FFluidShadowClusterSettings());
+	Clusterer.Update(Positions, TestRadius, TArray<FVector>());
+
+	TestTrue(TEXT("Proxies reduced at least 4x"), Clusterer.GetNumClusters() * 4 <= Positions.Num());
+	TestEqual(TEXT("No free slots on first build"), Clusterer.GetNumSlots(), Clusterer.GetNumClusters());
+
+	const TArray<FTransform>& Transforms = Clusterer.GetInstanceTransforms();
+	const TArray<int32> Slots = GatherParticleSlots(Clusterer, Positions);
+	const float ProxyMeshRadius = Clusterer.GetSettings().ProxyMeshRadius;
+
+	int32 Uncovered = 0;
+	for (int32 i = 0; i < Positions.Num(); ++i)
+	{
+		if (!Transforms.IsValidIndex(Slots[i]) || !IsInsideProxy(Transforms[Slots[i]], Positions[i], ProxyMeshRadius))
+		{
+			++Uncovered;
+		}
+	}
+	// Ellipsoids are fitted from mean/variance, so rare outliers in a cell may poke out
+	TestTrue(TEXT("Particles covered by their cluster"), Uncovered * 100 < Positions.Num());
+
+	// A lone particle is a sphere of the particle radius
+	TArray<FVector> Single = { FVector(1000.0f, 0.0f, 0.0f) };
+	FFluidShadowClusterer SingleClusterer;
+	SingleClusterer.Update(Single, TestRadius, TArray<FVector>());
+	TestTrue(TEXT("Single particle proxy has particle radius"),
+		SingleClusterer.GetInstanceTransforms()[0].GetScale3D().Equals(FVector(TestRadius / ProxyMeshRadius), 1.e-4));
+
+	return true;
+}
+
+//=============================================================================
+// S-02: Distance LOD
+// Identical blobs near and far from the view: the far one uses a coarser
+// level and fewer proxies; small view motion does not re-key clusters
+//=============================================================================
+bool FKawaiiFluidShadowClusterTest_DistanceLOD::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(7);
+	const FVector NearCenter(500.0f, 0.0f, 0.0f);
+	const FVector FarCenter(20000.0f, 0.0f, 0.0f);
+
+	TArray<FVector> NearBlob;
+	TArray<FVector> FarBlob;
+	AddBlob(NearBlob, NearCenter, 16, Random);
+	AddBlob(FarBlob, FarCenter, 16, Random);
+
+	FFluidShadowClusterSettings Settings;
+	Settings.LODDistance = 2000.0f;
+	Settings.MaxLOD = 3;
+
+	TArray<FVector> Views = { FVector::ZeroVector };
+
+	FFluidShadowClusterer NearClusterer;
+	NearClusterer.SetSettings(Settings);
+	NearClusterer.Update(NearBlob, TestRadius, Views);
+
+	FFluidShadowClusterer FarClusterer;
+	FarClusterer.SetSettings(Settings);
+	FarClusterer.Update(FarBlob, TestRadius, Views);
+
+	TestEqual(TEXT("Near blob at LOD 0"), NearClusterer.ComputeLOD(NearCenter), 0);
+	TestEqual(TEXT("Far blob clamped to MaxLOD"), FarClusterer.ComputeLOD(FarCenter), 3);
+	TestTrue(TEXT("Far blob uses far fewer proxies"), FarClusterer.GetNumClusters() * 8 <= NearClusterer.GetNumClusters());
+
+	// Blob straddling the LOD 0/1 boundary; the camera drifts less than the anchor
+	// hysteresis, so the boundary does not move and cluster keys and slots are unchanged
+	TArray<FVector> BoundaryBlob;
+	AddBlob(BoundaryBlob, FVector(Settings.LODDistance, 0.0f, 0.0f), 16, Random);
+
+	FFluidShadowClusterer BoundaryClusterer;
+	BoundaryClusterer.SetSettings(Settings);
+	BoundaryClusterer.Update(BoundaryBlob, TestRadius, Views);
+	const TArray<int32> SlotsBefore = GatherParticleSlots(BoundaryClusterer, BoundaryBlob);
+
+	Views[0] = FVector(Settings.LODDistance * FFluidShadowClusterer::AnchorHysteresis * 0.5f, 0.0f, 0.0f);
+	const EFluidShadowSlotChange Change = BoundaryClusterer.Update(BoundaryBlob, TestRadius, Views);
+	TestTrue(TEXT("No slot change for small view motion"), Change == EFluidShadowSlotChange::None);
+	TestTrue(TEXT("Slots unchanged for small view motion"), GatherParticleSlots(BoundaryClusterer, BoundaryBlob) == SlotsBefore);
+
+	// No views: everything at full resolution
+	FFluidShadowClusterer NoViewClusterer;
+	NoViewClusterer.SetSettings(Settings);
+	NoViewClusterer.Update(FarBlob, TestRadius, TArray<FVector>());
+	TestEqual(TEXT("Without views far blob at LOD 0"), NoViewClusterer.ComputeLOD(FarCenter), 0);
+
+	return true;
+}
+
+//=============================================================================
+// S-03: Stable Slots
+// Despawning part of a blob and spawning elsewhere keeps the slot of every
+// surviving cluster; vacated slots are zero-scaled and reused before growing
+//=============================================================================
+bool FKawaiiFluidShadowClusterTest_StableSlots::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(13);
+	TArray<FVector> Positions;
+	AddBlob(Positions, FVector::ZeroVector, 20, Random);
+
+	FFluidShadowClusterer Clusterer;
+	Clusterer.Update(Positions, TestRadius, TArray<FVector>());
+	const TArray<int32> SlotsBefore = GatherParticleSlots(Clusterer, Positions);
+	const int32 NumSlotsBefore = Clusterer.GetNumSlots();
+
+	// Despawn the top third of the blob
+	TArray<FVector> Survivors;
+	TArray<int32> SurvivorSlotsBefore;
+	for (int32 i = 0; i < Positions.Num(); ++i)
+	{
+		if (Positions[i].Z < 40.0f)
+		{
+			Survivors.Add(Positions[i]);
+			SurvivorSlotsBefore.Add(SlotsBefore[i]);
+		}
+	}
+
+	EFluidShadowSlotChange Change = Clusterer.Update(Survivors, TestRadius, TArray<FVector>());
+	TestTrue(TEXT("Despawn does not renumber slots"), Change == EFluidShadowSlotChange::None);
+	TestEqual(TEXT("Slot count unchanged"), Clusterer.GetNumSlots(), NumSlotsBefore);
+	TestTrue(TEXT("Surviving clusters keep their slots"), GatherParticleSlots(Clusterer, Survivors) == SurvivorSlotsBefore);
+
+	int32 ZeroScaled = 0;
+	for (const FTransform& Transform : Clusterer.GetInstanceTransforms())
+	{
+		ZeroScaled += Transform.GetScale3D().IsZero() ? 1 : 0;
+	}
+	TestEqual(TEXT("Vacated slots zero-scaled"), ZeroScaled, Clusterer.GetNumSlots() - Clusterer.GetNumClusters());
+
+	// Spawn a smaller blob elsewhere: reuses vacated slots instead of growing
+	TArray<FVector> WithSpawn = Survivors;
+	AddBlob(WithSpawn, FVector(2000.0f, 0.0f, 0.0f), 8, Random);
+	Change = Clusterer.Update(WithSpawn, TestRadius, TArray<FVector>());
+	TestTrue(TEXT("Spawn fills free slots"), Change == EFluidShadowSlotChange::None);
+	TestEqual(TEXT("Slot count still unchanged"), Clusterer.GetNumSlots(), NumSlotsBefore);
+	TestTrue(TEXT("Survivors still keep their slots"),
+		GatherParticleSlots(Clusterer, Survivors) == SurvivorSlotsBefore);
+
+	// Spawn more than the free list holds: grows, existing slots untouched
+	const int32 NumSlotsBeforeGrow = Clusterer.GetNumSlots();
+	AddBlob(WithSpawn, FVector(-3000.0f, 0.0f, 0.0f), 20, Random);
+	Change = Clusterer.Update(WithSpawn, TestRadius, TArray<FVector>());
+	TestTrue(TEXT("Large spawn grows the slot array"), Change == EFluidShadowSlotChange::Grown);
+	TestEqual(TEXT("Previous slot count reported"), Clusterer.GetPreviousNumSlots(), NumSlotsBeforeGrow);
+	TestTrue(TEXT("Survivors keep their slots after growth"),
+		GatherParticleSlots(Clusterer, Survivors) == SurvivorSlotsBefore);
+
+	return true;
+}
+
+//=============================================================================
+// S-04: Compaction
+// When most slots are vacated the array is compacted; afterwards slots are
+// dense and every live cluster's transform is at its reported slot
+//=============================================================================
+bool FKawaiiFluidShadowClusterTest_Compaction::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(29);
+	TArray<FVector> Positions;
+	AddBlob(Positions, FVector::ZeroVector, 24, Random);
+
+	FFluidShadowClusterer Clusterer;
+	Clusterer.Update(Positions, TestRadius, TArray<FVector>());
+	TestTrue(TEXT("Enough clusters to exceed the compaction threshold"),
+		Clusterer.GetNumClusters() > FFluidShadowClusterer::MinFreeSlotsBeforeCompact * 2);
+
+	// Keep only a small corner
+	TArray<FVector> Corner;
+	for (const FVector& Position : Positions)
+	{
+		if (Position.X < -60.0f && Position.Y < -60.0f && Position.Z < -60.0f)
+		{
+			Corner.Add(Position);
+		}
+	}
+
+	const EFluidShadowSlotChange Change = Clusterer.Update(Corner, TestRadius, TArray<FVector>());
+	TestTrue(TEXT("Mostly vacated array compacts"), Change == EFluidShadowSlotChange::Compacted);
+	TestEqual(TEXT("Dense after compaction"), Clusterer.GetNumSlots(), Clusterer.GetNumClusters());
+
+	const TArray<FTransform>& Transforms = Clusterer.GetInstanceTransforms();
+	const TArray<int32> Slots = GatherParticleSlots(Clusterer, Corner);
+	const float ProxyMeshRadius = Clusterer.GetSettings().ProxyMeshRadius;
+
+	int32 Uncovered = 0;
+	for (int32 i = 0; i < Corner.Num(); ++i)
+	{
+		if (!Transforms.IsValidIndex(Slots[i]) || !IsInsideProxy(Transforms[Slots[i]], Corner[i], ProxyMeshRadius))
+		{
+			++Uncovered;
+		}
+	}
+	TestTrue(TEXT("Renumbered slots match their transforms"), Uncovered * 100 < Corner.Num());
+
+	Clusterer.Reset();
+	TestEqual(TEXT("Reset clears slots"), Clusterer.GetNumSlots(), 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
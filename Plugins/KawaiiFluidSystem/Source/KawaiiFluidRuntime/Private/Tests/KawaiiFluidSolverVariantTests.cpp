@@ -0,0 +1,221 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Density Kernel Variant Unit Tests
+// Variant selection per tensile configuration, specialized kernels against the generic runtime-branch kernel
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Physics/DensityConstraint.h"
+#include "Core/FluidParticle.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSolverVariantTest_Selection,
+	"KawaiiFluid.Physics.SolverVariants.V01_Selection",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSolverVariantTest_EquivalenceMatrix,
+	"KawaiiFluid.Physics.SolverVariants.V02_EquivalenceMatrix",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSolverVariantTest_TensileIsActive,
+	"KawaiiFluid.Physics.SolverVariants.V03_TensileIsActive",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float TestSmoothingRadius = 20.0f;
+	constexpr float TestRestDensity = 1000.0f;
+	constexpr float TestCompliance = 0.01f;
+	constexpr float TestDeltaTime = 1.0f / 120.0f;
+	constexpr int32 TestIterations = 3;
+
+	/** Jittered, slightly compressed grid (varying neighbor counts exercise the SIMD tail) */
+	TArray<FFluidParticle> MakeJitteredBlock(int32 GridSize, float Spacing, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FFluidParticle> Particles;
+		Particles.Reserve(GridSize * GridSize * GridSize);
+		for (int32 x = 0; x < GridSize; ++x)
+		{
+			for (int32 y = 0; y < GridSize; ++y)
+			{
+				for (int32 z = 0; z < GridSize; ++z)
+				{
+					const FVector Jitter = FVector(Random.VRand()) * Random.FRandRange(0.0f, Spacing * 0.3f);
+					FFluidParticle P(FVector(x, y, z) * Spacing + Jitter, Particles.Num());
+					P.Mass = 1.0f;
+					Particles.Add(P);
+				}
+			}
+		}
+		return Particles;
+	}
+
+	/** Brute-force neighbor lists on predicted positions (self included, like FSpatialHash queries) */
+	void BuildNeighbors(TArray<FFluidParticle>& Particles, float Radius)
+	{
+		const double RadiusSq = static_cast<double>(Radius) * Radius;
+		for (FFluidParticle& P : Particles)
+		{
+			P.NeighborIndices.Reset();
+			for (int32 j = 0; j < Particles.Num(); ++j)
+			{
+				if (FVector::DistSquared(P.PredictedPosition, Particles[j].PredictedPosition) <= RadiusSq)
+				{
+					P.NeighborIndices.Add(j);
+				}
+			}
+		}
+	}
+
+	FTensileInstabilityParams MakeTensile(bool bEnabled, int32 N)
+	{
+		FTensileInstabilityParams Params;
+		Params.bEnabled = bEnabled;
+		Params.K = 10.0f;
+		Params.N = N;
+		Params.DeltaQ = 0.2f;
+		return Params;
+	}
+
+	/** Run the solver iterations; returns the variant used */
+	EDensityKernelVariant RunSolver(TArray<FFluidParticle>& Particles, const FTensileInstabilityParams& Tensile, bool bSpecialized)
+	{
+		FDensityConstraint Constraint;
+		Constraint.SetUseSpecializedKernels(bSpecialized);
+		for (int32 Iter = 0; Iter < TestIterations; ++Iter)
+		{
+			Constraint.SolveWithTensileCorrection(Particles, TestSmoothingRadius, TestRestDensity, TestCompliance, TestDeltaTime, Tensile);
+		}
+		return Constraint.GetLastKernelVariant();
+	}
+
+	double MaxPositionDifference(const TArray<FFluidParticle>& A, const TArray<FFluidParticle>& B)
+	{
+		double MaxDiff = 0.0;
+		for (int32 i = 0; i < A.Num(); ++i)
+		{
+			MaxDiff = FMath::Max(MaxDiff, FVector::Dist(A[i].PredictedPosition, B[i].PredictedPosition));
+		}
+		return MaxDiff;
+	}
+}
+
+//=============================================================================
+// V-01: Selection
+// Tensile off (or degenerate W(Δq)) selects Plain; n = 2/4/6 select the unrolled
+// variants; any other exponent falls back to the runtime-exponent variant
+//=============================================================================
+bool FKawaiiFluidSolverVariantTest_Selection::RunTest(const FString& Parameters)
+{
+	FTensileInstabilityParams Params = MakeTensile(false, 4);
+	Params.W_DeltaQ = 1.0f;
+	TestTrue(TEXT("Disabled -> Plain"), FDensityConstraint::SelectKernelVariant(Params) == EDensityKernelVariant::Plain);
+
+	Params.bEnabled = true;
+	Params.W_DeltaQ = 0.0f;
+	TestTrue(TEXT("Zero W(dq) -> Plain"), FDensityConstraint::SelectKernelVariant(Params) == EDensityKernelVariant::Plain);
+
+	Params.W_DeltaQ = 1.0f;
+	Params.N = 2;
+	TestTrue(TEXT("n=2 -> TensilePow2"), FDensityConstraint::SelectKernelVariant(Params) == EDensityKernelVariant::TensilePow2);
+	Params.N = 4;
+	TestTrue(TEXT("n=4 -> TensilePow4"), FDensityConstraint::SelectKernelVariant(Params) == EDensityKernelVariant::TensilePow4);
+	Params.N = 6;
+	TestTrue(TEXT("n=6 -> TensilePow6"), FDensityConstraint::SelectKernelVariant(Params) == EDensityKernelVariant::TensilePow6);
+	Params.N = 3;
+	TestTrue(TEXT("n=3 -> TensilePowN"), FDensityConstraint::SelectKernelVariant(Params) == EDensityKernelVariant::TensilePowN);
+
+	// The solver records what it ran
+	TArray<FFluidParticle> Particles = MakeJitteredBlock(4, 8.0f, 1);
+	BuildNeighbors(Particles, TestSmoothingRadius);
+	FDensityConstraint Constraint;
+	Constraint.Solve(Particles, TestSmoothingRadius, TestRestDensity, TestCompliance, TestDeltaTime);
+	TestTrue(TEXT("Solve runs Plain"), Constraint.GetLastKernelVariant() == EDensityKernelVariant::Plain);
+	Constraint.SetUseSpecializedKernels(false);
+	Constraint.Solve(Particles, TestSmoothingRadius, TestRestDensity, TestCompliance, TestDeltaTime);
+	TestTrue(TEXT("Specialization off runs Generic"), Constraint.GetLastKernelVariant() == EDensityKernelVariant::Generic);
+
+	return true;
+}
+
+//=============================================================================
+// V-02: Equivalence Matrix
+// Every specialized variant matches the generic kernel on the same input.
+// Fixed exponents are multiplied out instead of FMath::Pow, so allow float noise.
+//=============================================================================
+bool FKawaiiFluidSolverVariantTest_EquivalenceMatrix::RunTest(const FString& Parameters)
+{
+	struct FCase
+	{
+		const TCHAR* Name;
+		bool bTensile;
+		int32 N;
+		EDensityKernelVariant Expected;
+	};
+	const FCase Cases[] =
+	{
+		{ TEXT("Plain"),       false, 4, EDensityKernelVariant::Plain },
+		{ TEXT("TensilePow2"), true,  2, EDensityKernelVariant::TensilePow2 },
+		{ TEXT("TensilePow4"), true,  4, EDensityKernelVariant::TensilePow4 },
+		{ TEXT("TensilePow6"), true,  6, EDensityKernelVariant::TensilePow6 },
+		{ TEXT("TensilePowN"), true,  3, EDensityKernelVariant::TensilePowN },
+	};
+
+	// Dense block (compressed -> nonzero lambdas) at two spacings
+	const float Spacings[] = { 6.0f, 9.0f };
+	constexpr double PositionTolerance = 1e-3;  // cm
+
+	for (const FCase& Case : Cases)
+	{
+		for (int32 SpacingIndex = 0; SpacingIndex < UE_ARRAY_COUNT(Spacings); ++SpacingIndex)
+		{
+			TArray<FFluidParticle> Reference = MakeJitteredBlock(6, Spacings[SpacingIndex], 7 + SpacingIndex);
+			BuildNeighbors(Reference, TestSmoothingRadius);
+			TArray<FFluidParticle> Specialized = Reference;
+
+			const FTensileInstabilityParams Tensile = MakeTensile(Case.bTensile, Case.N);
+			const EDensityKernelVariant GenericVariant = RunSolver(Reference, Tensile, false);
+			const EDensityKernelVariant UsedVariant = RunSolver(Specialized, Tensile, true);
+
+			const FString Label = FString::Printf(TEXT("%s (spacing %.0f)"), Case.Name, Spacings[SpacingIndex]);
+			TestTrue(FString::Printf(TEXT("%s: reference ran Generic"), *Label), GenericVariant == EDensityKernelVariant::Generic);
+			TestTrue(FString::Printf(TEXT("%s: expected variant selected"), *Label), UsedVariant == Case.Expected);
+
+			const double MaxDiff = MaxPositionDifference(Reference, Specialized);
+			TestTrue(FString::Printf(TEXT("%s: positions match generic (max %.2e cm)"), *Label, MaxDiff), MaxDiff <= PositionTolerance);
+
+			float MaxLambdaDiff = 0.0f;
+			for (int32 i = 0; i < Reference.Num(); ++i)
+			{
+				MaxLambdaDiff = FMath::Max(MaxLambdaDiff, FMath::Abs(Reference[i].Lambda - Specialized[i].Lambda));
+			}
+			TestTrue(FString::Printf(TEXT("%s: lambdas match generic (max %.2e)"), *Label, MaxLambdaDiff), MaxLambdaDiff <= 1e-4f);
+		}
+	}
+
+	return true;
+}
+
+//=============================================================================
+// V-03: Tensile Is Active
+// Guards V-02 against a vacuous pass: with scorr on, the result differs
+// from the plain solve by more than the equivalence tolerance
+//=============================================================================
+bool FKawaiiFluidSolverVariantTest_TensileIsActive::RunTest(const FString& Parameters)
+{
+	TArray<FFluidParticle> Plain = MakeJitteredBlock(6, 9.0f, 11);
+	BuildNeighbors(Plain, TestSmoothingRadius);
+	TArray<FFluidParticle> Tensile = Plain;
+
+	RunSolver(Plain, MakeTensile(false, 4), true);
+	RunSolver(Tensile, MakeTensile(true, 4), true);
+
+	const double MaxDiff = MaxPositionDifference(Plain, Tensile);
+	AddInfo(FString::Printf(TEXT("Plain vs TensilePow4 max difference: %.4f cm"), MaxDiff));
+	TestTrue(TEXT("scorr changes the result"), MaxDiff > 1e-2);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,345 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Source Registry Unit Tests
+// Two-level bitmap SourceID allocation at full capacity, lowest-first reuse, random stress, dirty counter ranges,
+// quarantine of released ids until their particles drain
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformTime.h"
+#include "Core/KawaiiFluidSourceIDAllocator.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSourceRegistryTest_FullCapacity,
+	"KawaiiFluid.Core.SourceRegistry.R01_FullCapacity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSourceRegistryTest_LowestFirstReuse,
+	"KawaiiFluid.Core.SourceRegistry.R02_LowestFirstReuse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSourceRegistryTest_RandomStress,
+	"KawaiiFluid.Core.SourceRegistry.R03_RandomStress",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSourceRegistryTest_DirtyRanges,
+	"KawaiiFluid.Core.SourceRegistry.R04_DirtyRanges",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSourceRegistryTest_QuarantineUntilDrained,
+	"KawaiiFluid.Core.SourceRegistry.R05_QuarantineUntilDrained",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/** Allocate until the allocator reports full; true if ids came out as 0, 1, 2, ... */
+	bool AllocateAll(FKawaiiFluidSourceIDAllocator& Allocator, int32& OutCount)
+	{
+		bool bSequential = true;
+		OutCount = 0;
+		for (int32 ID = Allocator.Allocate(); ID != EGPUParticleSource::InvalidSourceID; ID = Allocator.Allocate())
+		{
+			bSequential &= (ID == OutCount);
+			++OutCount;
+		}
+		return bSequential;
+	}
+}
+
+//=============================================================================
+// R-01: Full Capacity
+// Every id up to MaxSourceCount is handed out exactly once, in order; the
+// allocator then fails until an id is released
+//=============================================================================
+bool FKawaiiFluidSourceRegistryTest_FullCapacity::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSourceIDAllocator Allocator;
+	TestEqual(TEXT("Default capacity is MaxSourceCount"), Allocator.GetCapacity(), EGPUParticleSource::MaxSourceCount);
+
+	const double StartTime = FPlatformTime::Seconds();
+	int32 Count = 0;
+	const bool bSequential = AllocateAll(Allocator, Count);
+	const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	AddInfo(FString::Printf(TEXT("%d ids allocated in %.2f ms"), Count, ElapsedMs));
+
+	TestEqual(TEXT("All ids allocated"), Count, EGPUParticleSource::MaxSourceCount);
+	TestTrue(TEXT("Ids are handed out lowest first"), bSequential);
+	TestEqual(TEXT("Num matches"), Allocator.Num(), EGPUParticleSource::MaxSourceCount);
+	TestEqual(TEXT("High-water mark covers every id"), Allocator.GetHighWaterMark(), EGPUParticleSource::MaxSourceCount);
+	TestEqual(TEXT("Full allocator fails"), Allocator.Allocate(), EGPUParticleSource::InvalidSourceID);
+	TestFalse(TEXT("Out-of-range id is never allocated"), Allocator.IsAllocated(EGPUParticleSource::MaxSourceCount));
+
+	// Ids from both ends of the id space and across summary words come back
+	const int32 Released[] = { EGPUParticleSource::MaxSourceCount - 1, 4096, 0 };
+	for (const int32 ID : Released)
+	{
+		TestTrue(FString::Printf(TEXT("Release %d"), ID), Allocator.Release(ID));
+	}
+	TestEqual(TEXT("Lowest released id first"), Allocator.Allocate(), 0);
+	TestEqual(TEXT("Then the next one"), Allocator.Allocate(), 4096);
+	TestEqual(TEXT("Last id of the capacity"), Allocator.Allocate(), EGPUParticleSource::MaxSourceCount - 1);
+	TestEqual(TEXT("Full again"), Allocator.Allocate(), EGPUParticleSource::InvalidSourceID);
+
+	// Capacity that is not a multiple of the word size
+	FKawaiiFluidSourceIDAllocator Small(130);
+	TestTrue(TEXT("Small: sequential"), AllocateAll(Small, Count));
+	TestEqual(TEXT("Small: tail word honors the capacity"), Count, 130);
+
+	Allocator.Reset();
+	TestEqual(TEXT("Reset frees every id"), Allocator.Num(), 0);
+	TestEqual(TEXT("Reset restarts the high-water mark"), Allocator.GetHighWaterMark(), 0);
+	TestEqual(TEXT("Reset allocates from zero"), Allocator.Allocate(), 0);
+
+	return true;
+}
+
+//=============================================================================
+// R-02: Lowest-First Reuse
+// Released ids are reused lowest first, so the high-water mark (the size of
+// the per-source counter buffers) stays at the peak number of live sources
+//=============================================================================
+bool FKawaiiFluidSourceRegistryTest_LowestFirstReuse::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSourceIDAllocator Allocator;
+	for (int32 i = 0; i < 300; ++i)
+	{
+		Allocator.Allocate();
+	}
+
+	const int32 Released[] = { 200, 7, 64, 299 };
+	for (const int32 ID : Released)
+	{
+		Allocator.Release(ID);
+	}
+	TestFalse(TEXT("Released id is free"), Allocator.IsAllocated(64));
+	TestTrue(TEXT("Neighbor stays allocated"), Allocator.IsAllocated(63));
+	TestFalse(TEXT("Double release is rejected"), Allocator.Release(7));
+	TestFalse(TEXT("Out-of-range release is rejected"), Allocator.Release(EGPUParticleSource::InvalidSourceID));
+	TestEqual(TEXT("Num after releases"), Allocator.Num(), 296);
+
+	const int32 Expected[] = { 7, 64, 200, 299, 300 };
+	for (const int32 ID : Expected)
+	{
+		TestEqual(TEXT("Lowest free id"), Allocator.Allocate(), ID);
+	}
+	TestEqual(TEXT("High-water mark is peak live count"), Allocator.GetHighWaterMark(), 301);
+
+	// Churn: register/unregister 10000 times with 300 live sources
+	FRandomStream Random(7);
+	for (int32 i = 0; i < 10000; ++i)
+	{
+		const int32 ID = Random.RandRange(0, 300);
+		Allocator.Release(ID);
+		Allocator.Allocate();
+	}
+	TestEqual(TEXT("Churn: live count unchanged"), Allocator.Num(), 301);
+	TestEqual(TEXT("Churn: high-water mark unchanged"), Allocator.GetHighWaterMark(), 301);
+
+	return true;
+}
+
+//=============================================================================
+// R-03: Random Stress
+// 200k random allocate/release operations against a bit array reference:
+// every allocation returns the reference's lowest free id
+//=============================================================================
+bool FKawaiiFluidSourceRegistryTest_RandomStress::RunTest(const FString& Parameters)
+{
+	constexpr int32 Capacity = 10000;
+	constexpr int32 NumOps = 200000;
+
+	FKawaiiFluidSourceIDAllocator Allocator(Capacity);
+	TBitArray<> Reference(false, Capacity);
+	TArray<int32> Live;
+	FRandomStream Random(1234);
+
+	int32 Mismatches = 0;
+	int32 PeakLive = 0;
+	const double StartTime = FPlatformTime::Seconds();
+
+	for (int32 Op = 0; Op < NumOps; ++Op)
+	{
+		// Alternate mostly-allocating and mostly-releasing phases so the pool fills up and drains
+		const float AllocateChance = (Op / 20000) % 2 == 0 ? 0.8f : 0.3f;
+
+		if (Live.Num() == 0 || Random.FRand() < AllocateChance)
+		{
+			const int32 ExpectedID = Reference.Find(false);
+			const int32 ID = Allocator.Allocate();
+			if (ID != (ExpectedID == INDEX_NONE ? EGPUParticleSource::InvalidSourceID : ExpectedID))
+			{
+				++Mismatches;
+			}
+			if (ID >= 0 && ID < Capacity)
+			{
+				Reference[ID] = true;
+				Live.Add(ID);
+			}
+		}
+		else
+		{
+			const int32 Index = Random.RandRange(0, Live.Num() - 1);
+			const int32 ID = Live[Index];
+			Live.RemoveAtSwap(Index);
+			if (!Allocator.Release(ID))
+			{
+				++Mismatches;
+			}
+			Reference[ID] = false;
+		}
+
+		PeakLive = FMath::Max(PeakLive, Live.Num());
+		if (Allocator.Num() != Live.Num())
+		{
+			++Mismatches;
+		}
+	}
+
+	const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	AddInfo(FString::Printf(TEXT("%d ops (including the reference) in %.1f ms, peak %d live, high-water %d"),
+		NumOps, ElapsedMs, PeakLive, Allocator.GetHighWaterMark()));
+
+	TestEqual(TEXT("Allocator matches the reference"), Mismatches, 0);
+	TestEqual(TEXT("Stress reached full capacity"), PeakLive, Capacity);
+	TestEqual(TEXT("High-water mark is the peak live count"), Allocator.GetHighWaterMark(), PeakLive);
+
+	bool bSameState = true;
+	for (int32 ID = 0; ID < Capacity; ++ID)
+	{
+		bSameState &= Allocator.IsAllocated(ID) == Reference[ID];
+	}
+	TestTrue(TEXT("Final allocation state matches"), bSameState);
+
+	return true;
+}
+
+//=============================================================================
+// R-04: Dirty Ranges
+// Dirty counters coalesce into at most MaxRanges sorted ranges that cover
+// every marked id; nearby ids share one copy
+//=============================================================================
+bool FKawaiiFluidSourceRegistryTest_DirtyRanges::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSourceRangeSet Ranges(4, 3);
+	TestTrue(TEXT("Starts empty"), Ranges.IsEmpty());
+
+	Ranges.Add(11);
+	Ranges.Add(10);
+	Ranges.Add(12);
+	TestEqual(TEXT("Adjacent ids form one range"), Ranges.GetRanges().Num(), 1);
+	TestTrue(TEXT("Range [10, 13)"), Ranges.GetRanges()[0] == FKawaiiFluidSourceRange(10, 13));
+
+	Ranges.Add(15);
+	TestTrue(TEXT("Gap within MergeGap joins: [10, 16)"), Ranges.GetRanges().Num() == 1 && Ranges.GetRanges()[0] == FKawaiiFluidSourceRange(10, 16));
+
+	Ranges.Add(300);
+	Ranges.Add(200);
+	Ranges.Add(100);
+	TestEqual(TEXT("Range budget holds"), Ranges.GetRanges().Num(), 3);
+	TestTrue(TEXT("Closest pair was joined"), Ranges.GetRanges()[0] == FKawaiiFluidSourceRange(10, 101));
+	TestTrue(TEXT("Far ids stay separate"),
+		Ranges.GetRanges()[1] == FKawaiiFluidSourceRange(200, 201) && Ranges.GetRanges()[2] == FKawaiiFluidSourceRange(300, 301));
+	TestEqual(TEXT("Copied counters"), Ranges.GetNumIDs(), 93);
+	TestFalse(TEXT("Gap between ranges is clean"), Ranges.Contains(150));
+
+	Ranges.AddRange(0, 400);
+	TestTrue(TEXT("Covering range absorbs everything"), Ranges.GetRanges().Num() == 1 && Ranges.GetRanges()[0] == FKawaiiFluidSourceRange(0, 400));
+
+	Ranges.Reset();
+	TestTrue(TEXT("Reset empties"), Ranges.IsEmpty());
+
+	// Random marks: always sorted, disjoint, within budget, and a superset of the marks
+	FKawaiiFluidSourceRangeSet Random8;
+	FRandomStream Random(99);
+	TArray<int32> Marked;
+	bool bValid = true;
+	for (int32 i = 0; i < 2000; ++i)
+	{
+		const int32 ID = Random.RandRange(0, EGPUParticleSource::MaxSourceCount - 1);
+		Random8.Add(ID);
+		Marked.Add(ID);
+
+		const TArray<FKawaiiFluidSourceRange>& Current = Random8.GetRanges();
+		bValid &= Current.Num() <= 8;
+		for (int32 r = 1; r < Current.Num(); ++r)
+		{
+			bValid &= Current[r - 1].End < Current[r].Begin;
+		}
+	}
+	bool bCovered = true;
+	for (const int32 ID : Marked)
+	{
+		bCovered &= Random8.Contains(ID);
+	}
+	TestTrue(TEXT("Random: sorted, disjoint, within budget"), bValid);
+	TestTrue(TEXT("Random: every marked id is read back"), bCovered);
+
+	return true;
+}
+
+//=============================================================================
+// R-05: Quarantine Until Drained
+// An emitter releases its id while its particles are still alive; the next
+// emitter allocated right away must get a different id, and the released id
+// only returns to the pool once its per-source counter reads zero
+//=============================================================================
+bool FKawaiiFluidSourceRegistryTest_QuarantineUntilDrained::RunTest(const FString& Parameters)
+{
+	constexpr int32 MinUpdates = 3;
+
+	FKawaiiFluidSourceIDAllocator Allocator(256);
+	TArray<int32> ParticleCounts;
+	ParticleCounts.Init(0, 256);
+	const auto IsDrained = [&ParticleCounts](int32 ID) { return ParticleCounts[ID] == 0; };
+
+	const int32 OldID = Allocator.Allocate();
+	const int32 Other = Allocator.Allocate();
+	ParticleCounts[OldID] = 500;
+
+	// EndPlay: the old emitter's particles outlive it
+	TestTrue(TEXT("Quarantine a live id"), Allocator.Quarantine(OldID));
+	TestFalse(TEXT("Double quarantine is rejected"), Allocator.Quarantine(OldID));
+	TestFalse(TEXT("Free id cannot be quarantined"), Allocator.Quarantine(200));
+	TestFalse(TEXT("Quarantined id cannot be released directly"), Allocator.Release(OldID));
+	TestTrue(TEXT("Quarantined id is not free"), Allocator.IsAllocated(OldID) && Allocator.IsQuarantined(OldID));
+	TestEqual(TEXT("Quarantined id is not live"), Allocator.Num(), 1);
+
+	// BeginPlay of the next emitter in the same frame
+	const int32 NewID = Allocator.Allocate();
+	TestNotEqual(TEXT("Immediate re-allocation does not reuse the released id"), NewID, OldID);
+	TestNotEqual(TEXT("Nor a live id"), NewID, Other);
+	TestEqual(TEXT("New emitter starts with no inherited particles"), ParticleCounts[NewID], 0);
+
+	// Particles still alive: the id stays quarantined however long it takes
+	for (int32 Update = 0; Update < 10; ++Update)
+	{
+		TestEqual(TEXT("Alive particles keep the id quarantined"), Allocator.ReleaseDrained(MinUpdates, IsDrained), 0);
+	}
+
+	// Counter reads zero: released on the next update
+	ParticleCounts[OldID] = 0;
+	TestEqual(TEXT("Drained id is released"), Allocator.ReleaseDrained(MinUpdates, IsDrained), 1);
+	TestFalse(TEXT("Drained id is free"), Allocator.IsAllocated(OldID) || Allocator.IsQuarantined(OldID));
+	TestEqual(TEXT("Drained id is reused lowest first"), Allocator.Allocate(), OldID);
+
+	// A counter that reads zero at once still waits MinUpdates (readback latency)
+	TestTrue(TEXT("Quarantine a drained id"), Allocator.Quarantine(Other));
+	int32 Updates = 0;
+	while (Allocator.GetNumQuarantined() > 0 && Updates < 10)
+	{
+		Allocator.ReleaseDrained(MinUpdates, IsDrained);
+		++Updates;
+	}
+	TestEqual(TEXT("Released after MinUpdates"), Updates, MinUpdates);
+
+	// Reset drops the quarantine too
+	Allocator.Quarantine(NewID);
+	Allocator.Reset();
+	TestEqual(TEXT("Reset clears the quarantine"), Allocator.GetNumQuarantined(), 0);
+	TestFalse(TEXT("Reset frees quarantined ids"), Allocator.IsQuarantined(NewID));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,237 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Splash Candidate Selection Unit Tests
+// CPU reference for FluidSplashCompact.usf: condition rules, budget, and unbiased selection
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Core/KawaiiFluidSplashSelector.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSplashSelectorTest_ConditionModes,
+	"KawaiiFluid.Core.SplashSelector.P01_ConditionModes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSplashSelectorTest_BudgetAndCapacity,
+	"KawaiiFluid.Core.SplashSelector.P02_BudgetAndCapacity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSplashSelectorTest_NoIndexBias,
+	"KawaiiFluid.Core.SplashSelector.P03_NoIndexBias",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSplashSelectorTest_ImportanceWeighting,
+	"KawaiiFluid.Core.SplashSelector.P04_ImportanceWeighting",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	struct FSplashTestParticles
+	{
+		TArray<FVector3f> Positions;
+		TArray<FVector3f> Velocities;
+		TArray<uint32> NeighborCounts;
+		TArray<int32> ParticleIDs;
+		TBitArray<> WasIsolated;
+
+		void Add(float Speed, uint32 NeighborCount)
+		{
+			const int32 Index = Positions.Num();
+			Positions.Add(FVector3f(static_cast<float>(Index), 0.0f, 0.0f));
+			Velocities.Add(FVector3f(Speed, 0.0f, 0.0f));
+			NeighborCounts.Add(NeighborCount);
+			ParticleIDs.Add(Index);
+		}
+
+		void Compact(const FKawaiiFluidSplashSettings& Settings, uint32 FrameIndex, TArray<FGPUSplashCandidate>& OutCandidates)
+		{
+			FKawaiiFluidSplashSelector::CompactCandidates(Positions, Velocities, NeighborCounts, ParticleIDs,
+				WasIsolated, Settings, FrameIndex, OutCandidates);
+		}
+	};
+}
+
+//=============================================================================
+// P-01: Condition Modes
+// Each mode reproduces the legacy rules; becoming isolated triggers only
+// on the frame the state changes, not while the particle stays isolated
+//=============================================================================
+bool FKawaiiFluidSplashSelectorTest_ConditionModes::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSplashSettings Settings;
+	Settings.VelocityThreshold = 200.0f;
+	Settings.IsolationNeighborThreshold = 2;
+
+	auto Evaluate = [&Settings](ESplashConditionMode Mode, float Speed, uint32 Neighbors, bool bWasIsolated)
+	{
+		Settings.ConditionMode = Mode;
+		return FKawaiiFluidSplashSelector::EvaluateCondition(Settings, Speed, Neighbors, bWasIsolated);
+	};
+
+	TestTrue(TEXT("AND: fast + just isolated"), Evaluate(ESplashConditionMode::VelocityAndIsolation, 300.0f, 1, false));
+	TestFalse(TEXT("AND: fast, already isolated"), Evaluate(ESplashConditionMode::VelocityAndIsolation, 300.0f, 1, true));
+	TestFalse(TEXT("AND: slow + just isolated"), Evaluate(ESplashConditionMode::VelocityAndIsolation, 100.0f, 1, false));
+	TestTrue(TEXT("OR: fast only"), Evaluate(ESplashConditionMode::VelocityOrIsolation, 300.0f, 10, false));
+	TestTrue(TEXT("OR: just isolated only"), Evaluate(ESplashConditionMode::VelocityOrIsolation, 0.0f, 2, false));
+	TestFalse(TEXT("OR: neither"), Evaluate(ESplashConditionMode::VelocityOrIsolation, 0.0f, 10, false));
+	TestTrue(TEXT("VelocityOnly ignores isolation"), Evaluate(ESplashConditionMode::VelocityOnly, 300.0f, 10, true));
+	TestFalse(TEXT("VelocityOnly: slow"), Evaluate(ESplashConditionMode::VelocityOnly, 100.0f, 0, false));
+	TestTrue(TEXT("IsolationOnly: just isolated"), Evaluate(ESplashConditionMode::IsolationOnly, 0.0f, 0, false));
+	TestFalse(TEXT("IsolationOnly: dense"), Evaluate(ESplashConditionMode::IsolationOnly, 0.0f, 3, false));
+
+	// Same particle over three frames: dense -> isolated -> still isolated
+	Settings.ConditionMode = ESplashConditionMode::IsolationOnly;
+	Settings.Budget = 10;
+	FSplashTestParticles Particles;
+	Particles.Add(0.0f, 8);
+	TArray<FGPUSplashCandidate> Candidates;
+
+	Particles.Compact(Settings, 0, Candidates);
+	TestEqual(TEXT("Frame 0: dense, no splash"), Candidates.Num(), 0);
+
+	Particles.NeighborCounts[0] = 1;
+	Particles.Compact(Settings, 1, Candidates);
+	TestEqual(TEXT("Frame 1: became isolated, one splash"), Candidates.Num(), 1);
+
+	Particles.Compact(Settings, 2, Candidates);
+	TestEqual(TEXT("Frame 2: still isolated, no splash"), Candidates.Num(), 0);
+
+	return true;
+}
+
+//=============================================================================
+// P-02: Budget And Capacity
+// The compacted list stays near Budget * Oversample and within MaxCandidates;
+// selection never exceeds the budget and is sorted by key
+//=============================================================================
+bool FKawaiiFluidSplashSelectorTest_BudgetAndCapacity::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSplashSettings Settings;
+	Settings.ConditionMode = ESplashConditionMode::VelocityOnly;
+	Settings.Budget = 10;
+
+	FSplashTestParticles Particles;
+	for (int32 i = 0; i < 20000; ++i)
+	{
+		Particles.Add(400.0f + static_cast<float>(i % 7) * 100.0f, 0);
+	}
+
+	const int32 Target = Settings.Budget * FKawaiiFluidSplashSelector::Oversample;
+	TArray<FGPUSplashCandidate> Candidates;
+	for (uint32 Frame = 0; Frame < 16; ++Frame)
+	{
+		Particles.Compact(Settings, Frame, Candidates);
+		TestTrue(TEXT("Compacted within capacity"), Candidates.Num() <= FKawaiiFluidSplashSelector::MaxCandidates);
+		TestTrue(TEXT("Compacted near target"), Candidates.Num() >= Target / 2 && Candidates.Num() <= Target * 2);
+
+		FKawaiiFluidSplashSelector::SelectTopCandidates(Candidates, Settings.Budget);
+		TestEqual(TEXT("Selection filled to budget"), Candidates.Num(), Settings.Budget);
+		for (int32 i = 1; i < Candidates.Num(); ++i)
+		{
+			TestTrue(TEXT("Sorted by key"), Candidates[i - 1].Key >= Candidates[i].Key);
+		}
+	}
+
+	// Fewer candidates than budget: every candidate survives thinning
+	FSplashTestParticles Few;
+	for (int32 i = 0; i < 5; ++i)
+	{
+		Few.Add(500.0f, 0);
+	}
+	Few.Compact(Settings, 0, Candidates);
+	TestEqual(TEXT("All candidates kept when under budget"), Candidates.Num(), 5);
+
+	Settings.Budget = 0;
+	Particles.Compact(Settings, 0, Candidates);
+	TestEqual(TEXT("Zero budget yields no candidates"), Candidates.Num(), 0);
+
+	return true;
+}
+
+//=============================================================================
+// P-03: No Index Bias
+// With equal weights, selected particles are spread over the whole buffer
+// (the legacy scan always picked the first MaxSplashVFXPerFrame hits)
+//=============================================================================
+bool FKawaiiFluidSplashSelectorTest_NoIndexBias::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSplashSettings Settings;
+	Settings.ConditionMode = ESplashConditionMode::VelocityOnly;
+	Settings.Budget = 10;
+
+	const int32 NumParticles = 10000;
+	FSplashTestParticles Particles;
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		Particles.Add(500.0f, 0);
+	}
+
+	double IndexSum = 0.0;
+	int32 NumSelected = 0;
+	TArray<FGPUSplashCandidate> Candidates;
+	for (uint32 Frame = 0; Frame < 200; ++Frame)
+	{
+		Particles.Compact(Settings, Frame, Candidates);
+		FKawaiiFluidSplashSelector::SelectTopCandidates(Candidates, Settings.Budget);
+		for (const FGPUSplashCandidate& Candidate : Candidates)
+		{
+			IndexSum += Candidate.ParticleID;
+			++NumSelected;
+		}
+	}
+
+	TestTrue(TEXT("Splashes selected"), NumSelected > 0);
+	const double MeanIndex = IndexSum / FMath::Max(NumSelected, 1);
+	AddInfo(FString::Printf(TEXT("Mean selected index %.1f (expected ~%d)"), MeanIndex, NumParticles / 2));
+	TestTrue(TEXT("Mean index near buffer center"), FMath::Abs(MeanIndex - NumParticles * 0.5) < NumParticles * 0.05);
+
+	return true;
+}
+
+//=============================================================================
+// P-04: Importance Weighting
+// Fast particles (weight 4) are selected more often than slow ones (weight 1)
+//=============================================================================
+bool FKawaiiFluidSplashSelectorTest_ImportanceWeighting::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSplashSettings Settings;
+	Settings.ConditionMode = ESplashConditionMode::VelocityOnly;
+	Settings.VelocityThreshold = 100.0f;
+	Settings.Budget = 8;
+
+	// Even IDs slow (weight 1), odd IDs fast (weight 4)
+	FSplashTestParticles Particles;
+	for (int32 i = 0; i < 4000; ++i)
+	{
+		Particles.Add((i & 1) ? 400.0f : 101.0f, 0);
+	}
+
+	int32 SlowSelected = 0;
+	int32 FastSelected = 0;
+	TArray<FGPUSplashCandidate> Candidates;
+	for (uint32 Frame = 0; Frame < 200; ++Frame)
+	{
+		Particles.Compact(Settings, Frame, Candidates);
+		FKawaiiFluidSplashSelector::SelectTopCandidates(Candidates, Settings.Budget);
+		for (const FGPUSplashCandidate& Candidate : Candidates)
+		{
+			if (Candidate.ParticleID & 1)
+			{
+				++FastSelected;
+			}
+			else
+			{
+				++SlowSelected;
+			}
+		}
+	}
+
+	const double Ratio = static_cast<double>(FastSelected) / FMath::Max(SlowSelected, 1);
+	AddInfo(FString::Printf(TEXT("Fast/slow selection ratio %.2f"), Ratio));
+	TestTrue(TEXT("Fast particles preferred"), Ratio > 2.0);
+	TestTrue(TEXT("Slow particles still selected"), SlowSelected > 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,319 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// Surface Detection Unit Tests
+// Lattice classification and normals, sparse inputs and the neighbor threshold, hysteresis, surface-only cohesion
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Physics/SurfaceDetector.h"
+#include "Physics/AdhesionSolver.h"
+#include "Physics/SPHKernelTable.h"
+#include "Core/FluidParticle.h"
+#include "Core/SpatialHash.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSurfaceTest_BlockClassification,
+	"KawaiiFluid.Physics.Surface.S01_BlockClassification",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSurfaceTest_SparseAndThreshold,
+	"KawaiiFluid.Physics.Surface.S02_SparseAndThreshold",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSurfaceTest_TemporalCoherence,
+	"KawaiiFluid.Physics.Surface.S03_TemporalCoherence",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSurfaceTest_SurfaceOnlyCohesion,
+	"KawaiiFluid.Physics.Surface.S04_SurfaceOnlyCohesion",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	// h = 2 * spacing: a lattice particle has 26 neighbors (|offset|² = 1, 2, 3 spacings²)
+	constexpr float TestSpacing = 10.0f;
+	constexpr float TestSmoothingRadius = 20.0f;
+
+	/** Lattice coordinates of particle i in a Count^3 block (X fastest) */
+	FIntVector LatticeCoord(int32 Index, int32 Count)
+	{
+		return FIntVector(Index % Count, (Index / Count) % Count, Index / (Count * Count));
+	}
+
+	/** Count^3 block from the origin, X fastest; cells in Skip are left empty */
+	TArray<FFluidParticle> MakeLattice(int32 Count, const TArray<FIntVector>& Skip = TArray<FIntVector>())
+	{
+		TArray<FFluidParticle> Particles;
+		for (int32 z = 0; z < Count; ++z)
+		{
+			for (int32 y = 0; y < Count; ++y)
+			{
+				for (int32 x = 0; x < Count; ++x)
+				{
+					if (!Skip.Contains(FIntVector(x, y, z)))
+					{
+						Particles.Add(FFluidParticle(FVector(x, y, z) * TestSpacing, Particles.Num()));
+					}
+				}
+			}
+		}
+		return Particles;
+	}
+
+	/** Index of the particle at a lattice position (INDEX_NONE if absent) */
+	int32 FindParticle(const TArray<FFluidParticle>& Particles, const FIntVector& Coord)
+	{
+		const FVector Position = FVector(Coord.X, Coord.Y, Coord.Z) * TestSpacing;
+		return Particles.IndexOfByPredicate([&Position](const FFluidParticle& P) { return P.Position.Equals(Position, 1e-3); });
+	}
+
+	void BuildNeighborLists(TArray<FFluidParticle>& Particles)
+	{
+		TArray<FVector> Positions;
+		for (const FFluidParticle& P : Particles)
+		{
+			Positions.Add(P.Position);
+		}
+
+		FSpatialHash SpatialHash(TestSmoothingRadius);
+		SpatialHash.BuildFromPositions(Positions);
+		for (FFluidParticle& P : Particles)
+		{
+			SpatialHash.GetNeighbors(P.Position, TestSmoothingRadius, P.NeighborIndices);
+		}
+	}
+
+	FSurfaceDetectorSettings MakeSettings()
+	{
+		FSurfaceDetectorSettings Settings;
+		Settings.SmoothingRadius = TestSmoothingRadius;
+		return Settings;
+	}
+}
+
+//=============================================================================
+// S-01: Block Classification
+// In a lattice block exactly the outer layer is surface (the layer below has a
+// symmetric neighborhood); face normals point outward, interior normals are zero
+//=============================================================================
+bool FKawaiiFluidSurfaceTest_BlockClassification::RunTest(const FString& Parameters)
+{
+	constexpr int32 Count = 8;
+	TArray<FFluidParticle> Particles = MakeLattice(Count);
+	BuildNeighborLists(Particles);
+
+	FSurfaceDetector Detector;
+	const int32 NumSurface = Detector.Classify(Particles, MakeSettings());
+	TestEqual(TEXT("Surface count is the outer layer"), NumSurface, Count * Count * Count - (Count - 2) * (Count - 2) * (Count - 2));
+
+	bool bOuterLayerOnly = true;
+	bool bInteriorNormalsZero = true;
+	for (int32 i = 0; i < Particles.Num(); ++i)
+	{
+		const FIntVector Coord = LatticeCoord(i, Count);
+		const bool bOuter = FMath::Min3(Coord.X, Coord.Y, Coord.Z) == 0 || FMath::Max3(Coord.X, Coord.Y, Coord.Z) == Count - 1;
+		bOuterLayerOnly &= Particles[i].bIsSurfaceParticle == bOuter;
+		if (!bOuter)
+		{
+			bInteriorNormalsZero &= Particles[i].SurfaceNormal.IsZero();
+		}
+	}
+	TestTrue(TEXT("Flags match the outer layer"), bOuterLayerOnly);
+	TestTrue(TEXT("Interior normals are zero"), bInteriorNormalsZero);
+
+	// Index list: ascending, one entry per flagged particle
+	const TArray<int32>& SurfaceIndices = Detector.GetSurfaceIndices();
+	bool bIndicesMatch = SurfaceIndices.Num() == NumSurface;
+	for (int32 k = 0; k < SurfaceIndices.Num(); ++k)
+	{
+		bIndicesMatch &= Particles[SurfaceIndices[k]].bIsSurfaceParticle && (k == 0 || SurfaceIndices[k - 1] < SurfaceIndices[k]);
+	}
+	TestTrue(TEXT("Surface index list matches the flags"), bIndicesMatch);
+
+	// Face centers: outward unit normals
+	const int32 Mid = Count / 2;
+	const TPair<FIntVector, FVector> Faces[] = {
+		{ FIntVector(0, Mid, Mid), FVector(-1.0, 0.0, 0.0) },
+		{ FIntVector(Count - 1, Mid, Mid), FVector(1.0, 0.0, 0.0) },
+		{ FIntVector(Mid, 0, Mid), FVector(0.0, -1.0, 0.0) },
+		{ FIntVector(Mid, Mid, Count - 1), FVector(0.0, 0.0, 1.0) }
+	};
+	for (const TPair<FIntVector, FVector>& Face : Faces)
+	{
+		const FVector& Normal = Particles[FindParticle(Particles, Face.Key)].SurfaceNormal;
+		TestTrue(FString::Printf(TEXT("Face (%d, %d, %d): outward normal"), Face.Key.X, Face.Key.Y, Face.Key.Z),
+			FVector::DotProduct(Normal, Face.Value) > 0.999 && FMath::IsNearlyEqual(Normal.Size(), 1.0, 1e-4));
+	}
+
+	// Corner normal along the diagonal
+	const FVector CornerNormal = Particles[0].SurfaceNormal;
+	TestTrue(TEXT("Corner: diagonal normal"), FVector::DotProduct(CornerNormal, FVector(-1.0, -1.0, -1.0).GetSafeNormal()) > 0.999);
+
+	return true;
+}
+
+//=============================================================================
+// S-02: Sparse and Threshold
+// Isolated particles and pairs are surface with sensible normals; the neighbor
+// threshold counts neighbors without the particle itself
+//=============================================================================
+bool FKawaiiFluidSurfaceTest_SparseAndThreshold::RunTest(const FString& Parameters)
+{
+	FSurfaceDetector Detector;
+	const FSurfaceDetectorSettings Settings = MakeSettings();
+
+	TArray<FFluidParticle> Empty;
+	TestEqual(TEXT("Empty input"), Detector.Classify(Empty, Settings), 0);
+
+	// Isolated: surface, no direction
+	TArray<FFluidParticle> Single;
+	Single.Add(FFluidParticle(FVector(5.0, -3.0, 2.0), 0));
+	BuildNeighborLists(Single);
+	TestEqual(TEXT("Isolated: surface"), Detector.Classify(Single, Settings), 1);
+	TestTrue(TEXT("Isolated: zero normal"), Single[0].SurfaceNormal.IsZero());
+
+	// Pair: both surface, normals point away from each other
+	TArray<FFluidParticle> Pair;
+	Pair.Add(FFluidParticle(FVector(0.0, 0.0, 0.0), 0));
+	Pair.Add(FFluidParticle(FVector(TestSpacing, 0.0, 0.0), 1));
+	BuildNeighborLists(Pair);
+	TestEqual(TEXT("Pair: both surface"), Detector.Classify(Pair, Settings), 2);
+	TestTrue(TEXT("Pair: normals point away"),
+		Pair[0].SurfaceNormal.Equals(FVector(-1.0, 0.0, 0.0), 1e-5) && Pair[1].SurfaceNormal.Equals(FVector(1.0, 0.0, 0.0), 1e-5));
+
+	// Coincident particles: counted as neighbors, but no direction
+	TArray<FFluidParticle> Coincident;
+	for (int32 i = 0; i < 3; ++i)
+	{
+		Coincident.Add(FFluidParticle(FVector(1.0, 2.0, 3.0), i));
+	}
+	BuildNeighborLists(Coincident);
+	FSurfaceDetectorSettings CountOnly = Settings;
+	CountOnly.GradientThreshold = 2.0f;
+	CountOnly.NeighborThreshold = 2;
+	TestEqual(TEXT("Coincident: two neighbors each reach a threshold of 2"), Detector.Classify(Coincident, CountOnly), 0);
+
+	// Neighbor threshold: lattice particles have at most 26 neighbors
+	constexpr int32 Count = 6;
+	const int32 OuterLayer = Count * Count * Count - (Count - 2) * (Count - 2) * (Count - 2);
+	TArray<FFluidParticle> Block = MakeLattice(Count);
+	BuildNeighborLists(Block);
+
+	FSurfaceDetectorSettings Threshold = Settings;
+	Threshold.bTemporalCoherence = false;
+	Threshold.NeighborThreshold = 26;
+	TestEqual(TEXT("Threshold 26: full neighborhoods stay interior"), Detector.Classify(Block, Threshold), OuterLayer);
+	Threshold.NeighborThreshold = 27;
+	TestEqual(TEXT("Threshold 27: every particle is surface"), Detector.Classify(Block, Threshold), Block.Num());
+
+	return true;
+}
+
+//=============================================================================
+// S-03: Temporal Coherence
+// A particle inside the hysteresis band keeps last frame's classification;
+// without coherence, and for particles below the band, flags are recomputed
+//=============================================================================
+bool FKawaiiFluidSurfaceTest_TemporalCoherence::RunTest(const FString& Parameters)
+{
+	// Three +X neighbors removed from the center: gradient ~0.17, between exit (0.12) and enter (0.2)
+	constexpr int32 Count = 9;
+	const TArray<FIntVector> Holes = { FIntVector(5, 4, 4), FIntVector(5, 5, 4), FIntVector(5, 4, 5) };
+	TArray<FFluidParticle> Particles = MakeLattice(Count, Holes);
+	BuildNeighborLists(Particles);
+
+	const int32 Center = FindParticle(Particles, FIntVector(4, 4, 4));
+	const int32 Calm = FindParticle(Particles, FIntVector(2, 2, 2));
+
+	FSurfaceDetector Detector;
+	const FSurfaceDetectorSettings Settings = MakeSettings();
+	Detector.Classify(Particles, Settings);
+	TestFalse(TEXT("Band particle enters as interior"), Particles[Center].bIsSurfaceParticle);
+
+	// Flag everything as surface last frame
+	for (FFluidParticle& P : Particles)
+	{
+		P.bIsSurfaceParticle = true;
+	}
+	Detector.Classify(Particles, Settings);
+	TestTrue(TEXT("Band particle stays surface"), Particles[Center].bIsSurfaceParticle);
+	TestTrue(TEXT("Band particle: normal toward the hole"), Particles[Center].SurfaceNormal.X > 0.5);
+	TestFalse(TEXT("Symmetric particle leaves the surface"), Particles[Calm].bIsSurfaceParticle);
+	TestTrue(TEXT("Index list includes the band particle"), Detector.GetSurfaceIndices().Contains(Center));
+
+	// Without coherence the previous flag is ignored
+	FSurfaceDetectorSettings Stateless = Settings;
+	Stateless.bTemporalCoherence = false;
+	Detector.Classify(Particles, Stateless);
+	TestFalse(TEXT("No coherence: band particle is interior"), Particles[Center].bIsSurfaceParticle);
+
+	// Repeated passes are stable
+	Detector.Classify(Particles, Settings);
+	const TArray<int32> FirstPass = Detector.GetSurfaceIndices();
+	Detector.Classify(Particles, Settings);
+	TestTrue(TEXT("Repeated pass: same surface"), Detector.GetSurfaceIndices() == FirstPass);
+
+	return true;
+}
+
+//=============================================================================
+// S-04: Surface-Only Cohesion
+// Restricting ApplyCohesion to the surface index list gives surface particles
+// exactly the full-pass velocities; interior particles only lose a force that
+// cancels in a symmetric neighborhood
+//=============================================================================
+bool FKawaiiFluidSurfaceTest_SurfaceOnlyCohesion::RunTest(const FString& Parameters)
+{
+	constexpr int32 Count = 7;
+	constexpr float CohesionStrength = 0.5f;
+
+	TArray<FFluidParticle> Particles = MakeLattice(Count);
+	BuildNeighborLists(Particles);
+
+	FSurfaceDetector Detector;
+	Detector.Classify(Particles, MakeSettings());
+	const TArray<int32>& SurfaceIndices = Detector.GetSurfaceIndices();
+
+	FSPHKernelTable KernelTable;
+	KernelTable.Build(TestSmoothingRadius);
+	const FSPHKernelTable* Tables[] = { nullptr, &KernelTable };
+
+	for (const FSPHKernelTable* Table : Tables)
+	{
+		const TCHAR* Path = Table ? TEXT("Table") : TEXT("Analytic");
+
+		TArray<FFluidParticle> Full = Particles;
+		TArray<FFluidParticle> SurfaceOnly = Particles;
+		FAdhesionSolver Solver;
+		Solver.ApplyCohesion(Full, CohesionStrength, TestSmoothingRadius, Table);
+		Solver.ApplyCohesion(SurfaceOnly, CohesionStrength, TestSmoothingRadius, Table, &SurfaceIndices);
+
+		double MaxSurfaceSpeed = 0.0;
+		double MaxInteriorSpeed = 0.0;
+		bool bSurfaceMatches = true;
+		bool bInteriorUntouched = true;
+		for (int32 i = 0; i < Particles.Num(); ++i)
+		{
+			if (Particles[i].bIsSurfaceParticle)
+			{
+				bSurfaceMatches &= SurfaceOnly[i].Velocity == Full[i].Velocity;
+				MaxSurfaceSpeed = FMath::Max(MaxSurfaceSpeed, Full[i].Velocity.Size());
+			}
+			else
+			{
+				bInteriorUntouched &= SurfaceOnly[i].Velocity.IsZero();
+				MaxInteriorSpeed = FMath::Max(MaxInteriorSpeed, Full[i].Velocity.Size());
+			}
+		}
+
+		TestTrue(FString::Printf(TEXT("%s: surface velocities match the full pass"), Path), bSurfaceMatches);
+		TestTrue(FString::Printf(TEXT("%s: interior velocities untouched"), Path), bInteriorUntouched);
+		TestTrue(FString::Printf(TEXT("%s: surface is pulled inward"), Path), MaxSurfaceSpeed > 0.0);
+		TestTrue(FString::Printf(TEXT("%s: full-pass interior force cancels (%.3g vs %.3g)"), Path, MaxInteriorSpeed, MaxSurfaceSpeed),
+			MaxInteriorSpeed < 1e-4 * MaxSurfaceSpeed);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,238 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// XSPH Viscosity Unit Tests
+// Bitwise-identical results for any work split, parity with a double-precision reference, buffer reuse
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Physics/ViscositySolver.h"
+#include "Core/FluidParticle.h"
+#include "Core/SpatialHash.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidViscosityTest_ThreadCountDeterminism,
+	"KawaiiFluid.Physics.Viscosity.V01_ThreadCountDeterminism",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidViscosityTest_MatchesReference,
+	"KawaiiFluid.Physics.Viscosity.V02_MatchesReference",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidViscosityTest_BufferReuse,
+	"KawaiiFluid.Physics.Viscosity.V03_BufferReuse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float TestSmoothingRadius = 20.0f;
+	constexpr float TestViscosity = 0.3f;
+	constexpr float MaxSpeed = 400.0f;
+
+	/** Jittered lattice block (spacing h/2) with random velocities */
+	TArray<FFluidParticle> MakeBlock(FRandomStream& Random, int32 Count, const FVector& Origin)
+	{
+		const float Spacing = TestSmoothingRadius * 0.5f;
+		TArray<FFluidParticle> Particles;
+		for (int32 z = 0; z < Count; ++z)
+		{
+			for (int32 y = 0; y < Count; ++y)
+			{
+				for (int32 x = 0; x < Count; ++x)
+				{
+					const FVector Jitter(Random.FRandRange(-0.3f, 0.3f), Random.FRandRange(-0.3f, 0.3f), Random.FRandRange(-0.3f, 0.3f));
+					FFluidParticle P(Origin + (FVector(x, y, z) + Jitter) * Spacing, Particles.Num());
+					P.Velocity = FVector(Random.VRand()) * Random.FRandRange(0.0f, MaxSpeed);
+					Particles.Add(P);
+				}
+			}
+		}
+		return Particles;
+	}
+
+	void BuildNeighborLists(TArray<FFluidParticle>& Particles)
+	{
+		TArray<FVector> Positions;
+		for (const FFluidParticle& P : Particles)
+		{
+			Positions.Add(P.Position);
+		}
+
+		FSpatialHash SpatialHash(TestSmoothingRadius);
+		SpatialHash.BuildFromPositions(Positions);
+		for (FFluidParticle& P : Particles)
+		{
+			SpatialHash.GetNeighbors(P.Position, TestSmoothingRadius, P.NeighborIndices);
+		}
+	}
+
+	/** XSPH in double precision (the Poly6 normalization cancels in the weighted mean) */
+	TArray<FVector> ReferenceXSPH(const TArray<FFluidParticle>& Particles, double Viscosity, double h)
+	{
+		TArray<FVector> Velocities;
+		for (int32 i = 0; i < Particles.Num(); ++i)
+		{
+			FVector Correction = FVector::ZeroVector;
+			double WeightSum = 0.0;
+			for (int32 j : Particles[i].NeighborIndices)
+			{
+				const double Diff = h * h - FVector::DistSquared(Particles[i].Position, Particles[j].Position);
+				if (j != i && Diff > 0.0)
+				{
+					const double Weight = Diff * Diff * Diff;
+					Correction += (Particles[j].Velocity - Particles[i].Velocity) * Weight;
+					WeightSum += Weight;
+				}
+			}
+			Velocities.Add(Particles[i].Velocity + (WeightSum > 0.0 ? Correction * (Viscosity / WeightSum) : FVector::ZeroVector));
+		}
+		return Velocities;
+	}
+
+	bool VelocitiesIdentical(const TArray<FFluidParticle>& A, const TArray<FFluidParticle>& B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+		for (int32 i = 0; i < A.Num(); ++i)
+		{
+			if (A[i].Velocity != B[i].Velocity)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+//=============================================================================
+// V-01: Thread Count Determinism
+// Every particle sums its neighbors in a fixed order, so one range (single
+// thread), a few ranges, many ranges and one particle per range agree bitwise
+//=============================================================================
+bool FKawaiiFluidViscosityTest_ThreadCountDeterminism::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(49);
+	TArray<FFluidParticle> Input = MakeBlock(Random, 12, FVector(-40.0, 10.0, 300.0));
+	BuildNeighborLists(Input);
+
+	TArray<FFluidParticle> SingleRange = Input;
+	FViscositySolver Solver;
+	Solver.ApplyXSPH(SingleRange, TestViscosity, TestSmoothingRadius, 1);
+	TestFalse(TEXT("Viscosity changed the velocities"), VelocitiesIdentical(SingleRange, Input));
+
+	const int32 RangeCounts[] = { 0, 2, 3, 7, 64, 1000, Input.Num(), Input.Num() * 4 };
+	for (int32 NumRanges : RangeCounts)
+	{
+		TArray<FFluidParticle> Split = Input;
+		Solver.ApplyXSPH(Split, TestViscosity, TestSmoothingRadius, NumRanges);
+		TestTrue(FString::Printf(TEXT("%d ranges: bitwise identical to one range"), NumRanges), VelocitiesIdentical(Split, SingleRange));
+	}
+
+	// Positions and neighbor lists are read only
+	TArray<FFluidParticle> Again = Input;
+	Solver.ApplyXSPH(Again, TestViscosity, TestSmoothingRadius);
+	bool bReadOnlyUntouched = true;
+	for (int32 i = 0; i < Input.Num(); ++i)
+	{
+		bReadOnlyUntouched &= Again[i].Position == Input[i].Position && Again[i].NeighborIndices == Input[i].NeighborIndices;
+	}
+	TestTrue(TEXT("Positions and neighbor lists untouched"), bReadOnlyUntouched);
+
+	return true;
+}
+
+//=============================================================================
+// V-02: Matches Reference
+// Float SIMD result matches double-precision XSPH near and far from the world
+// origin; particles without neighbors and uniform flow are left exactly as is
+//=============================================================================
+bool FKawaiiFluidViscosityTest_MatchesReference::RunTest(const FString& Parameters)
+{
+	const FVector Origins[] = { FVector(0.0), FVector(-8.0e5, 4.0e5, 1.0e3) };
+	for (const FVector& Origin : Origins)
+	{
+		FRandomStream Random(7);
+		TArray<FFluidParticle> Particles = MakeBlock(Random, 10, Origin);
+		BuildNeighborLists(Particles);
+		const TArray<FVector> Reference = ReferenceXSPH(Particles, TestViscosity, TestSmoothingRadius);
+
+		FViscositySolver Solver;
+		Solver.ApplyXSPH(Particles, TestViscosity, TestSmoothingRadius);
+
+		double WorstError = 0.0;
+		for (int32 i = 0; i < Particles.Num(); ++i)
+		{
+			WorstError = FMath::Max(WorstError, (Particles[i].Velocity - Reference[i]).GetAbsMax());
+		}
+		TestTrue(FString::Printf(TEXT("Origin %.0f: matches double reference (worst %.2e cm/s)"), Origin.X, WorstError), WorstError < 1e-5 * MaxSpeed);
+	}
+
+	FViscositySolver Solver;
+
+	// Isolated particle: no neighbor in range, velocity kept exactly
+	TArray<FFluidParticle> Isolated;
+	Isolated.Add(FFluidParticle(FVector(0.0), 0));
+	Isolated.Add(FFluidParticle(FVector(TestSmoothingRadius * 3.0, 0.0, 0.0), 1));
+	Isolated[0].Velocity = FVector(123.456789, -0.1, 7.0);
+	Isolated[1].Velocity = FVector(-50.0, 0.0, 0.0);
+	BuildNeighborLists(Isolated);
+	Solver.ApplyXSPH(Isolated, TestViscosity, TestSmoothingRadius);
+	TestTrue(TEXT("Isolated particle keeps its velocity"), Isolated[0].Velocity == FVector(123.456789, -0.1, 7.0));
+
+	// Uniform flow: every velocity difference is zero
+	FRandomStream Random(11);
+	TArray<FFluidParticle> Uniform = MakeBlock(Random, 6, FVector(0.0));
+	const FVector Flow(31.25, -12.5, 250.0);
+	for (FFluidParticle& P : Uniform)
+	{
+		P.Velocity = Flow;
+	}
+	BuildNeighborLists(Uniform);
+	Solver.ApplyXSPH(Uniform, TestViscosity, TestSmoothingRadius);
+	bool bUniformKept = true;
+	for (const FFluidParticle& P : Uniform)
+	{
+		bUniformKept &= P.Velocity == Flow;
+	}
+	TestTrue(TEXT("Uniform flow unchanged"), bUniformKept);
+
+	// Zero coefficient is a no-op
+	TArray<FFluidParticle> Untouched = MakeBlock(Random, 4, FVector(0.0));
+	BuildNeighborLists(Untouched);
+	const TArray<FFluidParticle> Before = Untouched;
+	Solver.ApplyXSPH(Untouched, 0.0f, TestSmoothingRadius);
+	TestTrue(TEXT("Zero viscosity leaves velocities"), VelocitiesIdentical(Untouched, Before));
+
+	return true;
+}
+
+//=============================================================================
+// V-03: Buffer Reuse
+// The persistent snapshot and work ranges follow the particle count: a solver
+// reused across large, small and large sets matches a fresh solver each time
+//=============================================================================
+bool FKawaiiFluidViscosityTest_BufferReuse::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(3);
+	const int32 Sizes[] = { 11, 3, 1, 9, 11 };
+
+	FViscositySolver Reused;
+	for (int32 Size : Sizes)
+	{
+		TArray<FFluidParticle> Input = MakeBlock(Random, Size, FVector(Size * 100.0, 0.0, 0.0));
+		BuildNeighborLists(Input);
+
+		TArray<FFluidParticle> FromReused = Input;
+		TArray<FFluidParticle> FromFresh = Input;
+		FViscositySolver Fresh;
+		Reused.ApplyXSPH(FromReused, TestViscosity, TestSmoothingRadius);
+		Fresh.ApplyXSPH(FromFresh, TestViscosity, TestSmoothingRadius);
+
+		TestTrue(FString::Printf(TEXT("%d^3 particles: reused solver matches a fresh one"), Size), VelocitiesIdentical(FromReused, FromFresh));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
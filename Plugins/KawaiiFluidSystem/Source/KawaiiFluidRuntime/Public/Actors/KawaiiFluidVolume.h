@@ -11,11 +11,14 @@
 
 class UKawaiiFluidVolumeComponent;
 class UNiagaraSystem;
+class UNiagaraComponent;
+class FGPUFluidSimulator;
 class UKawaiiFluidSimulationModule;
 class UKawaiiFluidSimulationContext;
 class UKawaiiFluidPresetDataAsset;
 class UKawaiiFluidRenderingModule;
 class AKawaiiFluidEmitter;
+struct FKawaiiFluidBrushSampleRegion;
 
 /**
  * Kawaii Fluid Volume
@@ -114,12 +117,22 @@ public:
 	// Brush API (Editor/Runtime shared)
 	//========================================
 
-	/** Add particles within radius (hemisphere distribution - spawns above surface only) */
+	/** Add particles within radius (hemisphere distribution - spawns above surface only, ignores BrushSettings.bFillEmptySpace) */
 	UFUNCTION(BlueprintCallable, Category = "Brush")
 	void AddParticlesInRadius(const FVector& WorldCenter, float Radius, int32 Count,
 	                          const FVector& Velocity, float Randomness = 0.8f,
 	                          const FVector& SurfaceNormal = FVector::UpVector);
 
+	/**
+	 * Brush spawn positions for a stroke region (capsule from the previous to the current brush position)
+	 * With bFillEmptySpace: seeded Poisson-disk samples at the preset ParticleSpacing, placed only where neither
+	 * existing particles of any source nor ExtraOccupied (samples of the same drag not yet read back) are.
+	 * Count caps the samples per stroke. Otherwise: Count random points in the hemisphere around Region.End.
+	 */
+	void ComputeBrushSpawnPositions(const FKawaiiFluidBrushSampleRegion& Region, int32 Count, float Randomness,
+	                                int32 Seed, bool bFillEmptySpace, TConstArrayView<FVector> ExtraOccupied,
+	                                TArray<FVector>& OutPositions) const;
+
 	/** Remove particles within radius (GPU-driven, no readback dependency) */
 	UFUNCTION(BlueprintCallable, Category = "Brush")
 	void RemoveParticlesInRadiusGPU(const FVector& WorldCenter, float Radius);
@@ -235,6 +248,20 @@ protected:
 	UPROPERTY(Transient)
 	TArray<TWeakObjectPtr<AKawaiiFluidEmitter>> RegisteredEmitters;
 
+	//========================================
+	// Splash VFX
+	//========================================
+
+	/** Persistent Niagara component receiving all splashes (bPooledSplashVFX) */
+	UPROPERTY(Transient)
+	TObjectPtr<UNiagaraComponent> SplashNiagaraComponent;
+
+	/** Splash system last checked for the pooled user parameters */
+	TWeakObjectPtr<const UNiagaraSystem> PooledSplashCheckedSystem;
+
+	/** Whether PooledSplashCheckedSystem exposes User.SplashPositions/SplashDirections/SplashCount */
+	bool bPooledSplashParamsFound = false;
+
 	//========================================
 	// Spawn Request Queue
 	//========================================
@@ -326,11 +353,6 @@ private:
 	/** Cached shadow velocities for prediction */
 	TArray<FVector> CachedShadowVelocities;
 
-	/** Cached neighbor counts for isolation detection */
-	TArray<int32> CachedNeighborCounts;
-
-	/** Previous frame neighbor counts for state change detection (non-isolated -> isolated) */
-	TArray<int32> PrevNeighborCounts;
 
 	/** Cached anisotropy axis 1 (xyz=direction, w=scale) for ellipsoid shadows */
 	TArray<FVector4> CachedAnisotropyAxis1;
@@ -349,4 +371,36 @@ private:
 
 	/** Buffer for shadow position prediction to avoid per-frame allocation */
 	TArray<FVector> ShadowPredictionBuffer;
+
+	//========================================
+	// Brush
+	//========================================
+
+	/** Seed of the next AddParticlesInRadius stroke (deterministic sequence per volume) */
+	int32 BrushStrokeSeed = 0;
+
+	//========================================
+	// Splash Detection
+	//========================================
+
+	/** Selected splash candidates (GPU readback or CPU reference) */
+	TArray<FGPUSplashCandidate> SplashCandidates;
+
+	/** CPU mode: per-particle isolation state for state change detection (non-isolated -> isolated) */
+	TBitArray<> CPUSplashWasIsolated;
+
+	/** CPU mode: hash seed for splash selection */
+	uint32 CPUSplashFrameIndex = 0;
+
+	/** Pooled component currently holds a non-zero splash count */
+	bool bSplashNiagaraHasSplashes = false;
+
+	/** Select this frame's splashes (GPU candidates or CPU reference) and emit them */
+	void UpdateSplashVFX(bool bGPUActive, FGPUFluidSimulator* GPUSimulator);
+
+	/** Emit selected splashes (pooled Niagara arrays or one system per splash) */
+	void EmitSplashes(const TArray<FGPUSplashCandidate>& Candidates);
+
+	/** Destroy the pooled splash component */
+	void CleanupSplashVFX();
 };
@@ -31,6 +31,8 @@ public:
 
 	virtual float GetSignedDistance(const FVector& Point, FVector& OutGradient) const override;
 
+	virtual FBox GetQueryBounds() const override;
+
 private:
 	FVector WorldToLocal(const FVector& WorldPoint) const;
 
@@ -40,6 +40,8 @@ public:
 
 	virtual float GetSignedDistance(const FVector& Point, FVector& OutGradient) const override;
 
+	virtual FBox GetQueryBounds() const override;
+
 private:
 	FVector GetCapsuleCenter() const;
 
@@ -42,6 +42,9 @@ public:
 
 	virtual bool IsCacheValid() const { return false; }
 
+	/** World-space box around the shape; closest-point queries from outside report at least the distance to it (invalid box = unbounded) */
+	virtual FBox GetQueryBounds() const { return FBox(ForceInit); }
+
 	UFUNCTION(BlueprintCallable, Category = "Fluid Collider")
 	virtual bool GetClosestPoint(const FVector& Point, FVector& OutClosestPoint, FVector& OutNormal, float& OutDistance) const;
 
@@ -0,0 +1,65 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UKawaiiFluidCollider;
+
+/**
+ * @brief Uniform grid over collider query bounds.
+ * @details Rebuilt once per substep from UKawaiiFluidCollider::GetQueryBounds inflated by a margin,
+ * so a particle only runs closest-point queries against the colliders whose inflated bounds contain
+ * it. Colliders without bounds, or spanning too many cells, are tested by every query.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidColliderBroadphase
+{
+public:
+	/** Candidate collider indices of one query (no heap allocation for typical counts) */
+	using FCandidateList = TArray<int32, TInlineAllocator<16>>;
+
+	FKawaiiFluidColliderBroadphase();
+
+	/**
+	 * @brief Rebuild the grid.
+	 * @param Colliders Collider list; disabled and null entries are skipped
+	 * @param Margin Distance added to every collider's bounds
+	 */
+	void Build(const TArray<TObjectPtr<UKawaiiFluidCollider>>& Colliders, float Margin);
+
+	/**
+	 * @brief Get the colliders whose inflated bounds contain a point.
+	 * @param Position Query point in world space
+	 * @param OutColliders Indices into the Build collider array, ascending
+	 */
+	void Query(const FVector& Position, FCandidateList& OutColliders) const;
+
+	/** Number of enabled colliders of the last Build */
+	int32 GetNumColliders() const { return NumColliders; }
+
+	/** Number of grid cells in use */
+	int32 GetNumCells() const { return Grid.Num(); }
+
+	/** Grid cell size (cm) */
+	float GetCellSize() const { return CellSize; }
+
+private:
+	/** Colliders covering more cells than this are tested by every query instead */
+	static constexpr int64 MaxCellsPerCollider = 64;
+
+	FIntVector GetCellCoord(const FVector& Position) const;
+
+	/** Cell size: median largest dimension of the inflated bounds */
+	float CellSize;
+
+	int32 NumColliders;
+
+	/** Inflated bounds per collider index (invalid = unbounded) */
+	TArray<FBox> InflatedBounds;
+
+	/** Cell coordinate -> collider indices, ascending */
+	TMap<FIntVector, TArray<int32>> Grid;
+
+	/** Unbounded and oversized colliders, ascending */
+	TArray<int32> GlobalColliders;
+};
@@ -131,6 +131,8 @@ public:
 
 	virtual bool IsCacheValid() const override { return bCacheValid; }
 
+	virtual FBox GetQueryBounds() const override;
+
 	void ExportToGPUPrimitives(
 		TArray<struct FGPUCollisionSphere>& OutSpheres,
 		TArray<struct FGPUCollisionCapsule>& OutCapsules,
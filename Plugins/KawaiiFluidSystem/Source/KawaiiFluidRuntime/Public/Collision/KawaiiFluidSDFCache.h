@@ -0,0 +1,288 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+//
+// Sparse-Brick SDF Cache for Static World Collision
+// =================================================
+// Bakes the signed distance of static world collision shapes (spheres, capsules, oriented boxes,
+// convex hulls) into sparse bricks of BrickCells^3 voxels on a world-aligned grid.
+// Only bricks near or inside geometry are stored; everything else reads as "far".
+//
+// World collision then becomes one trilinear lookup per particle instead of overlap queries
+// followed by closest-point queries against every overlapped primitive.
+//
+// Shapes are grouped by owner (actor UniqueID). Changing or removing an owner only dirties the
+// bricks it touched; dirty bricks are rebuilt synchronously or in a background task.
+// Each brick also keeps the owners near it and, per sample, which of them is closest, so a
+// lookup reports the hit owner as well as the distance.
+//
+// ExportBrickData flattens the bricks into an open-addressed coordinate table plus one packed
+// sample array; the GPU world-collision pass (FluidSDFBrickCollision.usf) reads that layout.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/Task.h"
+
+struct FGPUCollisionPrimitives;
+
+/** SDF shape type */
+enum class EKawaiiFluidSDFShapeType : uint8
+{
+	Sphere,
+	Capsule,
+	Box,
+	Convex
+};
+
+/**
+ * Analytic collision shape in world space
+ * @param Center Sphere/box center, capsule start
+ * @param End Capsule end
+ * @param Extent Box half extents
+ * @param Radius Sphere/capsule radius
+ * @param Rotation Box rotation
+ * @param Planes Convex planes (outward normal, W = distance from origin)
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidSDFShape
+{
+	EKawaiiFluidSDFShapeType Type = EKawaiiFluidSDFShapeType::Sphere;
+	FVector Center = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+	FVector Extent = FVector::ZeroVector;
+	float Radius = 0.0f;
+	FQuat Rotation = FQuat::Identity;
+	TArray<FPlane> Planes;
+
+	static FKawaiiFluidSDFShape MakeSphere(const FVector& InCenter, float InRadius);
+	static FKawaiiFluidSDFShape MakeCapsule(const FVector& InStart, const FVector& InEnd, float InRadius);
+	static FKawaiiFluidSDFShape MakeBox(const FVector& InCenter, const FVector& InExtent, const FQuat& InRotation);
+
+	/**
+	 * Convex hull from outward planes
+	 * @param InCenter Point inside the hull
+	 * @param InBoundingRadius Radius of a sphere around InCenter that contains the hull
+	 */
+	static FKawaiiFluidSDFShape MakeConvex(const FVector& InCenter, float InBoundingRadius, TArray<FPlane> InPlanes);
+
+	/**
+	 * Signed distance (negative inside)
+	 * Convex distance is max(plane distance): exact inside and on faces, a lower bound near edges.
+	 */
+	float Evaluate(const FVector& Position) const;
+
+	/** World AABB */
+	FBox GetBounds() const;
+};
+
+/**
+ * Flat brick layout uploaded to the GPU
+ * FKawaiiFluidSDFBrickData::Sample mirrors the lookup in FluidSDFBrickCollision.usf.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidSDFBrickData
+{
+	/** Open-addressed table (power of two, at most half full): XYZ = brick coordinate, W = brick index (INDEX_NONE = empty slot) */
+	TArray<FIntVector4> BrickTable;
+
+	/** Samples of brick i at [i * BrickSamples^3, (i + 1) * BrickSamples^3), x fastest */
+	TArray<float> Samples;
+
+	float VoxelSize = 10.0f;
+
+	int32 GetNumBricks() const;
+	bool IsEmpty() const { return Samples.Num() == 0; }
+
+	/** Table slot hash of a brick coordinate (SDFBrickHash in the shader) */
+	static uint32 HashBrickCoord(const FIntVector& Coord);
+
+	/** Brick index of a coordinate, INDEX_NONE if not stored */
+	int32 FindBrick(const FIntVector& Coord) const;
+
+	/**
+	 * Trilinear lookup in float, as done on the GPU
+	 * @return false if no brick covers Position
+	 */
+	bool Sample(const FVector3f& Position, float& OutDistance, FVector3f& OutNormal) const;
+};
+
+/**
+ * Sparse-brick signed distance cache
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidSDFCache
+{
+public:
+	/** Voxels per brick axis (a brick stores (BrickCells + 1)^3 corner samples) */
+	static constexpr int32 BrickCells = 8;
+	static constexpr int32 BrickSamples = BrickCells + 1;
+
+	/**
+	 * @param InVoxelSize Sample spacing (cm)
+	 * @param InNarrowBand Bricks are kept only if some sample is closer than this (cm)
+	 */
+	explicit FKawaiiFluidSDFCache(float InVoxelSize = 10.0f, float InNarrowBand = 30.0f);
+	~FKawaiiFluidSDFCache();
+
+	FKawaiiFluidSDFCache(const FKawaiiFluidSDFCache&) = delete;
+	FKawaiiFluidSDFCache& operator=(const FKawaiiFluidSDFCache&) = delete;
+
+	//========================================
+	// Shapes
+	//========================================
+
+	/** Replace all shapes of an owner; bricks are dirtied only if the shapes changed */
+	void SetOwnerShapes(int32 OwnerID, TArray<FKawaiiFluidSDFShape> Shapes);
+
+	/** Remove an owner and dirty the bricks it touched */
+	void RemoveOwner(int32 OwnerID);
+
+	/** Invalidate an owner without changing its shapes (forces its bricks to rebuild) */
+	void InvalidateOwner(int32 OwnerID);
+
+	/**
+	 * Sync owners from world collision primitives (BoneIndex < 0 only)
+	 * Owners missing from Primitives are removed; unchanged owners keep their bricks.
+	 */
+	void SyncFromPrimitives(const FGPUCollisionPrimitives& Primitives);
+
+	/** Restrict bricks to a region (changing it rebuilds everything) */
+	void SetClipBounds(const FBox& InClipBounds);
+
+	/** Remove all shapes and bricks */
+	void Reset();
+
+	//========================================
+	// Build
+	//========================================
+
+	/** Rebuild all dirty bricks on the calling thread */
+	void BuildDirtyBricks();
+
+	/** Start rebuilding dirty bricks in a background task (no-op while a build is running) */
+	void KickAsyncBuild();
+
+	/**
+	 * Publish the results of a finished background build (call from the owning thread)
+	 * @return true if bricks were updated
+	 */
+	bool ApplyCompletedBuild();
+
+	/** Is a background build running */
+	bool IsBuildInProgress() const { return PendingBuild.IsValid() && !PendingBuild.IsCompleted(); }
+
+	/** Dirty bricks waiting for a build */
+	int32 GetNumDirtyBricks() const { return DirtyBricks.Num(); }
+
+	//========================================
+	// Query
+	//========================================
+
+	/**
+	 * Trilinear signed distance lookup
+	 * @param Position World position
+	 * @param OutDistance Signed distance (negative inside)
+	 * @param OutNormal Normalized SDF gradient (points away from geometry)
+	 * @return false if no brick covers Position (farther than NarrowBand from any shape)
+	 */
+	bool Sample(const FVector& Position, float& OutDistance, FVector& OutNormal) const;
+
+	/**
+	 * Trilinear signed distance lookup with the owner of the closest shape
+	 * @param OutOwnerID Owner of the shape nearest to the closest sample (INDEX_NONE if unknown)
+	 */
+	bool Sample(const FVector& Position, float& OutDistance, FVector& OutNormal, int32& OutOwnerID) const;
+
+	/**
+	 * Sphere-trace a ray against the cached surface
+	 * @param Start Ray origin
+	 * @param Direction Normalized ray direction
+	 * @param MaxDistance Ray length (cm)
+	 * @param IgnoreOwnerID Surfaces of this owner are passed through (INDEX_NONE = none)
+	 * @param OutDistance Distance along the ray to the hit
+	 * @param OutOwnerID Owner of the hit surface
+	 * @return true if a surface was hit within MaxDistance
+	 */
+	bool Raycast(const FVector& Start, const FVector& Direction, float MaxDistance, int32 IgnoreOwnerID,
+		float& OutDistance, int32& OutOwnerID) const;
+
+	/** Number of allocated bricks */
+	int32 GetNumBricks() const { return Bricks.Num(); }
+
+	/** Has any brick been built */
+	bool HasData() const { return Bricks.Num() > 0; }
+
+	/** Bumped whenever bricks are added, rebuilt or removed */
+	uint32 GetBrickRevision() const { return BrickRevision; }
+
+	/** Flatten the current bricks into the GPU layout (owner data is not exported) */
+	void ExportBrickData(FKawaiiFluidSDFBrickData& OutData) const;
+
+	/** Number of owners */
+	int32 GetNumOwners() const { return Owners.Num(); }
+
+	float GetVoxelSize() const { return VoxelSize; }
+	float GetNarrowBand() const { return NarrowBand; }
+
+	/** Upper bound on bricks marked dirty per change (protects against huge shapes) */
+	int32 MaxBricks = 65536;
+
+	/** Owner slot of samples whose owner did not fit the brick's owner table */
+	static constexpr uint8 UnknownOwnerSlot = MAX_uint8;
+
+private:
+	struct FOwnerEntry
+	{
+		TArray<FKawaiiFluidSDFShape> Shapes;
+		FBox Bounds = FBox(EForceInit::ForceInit);
+		uint32 Hash = 0;
+	};
+
+	struct FBrick
+	{
+		/** Signed distances ((BrickCells + 1)^3, x fastest) */
+		TArray<float> Samples;
+
+		/** Per sample: slot in OwnerIDs of the closest shape's owner */
+		TArray<uint8> SampleOwners;
+
+		/** Owners with a shape near this brick */
+		TArray<int32, TInlineAllocator<4>> OwnerIDs;
+	};
+
+	/** Result of building one brick (empty Samples = brick removed) */
+	struct FBrickResult
+	{
+		FIntVector Coord;
+		FBrick Brick;
+	};
+
+	/** Immutable snapshot of shapes used by a build */
+	struct FBuildInput
+	{
+		TArray<FKawaiiFluidSDFShape> Shapes;
+		TArray<int32> ShapeOwners;
+		TArray<FBox> ExpandedBounds;
+		float VoxelSize = 10.0f;
+		float NarrowBand = 30.0f;
+	};
+
+	static uint32 HashShapes(const TArray<FKawaiiFluidSDFShape>& Shapes);
+	static TArray<FBrickResult> BuildBricks(const FBuildInput& Input, const TArray<FIntVector>& Coords);
+
+	TSharedRef<FBuildInput> MakeBuildInput() const;
+	void MarkDirty(const FBox& Bounds);
+	void ApplyResults(TArray<FBrickResult>& Results);
+	FBox GetBrickBounds(const FIntVector& Coord) const;
+
+	float VoxelSize;
+	float NarrowBand;
+	FBox ClipBounds = FBox(EForceInit::ForceInit);
+
+	TMap<int32, FOwnerEntry> Owners;
+
+	/** Brick coordinate -> samples and owners */
+	TMap<FIntVector, FBrick> Bricks;
+
+	TSet<FIntVector> DirtyBricks;
+
+	uint32 BrickRevision = 0;
+
+	UE::Tasks::TTask<TArray<FBrickResult>> PendingBuild;
+};
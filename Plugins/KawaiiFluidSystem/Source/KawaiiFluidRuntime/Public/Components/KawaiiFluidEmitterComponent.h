@@ -9,6 +9,7 @@
 class AKawaiiFluidEmitter;
 class AKawaiiFluidVolume;
 class UKawaiiFluidSimulationModule;
+class UKawaiiFluidPackingAsset;
 class UBillboardComponent;
 class APawn;
 
@@ -45,6 +46,7 @@ enum class EKawaiiFluidEmitterShapeType : uint8
  * @param CubeHalfSize Half-size for cube shape
  * @param CylinderRadius Radius for cylinder shape
  * @param CylinderHalfHeight Half-height for cylinder shape
+ * @param PresettledPacking Baked rest-density packing used instead of the hexagonal lattice (optional)
  * @param StreamRadius Cross-sectional radius for stream emission
  * @param LayersPerSecond Target spawn rate for stream mode
  * @param bUseStreamJitter Whether to apply random offset to stream particles
@@ -66,6 +68,7 @@ enum class EKawaiiFluidEmitterShapeType : uint8
  * @param bJustCleared Flag to track if particles were just cleared
  * @param bPendingVolumeSearch Whether we need to search for volume in next tick
  * @param bDistanceActivated Current activation state based on player distance
+ * @param bUsesBatchedDistanceActivation Whether the Subsystem evaluates distance activation for this emitter
  * @param CachedPlayerPawn Cached player pawn reference
  * @param DistanceCheckAccumulator Timer for distance check interval
  * @param bNeedsRespawnOnReentry Track if Fill mode needs re-spawn on reentry
@@ -132,6 +135,11 @@ public:
 		meta = (EditCondition = "EmitterMode == EKawaiiFluidEmitterMode::Fill && ShapeType == EKawaiiFluidEmitterShapeType::Cylinder", EditConditionHides, ClampMin = "1.0"))
 	float CylinderHalfHeight = 50.0f;
 
+	/** Pre-settled packing (relaxed offline to rest density); replaces the shape above when baked */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Emitter|Fill Shape",
+		meta = (EditCondition = "EmitterMode == EKawaiiFluidEmitterMode::Fill", EditConditionHides))
+	TObjectPtr<UKawaiiFluidPackingAsset> PresettledPacking;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Emitter|Stream",
 		meta = (EditCondition = "EmitterMode == EKawaiiFluidEmitterMode::Stream", EditConditionHides, ClampMin = "1.0"))
 	float StreamRadius = 25.0f;
@@ -227,6 +235,12 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Emitter")
 	bool IsStreamSpawning() const { return bStreamSpawning; }
 
+	/** Hysteresis buffer for distance deactivation (auto-calculated: 10% of ActivationDistance) */
+	FORCEINLINE float GetHysteresisDistance() const { return ActivationDistance * 0.1f; }
+
+	/** Apply activation state evaluated by the Subsystem's batched distance activation */
+	void ApplyDistanceActivation(bool bNewState);
+
 protected:
 	float SpawnAccumulator = 0.0f;
 
@@ -242,6 +256,9 @@ protected:
 
 	bool bDistanceActivated = true;
 
+	/** Activation is driven by the Subsystem (no custom DistanceReferenceActor) */
+	bool bUsesBatchedDistanceActivation = false;
+
 	TWeakObjectPtr<APawn> CachedPlayerPawn;
 
 	float DistanceCheckAccumulator = 0.0f;
@@ -260,6 +277,8 @@ protected:
 
 	int32 SpawnParticlesCylinderHexagonal(FVector Center, FQuat Rotation, float Radius, float HalfHeight, float Spacing, FVector InInitialVelocity);
 
+	int32 SpawnParticlesFromPacking(FVector Center, FQuat Rotation, float Spacing, FVector InInitialVelocity);
+
 	void SpawnStreamLayer(FVector Position, FVector LayerDirection, FVector VelocityDirection, float Speed, float Radius, float Spacing);
 
 	void SpawnStreamLayerBatch(FVector Position, FVector LayerDirection, FVector VelocityDirection, 
@@ -282,8 +301,6 @@ protected:
 
 	APawn* GetPlayerPawn();
 
-	FORCEINLINE float GetHysteresisDistance() const { return ActivationDistance * 0.1f; }
-
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(Transient)
 	TObjectPtr<UBillboardComponent> BillboardComponent;
@@ -23,6 +23,7 @@ class UNiagaraSystem;
  * @param Preset The fluid preset defining physics and rendering
  * @param MaxParticleCount Maximum GPU buffer capacity for this volume
  * @param bUseWorldCollision Enable interaction with world geometry
+ * @param bUseWorldSDFCache Collide with a baked sparse-brick SDF of world geometry instead of per-primitive tests
  * @param bEnableStaticBoundaryParticles Use static particles for boundary density
  * @param StaticBoundaryParticleSpacing Spacing for static boundary particles
  * @param bEnableCollisionEvents Enable hit events for particles
@@ -35,6 +36,7 @@ class UNiagaraSystem;
  * @param ShadowCullDistance Max distance for shadow rendering
  * @param ShadowRadiusOffset Size adjustment for shadow spheres
  * @param SplashVFX Niagara system for splash effects
+ * @param bPooledSplashVFX Emit all splashes through one persistent Niagara component (User.SplashPositions/SplashDirections arrays + User.SplashCount) instead of spawning a system per splash; systems without those parameters fall back to per-splash spawns
  * @param SplashVelocityThreshold Speed required to trigger splash
  * @param MaxSplashVFXPerFrame Budget for splash spawning
  * @param SplashConditionMode Logic for triggering splashes
@@ -108,6 +110,15 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Volume|Collision")
 	bool bUseWorldCollision = true;
 
+	/**
+	 * Bake world simple collision into sparse SDF bricks and collide with one lookup per particle.
+	 * Falls back to primitives while bricks build and when static boundary particles are enabled.
+	 * World geometry then produces no per-collider collision feedback.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Volume|Collision",
+		meta = (DisplayName = "Use World SDF Cache", EditCondition = "bUseWorldCollision", EditConditionHides))
+	bool bUseWorldSDFCache = false;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Volume|Collision",
 		meta = (DisplayName = "Enable Static Boundary Particles",
 		        EditCondition = "bUseWorldCollision && !bUseUnlimitedSize", EditConditionHides))
@@ -151,6 +162,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Volume|VFX")
 	TObjectPtr<UNiagaraSystem> SplashVFX;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Volume|VFX",
+	          meta = (EditCondition = "SplashVFX != nullptr"))
+	bool bPooledSplashVFX = false;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Volume|VFX",
 	          meta = (ClampMin = "0", EditCondition = "SplashVFX != nullptr"))
 	float SplashVelocityThreshold = 200.0f;
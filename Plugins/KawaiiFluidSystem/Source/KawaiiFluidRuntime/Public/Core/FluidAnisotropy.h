@@ -93,6 +93,28 @@ struct KAWAIIFLUIDRUNTIME_API FFluidAnisotropyParams
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering|Anisotropy|Optimization", meta = (EditCondition = "bEnabled", ClampMin = "1", ClampMax = "10", UIMin = "1", UIMax = "10"))
 	int32 UpdateInterval = 1;
 
+	/**
+	 * Recompute only particles whose neighborhood changed and reuse the previous ellipsoid elsewhere.
+	 * Calm water then costs a fraction of a full pass. Density-based mode only (velocity axes change every frame).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering|Anisotropy|Optimization", meta = (EditCondition = "bEnabled && Mode == EFluidAnisotropyMode::DensityBased"))
+	bool bIncrementalUpdate = false;
+
+	/** Distance a particle may travel before its ellipsoid is recomputed, as a fraction of the smoothing radius. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering|Anisotropy|Optimization",
+		meta = (EditCondition = "bEnabled && bIncrementalUpdate", ClampMin = "0.01", ClampMax = "1.0", UIMin = "0.01", UIMax = "0.5"))
+	float IncrementalMotionThreshold = 0.1f;
+
+	/** Neighbor count change that triggers a recompute. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering|Anisotropy|Optimization",
+		meta = (EditCondition = "bEnabled && bIncrementalUpdate", ClampMin = "1", ClampMax = "16", UIMin = "1", UIMax = "8"))
+	int32 IncrementalNeighborThreshold = 2;
+
+	/** Ellipsoids older than this many updates are recomputed even in still water (bounds accumulated drift). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering|Anisotropy|Optimization",
+		meta = (EditCondition = "bEnabled && bIncrementalUpdate", ClampMin = "1", ClampMax = "600", UIMin = "1", UIMax = "120"))
+	int32 IncrementalMaxStaleFrames = 30;
+
 	/** Blend ellipsoid orientation with previous frame to reduce flickering. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering|Anisotropy|Temporal", meta = (EditCondition = "bEnabled"))
 	bool bEnableTemporalSmoothing = true;
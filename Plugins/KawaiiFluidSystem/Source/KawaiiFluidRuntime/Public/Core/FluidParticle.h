@@ -49,6 +49,10 @@ struct KAWAIIFLUIDRUNTIME_API FFluidParticle
 	UPROPERTY(BlueprintReadOnly, Category = "Particle")
 	FName AttachedBoneName;
 
+	// Attached owner and bone IDs in FAdhesionSolver's attachment table (valid while bIsAttached)
+	int32 AttachedOwnerID;
+	int32 AttachedBoneID;
+
 	// Relative position in bone local coordinates (for bone motion tracking)
 	FVector AttachedLocalOffset;
 
@@ -98,6 +102,8 @@ struct KAWAIIFLUIDRUNTIME_API FFluidParticle
 		, Lambda(0.0f)
 		, bIsAttached(false)
 		, AttachedBoneName(NAME_None)
+		, AttachedOwnerID(INDEX_NONE)
+		, AttachedBoneID(INDEX_NONE)
 		, AttachedLocalOffset(FVector::ZeroVector)
 		, AttachedSurfaceNormal(FVector::UpVector)
 		, bJustDetached(false)
@@ -111,6 +117,18 @@ struct KAWAIIFLUIDRUNTIME_API FFluidParticle
 	{
 	}
 
+	/** Drops the attachment: actor, bone, owner/bone IDs, local offset and surface normal */
+	void ClearAttachment()
+	{
+		bIsAttached = false;
+		AttachedActor.Reset();
+		AttachedBoneName = NAME_None;
+		AttachedOwnerID = INDEX_NONE;
+		AttachedBoneID = INDEX_NONE;
+		AttachedLocalOffset = FVector::ZeroVector;
+		AttachedSurfaceNormal = FVector::UpVector;
+	}
+
 	FFluidParticle(const FVector& InPosition, int32 InID)
 		: Position(InPosition)
 		, PredictedPosition(InPosition)
@@ -120,6 +138,8 @@ struct KAWAIIFLUIDRUNTIME_API FFluidParticle
 		, Lambda(0.0f)
 		, bIsAttached(false)
 		, AttachedBoneName(NAME_None)
+		, AttachedOwnerID(INDEX_NONE)
+		, AttachedBoneID(INDEX_NONE)
 		, AttachedLocalOffset(FVector::ZeroVector)
 		, AttachedSurfaceNormal(FVector::UpVector)
 		, bJustDetached(false)
@@ -0,0 +1,128 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+//
+// Batched Distance Activation Grid
+// ================================
+// Holds activatable objects (emitters, volumes) in a spatial hash and evaluates their
+// distance-based activation against any number of reference points (players, split-screen
+// views, spectators) in one pass. Replaces per-object distance checks with a single
+// O(N + K) update per interval, where K is the number of entries near a reference point.
+//
+// Plain C++ (no UObject dependency) so activation rules can be tested with synthetic positions.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/SpatialHash.h"
+
+/**
+ * Single entry in the activation grid
+ * @param Location World position of the activatable object
+ * @param ActivationDistance Entry becomes active when a reference point is closer than this
+ * @param HysteresisDistance Extra range an active entry keeps before deactivating
+ * @param bActive Current activation state
+ * @param bInUse Slot is allocated (false = free list slot)
+ */
+struct FKawaiiFluidActivationEntry
+{
+	FVector Location = FVector::ZeroVector;
+	float ActivationDistance = 0.0f;
+	float HysteresisDistance = 0.0f;
+	bool bActive = false;
+	bool bInUse = false;
+
+	/** Distance at which the entry changes state (depends on current state for hysteresis) */
+	FORCEINLINE float GetReach() const
+	{
+		return bActive ? ActivationDistance + HysteresisDistance : ActivationDistance;
+	}
+};
+
+/**
+ * Spatially partitioned activation service
+ *
+ * Entries are addressed by stable integer handles. Locations may be updated every interval;
+ * the underlying spatial hash is rebuilt lazily only when something moved or changed.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidActivationGrid
+{
+public:
+	FKawaiiFluidActivationGrid();
+	explicit FKawaiiFluidActivationGrid(float InMinCellSize);
+
+	/** Add entry and return its handle (initially inactive) */
+	int32 AddEntry(const FVector& Location, float ActivationDistance, float HysteresisDistance);
+
+	/** Remove entry; the handle may be reused by a later AddEntry */
+	void RemoveEntry(int32 Handle);
+
+	/** Update location and distances of an existing entry */
+	void SetEntry(int32 Handle, const FVector& Location, float ActivationDistance, float HysteresisDistance);
+
+	/** Update location of an existing entry */
+	void SetEntryLocation(int32 Handle, const FVector& Location);
+
+	/** Is handle allocated */
+	bool IsValidHandle(int32 Handle) const { return Entries.IsValidIndex(Handle) && Entries[Handle].bInUse; }
+
+	/** Override activation state (e.g. initial state evaluated by the caller) */
+	void SetEntryActive(int32 Handle, bool bActive);
+
+	/** Current activation state of entry */
+	bool IsEntryActive(int32 Handle) const { return IsValidHandle(Handle) && Entries[Handle].bActive; }
+
+	/** Number of allocated entries */
+	int32 Num() const { return NumInUse; }
+
+	/** Remove all entries */
+	void Reset();
+
+	/**
+	 * Evaluate activation for all entries against reference points
+	 * An entry is active if ANY reference point is within its reach (hysteresis applied per entry).
+	 * With no reference points every entry deactivates.
+	 * @param ReferencePoints Viewer locations (players, split-screen views, spectators)
+	 * @param OutChangedHandles Handles whose state flipped during this update
+	 */
+	void Update(TConstArrayView<FVector> ReferencePoints, TArray<int32>& OutChangedHandles);
+
+	/**
+	 * Evaluate a location against reference points without modifying any entry
+	 * Used for the initial state of an entry before the first batched update.
+	 */
+	static bool IsWithinActivationRange(const FVector& Location, float ActivationDistance, TConstArrayView<FVector> ReferencePoints);
+
+	/**
+	 * Find the entry closest to a location
+	 * Searches the grid in growing rings and falls back to a linear scan when nothing is nearby.
+	 * @return Handle of nearest entry, or INDEX_NONE if the grid is empty
+	 */
+	int32 FindNearest(const FVector& Location) const;
+
+private:
+	/** Rebuild spatial hash from current entry locations */
+	void RebuildIfDirty() const;
+
+	/** Entry storage (index = handle) */
+	TArray<FKawaiiFluidActivationEntry> Entries;
+
+	/** Free handle list */
+	TArray<int32> FreeHandles;
+
+	int32 NumInUse = 0;
+
+	/** Lower bound for cell size (volumes without activation distance still need a sensible grid) */
+	float MinCellSize = 1000.0f;
+
+	/** Spatial hash over in-use entries (hash index -> HashToHandle) */
+	mutable FSpatialHash SpatialHash;
+	mutable TArray<int32> HashToHandle;
+	mutable float MaxReach = 0.0f;
+	mutable bool bHashDirty = true;
+
+	/** Scratch buffers reused across updates */
+	TArray<int32> CandidateScratch;
+	TBitArray<> InRangeScratch;
+
+	/** Max grid rings searched by FindNearest before falling back to linear scan */
+	static constexpr int32 MaxNearestSearchRings = 4;
+};
@@ -0,0 +1,74 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+//
+// Batch CPU Anisotropy
+// ====================
+// Density-based ellipsoids for a whole particle set on the CPU, without a GPU readback of the
+// anisotropy buffers: shadow proxies, ISM instances and offline captures that already hold the
+// positions. Same algorithm as FluidAnisotropyCompute.usf (through FKawaiiFluidAnisotropyScheduler),
+// laid out for throughput:
+//
+// 1. Grid: particles are sorted by the key of their cell (size h) with X as the fastest part, so the
+//    three X-adjacent cells of a neighbor row are one contiguous range of the sorted SoA arrays
+//    (9 ranges per cell instead of 27 lookups per particle).
+// 2. Covariance: 4 candidates at a time with VectorRegister4Float (kernel weight, weighted center,
+//    then the weighted covariance over the first MaxCachedNeighbors neighbors). Offsets are taken
+//    relative to the particle, which keeps float precision far from the world origin.
+// 3. Eigen and scales: FKawaiiFluidAnisotropyScheduler::ComputeEllipsoid, shared with the
+//    reference, so both paths clamp and blend identically.
+//
+// Cells are processed in parallel; each writes only its own particles' outputs.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/KawaiiFluidAnisotropyScheduler.h"
+
+/**
+ * Reusable batch solver (keeps its grid and sorted arrays between calls)
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidAnisotropyBatch
+{
+public:
+	/**
+	 * Density-based ellipsoids of all particles
+	 * @param Positions Particle positions (non-finite positions get a sphere)
+	 * @param OutEllipsoids One ellipsoid per particle, in input order
+	 * @param OutNeighborCounts Optional kernel neighbor count per particle (includes the particle itself)
+	 */
+	void Compute(
+		TConstArrayView<FVector3f> Positions,
+		const FKawaiiFluidAnisotropySettings& Settings,
+		TArray<FKawaiiFluidEllipsoid>& OutEllipsoids,
+		TArray<uint32>* OutNeighborCounts = nullptr);
+
+	/** Occupied grid cells of the last Compute */
+	int32 GetNumCells() const { return CellKeys.Num(); }
+
+	/**
+	 * Instance transform that turns a unit mesh into the ellipsoid
+	 * @param BaseScale Mesh scale of a sphere particle (axis scales multiply it)
+	 * @return Right-handed rotation with local X/Y along the first two axes
+	 */
+	static FTransform MakeInstanceTransform(const FVector3f& Position, const FKawaiiFluidEllipsoid& Ellipsoid, float BaseScale);
+
+private:
+	void BuildGrid(TConstArrayView<FVector3f> Positions, float CellSize);
+
+	/** Sorted range of the X-row (Cell.X - 1 .. Cell.X + 1) at the given Y/Z; false if empty */
+	bool FindRowRange(const FIntVector& Cell, int32 DY, int32 DZ, int32& OutBegin, int32& OutEnd) const;
+
+	// Cell-sorted SoA positions (padded with far-away entries to a whole SIMD load)
+	TArray<float> SortedX;
+	TArray<float> SortedY;
+	TArray<float> SortedZ;
+	TArray<int32> SortedToParticle;
+
+	// Occupied cells in key order, CellStart has one extra entry (end of the last cell)
+	TArray<uint64> CellKeys;
+	TArray<int32> CellStart;
+	TMap<uint64, int32> CellLookup;
+
+	// Scratch for the sort
+	TArray<uint64> ParticleKeys;
+	TArray<int32> SortOrder;
+};
@@ -0,0 +1,179 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+//
+// Incremental Anisotropy Scheduling (CPU Reference)
+// =================================================
+// Density-based anisotropy (FluidAnisotropyCompute.usf) costs a neighbor traversal, a weighted
+// covariance and a 3x3 eigen decomposition per particle, yet in calm water the ellipsoid barely
+// changes between frames. With bIncrementalUpdate the GPU pass recomputes only particles whose
+// neighborhood changed and copies last frame's axes for the rest. This is the CPU reference of
+// that pass; it mirrors the shader math so the tests can check both the axes and the schedule.
+//
+// 1. Covariance (Yu & Turk 2013, FleX): kernel-weighted center of the neighbors, then the
+//    weighted covariance around it over the first MaxCachedNeighbors neighbors (the shader caches
+//    that many in registers).
+// 2. Eigen: analytic symmetric 3x3 decomposition (Cardano / Kopp 2008), eigenvalues descending;
+//    the eigenvector of the most isolated eigenvalue first, the other two from the 2x2 problem in
+//    its plane (Eberly 2014), so repeated eigenvalues still give an orthonormal basis.
+// 3. Scales: sigma = sqrt(lambda) clamped to sigma0 / K_R, then the volume-preserving log-space
+//    scaling or the FleX h / sigma formula, blended toward a sphere for sparse neighborhoods.
+// 4. Schedule: every particle keeps an FGPUAnisotropyHistory record (position and solver neighbor
+//    count at its last recompute). A particle has *moved* when its record belongs to another
+//    particle (spawn, despawn compaction), it travelled MotionThreshold * h, or its neighbor count
+//    changed by NeighborThreshold. Moved particles mark their grid cell (cell size h) and the cell
+//    they were recomputed in. A particle is recomputed when it moved, any cell of its 3x3x3 block
+//    is marked, or its ellipsoid is MaxStaleFrames passes old; otherwise the old ellipsoid is kept.
+//
+// On the GPU the history record is reordered with the particles by the Z-Order sort, so PrevIndex
+// is the particle's slot in the previous output. The CPU reference keeps particle order fixed.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GPU/GPUFluidParticle.h"
+
+struct FFluidAnisotropyParams;
+
+/**
+ * Density-based anisotropy settings (mirrors the shader parameters)
+ */
+struct FKawaiiFluidAnisotropySettings
+{
+	/** Neighbor search and kernel radius (cm) */
+	float SmoothingRadius = 20.0f;
+
+	/** AnisotropyScale in the shader (0 = sphere, 1 = covariance ratios) */
+	float Strength = 1.0f;
+
+	float MinStretch = 0.2f;
+	float MaxStretch = 2.0f;
+	bool bPreserveVolume = true;
+	float NonPreservedRenderScale = 1.0f;
+
+	static FKawaiiFluidAnisotropySettings FromParams(const FFluidAnisotropyParams& Params, float SmoothingRadius);
+};
+
+/**
+ * Incremental update thresholds (mirrors FFluidAnisotropyParams::Incremental*)
+ */
+struct FKawaiiFluidAnisotropySchedule
+{
+	/** Travel distance that forces a recompute, fraction of the smoothing radius */
+	float MotionThreshold = 0.1f;
+
+	/** Neighbor count change that forces a recompute */
+	int32 NeighborThreshold = 2;
+
+	/** Passes an ellipsoid may be reused before it is recomputed anyway */
+	int32 MaxStaleFrames = 30;
+
+	static FKawaiiFluidAnisotropySchedule FromParams(const FFluidAnisotropyParams& Params);
+};
+
+/** Upper triangle of a symmetric 3x3 matrix */
+struct FKawaiiFluidCovariance
+{
+	float XX = 0.0f, XY = 0.0f, XZ = 0.0f;
+	float YY = 0.0f, YZ = 0.0f;
+	float ZZ = 0.0f;
+};
+
+/** Ellipsoid in the GPU output layout (direction.xyz + scale.w per axis) */
+struct FKawaiiFluidEllipsoid
+{
+	FVector4f Axes[3] = {
+		FVector4f(1.0f, 0.0f, 0.0f, 1.0f),
+		FVector4f(0.0f, 1.0f, 0.0f, 1.0f),
+		FVector4f(0.0f, 0.0f, 1.0f, 1.0f)
+	};
+};
+
+/** Work done by one incremental pass */
+struct FKawaiiFluidAnisotropyPassStats
+{
+	int32 NumParticles = 0;
+
+	/** Particles that moved or had no history */
+	int32 NumMoved = 0;
+
+	/** Particles whose ellipsoid was recomputed (moved, near a moved particle, or expired) */
+	int32 NumRecomputed = 0;
+};
+
+/**
+ * Density-based anisotropy math and incremental scheduling (CPU reference of FluidAnisotropyCompute.usf)
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidAnisotropyScheduler
+{
+public:
+	/** Neighbors kept for the covariance (MAX_CACHED_NEIGHBORS) */
+	static constexpr int32 MaxCachedNeighbors = 32;
+
+	/** Below this many neighbors the particle stays a sphere (MIN_NEIGHBORS_FOR_ANISOTROPY) */
+	static constexpr int32 MinNeighbors = 4;
+
+	/** Full anisotropy from this many neighbors on (FULL_NEIGHBORS_FOR_ANISOTROPY) */
+	static constexpr int32 FullNeighbors = 6;
+
+	/** Largest allowed sigma0 / sigma ratio (K_R) */
+	static constexpr float MaxSigmaRatio = 4.0f;
+
+	/** Cubic spline weight used by the covariance */
+	static float KernelWeight(float Distance, float H);
+
+	/**
+	 * Analytic eigen decomposition of a symmetric 3x3 matrix
+	 * @param OutValues Eigenvalues, descending
+	 * @param OutVectors Orthonormal eigenvectors matching OutValues
+	 */
+	static void SymmetricEigen(const FKawaiiFluidCovariance& M, FVector3f& OutValues, FVector3f OutVectors[3]);
+
+	/**
+	 * Weighted covariance of the neighbors around their kernel-weighted center
+	 * @param Candidates Positions around Center (may include Center itself; farther than H is ignored)
+	 * @return Neighbor count (the covariance is only valid from MinNeighbors on)
+	 */
+	static int32 ComputeCovariance(const FVector3f& Center, TConstArrayView<FVector3f> Candidates, float H, FKawaiiFluidCovariance& OutCovariance);
+
+	/** Density-based ellipsoid of one particle */
+	static FKawaiiFluidEllipsoid ComputeDensityBased(const FVector3f& Center, TConstArrayView<FVector3f> Candidates, const FKawaiiFluidAnisotropySettings& Settings);
+
+	/** Ellipsoid from a covariance (eigen decomposition and scale clamping; sphere below MinNeighbors) */
+	static FKawaiiFluidEllipsoid ComputeEllipsoid(const FKawaiiFluidCovariance& Covariance, int32 NeighborCount, const FKawaiiFluidAnisotropySettings& Settings);
+
+	/** Density-based ellipsoids of all particles (full pass) */
+	static void ComputeAll(
+		TConstArrayView<FVector3f> Positions,
+		const FKawaiiFluidAnisotropySettings& Settings,
+		TArray<FKawaiiFluidEllipsoid>& OutEllipsoids,
+		TArray<uint32>* OutNeighborCounts = nullptr);
+
+	/** Record belongs to this particle and points into the previous output */
+	static bool HasHistory(const FGPUAnisotropyHistory& History, int32 ParticleID, int32 PrevCount);
+
+	/** Neighborhood-changing motion since the last recompute (no history counts as moved) */
+	static bool HasMoved(
+		const FGPUAnisotropyHistory& History,
+		bool bHasHistory,
+		const FVector3f& Position,
+		uint32 NeighborCount,
+		const FKawaiiFluidAnisotropySchedule& Schedule,
+		float SmoothingRadius);
+
+	/** Ellipsoid reached MaxStaleFrames */
+	static bool IsExpired(const FGPUAnisotropyHistory& History, const FKawaiiFluidAnisotropySchedule& Schedule);
+
+	/**
+	 * One incremental anisotropy pass
+	 * @param NeighborCounts Solver neighbor counts (SoA_NeighborCounts on the GPU)
+	 * @param InOutHistory Per-particle history, grown with empty records for new particles
+	 * @param InOutEllipsoids Last pass's ellipsoids in, this pass's out
+	 */
+	static FKawaiiFluidAnisotropyPassStats UpdateIncremental(
+		TConstArrayView<FVector3f> Positions,
+		TConstArrayView<int32> ParticleIDs,
+		TConstArrayView<uint32> NeighborCounts,
+		const FKawaiiFluidAnisotropySettings& Settings,
+		const FKawaiiFluidAnisotropySchedule& Schedule,
+		TArray<FGPUAnisotropyHistory>& InOutHistory,
+		TArray<FKawaiiFluidEllipsoid>& InOutEllipsoids);
+};
@@ -0,0 +1,93 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+//
+// Brush Sampler
+// =============
+// Spawn positions for the fluid brush. Instead of dropping N random particles per stroke
+// (which stacks them inside fluid that is already there), the sampler fills only the empty
+// part of the stroke region with a blue-noise Poisson-disk set at the preset ParticleSpacing:
+//
+// - Existing particles (and earlier samples of the same drag) are inserted into a spatial
+//   hash; a candidate is accepted only if nothing lies closer than Spacing.
+// - The region is the swept sphere between the previous and current brush position cut by
+//   the surface plane, so consecutive strokes coalesce into one path instead of overlapping
+//   blobs.
+// - Bridson's algorithm driven by an FRandomStream: the same seed and occupied set always
+//   produce the same samples.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/SpatialHash.h"
+
+/**
+ * Stroke region: capsule from Start to End, above the surface plane
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidBrushSampleRegion
+{
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+	float Radius = 50.0f;
+	FVector SurfaceNormal = FVector::UpVector;
+
+	/** Minimum height above the surface plane (keeps samples out of the ground) */
+	float MinHeight = 0.0f;
+
+	FKawaiiFluidBrushSampleRegion() = default;
+
+	FKawaiiFluidBrushSampleRegion(const FVector& InStart, const FVector& InEnd, float InRadius, const FVector& InSurfaceNormal)
+		: Start(InStart)
+		, End(InEnd)
+		, Radius(InRadius)
+		, SurfaceNormal(InSurfaceNormal.GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector))
+	{
+	}
+
+	bool Contains(const FVector& Position) const;
+
+	FBox GetBounds() const;
+};
+
+/**
+ * Poisson-disk brush sampler against an occupied set
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidBrushSampler
+{
+public:
+	explicit FKawaiiFluidBrushSampler(float InSpacing);
+
+	/** Mark positions as taken (existing particles) */
+	void AddOccupied(const FVector& Position);
+	void AddOccupied(TConstArrayView<FVector> Positions);
+	void AddOccupied(TConstArrayView<FVector3f> Positions);
+
+	void Reset();
+
+	/** True if no occupied position lies closer than Spacing */
+	bool IsFree(const FVector& Position) const;
+
+	int32 NumOccupied() const { return Occupied.Num(); }
+
+	float GetSpacing() const { return Spacing; }
+
+	/**
+	 * Fill the empty part of Region
+	 * Accepted samples are added to the occupied set, so repeated calls never overlap.
+	 * @return Number of samples appended to OutPositions (at most MaxSamples)
+	 */
+	int32 Sample(const FKawaiiFluidBrushSampleRegion& Region, int32 MaxSamples, int32 Seed, TArray<FVector>& OutPositions);
+
+private:
+	/** Candidates tried around each active sample (Bridson's k) */
+	static constexpr int32 CandidatesPerSample = 30;
+
+	/** Consecutive failed darts before the region is considered full */
+	static constexpr int32 MaxDartFailures = 64;
+
+	float Spacing;
+
+	FSpatialHash Hash;
+
+	TArray<FVector> Occupied;
+
+	mutable TArray<int32> NeighborScratch;
+};
@@ -0,0 +1,134 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+//
+// Brush Stroke Deltas
+// ===================
+// A brush stroke only touches a handful of particles, so its undo record stores just those:
+// the block it spawned and the block it removed, keyed by ParticleID. Undo/redo replay the
+// record as one batched spawn and one batched despawn on the target instead of restoring a
+// snapshot of every particle in the volume.
+//
+// - FKawaiiFluidParticleBlock: compact SoA record (ID, position, velocity; 28 bytes/particle)
+// - IKawaiiFluidParticleEditTarget: batched spawn/despawn by ParticleID (implemented by
+//   UKawaiiFluidSimulationModule for both the GPU simulator and CPU mode)
+// - FKawaiiFluidBrushStrokeDelta: records one stroke and replays it forward or backward
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Compact particle record
+ * Parallel arrays; every particle of a block shares Mass.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidParticleBlock
+{
+	TArray<int32> ParticleIDs;
+	TArray<FVector3f> Positions;
+	TArray<FVector3f> Velocities;
+	float Mass = 1.0f;
+
+	int32 Num() const { return ParticleIDs.Num(); }
+	bool IsEmpty() const { return ParticleIDs.Num() == 0; }
+
+	void Add(int32 ParticleID, const FVector3f& Position, const FVector3f& Velocity)
+	{
+		ParticleIDs.Add(ParticleID);
+		Positions.Add(Position);
+		Velocities.Add(Velocity);
+	}
+
+	void Reset()
+	{
+		ParticleIDs.Reset();
+		Positions.Reset();
+		Velocities.Reset();
+	}
+
+	/** Largest ParticleID in the block, or INDEX_NONE */
+	int32 GetMaxParticleID() const;
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return ParticleIDs.GetAllocatedSize() + Positions.GetAllocatedSize() + Velocities.GetAllocatedSize();
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FKawaiiFluidParticleBlock& Block)
+	{
+		Ar << Block.ParticleIDs << Block.Positions << Block.Velocities << Block.Mass;
+		return Ar;
+	}
+};
+
+/**
+ * Batched particle edits addressed by ParticleID
+ */
+class IKawaiiFluidParticleEditTarget
+{
+public:
+	virtual ~IKawaiiFluidParticleEditTarget() = default;
+
+	/**
+	 * Reserve Count consecutive ParticleIDs
+	 * @return First ID of [First, First + Count), or INDEX_NONE if the target cannot spawn
+	 */
+	virtual int32 AllocateParticleIDs(int32 Count) = 0;
+
+	/** Spawn a block with its recorded ParticleIDs */
+	virtual void SpawnParticleBlock(const FKawaiiFluidParticleBlock& Block) = 0;
+
+	/** Despawn particles by ParticleID (unknown IDs are ignored) */
+	virtual void DespawnParticlesByID(TConstArrayView<int32> ParticleIDs) = 0;
+
+	/**
+	 * Collect the particles inside a sphere
+	 * @return false if no particle data is available (nothing can be recorded)
+	 */
+	virtual bool CollectParticlesInSphere(const FVector& Center, float Radius, FKawaiiFluidParticleBlock& OutBlock) const = 0;
+};
+
+/**
+ * One brush stroke: particles it added and particles it removed
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidBrushStrokeDelta
+{
+public:
+	/**
+	 * Spawn particles with freshly allocated IDs and record them
+	 * @return false if the target could not allocate IDs (nothing spawned)
+	 */
+	bool ApplyAdd(IKawaiiFluidParticleEditTarget& Target, TConstArrayView<FVector> Positions, const FVector& Velocity, float Mass);
+
+	/**
+	 * Despawn the particles inside a sphere by ID and record them
+	 * @return false if the target has no particle data (nothing removed)
+	 */
+	bool ApplyRemove(IKawaiiFluidParticleEditTarget& Target, const FVector& Center, float Radius);
+
+	/** Replay backward: despawn the added block, respawn the removed block */
+	void Undo(IKawaiiFluidParticleEditTarget& Target) const;
+
+	/** Replay forward: respawn the added block, despawn the removed block */
+	void Redo(IKawaiiFluidParticleEditTarget& Target) const;
+
+	const FKawaiiFluidParticleBlock& GetAdded() const { return Added; }
+	const FKawaiiFluidParticleBlock& GetRemoved() const { return Removed; }
+
+	bool IsEmpty() const { return Added.IsEmpty() && Removed.IsEmpty(); }
+
+	SIZE_T GetAllocatedSize() const { return Added.GetAllocatedSize() + Removed.GetAllocatedSize(); }
+
+	FString ToString() const;
+
+	friend FArchive& operator<<(FArchive& Ar, FKawaiiFluidBrushStrokeDelta& Delta)
+	{
+		Ar << Delta.Added << Delta.Removed;
+		return Ar;
+	}
+
+private:
+	/** Move Block into an empty record (no slack), else append */
+	static void AppendBlock(FKawaiiFluidParticleBlock& Record, FKawaiiFluidParticleBlock&& Block);
+
+	FKawaiiFluidParticleBlock Added;
+	FKawaiiFluidParticleBlock Removed;
+};
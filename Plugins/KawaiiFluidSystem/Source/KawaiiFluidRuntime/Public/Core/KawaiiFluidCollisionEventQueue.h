@@ -0,0 +1,97 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+//
+// Collision Event Queue
+// =====================
+// Per-module filter and buffer between raw collision feedback (GPU readback + CPU buffer) and
+// collision event listeners. A waterfall hitting a collider produces thousands of contacts per
+// frame; only a handful become events, so the per-contact path must be cheap:
+//
+// - Filtering (SourceID, hit speed, per-particle cooldown) is O(1) per contact.
+// - Cooldown is a fixed-size ParticleID-indexed ring (TKawaiiFluidParticleHistory), so it is
+//   stable across Z-Order reordering and does not grow with the number of particles ever hit.
+// - Accepted events go into a preallocated buffer capped at MaxEventsPerFrame; contacts after
+//   the buffer is full are rejected before any event is built.
+// - Listeners receive the frame's events as one batch.
+//
+// No heap allocation after Configure() unless the capacity grows.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/KawaiiFluidSimulationTypes.h"
+#include "Core/KawaiiFluidParticleIdentity.h"
+
+/**
+ * Per-frame counters of the event queue
+ * @param NumContacts Contacts offered this frame
+ * @param NumAccepted Contacts that became events
+ * @param NumFiltered Rejected by SourceID or hit speed
+ * @param NumCooldown Rejected by per-particle cooldown
+ * @param NumDropped Rejected because the frame's event buffer was full
+ */
+struct FKawaiiFluidCollisionEventStats
+{
+	int32 NumContacts = 0;
+	int32 NumAccepted = 0;
+	int32 NumFiltered = 0;
+	int32 NumCooldown = 0;
+	int32 NumDropped = 0;
+};
+
+/**
+ * Fixed-capacity collision event buffer with ID-keyed cooldown
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidCollisionEventQueue
+{
+public:
+	/** Event buffer size used when MaxEventsPerFrame is 0 (unlimited) */
+	static constexpr int32 MaxCapacity = 1024;
+
+	FKawaiiFluidCollisionEventQueue();
+
+	/**
+	 * Apply event settings (allocates only when the capacity grows)
+	 * @param MaxEventsPerFrame Event buffer capacity (0 = MaxCapacity)
+	 * @param InCooldown Minimum seconds between events of the same particle
+	 * @param InMinVelocity Minimum hit speed (cm/s)
+	 * @param InSourceID Only accept contacts of this source (-1 = any)
+	 */
+	void Configure(int32 MaxEventsPerFrame, float InCooldown, float InMinVelocity, int32 InSourceID);
+
+	/** Start a frame: clear the event buffer and counters (cooldowns are kept) */
+	void BeginFrame(float InCurrentTime);
+
+	/**
+	 * Offer one contact
+	 * @return Event slot to fill (ParticleID, SourceID and HitSpeed already set), or nullptr if rejected
+	 */
+	FKawaiiFluidCollisionEvent* TryAdd(int32 ParticleID, int32 SourceID, float HitSpeed);
+
+	/** Event buffer is full; further contacts this frame are dropped */
+	bool IsFull() const { return NumEvents >= Capacity; }
+
+	/** Events accepted since BeginFrame */
+	TConstArrayView<FKawaiiFluidCollisionEvent> GetEvents() const { return TConstArrayView<FKawaiiFluidCollisionEvent>(Events.GetData(), NumEvents); }
+
+	const FKawaiiFluidCollisionEventStats& GetStats() const { return Stats; }
+
+	/** Cooldown state (last event time per ParticleID) */
+	TKawaiiFluidParticleHistory<float>& GetCooldownHistory() { return LastEventTime; }
+
+	/** Forget all cooldowns and events */
+	void Reset();
+
+private:
+	TArray<FKawaiiFluidCollisionEvent> Events;
+	int32 NumEvents = 0;
+	int32 Capacity = 0;
+
+	TKawaiiFluidParticleHistory<float> LastEventTime;
+
+	float Cooldown = 0.1f;
+	float MinVelocity = 0.0f;
+	int32 FilterSourceID = -1;
+	float CurrentTime = 0.0f;
+
+	FKawaiiFluidCollisionEventStats Stats;
+};
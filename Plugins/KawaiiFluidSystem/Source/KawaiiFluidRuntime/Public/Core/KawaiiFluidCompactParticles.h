@@ -0,0 +1,147 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+//
+// Compact Particle Storage
+// ========================
+// Optional compressed SoA copy of FFluidParticle read by the CPU reference solver's neighbor loops.
+// The context packs it once per substep after FinalizePositions; viscosity and surface
+// classification then both read it instead of building their own float snapshots.
+//
+// - Position:  float per axis, relative to the origin of the particle's tile. Tiles are
+//              TileCells (64) grid cells per axis, matching the GPU Hybrid Tiled Z-Order tiles
+//              (HYBRID_TILE_SIZE), so precision does not depend on the distance to the world origin.
+// - Velocity:  half per axis (relative error <= 2^-11, components clamped to +-65504 cm/s).
+// - Flags:     one byte (EKawaiiFluidCompactFlags).
+// - Tile:      uint16 index into the tile table.
+//
+// 21 bytes per particle. Half conversion runs 8 lanes at a time (FPlatformMath::WideVector*Half,
+// F16C where available).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/FluidParticle.h"
+
+/** Boolean particle state packed into one byte */
+namespace EKawaiiFluidCompactFlags
+{
+	enum Type : uint8
+	{
+		None          = 0,
+		Attached      = 1 << 0,
+		NearBoundary  = 1 << 1,
+		Surface       = 1 << 2,
+	};
+}
+
+/**
+ * Tile-relative float / half-velocity SoA copy of a particle array
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidCompactParticles
+{
+public:
+	/** Grid cells per tile axis (HYBRID_TILE_SIZE in FluidMortonUtils.ush) */
+	static constexpr int32 TileCells = 64;
+
+	/** Tile indices are 16 bits */
+	static constexpr int32 MaxTiles = MAX_uint16;
+
+	/** Largest finite half; faster velocity components are clamped */
+	static constexpr float MaxSpeedComponent = 65504.0f;
+
+	/** Conversion block size (lanes of WideVectorLoadHalf / WideVectorStoreHalf) */
+	static constexpr int32 BlockSize = 8;
+
+	/** Bytes per particle of the compact layout */
+	static constexpr int32 BytesPerParticle = 3 * sizeof(float) + 3 * sizeof(uint16) + sizeof(uint8) + sizeof(uint16);
+
+	/**
+	 * Pack positions, velocities and flags (buffers are reused between calls)
+	 * @param Particles Source particles
+	 * @param CellSize Grid cell size (cm), normally the smoothing radius
+	 * @return false if the particles span more than MaxTiles tiles (the layout is left empty)
+	 */
+	bool Load(TConstArrayView<FFluidParticle> Particles, float CellSize);
+
+	/** Drop the packed data (IsValidFor fails until the next Load) */
+	void Invalidate() { NumParticles = 0; }
+
+	/** True if the last Load packed exactly this many particles */
+	bool IsValidFor(int32 Count) const { return Count > 0 && NumParticles == Count; }
+
+	int32 Num() const { return NumParticles; }
+	int32 GetNumTiles() const { return TileCoords.Num(); }
+	float GetTileSize() const { return TileSize; }
+
+	/** World position (double, tile origin + local offset) */
+	FVector GetPosition(int32 Index) const
+	{
+		return FVector(TileCoords[TileIndex[Index]]) * TileSize + FVector(LocalX[Index], LocalY[Index], LocalZ[Index]);
+	}
+
+	/** P_A - P_B in float; same-tile pairs never touch the tile table */
+	FORCEINLINE FVector3f GetOffset(int32 A, int32 B) const
+	{
+		FVector3f Offset(LocalX[A] - LocalX[B], LocalY[A] - LocalY[B], LocalZ[A] - LocalZ[B]);
+		const uint16 TileA = TileIndex[A];
+		const uint16 TileB = TileIndex[B];
+		if (TileA != TileB)
+		{
+			Offset += FVector3f(TileCoords[TileA] - TileCoords[TileB]) * TileSize;
+		}
+		return Offset;
+	}
+
+	/** Velocity of one particle (scalar conversion; neighbor loops convert 8 lanes with ConvertVelocities) */
+	FORCEINLINE FVector3f GetVelocity(int32 Index) const
+	{
+		return FVector3f(
+			FPlatformMath::LoadHalf(&VelX[Index]),
+			FPlatformMath::LoadHalf(&VelY[Index]),
+			FPlatformMath::LoadHalf(&VelZ[Index]));
+	}
+
+	/**
+	 * Gather and convert the velocities of BlockSize particles
+	 * @param Indices BlockSize particle indices
+	 * @param OutX, OutY, OutZ BlockSize floats each
+	 */
+	FORCEINLINE void GatherVelocities(const int32* Indices, float* RESTRICT OutX, float* RESTRICT OutY, float* RESTRICT OutZ) const
+	{
+		alignas(16) uint16 HalfX[BlockSize];
+		alignas(16) uint16 HalfY[BlockSize];
+		alignas(16) uint16 HalfZ[BlockSize];
+		for (int32 Lane = 0; Lane < BlockSize; ++Lane)
+		{
+			const int32 Index = Indices[Lane];
+			HalfX[Lane] = VelX[Index];
+			HalfY[Lane] = VelY[Index];
+			HalfZ[Lane] = VelZ[Index];
+		}
+		FPlatformMath::WideVectorLoadHalf(OutX, HalfX);
+		FPlatformMath::WideVectorLoadHalf(OutY, HalfY);
+		FPlatformMath::WideVectorLoadHalf(OutZ, HalfZ);
+	}
+
+	uint8 GetFlags(int32 Index) const { return Flags[Index]; }
+	int32 GetTileIndex(int32 Index) const { return TileIndex[Index]; }
+	const FIntVector& GetTileCoord(int32 Tile) const { return TileCoords[Tile]; }
+
+	/** Max absolute per-axis position error of a packed position (cm) */
+	float GetPositionErrorBound() const;
+
+	/** Tile coordinate of a world position */
+	static FIntVector ComputeTileCoord(const FVector& Position, float TileSize);
+
+private:
+	int32 NumParticles = 0;
+	float TileSize = 0.0f;
+
+	// Padded to a multiple of BlockSize
+	TArray<float> LocalX, LocalY, LocalZ;
+	TArray<uint16> VelX, VelY, VelZ;
+	TArray<uint8> Flags;
+	TArray<uint16> TileIndex;
+
+	TArray<FIntVector> TileCoords;
+	TMap<FIntVector, int32> TileLookup;
+};
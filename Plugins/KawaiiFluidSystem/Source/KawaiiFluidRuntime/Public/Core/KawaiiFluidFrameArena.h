@@ -0,0 +1,277 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+//
+// Frame Arena
+// ===========
+// Linear (bump) allocator for per-frame simulation temporaries: job lists, cell query lists,
+// candidate index lists. These are built and dropped every frame; with the default heap
+// allocator every Add/Reserve goes through the global allocator and its lock.
+//
+// - FKawaiiFluidFrameArena: chunked bump allocator. Free is a no-op; Reset() releases
+//   everything at once. After a frame that overflowed into several chunks, Reset() coalesces
+//   them into one chunk sized to the high-water mark, so a steady-state frame allocates
+//   nothing from the heap.
+// - TKawaiiFluidArenaAllocator / TKawaiiFluidFrameArray: container allocator bound to the arena
+//   active on the calling thread (FKawaiiFluidFrameArenaScope). Falls back to the heap when no
+//   arena is active (worker threads, editor calls outside the simulation tick).
+// - FKawaiiFluidDoubleBufferedArena: two arenas flipped per frame. Memory allocated in frame N
+//   stays valid until the start of frame N + 2, long enough for render commands enqueued in
+//   frame N to consume it.
+//
+// Not thread-safe: an arena (and every container bound to it) belongs to the thread that
+// activated it. Containers must not outlive the arena's next Reset().
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Frame arena statistics
+ * @param BytesUsed Bytes handed out since the last Reset (including alignment padding)
+ * @param HighWaterMark Largest BytesUsed of any frame so far (use for sizing)
+ * @param Capacity Total bytes of all chunks
+ * @param NumChunks Chunks currently owned
+ * @param NumAllocations Allocations since the last Reset
+ * @param NumChunkAllocations Heap allocations of chunks since creation
+ * @param NumResets Resets since creation
+ */
+struct FKawaiiFluidFrameArenaStats
+{
+	SIZE_T BytesUsed = 0;
+	SIZE_T HighWaterMark = 0;
+	SIZE_T Capacity = 0;
+	int32 NumChunks = 0;
+	int32 NumAllocations = 0;
+	int32 NumChunkAllocations = 0;
+	int32 NumResets = 0;
+};
+
+/**
+ * Chunked linear allocator, reset once per frame
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidFrameArena : public FNoncopyable
+{
+public:
+	/** Default size of the first chunk and minimum size of overflow chunks */
+	static constexpr SIZE_T DefaultChunkSize = 64 * 1024;
+
+	explicit FKawaiiFluidFrameArena(SIZE_T InChunkSize = DefaultChunkSize);
+	~FKawaiiFluidFrameArena();
+
+	/** Allocate Size bytes (never fails; overflows into a new chunk) */
+	void* Allocate(SIZE_T Size, uint32 Alignment);
+
+	/**
+	 * Resize an allocation of this arena. The most recent allocation grows or shrinks in
+	 * place when it fits its chunk; otherwise a new block is allocated and the old contents copied.
+	 * @return New block (nullptr if NewSize is 0)
+	 */
+	void* Reallocate(void* Ptr, SIZE_T OldSize, SIZE_T NewSize, uint32 Alignment);
+
+	/** Release all allocations (chunks are kept, coalesced to the high-water mark) */
+	void Reset();
+
+	/** Release all allocations and chunks */
+	void Empty();
+
+	/** Pointer lies in one of this arena's chunks */
+	bool Owns(const void* Ptr) const;
+
+	/** Incremented by every Reset; containers use it to detect use after reset */
+	uint32 GetGeneration() const { return Generation; }
+
+	const FKawaiiFluidFrameArenaStats& GetStats() const { return Stats; }
+
+	/** Arena active on the calling thread (nullptr = containers use the heap) */
+	static FKawaiiFluidFrameArena* GetActive();
+
+private:
+	friend class FKawaiiFluidFrameArenaScope;
+
+	struct FChunk
+	{
+		uint8* Data = nullptr;
+		SIZE_T Size = 0;
+	};
+
+	/** Allocate and append a chunk of at least MinSize bytes */
+	void AddChunk(SIZE_T MinSize);
+
+	void FreeChunks();
+
+	TArray<FChunk> Chunks;
+	int32 CurrentChunk = 0;
+	SIZE_T Offset = 0;
+
+	/** Most recent allocation (can be resized in place) */
+	uint8* LastAllocation = nullptr;
+
+	SIZE_T ChunkSize;
+	uint32 Generation = 0;
+	FKawaiiFluidFrameArenaStats Stats;
+};
+
+/**
+ * Makes an arena the calling thread's active arena for the lifetime of the scope (nestable)
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidFrameArenaScope : public FNoncopyable
+{
+public:
+	explicit FKawaiiFluidFrameArenaScope(FKawaiiFluidFrameArena& Arena);
+	~FKawaiiFluidFrameArenaScope();
+
+private:
+	FKawaiiFluidFrameArena* Previous;
+};
+
+/**
+ * Two arenas flipped once per frame, for temporaries read one frame later (render thread)
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidDoubleBufferedArena : public FNoncopyable
+{
+public:
+	explicit FKawaiiFluidDoubleBufferedArena(SIZE_T InChunkSize = FKawaiiFluidFrameArena::DefaultChunkSize);
+
+	/** Flip: the arena of two frames ago is reset and becomes current */
+	void BeginFrame();
+
+	/** Arena for allocations of this frame */
+	FKawaiiFluidFrameArena& GetCurrent() { return Arenas[CurrentIndex]; }
+
+	/** Arena of the previous frame (still valid) */
+	FKawaiiFluidFrameArena& GetPrevious() { return Arenas[CurrentIndex ^ 1]; }
+
+	/** Largest high-water mark of both arenas */
+	SIZE_T GetHighWaterMark() const;
+
+	void Empty();
+
+private:
+	FKawaiiFluidFrameArena Arenas[2];
+	int32 CurrentIndex = 0;
+};
+
+/**
+ * Container allocator backed by the calling thread's active frame arena (heap when none is active)
+ * The arena is captured at the first allocation; growth must happen on the same thread.
+ */
+template<uint32 Alignment = 16>
+class TKawaiiFluidArenaAllocator
+{
+public:
+	using SizeType = int32;
+
+	enum { NeedsElementType = false };
+	enum { RequireRangeCheck = true };
+
+	class ForAnyElementType
+	{
+	public:
+		ForAnyElementType() = default;
+
+		~ForAnyElementType()
+		{
+			if (Data && !Arena)
+			{
+				FMemory::Free(Data);
+			}
+		}
+
+		FORCEINLINE void MoveToEmpty(ForAnyElementType& Other)
+		{
+			checkSlow(this != &Other);
+			if (Data && !Arena)
+			{
+				FMemory::Free(Data);
+			}
+			Data = Other.Data;
+			Arena = Other.Arena;
+			Generation = Other.Generation;
+			Other.Data = nullptr;
+			Other.Arena = nullptr;
+		}
+
+		FORCEINLINE FScriptContainerElement* GetAllocation() const { return Data; }
+
+		void ResizeAllocation(SizeType PreviousNumElements, SizeType NumElements, SIZE_T NumBytesPerElement)
+		{
+			if (!Data)
+			{
+				Arena = FKawaiiFluidFrameArena::GetActive();
+				Generation = Arena ? Arena->GetGeneration() : 0;
+			}
+
+			if (!Arena)
+			{
+				if (Data || NumElements)
+				{
+					Data = static_cast<FScriptContainerElement*>(FMemory::Realloc(Data, NumElements * NumBytesPerElement, Alignment));
+				}
+				return;
+			}
+
+			checkf(Arena->GetGeneration() == Generation, TEXT("Frame arena container used after its arena was reset"));
+			Data = static_cast<FScriptContainerElement*>(Arena->Reallocate(
+				Data, PreviousNumElements * NumBytesPerElement, NumElements * NumBytesPerElement, Alignment));
+			if (!Data)
+			{
+				Arena = nullptr;
+			}
+		}
+
+		FORCEINLINE SizeType CalculateSlackReserve(SizeType NumElements, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackReserve(NumElements, NumBytesPerElement, false, Alignment);
+		}
+
+		FORCEINLINE SizeType CalculateSlackShrink(SizeType NumElements, SizeType NumAllocatedElements, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackShrink(NumElements, NumAllocatedElements, NumBytesPerElement, false, Alignment);
+		}
+
+		FORCEINLINE SizeType CalculateSlackGrow(SizeType NumElements, SizeType NumAllocatedElements, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackGrow(NumElements, NumAllocatedElements, NumBytesPerElement, false, Alignment);
+		}
+
+		SIZE_T GetAllocatedSize(SizeType NumAllocatedElements, SIZE_T NumBytesPerElement) const
+		{
+			return NumAllocatedElements * NumBytesPerElement;
+		}
+
+		bool HasAllocation() const { return Data != nullptr; }
+
+		SizeType GetInitialCapacity() const { return 0; }
+
+		/** Arena backing this container (nullptr = heap) */
+		FKawaiiFluidFrameArena* GetArena() const { return Arena; }
+
+	private:
+		ForAnyElementType(const ForAnyElementType&) = delete;
+		ForAnyElementType& operator=(const ForAnyElementType&) = delete;
+
+		FScriptContainerElement* Data = nullptr;
+		FKawaiiFluidFrameArena* Arena = nullptr;
+		uint32 Generation = 0;
+	};
+
+	template<typename ElementType>
+	class ForElementType : public ForAnyElementType
+	{
+	public:
+		FORCEINLINE ElementType* GetAllocation() const
+		{
+			return reinterpret_cast<ElementType*>(ForAnyElementType::GetAllocation());
+		}
+	};
+};
+
+template<uint32 Alignment>
+struct TAllocatorTraits<TKawaiiFluidArenaAllocator<Alignment>> : TAllocatorTraitsBase<TKawaiiFluidArenaAllocator<Alignment>>
+{
+	enum { SupportsMove = true };
+	enum { IsZeroConstruct = true };
+};
+
+/** Per-frame array (arena-backed on the simulating thread, heap elsewhere) */
+template<typename ElementType>
+using TKawaiiFluidFrameArray = TArray<ElementType, TKawaiiFluidArenaAllocator<>>;
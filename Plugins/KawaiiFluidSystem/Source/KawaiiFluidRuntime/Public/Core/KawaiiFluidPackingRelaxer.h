@@ -0,0 +1,135 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+//
+// Offline Packing Relaxation
+// ==========================
+// Fill shapes spawned from a hexagonal lattice start away from rest density: the lattice
+// number density only approximates ρ₀ for the discrete Poly6 sum, and the shape boundary cuts
+// the lattice unevenly. The simulation then spends its first seconds relaxing.
+//
+// The relaxer produces the settled packing once, offline, on the CPU:
+// 1. Calibrate a cubic lattice spacing whose bulk Poly6 density is exactly ρ₀
+// 2. Seed the shape with that lattice (seeded jitter) and surround it with a band of frozen
+//    ghost particles one smoothing radius thick, so every fluid particle has full kernel support
+// 3. Jacobi PBF iterations on the bilateral constraint C = ρ/ρ₀ - 1 (ghosts contribute density
+//    and mirror the fluid λ), projecting particles back into the shape after every step
+//
+// The result is stored in UKawaiiFluidPackingAsset and instantiated by transform at spawn time.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/SpatialHash.h"
+#include "Components/KawaiiFluidEmitterComponent.h"
+
+class UKawaiiFluidPresetDataAsset;
+
+/**
+ * Local-space spawn shape (centered at the origin)
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidPackingShape
+{
+	EKawaiiFluidEmitterShapeType Type = EKawaiiFluidEmitterShapeType::Sphere;
+	float SphereRadius = 50.0f;
+	FVector BoxHalfSize = FVector(50.0);
+	float CylinderRadius = 30.0f;
+	float CylinderHalfHeight = 50.0f;
+
+	static FKawaiiFluidPackingShape MakeSphere(float Radius);
+	static FKawaiiFluidPackingShape MakeBox(const FVector& HalfSize);
+	static FKawaiiFluidPackingShape MakeCylinder(float Radius, float HalfHeight);
+
+	/** Signed distance to the surface (negative inside) */
+	float SignedDistance(const FVector& Position) const;
+
+	/** Closest point inside the shape (identity for inside points) */
+	FVector ProjectInside(const FVector& Position) const;
+
+	FBox GetBounds() const;
+};
+
+/**
+ * Relaxation parameters (SPH quantities of the preset the packing is baked for)
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidPackingParams
+{
+	float SmoothingRadius = 20.0f;   // cm
+	float RestDensity = 1200.0f;     // kg/m³
+	float ParticleMass = 1.2f;       // kg
+	int32 Iterations = 100;
+
+	/** Seed lattice jitter as a fraction of the lattice spacing */
+	float Jitter = 0.25f;
+
+	int32 Seed = 0;
+
+	static FKawaiiFluidPackingParams FromPreset(const UKawaiiFluidPresetDataAsset& Preset);
+};
+
+/**
+ * Density deviation |ρ/ρ₀ - 1| before and after relaxation
+ */
+struct FKawaiiFluidPackingStats
+{
+	int32 NumParticles = 0;
+	int32 NumGhosts = 0;
+	float LatticeSpacing = 0.0f;
+	float InitialRMSDeviation = 0.0f;
+	float InitialMaxDeviation = 0.0f;
+	float RMSDeviation = 0.0f;
+	float MaxDeviation = 0.0f;
+};
+
+/**
+ * CPU relaxation of a fill shape to rest density
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidPackingRelaxer
+{
+public:
+	FKawaiiFluidPackingRelaxer(const FKawaiiFluidPackingShape& InShape, const FKawaiiFluidPackingParams& InParams);
+
+	/** Poly6 density of a particle in an infinite cubic lattice */
+	static float ComputeLatticeDensity(float Spacing, float SmoothingRadius, float ParticleMass);
+
+	/** Cubic lattice spacing whose bulk density equals RestDensity (bisection) */
+	static float CalibrateLatticeSpacing(float SmoothingRadius, float RestDensity, float ParticleMass);
+
+	/** Seed lattice and ghost band */
+	void Initialize();
+
+	/** One Jacobi PBF iteration */
+	void Step();
+
+	/** Initialize, run Params.Iterations steps, report deviation before and after */
+	FKawaiiFluidPackingStats Relax();
+
+	/** RMS and max |ρ/ρ₀ - 1| over the fluid particles (ghost-supported) */
+	void MeasureDensityDeviation(float& OutRMS, float& OutMax);
+
+	const TArray<FVector>& GetPositions() const { return Positions; }
+	const TArray<FVector>& GetGhostPositions() const { return Ghosts; }
+	float GetLatticeSpacing() const { return LatticeSpacing; }
+
+private:
+	FKawaiiFluidPackingShape Shape;
+	FKawaiiFluidPackingParams Params;
+	float LatticeSpacing = 0.0f;
+
+	/** Kernel constants in meters */
+	float H_m = 0.0f;
+	float Poly6Coeff = 0.0f;
+	float SpikyCoeff = 0.0f;
+
+	TArray<FVector> Positions;
+	TArray<FVector> Ghosts;
+
+	/** Fluid then ghost positions; neighbor indices >= Positions.Num() are ghosts */
+	TArray<FVector> AllPositions;
+	TArray<TArray<int32>> Neighbors;
+	TArray<float> Densities;
+	TArray<float> Lambdas;
+	TArray<FVector> Deltas;
+	FSpatialHash Hash;
+
+	void BuildNeighbors();
+	void ComputeDensities();
+};
@@ -0,0 +1,138 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+//
+// Stable Particle Identity
+// ========================
+// The GPU Z-Order sort (FluidReorderParticles.usf) permutes buffer slots every substep, so an
+// array index only identifies a particle within one readback. Per-particle CPU state must be
+// keyed by ParticleID instead:
+//
+// - FKawaiiFluidParticleIDMap: ParticleID -> slot lookup (inverse of the slot -> ID permutation
+//   carried by every readback). Rebuilt in O(N) per readback, no allocation once warmed up.
+// - TKawaiiFluidParticleHistory: fixed-size ring indexed by ParticleID for per-particle history
+//   (event cooldowns, previous-frame state). Memory is bounded; a stale entry is evicted when a
+//   particle exactly Capacity IDs newer claims its entry.
+//
+// ParticleIDs are allocated sequentially (FGPUSpawnManager::AllocateParticleIDs), so live
+// particles occupy a sliding ID window and rarely alias in the ring.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * ParticleID -> buffer slot lookup
+ *
+ * Open addressing table (power-of-two capacity >= 2 * Num, linear probing).
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidParticleIDMap
+{
+public:
+	/**
+	 * Rebuild from a readback's slot -> ID array
+	 * @param SlotToID ParticleID of each buffer slot (negative IDs are skipped)
+	 */
+	void Rebuild(TConstArrayView<int32> SlotToID);
+
+	/** Slot holding ParticleID, or INDEX_NONE */
+	int32 FindSlot(int32 ParticleID) const;
+
+	/** Number of mapped particles */
+	int32 Num() const { return NumMapped; }
+
+	/** Clear mapping (keeps table memory) */
+	void Reset();
+
+private:
+	FORCEINLINE uint32 HashID(int32 ParticleID) const
+	{
+		// Fibonacci hashing spreads sequential IDs across the table
+		return (static_cast<uint32>(ParticleID) * 2654435769u) & TableMask;
+	}
+
+	/** ParticleID per table entry (INDEX_NONE = empty) */
+	TArray<int32> TableIDs;
+
+	/** Slot per table entry */
+	TArray<int32> TableSlots;
+
+	uint32 TableMask = 0;
+	int32 NumMapped = 0;
+};
+
+/**
+ * Fixed-size per-particle history ring indexed by ParticleID
+ *
+ * Entry = ParticleID & (Capacity - 1). Each entry stores the owning ParticleID, so a lookup for a
+ * particle whose entry was reclaimed returns nullptr instead of another particle's state.
+ */
+template <typename ValueType>
+class TKawaiiFluidParticleHistory
+{
+public:
+	static constexpr int32 DefaultCapacity = 4096;
+
+	explicit TKawaiiFluidParticleHistory(int32 InCapacity = DefaultCapacity)
+	{
+		Initialize(InCapacity);
+	}
+
+	/** Resize (rounded up to a power of two) and clear */
+	void Initialize(int32 InCapacity)
+	{
+		const uint32 Capacity = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(InCapacity, 1)));
+		Entries.SetNum(Capacity);
+		Mask = Capacity - 1;
+		Reset();
+	}
+
+	/** Stored value for ParticleID, or nullptr if none (or evicted) */
+	const ValueType* Find(int32 ParticleID) const
+	{
+		const FEntry& Entry = Entries[static_cast<uint32>(ParticleID) & Mask];
+		return (ParticleID >= 0 && Entry.ParticleID == ParticleID) ? &Entry.Value : nullptr;
+	}
+
+	/** Store value for ParticleID (evicts whatever occupied the entry) */
+	void Set(int32 ParticleID, const ValueType& Value)
+	{
+		if (ParticleID < 0)
+		{
+			return;
+		}
+
+		FEntry& Entry = Entries[static_cast<uint32>(ParticleID) & Mask];
+		Entry.ParticleID = ParticleID;
+		Entry.Value = Value;
+	}
+
+	/** Forget ParticleID (no-op if its entry belongs to another particle) */
+	void Remove(int32 ParticleID)
+	{
+		FEntry& Entry = Entries[static_cast<uint32>(ParticleID) & Mask];
+		if (ParticleID >= 0 && Entry.ParticleID == ParticleID)
+		{
+			Entry.ParticleID = INDEX_NONE;
+		}
+	}
+
+	/** Forget all particles */
+	void Reset()
+	{
+		for (FEntry& Entry : Entries)
+		{
+			Entry.ParticleID = INDEX_NONE;
+		}
+	}
+
+	int32 GetCapacity() const { return Entries.Num(); }
+
+private:
+	struct FEntry
+	{
+		int32 ParticleID = INDEX_NONE;
+		ValueType Value = ValueType();
+	};
+
+	TArray<FEntry> Entries;
+	uint32 Mask = 0;
+};
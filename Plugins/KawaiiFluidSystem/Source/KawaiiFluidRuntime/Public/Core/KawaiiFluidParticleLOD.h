@@ -0,0 +1,138 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+//
+// Far-Field Particle LOD
+// ======================
+// Merges distant, low-energy particle clusters into heavier representative particles and
+// splits representatives back into base-mass particles as a viewer approaches.
+//
+// Both rules conserve total mass, linear momentum and center of mass exactly
+// (up to floating point), so the far field keeps its bulk motion while using fewer particles.
+//
+// The rules run on the CPU over the particle readback. BuildUpdate turns one merge/split step
+// into a diff (particle ids to despawn, particles to spawn) that the simulation context applies
+// through the GPU despawn-by-ID and spawn queues (r.Fluid.ParticleLOD, off by default).
+// Plain C++ over FFluidParticle (no UObject/world dependency).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/FluidParticle.h"
+
+/**
+ * Particle LOD tuning
+ * SplitDistance < MergeDistance gives a hysteresis band where particles keep their current resolution.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidParticleLODSettings
+{
+	/** Particles farther than this from every viewer may be merged (cm) */
+	float MergeDistance = 6000.0f;
+
+	/** Representatives closer than this to any viewer are split (cm) */
+	float SplitDistance = 4000.0f;
+
+	/** Mass of one full-resolution particle */
+	float BaseMass = 1.0f;
+
+	/** Maximum number of base particles folded into one representative */
+	int32 MaxMergeCount = 8;
+
+	/** Only particles slower than this are merged (low-energy far field) (cm/s) */
+	float MaxMergeSpeed = 50.0f;
+
+	/** Clustering cell size; usually 2x particle spacing (cm) */
+	float ClusterCellSize = 20.0f;
+
+	/** Radius of the child pattern placed around a split representative (cm) */
+	float SplitRadius = 5.0f;
+};
+
+/**
+ * Result counters of a merge/split pass
+ */
+struct FKawaiiFluidParticleLODStats
+{
+	/** Particles consumed by merging (including representatives merged again) */
+	int32 NumMergedParticles = 0;
+
+	/** Representatives created by merging */
+	int32 NumRepresentativesCreated = 0;
+
+	/** Representatives split back to base particles */
+	int32 NumRepresentativesSplit = 0;
+
+	/** Particles created by splitting */
+	int32 NumSplitParticles = 0;
+};
+
+/**
+ * Far-field particle LOD rules
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidParticleLOD
+{
+public:
+	/**
+	 * Merge far, slow particles that share a cluster cell and SourceID into representatives
+	 * Representative: Mass = Σm, Position = Σm·x / Σm, Velocity = Σm·v / Σm.
+	 * Representatives keep the smallest ParticleID of their cluster. Attached particles are never merged.
+	 * @param Particles In/Out particle array (relative order of untouched particles is preserved)
+	 * @param Settings LOD tuning
+	 * @param ViewPoints Viewer locations; with none, nothing is merged
+	 * @return Pass counters
+	 */
+	static FKawaiiFluidParticleLODStats MergeFarParticles(
+		TArray<FFluidParticle>& Particles,
+		const FKawaiiFluidParticleLODSettings& Settings,
+		TConstArrayView<FVector> ViewPoints);
+
+	/**
+	 * Split representatives near any viewer into round(Mass / BaseMass) particles
+	 * Children share the representative velocity and mass evenly; their offsets sum to zero so the
+	 * center of mass is unchanged. The first child keeps the representative ParticleID.
+	 * @param Particles In/Out particle array
+	 * @param Settings LOD tuning
+	 * @param ViewPoints Viewer locations
+	 * @param InOutNextParticleID Next free ParticleID (advanced for each new child)
+	 * @return Pass counters
+	 */
+	static FKawaiiFluidParticleLODStats SplitNearParticles(
+		TArray<FFluidParticle>& Particles,
+		const FKawaiiFluidParticleLODSettings& Settings,
+		TConstArrayView<FVector> ViewPoints,
+		int32& InOutNextParticleID);
+
+	/**
+	 * One LOD step (merge, then split) on a particle snapshot, reported as a diff
+	 * Particles that were merged or split are listed in OutRemovedIDs; the representatives and
+	 * children replacing them are in OutAddedParticles. Removed and added particles carry the same
+	 * mass, momentum and center of mass. Added particles have ParticleID INDEX_NONE: the caller
+	 * assigns fresh ids, so a despawn and a spawn in the same frame never share an id.
+	 * @param Particles Snapshot (Position, Velocity, Mass, ParticleID, SourceID, bIsAttached)
+	 * @param Settings LOD tuning
+	 * @param ViewPoints Viewer locations
+	 * @param OutRemovedIDs ParticleIDs to despawn
+	 * @param OutAddedParticles Particles to spawn
+	 * @return Pass counters of both steps
+	 */
+	static FKawaiiFluidParticleLODStats BuildUpdate(
+		TConstArrayView<FFluidParticle> Particles,
+		const FKawaiiFluidParticleLODSettings& Settings,
+		TConstArrayView<FVector> ViewPoints,
+		TArray<int32>& OutRemovedIDs,
+		TArray<FFluidParticle>& OutAddedParticles);
+
+	/** Is particle a merged representative (mass noticeably above BaseMass) */
+	static bool IsRepresentative(const FFluidParticle& Particle, float BaseMass)
+	{
+		return Particle.Mass > BaseMass * 1.5f;
+	}
+
+	/** Number of base particles a representative stands for */
+	static int32 GetRepresentedCount(const FFluidParticle& Particle, float BaseMass)
+	{
+		return FMath::Max(1, FMath::RoundToInt(Particle.Mass / FMath::Max(BaseMass, KINDA_SMALL_NUMBER)));
+	}
+
+private:
+	/** Squared distance to the closest viewer (max float with no viewers) */
+	static double GetMinViewDistanceSq(const FVector& Position, TConstArrayView<FVector> ViewPoints);
+};
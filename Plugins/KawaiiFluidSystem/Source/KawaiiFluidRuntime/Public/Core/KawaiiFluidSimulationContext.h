@@ -9,6 +9,9 @@
 #include "GPU/GPUFluidParticle.h"
 #include "Data/KawaiiFluidPresetDataAsset.h"
 #include "Components/KawaiiFluidVolumeComponent.h"
+#include "Collision/KawaiiFluidSDFCache.h"
+#include "Core/KawaiiFluidParticleLOD.h"
+#include "WorldCollision.h"
 #include "KawaiiFluidSimulationContext.generated.h"
 
 // Forward declarations
@@ -17,10 +20,32 @@ class FDensityConstraint;
 class FViscositySolver;
 class FAdhesionSolver;
 class FStackPressureSolver;
+class FSurfaceDetector;
+class FKawaiiFluidCompactParticles;
+class FSPHKernelTable;
 class FGPUFluidSimulator;
 class FKawaiiFluidRenderResource;
 struct FGPUFluidSimulationParams;
 
+/**
+ * Per-frame GPU simulation state shared by the three frame phases
+ * BeginGPUFrame (game thread) -> PrepareGPUCollision (task-safe per context) -> SubmitGPUFrame (game thread)
+ */
+struct FKawaiiFluidGPUFrameData
+{
+	/** BeginGPUFrame succeeded (simulator ready, preset valid) */
+	bool bValid = false;
+
+	/** World collision query bounds (volume bounds or particle/character bounds in Unlimited mode) */
+	FBox WorldQueryBounds = FBox(EForceInit::ForceInit);
+
+	/** GPU simulation parameters for this frame's substeps */
+	FGPUFluidSimulationParams GPUParams;
+
+	/** World time sampled on the game thread (for adhesion) */
+	float AdhesionTime = 0.0f;
+};
+
 /**
  * Stateless Simulation Context
  *
@@ -93,6 +118,17 @@ public:
 	/** Mark landscape heightmap dirty (re-extract and upload on next GPU sim) */
 	void MarkLandscapeHeightmapDirty() { bLandscapeHeightmapDirty = true; }
 
+	/**
+	 * Far-field particle LOD step on the latest GPU readback
+	 * Merges far, slow clusters into representatives and splits representatives near a viewer,
+	 * through the GPU despawn-by-ID and spawn queues. Steps must be further apart than the
+	 * readback latency so each one sees the result of the previous one.
+	 * @param ViewPoints Viewer locations
+	 * @param Settings LOD tuning (BaseMass, ClusterCellSize and SplitRadius come from the preset)
+	 * @return Pass counters
+	 */
+	FKawaiiFluidParticleLODStats UpdateParticleLOD(TConstArrayView<FVector> ViewPoints, const FKawaiiFluidParticleLODSettings& Settings);
+
 	//========================================
 	// Target Volume Component (Z-Order Space Bounds)
 	//========================================
@@ -160,6 +196,64 @@ public:
 		float& AccumulatedTime
 	);
 
+	/**
+	 * CPU simulation entry point (editor preview / thumbnails, no GPU simulator required)
+	 * Runs fixed-dt SimulateSubstep calls with the same accumulator as SimulateGPU
+	 *
+	 * @param Particles - In/Out particle array
+	 * @param Preset - Read-only preset parameters
+	 * @param Params - Per-frame simulation parameters (WorldBounds is used as axis-aligned containment)
+	 * @param SpatialHash - In/Out spatial hash, cell size = Preset->SmoothingRadius
+	 * @param DeltaTime - Frame delta time
+	 * @param AccumulatedTime - In/Out accumulated time for substeps
+	 * @return Number of substeps run
+	 */
+	virtual int32 SimulateCPU(
+		TArray<FFluidParticle>& Particles,
+		const UKawaiiFluidPresetDataAsset* Preset,
+		const FKawaiiFluidSimulationParams& Params,
+		FSpatialHash& SpatialHash,
+		float DeltaTime,
+		float& AccumulatedTime
+	);
+
+	//========================================
+	// Phased GPU Frame (Subsystem task scheduling)
+	// SimulateGPU runs these back to back; the Subsystem runs PrepareGPUCollision
+	// for contexts that own their GPU simulator exclusively in parallel
+	//========================================
+
+	/**
+	 * Game-thread setup: simulator readiness, bounds, query bounds, GPU params, collider shape cache
+	 * @return false if the frame should be skipped
+	 */
+	bool BeginGPUFrame(
+		const UKawaiiFluidPresetDataAsset* Preset,
+		const FKawaiiFluidSimulationParams& Params,
+		FKawaiiFluidGPUFrameData& OutFrame
+	);
+
+	/**
+	 * Collision primitive assembly, world collision gathering, static boundary generation
+	 * Touches only this context and its own GPU simulator (safe to run concurrently with other contexts)
+	 */
+	void PrepareGPUCollision(
+		const UKawaiiFluidPresetDataAsset* Preset,
+		const FKawaiiFluidSimulationParams& Params,
+		const FKawaiiFluidGPUFrameData& Frame
+	);
+
+	/**
+	 * Game-thread submission: landscape heightmap, boundary skinning, substeps, stats
+	 */
+	void SubmitGPUFrame(
+		const UKawaiiFluidPresetDataAsset* Preset,
+		const FKawaiiFluidSimulationParams& Params,
+		FKawaiiFluidGPUFrameData& Frame,
+		float DeltaTime,
+		float& AccumulatedTime
+	);
+
 	/**
 	 * Single substep simulation
 	 */
@@ -251,12 +345,25 @@ protected:
 		float Restitution
 	);
 
+	/** 5c. Containment bounds for the CPU path (Params.WorldBounds, axis-aligned, Params.BoundsRestitution/BoundsFriction) */
+	virtual void HandleBoundsCollision(
+		TArray<FFluidParticle>& Particles,
+		const FKawaiiFluidSimulationParams& Params,
+		float ParticleRadius
+	);
+
 	/** 6. Finalize positions and update velocities */
 	virtual void FinalizePositions(
 		TArray<FFluidParticle>& Particles,
 		float DeltaTime
 	);
 
+	/** 6b. Pack the compact layout read by viscosity and surface classification (r.Fluid.CPUCompactLayout) */
+	void PackCompactParticles(
+		const TArray<FFluidParticle>& Particles,
+		const UKawaiiFluidPresetDataAsset* Preset
+	);
+
 	/** 7. Apply viscosity (XSPH) */
 	virtual void ApplyViscosity(
 		TArray<FFluidParticle>& Particles,
@@ -270,7 +377,13 @@ protected:
 		const TArray<TObjectPtr<UKawaiiFluidCollider>>& Colliders
 	);
 
-	/** 9. Apply cohesion (surface tension between particles) */
+	/** 9a. Classify surface particles (bIsSurfaceParticle, SurfaceNormal) */
+	virtual void ClassifySurface(
+		TArray<FFluidParticle>& Particles,
+		const UKawaiiFluidPresetDataAsset* Preset
+	);
+
+	/** 9b. Apply cohesion (surface tension between particles, surface particles only when classified) */
 	virtual void ApplyCohesion(
 		TArray<FFluidParticle>& Particles,
 		const UKawaiiFluidPresetDataAsset* Preset
@@ -300,7 +413,17 @@ protected:
 	/** Cache collider shapes (once per frame) */
 	virtual void CacheColliderShapes(const TArray<TObjectPtr<UKawaiiFluidCollider>>& Colliders);
 
-	/** Append cached world-collision primitives (GPU) using channel-filtered world query */
+	/**
+	 * Poll the pending async world overlap query and issue a new one if QueryBounds left the covered box
+	 * Game thread only. Results are consumed by AppendGPUWorldCollisionPrimitives (one frame latency).
+	 * @param QueryBounds Bounds that need world collision this frame
+	 */
+	void UpdateWorldOverlapQuery(const FKawaiiFluidSimulationParams& Params, const FBox& QueryBounds);
+
+	/**
+	 * Append cached world-collision primitives (GPU) from the channel-filtered overlap set
+	 * Only components entering the set (or moving) are exported; safe to call from a worker thread.
+	 */
 	void AppendGPUWorldCollisionPrimitives(
 		FGPUCollisionPrimitives& OutPrimitives,
 		const FKawaiiFluidSimulationParams& Params,
@@ -327,6 +450,18 @@ protected:
 	/** Stack pressure solver (weight transfer from stacked attached particles) */
 	TSharedPtr<FStackPressureSolver> StackPressureSolver;
 
+	/** Surface particle classifier (its index list limits cohesion to the surface) */
+	TSharedPtr<FSurfaceDetector> SurfaceDetector;
+
+	/** Compact particle layout packed after FinalizePositions (valid only while r.Fluid.CPUCompactLayout is on) */
+	TSharedPtr<FKawaiiFluidCompactParticles> CompactParticles;
+
+	/** Tabulated SPH kernels for the preset's smoothing radius (rebuilt when the radius changes) */
+	TSharedPtr<FSPHKernelTable> KernelTable;
+
+	/** Kernel table for the preset (nullptr if it cannot be built) */
+	const FSPHKernelTable* GetKernelTable(const UKawaiiFluidPresetDataAsset* Preset);
+
 	/** Flag to check if solvers are initialized */
 	bool bSolversInitialized = false;
 
@@ -390,8 +525,11 @@ protected:
 	// Persistent Bone Transform Data (for GPU adhesion)
 	//========================================
 
-	/** Bone transforms persisted across frames for velocity calculation */
-	TArray<FGPUBoneTransform> PersistentBoneTransforms;
+	/**
+	 * Collision primitives exported each frame. Shape arrays are reset but keep their allocation;
+	 * BoneTransforms persist across frames for velocity calculation
+	 */
+	FGPUCollisionPrimitives GPUCollisionPrimitivesScratch;
 
 	/** Bone name to index mapping persisted across frames */
 	TMap<FName, int32> PersistentBoneNameToIndex;
@@ -409,8 +547,48 @@ protected:
 	/** Cached primitives built from world collision channel */
 	FGPUCollisionPrimitives CachedGPUWorldCollisionPrimitives;
 
-	/** Cached query bounds for world collision */
-	FBox CachedGPUWorldCollisionBounds = FBox(EForceInit::ForceInit);
+	/** Exported primitives of one overlapped world component */
+	struct FWorldCollisionComponentEntry
+	{
+		FGPUCollisionPrimitives Primitives;
+		FTransform Transform = FTransform::Identity;
+		int32 InstanceCount = 0;
+		TWeakObjectPtr<const AActor> Owner;
+		bool bExported = false;
+	};
+
+	/** Persistent set of overlapped world components (diffed against each overlap result) */
+	TMap<TWeakObjectPtr<const UPrimitiveComponent>, FWorldCollisionComponentEntry> WorldCollisionComponents;
+
+	/** Components from the latest resolved overlap query */
+	TArray<TWeakObjectPtr<const UPrimitiveComponent>> ResolvedWorldOverlapComponents;
+
+	/** ResolvedWorldOverlapComponents has not been diffed yet */
+	bool bWorldOverlapResultReady = false;
+
+	/** Re-export every component on the next diff (actors spawned/destroyed) */
+	bool bWorldOverlapForceReexport = false;
+
+	/** Padded box covered by the resolved overlap query */
+	FBox WorldOverlapCoveredBounds = FBox(EForceInit::ForceInit);
+
+	/** In-flight async overlap query and its box */
+	FTraceHandle PendingWorldOverlapHandle;
+	FBox PendingWorldOverlapBounds = FBox(EForceInit::ForceInit);
+
+	/** FluidCollider owners excluded from CachedGPUWorldCollisionPrimitives */
+	TSet<const AActor*> CachedFluidColliderOwners;
+
+	/** Store a finished overlap result for the next diff */
+	void ResolveWorldOverlap(const TArray<FOverlapResult>& Overlaps, const FBox& Bounds);
+
+	/** Export simple collision of one static mesh / ISM component */
+	void ExportWorldCollisionComponent(
+		const UPrimitiveComponent* PrimComp,
+		float DefaultFriction,
+		float DefaultRestitution,
+		bool bShouldLog,
+		FGPUCollisionPrimitives& OutPrimitives) const;
 
 	/** Cached world pointer for world collision */
 	TWeakObjectPtr<UWorld> CachedGPUWorldCollisionWorld;
@@ -418,6 +596,9 @@ protected:
 	/** Cached world collision primitives dirty flag */
 	bool bGPUWorldCollisionCacheDirty = true;
 
+	/** Bumped whenever CachedGPUWorldCollisionPrimitives is rebuilt */
+	int32 GPUWorldCollisionCacheRevision = 0;
+
 	/** Static boundary particles need regeneration flag */
 	bool bStaticBoundaryParticlesDirty = true;
 
@@ -440,4 +621,65 @@ protected:
 
 	/** Update landscape heightmap collision (called from SimulateGPU) */
 	void UpdateLandscapeHeightmapCollision(const FKawaiiFluidSimulationParams& Params, const UKawaiiFluidPresetDataAsset* Preset);
+
+	//========================================
+	// World SDF Cache (SDF world collision, CPU and GPU)
+	//========================================
+
+	/** Sparse-brick SDF of static world collision, synced from CachedGPUWorldCollisionPrimitives */
+	FKawaiiFluidSDFCache WorldSDFCache;
+
+	/** GPUWorldCollisionCacheRevision the SDF cache was last synced to */
+	int32 WorldSDFSourceRevision = INDEX_NONE;
+
+	/** Per-frame world primitive gather of the SDF path (allocation reused across frames) */
+	FGPUCollisionPrimitives WorldSDFGatherScratch;
+
+	/** SDF owner ID (actor UniqueID) -> actor, for collision events and attachment checks */
+	TMap<int32, TWeakObjectPtr<AActor>> WorldSDFOwnerActors;
+
+	/** Brick revision last uploaded to the GPU simulator */
+	uint32 WorldSDFUploadedRevision = 0;
+	bool bWorldSDFBricksUploaded = false;
+
+	/** Region snap for the SDF query bounds (keeps the region stable while particles move) */
+	static constexpr float WorldSDFRegionSnap = 2000.0f;
+
+	/** Snap bounds outward to WorldSDFRegionSnap */
+	static FBox SnapWorldSDFRegion(const FBox& Bounds);
+
+	/**
+	 * Refresh world primitives around the particles, sync the SDF cache and publish finished brick builds
+	 * Game thread only (issues the overlap query).
+	 * @return true if the cache is complete and can replace overlap queries this substep
+	 */
+	bool UpdateWorldSDFCache(const FKawaiiFluidSimulationParams& Params, const TArray<FFluidParticle>& Particles);
+
+	/**
+	 * Sync the SDF cache to the world primitives gathered for Bounds and publish finished brick builds
+	 * Consumes the overlap query issued by UpdateWorldOverlapQuery; safe to call from a worker thread.
+	 * @return true if the cache is complete
+	 */
+	bool UpdateWorldSDFCache(
+		const FKawaiiFluidSimulationParams& Params,
+		const FBox& Bounds,
+		float DefaultFriction,
+		float DefaultRestitution,
+		const TSet<const AActor*>& FluidColliderOwners);
+
+	/** Upload the SDF bricks to the GPU simulator if they changed since the last upload */
+	void UploadWorldSDFBricks();
+
+	//========================================
+	// Particle LOD
+	//========================================
+
+	/** ParticleID -> mass of representatives alive on the GPU (the readback carries no mass) */
+	TMap<int32, float> LODRepresentativeMasses;
+
+	/** Representatives spawned by the last LOD step (may not be in the readback yet) */
+	TSet<int32> LODPendingSpawnIDs;
+
+	/** Particles despawned by the last LOD step (may still be in the readback) */
+	TSet<int32> LODPendingDespawnIDs;
 };
@@ -6,6 +6,7 @@
 #include "GameFramework/Actor.h"
 #include <atomic>
 #include "Core/KawaiiFluidRenderingTypes.h"
+#include "Core/KawaiiFluidParticleIdentity.h"
 #include "KawaiiFluidSimulationTypes.generated.h"
 
 class UKawaiiFluidCollider;
@@ -192,13 +193,19 @@ struct KAWAIIFLUIDRUNTIME_API FFluidBrushSettings
 	UPROPERTY(EditAnywhere, Category = "Brush", meta = (ClampMin = "10.0", ClampMax = "500.0"))
 	float Radius = 50.0f;
 
+	/** Particles per stroke (upper bound per stroke when filling empty space) */
 	UPROPERTY(EditAnywhere, Category = "Brush", meta = (ClampMin = "1", ClampMax = "100"))
 	int32 ParticlesPerStroke = 15;
 
+	/** Fill only empty space along the stroke path at the preset ParticleSpacing (Poisson-disk) */
+	UPROPERTY(EditAnywhere, Category = "Brush")
+	bool bFillEmptySpace = true;
+
 	UPROPERTY(EditAnywhere, Category = "Brush")
 	FVector InitialVelocity = FVector(0, 0, 0);
 
-	UPROPERTY(EditAnywhere, Category = "Brush", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	/** Radius jitter of the legacy random distribution (unused when filling empty space) */
+	UPROPERTY(EditAnywhere, Category = "Brush", meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "!bFillEmptySpace"))
 	float Randomness = 0.8f;
 
 	UPROPERTY(EditAnywhere, Category = "Brush", meta = (ClampMin = "0.01", ClampMax = "0.5"))
@@ -214,8 +221,9 @@ struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidCollisionEvent
 	GENERATED_BODY()
 
 	// ID-based (from GPU)
+	/** Stable ParticleID of the colliding particle (not an index into the particle array) */
 	UPROPERTY(BlueprintReadOnly, Category = "Collision")
-	int32 ParticleIndex = 0;
+	int32 ParticleID = 0;
 
 	UPROPERTY(BlueprintReadOnly, Category = "Collision")
 	int32 SourceID = -1;              // Particle source Component ID
@@ -292,6 +300,15 @@ struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidSimulationParams
 	UPROPERTY(BlueprintReadWrite, Category = "Simulation")
 	EWorldCollisionMethod WorldCollisionMethod = EWorldCollisionMethod::SDF;
 
+	/**
+	 * Sample a baked sparse-brick SDF of world simple collision: replaces per-particle overlap
+	 * queries on the CPU (SDF method) and the world primitives of the GPU primitive pass.
+	 * Opt-in: landscape and complex-only collision are not baked, and every overlapped actor is
+	 * baked as if it were static.
+	 */
+	UPROPERTY(BlueprintReadWrite, Category = "Simulation")
+	bool bUseWorldSDFCache = false;
+
 	/** Particle render radius (for collision detection) */
 	UPROPERTY(BlueprintReadWrite, Category = "Simulation")
 	float ParticleRadius = 5.0f;
@@ -327,10 +344,10 @@ struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidSimulationParams
 	/** Bounds rotation - for OBB collision (identity = AABB mode) */
 	FQuat BoundsRotation = FQuat::Identity;
 
-	/** Bounds collision restitution (bounciness) - used for Containment on GPU */
+	/** Bounds collision restitution (bounciness) - used for Containment on GPU and the CPU bounds */
 	float BoundsRestitution = 0.3f;
 
-	/** Bounds collision friction - used for Containment on GPU */
+	/** Bounds collision friction - used for Containment on GPU and the CPU bounds */
 	float BoundsFriction = 0.1f;
 
 	/** Skip bounds collision entirely (Unlimited Size mode)
@@ -370,8 +387,8 @@ struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidSimulationParams
 	/** Per-particle event cooldown in seconds (prevents same particle spamming events) */
 	float EventCooldownPerParticle = 0.1f;
 
-	/** Pointer to per-particle last event time map (managed by component) */
-	TMap<int32, float>* ParticleLastEventTimePtr = nullptr;
+	/** Pointer to per-particle last event time, keyed by ParticleID (managed by component) */
+	TKawaiiFluidParticleHistory<float>* ParticleLastEventTimePtr = nullptr;
 
 	/** Current game time for cooldown calculation */
 	float CurrentGameTime = 0.0f;
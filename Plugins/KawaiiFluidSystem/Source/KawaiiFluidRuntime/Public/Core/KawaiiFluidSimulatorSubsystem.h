@@ -5,9 +5,13 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Engine/EngineBaseTypes.h"  // For ELevelTick
+#include "Components/SceneComponent.h"  // For EUpdateTransformFlags
 #include "Core/KawaiiFluidSimulationTypes.h"
 #include "Components/KawaiiFluidInteractionComponent.h"
 #include "GPU/GPUFluidParticle.h"
+#include "Core/KawaiiFluidActivationGrid.h"
+#include "Core/KawaiiFluidFrameArena.h"
+#include "Core/KawaiiFluidSourceIDAllocator.h"
 #include "KawaiiFluidSimulatorSubsystem.generated.h"
 
 class UKawaiiFluidSimulationModule;
@@ -18,11 +22,13 @@ class AKawaiiFluidVolume;
 class AKawaiiFluidEmitter;
 class UKawaiiFluidCollider;
 class UKawaiiFluidInteractionComponent;
+class UKawaiiFluidEmitterComponent;
 class AActor;
 class ULevel;
 class FSpatialHash;
 struct FFluidParticle;
 class FGPUFluidSimulator;
+struct FKawaiiFluidSimulationJob;
 
 /**
  * Cache key for Context lookup
@@ -112,7 +118,7 @@ public:
 	/** Allocate a unique SourceID (0 ~ MaxSourceCount-1) for GPU counter tracking */
 	int32 AllocateSourceID();
 
-	/** Release a SourceID back to the pool */
+	/** Release a SourceID; it is reused only after its particles are gone from every GPU simulator */
 	void ReleaseSourceID(int32 SourceID);
 
 	//========================================
@@ -128,6 +134,35 @@ public:
 	/** Get all registered volume actors */
 	const TArray<TObjectPtr<AKawaiiFluidVolume>>& GetAllVolumes() const { return AllVolumes; }
 
+	/** Find the registered volume closest to a location (spatial grid lookup) */
+	AKawaiiFluidVolume* FindNearestVolume(const FVector& Location) const;
+
+	//========================================
+	// Distance Activation (Batched)
+	//========================================
+
+	/**
+	 * Register emitter for batched distance activation (registering twice is a no-op)
+	 * All registered emitters are evaluated against every reference point in one grid pass.
+	 * @param bOutActive Initial activation state against current reference points (current state if already registered)
+	 * @return True if the emitter is registered
+	 */
+	bool RegisterDistanceActivation(UKawaiiFluidEmitterComponent* Emitter, bool& bOutActive);
+
+	/** Unregister emitter from batched distance activation */
+	void UnregisterDistanceActivation(UKawaiiFluidEmitterComponent* Emitter);
+
+	/**
+	 * Add an extra activation reference actor (spectator cameras, cinematic rigs)
+	 * Local player pawns (or their cameras when not possessing) are always used.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "KawaiiFluid|Optimization")
+	void RegisterActivationReference(AActor* ReferenceActor);
+
+	/** Remove an extra activation reference actor */
+	UFUNCTION(BlueprintCallable, Category = "KawaiiFluid|Optimization")
+	void UnregisterActivationReference(AActor* ReferenceActor);
+
 	//========================================
 	// Volume Component Registration (Legacy)
 	//========================================
@@ -235,11 +270,17 @@ private:
 	// SourceID Allocation State
 	//========================================
 
-	/** Bitfield tracking used SourceIDs (index = SourceID, true = in use) */
-	TBitArray<> UsedSourceIDs;
+	/** Two-level bitmap of free SourceIDs (O(1) allocate/release, lowest id first) */
+	FKawaiiFluidSourceIDAllocator SourceIDAllocator;
+
+	/** Frames a released SourceID stays quarantined before its counters are trusted (covers the readback ring) */
+	static constexpr int32 SourceIDQuarantineFrames = 8;
 
-	/** Next SourceID hint for faster allocation */
-	int32 NextSourceIDHint = 0;
+	/** Return quarantined SourceIDs whose per-source counters read back zero */
+	void ReleaseDrainedSourceIDs();
+
+	/** Module per SourceID, sized to the allocator high-water mark (owned by AllModules) */
+	TArray<TWeakObjectPtr<UKawaiiFluidSimulationModule>> ModulesBySourceID;
 
 	//========================================
 	// Volume Actor Management (New Architecture)
@@ -249,6 +290,53 @@ private:
 	UPROPERTY()
 	TArray<TObjectPtr<AKawaiiFluidVolume>> AllVolumes;
 
+	/** Volume locations for nearest-volume queries */
+	FKawaiiFluidActivationGrid VolumeGrid;
+
+	/** Volumes indexed by VolumeGrid handle (stale entries are null) */
+	TArray<TWeakObjectPtr<AKawaiiFluidVolume>> VolumeGridVolumes;
+
+	/** Keep a volume's VolumeGrid location in sync when its root component moves */
+	void HandleVolumeTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags,
+	                                  ETeleportType Teleport, int32 Handle);
+
+	//========================================
+	// Distance Activation State
+	//========================================
+
+	/** Emitter activation grid (handle = index into ActivationEmitters) */
+	FKawaiiFluidActivationGrid EmitterActivationGrid;
+
+	/** Emitters indexed by activation grid handle (stale entries are null) */
+	TArray<TWeakObjectPtr<UKawaiiFluidEmitterComponent>> ActivationEmitters;
+
+	/** Extra reference actors registered by gameplay code */
+	TArray<TWeakObjectPtr<AActor>> ActivationReferenceActors;
+
+	/** Reference point scratch buffer */
+	TArray<FVector> ActivationReferencePoints;
+
+	/** Changed handle scratch buffer */
+	TArray<int32> ActivationChangedHandles;
+
+	/** Throttle accumulator for batched activation update */
+	float ActivationUpdateAccumulator = 0.0f;
+
+	/** Batched activation update interval (10Hz, matches former per-emitter check) */
+	static constexpr float ActivationUpdateInterval = 0.1f;
+
+	/** Gather reference points from local players and registered reference actors */
+	void GatherActivationReferencePoints(TArray<FVector>& OutPoints) const;
+
+	/** Refresh emitter locations and evaluate activation for all registered emitters */
+	void UpdateDistanceActivation(float DeltaTime);
+
+	/** Throttle accumulator for the particle LOD step */
+	float ParticleLODAccumulator = 0.0f;
+
+	/** Far-field particle LOD step on every context (r.Fluid.ParticleLOD, viewers from GatherActivationReferencePoints) */
+	void UpdateParticleLOD(float DeltaTime);
+
 	//========================================
 	// Volume Component Management (Legacy)
 	//========================================
@@ -303,15 +391,36 @@ private:
 	/** CPU collision feedback buffer lock (ParallelFor safe) */
 	FCriticalSection CPUCollisionFeedbackLock;
 
+	/** OwnerID -> InteractionComponent map rebuilt each tick (allocation reused across frames) */
+	TMap<int32, UKawaiiFluidInteractionComponent*> OwnerIDToICScratch;
+
+	//========================================
+	// Frame Arena
+	//========================================
+
+	/** Backs per-frame temporaries of the simulation tick (job lists, CPU collision queries, spawn batches) */
+	FKawaiiFluidDoubleBufferedArena FrameArenas;
+
 	//========================================
 	// Simulation Methods
 	//========================================
 
-	/** Simulate independent modules */
-	void SimulateIndependentFluidComponents(float DeltaTime);
+	/** Gather simulation jobs for all modules and run them (phased, collision gathering in parallel) */
+	void SimulateFluidComponents(float DeltaTime);
+
+	/** Build one job per independent module */
+	void GatherIndependentSimulationJobs(TKawaiiFluidFrameArray<FKawaiiFluidSimulationJob>& OutJobs);
+
+	/** Build one job per (VolumeComponent + Preset) batch */
+	void GatherBatchedSimulationJobs(TKawaiiFluidFrameArray<FKawaiiFluidSimulationJob>& OutJobs);
 
-	/** Simulate batched modules */
-	void SimulateBatchedFluidComponents(float DeltaTime);
+	/**
+	 * Run jobs in three phases
+	 * 1. Game thread: BeginGPUFrame for every context driven by a single job
+	 * 2. ParallelFor: PrepareGPUCollision for those contexts
+	 * 3. Game thread: merge / submit / split in original order (shared contexts run Simulate here)
+	 */
+	void RunSimulationJobs(TKawaiiFluidFrameArray<FKawaiiFluidSimulationJob>& Jobs, float DeltaTime);
 
 	/** Group modules by Preset + VolumeComponent */
 	TMap<FContextCacheKey, TArray<TObjectPtr<UKawaiiFluidSimulationModule>>> GroupModulesByContext() const;
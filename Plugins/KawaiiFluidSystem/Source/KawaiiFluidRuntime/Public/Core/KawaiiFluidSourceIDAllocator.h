@@ -0,0 +1,142 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+//
+// Source Registry
+// ===============
+// Every simulation module owns a SourceID that tags its particles on the GPU and indexes the
+// per-source counters (particle count, emitter max, recycle excess). IDs go up to
+// EGPUParticleSource::MaxSourceCount (16-bit, 0xFFFF is the invalid id of packed readbacks).
+//
+// - FKawaiiFluidSourceIDAllocator: two-level bitmap of free IDs. A summary bit per 64-id leaf
+//   word says "this word has a free id", so Allocate/Release touch one summary word and one
+//   leaf word (count-trailing-zeros), independent of how many sources exist. Allocation is
+//   lowest-first, which keeps live IDs dense near zero: counter buffers only need to cover
+//   the high-water mark, not the whole id space.
+//   A released id is quarantined first: its particles can outlive the owner on the GPU, and a
+//   new owner must not inherit them through the per-source counters. ReleaseDrained frees it
+//   once its counter reads back zero.
+// - FKawaiiFluidSourceRangeSet: sorted, merged [Begin, End) id ranges. Tracks which counters
+//   changed since the last readback, so only those ranges are copied back to the CPU.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GPU/GPUFluidParticle.h"
+
+/**
+ * O(1) SourceID allocator (two-level free bitmap, lowest id first)
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidSourceIDAllocator
+{
+public:
+	/** IDs per leaf word */
+	static constexpr int32 IDsPerWord = 64;
+
+	/** IDs covered by one summary word (64 leaf words) */
+	static constexpr int32 IDsPerSummaryWord = IDsPerWord * 64;
+
+	explicit FKawaiiFluidSourceIDAllocator(int32 InCapacity = EGPUParticleSource::MaxSourceCount);
+
+	/** Lowest free id, InvalidSourceID when all ids are in use */
+	int32 Allocate();
+
+	/** Return an id to the pool immediately (false if it was not allocated or is quarantined) */
+	bool Release(int32 ID);
+
+	/** Retire an id without freeing it; ReleaseDrained returns it to the pool (false if it was not allocated) */
+	bool Quarantine(int32 ID);
+
+	/**
+	 * Age every quarantined id by one update and free those quarantined for at least MinUpdates
+	 * updates whose particles are gone
+	 * @param MinUpdates Updates an id stays quarantined regardless of IsDrained (readback latency)
+	 * @param IsDrained True when no particle of the id is alive anymore
+	 * @return Number of ids returned to the pool
+	 */
+	int32 ReleaseDrained(int32 MinUpdates, TFunctionRef<bool(int32)> IsDrained);
+
+	/** True for live and quarantined ids (neither can be handed out) */
+	bool IsAllocated(int32 ID) const;
+
+	bool IsQuarantined(int32 ID) const { return ID >= 0 && ID < Capacity && QuarantinedBits[ID]; }
+
+	/** Free every id (high-water mark restarts at 0) */
+	void Reset();
+
+	/** Live ids (quarantined ids excluded) */
+	int32 Num() const { return NumAllocated; }
+	int32 GetNumQuarantined() const { return Quarantined.Num(); }
+	int32 GetCapacity() const { return Capacity; }
+
+	/** Highest id handed out since Reset + 1 (size of a dense per-source table) */
+	int32 GetHighWaterMark() const { return HighWaterMark; }
+
+private:
+	/** Set the free bits of an id (no bookkeeping) */
+	void MarkFree(int32 ID);
+
+	/** Bit set = id free */
+	TArray<uint64> FreeWords;
+
+	/** Bit w set = FreeWords[SummaryIndex * 64 + w] != 0 */
+	TArray<uint64> SummaryWords;
+
+	/** No summary word below this index has a free id */
+	int32 FirstFreeSummary = 0;
+
+	struct FQuarantinedID
+	{
+		int32 ID = 0;
+		int32 Updates = 0;
+	};
+
+	/** Retired ids waiting for their particles to drain (oldest first) */
+	TArray<FQuarantinedID> Quarantined;
+
+	/** Bit set = id quarantined */
+	TBitArray<> QuarantinedBits;
+
+	int32 Capacity = 0;
+	int32 NumAllocated = 0;
+	int32 HighWaterMark = 0;
+};
+
+/** Half-open id range [Begin, End) */
+struct FKawaiiFluidSourceRange
+{
+	int32 Begin = 0;
+	int32 End = 0;
+
+	FKawaiiFluidSourceRange() = default;
+	FKawaiiFluidSourceRange(int32 InBegin, int32 InEnd) : Begin(InBegin), End(InEnd) {}
+
+	int32 Num() const { return End - Begin; }
+	bool operator==(const FKawaiiFluidSourceRange& Other) const { return Begin == Other.Begin && End == Other.End; }
+};
+
+/**
+ * Sorted set of disjoint id ranges
+ * Ranges closer than MergeGap are joined (one copy of a few clean counters is cheaper than
+ * two copies), and the set never holds more than MaxRanges (closest neighbors are joined).
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidSourceRangeSet
+{
+public:
+	explicit FKawaiiFluidSourceRangeSet(int32 InMergeGap = 16, int32 InMaxRanges = 8);
+
+	void Add(int32 ID) { AddRange(ID, ID + 1); }
+	void AddRange(int32 Begin, int32 End);
+
+	bool Contains(int32 ID) const;
+	bool IsEmpty() const { return Ranges.Num() == 0; }
+	void Reset() { Ranges.Reset(); }
+
+	/** Ids covered by all ranges */
+	int32 GetNumIDs() const;
+
+	const TArray<FKawaiiFluidSourceRange>& GetRanges() const { return Ranges; }
+
+private:
+	TArray<FKawaiiFluidSourceRange> Ranges;
+	int32 MergeGap = 16;
+	int32 MaxRanges = 8;
+};
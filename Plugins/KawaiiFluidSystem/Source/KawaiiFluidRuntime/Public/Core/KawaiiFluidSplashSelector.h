@@ -0,0 +1,92 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+//
+// Splash Candidate Selection (CPU Reference)
+// ==========================================
+// Decides which particles emit splash VFX this frame. FluidSplashCompact.usf runs the same
+// rules on the GPU; this is the reference for its tests and the path used by CPU simulation.
+//
+// 1. Condition (ESplashConditionMode): fast (speed > threshold) and/or just became isolated
+//    (neighbor count at or below the isolation threshold, and not isolated last frame).
+// 2. Weight: speed / threshold clamped to [1, MaxWeight], quantized and summed over all candidates.
+// 3. Thinning: a candidate is kept with probability min(1, Weight * Budget * Oversample / TotalWeight),
+//    so the compacted list stays small and does not depend on particle order.
+// 4. Selection: weighted reservoir keys u^(1/Weight); the Budget highest keys are emitted.
+//
+// Random numbers are hashed from (ParticleID, FrameIndex), so the CPU and GPU passes agree.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/KawaiiFluidRenderingTypes.h"
+#include "GPU/GPUFluidParticle.h"
+
+/**
+ * Splash selection settings (mirrors the volume component's VFX properties)
+ */
+struct FKawaiiFluidSplashSettings
+{
+	ESplashConditionMode ConditionMode = ESplashConditionMode::VelocityAndIsolation;
+
+	/** Speed required to count as fast-moving (cm/s) */
+	float VelocityThreshold = 200.0f;
+
+	/** Neighbor count at or below which a particle is isolated */
+	int32 IsolationNeighborThreshold = 2;
+
+	/** Splashes emitted per frame */
+	int32 Budget = 10;
+};
+
+/**
+ * Splash candidate compaction and selection
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidSplashSelector
+{
+public:
+	/** Compacted candidate capacity (GPU buffer size) */
+	static constexpr int32 MaxCandidates = 256;
+
+	/** Expected compacted candidates per emitted splash */
+	static constexpr int32 Oversample = 4;
+
+	/** Upper bound on the importance weight of one particle */
+	static constexpr float MaxWeight = 8.0f;
+
+	/** Fixed-point scale for summed weights (GPU uses an integer atomic) */
+	static constexpr float WeightFixedScale = 16.0f;
+
+	/**
+	 * Evaluate the splash condition of one particle
+	 * @param bInOutWasIsolated Isolation state from last frame; updated to this frame's state
+	 * @return true if the particle is a splash candidate
+	 */
+	static bool EvaluateCondition(
+		const FKawaiiFluidSplashSettings& Settings,
+		float Speed,
+		uint32 NeighborCount,
+		bool& bInOutWasIsolated);
+
+	/** Quantized importance weight of a candidate (>= WeightFixedScale) */
+	static uint32 ComputeWeightFixed(const FKawaiiFluidSplashSettings& Settings, float Speed);
+
+	/** Uniform random in (0, 1] from particle ID, frame and stream */
+	static float HashUnit(int32 ParticleID, uint32 FrameIndex, uint32 Stream);
+
+	/**
+	 * Compaction pass (same two passes as the GPU): sum weights, then thin and emit keyed candidates
+	 * @param InOutWasIsolated Per-particle isolation state (resized to Positions.Num() if it does not match)
+	 * @param OutCandidates Compacted candidates (at most MaxCandidates, unsorted)
+	 */
+	static void CompactCandidates(
+		TConstArrayView<FVector3f> Positions,
+		TConstArrayView<FVector3f> Velocities,
+		TConstArrayView<uint32> NeighborCounts,
+		TConstArrayView<int32> ParticleIDs,
+		TBitArray<>& InOutWasIsolated,
+		const FKawaiiFluidSplashSettings& Settings,
+		uint32 FrameIndex,
+		TArray<FGPUSplashCandidate>& OutCandidates);
+
+	/** Keep the Budget candidates with the highest keys (sorted by key, descending) */
+	static void SelectTopCandidates(TArray<FGPUSplashCandidate>& InOutCandidates, int32 Budget);
+};
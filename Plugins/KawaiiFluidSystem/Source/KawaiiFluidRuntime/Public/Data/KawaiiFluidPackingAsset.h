@@ -0,0 +1,112 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Core/KawaiiFluidPackingRelaxer.h"
+#include "KawaiiFluidPackingAsset.generated.h"
+
+class UKawaiiFluidPresetDataAsset;
+
+/**
+ * Pre-settled Fluid Packing
+ * A fill shape relaxed offline to rest density for one preset (see FKawaiiFluidPackingRelaxer).
+ * Positions are stored quantized to 16 bits per axis within the local bounds (6 bytes/particle)
+ * and instantiated by transform when an emitter fills its shape.
+ */
+UCLASS(BlueprintType)
+class KAWAIIFLUIDRUNTIME_API UKawaiiFluidPackingAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	//========================================
+	// Source
+	//========================================
+
+	/** Preset the packing is relaxed for (smoothing radius, density, particle mass) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Packing")
+	TObjectPtr<UKawaiiFluidPresetDataAsset> Preset;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Packing|Shape")
+	EKawaiiFluidEmitterShapeType ShapeType = EKawaiiFluidEmitterShapeType::Sphere;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Packing|Shape",
+		meta = (EditCondition = "ShapeType == EKawaiiFluidEmitterShapeType::Sphere", EditConditionHides, ClampMin = "1.0"))
+	float SphereRadius = 50.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Packing|Shape",
+		meta = (EditCondition = "ShapeType == EKawaiiFluidEmitterShapeType::Cube", EditConditionHides))
+	FVector CubeHalfSize = FVector(50.0f, 50.0f, 50.0f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Packing|Shape",
+		meta = (EditCondition = "ShapeType == EKawaiiFluidEmitterShapeType::Cylinder", EditConditionHides, ClampMin = "1.0"))
+	float CylinderRadius = 30.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Packing|Shape",
+		meta = (EditCondition = "ShapeType == EKawaiiFluidEmitterShapeType::Cylinder", EditConditionHides, ClampMin = "1.0"))
+	float CylinderHalfHeight = 50.0f;
+
+	/** Relaxation iterations (Jacobi PBF steps) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Packing|Relaxation", meta = (ClampMin = "1", ClampMax = "2000"))
+	int32 RelaxationIterations = 100;
+
+	/** Seed lattice jitter (fraction of spacing); breaks the lattice so the result is isotropic */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Packing|Relaxation", meta = (ClampMin = "0.0", ClampMax = "0.5"))
+	float Jitter = 0.25f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Packing|Relaxation")
+	int32 Seed = 0;
+
+	//========================================
+	// Baked
+	//========================================
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Packing|Baked")
+	int32 NumParticles = 0;
+
+	/** Preset ParticleSpacing at bake time (spawns warn when the target preset differs) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Packing|Baked")
+	float BakedParticleSpacing = 0.0f;
+
+	/** RMS |ρ/ρ₀ - 1| after relaxation */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Packing|Baked")
+	float RMSDensityDeviation = 0.0f;
+
+	/** Max |ρ/ρ₀ - 1| after relaxation */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Packing|Baked")
+	float MaxDensityDeviation = 0.0f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Packing|Baked")
+	FBox LocalBounds = FBox(ForceInit);
+
+	/** Run the relaxation and store the result */
+	UFUNCTION(CallInEditor, BlueprintCallable, Category = "Packing")
+	void Bake();
+
+	UFUNCTION(BlueprintPure, Category = "Packing")
+	bool IsBaked() const { return NumParticles > 0 && QuantizedPositions.Num() == NumParticles * 3; }
+
+	/** Shape description of the source properties */
+	FKawaiiFluidPackingShape GetShape() const;
+
+	/** Store positions (local space), quantized */
+	void SetPositions(TConstArrayView<FVector> LocalPositions);
+
+	/** Dequantized local-space positions */
+	void GetLocalPositions(TArray<FVector>& OutPositions) const;
+
+	/** Positions placed by Transform (local → world) */
+	void GetPositions(const FTransform& Transform, TArray<FVector>& OutPositions) const;
+
+	/** Largest per-axis dequantization error (cm) */
+	float GetQuantizationError() const;
+
+	SIZE_T GetBakedDataSize() const { return QuantizedPositions.GetAllocatedSize(); }
+
+private:
+	/** XYZ per particle, 0..65535 across LocalBounds */
+	UPROPERTY()
+	TArray<uint16> QuantizedPositions;
+};
@@ -15,6 +15,7 @@ struct FGPUFluidParticle;
 struct FGPUParticleAttachment;
 struct FGPUBoundaryParticle;
 struct FGPUBoneDeltaAttachment;
+struct FGPUAnisotropyHistory;
 struct FGPUCollisionSphere;
 struct FGPUCollisionCapsule;
 struct FGPUCollisionBox;
@@ -127,12 +128,26 @@ struct KAWAIIFLUIDRUNTIME_API FAnisotropyComputeParams
 	// Non-preserved render scale (only used when bPreserveVolume = false)
 	// Controls overall ellipsoid size when volume preservation is disabled
 	float NonPreservedRenderScale = 1.0f;
+
+	// Incremental update (DensityBased only): recompute particles whose neighborhood changed,
+	// copy PrevAxis*SRV[History.PrevIndex] for the rest. PrevAxis*SRV hold last pass's output.
+	bool bIncrementalUpdate = false;
+	FRDGBufferSRVRef ParticleIDsSRV = nullptr;			// int as Buffer<int> (SoA_ParticleIDs)
+	FRDGBufferSRVRef NeighborCountsSRV = nullptr;		// uint as Buffer<uint> (SoA_NeighborCounts)
+	FRDGBufferUAVRef AnisotropyHistoryUAV = nullptr;	// FGPUAnisotropyHistory per particle (sorted with particles)
+	int32 PrevAnisotropyCount = 0;						// Element count of PrevAxis*SRV (0 = full recompute)
+	float IncrementalMotionDistance = 1.0f;				// cm
+	int32 IncrementalNeighborThreshold = 2;
+	int32 IncrementalMaxStaleFrames = 30;
 };
 
 // Constants (must match FluidSpatialHash.ush and FluidAnisotropyCompute.usf)
 #define ANISOTROPY_SPATIAL_HASH_SIZE 65536
 #define ANISOTROPY_MAX_PARTICLES_PER_CELL 16
 
+// Cell activity bitmask for incremental updates (1 bit per spatial hash bucket)
+#define ANISOTROPY_CELL_ACTIVITY_WORDS (ANISOTROPY_SPATIAL_HASH_SIZE / 32)
+
 //=============================================================================
 // Anisotropy Compute Shader
 // Calculates ellipsoid orientation and scale for each particle
@@ -235,6 +250,17 @@ public:
 
 		// Non-preserved render scale (only used when bPreserveVolume = 0)
 		SHADER_PARAMETER(float, NonPreservedRenderScale)
+
+		// Incremental update (reuse PrevAnisotropyAxis* where the neighborhood is calm)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<int>, InParticleIDs)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<uint>, InNeighborCounts)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FGPUAnisotropyHistory>, AnisotropyHistory)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, CellActivity)
+		SHADER_PARAMETER(int32, bIncrementalUpdate)
+		SHADER_PARAMETER(float, IncrementalMotionDistance)
+		SHADER_PARAMETER(uint32, IncrementalNeighborThreshold)
+		SHADER_PARAMETER(uint32, IncrementalMaxStaleFrames)
+		SHADER_PARAMETER(uint32, PrevAnisotropyCount)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static constexpr int32 ThreadGroupSize = 64;
@@ -264,6 +290,49 @@ public:
 	}
 };
 
+//=============================================================================
+// Anisotropy Mark Activity Shader
+// Incremental update pre-pass: particles that moved mark their grid cells so
+// MainCS recomputes every particle whose neighborhood they touch
+//=============================================================================
+
+class FFluidAnisotropyMarkActivityCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFluidAnisotropyMarkActivityCS);
+	SHADER_USE_PARAMETER_STRUCT(FFluidAnisotropyMarkActivityCS, FGlobalShader);
+
+	// Same source file as FFluidAnisotropyCS, so the same grid defines are required
+	using FPermutationDomain = TShaderPermutationDomain<FGridResolutionDim>;
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<float>, InPositions)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<int>, InParticleIDs)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<uint>, InNeighborCounts)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FGPUAnisotropyHistory>, AnisotropyHistory)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, CellActivity)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
+		SHADER_PARAMETER(float, CellSize)
+		SHADER_PARAMETER(float, IncrementalMotionDistance)
+		SHADER_PARAMETER(uint32, IncrementalNeighborThreshold)
+		SHADER_PARAMETER(uint32, PrevAnisotropyCount)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static constexpr int32 ThreadGroupSize = FFluidAnisotropyCS::ThreadGroupSize;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return FFluidAnisotropyCS::ShouldCompilePermutation(Parameters);
+	}
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters,
+		FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FFluidAnisotropyCS::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+	}
+};
+
 //=============================================================================
 // Anisotropy Pass Builder
 // Utility class for adding anisotropy compute passes to RDG
@@ -0,0 +1,94 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GlobalShader.h"
+#include "ShaderParameterStruct.h"
+#include "RenderGraphResources.h"
+#include "GPU/GPUFluidParticle.h"
+
+class FRDGBuilder;
+
+//=============================================================================
+// Quantized Readback Compute Shaders
+// Header init, particle AABB reduction, then 20-byte packing of each particle
+// (see FluidQuantizeReadback.usf and GPUQuantizedReadback)
+//=============================================================================
+
+BEGIN_SHADER_PARAMETER_STRUCT(FQuantizeReadbackParameters, )
+	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGPUFluidParticle>, InParticles)
+	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
+	SHADER_PARAMETER_RDG_BUFFER_UAV(RWByteAddressBuffer, OutQuantized)
+END_SHADER_PARAMETER_STRUCT()
+
+class FInitQuantizeHeaderCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FInitQuantizeHeaderCS);
+	SHADER_USE_PARAMETER_STRUCT(FInitQuantizeHeaderCS, FGlobalShader);
+
+	using FParameters = FQuantizeReadbackParameters;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+class FReduceQuantizeBoundsCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FReduceQuantizeBoundsCS);
+	SHADER_USE_PARAMETER_STRUCT(FReduceQuantizeBoundsCS, FGlobalShader);
+
+	using FParameters = FQuantizeReadbackParameters;
+
+	static constexpr int32 ThreadGroupSize = 256;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters,
+		FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREAD_GROUP_SIZE"), ThreadGroupSize);
+	}
+};
+
+class FEncodeQuantizedCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FEncodeQuantizedCS);
+	SHADER_USE_PARAMETER_STRUCT(FEncodeQuantizedCS, FGlobalShader);
+
+	using FParameters = FQuantizeReadbackParameters;
+
+	static constexpr int32 ThreadGroupSize = 256;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters,
+		FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREAD_GROUP_SIZE"), ThreadGroupSize);
+	}
+};
+
+/**
+ * Add the three quantization passes
+ * @param ParticleBuffer Full particle buffer (FGPUFluidParticle)
+ * @param CountBuffer Particle count buffer (indirect args at offset 0, count at [6])
+ * @param MaxParticleCount CPU upper bound of the particle count (buffer allocation only)
+ * @return ByteAddress buffer: FQuantizedReadbackHeader followed by FQuantizedParticleStats records
+ */
+FRDGBufferRef AddQuantizeReadbackPasses(FRDGBuilder& GraphBuilder, FRDGBufferRef ParticleBuffer, FRDGBufferRef CountBuffer, int32 MaxParticleCount);
@@ -0,0 +1,135 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+//
+// Quantized Readback Codec
+// ========================
+// CPU side of the quantized stats readback (FluidQuantizeReadback.usf):
+//
+// - Position:  16 bits per axis relative to the frame's particle AABB (header).
+//              Error <= 0.5 * Extent / 65535 per axis.
+// - Velocity:  octahedral unit direction (2 x snorm16) + half-precision magnitude.
+//              Direction error <= DirectionErrorBound (radians), magnitude relative
+//              error <= SpeedRelativeErrorBound (speeds above 65504 cm/s saturate).
+// - ParticleID exact; SourceID 16 bits (-1 preserved); NeighborCount saturates at 255;
+//   Flags keep the low 8 bits (all EGPUParticleFlags).
+//
+// The Encode* functions are a CPU reference of the shader, used for round-trip tests.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/Float16.h"
+#include "GPU/GPUFluidParticle.h"
+
+namespace GPUQuantizedReadback
+{
+	/** Smallest bounds extent used for quantization (must match MIN_EXTENT in the shader) */
+	constexpr float MinExtent = 0.001f;
+
+	/** Largest encodable speed (largest finite half) */
+	constexpr float MaxSpeed = 65504.0f;
+
+	/** Saturation value of the packed neighbor count */
+	constexpr uint32 MaxNeighborCount = 255;
+
+	/** Bits of EGPUParticleFlags carried by the packed record */
+	constexpr uint32 FlagsMask = 0xFF;
+
+	/** Max angle (radians) between decoded and original velocity direction */
+	constexpr float DirectionErrorBound = 1.0e-4f;
+
+	/** Max relative error of the decoded speed (half: 10 stored significand bits; also holds if f32tof16 truncates) */
+	constexpr float SpeedRelativeErrorBound = 1.0f / 1024.0f;
+
+	/** Byte offset of particle i in the readback buffer */
+	FORCEINLINE constexpr uint32 GetRecordOffset(int32 ParticleIndex)
+	{
+		return sizeof(FQuantizedReadbackHeader) + static_cast<uint32>(ParticleIndex) * sizeof(FQuantizedParticleStats);
+	}
+
+	/** Readback buffer size for a particle count */
+	FORCEINLINE constexpr uint32 GetBufferSize(int32 ParticleCount)
+	{
+		return GetRecordOffset(ParticleCount);
+	}
+
+	/** Decoded header: bounds and dequantization step */
+	struct FBounds
+	{
+		FVector3f Min = FVector3f::ZeroVector;
+		FVector3f Max = FVector3f::ZeroVector;
+		FVector3f Step = FVector3f::ZeroVector;    // Extent / 65535
+		int32 ParticleCount = 0;
+
+		bool IsValid() const { return ParticleCount > 0 && Min.X <= Max.X && Min.Y <= Max.Y && Min.Z <= Max.Z; }
+
+		/** Max absolute per-axis position error */
+		FVector3f GetPositionErrorBound() const { return Step * 0.5f; }
+	};
+
+	/** Order-preserving float -> uint (matches shader) */
+	FORCEINLINE uint32 FloatToOrderedUint(float Value)
+	{
+		uint32 Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+		return (Bits & 0x80000000u) ? ~Bits : (Bits | 0x80000000u);
+	}
+
+	FORCEINLINE float OrderedUintToFloat(uint32 Ordered)
+	{
+		const uint32 Bits = (Ordered & 0x80000000u) ? (Ordered & 0x7FFFFFFFu) : ~Ordered;
+		float Value;
+		FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+		return Value;
+	}
+
+	/** Build FBounds from explicit min/max (extent clamped like the shader) */
+	KAWAIIFLUIDRUNTIME_API FBounds MakeBounds(const FVector3f& Min, const FVector3f& Max, int32 ParticleCount);
+
+	/** Decode the readback header */
+	KAWAIIFLUIDRUNTIME_API FBounds DecodeHeader(const FQuantizedReadbackHeader& Header);
+
+	/** Unit vector -> [-1, 1]^2 */
+	KAWAIIFLUIDRUNTIME_API FVector2f OctEncode(const FVector3f& Direction);
+
+	/** [-1, 1]^2 -> unit vector */
+	KAWAIIFLUIDRUNTIME_API FVector3f OctDecode(const FVector2f& Encoded);
+
+	FORCEINLINE FVector3f DecodePosition(const FQuantizedParticleStats& Packed, const FBounds& Bounds)
+	{
+		return FVector3f(
+			Bounds.Min.X + static_cast<float>(Packed.PositionXY & 0xFFFF) * Bounds.Step.X,
+			Bounds.Min.Y + static_cast<float>(Packed.PositionXY >> 16) * Bounds.Step.Y,
+			Bounds.Min.Z + static_cast<float>(Packed.PositionZSpeed & 0xFFFF) * Bounds.Step.Z);
+	}
+
+	FORCEINLINE float DecodeSpeed(const FQuantizedParticleStats& Packed)
+	{
+		FFloat16 Speed;
+		Speed.Encoded = static_cast<uint16>(Packed.PositionZSpeed >> 16);
+		return Speed.GetFloat();
+	}
+
+	KAWAIIFLUIDRUNTIME_API FVector3f DecodeVelocity(const FQuantizedParticleStats& Packed);
+
+	FORCEINLINE int32 DecodeSourceID(const FQuantizedParticleStats& Packed)
+	{
+		const uint32 Bits = Packed.SourceNeighborFlags & 0xFFFF;
+		return Bits == 0xFFFF ? EGPUParticleSource::InvalidSourceID : static_cast<int32>(Bits);
+	}
+
+	FORCEINLINE uint32 DecodeNeighborCount(const FQuantizedParticleStats& Packed)
+	{
+		return (Packed.SourceNeighborFlags >> 16) & 0xFF;
+	}
+
+	FORCEINLINE uint32 DecodeFlags(const FQuantizedParticleStats& Packed)
+	{
+		return Packed.SourceNeighborFlags >> 24;
+	}
+
+	/** CPU reference of ReduceQuantizeBoundsCS + InitQuantizeHeaderCS */
+	KAWAIIFLUIDRUNTIME_API FQuantizedReadbackHeader EncodeHeader(TConstArrayView<FGPUFluidParticle> Particles);
+
+	/** CPU reference of EncodeQuantizedCS */
+	KAWAIIFLUIDRUNTIME_API FQuantizedParticleStats EncodeParticle(const FGPUFluidParticle& Particle, const FBounds& Bounds);
+}
@@ -0,0 +1,75 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GlobalShader.h"
+#include "ShaderParameterStruct.h"
+#include "RenderGraphResources.h"
+#include "GPU/GPUFluidParticle.h"
+
+//=============================================================================
+// Splash Compaction Compute Shaders
+// Pass 1 sums splash candidate weights, pass 2 appends an importance-sampled
+// candidate list (see FluidSplashCompact.usf and FKawaiiFluidSplashSelector)
+//=============================================================================
+
+BEGIN_SHADER_PARAMETER_STRUCT(FSplashCompactParameters, )
+	SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FGPUFluidParticle>, Particles)
+	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
+	SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, SplashBuffer)
+	SHADER_PARAMETER(uint32, ConditionMode)
+	SHADER_PARAMETER(float, VelocityThreshold)
+	SHADER_PARAMETER(uint32, IsolationNeighborThreshold)
+	SHADER_PARAMETER(uint32, MaxCandidates)
+	SHADER_PARAMETER(float, TargetCount)
+	SHADER_PARAMETER(uint32, FrameIndex)
+END_SHADER_PARAMETER_STRUCT()
+
+class FSplashWeightCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FSplashWeightCS);
+	SHADER_USE_PARAMETER_STRUCT(FSplashWeightCS, FGlobalShader);
+
+	using FParameters = FSplashCompactParameters;
+
+	static constexpr int32 ThreadGroupSize = 256;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters,
+		FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREAD_GROUP_SIZE"), ThreadGroupSize);
+	}
+};
+
+class FSplashCompactCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FSplashCompactCS);
+	SHADER_USE_PARAMETER_STRUCT(FSplashCompactCS, FGlobalShader);
+
+	using FParameters = FSplashCompactParameters;
+
+	static constexpr int32 ThreadGroupSize = 256;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters,
+		FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREAD_GROUP_SIZE"), ThreadGroupSize);
+	}
+};
@@ -60,6 +60,7 @@ namespace EGPUParticleFlags
 	constexpr uint32 HasCollided = 1 << 4;       // Particle collided this frame
 	constexpr uint32 IsSleeping = 1 << 5;        // Particle is in sleep state (low velocity)
 	constexpr uint32 NearBoundary = 1 << 6;      // Particle is near boundary (for visualization, doesn't skip physics)
+	constexpr uint32 WasIsolated = 1 << 7;       // Particle was isolated at the last splash detection (state change tracking)
 }
 
 /**
@@ -69,7 +70,7 @@ namespace EGPUParticleFlags
 namespace EGPUParticleSource
 {
 	constexpr int32 InvalidSourceID = -1;
-	constexpr int32 MaxSourceCount = 64;  // Maximum number of unique sources (components) for GPU counter tracking
+	constexpr int32 MaxSourceCount = 65535;  // Maximum number of unique sources (16-bit in packed readbacks, 0xFFFF = invalid)
 }
 
 /** Check if SourceID is valid */
@@ -393,6 +394,24 @@ struct FGPUHeightmapCollisionParams
 };
 static_assert(sizeof(FGPUHeightmapCollisionParams) == 80, "FGPUHeightmapCollisionParams must be 80 bytes");
 
+/**
+ * World SDF Brick Collision Parameters
+ * Response of the static world geometry baked into FKawaiiFluidSDFCache bricks
+ */
+struct FGPUSDFBrickCollisionParams
+{
+	int32 bEnabled;               // Whether SDF brick collision is enabled
+	float Friction;               // Friction coefficient (0-1)
+	float Restitution;            // Bounciness (0-1)
+
+	FGPUSDFBrickCollisionParams()
+		: bEnabled(0)
+		, Friction(0.3f)
+		, Restitution(0.1f)
+	{
+	}
+};
+
 //=============================================================================
 // GPU Collision Primitives
 // Uploaded from FluidCollider system for GPU-based collision detection
@@ -701,7 +720,7 @@ struct FGPUCollisionFeedback
 	int32 ParticleSourceID;       // 4 bytes - Particle SourceID (ComponentIndex)
 	int32 ParticleActorID;        // 4 bytes - Particle source actor ID (optional)
 	int32 BoneIndex;              // 4 bytes - Bone index for per-bone force calculation (-1 = no bone)
-	int32 Padding1;               // 4 bytes - Alignment padding
+	int32 ParticleID;             // 4 bytes - Stable particle ID (ParticleIndex is the sorted slot)
 
 	// Row 5 (16 bytes) - Bone-local impact offset (for precise effect placement)
 	FVector3f ImpactOffset;       // 12 bytes - Impact position in bone-local space
@@ -723,7 +742,7 @@ struct FGPUCollisionFeedback
 		, ParticleSourceID(EGPUParticleSource::InvalidSourceID)
 		, ParticleActorID(0)
 		, BoneIndex(-1)
-		, Padding1(0)
+		, ParticleID(-1)
 		, ImpactOffset(FVector3f::ZeroVector)
 		, Padding2(0)
 		, ParticlePosition(FVector3f::ZeroVector)
@@ -787,7 +806,7 @@ struct FGPUCollisionPrimitives
  * Memory Layout:
  *   [0-15]   Position, Radius
  *   [16-31]  Velocity, Mass
- *   [32-47]  SourceID, Reserved (NEW)
+ *   [32-47]  SourceID, ActorID, ParticleID, Reserved
  */
 struct FGPUSpawnRequest
 {
@@ -802,7 +821,7 @@ struct FGPUSpawnRequest
 	// Row 3 (16 bytes) - NEW: Source identification
 	int32 SourceID;           // 4 bytes  - Source identification (PresetIndex | ComponentIndex << 16)
 	int32 ActorID;            // 4 bytes  - Source actor ID (optional)
-	int32 Reserved1;          // 4 bytes
+	int32 ParticleID;         // 4 bytes  - Explicit particle ID (-1 = assign from NextParticleID)
 	int32 Reserved2;          // 4 bytes
 
 	FGPUSpawnRequest()
@@ -812,7 +831,7 @@ struct FGPUSpawnRequest
 		, Mass(1.0f)
 		, SourceID(EGPUParticleSource::InvalidSourceID)
 		, ActorID(0)
-		, Reserved1(0)
+		, ParticleID(-1)
 		, Reserved2(0)
 	{
 	}
@@ -824,7 +843,7 @@ struct FGPUSpawnRequest
 		, Mass(InMass)
 		, SourceID(EGPUParticleSource::InvalidSourceID)
 		, ActorID(0)
-		, Reserved1(0)
+		, ParticleID(-1)
 		, Reserved2(0)
 	{
 	}
@@ -836,7 +855,7 @@ struct FGPUSpawnRequest
 		, Mass(InMass)
 		, SourceID(InSourceID)
 		, ActorID(0)
-		, Reserved1(0)
+		, ParticleID(-1)
 		, Reserved2(0)
 	{
 	}
@@ -1370,3 +1389,119 @@ struct FCompactParticleStatsEx
 	}
 };
 static_assert(sizeof(FCompactParticleStatsEx) == 48, "FCompactParticleStatsEx must be 48 bytes");
+
+//=============================================================================
+// Quantized Particle Stats (for bandwidth-reduced GPU→CPU Readback)
+// 20 bytes per particle instead of 64 (full) / 48 (extended compact)
+// Decoded on CPU by GPUQuantizedReadback (FluidQuantizedReadback.h)
+//=============================================================================
+
+/** Layout of a stats readback buffer */
+enum class EGPUStatsReadbackFormat : uint8
+{
+	Full,       // FGPUFluidParticle (64 bytes)
+	Compact,    // FCompactParticleStats (32 bytes, no velocity)
+	Quantized   // FQuantizedReadbackHeader + FQuantizedParticleStats (20 bytes)
+};
+
+/**
+ * Quantized Readback Header (32 bytes, at offset 0 of the quantized readback buffer)
+ * Bounds are reduced on GPU in the same frame, stored as order-preserving uints
+ * (min as-is, max inverted so both reduce with InterlockedMin)
+ * Must match HLSL layout in FluidQuantizeReadback.usf
+ */
+struct FQuantizedReadbackHeader
+{
+	uint32 OrderedMin[3];       // 12 bytes - FloatToOrderedUint(BoundsMin)
+	uint32 InvOrderedMax[3];    // 12 bytes - ~FloatToOrderedUint(BoundsMax) (total: 24)
+	uint32 ParticleCount;       // 4 bytes  - GPU particle count at encode time
+	uint32 Padding;             // 4 bytes  - (total: 32)
+};
+static_assert(sizeof(FQuantizedReadbackHeader) == 32, "FQuantizedReadbackHeader must be 32 bytes");
+
+/**
+ * Quantized Particle Stats Structure (20 bytes)
+ * Must match HLSL packing in FluidQuantizeReadback.usf
+ *
+ * Memory Layout (20 bytes):
+ *   PositionXY          (4 bytes) - unorm16 X | unorm16 Y << 16 (bounds-relative)
+ *   PositionZSpeed      (4 bytes) - unorm16 Z | half(|Velocity|) << 16
+ *   VelocityOct         (4 bytes) - snorm16 U | snorm16 V << 16 (octahedral direction)
+ *   ParticleID          (4 bytes) - int32 (exact)
+ *   SourceNeighborFlags (4 bytes) - SourceID & 0xFFFF | min(NeighborCount, 255) << 16 | Flags & 0xFF << 24
+ */
+struct FQuantizedParticleStats
+{
+	uint32 PositionXY;
+	uint32 PositionZSpeed;
+	uint32 VelocityOct;
+	int32 ParticleID;
+	uint32 SourceNeighborFlags;
+};
+static_assert(sizeof(FQuantizedParticleStats) == 20, "FQuantizedParticleStats must be 20 bytes");
+
+//=============================================================================
+// Splash Candidate (GPU splash compaction output)
+//=============================================================================
+
+/**
+ * Splash Candidate Structure (32 bytes)
+ * Written by FluidSplashCompact.usf after a 16-byte header (Count, TotalWeight, Reserved x2)
+ * Must match HLSL struct in FluidSplashCompact.usf
+ *
+ * Memory Layout (32 bytes):
+ *   Position      (12 bytes) - float3
+ *   Key           (4 bytes)  - float, weighted selection key (higher wins)
+ *   Velocity      (12 bytes) - float3
+ *   ParticleID    (4 bytes)  - int32
+ */
+struct FGPUSplashCandidate
+{
+	FVector3f Position;       // 12 bytes - Particle position
+	float Key;                // 4 bytes  - Selection key u^(1/Weight) (total: 16)
+	FVector3f Velocity;       // 12 bytes - Particle velocity (splash direction)
+	int32 ParticleID;         // 4 bytes  - Unique particle ID (total: 32)
+
+	FGPUSplashCandidate()
+		: Position(FVector3f::ZeroVector)
+		, Key(0.0f)
+		, Velocity(FVector3f::ZeroVector)
+		, ParticleID(0)
+	{
+	}
+};
+static_assert(sizeof(FGPUSplashCandidate) == 32, "FGPUSplashCandidate must be 32 bytes");
+
+/**
+ * Anisotropy History Structure (32 bytes)
+ * Per-particle record of the last anisotropy recompute, reordered with the particles by the Z-Order sort
+ * Must match HLSL struct FAnisotropyHistory in FluidAnisotropyCompute.usf
+ *
+ * Memory Layout (32 bytes):
+ *   RefPosition        (12 bytes) - float3, position at the last recompute
+ *   ParticleID         (4 bytes)  - int32, owner of the record (-1 = empty)
+ *   PrevIndex          (4 bytes)  - uint, slot in the previous anisotropy output
+ *   NeighborCount      (4 bytes)  - uint, solver neighbor count at the last recompute
+ *   FramesSinceUpdate  (4 bytes)  - uint, anisotropy passes since the last recompute
+ *   Padding            (4 bytes)
+ */
+struct FGPUAnisotropyHistory
+{
+	FVector3f RefPosition;        // 12 bytes - Position at the last recompute
+	int32 ParticleID;             // 4 bytes  - Owner particle (-1 = empty) (total: 16)
+	uint32 PrevIndex;             // 4 bytes  - Slot in the previous anisotropy output
+	uint32 NeighborCount;         // 4 bytes  - Neighbor count at the last recompute
+	uint32 FramesSinceUpdate;     // 4 bytes  - Passes since the last recompute
+	uint32 Padding;               // 4 bytes  (total: 32)
+
+	FGPUAnisotropyHistory()
+		: RefPosition(FVector3f::ZeroVector)
+		, ParticleID(-1)
+		, PrevIndex(0xFFFFFFFF)
+		, NeighborCount(0)
+		, FramesSinceUpdate(0)
+		, Padding(0)
+	{
+	}
+};
+static_assert(sizeof(FGPUAnisotropyHistory) == 32, "FGPUAnisotropyHistory must be 32 bytes");
@@ -14,8 +14,11 @@
 #include "GPU/Managers/GPUBoundarySkinningManager.h"
 #include "GPU/Managers/GPUAdhesionManager.h"
 #include "GPU/Managers/GPUStaticBoundaryManager.h"
+#include "GPU/Managers/GPUSplashManager.h"
 #include "GPU/GPUBoundaryAttachment.h"
+#include "GPU/GPUReadbackScheduler.h"
 #include "Core/FluidAnisotropy.h"
+#include "Core/KawaiiFluidParticleIdentity.h"
 #include <atomic>
 
 // Log category
@@ -379,6 +382,13 @@ public:
 	/** Check if anisotropy is enabled */
 	bool IsAnisotropyEnabled() const { return CachedAnisotropyParams.bEnabled; }
 
+	/** Check if anisotropy recomputes only particles whose neighborhood changed (DensityBased only) */
+	bool IsIncrementalAnisotropyEnabled() const
+	{
+		return CachedAnisotropyParams.bEnabled && CachedAnisotropyParams.bIncrementalUpdate
+			&& CachedAnisotropyParams.Mode == EFluidAnisotropyMode::DensityBased;
+	}
+
 	/** Get persistent anisotropy axis buffers (for rendering) */
 	TRefCountPtr<FRDGPooledBuffer> GetPersistentAnisotropyAxis1Buffer() const { return PersistentAnisotropyAxis1Buffer; }
 	TRefCountPtr<FRDGPooledBuffer> GetPersistentAnisotropyAxis2Buffer() const { return PersistentAnisotropyAxis2Buffer; }
@@ -417,6 +427,20 @@ public:
 	/** Check if Heightmap collision is enabled */
 	bool IsHeightmapCollisionEnabled() const { return CollisionManager.IsValid() && CollisionManager->IsHeightmapCollisionEnabled(); }
 
+	//=============================================================================
+	// World SDF Brick Collision (Delegated to FGPUCollisionManager)
+	// Static world geometry baked into FKawaiiFluidSDFCache bricks
+	//=============================================================================
+
+	/** Set SDF brick collision parameters (bEnabled selects bricks over world primitives) */
+	void SetSDFBrickCollisionParams(const FGPUSDFBrickCollisionParams& Params) { if (CollisionManager.IsValid()) CollisionManager->SetSDFBrickCollisionParams(Params); }
+
+	/** Upload SDF bricks */
+	void UploadSDFBricks(FKawaiiFluidSDFBrickData&& Data) { if (CollisionManager.IsValid()) CollisionManager->UploadSDFBricks(MoveTemp(Data)); }
+
+	/** Check if SDF brick collision is enabled */
+	bool IsSDFBrickCollisionEnabled() const { return CollisionManager.IsValid() && CollisionManager->IsSDFBrickCollisionEnabled(); }
+
 	// Collision Primitives (Delegated to FGPUCollisionManager)
 	//=============================================================================
 	//=============================================================================
@@ -716,7 +740,7 @@ public:
 	 * Add multiple spawn requests at once (thread-safe, more efficient than individual calls)
 	 * @param Requests - Array of spawn requests to add
 	 */
-	void AddSpawnRequests(const TArray<FGPUSpawnRequest>& Requests);
+	void AddSpawnRequests(TConstArrayView<FGPUSpawnRequest> Requests);
 
 	/**
 	 * Add GPU brush despawn request - removes particles within radius (thread-safe)
@@ -731,6 +755,12 @@ public:
 	 */
 	void AddGPUDespawnSourceRequest(int32 SourceID);
 
+	/**
+	 * Add GPU ID despawn requests - removes particles with matching ParticleIDs (thread-safe)
+	 * @param ParticleIDs - Particle IDs to despawn
+	 */
+	void AddGPUDespawnIDRequests(TConstArrayView<int32> ParticleIDs);
+
 	/**
 	 * Set per-source emitter max for GPU-driven recycling (thread-safe)
 	 * GPU automatically removes oldest particles to keep each source under its limit
@@ -745,9 +775,11 @@ public:
 	 * @param OutPositions - Output array of particle positions
 	 * @param OutParticleIDs - Output array of particle IDs (same index as positions)
 	 * @param OutSourceIDs - Output array of source IDs (same index as positions)
+	 * @param OutVelocities - Optional velocities from the same readback (empty if velocity readback is off)
 	 * @return true if valid data was copied
 	 */
-	bool GetParticlePositionsAndIDs(TArray<FVector3f>& OutPositions, TArray<int32>& OutParticleIDs, TArray<int32>& OutSourceIDs);
+	bool GetParticlePositionsAndIDs(TArray<FVector3f>& OutPositions, TArray<int32>& OutParticleIDs, TArray<int32>& OutSourceIDs,
+		TArray<FVector3f>* OutVelocities = nullptr);
 
 	/**
 	 * Lightweight API for ISM rendering - returns positions and velocities only
@@ -764,6 +796,18 @@ public:
 	 */
 	void SetFullReadbackEnabled(bool bEnabled) { bFullReadbackEnabled.store(bEnabled); }
 
+	/**
+	 * Enable/disable quantized stats readback (20 bytes per particle instead of 64/32)
+	 * Positions are quantized to 16 bits per axis within the particle AABB and velocities to
+	 * octahedral direction + half magnitude (see GPUQuantizedReadback for error bounds).
+	 * Detailed GPU stats always use the full-precision readback.
+	 */
+	void SetQuantizedReadbackEnabled(bool bEnabled) { bQuantizedReadbackEnabled.store(bEnabled); }
+	bool IsQuantizedReadbackEnabled() const { return bQuantizedReadbackEnabled.load(); }
+
+	/** Readback channels with per-channel latency / drop counters (render thread, null before Initialize) */
+	const FGPUReadbackScheduler* GetReadbackScheduler() const { return ReadbackScheduler.Get(); }
+
 	/**
 	 * Get particle IDs for a specific SourceID from cached readback data
 	 * Returns nullptr if no cached data or SourceID not found
@@ -780,6 +824,14 @@ public:
 	 */
 	const TArray<int32>* GetAllParticleIDs() const;
 
+	/**
+	 * Find the buffer slot of a particle in the cached readback data
+	 * Slots are permuted by every Z-Order sort; use this instead of storing indices across frames
+	 * @param ParticleID - Stable particle ID
+	 * @return Slot in the latest readback (same index as GetAllParticleIDs), or INDEX_NONE
+	 */
+	int32 FindParticleIndexByID(int32 ParticleID) const;
+
 	/**
 	 * Get particle flags from cached readback data
 	 * Returns nullptr if no cached data available
@@ -824,6 +876,9 @@ public:
 	 */
 	int32 AllocateParticleIDs(int32 Count) { return SpawnManager.IsValid() ? SpawnManager->AllocateParticleIDs(Count) : 0; }
 
+	/** Keep newly assigned IDs above ParticleID (before respawning particles with recorded IDs) */
+	void ReserveParticleIDsThrough(int32 ParticleID) { if (SpawnManager.IsValid()) SpawnManager->ReserveParticleIDsThrough(ParticleID); }
+
 	/**
 	 * Get the spawn manager (for per-source particle count tracking)
 	 */
@@ -851,7 +906,9 @@ private:
 		FRDGBufferUAVRef& OutPositionsUAV,
 		const FGPUFluidSimulationParams& Params,
 		// Optional: BoneDeltaAttachment buffer to reorder along with particles during Z-Order sorting
-		FRDGBufferRef* InOutAttachmentBuffer = nullptr);
+		FRDGBufferRef* InOutAttachmentBuffer = nullptr,
+		// Optional: Anisotropy history buffer to reorder along with particles during Z-Order sorting
+		FRDGBufferRef* InOutAnisotropyHistoryBuffer = nullptr);
 
 	/** Phase 3: Execute constraint solver loop (Density/Pressure + Collision per iteration)
 	 *  XPBD Principle: Collision constraints are solved inside the solver loop
@@ -976,6 +1033,12 @@ private:
 		const FSimulationSpatialData& SpatialData,
 		const FGPUFluidSimulationParams& Params);
 
+	/** Add SDF brick collision pass (static world geometry) */
+	void AddSDFBrickCollisionPass(
+		FRDGBuilder& GraphBuilder,
+		const FSimulationSpatialData& SpatialData,
+		const FGPUFluidSimulationParams& Params);
+
 	//-------------------------------------------------------------------------
 	// Collision Feedback Buffer Management (delegated to CollisionFeedbackManager)
 	//-------------------------------------------------------------------------
@@ -1048,6 +1111,17 @@ private:
 		FRDGBuilder& GraphBuilder,
 		int32 RequiredCapacity);
 
+	/**
+	 * Ensure the incremental anisotropy history buffer exists with sufficient capacity.
+	 * New records are empty (ParticleID = -1), so those particles are recomputed on the next pass.
+	 * @param GraphBuilder - RDG builder
+	 * @param RequiredCapacity - Minimum particle capacity required
+	 * @return RDG buffer reference for the history records
+	 */
+	FRDGBufferRef EnsureAnisotropyHistoryBuffer(
+		FRDGBuilder& GraphBuilder,
+		int32 RequiredCapacity);
+
 	/**
 	 * Add apply bone transform pass (runs at SIMULATION START)
 	 * Sets velocity for attached particles to follow bone movement naturally.
@@ -1118,7 +1192,10 @@ private:
 		const FGPUFluidSimulationParams& Params,
 		// Optional: BoneDeltaAttachment buffer to reorder along with particles
 		FRDGBufferRef InAttachmentBuffer = nullptr,
-		FRDGBufferRef* OutSortedAttachmentBuffer = nullptr);
+		FRDGBufferRef* OutSortedAttachmentBuffer = nullptr,
+		// Optional: Anisotropy history buffer to reorder along with particles
+		FRDGBufferRef InAnisotropyHistoryBuffer = nullptr,
+		FRDGBufferRef* OutSortedAnisotropyHistoryBuffer = nullptr);
 
 	//=============================================================================
 	// ParticleID Sorting for Readback Optimization
@@ -1178,6 +1255,10 @@ private:
 	// Cached all particle IDs (built during readback processing)
 	TArray<int32> CachedAllParticleIDs;
 
+	// ParticleID -> slot inverse of CachedAllParticleIDs (rebuilt lazily on first query)
+	mutable FKawaiiFluidParticleIDMap CachedParticleIDMap;
+	mutable bool bParticleIDMapDirty = true;
+
 	// Cached particle positions (always built during readback for lightweight despawn API)
 	TArray<FVector3f> CachedParticlePositions;
 
@@ -1197,6 +1278,9 @@ private:
 	// When true, CachedParticleVelocities is populated during ProcessStatsReadback
 	std::atomic<bool> bFullReadbackEnabled{false};
 
+	// When true, stats readback uses the quantized 20-byte encoding unless detailed stats need full data
+	std::atomic<bool> bQuantizedReadbackEnabled{true};
+
 	// Persistent GPU buffer - reused across frames (Phase 2)
 	// After simulation, this contains the results to be used next frame
 	TRefCountPtr<FRDGPooledBuffer> PersistentParticleBuffer;
@@ -1263,6 +1347,10 @@ private:
 	TRefCountPtr<FRDGPooledBuffer> PersistentRenderOffsetBuffer;  // Surface particle render offset
 	int32 AnisotropyFrameCounter = 0;  // Frame counter for UpdateInterval optimization
 
+	// Incremental anisotropy history (FGPUAnisotropyHistory per particle, sorted with particles)
+	TRefCountPtr<FRDGPooledBuffer> AnisotropyHistoryBuffer;
+	int32 AnisotropyHistoryCapacity = 0;
+
 	// Critical section for thread-safe buffer access
 	FCriticalSection BufferLock;
 
@@ -1298,11 +1386,11 @@ private:
 	/** GPU-authoritative particle count buffer for DispatchIndirect */
 	TRefCountPtr<FRDGPooledBuffer> PersistentParticleCountBuffer;
 
-	/** Triple-buffered async readback for GPU particle count → CPU CurrentParticleCount */
-	static constexpr int32 NUM_COUNT_READBACK_BUFFERS = 3;
-	FRHIGPUBufferReadback* CountReadbacks[NUM_COUNT_READBACK_BUFFERS] = { nullptr };
-	bool bCountReadbackValid[NUM_COUNT_READBACK_BUFFERS] = { false, false, false };
-	int32 CountReadbackWriteIndex = 0;
+	/** Readback channel for GPU particle count → CPU CurrentParticleCount (consumed by ReadbackScheduler) */
+	int32 CountReadbackChannel = INDEX_NONE;
+
+	/** Spawn batches not yet visible in a consumed count readback */
+	FGPUSpawnCountTracker SpawnCountTracker;
 
 	/** True once particles have ever existed (replaces CurrentParticleCount==0 early-out) */
 	bool bEverHadParticles = false;
@@ -1316,8 +1404,23 @@ private:
 	/** Enqueue async readback of PersistentParticleCountBuffer */
 	void EnqueueParticleCountReadback(FRHICommandListImmediate& RHICmdList);
 
-	/** Process completed readback → update CurrentParticleCount */
-	void ProcessParticleCountReadback();
+	/** Record a spawn batch so count readbacks taken before it add it on consume */
+	void RecordSpawnForCountReadback(int32 SpawnCount);
+
+	/** Drop count readbacks enqueued before the count was replaced wholesale (full upload) */
+	void ResetParticleCountReadback();
+
+	//=============================================================================
+	// Readback Scheduler
+	// Owns the ring-buffered GPU→CPU copies of count, stats, debug indices and bounds.
+	// Count, debug index and bounds channels are dispatched by one ProcessCompleted() per frame;
+	// the stats channel is driven by ProcessStatsReadback (conditional, large payload).
+	//=============================================================================
+
+	TUniquePtr<FGPUReadbackScheduler> ReadbackScheduler;
+
+	/** Create the scheduler and register channels + consumers */
+	void InitializeReadbackScheduler();
 
 	//=============================================================================
 	// Collision System (Delegated to FGPUCollisionManager)
@@ -1355,6 +1458,13 @@ private:
 
 	TUniquePtr<FGPUStaticBoundaryManager> StaticBoundaryManager;
 
+	//=============================================================================
+	// Splash Detection (Delegated to FGPUSplashManager)
+	// Compacts splash VFX candidates on the GPU, reads back only the small list
+	//=============================================================================
+
+	TUniquePtr<FGPUSplashManager> SplashManager;
+
 	//=============================================================================
 	// Bone Delta Attachment (NEW simplified bone-following system)
 	// Per-particle attachment data: BoneIndex, LocalOffset, PreviousPosition
@@ -1418,22 +1528,11 @@ private:
 	// Uses FRHIGPUBufferReadback for non-blocking readback (2-3 frame latency)
 	//=============================================================================
 
-	static constexpr int32 NUM_STATS_READBACK_BUFFERS = 3;  // Triple buffering
-
-	/** Async readback objects for full particle data (for ID-based operations) */
-	FRHIGPUBufferReadback* StatsReadbacks[NUM_STATS_READBACK_BUFFERS] = { nullptr };
-
-	/** Current write index for stats readback ring buffer */
-	int32 StatsReadbackWriteIndex = 0;
-
-	/** Frame number tracking for each stats readback buffer */
-	uint64 StatsReadbackFrameNumbers[NUM_STATS_READBACK_BUFFERS] = { 0 };
-
-	/** Particle count for each stats readback buffer */
-	int32 StatsReadbackParticleCounts[NUM_STATS_READBACK_BUFFERS] = { 0 };
-
-	/** Compact stats readback mode tracking (true = compact 32-byte, false = full 64-byte) */
-	bool bStatsReadbackCompactMode[NUM_STATS_READBACK_BUFFERS] = { false };
+	/**
+	 * Readback channel for particle data (for ID-based operations)
+	 * Slot Payload = particle count, UserFlags = EGPUStatsReadbackFormat (full 64-byte, compact 32-byte or quantized 20-byte)
+	 */
+	int32 StatsReadbackChannel = INDEX_NONE;
 
 	/** Persistent compact stats buffer for GPU extraction */
 	TRefCountPtr<FRDGPooledBuffer> PersistentCompactStatsBuffer;
@@ -1447,19 +1546,8 @@ private:
 	// Uses FRHIGPUBufferReadback for non-blocking readback (2-3 frame latency)
 	//=============================================================================
 
-	static constexpr int32 NUM_DEBUG_INDEX_READBACK_BUFFERS = 3;  // Triple buffering
-
-	/** Async readback objects for debug Z-Order array indices */
-	FRHIGPUBufferReadback* DebugIndexReadbacks[NUM_DEBUG_INDEX_READBACK_BUFFERS] = { nullptr };
-
-	/** Current write index for debug index readback ring buffer */
-	int32 DebugIndexReadbackWriteIndex = 0;
-
-	/** Frame number tracking for each debug index readback buffer */
-	uint64 DebugIndexReadbackFrameNumbers[NUM_DEBUG_INDEX_READBACK_BUFFERS] = { 0 };
-
-	/** Particle count for each debug index readback buffer */
-	int32 DebugIndexReadbackParticleCounts[NUM_DEBUG_INDEX_READBACK_BUFFERS] = { 0 };
+	/** Readback channel for debug Z-Order array indices (int32 per particle) */
+	int32 DebugIndexReadbackChannel = INDEX_NONE;
 
 	/** Persistent GPU buffer for debug Z-Order array indices (int32 per particle) */
 	TRefCountPtr<FRDGPooledBuffer> PersistentDebugZOrderIndexBuffer;
@@ -1479,16 +1567,8 @@ private:
 	// Uses FRHIGPUBufferReadback for non-blocking readback (2-3 frame latency)
 	//=============================================================================
 
-	static constexpr int32 NUM_PARTICLE_BOUNDS_READBACK_BUFFERS = 3;  // Triple buffering
-
-	/** Async readback objects for particle bounds (2 × FVector3f: Min, Max) */
-	FRHIGPUBufferReadback* ParticleBoundsReadbacks[NUM_PARTICLE_BOUNDS_READBACK_BUFFERS] = { nullptr };
-
-	/** Current write index for particle bounds readback ring buffer */
-	int32 ParticleBoundsReadbackWriteIndex = 0;
-
-	/** Frame number tracking for each particle bounds readback buffer */
-	uint64 ParticleBoundsReadbackFrameNumbers[NUM_PARTICLE_BOUNDS_READBACK_BUFFERS] = { 0 };
+	/** Readback channel for particle bounds (2 × FVector3f: Min, Max) */
+	int32 ParticleBoundsReadbackChannel = INDEX_NONE;
 
 	/** Cached particle bounds (AABB from GPU readback) */
 	FBox CachedParticleBounds;
@@ -1636,6 +1716,35 @@ public:
 	 */
 	bool GetShadowNeighborCounts(TArray<int32>& OutNeighborCounts) const;
 
+	//=============================================================================
+	// Splash Candidate API (Delegated to FGPUSplashManager)
+	// Splash detection runs on the GPU; no shadow/particle readback is required
+	//=============================================================================
+
+	/**
+	 * Enable or disable GPU splash detection
+	 * @param bEnabled - true to run the splash compaction passes each frame
+	 * @param Settings - Condition mode, thresholds and per-frame budget
+	 */
+	void SetSplashDetection(bool bEnabled, const FKawaiiFluidSplashSettings& Settings)
+	{
+		if (SplashManager.IsValid())
+		{
+			SplashManager->SetSettings(Settings);
+			SplashManager->SetEnabled(bEnabled);
+		}
+	}
+
+	/**
+	 * Take the splash candidates of the latest finished readback (non-blocking)
+	 * @param OutCandidates - Selected candidates (at most the configured budget)
+	 * @return true if new candidates were available
+	 */
+	bool ConsumeSplashCandidates(TArray<FGPUSplashCandidate>& OutCandidates)
+	{
+		return SplashManager.IsValid() && SplashManager->ConsumeCandidates(OutCandidates);
+	}
+
 	//=============================================================================
 	// Debug Z-Order Array Index API (for visualization)
 	// Returns array indices after Z-Order sort, before ParticleID re-sort
@@ -1684,14 +1793,8 @@ void ReleaseAnisotropyReadbackObjects();
 	// Stats/Recycle Readback Internal Functions
 	//=============================================================================
 
-	/** Allocate stats readback objects */
-	void AllocateStatsReadbackObjects(FRHICommandListImmediate& RHICmdList);
-
-	/** Release stats readback objects */
-	void ReleaseStatsReadbackObjects();
-
-	/** Enqueue stats readback (full 64-byte or compact 32-byte particle data for ID-based operations) */
-	void EnqueueStatsReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer, int32 ParticleCount, bool bCompactMode = false);
+	/** Enqueue stats readback (full 64-byte, compact 32-byte or quantized 20-byte particle data for ID-based operations) */
+	void EnqueueStatsReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer, int32 ParticleCount, EGPUStatsReadbackFormat Format = EGPUStatsReadbackFormat::Full);
 
 	/** Process stats readback (check for completion, populate cached lightweight data) */
 	void ProcessStatsReadback(FRHICommandListImmediate& RHICmdList);
@@ -1700,17 +1803,11 @@ void ReleaseAnisotropyReadbackObjects();
 	// Debug Z-Order Index Readback Internal Functions
 	//=============================================================================
 
-	/** Allocate debug Z-Order index readback objects */
-	void AllocateDebugIndexReadbackObjects(FRHICommandListImmediate& RHICmdList);
-
-	/** Release debug Z-Order index readback objects */
-	void ReleaseDebugIndexReadbackObjects();
-
 	/** Enqueue debug Z-Order index readback (int32 array: [ParticleID] → ZOrderArrayIndex) */
 	void EnqueueDebugIndexReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer, int32 ParticleCount);
 
-	/** Process debug Z-Order index readback (check for completion, populate CachedZOrderArrayIndices) */
-	void ProcessDebugIndexReadback();
+	/** Consume a completed debug Z-Order index readback (populate CachedZOrderArrayIndices) */
+	void ConsumeDebugIndexReadback(TConstArrayView<int32> IndexData, const FGPUReadbackSlotInfo& Info);
 
 	/** Add RDG pass to record Z-Order array indices (call BEFORE ParticleID re-sort) */
 	void AddRecordZOrderIndicesPass(FRDGBuilder& GraphBuilder, FRDGBufferRef ParticleBuffer, int32 ParticleCount);
@@ -1719,12 +1816,6 @@ void ReleaseAnisotropyReadbackObjects();
 	// Particle Bounds Readback Internal Functions
 	//=============================================================================
 
-	/** Allocate particle bounds readback objects */
-	void AllocateParticleBoundsReadbackObjects(FRHICommandListImmediate& RHICmdList);
-
-	/** Release particle bounds readback objects */
-	void ReleaseParticleBoundsReadbackObjects();
-
-	/** Process particle bounds readback (check for completion, populate CachedParticleBounds) */
-	void ProcessParticleBoundsReadback();
+	/** Consume a completed particle bounds readback (populate CachedParticleBounds) */
+	void ConsumeParticleBoundsReadback(TConstArrayView<FVector3f> BoundsData, const FGPUReadbackSlotInfo& Info);
 };
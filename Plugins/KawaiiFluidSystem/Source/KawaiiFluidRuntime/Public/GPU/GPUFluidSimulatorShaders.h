@@ -255,8 +255,29 @@ public:
 	DECLARE_GLOBAL_SHADER(FSolveDensityPressureCS);
 	SHADER_USE_PARAMETER_STRUCT(FSolveDensityPressureCS, FGlobalShader);
 
-	// Permutation domain for grid resolution (Z-Order neighbor search)
-	using FPermutationDomain = TShaderPermutationDomain<FGridResolutionDim>;
+	// Feature permutations: a disabled feature is compiled out of the neighbor loops
+	// instead of being evaluated per neighbor with a zero coefficient
+	class FTensileInstabilityDim : SHADER_PERMUTATION_BOOL("USE_TENSILE_INSTABILITY");
+	class FSurfaceTensionDim : SHADER_PERMUTATION_BOOL("USE_POSITION_BASED_SURFACE_TENSION");
+	class FBoundaryDensityDim : SHADER_PERMUTATION_BOOL("USE_BOUNDARY_DENSITY");
+
+	// Permutation domain for grid resolution (Z-Order neighbor search) and feature set
+	using FPermutationDomain = TShaderPermutationDomain<FGridResolutionDim, FTensileInstabilityDim, FSurfaceTensionDim, FBoundaryDensityDim>;
+
+	/**
+	 * Pick the feature permutation for the current parameters
+	 * @param GridPermutation FGridResolutionDim value
+	 * @param bHasBoundaryParticles A boundary particle buffer is bound for this dispatch
+	 */
+	static FPermutationDomain SelectPermutation(const FGPUFluidSimulationParams& Params, int32 GridPermutation, bool bHasBoundaryParticles)
+	{
+		FPermutationDomain PermutationVector;
+		PermutationVector.Set<FGridResolutionDim>(GridPermutation);
+		PermutationVector.Set<FTensileInstabilityDim>(Params.bEnableTensileInstability != 0 && Params.TensileK > 0.0f);
+		PermutationVector.Set<FSurfaceTensionDim>(Params.bEnablePositionBasedSurfaceTension != 0 && Params.SurfaceTensionStrength > 0.0f);
+		PermutationVector.Set<FBoundaryDensityDim>(bHasBoundaryParticles);
+		return PermutationVector;
+	}
 
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
 		// SoA (Structure of Arrays) Particle Buffers
@@ -588,6 +609,55 @@ public:
 	}
 };
 
+//=============================================================================
+// SDF Brick Collision Compute Shader
+// Apply collision with static world geometry baked into sparse SDF bricks
+// One hashed brick lookup + trilinear sample per particle
+//=============================================================================
+
+class FSDFBrickCollisionCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FSDFBrickCollisionCS);
+	SHADER_USE_PARAMETER_STRUCT(FSDFBrickCollisionCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		// Particle SOA buffers
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<float>, Positions)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<float>, PredictedPositions)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint2>, PackedVelocities)  // B plan: half3 packed
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, Flags)
+		SHADER_PARAMETER(int32, ParticleCount)
+
+		// Brick data
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<int4>, BrickTable)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float>, BrickSamples)
+		SHADER_PARAMETER(uint32, BrickTableMask)
+		SHADER_PARAMETER(float, InvVoxelSize)
+
+		// Collision response parameters
+		SHADER_PARAMETER(float, CollisionThreshold)
+		SHADER_PARAMETER(float, Friction)
+		SHADER_PARAMETER(float, Restitution)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static constexpr int32 ThreadGroupSize = 256;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters,
+		FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREAD_GROUP_SIZE"), ThreadGroupSize);
+	}
+};
+
 //=============================================================================
 // Primitive Collision Compute Shader
 // Pass 6.5: Apply collision with explicit primitives (spheres, capsules, boxes, convexes)
@@ -607,6 +677,7 @@ public:
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint2>, PackedVelocities)  // B plan: half3 packed
 		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<uint>, PackedDensityLambda)  // B plan: half2 packed
 		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<int>, SourceIDs)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<int>, ParticleIDs)
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, Flags)
 		SHADER_PARAMETER(int32, ParticleCount)
 		SHADER_PARAMETER(float, ParticleRadius)
@@ -1001,7 +1072,36 @@ public:
 	}
 };
 
-// Oldest despawn Pass 1: Build 256-bucket histogram of ParticleID upper bits
+// ID-based despawn: marks particles whose ParticleID is in a sorted list (brush stroke undo/redo)
+class FMarkDespawnByIDCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FMarkDespawnByIDCS);
+	SHADER_USE_PARAMETER_STRUCT(FMarkDespawnByIDCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<int>, DespawnParticleIDs)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGPUFluidParticle>, Particles)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, OutAliveMask)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
+		SHADER_PARAMETER(int32, DespawnParticleIDCount)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static constexpr int32 ThreadGroupSize = 256;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREAD_GROUP_SIZE"), ThreadGroupSize);
+	}
+};
+
+// Oldest despawn Pass 1: Build a 256-bucket histogram of ParticleID upper bits per recycled source
 class FBuildIDHistogramCS : public FGlobalShader
 {
 public:
@@ -1013,7 +1113,7 @@ public:
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, IDHistogram)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, PerSourceExcess)
-		SHADER_PARAMETER(int32, FilterSourceID)
+		SHADER_PARAMETER(int32, SourceCount)
 		SHADER_PARAMETER(int32, IDShiftBits)
 	END_SHADER_PARAMETER_STRUCT()
 
@@ -1031,7 +1131,7 @@ public:
 	}
 };
 
-// Oldest despawn Pass 2: Find threshold bucket via prefix sum (single thread)
+// Oldest despawn Pass 2: Find each source's threshold bucket via prefix sum (one thread per source)
 class FFindOldestThresholdCS : public FGlobalShader
 {
 public:
@@ -1044,9 +1144,11 @@ public:
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, OldestThreshold)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, PerSourceExcess)
-		SHADER_PARAMETER(int32, FilterSourceID)
+		SHADER_PARAMETER(int32, SourceCount)
 	END_SHADER_PARAMETER_STRUCT()
 
+	static constexpr int32 ThreadGroupSize = 64;
+
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
 	{
 		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
@@ -1068,7 +1170,7 @@ public:
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, BoundaryCounter)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, PerSourceExcess)
-		SHADER_PARAMETER(int32, FilterSourceID)
+		SHADER_PARAMETER(int32, SourceCount)
 		SHADER_PARAMETER(int32, IDShiftBits)
 	END_SHADER_PARAMETER_STRUCT()
 
@@ -1101,6 +1203,8 @@ public:
 		SHADER_PARAMETER(int32, ActiveSourceCount)
 	END_SHADER_PARAMETER_STRUCT()
 
+	static constexpr int32 ThreadGroupSize = 64;
+
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
 	{
 		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
@@ -1737,6 +1841,9 @@ public:
 		SHADER_PARAMETER(FVector3f, BoundaryAABBMin)
 		SHADER_PARAMETER(FVector3f, BoundaryAABBMax)
 		SHADER_PARAMETER(int32, bUseBoundaryAABBCulling)
+		// Tabulated kernel shapes (FSPHKernelTable::GetShapeData layout)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float>, KernelTable)
+		SHADER_PARAMETER(int32, KernelTableResolution)
 		// Attached particle counter for GPU readback (statistics/logging)
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, AttachedParticleCount)
 	END_SHADER_PARAMETER_STRUCT()
@@ -2187,6 +2294,10 @@ public:
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGPUBoneDeltaAttachment>, OldBoneDeltaAttachments)
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FGPUBoneDeltaAttachment>, SortedBoneDeltaAttachments)
 		SHADER_PARAMETER(int32, bReorderAttachments)
+		// Optional: Anisotropy history reordering (incremental anisotropy)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGPUAnisotropyHistory>, OldAnisotropyHistory)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FGPUAnisotropyHistory>, SortedAnisotropyHistory)
+		SHADER_PARAMETER(int32, bReorderAnisotropyHistory)
 		SHADER_PARAMETER(int32, ParticleCount)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
 	END_SHADER_PARAMETER_STRUCT()
@@ -63,6 +63,10 @@ struct FSimulationSpatialData
 	FRDGBufferUAVRef BoneDeltaAttachmentUAV = nullptr;
 	FRDGBufferSRVRef BoneDeltaAttachmentSRV = nullptr;
 
+	// Incremental anisotropy history (sorted with particles, written by the anisotropy pass)
+	// Created by EnsureAnisotropyHistoryBuffer when FFluidAnisotropyParams::bIncrementalUpdate is set
+	FRDGBufferRef AnisotropyHistoryBuffer = nullptr;
+
 	// SoA (Structure of Arrays) Particle Buffers (Memory Bandwidth Optimization)
 	// Split after BuildSpatialStructures, Merge after PostSimulation
 	//
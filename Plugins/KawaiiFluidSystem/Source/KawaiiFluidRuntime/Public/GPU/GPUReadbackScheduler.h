@@ -0,0 +1,424 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// GPU -> CPU Readback Scheduler
+//
+// Shared ring state machine for async buffer readbacks (count, bounds, stats, debug indices).
+//
+// - FGPUReadbackRing:          slot bookkeeping only (no RHI), unit-testable on the CPU
+// - TGPUReadbackChannel<T>:    ring + lazily created staging objects (FRHIGPUBufferReadback or a mock)
+// - TGPUReadbackScheduler<T>:  owns channels, polls them once per frame and dispatches to typed consumers
+//
+// Ordering rules (replace the per-channel "newest ready" searches):
+// - Only the newest completed copy is consumed; older completed copies are dropped (superseded)
+// - A copy that completes after a newer one was consumed is dropped (never goes back in time)
+// - Invalidate() starts a new epoch: copies enqueued before it are dropped when they complete
+//   (e.g. a CPU-side count replaced wholesale by a full upload)
+// - Counts that the CPU only adds to (spawns) are reconciled by FGPUSpawnCountTracker instead,
+//   so GPU-side removals between spawns still reach the CPU
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+/** Lifecycle of a ring slot */
+enum class EGPUReadbackSlotState : uint8
+{
+	Free,       // Staging object idle (or never used)
+	InFlight,   // Copy enqueued, waiting for the GPU
+	Acquired    // Newest ready copy handed to the consumer (locked until Release)
+};
+
+/** Bookkeeping of one enqueued copy */
+struct FGPUReadbackSlotInfo
+{
+	/** Per-channel enqueue order (1-based, monotonically increasing) */
+	uint64 Sequence = 0;
+
+	/** Render frame the copy was enqueued on */
+	uint64 FrameNumber = 0;
+
+	/** Channel epoch at enqueue time */
+	uint32 Epoch = 0;
+
+	/** Copied bytes */
+	uint32 NumBytes = 0;
+
+	/** Producer value stored with the copy (e.g. particle count) */
+	int32 Payload = 0;
+
+	/** Producer flags stored with the copy (e.g. buffer layout) */
+	uint32 UserFlags = 0;
+
+	EGPUReadbackSlotState State = EGPUReadbackSlotState::Free;
+};
+
+/** Per-channel counters */
+struct FGPUReadbackChannelStats
+{
+	uint64 NumEnqueued = 0;
+	uint64 NumConsumed = 0;
+
+	/** Completed copies dropped because a newer one was consumed */
+	uint64 NumSuperseded = 0;
+
+	/** Completed copies dropped because they predate Invalidate() */
+	uint64 NumInvalidated = 0;
+
+	/** In-flight copies replaced because every slot was busy */
+	uint64 NumOverwritten = 0;
+
+	/** Frames between enqueue and consume */
+	uint64 LastLatencyFrames = 0;
+	uint64 MaxLatencyFrames = 0;
+	float AverageLatencyFrames = 0.0f;
+};
+
+/**
+ * FGPUReadbackRing
+ *
+ * Slot state machine of one readback channel. Readiness is supplied by the caller,
+ * so the same logic drives FRHIGPUBufferReadback and CPU-side mocks.
+ * Render thread only.
+ */
+class KAWAIIFLUIDRUNTIME_API FGPUReadbackRing
+{
+public:
+	static constexpr int32 DefaultNumSlots = 3;  // Triple buffering
+
+	explicit FGPUReadbackRing(int32 InNumSlots = DefaultNumSlots);
+
+	/**
+	 * Reserve a slot for a new copy.
+	 * Prefers a free slot; otherwise recycles the oldest in-flight slot.
+	 * @return Slot index, or INDEX_NONE if every slot is acquired
+	 */
+	int32 BeginWrite(uint64 FrameNumber, uint32 NumBytes, int32 Payload = 0, uint32 UserFlags = 0);
+
+	/**
+	 * Acquire the newest completed copy of the current epoch.
+	 * Completed copies that are older, stale or superseded are freed.
+	 * @param IsSlotReady - bool(int32 Slot), true once the GPU copy of that slot finished
+	 * @return Acquired slot (must be passed to Release), or INDEX_NONE
+	 */
+	template<typename IsReadyFn>
+	int32 AcquireNewest(uint64 CurrentFrame, IsReadyFn&& IsSlotReady)
+	{
+		int32 Best = INDEX_NONE;
+		for (int32 Slot = 0; Slot < Slots.Num(); ++Slot)
+		{
+			if (Slots[Slot].State != EGPUReadbackSlotState::InFlight || !IsSlotReady(Slot))
+			{
+				continue;
+			}
+
+			if (!IsConsumable(Slots[Slot]))
+			{
+				DropCompleted(Slot);
+				continue;
+			}
+
+			if (Best == INDEX_NONE || Slots[Slot].Sequence > Slots[Best].Sequence)
+			{
+				if (Best != INDEX_NONE)
+				{
+					DropCompleted(Best);
+				}
+				Best = Slot;
+			}
+			else
+			{
+				DropCompleted(Slot);
+			}
+		}
+
+		if (Best != INDEX_NONE)
+		{
+			MarkAcquired(Best, CurrentFrame);
+		}
+		return Best;
+	}
+
+	/** Return an acquired slot to the free pool */
+	void Release(int32 Slot);
+
+	/** Start a new epoch: every copy enqueued so far is dropped when it completes */
+	void Invalidate();
+
+	/** Forget all slots and counters */
+	void Reset();
+
+	int32 GetNumSlots() const { return Slots.Num(); }
+	int32 GetNumInFlight() const;
+	uint32 GetEpoch() const { return Epoch; }
+	uint64 GetLastConsumedSequence() const { return LastConsumedSequence; }
+	const FGPUReadbackSlotInfo& GetSlot(int32 Slot) const { return Slots[Slot]; }
+	const FGPUReadbackChannelStats& GetStats() const { return Stats; }
+
+private:
+	/** Current epoch and newer than anything consumed */
+	bool IsConsumable(const FGPUReadbackSlotInfo& Info) const
+	{
+		return Info.Epoch == Epoch && Info.Sequence > LastConsumedSequence;
+	}
+
+	/** Free a completed slot that will not be consumed */
+	void DropCompleted(int32 Slot);
+
+	void MarkAcquired(int32 Slot, uint64 CurrentFrame);
+
+	TArray<FGPUReadbackSlotInfo> Slots;
+	FGPUReadbackChannelStats Stats;
+	uint64 NextSequence = 1;
+	uint64 LastConsumedSequence = 0;
+	uint32 Epoch = 0;
+};
+
+/**
+ * TGPUReadbackChannel
+ *
+ * One readback stream: ring + pooled staging objects (created on first use, reused every frame).
+ * StagingType needs: constructor(FName), IsReady(), Lock(uint32 NumBytes), Unlock().
+ */
+template<typename StagingType>
+class TGPUReadbackChannel
+{
+public:
+	explicit TGPUReadbackChannel(const TCHAR* InName, int32 NumSlots = FGPUReadbackRing::DefaultNumSlots)
+		: Name(InName)
+		, Ring(NumSlots)
+	{
+		Stagings.SetNum(Ring.GetNumSlots());
+	}
+
+	/**
+	 * Enqueue a copy into the next slot
+	 * @param Copy - void(StagingType&), issues the actual copy (e.g. EnqueueCopy)
+	 * @return Slot index, or INDEX_NONE if no slot was available
+	 */
+	template<typename CopyFn>
+	int32 Enqueue(uint64 FrameNumber, uint32 NumBytes, int32 Payload, uint32 UserFlags, CopyFn&& Copy)
+	{
+		const int32 Slot = Ring.BeginWrite(FrameNumber, NumBytes, Payload, UserFlags);
+		if (Slot == INDEX_NONE)
+		{
+			return INDEX_NONE;
+		}
+
+		if (!Stagings[Slot].IsValid())
+		{
+			Stagings[Slot] = MakeUnique<StagingType>(FName(*FString::Printf(TEXT("%s_%d"), *Name, Slot)));
+		}
+		Copy(*Stagings[Slot]);
+		return Slot;
+	}
+
+	/** Acquire the newest completed copy (see FGPUReadbackRing::AcquireNewest) */
+	int32 AcquireNewest(uint64 CurrentFrame)
+	{
+		return Ring.AcquireNewest(CurrentFrame, [this](int32 Slot)
+		{
+			return Stagings[Slot].IsValid() && Stagings[Slot]->IsReady();
+		});
+	}
+
+	/** Map an acquired slot (NumBytes = 0 maps the whole copy) */
+	const void* Lock(int32 Slot, uint32 NumBytes = 0)
+	{
+		check(Ring.GetSlot(Slot).State == EGPUReadbackSlotState::Acquired);
+		return Stagings[Slot]->Lock(NumBytes > 0 ? NumBytes : Ring.GetSlot(Slot).NumBytes);
+	}
+
+	void Unlock(int32 Slot)
+	{
+		Stagings[Slot]->Unlock();
+	}
+
+	void Release(int32 Slot)
+	{
+		Ring.Release(Slot);
+	}
+
+	/**
+	 * Acquire, map and hand the newest completed copy to Consume, then release it
+	 * @param Consume - void(const void* Data, const FGPUReadbackSlotInfo& Info)
+	 * @return true if a copy was consumed
+	 */
+	template<typename ConsumeFn>
+	bool ProcessNewest(uint64 CurrentFrame, ConsumeFn&& Consume)
+	{
+		const int32 Slot = AcquireNewest(CurrentFrame);
+		if (Slot == INDEX_NONE)
+		{
+			return false;
+		}
+
+		const void* Data = Lock(Slot);
+		if (Data)
+		{
+			Consume(Data, Ring.GetSlot(Slot));
+		}
+		Unlock(Slot);
+		Release(Slot);
+		return Data != nullptr;
+	}
+
+	void Invalidate() { Ring.Invalidate(); }
+
+	/** Delete staging objects and reset the ring */
+	void ReleaseResources()
+	{
+		for (TUniquePtr<StagingType>& Staging : Stagings)
+		{
+			Staging.Reset();
+		}
+		Ring.Reset();
+	}
+
+	bool HasStagingResources() const
+	{
+		return Stagings.ContainsByPredicate([](const TUniquePtr<StagingType>& Staging) { return Staging.IsValid(); });
+	}
+
+	const FString& GetName() const { return Name; }
+	const FGPUReadbackRing& GetRing() const { return Ring; }
+	const FGPUReadbackSlotInfo& GetSlotInfo(int32 Slot) const { return Ring.GetSlot(Slot); }
+	const FGPUReadbackChannelStats& GetStats() const { return Ring.GetStats(); }
+
+private:
+	FString Name;
+	FGPUReadbackRing Ring;
+	TArray<TUniquePtr<StagingType>> Stagings;
+};
+
+/**
+ * TGPUReadbackScheduler
+ *
+ * Owns all readback channels of a simulator. Channels with a consumer are polled by a single
+ * ProcessCompleted() per frame, in registration order; channels without one are driven manually.
+ */
+template<typename StagingType>
+class TGPUReadbackScheduler
+{
+public:
+	using FChannel = TGPUReadbackChannel<StagingType>;
+
+	/** Register a channel, returns its id */
+	int32 AddChannel(const TCHAR* Name, int32 NumSlots = FGPUReadbackRing::DefaultNumSlots)
+	{
+		FChannelEntry& Entry = Channels.Emplace_GetRef();
+		Entry.Channel = MakeUnique<FChannel>(Name, NumSlots);
+		return Channels.Num() - 1;
+	}
+
+	/**
+	 * Set the consumer of a channel; the mapped copy is viewed as an array of ElementType
+	 * @param Consumer - void(TConstArrayView<ElementType> Data, const FGPUReadbackSlotInfo& Info)
+	 */
+	template<typename ElementType>
+	void SetConsumer(int32 ChannelId, TFunction<void(TConstArrayView<ElementType>, const FGPUReadbackSlotInfo&)> Consumer)
+	{
+		Channels[ChannelId].Consumer = [Consumer = MoveTemp(Consumer)](const void* Data, const FGPUReadbackSlotInfo& Info)
+		{
+			Consumer(TConstArrayView<ElementType>(static_cast<const ElementType*>(Data), Info.NumBytes / sizeof(ElementType)), Info);
+		};
+	}
+
+	FChannel& GetChannel(int32 ChannelId) { return *Channels[ChannelId].Channel; }
+	const FChannel& GetChannel(int32 ChannelId) const { return *Channels[ChannelId].Channel; }
+	int32 GetNumChannels() const { return Channels.Num(); }
+
+	/**
+	 * Poll every channel that has a consumer and dispatch its newest completed copy
+	 * @return Number of consumed copies
+	 */
+	int32 ProcessCompleted(uint64 CurrentFrame)
+	{
+		int32 NumConsumed = 0;
+		for (FChannelEntry& Entry : Channels)
+		{
+			if (Entry.Consumer && Entry.Channel->ProcessNewest(CurrentFrame, Entry.Consumer))
+			{
+				++NumConsumed;
+			}
+		}
+		return NumConsumed;
+	}
+
+	/** Drop everything in flight on every channel */
+	void InvalidateAll()
+	{
+		for (FChannelEntry& Entry : Channels)
+		{
+			Entry.Channel->Invalidate();
+		}
+	}
+
+	/** Delete every staging object (channels and consumers stay registered) */
+	void ReleaseResources()
+	{
+		for (FChannelEntry& Entry : Channels)
+		{
+			Entry.Channel->ReleaseResources();
+		}
+	}
+
+private:
+	struct FChannelEntry
+	{
+		TUniquePtr<FChannel> Channel;
+		TFunction<void(const void*, const FGPUReadbackSlotInfo&)> Consumer;
+	};
+
+	TArray<FChannelEntry> Channels;
+};
+
+/**
+ * FGPUSpawnCountTracker
+ *
+ * Reconciles a count readback with spawns the GPU had not executed when the copy was taken.
+ * Every spawn batch gets a sequence number and each count copy is tagged with the last one
+ * enqueued before it; on consume only the batches after that tag are added to the GPU count.
+ * Render thread only.
+ */
+class KAWAIIFLUIDRUNTIME_API FGPUSpawnCountTracker
+{
+public:
+	/**
+	 * Record a spawn batch enqueued on the GPU
+	 * @return Sequence number of the batch
+	 */
+	uint32 RecordSpawn(int32 Count);
+
+	/** Tag for a count copy enqueued now (covers every batch recorded so far) */
+	uint32 GetSpawnSequence() const { return SpawnSequence; }
+
+	/**
+	 * Count after a copy tagged with CopySequence completed
+	 * Batches covered by the copy are forgotten; later ones are added on top of GPUCount.
+	 * @return GPUCount + pending spawns, clamped to [0, MaxCount]
+	 */
+	int32 Reconcile(uint32 CopySequence, int32 GPUCount, int32 MaxCount);
+
+	/** Forget pending batches (count replaced wholesale, copies before it are invalidated) */
+	void Reset();
+
+	int32 GetNumPendingBatches() const { return PendingBatches.Num(); }
+
+private:
+	struct FSpawnBatch
+	{
+		uint32 Sequence = 0;
+		int32 Count = 0;
+	};
+
+	/** Batches not yet covered by a consumed copy, in sequence order */
+	TArray<FSpawnBatch> PendingBatches;
+
+	/** Sequence of the last recorded batch (wraps; compared by difference) */
+	uint32 SpawnSequence = 0;
+};
+
+class FRHIGPUBufferReadback;
+
+/** Production scheduler over RHI staging buffers */
+using FGPUReadbackScheduler = TGPUReadbackScheduler<FRHIGPUBufferReadback>;
@@ -455,6 +455,16 @@ private:
 	/** Recalculate combined AABB from all owner AABBs */
 	void RecalculateCombinedAABB();
 
+	//=========================================================================
+	// Tabulated Kernels (shapes are radius-independent, uploaded once)
+	//=========================================================================
+
+	TRefCountPtr<FRDGPooledBuffer> PersistentKernelTableBuffer;
+	int32 KernelTableResolution = 0;
+
+	/** Register the kernel table buffer, uploading it on first use */
+	FRDGBufferRef GetKernelTableBuffer(FRDGBuilder& GraphBuilder, float Radius);
+
 	//=========================================================================
 	// Bone Transform Snapshot Queue (for deferred simulation execution)
 	// Prevents race condition: Game thread overwrites bone transforms before
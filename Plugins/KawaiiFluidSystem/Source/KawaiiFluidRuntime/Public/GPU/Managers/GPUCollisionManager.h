@@ -9,6 +9,7 @@
 #include "GPU/GPUFluidParticle.h"
 #include "GPU/GPUFluidSpatialData.h"
 #include "GPU/Managers/GPUCollisionFeedbackManager.h"
+#include "Collision/KawaiiFluidSDFCache.h"
 
 class FRHICommandListImmediate;
 class FRDGBuilder;
@@ -20,6 +21,7 @@ class FRDGBuilder;
  * - Bounds collision (AABB/OBB)
  * - Distance Field collision
  * - Primitive collision (Spheres, Capsules, Boxes, Convexes)
+ * - World SDF brick collision (static world geometry baked by FKawaiiFluidSDFCache)
  * - Collision feedback (GPU -> CPU readback)
  *
  * This consolidates collision logic that was previously scattered across
@@ -71,6 +73,25 @@ public:
 	/** Check if heightmap data is valid */
 	bool HasValidHeightmapData() const { return bHeightmapDataValid; }
 
+	//=========================================================================
+	// World SDF Brick Collision (static world geometry)
+	//=========================================================================
+
+	/** Enable or disable SDF brick collision */
+	void SetSDFBrickCollisionEnabled(bool bEnabled) { SDFBrickParams.bEnabled = bEnabled ? 1 : 0; }
+
+	/** Set SDF brick collision parameters */
+	void SetSDFBrickCollisionParams(const FGPUSDFBrickCollisionParams& Params) { SDFBrickParams = Params; }
+
+	/** Check if SDF brick collision is enabled */
+	bool IsSDFBrickCollisionEnabled() const { return SDFBrickParams.bEnabled != 0 && bSDFBrickDataValid; }
+
+	/**
+	 * Upload SDF bricks to GPU (buffers are rebuilt on the render thread before the next pass)
+	 * @param Data - Flattened bricks from FKawaiiFluidSDFCache::ExportBrickData (empty = no bricks)
+	 */
+	void UploadSDFBricks(FKawaiiFluidSDFBrickData&& Data);
+
 	//=========================================================================
 	// Collision Primitives
 	//=========================================================================
@@ -127,6 +148,14 @@ public:
 		const FGPUFluidSimulationParams& Params,
 		FRDGBufferRef IndirectArgsBuffer = nullptr);
 
+	/** Add SDF brick collision pass (static world geometry) */
+	void AddSDFBrickCollisionPass(
+		FRDGBuilder& GraphBuilder,
+		const FSimulationSpatialData& SpatialData,
+		int32 ParticleCount,
+		const FGPUFluidSimulationParams& Params,
+		FRDGBufferRef IndirectArgsBuffer = nullptr);
+
 	//=========================================================================
 	// Collision Feedback
 	//=========================================================================
@@ -212,6 +241,24 @@ private:
 	FTextureRHIRef HeightmapTextureRHI;
 	bool bHeightmapDataValid = false;
 
+	//=========================================================================
+	// World SDF Brick Collision
+	//=========================================================================
+
+	FGPUSDFBrickCollisionParams SDFBrickParams;
+
+	/** Bricks waiting for upload (render thread) */
+	FKawaiiFluidSDFBrickData PendingSDFBrickData;
+	bool bSDFBrickUploadPending = false;
+
+	/** Persistent brick buffers (render thread) */
+	TRefCountPtr<FRDGPooledBuffer> SDFBrickTableBuffer;
+	TRefCountPtr<FRDGPooledBuffer> SDFBrickSamplesBuffer;
+	uint32 SDFBrickTableMask = 0;
+	float SDFBrickInvVoxelSize = 0.0f;
+	int32 SDFBrickCount = 0;
+	bool bSDFBrickDataValid = false;
+
 	//=========================================================================
 	// Collision Primitives
 	//=========================================================================
@@ -5,7 +5,9 @@
 
 #include "CoreMinimal.h"
 #include "RenderGraphResources.h"
+#include "RHIResources.h"
 #include "GPU/GPUFluidParticle.h"
+#include "Core/KawaiiFluidSourceIDAllocator.h"
 #include <atomic>
 
 class FRHIGPUBufferReadback;
@@ -49,6 +51,8 @@ public:
 		ActiveGPUBrushDespawns.Empty();
 		PendingGPUSourceDespawns.Empty();
 		ActiveGPUSourceDespawns.Empty();
+		PendingGPUIDDespawns.Empty();
+		ActiveGPUIDDespawns.Empty();
 
 		bHasPendingSpawnRequests.store(false);
 		bHasPendingGPUDespawnRequests.store(false);
@@ -66,6 +70,8 @@ public:
 		ActiveGPUBrushDespawns.Empty();
 		PendingGPUSourceDespawns.Empty();
 		ActiveGPUSourceDespawns.Empty();
+		PendingGPUIDDespawns.Empty();
+		ActiveGPUIDDespawns.Empty();
 		bHasPendingGPUDespawnRequests.store(false);
 	}
 
@@ -85,7 +91,7 @@ public:
 	 * Add multiple spawn requests at once (thread-safe, more efficient)
 	 * @param Requests - Array of spawn requests
 	 */
-	void AddSpawnRequests(const TArray<FGPUSpawnRequest>& Requests);
+	void AddSpawnRequests(TConstArrayView<FGPUSpawnRequest> Requests);
 
 	/** Clear all pending spawn requests */
 	void ClearSpawnRequests();
@@ -122,6 +128,13 @@ public:
 	 */
 	void AddGPUDespawnSourceRequest(int32 SourceID);
 
+	/**
+	 * Add ID despawn requests - removes particles with matching ParticleIDs (thread-safe)
+	 * Used to replay brush stroke undo/redo records
+	 * @param ParticleIDs - Particle IDs to despawn (any order, duplicates allowed)
+	 */
+	void AddGPUDespawnIDRequests(TConstArrayView<int32> ParticleIDs);
+
 	/**
 	 * Set per-source emitter max particle count for GPU-driven recycling (thread-safe)
 	 * When set, GPU automatically removes oldest particles to keep each source under its limit
@@ -143,7 +156,7 @@ public:
 
 	/**
 	 * Add GPU-driven despawn RDG passes
-	 * Pipeline: ClearUAV(AliveMask,0) → InitAliveMask → [Brush] → [Source] → [PerSourceOldest] → UpdateSourceCounters → PrefixSum → Compact
+	 * Pipeline: ClearUAV(AliveMask,0) → InitAliveMask → [Brush] → [Source] → [ID] → [PerSourceOldest] → UpdateSourceCounters → PrefixSum → Compact
 	 * @param GraphBuilder - RDG builder
 	 * @param InOutParticleBuffer - Particle buffer (updated to compacted output)
 	 * @param InOutParticleCount - Particle count (used for dispatch, not updated by GPU)
@@ -163,7 +176,7 @@ public:
 
 	/**
 	 * Get persistent source counter buffer for RDG pass
-	 * Buffer contains [MaxSourceCount] uint32 counters, one per SourceID
+	 * Buffer contains GetSourceCounterCapacity() uint32 counters, one per SourceID
 	 */
 	TRefCountPtr<FRDGPooledBuffer> GetSourceCounterBuffer() const { return SourceCounterBuffer; }
 
@@ -173,6 +186,19 @@ public:
 	 */
 	FRDGBufferUAVRef RegisterSourceCounterUAV(FRDGBuilder& GraphBuilder);
 
+	/**
+	 * Grow the source counter buffer to cover SourceIDs [0, RequiredSlots) (render thread)
+	 * Sparse: sized to the highest SourceID in use (power of two, min 64), not MaxSourceCount.
+	 * Existing counters are copied into the grown buffer.
+	 */
+	void EnsureSourceCounterCapacity(FRDGBuilder& GraphBuilder, int32 RequiredSlots);
+
+	/** Counter slots in the source counter buffer (0 before the first spawn) */
+	int32 GetSourceCounterCapacity() const { return SourceCounterCapacity; }
+
+	/** Counters of SourceIDs [Begin, End) changed on the GPU; read back on the next EnqueueSourceCounterReadback */
+	void MarkSourceCountersDirty(int32 Begin, int32 End);
+
 	/**
 	 * Get particle count for a specific source (component)
 	 * Returns cached value from last readback (2-3 frame latency)
@@ -187,6 +213,7 @@ public:
 
 	/**
 	 * Enqueue source counter readback (call from render thread after simulation)
+	 * Copies only the dirty counter ranges (packed); skipped when no counter changed
 	 */
 	void EnqueueSourceCounterReadback(FRHICommandListImmediate& RHICmdList);
 
@@ -236,6 +263,15 @@ public:
 	 */
 	int32 AllocateParticleIDs(int32 Count) { return NextParticleID.fetch_add(Count); }
 
+	/** Make sure NextParticleID is past ParticleID (respawning recorded IDs must not collide with new ones) */
+	void ReserveParticleIDsThrough(int32 ParticleID)
+	{
+		int32 Current = NextParticleID.load();
+		while (Current <= ParticleID && !NextParticleID.compare_exchange_weak(Current, ParticleID + 1))
+		{
+		}
+	}
+
 	/** Reset NextParticleID to 0 when particle count is 0 (prevents overflow) */
 	void TryResetParticleID(int32 CurrentParticleCount)
 	{
@@ -312,24 +348,27 @@ private:
 	TArray<FGPUDespawnBrushRequest> ActiveGPUBrushDespawns;
 	TArray<int32> PendingGPUSourceDespawns;
 	TArray<int32> ActiveGPUSourceDespawns;
+	TArray<int32> PendingGPUIDDespawns;
+	TArray<int32> ActiveGPUIDDespawns;  // Sorted + unique after SwapGPUDespawnBuffers
 	mutable FCriticalSection GPUDespawnLock;
 
 	// Lock-free flag for quick pending check
 	std::atomic<bool> bHasPendingGPUDespawnRequests{false};
 
-	// Persistent buffers for Oldest despawn histogram
-	TRefCountPtr<FRDGPooledBuffer> PersistentIDHistogramBuffer;      // uint32 x 256
-	TRefCountPtr<FRDGPooledBuffer> PersistentOldestThresholdBuffer;  // uint32 x 2
-	TRefCountPtr<FRDGPooledBuffer> PersistentBoundaryCounterBuffer;  // uint32 x 1
+	// Persistent buffers for Oldest despawn histogram (indexed by source slot, sized with PerSourceRecycleCapacity)
+	TRefCountPtr<FRDGPooledBuffer> PersistentIDHistogramBuffer;      // uint32 x 256 x PerSourceRecycleCapacity
+	TRefCountPtr<FRDGPooledBuffer> PersistentOldestThresholdBuffer;  // uint32 x 2 x PerSourceRecycleCapacity
+	TRefCountPtr<FRDGPooledBuffer> PersistentBoundaryCounterBuffer;  // uint32 x PerSourceRecycleCapacity
 
 	//=========================================================================
 	// Per-Source Emitter Max (GPU-Driven Recycle)
 	//=========================================================================
-	TArray<int32> EmitterMaxCountsCPU;                                // [MaxSourceCount], 0 = no limit
+	TArray<int32> EmitterMaxCountsCPU;                                // [highest SourceID with a limit + 1], 0 = no limit
 	bool bEmitterMaxCountsDirty = false;
 	int32 ActiveEmitterMaxCount = 0;                                  // Count of non-zero entries
-	TRefCountPtr<FRDGPooledBuffer> PersistentEmitterMaxCountsBuffer;  // uint32 x MaxSourceCount
-	TRefCountPtr<FRDGPooledBuffer> PersistentPerSourceExcessBuffer;   // uint32 x MaxSourceCount
+	TRefCountPtr<FRDGPooledBuffer> PersistentEmitterMaxCountsBuffer;  // uint32 x PerSourceRecycleCapacity
+	TRefCountPtr<FRDGPooledBuffer> PersistentPerSourceExcessBuffer;   // uint32 x PerSourceRecycleCapacity
+	int32 PerSourceRecycleCapacity = 0;
 
 	//=========================================================================
 	// Particle ID Tracking
@@ -349,8 +388,17 @@ private:
 	// Source Counter (Per-Component Particle Count)
 	//=========================================================================
 
-	// GPU buffer storing per-source particle counts [MaxSourceCount]
+	// GPU buffer storing per-source particle counts [SourceCounterCapacity]
 	TRefCountPtr<FRDGPooledBuffer> SourceCounterBuffer;
+	int32 SourceCounterCapacity = 0;
+	static constexpr int32 MinSourceCounterSlots = 64;
+
+	// Counters changed since the last enqueued readback (render thread)
+	FKawaiiFluidSourceRangeSet DirtySourceRanges;
+
+	// Dirty ranges are packed back to back here before the readback copy
+	FBufferRHIRef SourceCounterGatherBuffer;
+	int32 SourceCounterGatherCapacity = 0;
 
 	// Ring buffer for async GPU→CPU readback (handles GPU latency)
 	static constexpr int32 SourceCounterRingBufferSize = 4;
@@ -358,6 +406,7 @@ private:
 	int32 SourceCounterWriteIndex = 0;  // Next slot to write (enqueue)
 	int32 SourceCounterReadIndex = 0;   // Next slot to read (process)
 	int32 SourceCounterPendingCount = 0; // Number of pending readbacks
+	TArray<TArray<FKawaiiFluidSourceRange>> SourceCounterReadbackRanges;  // Per slot: ranges packed into the copy
 
 	// CPU-cached source counts (updated from readback)
 	TArray<int32> CachedSourceCounts;
@@ -0,0 +1,147 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+// FGPUSplashManager - GPU splash candidate compaction with async readback
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderGraphResources.h"
+#include "RHIResources.h"
+#include "GPU/GPUFluidParticle.h"
+#include "Core/KawaiiFluidSplashSelector.h"
+#include <atomic>
+
+class FRHICommandListImmediate;
+class FRHIGPUBufferReadback;
+class FRDGBuilder;
+
+/**
+ * FGPUSplashManager
+ *
+ * Detects splash VFX candidates on the GPU so the game thread no longer scans every particle.
+ * Two compute passes over the particle buffer write a small, importance-sampled candidate list
+ * (see FluidSplashCompact.usf); only that list is read back (triple-buffered, no stalls).
+ *
+ * Isolation state changes are tracked per particle with EGPUParticleFlags::WasIsolated,
+ * so detection stays correct across Z-Order reordering.
+ *
+ * Buffer layout:
+ *   [Header: 16 bytes] Count, TotalWeight, Reserved x2
+ *   [Candidates: MaxCandidates x 32 bytes] FGPUSplashCandidate
+ */
+class KAWAIIFLUIDRUNTIME_API FGPUSplashManager
+{
+public:
+	FGPUSplashManager();
+	~FGPUSplashManager();
+
+	//=========================================================================
+	// Constants
+	//=========================================================================
+
+	static constexpr int32 NUM_SPLASH_BUFFERS = 3;
+
+	/** Header size: 4 uint32 (Count, TotalWeight, Reserved x2) */
+	static constexpr int32 HEADER_SIZE = 16;
+
+	/** Total buffer size in bytes */
+	static constexpr int32 BUFFER_SIZE = HEADER_SIZE + FKawaiiFluidSplashSelector::MaxCandidates * sizeof(FGPUSplashCandidate);
+
+	//=========================================================================
+	// Lifecycle
+	//=========================================================================
+
+	/** Initialize the splash manager */
+	void Initialize();
+
+	/** Release all resources */
+	void Release();
+
+	/** Check if ready */
+	bool IsReady() const { return bIsInitialized; }
+
+	//=========================================================================
+	// Configuration (game thread)
+	//=========================================================================
+
+	/** Enable or disable splash detection */
+	void SetEnabled(bool bEnabled) { bSplashEnabled.store(bEnabled); }
+
+	/** Check if splash detection is enabled */
+	bool IsEnabled() const { return bSplashEnabled.load(); }
+
+	/** Set detection settings (condition mode, thresholds, budget) */
+	void SetSettings(const FKawaiiFluidSplashSettings& InSettings);
+
+	//=========================================================================
+	// Passes and Readback (render thread)
+	//=========================================================================
+
+	/**
+	 * Add weight + compaction passes and enqueue the candidate readback
+	 * @param GraphBuilder - RDG builder
+	 * @param ParticleBuffer - Particle buffer (isolation flags are updated)
+	 * @param ParticleCountBuffer - GPU particle count buffer (indirect args + count at [6])
+	 */
+	void AddSplashCompactionPasses(
+		FRDGBuilder& GraphBuilder,
+		FRDGBufferRef ParticleBuffer,
+		FRDGBufferRef ParticleCountBuffer);
+
+	/** Process the oldest finished readback (non-blocking) */
+	void ProcessReadback();
+
+	//=========================================================================
+	// Query API (thread-safe, callable from game thread)
+	//=========================================================================
+
+	/**
+	 * Take the selected candidates of the latest readback (each readback is returned once)
+	 * @param OutCandidates - Candidates sorted by key, at most Settings.Budget
+	 * @return true if new candidates were available
+	 */
+	bool ConsumeCandidates(TArray<FGPUSplashCandidate>& OutCandidates);
+
+private:
+	/** Allocate readback objects (render thread) */
+	void AllocateReadbackObjects();
+
+	/** Release readback objects */
+	void ReleaseReadbackObjects();
+
+	//=========================================================================
+	// State
+	//=========================================================================
+
+	bool bIsInitialized = false;
+	std::atomic<bool> bSplashEnabled{false};
+
+	mutable FCriticalSection SplashLock;
+
+	/** Settings (written on game thread, copied on render thread under SplashLock) */
+	FKawaiiFluidSplashSettings Settings;
+
+	/** Hash seed; advanced once per compaction */
+	uint32 FrameIndex = 0;
+
+	//=========================================================================
+	// Async Readback Objects (triple buffered)
+	//=========================================================================
+
+	FRHIGPUBufferReadback* SplashReadbacks[NUM_SPLASH_BUFFERS] = { nullptr };
+
+	/** Enqueue order of each readback (0 = empty) */
+	uint64 ReadbackFrameNumbers[NUM_SPLASH_BUFFERS] = { 0 };
+
+	/** Budget captured when each readback was enqueued */
+	int32 ReadbackBudgets[NUM_SPLASH_BUFFERS] = { 0 };
+
+	int32 ReadbackWriteIndex = 0;
+	uint64 ReadbackFrameCounter = 0;
+
+	//=========================================================================
+	// Ready Data (guarded by SplashLock)
+	//=========================================================================
+
+	TArray<FGPUSplashCandidate> ReadyCandidates;
+	bool bHasReadyCandidates = false;
+};
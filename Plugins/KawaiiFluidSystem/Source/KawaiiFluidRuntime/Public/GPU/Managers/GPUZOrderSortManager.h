@@ -134,7 +134,10 @@ public:
 		// Optional: BoneDeltaAttachment buffer to reorder along with particles
 		FRDGBufferRef InAttachmentBuffer = nullptr,
 		FRDGBufferRef* OutSortedAttachmentBuffer = nullptr,
-		FRDGBufferRef IndirectArgsBuffer = nullptr);
+		FRDGBufferRef IndirectArgsBuffer = nullptr,
+		// Optional: Anisotropy history buffer to reorder along with particles (incremental anisotropy)
+		FRDGBufferRef InAnisotropyHistoryBuffer = nullptr,
+		FRDGBufferRef* OutSortedAnisotropyHistoryBuffer = nullptr);
 
 private:
 	//=========================================================================
@@ -169,7 +172,10 @@ private:
 		// Optional: BoneDeltaAttachment reordering
 		FRDGBufferSRVRef OldAttachmentsSRV = nullptr,
 		FRDGBufferUAVRef SortedAttachmentsUAV = nullptr,
-		FRDGBufferRef IndirectArgsBuffer = nullptr);
+		FRDGBufferRef IndirectArgsBuffer = nullptr,
+		// Optional: Anisotropy history reordering
+		FRDGBufferSRVRef OldAnisotropyHistorySRV = nullptr,
+		FRDGBufferUAVRef SortedAnisotropyHistoryUAV = nullptr);
 
 	/** Step 4: Compute Cell Start/End indices from sorted Morton codes */
 	void AddComputeCellStartEndPass(
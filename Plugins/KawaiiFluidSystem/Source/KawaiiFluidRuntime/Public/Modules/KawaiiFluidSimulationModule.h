@@ -6,6 +6,8 @@
 #include "UObject/Object.h"
 #include "Core/FluidParticle.h"
 #include "Core/KawaiiFluidSimulationTypes.h"
+#include "Core/KawaiiFluidCollisionEventQueue.h"
+#include "Core/KawaiiFluidBrushStrokeDelta.h"
 #include "Interfaces/IKawaiiFluidDataProvider.h"
 #include "GPU/GPUFluidSimulator.h"
 #include "Components/KawaiiFluidInteractionComponent.h"
@@ -14,8 +16,12 @@
 /** Collision event callback type */
 DECLARE_DELEGATE_OneParam(FOnModuleCollisionEvent, const FKawaiiFluidCollisionEvent&);
 
+/** Batched collision event callback type (all events of one frame) */
+DECLARE_DELEGATE_OneParam(FOnModuleCollisionEventBatch, TConstArrayView<FKawaiiFluidCollisionEvent>);
+
 class FSpatialHash;
 class UKawaiiFluidPresetDataAsset;
+class UKawaiiFluidPackingAsset;
 class UKawaiiFluidCollider;
 class UKawaiiFluidInteractionComponent;
 class UKawaiiFluidSimulationContext;
@@ -36,13 +42,14 @@ class AKawaiiFluidVolume;
  * - Manages Preset reference
  * - Accumulates external forces
  * - Particle spawn/despawn API
+ * - ParticleID-addressed batch edits (IKawaiiFluidParticleEditTarget, brush undo/redo)
  *
  * Usage:
  * - Included as Instanced in UKawaiiFluidComponent
  * - Blueprint functions directly callable
  */
 UCLASS(DefaultToInstanced, EditInlineNew, BlueprintType)
-class KAWAIIFLUIDRUNTIME_API UKawaiiFluidSimulationModule : public UObject, public IKawaiiFluidDataProvider
+class KAWAIIFLUIDRUNTIME_API UKawaiiFluidSimulationModule : public UObject, public IKawaiiFluidDataProvider, public IKawaiiFluidParticleEditTarget
 {
 	GENERATED_BODY()
 
@@ -380,6 +387,18 @@ public:
 	                                       FVector Velocity = FVector::ZeroVector,
 	                                       FRotator Rotation = FRotator::ZeroRotator);
 
+	/** Spawn a pre-settled packing (relaxed offline to rest density, no lattice settling)
+	 * @param Packing Baked packing asset
+	 * @param Center Packing origin
+	 * @param Velocity Initial velocity
+	 * @param Rotation Local→World rotation
+	 * @return Number of spawned particles
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Fluid")
+	int32 SpawnParticlesFromPacking(const UKawaiiFluidPackingAsset* Packing, FVector Center,
+	                                FVector Velocity = FVector::ZeroVector,
+	                                FRotator Rotation = FRotator::ZeroRotator);
+
 	//========================================
 	// Explicit Count Spawn Functions
 	//========================================
@@ -480,6 +499,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Fluid")
 	void DespawnBySourceGPU(int32 SourceID);
 
+	//~ Begin IKawaiiFluidParticleEditTarget Interface
+	virtual int32 AllocateParticleIDs(int32 Count) override;
+	virtual void SpawnParticleBlock(const FKawaiiFluidParticleBlock& Block) override;
+	virtual void DespawnParticlesByID(TConstArrayView<int32> ParticleIDs) override;
+	virtual bool CollectParticlesInSphere(const FVector& Center, float Radius, FKawaiiFluidParticleBlock& OutBlock) const override;
+	//~ End IKawaiiFluidParticleEditTarget Interface
+
+	/**
+	 * Positions of particles from every source (emitters included) within a sphere, for brush occupancy.
+	 * CollectParticlesInSphere stays limited to this module's own particles (erase/undo).
+	 * @return False if no particle data is available yet (GPU mode before the first readback)
+	 */
+	bool CollectOccupiedPositionsInSphere(const FVector& Center, float Radius, TArray<FVector3f>& OutPositions) const;
+
 	/** Get particle positions array */
 	UFUNCTION(BlueprintCallable, Category = "Fluid")
 	TArray<FVector> GetParticlePositions() const;
@@ -592,6 +625,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid|Collision")
 	bool bUseWorldCollision = true;
 
+	/** Collide with a baked sparse-brick SDF of world geometry (see FKawaiiFluidSDFCache) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid|Collision", meta = (EditCondition = "bUseWorldCollision"))
+	bool bUseWorldSDFCache = false;
+
 	//========================================
 	// Volume Visualization
 	//========================================
@@ -665,6 +702,12 @@ public:
 	/** Get collision event callback */
 	const FOnModuleCollisionEvent& GetCollisionEventCallback() const { return OnCollisionEventCallback; }
 
+	/** Set batched collision event callback (called once per frame with all accepted events) */
+	void SetCollisionEventBatchCallback(FOnModuleCollisionEventBatch InCallback) { OnCollisionEventBatchCallback = InCallback; }
+
+	/** Get event queue counters of the last processed frame */
+	const FKawaiiFluidCollisionEventStats& GetCollisionEventStats() const { return CollisionEventQueue.GetStats(); }
+
 	/** Process collision feedback (GPU + CPU unified)
 	 * Called by Subsystem after simulation. Processes both GPU buffer + CPU buffer.
 	 * @param OwnerIDToIC - OwnerID→IC map built by Subsystem (for O(1) lookup)
@@ -692,6 +735,9 @@ private:
 	/** Collision event callback */
 	FOnModuleCollisionEvent OnCollisionEventCallback;
 
+	/** Batched collision event callback */
+	FOnModuleCollisionEventBatch OnCollisionEventBatchCallback;
+
 	//========================================
 	// Data
 	//========================================
@@ -728,12 +774,15 @@ private:
 	/** Initialization state */
 	bool bIsInitialized = false;
 
-	/** Last event time per particle (for cooldown tracking) */
-	TMap<int32, float> ParticleLastEventTime;
+	/** Collision event filter, cooldown (keyed by ParticleID) and per-frame event buffer */
+	FKawaiiFluidCollisionEventQueue CollisionEventQueue;
+
+	/** GPU collision feedback copy (reused every frame) */
+	TArray<FGPUCollisionFeedback> GPUFeedbackScratch;
 
 public:
-	/** Get particle last event time map (for cooldown tracking) */
-	TMap<int32, float>& GetParticleLastEventTimeMap() { return ParticleLastEventTime; }
+	/** Get particle last event time history (for cooldown tracking) */
+	TKawaiiFluidParticleHistory<float>& GetParticleLastEventTimeHistory() { return CollisionEventQueue.GetCooldownHistory(); }
 
 	//========================================
 	// IKawaiiFluidDataProvider Interface (remaining methods)
@@ -778,6 +827,13 @@ public:
 	/** Set GPU simulation active flag */
 	void SetGPUSimulationActive(bool bActive) { bGPUSimulationActive = bActive; }
 
+	/**
+	 * CPU simulation mode (editor preview / thumbnails without a GPU simulator)
+	 * Spawn functions append to the Particles array instead of issuing GPU spawn requests
+	 */
+	void SetCPUSimulationMode(bool bEnable) { bCPUSimulationMode = bEnable; }
+	bool IsCPUSimulationMode() const { return bCPUSimulationMode; }
+
 	//========================================
 	// GPU ↔ CPU Particle Sync (PIE/Serialization)
 	//========================================
@@ -849,6 +905,15 @@ private:
 	/** GPU simulation active flag */
 	bool bGPUSimulationActive = false;
 
+	/** CPU simulation mode: spawns go to Particles (see SetCPUSimulationMode) */
+	bool bCPUSimulationMode = false;
+
+	/** Next particle ID for CPU-mode spawns */
+	int32 NextCPUParticleID = 0;
+
+	/** Append a particle to the Particles array (CPU simulation mode) */
+	int32 AddCPUParticle(const FVector& Position, const FVector& Velocity);
+
 	/** Cached simulation context pointer (owned by SimulatorSubsystem) */
 	UKawaiiFluidSimulationContext* CachedSimulationContext = nullptr;
 
@@ -4,14 +4,20 @@
 
 #include "CoreMinimal.h"
 #include "Core/FluidParticle.h"
+#include "Collision/KawaiiFluidColliderBroadphase.h"
 
 class UKawaiiFluidCollider;
+class FSPHKernelTable;
 
 /**
  * @brief Adhesion solver.
  *
  * Based on Akinci et al. 2013 "Versatile Surface Tension and Adhesion for SPH Fluids"
  * Implements fluid particle adhesion to surfaces (characters, walls, etc.)
+ *
+ * Each particle only queries the colliders found by a per-call grid broadphase, and attachment is
+ * tracked as integer owner/bone IDs (FFluidParticle::AttachedOwnerID / AttachedBoneID) in a table
+ * that lives as long as the solver.
  */
 class KAWAIIFLUIDRUNTIME_API FAdhesionSolver
 {
@@ -43,13 +49,29 @@ public:
 	 * @param Particles Particle array
 	 * @param CohesionStrength Cohesion strength
 	 * @param SmoothingRadius Kernel radius
+	 * @param KernelTable Tabulated kernels for SmoothingRadius (nullptr = analytic kernel)
+	 * @param ParticleSubset Indices of the particles that receive cohesion, e.g. FSurfaceDetector::GetSurfaceIndices (nullptr = all)
 	 */
 	void ApplyCohesion(
 		TArray<FFluidParticle>& Particles,
 		float CohesionStrength,
-		float SmoothingRadius
+		float SmoothingRadius,
+		const FSPHKernelTable* KernelTable = nullptr,
+		const TArray<int32>* ParticleSubset = nullptr
 	);
 
+	/** Query every enabled collider per particle instead of the broadphase candidates (reference path) */
+	void SetUseColliderBroadphase(bool bEnable) { bUseColliderBroadphase = bEnable; }
+
+	/** Actor of an attachment owner ID (nullptr if unknown or destroyed) */
+	AActor* GetAttachmentOwner(int32 OwnerID) const;
+
+	/** Bone name of an attachment bone ID (NAME_None if unknown) */
+	FName GetAttachmentBone(int32 BoneID) const;
+
+	/** Live actors in the attachment table */
+	int32 GetNumAttachmentOwners() const { return AttachmentOwnerIDs.Num(); }
+
 private:
 	/**
 	 * @brief Compute adhesion force with boundary surface.
@@ -69,6 +91,8 @@ private:
 	void UpdateAttachmentState(
 		FFluidParticle& Particle,
 		AActor* Collider,
+		int32 OwnerID,
+		int32 BoneID,
 		float Force,
 		float DetachThreshold,
 		FName BoneName,
@@ -76,4 +100,27 @@ private:
 		const FVector& ParticlePosition,
 		const FVector& SurfaceNormal
 	);
+
+	/** Owner ID of an actor, registering it on first use (serial only) */
+	int32 FindOrAddOwnerID(AActor* Owner);
+
+	/** Bone ID of a bone name, registering it on first use (serial only) */
+	int32 FindOrAddBoneID(FName BoneName);
+
+	/** Drop the table keys of destroyed actors (their owner IDs are not reused) */
+	void PruneDestroyedOwners();
+
+	/** Per-call collider grid */
+	FKawaiiFluidColliderBroadphase Broadphase;
+
+	bool bUseColliderBroadphase = true;
+
+	/** Owner ID per collider index of the current call (INDEX_NONE = no owner) */
+	TArray<int32> ColliderOwnerIDs;
+
+	/** Attachment table: actor <-> owner ID, bone name <-> bone ID (IDs are never reused, destroyed actors are pruned) */
+	TArray<TWeakObjectPtr<AActor>> AttachmentOwners;
+	TMap<TWeakObjectPtr<AActor>, int32> AttachmentOwnerIDs;
+	TArray<FName> AttachmentBones;
+	TMap<FName, int32> AttachmentBoneIDs;
 };
@@ -36,6 +36,21 @@ struct FSPHKernelCoeffs
 	FTensileInstabilityParams TensileParams;
 };
 
+/**
+ * Density kernel variants (compile-time feature sets of the position correction pass)
+ * Picked once per solve from the tensile parameters; a disabled feature costs nothing
+ * in the neighbor loops. Generic evaluates the features with runtime branches (reference path).
+ */
+enum class EDensityKernelVariant : uint8
+{
+	Generic,      // Runtime feature branches
+	Plain,        // No scorr
+	TensilePow2,  // scorr, n = 2
+	TensilePow4,  // scorr, n = 4 (preset default)
+	TensilePow6,  // scorr, n = 6
+	TensilePowN,  // scorr, runtime n
+};
+
 /**
  * @brief PBF density constraint solver.
  *
@@ -64,11 +79,26 @@ public:
 	void SetRestDensity(float NewRestDensity);
 	void SetEpsilon(float NewEpsilon);
 
+	/**
+	 * Specialized kernel variant for a tensile configuration (never Generic)
+	 * @param TensileParams Parameters with W_DeltaQ already computed
+	 */
+	static EDensityKernelVariant SelectKernelVariant(const FTensileInstabilityParams& TensileParams);
+
+	/** Use the specialized kernels (default) or the Generic runtime-branch path (also off when r.Fluid.CPUSpecializedKernels = 0) */
+	void SetUseSpecializedKernels(bool bEnable) { bUseSpecializedKernels = bEnable; }
+
+	/** Variant used by the last solve */
+	EDensityKernelVariant GetLastKernelVariant() const { return LastKernelVariant; }
+
 private:
 	float RestDensity;      // Rest density (kg/m³)
 	float Epsilon;          // Stability constant
 	float SmoothingRadius;  // Kernel radius (cm)
 
+	bool bUseSpecializedKernels = true;
+	EDensityKernelVariant LastKernelVariant = EDensityKernelVariant::Generic;
+
 	//========================================
 	// SoA Cache (Structure of Arrays)
 	//========================================
@@ -85,6 +115,15 @@ private:
 	void CopyToSoA(const TArray<FFluidParticle>& Particles);
 	void ApplyFromSoA(TArray<FFluidParticle>& Particles);
 
+	/** Shared body of Solve / SolveWithTensileCorrection */
+	void SolveInternal(
+		TArray<FFluidParticle>& Particles,
+		float InSmoothingRadius,
+		float InRestDensity,
+		float InCompliance,
+		float DeltaTime,
+		const FTensileInstabilityParams& TensileParams);
+
 	//========================================
 	// SIMD Optimized Functions (used internally by Solve)
 	//========================================
@@ -94,11 +133,18 @@ private:
 		const TArray<FFluidParticle>& Particles,
 		const FSPHKernelCoeffs& Coeffs);
 
-	/** Step 2: Compute position corrections (SIMD) */
+	/** Step 2: Compute position corrections (SIMD), one instantiation per kernel variant */
+	template<EDensityKernelVariant Variant>
 	void ComputeDeltaP_SIMD(
 		const TArray<FFluidParticle>& Particles,
 		const FSPHKernelCoeffs& Coeffs);
 
+	/** Step 2 dispatch */
+	void ComputeDeltaP(
+		const TArray<FFluidParticle>& Particles,
+		const FSPHKernelCoeffs& Coeffs,
+		EDensityKernelVariant Variant);
+
 	//========================================
 	// Legacy Functions (backward compatibility)
 	//========================================
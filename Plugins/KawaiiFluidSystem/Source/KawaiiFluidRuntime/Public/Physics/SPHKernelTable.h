@@ -0,0 +1,122 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+
+/**
+ * Tabulated kernels
+ * Each channel is stored as a dimensionless shape over x = r²/h² in [0, 1]; the value is
+ * Scale(h) * Shape(x), with Scale in the same units as SPHKernels (so Evaluate matches
+ * SPHKernels::Poly6 / SpikyGradient / ViscosityLaplacian / Adhesion / Cohesion).
+ *
+ * - SpikyGradient is the signed magnitude: SpikyGradient(r, h) = Evaluate(SpikyGradient, r²) * r̂
+ * - Adhesion stores the fourth power of its shape (the root has unbounded slope at both
+ *   ends of its support), extended smoothly below r = h/2; the fourth root and the support
+ *   mask are applied after interpolation
+ */
+namespace ESPHKernelChannel
+{
+	enum Type : uint8
+	{
+		Poly6,
+		SpikyGradient,
+		ViscosityLaplacian,
+		Adhesion,
+		Cohesion,
+		Count
+	};
+}
+
+enum class ESPHKernelInterpolation : uint8
+{
+	Linear,
+	Cubic,  // Catmull-Rom
+};
+
+/**
+ * Kernel table sizing
+ * @param MaxRelativeError Max |table - analytic| per channel, relative to the channel peak
+ * @param MinRadiusRatio Error is measured for r >= MinRadiusRatio * h (the sqrt-shaped Spiky and
+ *        ViscosityLaplacian channels converge only as sqrt(step) at r = 0)
+ * @param MinResolution First resolution tried (intervals per channel, power of two)
+ * @param MaxResolution Resolution cap
+ */
+struct FSPHKernelTableSettings
+{
+	float MaxRelativeError = 1e-3f;
+	float MinRadiusRatio = 0.05f;
+	int32 MinResolution = 64;
+	int32 MaxResolution = 16384;
+	ESPHKernelInterpolation Interpolation = ESPHKernelInterpolation::Linear;
+};
+
+/**
+ * Per-radius SPH kernel lookup table indexed by squared distance
+ *
+ * Shape data layout (GetShapeData, also the GPU buffer layout):
+ *   channel-major, GetChannelStride() floats per channel; sample k (x = k / Resolution)
+ *   is at [Channel * Stride + k + 1], with one padding sample on each side for cubic interpolation.
+ */
+class KAWAIIFLUIDRUNTIME_API FSPHKernelTable
+{
+public:
+	/**
+	 * Build for a kernel radius, doubling the resolution until every channel meets the error bound
+	 * @param InRadius Kernel radius (cm)
+	 * @return false if MaxResolution could not meet the bound for every channel (the table is still usable)
+	 */
+	bool Build(float InRadius, const FSPHKernelTableSettings& InSettings = FSPHKernelTableSettings());
+
+	bool IsValid() const { return Resolution > 0; }
+	float GetRadius() const { return Radius; }
+	int32 GetResolution() const { return Resolution; }
+	int32 GetChannelStride() const { return Resolution + 3; }
+	const FSPHKernelTableSettings& GetSettings() const { return Settings; }
+
+	/** Measured max error of a channel, relative to its peak */
+	float GetMaxError(ESPHKernelChannel::Type Channel) const { return MaxErrors[Channel]; }
+
+	/** Prefactor of a channel for this radius (SPHKernels units) */
+	float GetScale(ESPHKernelChannel::Type Channel) const { return Scales[Channel]; }
+
+	/** Kernel value for a squared distance (cm²); zero outside the support */
+	float Evaluate(ESPHKernelChannel::Type Channel, float R2) const;
+
+	/** Four lanes of Evaluate */
+	VectorRegister4Float Evaluate4(ESPHKernelChannel::Type Channel, VectorRegister4Float R2) const;
+
+	/** Evaluate Count squared distances (4 lanes at a time) */
+	void EvaluateBatch(ESPHKernelChannel::Type Channel, const float* R2, float* OutValues, int32 Count) const;
+
+	/** Channel-major shape samples (see class comment) */
+	const TArray<float>& GetShapeData() const { return ShapeData; }
+
+	/** Analytic shape of a channel at x = r²/h² (Adhesion: fourth power, see namespace comment) */
+	static float EvaluateShape(ESPHKernelChannel::Type Channel, float X);
+
+	/** Channel prefactors for a radius (cm) */
+	static float ComputeScale(ESPHKernelChannel::Type Channel, float InRadius);
+
+	void Reset();
+
+private:
+	/** Sample all channels at the given resolution */
+	void Sample(int32 InResolution);
+
+	/** Interpolated shape (before the Adhesion root) */
+	FORCEINLINE float InterpolateShape(ESPHKernelChannel::Type Channel, float X) const;
+
+	/** Max error of a channel against the analytic shape, relative to its peak */
+	float MeasureError(ESPHKernelChannel::Type Channel) const;
+
+	float Radius = 0.0f;
+	float InvRadiusSq = 0.0f;
+	int32 Resolution = 0;
+	FSPHKernelTableSettings Settings;
+
+	float Scales[ESPHKernelChannel::Count] = {};
+	float MaxErrors[ESPHKernelChannel::Count] = {};
+	TArray<float> ShapeData;
+};
@@ -0,0 +1,85 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/FluidParticle.h"
+
+class FKawaiiFluidCompactParticles;
+
+/**
+ * @brief Surface detection settings.
+ *
+ * A particle is on the surface when it has fewer than NeighborThreshold neighbors or when its
+ * normalized color-field gradient reaches GradientThreshold.
+ */
+struct FSurfaceDetectorSettings
+{
+	/** Kernel radius (neighbors beyond it are ignored) */
+	float SmoothingRadius = 20.0f;
+
+	/** Neighbor count (excluding the particle itself) below which a particle is surface; 0 = gradient only */
+	int32 NeighborThreshold = 0;
+
+	/**
+	 * Normalized gradient |Σ w r̂| / Σ w with the Spiky weight w = (h - r)²: 0 for a symmetric
+	 * neighborhood, 1 with all neighbors on one side. A flat face gives 0.5 in the continuum limit
+	 * and about 0.27 on a lattice at h = 2 * spacing, where the layer below it gives 0.
+	 */
+	float GradientThreshold = 0.2f;
+
+	/** Keep last frame's classification inside a hysteresis band (reads bIsSurfaceParticle) */
+	bool bTemporalCoherence = true;
+
+	/** A surface particle stays surface until its gradient drops below GradientThreshold * ExitRatio
+	    and its neighbor count reaches NeighborThreshold / ExitRatio */
+	float ExitRatio = 0.6f;
+};
+
+/**
+ * @brief Surface particle classifier.
+ *
+ * Neighbor count plus color-field gradient over the cached NeighborIndices, 4 neighbors at a time.
+ * Writes FFluidParticle::bIsSurfaceParticle (uploaded as EGPUParticleFlags::IsSurface) and an
+ * outward unit SurfaceNormal (zero for interior particles), and keeps the surface index list so
+ * surface-only passes (cohesion, splash, rendering) iterate over a fraction of the particles.
+ */
+class KAWAIIFLUIDRUNTIME_API FSurfaceDetector
+{
+public:
+	FSurfaceDetector();
+
+	/**
+	 * @brief Classify all particles.
+	 *
+	 * @param Particles Particle array (NeighborIndices must be up to date)
+	 * @param Settings Thresholds
+	 * @return Number of surface particles
+	 */
+	int32 Classify(TArray<FFluidParticle>& Particles, const FSurfaceDetectorSettings& Settings);
+
+	/**
+	 * @brief Classify all particles reading positions and last frame's surface flag from a compact
+	 * layout packed from the same particles (no position snapshot is built).
+	 * Falls back to Classify without it if Compact was not packed from this particle count.
+	 */
+	int32 Classify(TArray<FFluidParticle>& Particles, const FKawaiiFluidCompactParticles& Compact, const FSurfaceDetectorSettings& Settings);
+
+	/** Surface particle indices of the last Classify, ascending */
+	const TArray<int32>& GetSurfaceIndices() const { return SurfaceIndices; }
+
+private:
+	/** Fill SurfaceIndices from SurfaceMask */
+	int32 CollectSurfaceIndices(int32 NumParticles);
+
+	// SoA positions (reused between frames)
+	TArray<float> PosX;
+	TArray<float> PosY;
+	TArray<float> PosZ;
+
+	/** Per-particle result of the parallel pass */
+	TArray<uint8> SurfaceMask;
+
+	/** Compacted surface particle indices */
+	TArray<int32> SurfaceIndices;
+};
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Core/FluidParticle.h"
 
+class FKawaiiFluidCompactParticles;
+
 /**
  * @brief Viscosity solver.
  *
@@ -24,10 +26,56 @@ public:
 	 *
 	 * v_i = v_i + c * Σ(v_j - v_i) * W(r_ij, h)
 	 *
+	 * Neighbors are read from a float snapshot of the positions and velocities, and each
+	 * particle's new velocity is written straight to the particle, so there is no copy-back.
+	 * Work is split into contiguous ranges of equal neighbor count; every particle sums its
+	 * neighbors in a fixed order, so the result does not depend on the range or thread count.
+	 *
 	 * @param Particles Particle array
 	 * @param ViscosityCoeff Viscosity coefficient (0.0 ~ 1.0)
 	 * @param SmoothingRadius Kernel radius
+	 * @param NumWorkRanges Parallel work ranges (0 = 4 per core)
+	 */
+	void ApplyXSPH(TArray<FFluidParticle>& Particles, float ViscosityCoeff, float SmoothingRadius, int32 NumWorkRanges = 0);
+
+	/**
+	 * @brief Apply XSPH viscosity reading a compact layout packed from the same particles.
+	 *
+	 * Neighbor positions and velocities come from Compact (tile-relative floats, half velocities
+	 * converted 8 lanes at a time), so no snapshot is built. Same result as ApplyXSPH within
+	 * half-precision velocity error; the correction is added to the full-precision velocity.
+	 * Falls back to ApplyXSPH if Compact was not packed from this particle count.
 	 */
-	void ApplyXSPH(TArray<FFluidParticle>& Particles, float ViscosityCoeff, float SmoothingRadius);
+	void ApplyXSPH(TArray<FFluidParticle>& Particles, const FKawaiiFluidCompactParticles& Compact, float ViscosityCoeff, float SmoothingRadius, int32 NumWorkRanges = 0);
+
+private:
+	/**
+	 * Fill the work prefix sum (and the float snapshot if bSnapshot) in one pass over the
+	 * particles, then build the work ranges
+	 * @return Number of work ranges
+	 */
+	int32 PrepareWorkRanges(const TArray<FFluidParticle>& Particles, int32 NumWorkRanges, bool bSnapshot);
+
+	/**
+	 * Split the particles into NumRanges contiguous ranges of about equal neighbor count
+	 * (binary searches on the block-wise prefix sum filled by PrepareWorkRanges)
+	 */
+	void BuildWorkRanges(int32 NumRanges, int32 BlockSize);
+
+	// Position (relative to the first particle) and velocity snapshot read by ApplyXSPH, reused between frames
+	TArray<float> PosX;
+	TArray<float> PosY;
+	TArray<float> PosZ;
+	TArray<float> VelX;
+	TArray<float> VelY;
+	TArray<float> VelZ;
+
+	/** Running work (neighbors + 1) within each block of BlockSize particles */
+	TArray<int32> WorkPrefix;
+
+	/** Block work totals, turned into the work before each block by BuildWorkRanges */
+	TArray<int64> BlockWorkStart;
 
+	/** First particle of each work range, plus the particle count */
+	TArray<int32> RangeStart;
 };
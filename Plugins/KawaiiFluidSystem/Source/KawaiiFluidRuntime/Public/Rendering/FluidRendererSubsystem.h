@@ -7,6 +7,7 @@
 #include "Tickable.h"
 #include "FluidRenderingParameters.h"
 #include "Core/KawaiiFluidRenderingTypes.h"
+#include "Rendering/FluidShadowClusterer.h"
 #include "FluidRendererSubsystem.generated.h"
 
 class FFluidSceneViewExtension;
@@ -95,10 +96,38 @@ public:
 	 * @brief Skip factor for particle-to-instance conversion.
 	 * Value of 2 means every other particle becomes an instance.
 	 * Higher values improve performance but reduce shadow detail.
+	 * Only used when bClusterShadowProxies is disabled.
 	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ClampMin = "1", ClampMax = "10"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ClampMin = "1", ClampMax = "10", EditCondition = "!bClusterShadowProxies"))
 	int32 ParticleSkipFactor = 1;
 
+	/**
+	 * @brief Cluster particles into a sparse grid and cast shadows from one ellipsoid per occupied cell.
+	 * Instance slots stay stable across frames, so spawning/despawning particles does not rebuild the ISM.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM")
+	bool bClusterShadowProxies = true;
+
+	/**
+	 * @brief Cluster cell size near the view, in particle radii.
+	 * Larger values produce fewer, blobbier shadow ellipsoids.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ClampMin = "1.0", ClampMax = "32.0", EditCondition = "bClusterShadowProxies"))
+	float ShadowClusterSizeInRadii = 4.0f;
+
+	/**
+	 * @brief View distance (cm) where shadow clusters start to coarsen.
+	 * Cell size doubles at every further doubling of the distance. 0 disables distance LOD.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ClampMin = "0.0", EditCondition = "bClusterShadowProxies"))
+	float ShadowLODDistance = 3000.0f;
+
+	/**
+	 * @brief Highest shadow cluster LOD level (cell size = base * 2^MaxShadowLOD).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ClampMin = "0", ClampMax = "7", EditCondition = "bClusterShadowProxies"))
+	int32 MaxShadowLOD = 3;
+
 	/**
 	 * @brief Register shadow particles for aggregation.
 	 * Call this from Volume/Component Tick. Particles are aggregated per quality level
@@ -110,6 +139,13 @@ public:
 	 */
 	void RegisterShadowParticles(const FVector* ParticlePositions, int32 NumParticles, float ParticleRadius, EFluidShadowMeshQuality Quality);
 
+	/**
+	 * @brief Record a view origin used for shadow cluster LOD.
+	 * Called by the view extension on the game thread for every rendered view of this world.
+	 * @param ViewOrigin World-space view origin.
+	 */
+	void RecordShadowView(const FVector& ViewOrigin);
+
 private:
 	/** Actor that owns the ISM shadow components. */
 	UPROPERTY(Transient)
@@ -145,6 +181,18 @@ private:
 	/** Cached instance transforms for batch update. */
 	TArray<FTransform> CachedInstanceTransforms;
 
+	/** Shadow proxy clustering per quality level (stable instance slots). */
+	FFluidShadowClusterer ShadowClusterers[NUM_SHADOW_QUALITY_LEVELS];
+
+	/** View origins of the last rendered frame (LOD reference for clustering). */
+	TArray<FVector> ShadowViewLocations;
+
+	/** Frame number ShadowViewLocations was recorded in. */
+	uint64 ShadowViewFrameNumber = 0;
+
+	/** Update ISM instances from the clusterer of one quality level. */
+	void FlushClusteredShadowInstances(int32 QualityIndex, UInstancedStaticMeshComponent* ISM);
+
 	/** Flush aggregated particles to ISM components. Called in Tick. */
 	void FlushShadowInstances();
 
@@ -0,0 +1,130 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+//
+// Shadow Proxy Clustering
+// =======================
+// Builds ISM shadow proxies for a particle cloud: one ellipsoid per occupied cell of a sparse
+// grid instead of one sphere per particle.
+//
+// - Cell size grows with distance to the nearest view (LOD level = log2(distance / LODDistance),
+//   each level doubles the cell), so far fluid casts shadows from a few large ellipsoids.
+// - The LOD anchor only follows the view after it moves a fraction of LODDistance, so cluster
+//   boundaries do not shift every frame while the camera moves.
+// - Each cluster keeps its instance slot for as long as its cell stays occupied. Vacated slots are
+//   zero-scaled and reused; the instance array only grows, or is compacted when mostly empty.
+//   Spawning/despawning particles therefore updates transforms in place instead of re-adding
+//   every instance.
+//
+// Pure CPU; no UObject dependency (testable with synthetic clouds).
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Shadow clustering settings
+ * @param ClusterSizeInRadii LOD 0 cell size in particle radii
+ * @param LODDistance View distance (cm) where LOD 1 starts; each further doubling adds a level (0 = no LOD)
+ * @param MaxLOD Highest LOD level (cell size = base * 2^MaxLOD)
+ * @param CoverageSigma Ellipsoid half-extent in standard deviations of the cluster's particles
+ * @param ProxyMeshRadius Radius of the unscaled proxy sphere mesh (cm)
+ */
+struct FFluidShadowClusterSettings
+{
+	float ClusterSizeInRadii = 4.0f;
+	float LODDistance = 3000.0f;
+	int32 MaxLOD = 3;
+	float CoverageSigma = 2.0f;
+	float ProxyMeshRadius = 50.0f;
+};
+
+/** How the instance array changed during the last Update */
+enum class EFluidShadowSlotChange : uint8
+{
+	/** Same slot count; every slot can be updated in place */
+	None,
+	/** Slots [PreviousNumSlots, NumSlots) were appended; earlier slots are unchanged in index */
+	Grown,
+	/** Slots were renumbered (or shrunk); instances must be rebuilt */
+	Compacted
+};
+
+/**
+ * Sparse-grid shadow proxy builder with stable instance slots
+ */
+class KAWAIIFLUIDRUNTIME_API FFluidShadowClusterer
+{
+public:
+	/** Maximum supported MaxLOD (3 bits of the cluster key) */
+	static constexpr int32 LODLimit = 7;
+
+	/** Vacated slots tolerated before compaction (also at least the live cluster count) */
+	static constexpr int32 MinFreeSlotsBeforeCompact = 256;
+
+	/** Fraction of LODDistance the view must move before the LOD anchor follows */
+	static constexpr float AnchorHysteresis = 0.25f;
+
+	void SetSettings(const FFluidShadowClusterSettings& InSettings);
+	const FFluidShadowClusterSettings& GetSettings() const { return Settings; }
+
+	/**
+	 * Cluster one frame of particles and refresh the instance transforms
+	 * @param Positions Particle world positions
+	 * @param ParticleRadius Particle radius (cm)
+	 * @param ViewLocations Shadow-casting view origins (empty = no LOD, everything at level 0)
+	 * @return How the slot array changed since the previous Update
+	 */
+	EFluidShadowSlotChange Update(TConstArrayView<FVector> Positions, float ParticleRadius, TConstArrayView<FVector> ViewLocations);
+
+	/** Instance transforms indexed by slot (vacated slots have zero scale) */
+	const TArray<FTransform>& GetInstanceTransforms() const { return InstanceTransforms; }
+
+	/** Slot count before the last Update (valid ISM instances when the change is Grown) */
+	int32 GetPreviousNumSlots() const { return PreviousNumSlots; }
+
+	int32 GetNumSlots() const { return SlotKeys.Num(); }
+
+	/** Occupied clusters after the last Update */
+	int32 GetNumClusters() const { return ClusterToSlot.Num(); }
+
+	/** LOD level of a position relative to the current anchors */
+	int32 ComputeLOD(const FVector& Position) const;
+
+	/** Cluster key of a position (LOD level + cell) relative to the current anchors */
+	uint64 ComputeClusterKey(const FVector& Position, float ParticleRadius) const;
+
+	/** Slot of a cluster key, or INDEX_NONE if the cluster is not occupied */
+	int32 FindSlot(uint64 ClusterKey) const;
+
+	/** Drop all clusters and slots */
+	void Reset();
+
+private:
+	/** Per-slot accumulation for the current frame */
+	struct FClusterAccumulator
+	{
+		FVector3d Sum;
+		FVector3d SumSquared;
+		int32 Count;
+	};
+
+	/** Move anchors to the views if they left the hysteresis radius */
+	void UpdateAnchors(TConstArrayView<FVector> ViewLocations);
+
+	/** Slot for a key, allocating one (free list first) if the cluster is new */
+	int32 FindOrAddSlot(uint64 ClusterKey);
+
+	/** Renumber live slots densely */
+	void CompactSlots();
+
+	FFluidShadowClusterSettings Settings;
+
+	TArray<FVector> Anchors;
+
+	TMap<uint64, int32> ClusterToSlot;
+	TArray<uint64> SlotKeys;
+	TArray<int32> FreeSlots;
+	TArray<FClusterAccumulator> Accumulators;
+	TArray<FTransform> InstanceTransforms;
+
+	int32 PreviousNumSlots = 0;
+};
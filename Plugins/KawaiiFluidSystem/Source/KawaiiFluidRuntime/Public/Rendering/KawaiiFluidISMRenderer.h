@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
 #include "Components/InstancedStaticMeshComponent.h"
+#include "Core/KawaiiFluidAnisotropyBatch.h"
 #include "KawaiiFluidISMRenderer.generated.h"
 
 class IKawaiiFluidDataProvider;
@@ -19,6 +20,7 @@ class IKawaiiFluidDataProvider;
  * - High performance (GPU instancing)
  * - Custom mesh/material support
  * - Velocity-based color and rotation
+ * - Anisotropic ellipsoid instances (CPU batch, no GPU readback)
  * - Absolute world coordinates
  *
  * Note: This is NOT an ActorComponent - it's owned internally by RenderingModule.
@@ -61,6 +63,9 @@ public:
 	/** Set fluid color (creates dynamic material instance if needed) */
 	void SetFluidColor(FLinearColor Color);
 
+	/** Set preset (instance scale follows Preset->ParticleRadius) */
+	void SetPreset(class UKawaiiFluidPresetDataAsset* InPreset) { CachedPreset = InPreset; }
+
 	//========================================
 	// Debug Visualization Settings
 	//========================================
@@ -85,6 +90,9 @@ public:
 	/** Enable velocity-based rotation */
 	bool bRotateByVelocity = false;
 
+	/** Stretch each instance into its density-based ellipsoid (preset anisotropy params, overrides velocity rotation) */
+	bool bAnisotropicInstances = false;
+
 	/** Enable velocity-based color */
 	bool bColorByVelocity = false;
 
@@ -129,6 +137,12 @@ protected:
 	/** Initialize ISM component */
 	void InitializeISM();
 
+	/** CPU anisotropy for bAnisotropicInstances (grid and sorted arrays reused between frames) */
+	FKawaiiFluidAnisotropyBatch AnisotropyBatch;
+
+	/** Ellipsoid per particle of the current frame */
+	TArray<FKawaiiFluidEllipsoid> InstanceEllipsoids;
+
 	/** Load default particle mesh */
 	UStaticMesh* GetDefaultParticleMesh();
 